@@ -36,6 +36,13 @@
 #include <glm/gtc/matrix_transform.hpp>
 
 
+//[-------------------------------------------------------]
+//[ Local definitions                                     ]
+//[-------------------------------------------------------]
+static const char *COOKED_MESH_FILENAME = "../Data/Imrod/ImrodLowPoly.mesh";	/**< Cooked mesh, generated by the "MeshCooker" command line tool during the build */
+static const char *SOURCE_MESH_FILENAME = "../Data/Imrod/ImrodLowPoly.obj";		/**< Source asset of the cooked mesh, only imported in case the cooked mesh is missing */
+
+
 //[-------------------------------------------------------]
 //[ Public methods                                        ]
 //[-------------------------------------------------------]
@@ -44,14 +51,17 @@
 *    Constructor
 */
 AssimpMesh::AssimpMesh(const char *rendererName) :
-	IApplicationRenderer(rendererName),
+	IApplicationRendererToolkit(rendererName),
 	mMesh(nullptr),
 	mUniformBlockIndex(0),
 	mObjectSpaceToClipSpaceMatrixUniformHandle(NULL_HANDLE),
 	mObjectSpaceToViewSpaceMatrixUniformHandle(NULL_HANDLE),
 	mGlobalTimer(0.0f)
 {
-	// Nothing to do in here
+	for (unsigned int i = 0; i < NUMBER_OF_TEXTURES; ++i)
+	{
+		mTextureRequests[i].assimpMesh = this;
+	}
 }
 
 /**
@@ -71,7 +81,7 @@ AssimpMesh::~AssimpMesh()
 void AssimpMesh::onInitialization()
 {
 	// Call the base implementation
-	IApplicationRenderer::onInitialization();
+	IApplicationRendererToolkit::onInitialization();
 
 	// Get and check the renderer instance
 	Renderer::IRendererPtr renderer(getRenderer());
@@ -80,6 +90,17 @@ void AssimpMesh::onInitialization()
 		// Begin debug event
 		RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(renderer)
 
+		// Create the asset loader
+		// -> The assets are loaded by worker threads while the application is already running, the renderer
+		//    resources are created on the fly within "onUpdate()" by using a fixed time budget per frame
+		// -> Without renderer toolkit, the assets are loaded right away
+		RendererToolkit::IRendererToolkit *rendererToolkit = getRendererToolkit();
+		if (nullptr != rendererToolkit)
+		{
+			mAssetLoader = rendererToolkit->createAssetLoader();
+		}
+		mLoadingStopwatch.start();
+
 		// Decide which shader language should be used (for example "GLSL", "HLSL" or "Cg")
 		Renderer::IShaderLanguagePtr shaderLanguage(renderer->getShaderLanguage());
 		if (nullptr != shaderLanguage)
@@ -138,11 +159,13 @@ void AssimpMesh::onInitialization()
 					mObjectSpaceToViewSpaceMatrixUniformHandle = mProgram->getUniformHandle("ObjectSpaceToViewSpaceMatrix");
 				}
 
-				// Create mesh instance
+				// Load the mesh
 				// -> In order to keep it simple, we use simple ASCII strings as filenames which are relative to the executable
 				// -> In order to keep it simple, we provide the mesh with the program, usually you want to use a mesh
 				//    with multiple programs and therefore using multiple vertex array objects (VAO)
-				mMesh = new Mesh(*mProgram, "../Data/Imrod/ImrodLowPoly.obj");
+				// -> The build uses the "MeshCooker" command line tool to cook "ImrodLowPoly.obj" into the optimized "ImrodLowPoly.mesh" with LODs,
+				//    which is memory mapped and directly handed over to the renderer
+				loadAsset(COOKED_MESH_FILENAME, &AssimpMesh::loadMesh, &AssimpMesh::createMesh, &AssimpMesh::destroyMesh, this);
 			}
 
 			// Use texture collections when you want you exploit renderer API methods like
@@ -154,18 +177,18 @@ void AssimpMesh::onInitialization()
 				// -> No texture compression used
 				// -> The tangent space normal map is stored with three components, two would be enought to recalculate the third component within the fragment shader
 				// -> The specular map could be put into the alpha channel of the diffuse map instead of storing it as an individual texture
-				Renderer::ITexture *textures[] =
+				// -> The texture collection is created within "onAssetsLoaded()"
+				static const char *TEXTURE_FILENAMES[NUMBER_OF_TEXTURES] =
 				{
-					loadTGATexture(*renderer, "../Data/Imrod/Imrod_Diffuse.tga"),
-					loadTGATexture(*renderer, "../Data/Imrod/Imrod_Illumination.tga"),
-					loadTGATexture(*renderer, "../Data/Imrod/Imrod_norm.tga"),
-					loadTGATexture(*renderer, "../Data/Imrod/Imrod_spec.tga")
+					"../Data/Imrod/Imrod_Diffuse.tga",
+					"../Data/Imrod/Imrod_Illumination.tga",
+					"../Data/Imrod/Imrod_norm.tga",
+					"../Data/Imrod/Imrod_spec.tga"
 				};
-
-				// Create the texture collection
-				// -> The texture collection keeps a reference to the provided resources, so,
-				//    we don't need to care about the resource cleanup in here or later on
-				mTextureCollection = renderer->createTextureCollection(sizeof(textures) / sizeof(Renderer::ITexture2D *), textures);
+				for (unsigned int i = 0; i < NUMBER_OF_TEXTURES; ++i)
+				{
+					loadAsset(TEXTURE_FILENAMES[i], &AssimpMesh::loadTexture, &AssimpMesh::createTexture, &AssimpMesh::destroyTexture, &mTextureRequests[i]);
+				}
 			}
 
 			// Use sampler state collections when you want you exploit renderer API methods like
@@ -192,6 +215,16 @@ void AssimpMesh::onInitialization()
 			}
 		}
 
+		// Start loading the requested assets
+		if (nullptr != mAssetLoader)
+		{
+			mAssetLoader->start();
+		}
+		else
+		{
+			onAssetsLoaded();
+		}
+
 		// End debug event
 		RENDERER_END_DEBUG_EVENT(renderer)
 	}
@@ -202,9 +235,16 @@ void AssimpMesh::onDeinitialization()
 	// Begin debug event
 	RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(getRenderer())
 
+	// Release the asset loader, assets which are still being loaded are destroyed
+	mAssetLoader = nullptr;
+
 	// Release the used texturing resources
 	mSamplerStateCollection = nullptr;
 	mTextureCollection = nullptr;
+	for (unsigned int i = 0; i < NUMBER_OF_TEXTURES; ++i)
+	{
+		mTextureRequests[i].texture = nullptr;
+	}
 
 	// Destroy mesh instance
 	if (nullptr != mMesh)
@@ -221,7 +261,7 @@ void AssimpMesh::onDeinitialization()
 	RENDERER_END_DEBUG_EVENT(getRenderer())
 
 	// Call the base implementation
-	IApplicationRenderer::onDeinitialization();
+	IApplicationRendererToolkit::onDeinitialization();
 }
 
 void AssimpMesh::onUpdate()
@@ -234,6 +274,17 @@ void AssimpMesh::onUpdate()
 
 	// Start the stopwatch
 	mStopwatch.start();
+
+	// Create the renderer resources of the assets loaded so far, but don't stall the frame
+	if (nullptr != mAssetLoader)
+	{
+		mAssetLoader->update(static_cast<float>(MAXIMUM_LOADING_MILLISECONDS_PER_FRAME));
+		if (mAssetLoader->isFinished())
+		{
+			mAssetLoader = nullptr;
+			onAssetsLoaded();
+		}
+	}
 }
 
 void AssimpMesh::onDraw()
@@ -250,6 +301,7 @@ void AssimpMesh::onDraw()
 
 		// Set the viewport and get the aspect ratio
 		float aspectRatio = 4.0f / 3.0f;
+		unsigned int viewportHeight = 1;
 		{
 			// Get the render target with and height
 			unsigned int width  = 1;
@@ -261,6 +313,7 @@ void AssimpMesh::onDraw()
 
 				// Get the aspect ratio
 				aspectRatio = static_cast<float>(width) / height;
+				viewportHeight = height;
 			}
 		}
 
@@ -321,6 +374,9 @@ void AssimpMesh::onDraw()
 			// Draw mesh instance
 			if (nullptr != mMesh)
 			{
+				// Select the mesh LOD by using the projected screen size
+				// -> Same values as used for the object space to clip space matrix above: The mesh is scaled by 0.5, 25 units away from the camera and the vertical field of view is 45 degree
+				mMesh->selectLod(Mesh::calculatePixelsPerUnit(0.5f, 25.0f, 45.0f * 3.14159265f / 180.0f, viewportHeight));
 				mMesh->draw();
 			}
 
@@ -336,6 +392,154 @@ void AssimpMesh::onDraw()
 }
 
 
+//[-------------------------------------------------------]
+//[ Private static methods                                ]
+//[-------------------------------------------------------]
+void *AssimpMesh::loadMesh(const char *filename, void *)
+{
+	LoadedMesh *loadedMesh = new LoadedMesh;
+	loadedMesh->data		  = nullptr;
+	loadedMesh->numberOfBytes = 0;
+	if (Mesh::isCookedMesh(filename))
+	{
+		// Map the cooked mesh, the mapping is kept alive until the renderer resources have been created
+		if (loadedMesh->memoryMappedFile.open(filename))
+		{
+			return loadedMesh;
+		}
+
+		// Fall back to importing the source asset, e.g. when the examples were built without the "MeshCooker" command line tool
+		if (0 == strcmp(filename, COOKED_MESH_FILENAME))
+		{
+			OUTPUT_DEBUG_PRINTF("Cooked mesh \"%s\" not found, importing \"%s\" instead", COOKED_MESH_FILENAME, SOURCE_MESH_FILENAME)
+			loadedMesh->data = Mesh::cookMesh(SOURCE_MESH_FILENAME, loadedMesh->numberOfBytes);
+			if (nullptr != loadedMesh->data)
+			{
+				return loadedMesh;
+			}
+		}
+	}
+	else
+	{
+		// Import and cook the mesh, this is the expensive part
+		loadedMesh->data = Mesh::cookMesh(filename, loadedMesh->numberOfBytes);
+		if (nullptr != loadedMesh->data)
+		{
+			return loadedMesh;
+		}
+	}
+
+	// Error!
+	delete loadedMesh;
+	return nullptr;
+}
+
+void AssimpMesh::createMesh(void *loadedAsset, void *data)
+{
+	LoadedMesh *loadedMesh = static_cast<LoadedMesh*>(loadedAsset);
+	if (nullptr != loadedMesh)
+	{
+		AssimpMesh *assimpMesh = static_cast<AssimpMesh*>(data);
+
+		// Create the mesh instance by using the cooked mesh data
+		// -> The memory mapped cooked mesh data is directly handed over to the renderer, no copy is made
+		const bool memoryMapped = (nullptr == loadedMesh->data);
+		const void *cookedData = memoryMapped ? loadedMesh->memoryMappedFile.getData() : loadedMesh->data;
+		const unsigned int numberOfBytes = memoryMapped ? loadedMesh->memoryMappedFile.getNumberOfBytes() : loadedMesh->numberOfBytes;
+		Mesh *mesh = new Mesh(*assimpMesh->mProgram, nullptr);
+		if (mesh->loadCookedMesh(*assimpMesh->mProgram, cookedData, numberOfBytes))
+		{
+			assimpMesh->mMesh = mesh;
+		}
+		else
+		{
+			delete mesh;
+		}
+	}
+}
+
+void AssimpMesh::destroyMesh(void *loadedAsset, void *)
+{
+	// The memory mapping of a cooked mesh is closed by the destructor
+	LoadedMesh *loadedMesh = static_cast<LoadedMesh*>(loadedAsset);
+	delete [] loadedMesh->data;
+	delete loadedMesh;
+}
+
+void *AssimpMesh::loadTexture(const char *filename, void *)
+{
+	// Load and decode the image, this is the expensive part
+	LoadedTexture loadedTexture;
+	loadedTexture.data = loadTGAImage(filename, loadedTexture.width, loadedTexture.height);
+	return (nullptr != loadedTexture.data) ? new LoadedTexture(loadedTexture) : nullptr;
+}
+
+void AssimpMesh::createTexture(void *loadedAsset, void *data)
+{
+	LoadedTexture *loadedTexture = static_cast<LoadedTexture*>(loadedAsset);
+	if (nullptr != loadedTexture)
+	{
+		TextureRequest *textureRequest = static_cast<TextureRequest*>(data);
+		textureRequest->texture = createTGATexture(*textureRequest->assimpMesh->getRenderer(), loadedTexture->data, loadedTexture->width, loadedTexture->height);
+	}
+}
+
+void AssimpMesh::destroyTexture(void *loadedAsset, void *)
+{
+	LoadedTexture *loadedTexture = static_cast<LoadedTexture*>(loadedAsset);
+	free(loadedTexture->data);
+	delete loadedTexture;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+void AssimpMesh::loadAsset(const char *filename, RendererToolkit::IAssetLoader::LoadFunction loadFunction, RendererToolkit::IAssetLoader::CreateFunction createFunction, RendererToolkit::IAssetLoader::DestroyFunction destroyFunction, void *data)
+{
+	if (nullptr != mAssetLoader)
+	{
+		// Let the worker threads do the work
+		mAssetLoader->addRequest(filename, loadFunction, createFunction, destroyFunction, data);
+	}
+	else
+	{
+		// Load the asset right away
+		void *loadedAsset = loadFunction(filename, data);
+		createFunction(loadedAsset, data);
+		if (nullptr != loadedAsset)
+		{
+			destroyFunction(loadedAsset, data);
+		}
+	}
+}
+
+void AssimpMesh::onAssetsLoaded()
+{
+	// Get and check the renderer instance
+	Renderer::IRendererPtr renderer(getRenderer());
+	if (nullptr != renderer)
+	{
+		// Create the texture collection
+		// -> The texture collection keeps a reference to the provided resources, so,
+		//    we don't need to care about the resource cleanup in here or later on
+		Renderer::ITexture *textures[NUMBER_OF_TEXTURES];
+		for (unsigned int i = 0; i < NUMBER_OF_TEXTURES; ++i)
+		{
+			textures[i] = mTextureRequests[i].texture;
+		}
+		mTextureCollection = renderer->createTextureCollection(NUMBER_OF_TEXTURES, textures);
+		for (unsigned int i = 0; i < NUMBER_OF_TEXTURES; ++i)
+		{
+			mTextureRequests[i].texture = nullptr;
+		}
+	}
+
+	// Done
+	OUTPUT_DEBUG_PRINTF("Loaded the assets within %.1f ms", mLoadingStopwatch.getMilliseconds())
+}
+
+
 //[-------------------------------------------------------]
 //[ Preprocessor                                          ]
 //[-------------------------------------------------------]
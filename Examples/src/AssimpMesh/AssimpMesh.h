@@ -30,7 +30,8 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Framework/Stopwatch.h"
-#include "Framework/IApplicationRenderer.h"
+#include "Framework/MemoryMappedFile.h"
+#include "Framework/IApplicationRendererToolkit.h"
 
 
 //[-------------------------------------------------------]
@@ -61,8 +62,9 @@ class Mesh;
 *    - Diffuse, normal, specular and emissive mapping
 *    - Optimization: Cache data to not bother the renderer API to much
 *    - Open Asset Import Library (ASSIMP)
+*    - Loading assets on worker threads by using the renderer toolkit asset loader
 */
-class AssimpMesh : public IApplicationRenderer
+class AssimpMesh : public IApplicationRendererToolkit
 {
 
 
@@ -97,6 +99,93 @@ public:
 	virtual void onDraw() override;
 
 
+//[-------------------------------------------------------]
+//[ Private definitions                                   ]
+//[-------------------------------------------------------]
+private:
+	static const unsigned int NUMBER_OF_TEXTURES					  = 4;	/**< Number of textures: Diffuse, emissive, normal and specular */
+	static const unsigned int MAXIMUM_LOADING_MILLISECONDS_PER_FRAME = 4;	/**< Time budget for creating the renderer resources of loaded assets per frame */
+
+	/**
+	*  @brief
+	*    Mesh loaded into system memory
+	*
+	*  @note
+	*    - A cooked mesh is memory mapped and handed over to the renderer as it is, only other meshes are cooked into "data"
+	*/
+	struct LoadedMesh
+	{
+		MemoryMappedFile  memoryMappedFile;	/**< Memory mapped cooked mesh, not open if the mesh was cooked in memory */
+		unsigned char	 *data;				/**< Mesh cooked in memory, see "Mesh::cookMesh()", a null pointer if the cooked mesh is memory mapped */
+		unsigned int	  numberOfBytes;	/**< Number of bytes of the mesh cooked in memory */
+	};
+
+	/**
+	*  @brief
+	*    Texture loaded into system memory
+	*/
+	struct LoadedTexture
+	{
+		unsigned char *data;	/**< "Renderer::TextureFormat::R8G8B8A8" data, see "loadTGAImage()" */
+		unsigned int   width;	/**< Width in pixels */
+		unsigned int   height;	/**< Height in pixels */
+	};
+
+	/**
+	*  @brief
+	*    Texture request
+	*/
+	struct TextureRequest
+	{
+		AssimpMesh			  *assimpMesh;	/**< Owner instance, always valid */
+		Renderer::ITexturePtr  texture;		/**< The created texture, can be a null pointer */
+	};
+
+
+//[-------------------------------------------------------]
+//[ Private static methods                                ]
+//[-------------------------------------------------------]
+private:
+	// Asset loader functions, see "RendererToolkit::IAssetLoader"
+	static void *loadMesh(const char *filename, void *data);
+	static void createMesh(void *loadedAsset, void *data);
+	static void destroyMesh(void *loadedAsset, void *data);
+	static void *loadTexture(const char *filename, void *data);
+	static void createTexture(void *loadedAsset, void *data);
+	static void destroyTexture(void *loadedAsset, void *data);
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	/**
+	*  @brief
+	*    Load an asset
+	*
+	*  @param[in] filename
+	*    ASCII filename of the asset to load, must be valid
+	*  @param[in] loadFunction
+	*    Load function, must be valid
+	*  @param[in] createFunction
+	*    Create function, must be valid
+	*  @param[in] destroyFunction
+	*    Destroy function, must be valid
+	*  @param[in] data
+	*    Data to pass to the functions
+	*
+	*  @note
+	*    - The asset is added to the asset loader, in case there's no asset loader it's loaded right away
+	*/
+	void loadAsset(const char *filename, RendererToolkit::IAssetLoader::LoadFunction loadFunction, RendererToolkit::IAssetLoader::CreateFunction createFunction, RendererToolkit::IAssetLoader::DestroyFunction destroyFunction, void *data);
+
+	/**
+	*  @brief
+	*    Called as soon as all assets have been loaded
+	*/
+	void onAssetsLoaded();
+
+
 //[-------------------------------------------------------]
 //[ Private data                                          ]
 //[-------------------------------------------------------]
@@ -106,6 +195,10 @@ private:
 	Mesh								 *mMesh;					/**< Mesh instance, can be a null pointer */
 	Renderer::ITextureCollectionPtr		  mTextureCollection;		/**< Texture collection, can be a null pointer */
 	Renderer::ISamplerStateCollectionPtr  mSamplerStateCollection;	/**< Sampler state collection, can be a null pointer */
+	// Asset loading
+	RendererToolkit::IAssetLoaderPtr mAssetLoader;							/**< Asset loader, a null pointer if there's no renderer toolkit or all assets have been loaded */
+	TextureRequest					 mTextureRequests[NUMBER_OF_TEXTURES];	/**< Texture requests, the textures are put into the texture collection as soon as all assets have been loaded */
+	Stopwatch						 mLoadingStopwatch;						/**< Stopwatch measuring the loading time */
 	// Optimization: Cache data to not bother the renderer API to much
 	unsigned int mUniformBlockIndex;							/**< Uniform block index */
 	handle		 mObjectSpaceToClipSpaceMatrixUniformHandle;	/**< Object space to clip space matrix uniform handle, can be NULL_HANDLE */
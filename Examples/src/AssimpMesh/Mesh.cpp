@@ -28,11 +28,28 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "AssimpMesh/Mesh.h"
+#include "MeshCooker/MeshCooker.h"
 #include "Framework/PlatformTypes.h"
+#include "Framework/MemoryMappedFile.h"
 
-#include <assimp/scene.h>
-#include <assimp/Importer.hpp>
-#include <assimp/postprocess.h>
+#include <math.h>
+#include <string.h>
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Check whether or not the given range lies within the given total number of elements
+*
+*  @note
+*    - Uses subtraction instead of addition, so broken or malicious values can't wrap around
+*/
+static inline bool isRangeInside(unsigned int start, unsigned int count, unsigned int total)
+{
+	return (start <= total && count <= total - start);
+}
 
 
 //[-------------------------------------------------------]
@@ -44,130 +61,38 @@
 */
 Mesh::Mesh(Renderer::IProgram &program, const char *filename) :
 	mNumberOfVertices(0),
-	mNumberOfIndices(0)
+	mNumberOfIndices(0),
+	mNumberOfLods(0),
+	mLods(nullptr),
+	mCurrentLod(0),
+	mBoundingSphereRadius(0.0f)
 {
-	// Create an instance of the Assimp importer class
-	Assimp::Importer assimpImporter;
-
-	// Load the given mesh
-	// -> "aiProcess_MakeLeftHanded" is added because the rasterizer states directly map to Direct3D
-	const aiScene *assimpScene = (nullptr != filename) ? assimpImporter.ReadFile(filename, aiProcessPreset_TargetRealtime_MaxQuality | aiProcess_MakeLeftHanded) : nullptr;
-	if (nullptr != assimpScene && nullptr != assimpScene->mRootNode)
+	// Nothing to load?
+	if (nullptr == filename)
 	{
-		// Get the total number of vertices and indices by using the Assimp root node
-		getNumberOfVerticesAndIndicesRecursive(*assimpScene, *assimpScene->mRootNode, mNumberOfVertices, mNumberOfIndices);
-
-		// Allocate memory for the local vertex and index buffer data
-		float *vertexBufferData = new float[mNumberOfVertices * NUMBER_OF_COMPONENTS_PER_VERTEX];
-		unsigned short *indexBufferData = new unsigned short[mNumberOfIndices];
-
-		{ // Fill the mesh data recursively
-			unsigned int numberOfFilledVertices = 0;
-			unsigned int numberOfFilledIndices  = 0;
-			fillMeshRecursive(*assimpScene, *assimpScene->mRootNode, vertexBufferData, indexBufferData, aiMatrix4x4(), numberOfFilledVertices, numberOfFilledIndices);
-			mNumberOfVertices = numberOfFilledVertices;
-			mNumberOfIndices  = numberOfFilledIndices;
-		}
+		return;
+	}
 
-		// Get the used renderer instance
-		Renderer::IRenderer &renderer = program.getRenderer();
-
-		{ // Create vertex array object (VAO)
-			// Create the vertex buffer object (VBO)
-			Renderer::IVertexBufferPtr vertexBuffer(renderer.createVertexBuffer(sizeof(float) * NUMBER_OF_COMPONENTS_PER_VERTEX * mNumberOfVertices, vertexBufferData, Renderer::BufferUsage::STATIC_DRAW));
-
-			// Create the index buffer object (IBO)
-			Renderer::IIndexBuffer *indexBuffer = renderer.createIndexBuffer(sizeof(unsigned short) * mNumberOfIndices, Renderer::IndexBufferFormat::UNSIGNED_SHORT, indexBufferData, Renderer::BufferUsage::STATIC_DRAW);
-
-			// Please note: Storing fully featured normal, tangent and binormal is inefficient
-			// -> Normal vectors are considered to be normalized, so, we don't need to store all three components as fully featured float
-			// -> The binormal can be recalculated within a shader
-			// -> In order to keep this sample simple, we do it the classic way without mentioned optimizations
-
-			// Create vertex array object (VAO)
-			// -> The vertex array object (VAO) keeps a reference to the used vertex buffer object (VBO)
-			// -> This means that there's no need to keep an own vertex buffer object (VBO) reference
-			// -> When the vertex array object (VAO) is destroyed, it automatically decreases the
-			//    reference of the used vertex buffer objects (VBO). If the reference counter of a
-			//    vertex buffer object (VBO) reaches zero, it's automatically destroyed.
-			const Renderer::VertexArrayAttribute vertexArray[] =
-			{
-				{ // Attribute 0
-					// Data destination
-					Renderer::VertexArrayFormat::FLOAT_3,				// vertexArrayFormat (Renderer::VertexArrayFormat::Enum)
-					"Position",											// name[64] (char)
-					"POSITION",											// semantic[64] (char)
-					0,													// semanticIndex (unsigned int)
-					// Data source
-					vertexBuffer,										// vertexBuffer (Renderer::IVertexBuffer *)
-					0,													// offset (unsigned int)
-					sizeof(float) * NUMBER_OF_COMPONENTS_PER_VERTEX,	// stride (unsigned int)
-					// Data source, instancing part
-					0													// instancesPerElement (unsigned int)
-				},
-				{ // Attribute 1
-					// Data destination
-					Renderer::VertexArrayFormat::FLOAT_2,				// vertexArrayFormat (Renderer::VertexArrayFormat::Enum)
-					"TexCoord",											// name[64] (char)
-					"TEXCOORD",											// semantic[64] (char)
-					0,													// semanticIndex (unsigned int)
-					// Data source
-					vertexBuffer,										// vertexBuffer (Renderer::IVertexBuffer *)
-					sizeof(float) * 3,									// offset (unsigned int)
-					sizeof(float) * NUMBER_OF_COMPONENTS_PER_VERTEX,	// stride (unsigned int)
-					// Data source, instancing part
-					0													// instancesPerElement (unsigned int)
-				},
-				{ // Attribute 2
-					// Data destination
-					Renderer::VertexArrayFormat::FLOAT_3,				// vertexArrayFormat (Renderer::VertexArrayFormat::Enum)
-					"Tangent",											// name[64] (char)
-					"TEXCOORD",											// semantic[64] (char) - "TEXCOORD1" instead of "TANGENT" to make it also work with Cg
-					1,													// semanticIndex (unsigned int)
-					// Data source
-					vertexBuffer,										// vertexBuffer (Renderer::IVertexBuffer *)
-					sizeof(float) * 5,									// offset (unsigned int)
-					sizeof(float) * NUMBER_OF_COMPONENTS_PER_VERTEX,	// stride (unsigned int)
-					// Data source, instancing part
-					0													// instancesPerElement (unsigned int)
-				},
-				{ // Attribute 3
-					// Data destination
-					Renderer::VertexArrayFormat::FLOAT_3,				// vertexArrayFormat (Renderer::VertexArrayFormat::Enum)
-					"Binormal",											// name[64] (char)
-					"TEXCOORD",											// semantic[64] (char) - "TEXCOORD2" instead of "BINORMAL" to make it also work with Cg
-					2,													// semanticIndex (unsigned int)
-					// Data source
-					vertexBuffer,										// vertexBuffer (Renderer::IVertexBuffer *)
-					sizeof(float) * 8,									// offset (unsigned int)
-					sizeof(float) * NUMBER_OF_COMPONENTS_PER_VERTEX,	// stride (unsigned int)
-					// Data source, instancing part
-					0													// instancesPerElement (unsigned int)
-				},
-				{ // Attribute 4
-					// Data destination
-					Renderer::VertexArrayFormat::FLOAT_3,				// vertexArrayFormat (Renderer::VertexArrayFormat::Enum)
-					"Normal",											// name[64] (char)
-					"NORMAL",											// semantic[64] (char)
-					0,													// semanticIndex (unsigned int)
-					// Data source
-					vertexBuffer,										// vertexBuffer (Renderer::IVertexBuffer *)
-					sizeof(float) * 11,									// offset (unsigned int)
-					sizeof(float) * NUMBER_OF_COMPONENTS_PER_VERTEX,	// stride (unsigned int)
-					// Data source, instancing part
-					0													// instancesPerElement (unsigned int)
-				}
-			};
-			mVertexArray = program.createVertexArray(sizeof(vertexArray) / sizeof(Renderer::VertexArrayAttribute), vertexArray, indexBuffer);
+	// Cooked mesh?
+	if (isCookedMesh(filename))
+	{
+		// Map the cooked mesh, the mapping is only required until the renderer resources have been created
+		MemoryMappedFile memoryMappedFile;
+		if (memoryMappedFile.open(filename) && !loadCookedMesh(program, memoryMappedFile.getData(), memoryMappedFile.getNumberOfBytes()))
+		{
+			OUTPUT_DEBUG_PRINTF("Failed to load in the cooked mesh \"%s\"", filename)
 		}
-
-		// Destroy local vertex and input buffer data
-		delete [] vertexBufferData;
-		delete [] indexBufferData;
 	}
 	else
 	{
-		OUTPUT_DEBUG_PRINTF("Failed to load in \"%s\": %s", filename, assimpImporter.GetErrorString())
+		// Import the mesh by using Assimp and cook it in memory
+		unsigned int numberOfBytes = 0;
+		unsigned char *data = cookMesh(filename, numberOfBytes);
+		if (nullptr != data)
+		{
+			loadCookedMesh(program, data, numberOfBytes);
+			delete [] data;
+		}
 	}
 }
 
@@ -177,8 +102,61 @@ Mesh::Mesh(Renderer::IProgram &program, const char *filename) :
 */
 Mesh::~Mesh()
 {
+	// Destroy the LODs
+	delete [] mLods;
+
 	// The renderer resource pointers are released automatically
-	// Nothing to do in here
+}
+
+/**
+*  @brief
+*    Return the number of levels of detail (LOD)
+*/
+unsigned int Mesh::getNumberOfLods() const
+{
+	return mNumberOfLods;
+}
+
+/**
+*  @brief
+*    Return the LOD used by "draw()"
+*/
+unsigned int Mesh::getCurrentLod() const
+{
+	return mCurrentLod;
+}
+
+/**
+*  @brief
+*    Set the LOD used by "draw()"
+*/
+void Mesh::setCurrentLod(unsigned int lod)
+{
+	mCurrentLod = (lod < mNumberOfLods) ? lod : ((mNumberOfLods > 0) ? (mNumberOfLods - 1) : 0);
+}
+
+/**
+*  @brief
+*    Return the radius of the bounding sphere around the bounding box center
+*/
+float Mesh::getBoundingSphereRadius() const
+{
+	return mBoundingSphereRadius;
+}
+
+/**
+*  @brief
+*    Select the LOD used by "draw()" by using the projected screen size
+*/
+unsigned int Mesh::selectLod(float pixelsPerUnit, float maximumScreenSpaceError)
+{
+	// The LODs are ordered from fine to coarse and the geometric error grows with each LOD
+	mCurrentLod = 0;
+	for (unsigned int i = 1; i < mNumberOfLods && mLods[i].geometricError * pixelsPerUnit <= maximumScreenSpaceError; ++i)
+	{
+		mCurrentLod = i;
+	}
+	return mCurrentLod;
 }
 
 /**
@@ -202,167 +180,234 @@ void Mesh::draw()
 		}
 
 		// Render the specified geometric primitive, based on indexing into an array of vertices
-		renderer.drawIndexed(0, mNumberOfIndices, 0, 0, mNumberOfVertices);
+		// -> All LODs are sharing the vertex buffer, a LOD is just another index range
+		const MeshFormat::Lod &lod = mLods[mCurrentLod];
+		renderer.drawIndexed(lod.startIndexLocation, lod.numberOfIndices, 0, 0, mNumberOfVertices);
 	}
 }
 
-
-//[-------------------------------------------------------]
-//[ Private methods                                       ]
-//[-------------------------------------------------------]
 /**
 *  @brief
-*    Get the total number of vertices and indices by using a given Assimp node
+*    Create the renderer resources by using a cooked mesh
 */
-void Mesh::getNumberOfVerticesAndIndicesRecursive(const aiScene &assimpScene, const aiNode &assimpNode, unsigned int &numberOfVertices, unsigned int &numberOfIndices)
+bool Mesh::loadCookedMesh(Renderer::IProgram &program, const void *data, unsigned int numberOfBytes)
 {
-	// Loop through all meshes this node is using
-	for (unsigned int i = 0; i < assimpNode.mNumMeshes; ++i)
-	{
-		// Get the used mesh
-		const aiMesh &assimpMesh = *assimpScene.mMeshes[assimpNode.mMeshes[i]];
+	const unsigned char *cookedData = static_cast<const unsigned char*>(data);
 
-		// Update the number of vertices
-		numberOfVertices += assimpMesh.mNumVertices;
+	// Validate the header, we only support the current format version and the vertex layout this class was written for
+	if (numberOfBytes < sizeof(MeshFormat::Header))
+	{
+		// Error!
+		return false;
+	}
+	const MeshFormat::Header &header = *reinterpret_cast<const MeshFormat::Header*>(cookedData);
+	if (MeshFormat::MAGIC != header.magic || MeshFormat::VERSION != header.version || sizeof(float) * MeshFormat::NUMBER_OF_COMPONENTS_PER_VERTEX != header.numberOfBytesPerVertex)
+	{
+		// Error!
+		return false;
+	}
+	const Renderer::IndexBufferFormat::Enum indexBufferFormat = static_cast<Renderer::IndexBufferFormat::Enum>(header.indexBufferFormat);
+	if (Renderer::IndexBufferFormat::UNSIGNED_SHORT != indexBufferFormat && Renderer::IndexBufferFormat::UNSIGNED_INT != indexBufferFormat)
+	{
+		// Error!
+		return false;
+	}
+	const unsigned int numberOfBytesPerIndex = (Renderer::IndexBufferFormat::UNSIGNED_INT == indexBufferFormat) ? sizeof(unsigned int) : sizeof(unsigned short);
+
+	// Validate the tables and the data ranges against the file size
+	// -> Only divisions and subtractions, the values inside the file can't be trusted and multiplications or additions might wrap around
+	const unsigned int numberOfTableBytes = numberOfBytes - sizeof(MeshFormat::Header);
+	if (0 == header.numberOfLods || header.numberOfLods > numberOfTableBytes / sizeof(MeshFormat::Lod) ||
+		header.numberOfSubMeshes > (numberOfTableBytes - sizeof(MeshFormat::Lod) * header.numberOfLods) / header.numberOfLods / sizeof(MeshFormat::SubMesh) ||
+		header.vertexDataOffset > numberOfBytes || header.numberOfVertices > (numberOfBytes - header.vertexDataOffset) / header.numberOfBytesPerVertex ||
+		header.indexDataOffset > numberOfBytes || header.numberOfIndices > (numberOfBytes - header.indexDataOffset) / numberOfBytesPerIndex)
+	{
+		// Error! Truncated file.
+		return false;
+	}
 
-		// Loop through all mesh faces and update the number of indices
-		for (unsigned int j = 0; j < assimpMesh.mNumFaces; ++j)
+	// Validate the sub-mesh table, each sub-mesh must lie within the index data and reference existing vertices only
+	const MeshFormat::SubMesh *subMeshes = reinterpret_cast<const MeshFormat::SubMesh*>(cookedData + sizeof(MeshFormat::Header));
+	const unsigned int numberOfSubMeshes = header.numberOfSubMeshes * header.numberOfLods;
+	for (unsigned int i = 0; i < numberOfSubMeshes; ++i)
+	{
+		const MeshFormat::SubMesh &subMesh = subMeshes[i];
+		if (!isRangeInside(subMesh.startIndexLocation, subMesh.numberOfIndices, header.numberOfIndices) || !isRangeInside(subMesh.minimumIndex, subMesh.numberOfVertices, header.numberOfVertices))
 		{
-			numberOfIndices += assimpMesh.mFaces[j].mNumIndices;
+			// Error! Invalid sub-mesh.
+			return false;
 		}
 	}
 
-	// Loop through all child nodes recursively
-	for (unsigned int i = 0; i < assimpNode.mNumChildren; ++i)
+	// Validate the LOD table
+	const MeshFormat::Lod *lods = reinterpret_cast<const MeshFormat::Lod*>(subMeshes + numberOfSubMeshes);
+	for (unsigned int i = 0; i < header.numberOfLods; ++i)
 	{
-		getNumberOfVerticesAndIndicesRecursive(assimpScene, *assimpNode.mChildren[i], numberOfVertices, numberOfIndices);
+		if (!isRangeInside(lods[i].startIndexLocation, lods[i].numberOfIndices, header.numberOfIndices))
+		{
+			// Error! Invalid LOD.
+			return false;
+		}
+	}
+	mNumberOfVertices = header.numberOfVertices;
+	mNumberOfIndices  = header.numberOfIndices;
+
+	// Copy the LOD table, it's required for drawing
+	delete [] mLods;
+	mNumberOfLods = header.numberOfLods;
+	mLods = new MeshFormat::Lod[mNumberOfLods];
+	memcpy(mLods, lods, sizeof(MeshFormat::Lod) * mNumberOfLods);
+	mCurrentLod = 0;
+	mBoundingSphereRadius = header.boundingSphereRadius;
+
+	// Get the used renderer instance
+	Renderer::IRenderer &renderer = program.getRenderer();
+
+	{ // Create vertex array object (VAO)
+		// Create the vertex buffer object (VBO)
+		Renderer::IVertexBufferPtr vertexBuffer(renderer.createVertexBuffer(header.numberOfBytesPerVertex * mNumberOfVertices, cookedData + header.vertexDataOffset, Renderer::BufferUsage::STATIC_DRAW));
+
+		// Create the index buffer object (IBO)
+		Renderer::IIndexBuffer *indexBuffer = renderer.createIndexBuffer(numberOfBytesPerIndex * mNumberOfIndices, indexBufferFormat, cookedData + header.indexDataOffset, Renderer::BufferUsage::STATIC_DRAW);
+
+		// Please note: Storing fully featured normal, tangent and binormal is inefficient
+		// -> Normal vectors are considered to be normalized, so, we don't need to store all three components as fully featured float
+		// -> The binormal can be recalculated within a shader
+		// -> In order to keep this sample simple, we do it the classic way without mentioned optimizations
+
+		// Create vertex array object (VAO)
+		// -> The vertex array object (VAO) keeps a reference to the used vertex buffer object (VBO)
+		// -> This means that there's no need to keep an own vertex buffer object (VBO) reference
+		// -> When the vertex array object (VAO) is destroyed, it automatically decreases the
+		//    reference of the used vertex buffer objects (VBO). If the reference counter of a
+		//    vertex buffer object (VBO) reaches zero, it's automatically destroyed.
+		const Renderer::VertexArrayAttribute vertexArray[] =
+		{
+			{ // Attribute 0
+				// Data destination
+				Renderer::VertexArrayFormat::FLOAT_3,				// vertexArrayFormat (Renderer::VertexArrayFormat::Enum)
+				"Position",											// name[64] (char)
+				"POSITION",											// semantic[64] (char)
+				0,													// semanticIndex (unsigned int)
+				// Data source
+				vertexBuffer,										// vertexBuffer (Renderer::IVertexBuffer *)
+				0,													// offset (unsigned int)
+				header.numberOfBytesPerVertex,						// stride (unsigned int)
+				// Data source, instancing part
+				0													// instancesPerElement (unsigned int)
+			},
+			{ // Attribute 1
+				// Data destination
+				Renderer::VertexArrayFormat::FLOAT_2,				// vertexArrayFormat (Renderer::VertexArrayFormat::Enum)
+				"TexCoord",											// name[64] (char)
+				"TEXCOORD",											// semantic[64] (char)
+				0,													// semanticIndex (unsigned int)
+				// Data source
+				vertexBuffer,										// vertexBuffer (Renderer::IVertexBuffer *)
+				sizeof(float) * 3,									// offset (unsigned int)
+				header.numberOfBytesPerVertex,						// stride (unsigned int)
+				// Data source, instancing part
+				0													// instancesPerElement (unsigned int)
+			},
+			{ // Attribute 2
+				// Data destination
+				Renderer::VertexArrayFormat::FLOAT_3,				// vertexArrayFormat (Renderer::VertexArrayFormat::Enum)
+				"Tangent",											// name[64] (char)
+				"TEXCOORD",											// semantic[64] (char) - "TEXCOORD1" instead of "TANGENT" to make it also work with Cg
+				1,													// semanticIndex (unsigned int)
+				// Data source
+				vertexBuffer,										// vertexBuffer (Renderer::IVertexBuffer *)
+				sizeof(float) * 5,									// offset (unsigned int)
+				header.numberOfBytesPerVertex,						// stride (unsigned int)
+				// Data source, instancing part
+				0													// instancesPerElement (unsigned int)
+			},
+			{ // Attribute 3
+				// Data destination
+				Renderer::VertexArrayFormat::FLOAT_3,				// vertexArrayFormat (Renderer::VertexArrayFormat::Enum)
+				"Binormal",											// name[64] (char)
+				"TEXCOORD",											// semantic[64] (char) - "TEXCOORD2" instead of "BINORMAL" to make it also work with Cg
+				2,													// semanticIndex (unsigned int)
+				// Data source
+				vertexBuffer,										// vertexBuffer (Renderer::IVertexBuffer *)
+				sizeof(float) * 8,									// offset (unsigned int)
+				header.numberOfBytesPerVertex,						// stride (unsigned int)
+				// Data source, instancing part
+				0													// instancesPerElement (unsigned int)
+			},
+			{ // Attribute 4
+				// Data destination
+				Renderer::VertexArrayFormat::FLOAT_3,				// vertexArrayFormat (Renderer::VertexArrayFormat::Enum)
+				"Normal",											// name[64] (char)
+				"NORMAL",											// semantic[64] (char)
+				0,													// semanticIndex (unsigned int)
+				// Data source
+				vertexBuffer,										// vertexBuffer (Renderer::IVertexBuffer *)
+				sizeof(float) * 11,									// offset (unsigned int)
+				header.numberOfBytesPerVertex,						// stride (unsigned int)
+				// Data source, instancing part
+				0													// instancesPerElement (unsigned int)
+			}
+		};
+		mVertexArray = program.createVertexArray(sizeof(vertexArray) / sizeof(Renderer::VertexArrayAttribute), vertexArray, indexBuffer);
 	}
+
+	// Done
+	return (nullptr != mVertexArray);
 }
 
+
+//[-------------------------------------------------------]
+//[ Public static methods                                 ]
+//[-------------------------------------------------------]
 /**
 *  @brief
-*    Fill the mesh data recursively
+*    Calculate the number of pixels a mesh space unit covers on the screen when using a perspective projection
 */
-void Mesh::fillMeshRecursive(const aiScene &assimpScene, const aiNode &assimpNode, float *vertexBuffer, unsigned short *indexBuffer, const aiMatrix4x4 &assimpTransformation, unsigned int &numberOfVertices, unsigned int &numberOfIndices)
+float Mesh::calculatePixelsPerUnit(float scale, float viewSpaceDistance, float verticalFieldOfView, unsigned int viewportHeight)
 {
-	// Get the absolute transformation matrix of this Assimp node
-	const aiMatrix4x4 currentAssimpTransformation = assimpTransformation * assimpNode.mTransformation;
-	const aiMatrix3x3 currentAssimpNormalTransformation = aiMatrix3x3(currentAssimpTransformation);
-
-	// Loop through all meshes this node is using
-	for (unsigned int i = 0; i < assimpNode.mNumMeshes; ++i)
-	{
-		// Get the used mesh
-		const aiMesh &assimpMesh = *assimpScene.mMeshes[assimpNode.mMeshes[i]];
-
-		// Get the start vertex inside the our vertex buffer
-		const unsigned int starVertex = numberOfVertices;
-
-		// Loop through the Assimp mesh vertices
-		float *currentVertexBuffer = vertexBuffer + numberOfVertices * NUMBER_OF_COMPONENTS_PER_VERTEX;
-		for (unsigned int j = 0; j < assimpMesh.mNumVertices; ++j)
-		{
-			{ // Position
-				// Get the Assimp mesh vertex position
-				aiVector3D assimpVertex = assimpMesh.mVertices[j];
-
-				// Transform the Assimp mesh vertex position into global space
-				assimpVertex *= currentAssimpTransformation;
-
-				// Set our vertex buffer position
-				*currentVertexBuffer = assimpVertex.x;
-				++currentVertexBuffer;
-				*currentVertexBuffer = assimpVertex.y;
-				++currentVertexBuffer;
-				*currentVertexBuffer = assimpVertex.z;
-				++currentVertexBuffer;
-			}
-
-			{ // Texture coordinate
-				// Get the Assimp mesh vertex texture coordinate
-				aiVector3D assimpTexCoord = assimpMesh.mTextureCoords[0][j];
-
-				// Set our vertex buffer texture coordinate
-				*currentVertexBuffer = assimpTexCoord.x;
-				++currentVertexBuffer;
-				*currentVertexBuffer = assimpTexCoord.y;
-				++currentVertexBuffer;
-			}
-
-			{ // Tangent
-				// Get the Assimp mesh vertex tangent
-				aiVector3D assimpTangent = assimpMesh.mTangents[j];
-
-				// Transform the Assimp mesh vertex tangent into global space
-				assimpTangent *= currentAssimpNormalTransformation;
-
-				// Set our vertex buffer tangent
-				*currentVertexBuffer = assimpTangent.x;
-				++currentVertexBuffer;
-				*currentVertexBuffer = assimpTangent.y;
-				++currentVertexBuffer;
-				*currentVertexBuffer = assimpTangent.z;
-				++currentVertexBuffer;
-			}
-
-			{ // Binormal
-				// Get the Assimp mesh vertex binormal
-				aiVector3D assimpBinormal = assimpMesh.mBitangents[j];
-
-				// Transform the Assimp mesh vertex binormal into global space
-				assimpBinormal *= currentAssimpNormalTransformation;
-
-				// Set our vertex buffer binormal
-				*currentVertexBuffer = assimpBinormal.x;
-				++currentVertexBuffer;
-				*currentVertexBuffer = assimpBinormal.y;
-				++currentVertexBuffer;
-				*currentVertexBuffer = assimpBinormal.z;
-				++currentVertexBuffer;
-			}
+	// At the given distance, the viewport height covers "2 * distance * tan(fov / 2)" world space units
+	return scale * static_cast<float>(viewportHeight) * 0.5f / (viewSpaceDistance * tanf(verticalFieldOfView * 0.5f));
+}
 
-			{ // Normal
-				// Get the Assimp mesh vertex normal
-				aiVector3D assimpNormal = assimpMesh.mNormals[j];
+/**
+*  @brief
+*    Return whether or not the given filename is the one of a cooked mesh
+*/
+bool Mesh::isCookedMesh(const char *filename)
+{
+	const char *extension = strrchr(filename, '.');
+	return (nullptr != extension && 0 == strcmp(extension, ".mesh"));
+}
 
-				// Transform the Assimp mesh vertex normal into global space
-				assimpNormal *= currentAssimpNormalTransformation;
+/**
+*  @brief
+*    Import a mesh by using Assimp and cook it in memory
+*/
+unsigned char *Mesh::cookMesh(const char *filename, unsigned int &numberOfBytes)
+{
+	numberOfBytes = 0;
 
-				// Set our vertex buffer normal
-				*currentVertexBuffer = assimpNormal.x;
-				++currentVertexBuffer;
-				*currentVertexBuffer = assimpNormal.y;
-				++currentVertexBuffer;
-				*currentVertexBuffer = assimpNormal.z;
-				++currentVertexBuffer;
-			}
-		}
-		numberOfVertices += assimpMesh.mNumVertices;
+	// Import the mesh by using Assimp
+	// -> This is only the runtime fallback for meshes which haven't been cooked offline by the "MeshCooker" command line tool
+	MeshCooker meshCooker;
+	if (!meshCooker.loadAssimpMesh(filename))
+	{
+		// Error!
+		return nullptr;
+	}
 
-		// Loop through all Assimp mesh faces
-		unsigned short *currentIndexBuffer = indexBuffer + numberOfIndices;
-		for (unsigned int j = 0; j < assimpMesh.mNumFaces; ++j)
-		{
-			// Get the Assimp face
-			const aiFace &assimpFace = assimpMesh.mFaces[j];
-
-			// Loop through all indices of the Assimp face and set our indices
-			for (unsigned int assimpIndex = 0; assimpIndex < assimpFace.mNumIndices; ++assimpIndex, ++currentIndexBuffer)
-			{
-				//					  Assimp mesh vertex inde	  x									 Where the Assimp mesh starts within the our vertex buffer
-				*currentIndexBuffer = static_cast<unsigned short>(assimpFace.mIndices[assimpIndex] + starVertex);
-			}
+	// Optimize the mesh for the GPU, cooked meshes have already been optimized offline
+	MeshOptimizer::VertexCacheStatistics vertexCacheStatisticsBefore;
+	MeshOptimizer::VertexCacheStatistics vertexCacheStatisticsAfter;
+	meshCooker.optimize(vertexCacheStatisticsBefore, vertexCacheStatisticsAfter);
+	OUTPUT_DEBUG_PRINTF("Optimized \"%s\": ACMR %.3f -> %.3f, ATVR %.3f -> %.3f", filename, vertexCacheStatisticsBefore.acmr, vertexCacheStatisticsAfter.acmr, vertexCacheStatisticsBefore.atvr, vertexCacheStatisticsAfter.atvr)
 
-			// Update the number if processed indices
-			numberOfIndices += assimpFace.mNumIndices;
-		}
-	}
+	// Generate the LODs, each one halves the number of triangles
+	meshCooker.generateLods(4);
 
-	// Loop through all child nodes recursively
-	for (unsigned int assimpChild = 0; assimpChild < assimpNode.mNumChildren; ++assimpChild)
-	{
-		fillMeshRecursive(assimpScene, *assimpNode.mChildren[assimpChild], vertexBuffer, indexBuffer, currentAssimpTransformation, numberOfVertices, numberOfIndices);
-	}
+	// Cook the mesh in memory
+	return meshCooker.serialize(numberOfBytes);
 }
 
 
@@ -29,6 +29,8 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "MeshCooker/MeshFormat.h"
+
 #include <Renderer/Renderer.h>
 
 #include <assimp/vector3.h>	// Required by "assimp/matrix4x4.h" below
@@ -65,6 +67,10 @@ public:
 	*    Program instance to use
 	*  @param[in] filename
 	*    ASCII filename of the mesh to load in, in case of a null pointer nothing is loaded
+	*
+	*  @note
+	*    - Cooked meshes (".mesh" filename extension, see "MeshCooker/MeshFormat.h") are memory mapped and handed over to the renderer as they are
+	*    - Other meshes are loaded by using Assimp, this is considerably slower, use the "MeshCooker" command line tool to cook them
 	*/
 	Mesh(Renderer::IProgram &program, const char *filename);
 
@@ -76,66 +82,151 @@ public:
 
 	/**
 	*  @brief
-	*    Draw the mesh
+	*    Return the number of levels of detail (LOD)
+	*
+	*  @return
+	*    The number of LODs, LOD 0 is the original mesh, 0 if no mesh is loaded
 	*/
-	void draw();
+	unsigned int getNumberOfLods() const;
 
+	/**
+	*  @brief
+	*    Return the LOD used by "draw()"
+	*
+	*  @return
+	*    The LOD used by "draw()"
+	*/
+	unsigned int getCurrentLod() const;
 
-//[-------------------------------------------------------]
-//[ Private definitions                                   ]
-//[-------------------------------------------------------]
-private:
-	static const unsigned int NUMBER_OF_COMPONENTS_PER_VERTEX = 14;	/**< Number of components per vertex (3 position, 2 texture coordinate, 3 tangent, 3 binormal, 3 normal) */
+	/**
+	*  @brief
+	*    Set the LOD used by "draw()"
+	*
+	*  @param[in] lod
+	*    LOD to use, clamped to the available LODs
+	*/
+	void setCurrentLod(unsigned int lod);
+
+	/**
+	*  @brief
+	*    Return the radius of the bounding sphere around the bounding box center
+	*
+	*  @return
+	*    The bounding sphere radius in mesh space
+	*/
+	float getBoundingSphereRadius() const;
+
+	/**
+	*  @brief
+	*    Select the LOD used by "draw()" by using the projected screen size
+	*
+	*  @param[in] pixelsPerUnit
+	*    Number of pixels a mesh space unit covers on the screen at the mesh position, see "calculatePixelsPerUnit()"
+	*  @param[in] maximumScreenSpaceError
+	*    Maximum tolerated geometric error in pixels
+	*
+	*  @return
+	*    The selected LOD, the coarsest one which geometric error projected onto the screen stays within the given maximum
+	*
+	*  @remarks
+	*    Call this method once per frame before "draw()". The projected size of the whole mesh is
+	*    "getBoundingSphereRadius() * pixelsPerUnit", the geometric error of each LOD is projected the same way.
+	*/
+	unsigned int selectLod(float pixelsPerUnit, float maximumScreenSpaceError = 1.0f);
+
+	/**
+	*  @brief
+	*    Draw the mesh by using the current LOD
+	*/
+	void draw();
+
+	/**
+	*  @brief
+	*    Create the renderer resources by using a cooked mesh
+	*
+	*  @param[in] program
+	*    Program instance to use
+	*  @param[in] data
+	*    Cooked mesh data as described in "MeshCooker/MeshFormat.h", must be valid
+	*  @param[in] numberOfBytes
+	*    Number of bytes of the cooked mesh data
+	*
+	*  @return
+	*    "true" if all went fine, else "false"
+	*
+	*  @note
+	*    - The vertex and index data is directly handed over to the renderer, no copy is made
+	*/
+	bool loadCookedMesh(Renderer::IProgram &program, const void *data, unsigned int numberOfBytes);
 
 
 //[-------------------------------------------------------]
-//[ Private methods                                       ]
+//[ Public static methods                                 ]
 //[-------------------------------------------------------]
-private:
+public:
+	/**
+	*  @brief
+	*    Calculate the number of pixels a mesh space unit covers on the screen when using a perspective projection
+	*
+	*  @param[in] scale
+	*    Uniform mesh space to world space scale
+	*  @param[in] viewSpaceDistance
+	*    Distance between the camera and the mesh in view space, must be above zero
+	*  @param[in] verticalFieldOfView
+	*    Vertical field of view in radian
+	*  @param[in] viewportHeight
+	*    Viewport height in pixels
+	*
+	*  @return
+	*    Number of pixels a mesh space unit covers on the screen
+	*/
+	static float calculatePixelsPerUnit(float scale, float viewSpaceDistance, float verticalFieldOfView, unsigned int viewportHeight);
+
 	/**
 	*  @brief
-	*    Get the total number of vertices and indices by using a given Assimp node
-	*
-	*  @param[in]  assimpScene
-	*    Assimp scene
-	*  @param[in]  assimpNode
-	*    Assimp node to gather the data from
-	*  @param[out] numberOfVertices
-	*    Receives the number of vertices
-	*  @param[out] numberOfIndices
-	*    Receives the number of indices
+	*    Return whether or not the given filename is the one of a cooked mesh
+	*
+	*  @param[in] filename
+	*    ASCII filename of the mesh, must be valid
+	*
+	*  @return
+	*    "true" if the filename has the ".mesh" extension, else "false"
+	*
+	*  @note
+	*    - Cooked meshes are already in the format "loadCookedMesh()" expects, memory map them by using "MemoryMappedFile" instead of using "cookMesh()"
 	*/
-	void getNumberOfVerticesAndIndicesRecursive(const aiScene &assimpScene, const aiNode &assimpNode, unsigned int &numberOfVertices, unsigned int &numberOfIndices);
+	static bool isCookedMesh(const char *filename);
 
 	/**
 	*  @brief
-	*    Fill the mesh data recursively
-	*
-	*  @param[in]  assimpScene
-	*    Assimp scene
-	*  @param[in]  assimpNode
-	*    Assimp node to gather the data from
-	*  @param[in]  vertexBuffer
-	*    Vertex buffer to fill
-	*  @param[in]  indexBuffer
-	*    Index buffer to fill
-	*  @param[in]  assimpTransformation
-	*    Current absolute Assimp transformation matrix (local to global space)
-	*  @param[out] numberOfVertices
-	*    Receives the number of processed vertices
-	*  @param[out] numberOfIndices
-	*    Receives the number of processed indices
+	*    Import a mesh by using Assimp and cook it in memory
+	*
+	*  @param[in]  filename
+	*    ASCII filename of the mesh to import, must be valid and no cooked mesh (see "isCookedMesh()")
+	*  @param[out] numberOfBytes
+	*    Receives the number of bytes of the cooked mesh data
+	*
+	*  @return
+	*    The cooked mesh data as described in "MeshCooker/MeshFormat.h", destroy it by using "delete []", a null pointer on error
+	*
+	*  @note
+	*    - The mesh is optimized, LODs are generated and the result is cooked in memory
+	*    - The renderer isn't used, so meshes can be loaded by multiple threads at the same time, use "loadCookedMesh()" on the result
 	*/
-	void fillMeshRecursive(const aiScene &assimpScene, const aiNode &assimpNode, float *vertexBuffer, unsigned short *indexBuffer, const aiMatrix4x4 &assimpTransformation, unsigned int &numberOfVertices, unsigned int &numberOfIndices);
+	static unsigned char *cookMesh(const char *filename, unsigned int &numberOfBytes);
 
 
 //[-------------------------------------------------------]
 //[ Private data                                          ]
 //[-------------------------------------------------------]
 private:
-	unsigned int			  mNumberOfVertices;	/**< Number of vertices */
-	unsigned int			  mNumberOfIndices;		/**< Number of indices */
-	Renderer::IVertexArrayPtr mVertexArray;			/**< Vertex array object (VAO), can be a null pointer */
+	unsigned int			  mNumberOfVertices;		/**< Number of vertices */
+	unsigned int			  mNumberOfIndices;			/**< Number of indices of all LODs */
+	unsigned int			  mNumberOfLods;			/**< Number of LODs */
+	MeshFormat::Lod			 *mLods;					/**< LODs, can be a null pointer */
+	unsigned int			  mCurrentLod;				/**< LOD used by "draw()" */
+	float					  mBoundingSphereRadius;	/**< Bounding sphere radius in mesh space */
+	Renderer::IVertexArrayPtr mVertexArray;				/**< Vertex array object (VAO), can be a null pointer */
 
 
 };
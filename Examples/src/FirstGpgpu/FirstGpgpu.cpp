@@ -23,6 +23,7 @@
 //[-------------------------------------------------------]
 #include "FirstGpgpu/FirstGpgpu.h"
 #include "Framework/Color4.h"
+#include "Framework/PlatformTypes.h"	// For "OUTPUT_DEBUG_PRINTF()"
 #include "Framework/IApplicationRenderer.h"
 
 #include <string.h>
@@ -162,6 +163,10 @@ void FirstGpgpu::onInitialization()
 		mFramebuffer[i] = mRenderer->createFramebuffer(1, &texture2D);
 	}
 
+	// Create the staging 2D texture instance used for reading back the processed content
+	// -> Staging resources can't be bound to the pipeline, the GPU can only copy into them and the CPU can map them for reading
+	mTexture2DStaging = mRenderer->createTexture2D(64, 64, Renderer::TextureFormat::R8G8B8A8, nullptr, 0, Renderer::TextureUsage::STAGING);
+
 	{ // Create sampler state
 		// -> Our texture does not have any mipmaps, set "Renderer::SamplerState::maxLOD" to zero
 		//    in order to ensure a correct behaviour across the difference graphics APIs
@@ -309,6 +314,7 @@ void FirstGpgpu::onDeinitialization()
 	mProgramContentGeneration = nullptr;
 	mDepthStencilState = nullptr;
 	mSamplerState = nullptr;
+	mTexture2DStaging = nullptr;
 	for (int i = 0; i < 2; ++i)
 	{
 		mFramebuffer[i] = nullptr;
@@ -336,18 +342,59 @@ void FirstGpgpu::onDoJob()
 	// -> After this step, "mTexture2D[1]" holds the processed content
 	contentProcessing();
 
-	// TODO(co) "Renderer::IRenderer::map()"/"Renderer::IRenderer::unmap()" are currently under construction
-	// Map the texture holding the processed content
-	Renderer::MappedSubresource mappedSubresource;
-	if (mRenderer->map(*mTexture2D[1], 0, Renderer::MapType::READ, 0, mappedSubresource))
+	// Read back the processed content
+	// -> Copy the processed content into the staging 2D texture, the copy is performed asynchronously by the GPU
+	// -> Insert a fence right after the copy, the CPU could do other work until the fence is signaled
+	//    instead of stalling the pipeline by mapping a resource the GPU is still working on
+	if (nullptr != mTexture2DStaging && mRenderer->copyResource(*mTexture2DStaging, *mTexture2D[1]))
 	{
-		// Get the processed content pointer
-//		const unsigned char *data = static_cast<unsigned char*>(mappedSubresource.data);
-
-		// TODO(co) Write it out as image?
+		// Wait until the GPU is done with the copy (blocking wait, a real-time application would poll "Renderer::IRenderer::isFenceSignaled()" once per frame)
+		// -> When there's no fence support, fall back to a full pipeline flush
+		bool copyDone = true;
+		Renderer::IFencePtr fence(mRenderer->insertFence());
+		if (nullptr != fence)
+		{
+			copyDone = mRenderer->waitFence(*fence);
+		}
+		else
+		{
+			mRenderer->finish();
+		}
+		if (copyDone)
+		{
+			// Map the staging texture holding the processed content
+			Renderer::MappedSubresource mappedSubresource;
+			if (mRenderer->map(*mTexture2DStaging, 0, Renderer::MapType::READ, 0, mappedSubresource))
+			{
+				// Validate the processed content
+				// -> The generated content is a green triangle on a blue background, the processing only distorts it
+				// -> So every processed RGBA texel must have no red and full alpha, no matter how the sampler blended green and blue
+				const unsigned char *data = static_cast<unsigned char*>(mappedSubresource.data);
+				if (nullptr != data)
+				{
+					const unsigned int rowPitch = (0 != mappedSubresource.rowPitch) ? mappedSubresource.rowPitch : 64 * 4;
+					unsigned int numberOfInvalidTexels = 0;
+					for (unsigned int y = 0; y < 64; ++y)
+					{
+						const unsigned char *texel = data + y * rowPitch;
+						for (unsigned int x = 0; x < 64; ++x, texel += 4)
+						{
+							if (0 != texel[0] || 255 != texel[3])
+							{
+								++numberOfInvalidTexels;
+							}
+						}
+					}
+					if (0 != numberOfInvalidTexels)
+					{
+						OUTPUT_DEBUG_PRINTF("Error: %u of the processed texels have unexpected values\n", numberOfInvalidTexels)
+					}
+				}
 
-		// Unmap the texture holding the processed content
-		mRenderer->unmap(*mTexture2D[1], 0);
+				// Unmap the staging texture holding the processed content
+				mRenderer->unmap(*mTexture2DStaging, 0);
+			}
+		}
 	}
 
 	// End debug event
@@ -47,6 +47,7 @@
 *    - Sampler state object
 *    - Vertex shader (VS) and fragment shader (FS)
 *    - Framebuffer object (FBO) used for render to texture
+*    - Staging 2D texture, resource copy and fence used for asynchronous GPU to CPU readback
 *    - Depth stencil state object
 *    - General Purpose Computation on Graphics Processing Unit (GPGPU) by using the renderer interface and shaders without having any output window
 */
@@ -142,6 +143,7 @@ private:
 	Renderer::IRendererPtr			mRenderer;			/**< Renderer instance, can be a null pointer */
 	Renderer::ITexture2DPtr			mTexture2D[2];		/**< 2D texture, can be a null pointer */
 	Renderer::IFramebufferPtr		mFramebuffer[2];	/**< Framebuffer object (FBO), can be a null pointer */
+	Renderer::ITexture2DPtr			mTexture2DStaging;	/**< Staging 2D texture used for reading back the processed content, can be a null pointer */
 	Renderer::ISamplerStatePtr		mSamplerState;		/**< Sampler state, can be a null pointer */
 	Renderer::IDepthStencilStatePtr	mDepthStencilState;	/**< Depth stencil state, can be a null pointer */
 	// Content generation
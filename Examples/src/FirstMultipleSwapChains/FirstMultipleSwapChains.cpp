@@ -327,6 +327,40 @@ void FirstMultipleSwapChains::onDeinitialization()
 	IApplicationRenderer::onDeinitialization();
 }
 
+void FirstMultipleSwapChains::onDrawRequest()
+{
+	// Get and check the renderer instance
+	Renderer::IRendererPtr renderer(getRenderer());
+	if (nullptr != renderer)
+	{
+		// Get the main swap chain and ensure there's one
+		Renderer::ISwapChainPtr mainSwapChain(renderer->getMainSwapChain());
+		if (nullptr != mainSwapChain)
+		{
+			// Begin debug event
+			RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(renderer)
+
+			// Make the main swap chain to the current render target
+			renderer->omSetRenderTarget(mainSwapChain);
+
+			// Call the draw method, renders into all swap chains
+			onDraw();
+
+			// Draw the overlay
+			onDrawOverlay();
+
+			// Present the content of the current back buffers of all swap chains at once at the end of the frame
+			// -> Render into all swap chains first and present them afterwards, the renderer is then able to batch the presents
+			//    (e.g. OpenGL doesn't need to switch the native window its single, shared render context is bound to)
+			Renderer::ISwapChain *swapChains[2] = { mainSwapChain, mSwapChain };
+			renderer->presentSwapChains((nullptr != mSwapChain) ? 2u : 1u, swapChains);
+
+			// End debug event
+			RENDERER_END_DEBUG_EVENT(renderer)
+		}
+	}
+}
+
 void FirstMultipleSwapChains::onDraw()
 {
 	// Get and check the renderer instance
@@ -343,7 +377,7 @@ void FirstMultipleSwapChains::onDraw()
 
 		// Debug methods: When using Direct3D <11.1, these methods map to the Direct3D 9 PIX functions
 		// (D3DPERF_* functions, also works directly within VisualStudio 2012 out-of-the-box)
-		// -> In this example we're using multiple swap chains and calling "Renderer::ISwapChain::present()" twice per application
+		// -> In this example we're using multiple swap chains and presenting two of them per application frame
 		// -> Usually, a swap chain present is interpreted by the debug/profile tool as a single frame, which is of course correct
 		// -> In this example this behaviour makes it difficult to catch the desired frame of the desired native OS window
 
@@ -395,9 +429,6 @@ void FirstMultipleSwapChains::onDraw()
 			// Restore the previously set render target
 			renderer->omSetRenderTarget(renderTarget);
 
-			// Present the content of the current back buffer
-			mSwapChain->present();
-
 			// End debug event
 			RENDERER_END_DEBUG_EVENT(renderer)
 		}
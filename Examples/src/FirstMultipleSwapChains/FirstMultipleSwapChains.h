@@ -45,6 +45,7 @@
 *    - Vertex array object (VAO)
 *    - Vertex shader (VS) and fragment shader (FS)
 *    - Multiple swap chains
+*    - Presenting multiple swap chains at once
 *
 *  @note
 *    - This example is intentionally using OS dependant native window
@@ -81,6 +82,7 @@ public:
 public:
 	virtual void onInitialization() override;
 	virtual void onDeinitialization() override;
+	virtual void onDrawRequest() override;
 	virtual void onDraw() override;
 
 
@@ -37,6 +37,7 @@
 	#include <stdio.h>
 #endif
 
+#include <stdlib.h>
 #include <string.h>
 
 
@@ -85,6 +86,24 @@ void IApplicationRenderer::onInitialization()
 		};
 		mRenderer->rsSetViewports(1, &viewport);
 
+		// Frame pacing of the main swap chain in case the environment variables "RENDERER_SWAP_INTERVAL" (e.g. "0" for no vertical
+		// synchronization, "1" for vertical synchronization and "-1" for adaptive vertical synchronization) and
+		// "RENDERER_MAXIMUM_FRAME_LATENCY" (e.g. "1" for the lowest input latency) are set
+		Renderer::ISwapChain *swapChain = mRenderer->getMainSwapChain();
+		if (nullptr != swapChain)
+		{
+			const char *swapInterval = getenv("RENDERER_SWAP_INTERVAL");
+			if (nullptr != swapInterval && '\0' != swapInterval[0] && !swapChain->setSwapInterval(atoi(swapInterval)))
+			{
+				OUTPUT_DEBUG_PRINTF("The swap interval %s is not supported", swapInterval)
+			}
+			const char *maximumFrameLatency = getenv("RENDERER_MAXIMUM_FRAME_LATENCY");
+			if (nullptr != maximumFrameLatency && '\0' != maximumFrameLatency[0])
+			{
+				swapChain->setMaximumFrameLatency(static_cast<unsigned int>(atoi(maximumFrameLatency)));
+			}
+		}
+
 		// End debug event
 		RENDERER_END_DEBUG_EVENT(mRenderer)
 	}
@@ -184,6 +203,9 @@ void IApplicationRenderer::onDrawRequest()
 			// Call the draw method
 			onDraw();
 
+			// Draw the overlay
+			onDrawOverlay();
+
 			// Present the content of the current back buffer
 			swapChain->present();
 
@@ -194,6 +216,15 @@ void IApplicationRenderer::onDrawRequest()
 }
 
 
+//[-------------------------------------------------------]
+//[ Protected virtual IApplicationRenderer methods        ]
+//[-------------------------------------------------------]
+void IApplicationRenderer::onDrawOverlay()
+{
+	// Nothing to do in here
+}
+
+
 //[-------------------------------------------------------]
 //[ Protected methods                                     ]
 //[-------------------------------------------------------]
@@ -253,10 +284,10 @@ Renderer::IRenderer *IApplicationRenderer::createRendererInstance(const char *re
 					if (nullptr != symbol)
 					{
 						// "createRendererInstance()" signature
-						typedef Renderer::IRenderer *(__cdecl *createRendererInstance)(Renderer::handle);
+						typedef Renderer::IRenderer *(__cdecl *createRendererInstance)(Renderer::handle, Renderer::IAllocator *);
 
 						// Create the renderer instance
-						renderer = (static_cast<createRendererInstance>(symbol))(getNativeWindowHandle());
+						renderer = (static_cast<createRendererInstance>(symbol))(getNativeWindowHandle(), nullptr);
 					}
 					else
 					{
@@ -286,11 +317,11 @@ Renderer::IRenderer *IApplicationRenderer::createRendererInstance(const char *re
 					if (nullptr != symbol)
 					{
 						// "createRendererInstance()" signature
-						typedef Renderer::IRenderer *(*createRendererInstance)(Renderer::handle);
+						typedef Renderer::IRenderer *(*createRendererInstance)(Renderer::handle, Renderer::IAllocator *);
 
 						// Create the renderer instance
 						
-						renderer = (reinterpret_cast<createRendererInstance>(symbol))(getNativeWindowHandle());
+						renderer = (reinterpret_cast<createRendererInstance>(symbol))(getNativeWindowHandle(), nullptr);
 					}
 					else
 					{
@@ -315,10 +346,10 @@ Renderer::IRenderer *IApplicationRenderer::createRendererInstance(const char *re
 				if (0 == strcmp(rendererName, "Null"))
 				{
 					// "createNullRendererInstance()" signature
-					extern Renderer::IRenderer *createNullRendererInstance(Renderer::handle);
+					extern Renderer::IRenderer *createNullRendererInstance(Renderer::handle, Renderer::IAllocator *);
 
 					// Create the renderer instance
-					renderer = createNullRendererInstance(getNativeWindowHandle());
+					renderer = createNullRendererInstance(getNativeWindowHandle(), nullptr);
 				}
 				else
 			#endif
@@ -328,10 +359,10 @@ Renderer::IRenderer *IApplicationRenderer::createRendererInstance(const char *re
 				if (0 == strcmp(rendererName, "OpenGL"))
 				{
 					// "createOpenGLRendererInstance()" signature
-					extern Renderer::IRenderer *createOpenGLRendererInstance(Renderer::handle);
+					extern Renderer::IRenderer *createOpenGLRendererInstance(Renderer::handle, Renderer::IAllocator *);
 
 					// Create the renderer instance
-					renderer = createOpenGLRendererInstance(getNativeWindowHandle());
+					renderer = createOpenGLRendererInstance(getNativeWindowHandle(), nullptr);
 				}
 				else
 			#endif
@@ -341,10 +372,10 @@ Renderer::IRenderer *IApplicationRenderer::createRendererInstance(const char *re
 				if (0 == strcmp(rendererName, "OpenGLES2"))
 				{
 					// "createOpenGLES2RendererInstance()" signature
-					extern Renderer::IRenderer *createOpenGLES2RendererInstance(Renderer::handle);
+					extern Renderer::IRenderer *createOpenGLES2RendererInstance(Renderer::handle, Renderer::IAllocator *);
 
 					// Create the renderer instance
-					renderer = createOpenGLES2RendererInstance(getNativeWindowHandle());
+					renderer = createOpenGLES2RendererInstance(getNativeWindowHandle(), nullptr);
 				}
 				else
 			#endif
@@ -354,10 +385,10 @@ Renderer::IRenderer *IApplicationRenderer::createRendererInstance(const char *re
 				if (0 == strcmp(rendererName, "Direct3D9"))
 				{
 					// "createDirect3D9RendererInstance()" signature
-					extern Renderer::IRenderer *createDirect3D9RendererInstance(Renderer::handle);
+					extern Renderer::IRenderer *createDirect3D9RendererInstance(Renderer::handle, Renderer::IAllocator *);
 
 					// Create the renderer instance
-					renderer = createDirect3D9RendererInstance(getNativeWindowHandle());
+					renderer = createDirect3D9RendererInstance(getNativeWindowHandle(), nullptr);
 				}
 				else
 			#endif
@@ -367,10 +398,10 @@ Renderer::IRenderer *IApplicationRenderer::createRendererInstance(const char *re
 				if (0 == strcmp(rendererName, "Direct3D10"))
 				{
 					// "createDirect3D10RendererInstance()" signature
-					extern Renderer::IRenderer *createDirect3D10RendererInstance(Renderer::handle);
+					extern Renderer::IRenderer *createDirect3D10RendererInstance(Renderer::handle, Renderer::IAllocator *);
 
 					// Create the renderer instance
-					renderer = createDirect3D10RendererInstance(getNativeWindowHandle());
+					renderer = createDirect3D10RendererInstance(getNativeWindowHandle(), nullptr);
 				}
 				else
 			#endif
@@ -380,10 +411,10 @@ Renderer::IRenderer *IApplicationRenderer::createRendererInstance(const char *re
 				if (0 == strcmp(rendererName, "Direct3D11"))
 				{
 					// "createDirect3D11RendererInstance()" signature
-					extern Renderer::IRenderer *createDirect3D11RendererInstance(Renderer::handle);
+					extern Renderer::IRenderer *createDirect3D11RendererInstance(Renderer::handle, Renderer::IAllocator *);
 
 					// Create the renderer instance
-					renderer = createDirect3D11RendererInstance(getNativeWindowHandle());
+					renderer = createDirect3D11RendererInstance(getNativeWindowHandle(), nullptr);
 				}
 			#endif
 
@@ -425,6 +456,31 @@ Renderer::IRenderer *IApplicationRenderer::createRendererInstance(const char *re
 		}
 	#endif
 
+	// Trace
+	#if !defined(SHARED_LIBRARIES) && !defined(RENDERER_NO_TRACE)
+		// Capture all renderer API calls into a trace file in case the environment variable "RENDERER_TRACE_FILENAME" is set,
+		// the trace can be replayed by using the "TraceReplay" command line tool. In case the environment variable
+		// "RENDERER_STATISTICS" is set, the renderer API calls are only counted to gather per frame statistics.
+		const char *traceFilename = getenv("RENDERER_TRACE_FILENAME");
+		const char *statistics = getenv("RENDERER_STATISTICS");
+		if (nullptr == traceFilename || '\0' == traceFilename[0])
+		{
+			traceFilename = nullptr;
+		}
+		if (nullptr != renderer && (nullptr != traceFilename || (nullptr != statistics && '\0' != statistics[0])))
+		{
+			// "createTraceRendererInstance()" signature
+			extern Renderer::IRenderer *createTraceRendererInstance(Renderer::IRenderer &, const char *);
+
+			// Create the trace renderer instance wrapping the renderer instance, keep the renderer instance in case of an error
+			Renderer::IRenderer *traceRenderer = createTraceRendererInstance(*renderer, traceFilename);
+			if (nullptr != traceRenderer)
+			{
+				renderer = traceRenderer;
+			}
+		}
+	#endif
+
 	// Done
 	return renderer;
 }
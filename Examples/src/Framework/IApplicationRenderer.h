@@ -118,6 +118,20 @@ public:
 	virtual void onDrawRequest() override;
 
 
+//[-------------------------------------------------------]
+//[ Protected virtual IApplicationRenderer methods        ]
+//[-------------------------------------------------------]
+protected:
+	/**
+	*  @brief
+	*    Draw an overlay on top of the content drawn by "onDraw()", called right before the main swap chain is presented
+	*
+	*  @note
+	*    - The base implementation is empty
+	*/
+	virtual void onDrawOverlay();
+
+
 //[-------------------------------------------------------]
 //[ Protected methods                                     ]
 //[-------------------------------------------------------]
@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Framework/IApplicationRendererToolkit.h"
+#include "Framework/Color4.h"
 #ifdef SHARED_LIBRARIES
 	// Dynamically linked libraries
 	#ifdef WIN32
@@ -42,7 +43,11 @@
 	#include <stdio.h>
 #endif
 
+#include <glm/gtc/type_ptr.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
 #include <string.h>
+#include <stdio.h>
 
 
 //[-------------------------------------------------------]
@@ -78,6 +83,9 @@ void IApplicationRendererToolkit::onInitialization()
 
 void IApplicationRendererToolkit::onDeinitialization()
 {
+	// Release the statistics font instance
+	mStatisticsFont = nullptr;
+
 	// Delete the renderer toolkit instance
 	mRendererToolkit = nullptr;
 
@@ -102,6 +110,97 @@ void IApplicationRendererToolkit::onDeinitialization()
 }
 
 
+//[-------------------------------------------------------]
+//[ Protected virtual IApplicationRenderer methods        ]
+//[-------------------------------------------------------]
+void IApplicationRendererToolkit::onDrawOverlay()
+{
+	// Only renderer instances recording the renderer API calls (e.g. the trace renderer) end frames within the statistics
+	Renderer::IRenderer *renderer = getRenderer();
+	if (nullptr != renderer && nullptr != mRendererToolkit && renderer->getStatistics().numberOfFrames > 0)
+	{
+		// Create the statistics font instance on demand
+		if (nullptr == mStatisticsFont)
+		{
+			mStatisticsFont = mRendererToolkit->createFontTexture("../Data/Font/LinBiolinum_R.otf");
+			if (nullptr == mStatisticsFont)
+			{
+				// Error!
+				return;
+			}
+		}
+
+		// Begin debug event
+		RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(renderer)
+
+		// Sum up the statistics of the last frame
+		// -> The overlay renderer API calls are counted as well, they're part of the frame
+		const Renderer::FrameStatistics &frameStatistics = renderer->getStatistics().lastFrame;
+		unsigned int numberOfApiCalls = 0;
+		unsigned int numberOfRedundantApiCalls = 0;
+		unsigned int numberOfDrawCalls = 0;
+		for (unsigned int i = 0; i < Renderer::ApiCall::NUMBER_OF_API_CALLS; ++i)
+		{
+			numberOfApiCalls		  += frameStatistics.numberOfApiCalls[i];
+			numberOfRedundantApiCalls += frameStatistics.numberOfRedundantApiCalls[i];
+		}
+		for (unsigned int i = Renderer::ApiCall::DRAW; i <= Renderer::ApiCall::DRAW_AUTO; ++i)
+		{
+			numberOfDrawCalls += frameStatistics.numberOfApiCalls[i];
+		}
+
+		// Display the sums, located at the bottom left so the overlay doesn't collide with the example text
+		char text[128];
+		float y = -0.7f;
+		sprintf(text, "Renderer API calls: %u (%u redundant)", numberOfApiCalls, numberOfRedundantApiCalls);
+		mStatisticsFont->drawText(text, Color4::WHITE, glm::value_ptr(glm::translate(glm::mat4(1.0f), glm::vec3(-0.95f, y, 0.0f))), 0.0025f, 0.0025f);
+		y -= 0.05f;
+		sprintf(text, "Draw calls: %u, primitives: %llu, uploaded: %llu KiB", numberOfDrawCalls, frameStatistics.numberOfPrimitives, frameStatistics.numberOfUploadedBytes / 1024);
+		mStatisticsFont->drawText(text, Color4::WHITE, glm::value_ptr(glm::translate(glm::mat4(1.0f), glm::vec3(-0.95f, y, 0.0f))), 0.0025f, 0.0025f);
+
+		// Display the present intervals of the main swap chain, uneven intervals are a sign of stuttering
+		Renderer::ISwapChain *swapChain = renderer->getMainSwapChain();
+		if (nullptr != swapChain)
+		{
+			const Renderer::PresentStatistics &presentStatistics = swapChain->getPresentStatistics();
+			y -= 0.05f;
+			sprintf(text, "Present interval: %.2f ms (%.2f - %.2f ms), frame latency wait: %.2f ms", presentStatistics.averagePresentInterval, presentStatistics.minimumPresentInterval, presentStatistics.maximumPresentInterval, presentStatistics.lastFrameLatencyWaitTime);
+			mStatisticsFont->drawText(text, Color4::WHITE, glm::value_ptr(glm::translate(glm::mat4(1.0f), glm::vec3(-0.95f, y, 0.0f))), 0.0025f, 0.0025f);
+		}
+
+		// Display the most frequent renderer API calls
+		static const unsigned int NUMBER_OF_DISPLAYED_API_CALLS = 3;
+		bool displayed[Renderer::ApiCall::NUMBER_OF_API_CALLS] = {};
+		for (unsigned int n = 0; n < NUMBER_OF_DISPLAYED_API_CALLS; ++n)
+		{
+			// Find the most frequent renderer API call which is not yet displayed
+			unsigned int mostFrequent = Renderer::ApiCall::NUMBER_OF_API_CALLS;
+			for (unsigned int i = 0; i < Renderer::ApiCall::NUMBER_OF_API_CALLS; ++i)
+			{
+				if (!displayed[i] && frameStatistics.numberOfApiCalls[i] > 0 && (Renderer::ApiCall::NUMBER_OF_API_CALLS == mostFrequent || frameStatistics.numberOfApiCalls[i] > frameStatistics.numberOfApiCalls[mostFrequent]))
+				{
+					mostFrequent = i;
+				}
+			}
+			if (Renderer::ApiCall::NUMBER_OF_API_CALLS == mostFrequent)
+			{
+				// Done, there are no further renderer API calls
+				break;
+			}
+			displayed[mostFrequent] = true;
+
+			// Display the renderer API call
+			y -= 0.05f;
+			sprintf(text, "%s: %u (%u redundant)", Renderer::Statistics::getApiCallName(static_cast<Renderer::ApiCall::Enum>(mostFrequent)), frameStatistics.numberOfApiCalls[mostFrequent], frameStatistics.numberOfRedundantApiCalls[mostFrequent]);
+			mStatisticsFont->drawText(text, Color4::WHITE, glm::value_ptr(glm::translate(glm::mat4(1.0f), glm::vec3(-0.95f, y, 0.0f))), 0.0025f, 0.0025f);
+		}
+
+		// End debug event
+		RENDERER_END_DEBUG_EVENT(renderer)
+	}
+}
+
+
 //[-------------------------------------------------------]
 //[ Protected methods                                     ]
 //[-------------------------------------------------------]
@@ -73,6 +73,21 @@ public:
 	virtual void onDeinitialization() override;
 
 
+//[-------------------------------------------------------]
+//[ Protected virtual IApplicationRenderer methods        ]
+//[-------------------------------------------------------]
+protected:
+	/**
+	*  @brief
+	*    Draw an overlay on top of the content drawn by "onDraw()", called right before the main swap chain is presented
+	*
+	*  @note
+	*    - Displays the renderer API call statistics of the last frame, in case the renderer instance gathers them
+	*      (e.g. the trace renderer when the environment variable "RENDERER_STATISTICS" is set)
+	*/
+	virtual void onDrawOverlay() override;
+
+
 //[-------------------------------------------------------]
 //[ Protected methods                                     ]
 //[-------------------------------------------------------]
@@ -114,6 +129,7 @@ private:
 private:
 	void								  *mRendererToolkitSharedLibrary;	/**< Renderer toolkit shared library, can be a null pointer */
 	RendererToolkit::IRendererToolkitPtr   mRendererToolkit;				/**< Renderer toolkit instance, can be a null pointer */
+	RendererToolkit::IFontPtr			   mStatisticsFont;					/**< Font used to display the renderer statistics, created on demand, can be a null pointer */
 
 
 };
@@ -0,0 +1,139 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Framework/MemoryMappedFile.h"
+#include "Framework/PlatformTypes.h"
+#ifdef WIN32
+	#include "Framework/WindowsHeader.h"
+#elif defined LINUX
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Open and map a file
+*/
+bool MemoryMappedFile::open(const char *filename)
+{
+	// Close a previously opened file
+	close();
+
+	#ifdef WIN32
+		// Open the file
+		mFileHandle = ::CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (INVALID_HANDLE_VALUE != mFileHandle)
+		{
+			// Get the file size, we don't support files >4 GiB in here
+			const DWORD numberOfBytes = ::GetFileSize(mFileHandle, nullptr);
+			if (INVALID_FILE_SIZE != numberOfBytes && numberOfBytes > 0)
+			{
+				// Map the file
+				mFileMappingHandle = ::CreateFileMappingA(mFileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (nullptr != mFileMappingHandle)
+				{
+					mData = ::MapViewOfFile(mFileMappingHandle, FILE_MAP_READ, 0, 0, 0);
+					if (nullptr != mData)
+					{
+						mNumberOfBytes = numberOfBytes;
+					}
+				}
+			}
+		}
+	#elif defined LINUX
+		// Open the file
+		mFileDescriptor = ::open(filename, O_RDONLY);
+		if (-1 != mFileDescriptor)
+		{
+			// Get the file size
+			struct stat fileStatus;
+			if (0 == ::fstat(mFileDescriptor, &fileStatus) && fileStatus.st_size > 0)
+			{
+				// Map the file
+				void *data = ::mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, mFileDescriptor, 0);
+				if (MAP_FAILED != data)
+				{
+					mData		   = data;
+					mNumberOfBytes = static_cast<unsigned int>(fileStatus.st_size);
+				}
+			}
+		}
+	#else
+		#error "Unsupported platform"
+	#endif
+
+	// Error?
+	if (nullptr == mData)
+	{
+		OUTPUT_DEBUG_PRINTF("Failed to map the file \"%s\"", filename)
+		close();
+		return false;
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Unmap and close the file
+*/
+void MemoryMappedFile::close()
+{
+	#ifdef WIN32
+		if (nullptr != mData)
+		{
+			::UnmapViewOfFile(mData);
+		}
+		if (nullptr != mFileMappingHandle)
+		{
+			::CloseHandle(mFileMappingHandle);
+			mFileMappingHandle = nullptr;
+		}
+		if (INVALID_HANDLE_VALUE != mFileHandle)
+		{
+			::CloseHandle(mFileHandle);
+			mFileHandle = INVALID_HANDLE_VALUE;
+		}
+	#elif defined LINUX
+		if (nullptr != mData)
+		{
+			::munmap(mData, mNumberOfBytes);
+		}
+		if (-1 != mFileDescriptor)
+		{
+			::close(mFileDescriptor);
+			mFileDescriptor = -1;
+		}
+	#else
+		#error "Unsupported platform"
+	#endif
+	mData		   = nullptr;
+	mNumberOfBytes = 0;
+}
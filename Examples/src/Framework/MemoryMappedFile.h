@@ -0,0 +1,150 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __MEMORYMAPPEDFILE_H__
+#define __MEMORYMAPPEDFILE_H__
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Read-only memory mapped file
+*
+*  @remarks
+*    The file content is mapped into the address space of the process, the operating system
+*    pages the data in on demand. This way, cooked binary data can be handed over to the renderer
+*    without copying it into temporary buffers first.
+*
+*  @verbatim
+*    Usage example:
+*
+*    MemoryMappedFile memoryMappedFile;
+*    if (memoryMappedFile.open("../Data/Imrod/ImrodLowPoly.mesh"))
+*    {
+*        const void *data = memoryMappedFile.getData();
+*        const unsigned int numberOfBytes = memoryMappedFile.getNumberOfBytes();
+*        // Use the data
+*    }
+*  @endverbatim
+*/
+class MemoryMappedFile
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Default constructor
+	*/
+	inline MemoryMappedFile();
+
+	/**
+	*  @brief
+	*    Destructor
+	*
+	*  @note
+	*    - Closes the file in case it's still open
+	*/
+	inline ~MemoryMappedFile();
+
+	/**
+	*  @brief
+	*    Open and map a file
+	*
+	*  @param[in] filename
+	*    ASCII name of the file to map, must be valid
+	*
+	*  @return
+	*    "true" if all went fine, else "false" (file not found, empty file, mapping failed)
+	*
+	*  @note
+	*    - A previously opened file is closed automatically
+	*/
+	bool open(const char *filename);
+
+	/**
+	*  @brief
+	*    Unmap and close the file
+	*/
+	void close();
+
+	/**
+	*  @brief
+	*    Return the mapped file data
+	*
+	*  @return
+	*    The mapped file data, null pointer if no file is open, do not destroy the returned data
+	*/
+	inline const void *getData() const;
+
+	/**
+	*  @brief
+	*    Return the number of mapped bytes
+	*
+	*  @return
+	*    The number of mapped bytes, 0 if no file is open
+	*/
+	inline unsigned int getNumberOfBytes() const;
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	MemoryMappedFile(const MemoryMappedFile &source);
+	MemoryMappedFile &operator =(const MemoryMappedFile &source);
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	void		 *mData;			/**< Mapped file data, can be a null pointer */
+	unsigned int  mNumberOfBytes;	/**< Number of mapped bytes */
+	#ifdef WIN32
+		void *mFileHandle;			/**< Windows file handle, "INVALID_HANDLE_VALUE" if there's no file (type "HANDLE" not used in here in order to keep the header slim) */
+		void *mFileMappingHandle;	/**< Windows file mapping handle, can be a null pointer (type "HANDLE" not used in here in order to keep the header slim) */
+	#elif defined LINUX
+		int mFileDescriptor;		/**< POSIX file descriptor, -1 if there's no file */
+	#endif
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "MemoryMappedFile.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __MEMORYMAPPEDFILE_H__
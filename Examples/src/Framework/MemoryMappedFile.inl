@@ -0,0 +1,66 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Default constructor
+*/
+inline MemoryMappedFile::MemoryMappedFile() :
+	mData(nullptr),
+	mNumberOfBytes(0),
+	#ifdef WIN32
+		mFileHandle(reinterpret_cast<void*>(-1)),	// "INVALID_HANDLE_VALUE"
+		mFileMappingHandle(nullptr)
+	#elif defined LINUX
+		mFileDescriptor(-1)
+	#endif
+{
+	// Nothing to do in here
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+inline MemoryMappedFile::~MemoryMappedFile()
+{
+	close();
+}
+
+/**
+*  @brief
+*    Return the mapped file data
+*/
+inline const void *MemoryMappedFile::getData() const
+{
+	return mData;
+}
+
+/**
+*  @brief
+*    Return the number of mapped bytes
+*/
+inline unsigned int MemoryMappedFile::getNumberOfBytes() const
+{
+	return mNumberOfBytes;
+}
@@ -8,8 +8,8 @@
 /Header:	tga.h																*
 /Purpose:	Load Compressed and Uncompressed TGA files							*
 /Functions:	LoadTGA(Texture * texture, char * filename)							*
-/			LoadCompressedTGA(Texture * texture, char * filename, FILE * fTGA)	*
-/			LoadUncompressedTGA(Texture * texture, char * filename, FILE * fTGA)*	
+/			LoadCompressedTGA(Texture * texture, TGA & tga, FILE * fTGA)			*
+/			LoadUncompressedTGA(Texture * texture, TGA & tga, FILE * fTGA)		*	
 /*******************************************************************************/
 #include "Framework/TGALoader.h"
 
@@ -51,8 +51,7 @@ typedef struct
 } TGA;
 
 
-TGAHeader tgaheader;									// TGA header
-TGA tga;												// TGA image data
+// [CHANGED] The TGA header and TGA image data are no longer global variables so images can be loaded by multiple threads at the same time
 
 typedef	struct									
 {
@@ -68,8 +67,8 @@ bool LoadTGA(Texture * texture, char * filename);		// Load a TGA file
 
 GLubyte uTGAcompare[12] = {0,0,2, 0,0,0,0,0,0,0,0,0};	// Uncompressed TGA Header
 GLubyte cTGAcompare[12] = {0,0,10,0,0,0,0,0,0,0,0,0};	// Compressed TGA Header
-bool LoadUncompressedTGA(Texture *, char *, FILE *);	// Load an Uncompressed file
-bool LoadCompressedTGA(Texture *, char *, FILE *);		// Load a Compressed file
+bool LoadUncompressedTGA(Texture *, TGA &, FILE *);	// Load an Uncompressed file
+bool LoadCompressedTGA(Texture *, TGA &, FILE *);		// Load a Compressed file
 
 
 
@@ -78,36 +77,55 @@ bool LoadCompressedTGA(Texture *, char *, FILE *);		// Load a Compressed file
 #include <Renderer/Renderer.h>
 Renderer::ITexture2D *loadTGATexture(Renderer::IRenderer &renderer, const char *filename)
 {
-	Texture texture;
 	Renderer::ITexture2D *texture2D = nullptr;
+	unsigned int width = 0;
+	unsigned int height = 0;
+	unsigned char *imageData = loadTGAImage(filename, width, height);
+	if (nullptr != imageData)
+	{
+		texture2D = createTGATexture(renderer, imageData, width, height);
+		free(imageData);
+	}
+	return texture2D;
+}
+
+unsigned char *loadTGAImage(const char *filename, unsigned int &width, unsigned int &height)
+{
+	Texture texture;
 	if (LoadTGA(&texture, (char*)filename))
 	{
+		width  = texture.width;
+		height = texture.height;
 		if (24 == texture.bpp)
 		{
-			// Create the texture instance
-			unsigned char *temp = new unsigned char[texture.width * texture.height * 4];
-			unsigned char *imageCurrent = texture.imageData;
-			unsigned char *tempCurrent = temp;
-			for (unsigned int i = 0; i < texture.width * texture.height; ++i)
+			// Add the alpha channel
+			unsigned char *temp = static_cast<unsigned char*>(malloc(texture.width * texture.height * 4));
+			if (nullptr != temp)
 			{
-				tempCurrent[0] = imageCurrent[0];
-				tempCurrent[1] = imageCurrent[1];
-				tempCurrent[2] = imageCurrent[2];
-				tempCurrent[3] = 255;
-				imageCurrent += 3;
-				tempCurrent += 4;
+				unsigned char *imageCurrent = texture.imageData;
+				unsigned char *tempCurrent = temp;
+				for (unsigned int i = 0; i < texture.width * texture.height; ++i)
+				{
+					tempCurrent[0] = imageCurrent[0];
+					tempCurrent[1] = imageCurrent[1];
+					tempCurrent[2] = imageCurrent[2];
+					tempCurrent[3] = 255;
+					imageCurrent += 3;
+					tempCurrent += 4;
+				}
 			}
-			texture2D = renderer.createTexture2D(texture.width, texture.height, Renderer::TextureFormat::R8G8B8A8, temp, Renderer::TextureFlag::MIPMAPS);
-			delete [] temp;
-		}
-		else
-		{
-			// Create the texture instance
-			texture2D = renderer.createTexture2D(texture.width, texture.height, Renderer::TextureFormat::R8G8B8A8, texture.imageData, Renderer::TextureFlag::MIPMAPS);
+			free(texture.imageData);	// The image data was allocated by using "malloc()"
+			return temp;
 		}
-		delete [] texture.imageData;
+		return texture.imageData;
 	}
-	return texture2D;
+	return nullptr;
+}
+
+Renderer::ITexture2D *createTGATexture(Renderer::IRenderer &renderer, unsigned char *imageData, unsigned int width, unsigned int height)
+{
+	// Create the texture instance
+	return renderer.createTexture2D(width, height, Renderer::TextureFormat::R8G8B8A8, imageData, Renderer::TextureFlag::MIPMAPS);
 }
 
 
@@ -122,6 +140,8 @@ Renderer::ITexture2D *loadTGATexture(Renderer::IRenderer &renderer, const char *
 
 bool LoadTGA(Texture * texture, char * filename)				// Load a TGA file
 {
+	TGAHeader tgaheader;										// TGA header
+	TGA tga;													// TGA image data
 	FILE * fTGA;												// File pointer to texture file
 	fTGA = fopen(filename, "rb");								// Open file for reading
 
@@ -143,11 +163,11 @@ bool LoadTGA(Texture * texture, char * filename)				// Load a TGA file
 
 	if(memcmp(uTGAcompare, &tgaheader, sizeof(tgaheader)) == 0)				// See if header matches the predefined header of 
 	{																		// an Uncompressed TGA image
-		LoadUncompressedTGA(texture, filename, fTGA);						// If so, jump to Uncompressed TGA loading code
+		return LoadUncompressedTGA(texture, tga, fTGA);						// If so, jump to Uncompressed TGA loading code
 	}
 	else if(memcmp(cTGAcompare, &tgaheader, sizeof(tgaheader)) == 0)		// See if header matches the predefined header of
 	{																		// an RLE compressed TGA image
-		LoadCompressedTGA(texture, filename, fTGA);							// If so, jump to Compressed TGA loading code
+		return LoadCompressedTGA(texture, tga, fTGA);						// If so, jump to Compressed TGA loading code
 	}
 	else																	// If header matches neither type
 	{
@@ -158,7 +178,7 @@ bool LoadTGA(Texture * texture, char * filename)				// Load a TGA file
 	return true;															// All went well, continue on
 }
 
-bool LoadUncompressedTGA(Texture * texture, char * , FILE * fTGA)			// Load an uncompressed TGA (note, much of this code is based on NeHe's 
+bool LoadUncompressedTGA(Texture * texture, TGA & tga, FILE * fTGA)			// Load an uncompressed TGA (note, much of this code is based on NeHe's 
 {																			// TGA Loading code nehe.gamedev.net)
 	if(fread(tga.header, sizeof(tga.header), 1, fTGA) == 0)					// Read TGA header
 	{										
@@ -225,7 +245,7 @@ bool LoadUncompressedTGA(Texture * texture, char * , FILE * fTGA)			// Load an u
 	return true;															// Return success
 }
 
-bool LoadCompressedTGA(Texture * texture, char *, FILE * fTGA)				// Load COMPRESSED TGAs
+bool LoadCompressedTGA(Texture * texture, TGA & tga, FILE * fTGA)				// Load COMPRESSED TGAs
 { 
 	if(fread(tga.header, sizeof(tga.header), 1, fTGA) == 0)					// Attempt to read header
 	{
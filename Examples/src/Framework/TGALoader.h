@@ -8,6 +8,9 @@ namespace Renderer
 	class IRenderer;
 }
 extern Renderer::ITexture2D *loadTGATexture(Renderer::IRenderer &renderer, const char *filename);
+// Split into loading and texture creation so the image can be loaded by a worker thread
+extern unsigned char *loadTGAImage(const char *filename, unsigned int &width, unsigned int &height);	// Thread safe, returns "Renderer::TextureFormat::R8G8B8A8" data which must be destroyed by using "free()", null pointer on error
+extern Renderer::ITexture2D *createTGATexture(Renderer::IRenderer &renderer, unsigned char *imageData, unsigned int width, unsigned int height);
 
 
 #endif // __TGALOADER_H__
@@ -22,8 +22,9 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "InstancedCubes/CubeRendererDrawInstanced/BatchDrawInstanced.h"
-#include "Framework/Quaternion.h"
-#include "Framework/EulerAngles.h"
+#include "InstancedCubes/ICubeRenderer.h"
+
+#include <Renderer/RendererToolkit.h>
 
 #include <stdlib.h> // For rand()
 
@@ -36,7 +37,10 @@
 *    Default constructor
 */
 BatchDrawInstanced::BatchDrawInstanced() :
-	mNumberOfCubeInstances(0)
+	mNumberOfCubeInstances(0),
+	mNumberOfVisibleCubeInstances(0),
+	mVisiblePerInstanceData(nullptr),
+	mCulledInstanceBuffer(false)
 {
 	// Nothing to do in here
 }
@@ -48,13 +52,19 @@ BatchDrawInstanced::BatchDrawInstanced() :
 BatchDrawInstanced::~BatchDrawInstanced()
 {
 	// The renderer resource pointers are released automatically
+
+	// Destroy the per instance data of the visible cube instances
+	if (nullptr != mVisiblePerInstanceData)
+	{
+		delete [] mVisiblePerInstanceData;
+	}
 }
 
 /**
 *  @brief
 *    Initialize the batch
 */
-void BatchDrawInstanced::initialize(Renderer::IRenderer &renderer, unsigned int numberOfCubeInstances, bool alphaBlending, unsigned int numberOfTextures, unsigned int sceneRadius)
+void BatchDrawInstanced::initialize(Renderer::IRenderer &renderer, unsigned int numberOfCubeInstances, bool alphaBlending, unsigned int numberOfTextures, unsigned int sceneRadius, bool gpuCulling, RendererToolkit::IJobSystem *jobSystem)
 {
 	// Begin debug event
 	RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(&renderer)
@@ -62,63 +72,46 @@ void BatchDrawInstanced::initialize(Renderer::IRenderer &renderer, unsigned int
 	// Release previous data if required
 	mBlendState = nullptr;
 	mTextureBufferPerInstanceData = nullptr;
+	mTextureBufferVisiblePerInstanceData = nullptr;
+	mIndirectBuffer = nullptr;
 
 	// Set owner renderer instance
 	mRenderer = &renderer;
 
+	if (nullptr != mVisiblePerInstanceData)
+	{
+		delete [] mVisiblePerInstanceData;
+		mVisiblePerInstanceData = nullptr;
+	}
+	mCulledInstanceBuffer = false;
+
 	// Set the number of cube instance
 	mNumberOfCubeInstances = numberOfCubeInstances;
+	mNumberOfVisibleCubeInstances = 0;
 
 	{ // Create the texture buffer instance
 		// Allocate the local per instance data
 		const unsigned int numberOfElements = mNumberOfCubeInstances * 2 * 4;
 		float *data = new float[numberOfElements];
-		float *dataCurrent = data;
-
-		// Set data
-		// -> Layout: [Position][Rotation][Position][Rotation]...
-		//    - Position: xyz=Position, w=Slice of the 2D texture array to use
-		//    - Rotation: Rotation quaternion (xyz) and scale (w)
-		//      -> We don't need to store the w component of the quaternion. It's normalized and storing
-		//         three components while recomputing the fourths component is be sufficient.
-		Quaternion quaternion;	// Identity rotation quaternion
-		for (unsigned int i = 0; i < mNumberOfCubeInstances; ++i)
-		{
-			{ // Position
-				// r=x
-				*dataCurrent = -static_cast<int>(sceneRadius) + 2 * sceneRadius * (rand() % 65536) / 65536.0f;
-				++dataCurrent;
-				// g=y
-				*dataCurrent = -static_cast<int>(sceneRadius) + 2 * sceneRadius * (rand() % 65536) / 65536.0f;
-				++dataCurrent;
-				// b=z
-				*dataCurrent = -static_cast<int>(sceneRadius) + 2 * sceneRadius * (rand() % 65536) / 65536.0f;
-				++dataCurrent;
-				// a=Slice of the 2D texture array to use
-				*dataCurrent = static_cast<float>(rand() % numberOfTextures); // Choose a random texture
-				++dataCurrent;
-			}
 
-			{ // Rotation
-				EulerAngles::toQuaternion((rand() % 65536) / 65536.0f, (rand() % 65536) / 65536.0f * 2, (rand() % 65536) / 65536.0f * 3, quaternion);
-
-				// r=x
-				*dataCurrent = quaternion.x;
-				++dataCurrent;
-				// g=y
-				*dataCurrent = quaternion.y;
-				++dataCurrent;
-				// b=z
-				*dataCurrent = quaternion.z;
-				++dataCurrent;
-				// a=scale
-				*dataCurrent = 2.0f * (rand() % 65536) / 65536.0f;
-				++dataCurrent;
-			}
-		}
+		// Set random per instance data, see "ICubeRenderer::generatePerInstanceData()" for the data layout
+		ICubeRenderer::generatePerInstanceData(data, mNumberOfCubeInstances, numberOfTextures, sceneRadius, static_cast<unsigned int>(rand()), jobSystem);
 
 		// Create the texture buffer instance
-		mTextureBufferPerInstanceData = mRenderer->createTextureBuffer(sizeof(float) * numberOfElements, Renderer::TextureFormat::R32G32B32A32F, data, Renderer::BufferUsage::STATIC_DRAW);
+		// -> The visible cube instances are streamed into the texture buffer each frame
+		mTextureBufferPerInstanceData = mRenderer->createTextureBuffer(sizeof(float) * numberOfElements, Renderer::TextureFormat::R32G32B32A32F, data, Renderer::BufferUsage::DYNAMIC_DRAW);
+
+		// Initialize the frustum culling, the per instance data of the visible cube instances is written into a buffer of the same size
+		mFrustumCulling.initialize(mNumberOfCubeInstances, data, jobSystem);
+		mVisiblePerInstanceData = new float[numberOfElements];
+
+		// Create the resources required to cull the cube instances on the GPU
+		// -> The compute shader appends the visible cube instances to a texture buffer of the same size and counts them inside the indirect draw arguments
+		if (gpuCulling)
+		{
+			mTextureBufferVisiblePerInstanceData = mRenderer->createTextureBuffer(sizeof(float) * numberOfElements, Renderer::TextureFormat::R32G32B32A32F, nullptr, Renderer::BufferUsage::DYNAMIC_COPY);
+			mIndirectBuffer = mRenderer->createIndirectBuffer(sizeof(Renderer::DrawIndexedInstancedArguments), nullptr, Renderer::BufferUsage::DYNAMIC_COPY);
+		}
 
 		// Free local per instance data
 		delete [] data;
@@ -138,12 +131,47 @@ void BatchDrawInstanced::initialize(Renderer::IRenderer &renderer, unsigned int
 
 /**
 *  @brief
-*    Draw the batch
+*    Cull the instances on the CPU
 */
-void BatchDrawInstanced::draw()
+unsigned int BatchDrawInstanced::cull(const FrustumCulling::Frustum *frustum)
 {
+	mNumberOfVisibleCubeInstances = 0;
+
 	// Is there a valid renderer owner instance?
-	if (nullptr != mRenderer)
+	if (nullptr != mRenderer && nullptr != mTextureBufferPerInstanceData)
+	{
+		// Frustum culling
+		mNumberOfVisibleCubeInstances = mNumberOfCubeInstances;
+		if (nullptr != frustum)
+		{
+			// Stream the tightly packed visible cube instances into the texture buffer
+			mNumberOfVisibleCubeInstances = mFrustumCulling.cull(*frustum, mVisiblePerInstanceData);
+			if (mNumberOfVisibleCubeInstances > 0)
+			{
+				mTextureBufferPerInstanceData->copyDataFrom(sizeof(float) * FrustumCulling::NUMBER_OF_FLOATS_PER_INSTANCE * mNumberOfVisibleCubeInstances, mVisiblePerInstanceData);
+			}
+			mCulledInstanceBuffer = true;
+		}
+		else if (mCulledInstanceBuffer)
+		{
+			// Restore the per instance data of all cube instances
+			mTextureBufferPerInstanceData->copyDataFrom(sizeof(float) * FrustumCulling::NUMBER_OF_FLOATS_PER_INSTANCE * mNumberOfCubeInstances, mFrustumCulling.getPerInstanceData());
+			mCulledInstanceBuffer = false;
+		}
+	}
+
+	// Done
+	return mNumberOfVisibleCubeInstances;
+}
+
+/**
+*  @brief
+*    Draw the instances which survived "cull()"
+*/
+void BatchDrawInstanced::draw(RendererToolkit::IMeshBatch *meshBatch, unsigned int drawIndex)
+{
+	// Is there a valid renderer owner instance and anything to draw?
+	if (nullptr != mRenderer && nullptr != mTextureBufferPerInstanceData && mNumberOfVisibleCubeInstances > 0)
 	{
 		// Begin debug event
 		RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(mRenderer)
@@ -156,11 +184,108 @@ void BatchDrawInstanced::draw()
 
 		// Use instancing in order to draw multiple cubes with just a single draw call
 		// -> Draw calls are one of the most expensive rendering, avoid them if possible
-		mRenderer->drawIndexedInstanced(0, 36, 0, 0, 24, mNumberOfCubeInstances);
+		if (nullptr != meshBatch)
+		{
+			// The draw arguments of all batches are already inside the indirect buffer of the mesh batch
+			meshBatch->draw(Renderer::PrimitiveTopology::TRIANGLE_LIST, drawIndex, 1);
+		}
+		else
+		{
+			mRenderer->drawIndexedInstanced(0, 36, 0, 0, 24, mNumberOfVisibleCubeInstances);
+		}
+
+		// End debug event
+		RENDERER_END_DEBUG_EVENT(mRenderer)
+	}
+}
+
+/**
+*  @brief
+*    Cull the instances on the GPU
+*/
+void BatchDrawInstanced::cullOnGpu()
+{
+	// Is there a valid renderer owner instance and were the GPU culling resources created?
+	if (nullptr != mRenderer && nullptr != mTextureBufferPerInstanceData && nullptr != mTextureBufferVisiblePerInstanceData && nullptr != mIndirectBuffer)
+	{
+		// Begin debug event
+		RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(mRenderer)
+
+		// The compute shader reads the per instance data of all cube instances, restore it in case it was culled on the CPU before
+		if (mCulledInstanceBuffer)
+		{
+			mTextureBufferPerInstanceData->copyDataFrom(sizeof(float) * FrustumCulling::NUMBER_OF_FLOATS_PER_INSTANCE * mNumberOfCubeInstances, mFrustumCulling.getPerInstanceData());
+			mCulledInstanceBuffer = false;
+		}
+
+		// Reset the indirect draw arguments, the compute shader increments the number of instances for each visible cube instance
+		const Renderer::DrawIndexedInstancedArguments drawIndexedInstancedArguments =
+		{
+			36,	// indexCountPerInstance (unsigned int)
+			0,	// instanceCount (unsigned int)
+			0,	// startIndexLocation (unsigned int)
+			0,	// baseVertexLocation (unsigned int)
+			0	// startInstanceLocation (unsigned int)
+		};
+		mIndirectBuffer->copyDataFrom(sizeof(Renderer::DrawIndexedInstancedArguments), &drawIndexedInstancedArguments);
+
+		// Set the unordered access views
+		mRenderer->csSetUnorderedAccessView(0, mTextureBufferPerInstanceData);
+		mRenderer->csSetUnorderedAccessView(1, mTextureBufferVisiblePerInstanceData);
+		mRenderer->csSetUnorderedAccessView(2, mIndirectBuffer);
+
+		// One compute shader thread per cube instance
+		// -> In case there are more groups than a single dimension can hold, use the second dimension as well
+		const unsigned int numberOfGroups = (mNumberOfCubeInstances + NUMBER_OF_THREADS_PER_GROUP - 1) / NUMBER_OF_THREADS_PER_GROUP;
+		if (numberOfGroups > MAXIMUM_NUMBER_OF_GROUPS_PER_DIMENSION)
+		{
+			mRenderer->dispatch(MAXIMUM_NUMBER_OF_GROUPS_PER_DIMENSION, (numberOfGroups + MAXIMUM_NUMBER_OF_GROUPS_PER_DIMENSION - 1) / MAXIMUM_NUMBER_OF_GROUPS_PER_DIMENSION, 1);
+		}
+		else if (numberOfGroups > 0)
+		{
+			mRenderer->dispatch(numberOfGroups, 1, 1);
+		}
+
+		// Unset the unordered access views, the texture buffers are used for vertex texture fetch afterwards
+		mRenderer->csSetUnorderedAccessView(0, nullptr);
+		mRenderer->csSetUnorderedAccessView(1, nullptr);
+		mRenderer->csSetUnorderedAccessView(2, nullptr);
+
+		// End debug event
+		RENDERER_END_DEBUG_EVENT(mRenderer)
+	}
+}
+
+/**
+*  @brief
+*    Draw the instances which survived "cullOnGpu()"
+*/
+unsigned int BatchDrawInstanced::drawGpuCulled()
+{
+	unsigned int numberOfCulledCubeInstances = 0;
+
+	// Is there a valid renderer owner instance and were the GPU culling resources created?
+	if (nullptr != mRenderer && nullptr != mTextureBufferVisiblePerInstanceData && nullptr != mIndirectBuffer)
+	{
+		// Begin debug event
+		RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(mRenderer)
+
+		// Set the used texture at a certain texture unit
+		mRenderer->vsSetTexture(0, mTextureBufferVisiblePerInstanceData);
+
+		// Set the used blend state
+		mRenderer->omSetBlendState(mBlendState);
+
+		// The number of visible cube instances was written by the compute shader, there's no need to read it back to the CPU
+		mRenderer->multiDrawIndexedIndirect(*mIndirectBuffer, 0, 1);
+		numberOfCulledCubeInstances = mNumberOfCubeInstances;
 
 		// End debug event
 		RENDERER_END_DEBUG_EVENT(mRenderer)
 	}
+
+	// Done
+	return numberOfCulledCubeInstances;
 }
 
 
@@ -29,9 +29,20 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "InstancedCubes/FrustumCulling.h"
+
 #include <Renderer/Renderer.h>
 
 
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+	class IMeshBatch;
+}
+
+
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
@@ -43,6 +54,14 @@ class BatchDrawInstanced
 {
 
 
+//[-------------------------------------------------------]
+//[ Public definitions                                    ]
+//[-------------------------------------------------------]
+public:
+	static const unsigned int NUMBER_OF_THREADS_PER_GROUP				= 64;		/**< Number of compute shader threads per group used for GPU culling, must match the compute shader */
+	static const unsigned int MAXIMUM_NUMBER_OF_GROUPS_PER_DIMENSION	= 65535;	/**< Maximum number of compute shader groups per dispatch dimension guaranteed by all renderer APIs */
+
+
 //[-------------------------------------------------------]
 //[ Public methods                                        ]
 //[-------------------------------------------------------]
@@ -73,14 +92,77 @@ public:
 	*    Number of textures
 	*  @param[in] sceneRadius
 	*    Scene radius
+	*  @param[in] gpuCulling
+	*    Create the resources required to cull the instances on the GPU? (see "cullOnGpu()")
+	*  @param[in] jobSystem
+	*    Job system used to generate and cull the cube instances in parallel, can be a null pointer
+	*/
+	void initialize(Renderer::IRenderer &renderer, unsigned int numberOfCubeInstances, bool alphaBlending, unsigned int numberOfTextures, unsigned int sceneRadius, bool gpuCulling, RendererToolkit::IJobSystem *jobSystem);
+
+	/**
+	*  @brief
+	*    Cull the instances on the CPU
+	*
+	*  @param[in] frustum
+	*    View frustum to cull the instances against, can be a null pointer in which case all instances are visible
+	*
+	*  @return
+	*    The number of visible instances
+	*
+	*  @note
+	*    - Streams the visible instances into the texture buffer, "draw()" draws them
 	*/
-	void initialize(Renderer::IRenderer &renderer, unsigned int numberOfCubeInstances, bool alphaBlending, unsigned int numberOfTextures, unsigned int sceneRadius);
+	unsigned int cull(const FrustumCulling::Frustum *frustum);
 
 	/**
 	*  @brief
-	*    Draw the batch
+	*    Return the number of instances which survived "cull()"
+	*
+	*  @return
+	*    The number of visible instances
+	*/
+	inline unsigned int getNumberOfVisibleCubeInstances() const
+	{
+		return mNumberOfVisibleCubeInstances;
+	}
+
+	/**
+	*  @brief
+	*    Draw the instances which survived "cull()"
+	*
+	*  @param[in] meshBatch
+	*    Mesh batch holding the cube geometry, can be a null pointer in which case the cube instances are drawn directly
+	*  @param[in] drawIndex
+	*    Index of the draw of this batch within the mesh batch, the draw must draw "getNumberOfVisibleCubeInstances()" instances, unused if there's no mesh batch
+	*
+	*  @note
+	*    - When using a mesh batch, it sets the vertex array and primitive topology itself
+	*/
+	void draw(RendererToolkit::IMeshBatch *meshBatch, unsigned int drawIndex);
+
+	/**
+	*  @brief
+	*    Cull the instances on the GPU
+	*
+	*  @note
+	*    - The culling compute program and its uniform buffer must already be set
+	*    - Appends the visible instances to a texture buffer and writes their number into an indirect buffer
+	*    - "Renderer::IRenderer::memoryBarrier()" must be called before "drawGpuCulled()"
+	*    - Does nothing if the batch was not initialized with GPU culling
+	*/
+	void cullOnGpu();
+
+	/**
+	*  @brief
+	*    Draw the instances which survived "cullOnGpu()"
+	*
+	*  @return
+	*    The number of instances which were culled on the GPU, the number of drawn instances is only known on the GPU
+	*
+	*  @note
+	*    - The draw call is issued indirectly by using the draw arguments written by "cullOnGpu()"
 	*/
-	void draw();
+	unsigned int drawGpuCulled();
 
 
 //[-------------------------------------------------------]
@@ -113,10 +195,16 @@ private:
 //[ Private data                                          ]
 //[-------------------------------------------------------]
 private:
-	Renderer::IRendererPtr		mRenderer;						/**< Owner renderer instance, can be a null pointer */
-	unsigned int				mNumberOfCubeInstances;			/**< Number of cube instances */
-	Renderer::ITextureBufferPtr	mTextureBufferPerInstanceData;	/**< Texture buffer with per instance data (used via vertex texture fetch), each entry can contain a null pointer */
-	Renderer::IBlendStatePtr	mBlendState;					/**< Blend state, can be a null pointer */
+	Renderer::IRendererPtr		 mRenderer;								/**< Owner renderer instance, can be a null pointer */
+	unsigned int				 mNumberOfCubeInstances;				/**< Number of cube instances */
+	unsigned int				 mNumberOfVisibleCubeInstances;			/**< Number of cube instances which survived "cull()" */
+	Renderer::ITextureBufferPtr	 mTextureBufferPerInstanceData;			/**< Texture buffer with per instance data (used via vertex texture fetch), each entry can contain a null pointer */
+	Renderer::IBlendStatePtr	 mBlendState;							/**< Blend state, can be a null pointer */
+	FrustumCulling				 mFrustumCulling;						/**< Frustum culling of the cube instances */
+	float						*mVisiblePerInstanceData;				/**< Per instance data of the visible cube instances, streamed into the texture buffer each frame, can be a null pointer */
+	bool						 mCulledInstanceBuffer;					/**< Does the texture buffer currently only contain the visible cube instances? */
+	Renderer::ITextureBufferPtr	 mTextureBufferVisiblePerInstanceData;	/**< Texture buffer receiving the per instance data of the visible cube instances when culling on the GPU, can be a null pointer */
+	Renderer::IIndirectBufferPtr mIndirectBuffer;						/**< Indirect buffer receiving the draw arguments when culling on the GPU, can be a null pointer */
 
 
 };
@@ -38,11 +38,13 @@
 *  @brief
 *    Constructor
 */
-CubeRendererDrawInstanced::CubeRendererDrawInstanced(Renderer::IRenderer &renderer, unsigned int numberOfTextures, unsigned int sceneRadius) :
+CubeRendererDrawInstanced::CubeRendererDrawInstanced(Renderer::IRenderer &renderer, unsigned int numberOfTextures, unsigned int sceneRadius, RendererToolkit::IJobSystem *jobSystem, RendererToolkit::IRendererToolkit *rendererToolkit) :
+	ICubeRenderer(jobSystem),
 	mRenderer(&renderer),
 	mNumberOfTextures(numberOfTextures),
 	mSceneRadius(sceneRadius),
 	mMaximumNumberOfInstancesPerBatch(0),
+	mCubeMeshIndex(~0u),
 	mNumberOfBatches(0),
 	mBatches(nullptr)
 {
@@ -125,16 +127,7 @@ CubeRendererDrawInstanced::CubeRendererDrawInstanced(Renderer::IRenderer &render
 		if (mRenderer->getCapabilities().uniformBuffer)
 		{
 			{ // Create and set constant program uniform buffer at once
-				// TODO(co) Uggly fixed hacked in model-view-projection matrix
-				// TODO(co) OpenGL matrix, Direct3D has minor differences within the projection matrix we have to compensate
-				static const float MVP[] =
-				{
-					 1.2803299f,	-0.97915620f,	-0.58038759f,	-0.57922798f,
-					 0.0f,			 1.9776078f,	-0.57472473f,	-0.573576453f,
-					-1.2803299f,	-0.97915620f,	-0.58038759f,	-0.57922798f,
-					 0.0f,			 0.0f,			 9.8198195f,	 10.0f
-				};
-				mUniformBufferStaticVs = shaderLanguage->createUniformBuffer(sizeof(MVP), MVP, Renderer::BufferUsage::STATIC_DRAW);
+				mUniformBufferStaticVs = shaderLanguage->createUniformBuffer(sizeof(MODEL_VIEW_PROJECTION), MODEL_VIEW_PROJECTION, Renderer::BufferUsage::STATIC_DRAW);
 			}
 
 			// Create dynamic uniform buffers
@@ -194,7 +187,8 @@ CubeRendererDrawInstanced::CubeRendererDrawInstanced(Renderer::IRenderer &render
 				-0.5f,  0.5f,  0.5f,		1.0f, 1.0f,		-1.0f, 0.0f, 0.0f,	// 22
 				-0.5f,  0.5f, -0.5f,		0.0f, 1.0f,		-1.0f, 0.0f, 0.0f	// 23
 			};
-			Renderer::IVertexBufferPtr vertexBuffer(mRenderer->createVertexBuffer(sizeof(VERTEX_POSITION), VERTEX_POSITION, Renderer::BufferUsage::STATIC_DRAW));
+			// -> When using a mesh batch, the vertex megabuffer of the mesh batch is used instead
+			Renderer::IVertexBufferPtr vertexBuffer;
 
 			// Create the index buffer object (IBO)
 			static const unsigned short INDICES[] =
@@ -218,7 +212,32 @@ CubeRendererDrawInstanced::CubeRendererDrawInstanced(Renderer::IRenderer &render
 				21, 20, 22,		// 10
 				23, 22, 20		// 11
 			};
-			Renderer::IIndexBuffer *indexBuffer = mRenderer->createIndexBuffer(sizeof(INDICES), Renderer::IndexBufferFormat::UNSIGNED_SHORT, INDICES, Renderer::BufferUsage::STATIC_DRAW);
+			Renderer::IIndexBuffer *indexBuffer = nullptr;
+
+			// Put the cube into a mesh batch, the cube instances are then drawn by using the multi-draw indexed indirect call of the mesh batch
+			// -> The mesh batch only supports 32-bit indices
+			if (nullptr != rendererToolkit)
+			{
+				mMeshBatch = rendererToolkit->createMeshBatch(sizeof(float) * (3 + 2 + 3));
+				if (nullptr != mMeshBatch)
+				{
+					unsigned int indices[sizeof(INDICES) / sizeof(unsigned short)];
+					for (unsigned int i = 0; i < sizeof(INDICES) / sizeof(unsigned short); ++i)
+					{
+						indices[i] = INDICES[i];
+					}
+					mCubeMeshIndex = mMeshBatch->addMesh(VERTEX_POSITION, 24, indices, sizeof(INDICES) / sizeof(unsigned short));
+					if (~0u == mCubeMeshIndex)
+					{
+						mMeshBatch = nullptr;
+					}
+				}
+			}
+			if (nullptr == mMeshBatch)
+			{
+				vertexBuffer = mRenderer->createVertexBuffer(sizeof(VERTEX_POSITION), VERTEX_POSITION, Renderer::BufferUsage::STATIC_DRAW);
+				indexBuffer = mRenderer->createIndexBuffer(sizeof(INDICES), Renderer::IndexBufferFormat::UNSIGNED_SHORT, INDICES, Renderer::BufferUsage::STATIC_DRAW);
+			}
 
 			// Create vertex array object (VAO)
 			// -> The vertex array object (VAO) keeps a reference to the used vertex buffer object (VBO)
@@ -226,6 +245,7 @@ CubeRendererDrawInstanced::CubeRendererDrawInstanced(Renderer::IRenderer &render
 			// -> When the vertex array object (VAO) is destroyed, it automatically decreases the
 			//    reference of the used vertex buffer objects (VBO). If the reference counter of a
 			//    vertex buffer object (VBO) reaches zero, it's automatically destroyed.
+			// -> When using a mesh batch, the vertex buffer of the attributes is a null pointer and the mesh batch sources them from its vertex megabuffer
 			const Renderer::VertexArrayAttribute vertexArray[] =
 			{
 				{ // Attribute 0
@@ -268,7 +288,37 @@ CubeRendererDrawInstanced::CubeRendererDrawInstanced(Renderer::IRenderer &render
 					0										// instancesPerElement (unsigned int)
 				}
 			};
-			mVertexArray = mProgram->createVertexArray(sizeof(vertexArray) / sizeof(Renderer::VertexArrayAttribute), vertexArray, indexBuffer);
+			if (nullptr != mMeshBatch)
+			{
+				mVertexArray = mMeshBatch->createVertexArray(*mProgram, sizeof(vertexArray) / sizeof(Renderer::VertexArrayAttribute), vertexArray);
+			}
+			else
+			{
+				mVertexArray = mProgram->createVertexArray(sizeof(vertexArray) / sizeof(Renderer::VertexArrayAttribute), vertexArray, indexBuffer);
+			}
+
+			// GPU culling: A compute shader culls the cube instances and writes the draw arguments, the cubes are then drawn indirectly
+			// -> Requires compute shaders, native multi-draw indirect (else the draw arguments would be read back to the CPU) and uniform buffers
+			const Renderer::Capabilities &capabilities = mRenderer->getCapabilities();
+			if (capabilities.computeShader && capabilities.multiDrawIndirect && capabilities.uniformBuffer)
+			{
+				// Get the shader source code (outsourced to keep an overview)
+				// -> There's only an OpenGL compute shader, other renderers will just use CPU culling
+				const char *computeShaderSourceCode = nullptr;
+				#include "CubeRendererDrawInstanced_GLSL_430.h"
+
+				// Create the compute program
+				if (nullptr != computeShaderSourceCode)
+				{
+					mComputeProgram = shaderLanguage->createComputeProgram(shaderLanguage->createComputeShader(computeShaderSourceCode));
+					if (nullptr != mComputeProgram)
+					{
+						// Create the dynamic uniform buffer: Six view frustum planes and the bounding sphere radius scale, padded to a multiple of four floats
+						mUniformBufferDynamicCs = shaderLanguage->createUniformBuffer(sizeof(float) * (6 * 4 + 4), nullptr, Renderer::BufferUsage::DYNAMIC_DRAW);
+					}
+				}
+			}
+			mGpuCullingSupported = (nullptr != mComputeProgram && nullptr != mUniformBufferDynamicCs);
 		}
 	}
 
@@ -327,7 +377,7 @@ void CubeRendererDrawInstanced::setNumberOfCubes(unsigned int numberOfCubes)
 	for (int remaningNumberOfCubes = static_cast<int>(numberOfSolidCubes); batch < lastBatch; ++batch, remaningNumberOfCubes -= mMaximumNumberOfInstancesPerBatch)
 	{
 		const unsigned int numberOfCubes = (remaningNumberOfCubes > static_cast<int>(mMaximumNumberOfInstancesPerBatch)) ? mMaximumNumberOfInstancesPerBatch : remaningNumberOfCubes;
-		batch->initialize(*mRenderer, numberOfCubes, false, mNumberOfTextures, mSceneRadius);
+		batch->initialize(*mRenderer, numberOfCubes, false, mNumberOfTextures, mSceneRadius, mGpuCullingSupported, mJobSystem);
 	}
 
 	// Initialize the transparent batches
@@ -336,7 +386,7 @@ void CubeRendererDrawInstanced::setNumberOfCubes(unsigned int numberOfCubes)
 	for (int remaningNumberOfCubes = static_cast<int>(numberOfTransparentCubes); batch < lastBatch; ++batch, remaningNumberOfCubes -= mMaximumNumberOfInstancesPerBatch)
 	{
 		const unsigned int numberOfCubes = (remaningNumberOfCubes > static_cast<int>(mMaximumNumberOfInstancesPerBatch)) ? mMaximumNumberOfInstancesPerBatch : remaningNumberOfCubes;
-		batch->initialize(*mRenderer, numberOfCubes, true, mNumberOfTextures, mSceneRadius);
+		batch->initialize(*mRenderer, numberOfCubes, true, mNumberOfTextures, mSceneRadius, mGpuCullingSupported, mJobSystem);
 	}
 
 	// End debug event
@@ -351,6 +401,38 @@ void CubeRendererDrawInstanced::draw(float globalTimer, float globalScale, float
 		// Begin debug event
 		RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(mRenderer)
 
+		// Cull the cube instances on the GPU?
+		const bool gpuCulling = (nullptr != mBatches && mFrustumCulling && isGpuCulling());
+		if (gpuCulling)
+		{
+			{ // Copy the view frustum into the uniform buffer
+				FrustumCulling::Frustum frustum;
+				calculateFrustum(globalTimer, globalScale, frustum);
+				float uniformBufferData[6 * 4 + 4];
+				memcpy(uniformBufferData, frustum.planes, sizeof(frustum.planes));
+				uniformBufferData[6 * 4]     = frustum.radiusScale;
+				uniformBufferData[6 * 4 + 1] = 0.0f;
+				uniformBufferData[6 * 4 + 2] = 0.0f;
+				uniformBufferData[6 * 4 + 3] = 0.0f;
+				mUniformBufferDynamicCs->copyDataFrom(sizeof(uniformBufferData), uniformBufferData);
+			}
+
+			// Set the used compute program and uniform buffer
+			mRenderer->setProgram(mComputeProgram);
+			mRenderer->csSetUniformBuffer(mComputeProgram->getUniformBlockIndex("UniformBlockDynamicCs", 0), mUniformBufferDynamicCs);
+
+			// Cull the cube instances of all batches
+			BatchDrawInstanced *batch     = mBatches;
+			BatchDrawInstanced *lastBatch = mBatches + mNumberOfBatches;
+			for (; batch < lastBatch; ++batch)
+			{
+				batch->cullOnGpu();
+			}
+
+			// The visible cube instances are read via vertex texture fetch, the draw arguments by the indirect draw call
+			mRenderer->memoryBarrier(Renderer::MemoryBarrierFlag::TEXTURE_FETCH | Renderer::MemoryBarrierFlag::COMMAND);
+		}
+
 		// Set the used program
 		mRenderer->setProgram(mProgram);
 
@@ -385,18 +467,8 @@ void CubeRendererDrawInstanced::draw(float globalTimer, float globalScale, float
 		// Set constant program uniform
 		if (nullptr == mUniformBufferStaticVs)
 		{
-			// TODO(co) Uggly fixed hacked in model-view-projection matrix
-			// TODO(co) OpenGL matrix, Direct3D has minor differences within the projection matrix we have to compensate
-			static const float MVP[] =
-			{
-				 1.2803299f,	-0.97915620f,	-0.58038759f,	-0.57922798f,
-				 0.0f,			 1.9776078f,	-0.57472473f,	-0.573576453f,
-				-1.2803299f,	-0.97915620f,	-0.58038759f,	-0.57922798f,
-				 0.0f,			 0.0f,			 9.8198195f,	 10.0f
-			};
-
 			// There's no uniform buffer: We have to set individual uniforms
-			mProgram->setUniform4fv(mProgram->getUniformHandle("MVP"), MVP);
+			mProgram->setUniform4fv(mProgram->getUniformHandle("MVP"), MODEL_VIEW_PROJECTION);
 		}
 
 		{ // Set program uniforms
@@ -428,15 +500,57 @@ void CubeRendererDrawInstanced::draw(float globalTimer, float globalScale, float
 		}
 
 		// Draw the batches
+		mNumberOfVisibleCubes = 0;
 		if (nullptr != mBatches)
 		{
+			// Calculate the view frustum the batches cull their cube instances against
+			FrustumCulling::Frustum frustum;
+			if (mFrustumCulling && !gpuCulling)
+			{
+				calculateFrustum(globalTimer, globalScale, frustum);
+			}
+
 			// Loop though all batches
 			BatchDrawInstanced *batch     = mBatches;
 			BatchDrawInstanced *lastBatch = mBatches + mNumberOfBatches;
-			for (; batch < lastBatch; ++batch)
+			if (gpuCulling)
 			{
-				// Draw this batch
-				batch->draw();
+				for (; batch < lastBatch; ++batch)
+				{
+					mNumberOfVisibleCubes += batch->drawGpuCulled();
+				}
+			}
+			else
+			{
+				// Cull the cube instances of all batches
+				bool drawsChanged = (nullptr != mMeshBatch && mMeshBatch->getNumberOfDraws() != mNumberOfBatches);
+				for (; batch < lastBatch; ++batch)
+				{
+					const unsigned int numberOfPreviouslyVisibleCubes = batch->getNumberOfVisibleCubeInstances();
+					const unsigned int numberOfVisibleCubes = batch->cull(mFrustumCulling ? &frustum : nullptr);
+					if (numberOfVisibleCubes != numberOfPreviouslyVisibleCubes)
+					{
+						drawsChanged = true;
+					}
+					mNumberOfVisibleCubes += numberOfVisibleCubes;
+				}
+
+				// Gather the draws of all batches into the mesh batch, one draw per batch
+				// -> The draws are only gathered again if the number of visible cube instances of a batch changed, so the indirect buffer of the mesh batch is only updated on change
+				if (nullptr != mMeshBatch && drawsChanged)
+				{
+					mMeshBatch->clearDraws();
+					for (batch = mBatches; batch < lastBatch; ++batch)
+					{
+						mMeshBatch->addDraw(mCubeMeshIndex, batch->getNumberOfVisibleCubeInstances());
+					}
+				}
+
+				// Draw the batches, each batch uses an own texture buffer and blend state
+				for (unsigned int i = 0; i < mNumberOfBatches; ++i)
+				{
+					mBatches[i].draw(mMeshBatch, i);
+				}
 			}
 		}
 
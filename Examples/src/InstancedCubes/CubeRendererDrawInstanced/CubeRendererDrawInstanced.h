@@ -32,6 +32,7 @@
 #include "InstancedCubes/ICubeRenderer.h"
 
 #include <Renderer/Renderer.h>
+#include <Renderer/RendererToolkit.h>
 
 
 //[-------------------------------------------------------]
@@ -52,6 +53,9 @@ class BatchDrawInstanced;
 *    - Draw instanced (shader model 4 feature, build in shader variable holding the current instance ID)
 *    - 2D array texture
 *    - Texture buffer
+*
+*    When a renderer toolkit is available, the cube geometry is put into a renderer toolkit mesh batch and
+*    each batch of cube instances is drawn by using the multi-draw indexed indirect call of the mesh batch.
 */
 class CubeRendererDrawInstanced : public ICubeRenderer
 {
@@ -71,8 +75,12 @@ public:
 	*    Number of textures, must be <ICubeRenderer::MAXIMUM_NUMBER_OF_TEXTURES
 	*  @param[in] sceneRadius
 	*    Scene radius
+	*  @param[in] jobSystem
+	*    Job system used to generate and cull the cube instances in parallel, can be a null pointer
+	*  @param[in] rendererToolkit
+	*    Renderer toolkit used to create the mesh batch holding the cube geometry, can be a null pointer in which case the cubes are drawn directly
 	*/
-	CubeRendererDrawInstanced(Renderer::IRenderer &renderer, unsigned int numberOfTextures, unsigned int sceneRadius);
+	CubeRendererDrawInstanced(Renderer::IRenderer &renderer, unsigned int numberOfTextures, unsigned int sceneRadius, RendererToolkit::IJobSystem *jobSystem, RendererToolkit::IRendererToolkit *rendererToolkit);
 
 	/**
 	*  @brief
@@ -93,19 +101,23 @@ public:
 //[ Private data                                          ]
 //[-------------------------------------------------------]
 private:
-	Renderer::IRendererPtr		  mRenderer;							/**< Renderer instance to use, always valid */
-	unsigned int				  mNumberOfTextures;					/**< Number of textures */
-	unsigned int				  mSceneRadius;							/**< Scene radius */
-	unsigned int				  mMaximumNumberOfInstancesPerBatch;	/**< Maximum number of instances per batch */
-	Renderer::ITexture2DArrayPtr  mTexture2DArray;						/**< 2D texture array, can be a null pointer */
-	Renderer::ISamplerStatePtr	  mSamplerState;						/**< Sampler state, can be a null pointer */
-	Renderer::IUniformBufferPtr	  mUniformBufferStaticVs;				/**< Static vertex shader uniform buffer object (UBO), can be a null pointer */
-	Renderer::IUniformBufferPtr	  mUniformBufferDynamicVs;				/**< Dynamic vertex shader uniform buffer object (UBO), can be a null pointer */
-	Renderer::IUniformBufferPtr	  mUniformBufferDynamicFs;				/**< Dynamic fragment shader uniform buffer object (UBO), can be a null pointer */
-	Renderer::IProgramPtr		  mProgram;								/**< Program, can be a null pointer */
-	Renderer::IVertexArrayPtr	  mVertexArray;							/**< Vertex array object (VAO), can be a null pointer */
-	unsigned int				  mNumberOfBatches;						/**< Current number of batches */
-	BatchDrawInstanced			 *mBatches;								/**< Batches, can be a null pointer */
+	Renderer::IRendererPtr			 mRenderer;							/**< Renderer instance to use, always valid */
+	unsigned int					 mNumberOfTextures;					/**< Number of textures */
+	unsigned int					 mSceneRadius;						/**< Scene radius */
+	unsigned int					 mMaximumNumberOfInstancesPerBatch;	/**< Maximum number of instances per batch */
+	Renderer::ITexture2DArrayPtr	 mTexture2DArray;					/**< 2D texture array, can be a null pointer */
+	Renderer::ISamplerStatePtr		 mSamplerState;						/**< Sampler state, can be a null pointer */
+	Renderer::IUniformBufferPtr		 mUniformBufferStaticVs;			/**< Static vertex shader uniform buffer object (UBO), can be a null pointer */
+	Renderer::IUniformBufferPtr		 mUniformBufferDynamicVs;			/**< Dynamic vertex shader uniform buffer object (UBO), can be a null pointer */
+	Renderer::IUniformBufferPtr		 mUniformBufferDynamicFs;			/**< Dynamic fragment shader uniform buffer object (UBO), can be a null pointer */
+	Renderer::IProgramPtr			 mProgram;							/**< Program, can be a null pointer */
+	Renderer::IVertexArrayPtr		 mVertexArray;						/**< Vertex array object (VAO), can be a null pointer */
+	RendererToolkit::IMeshBatchPtr	 mMeshBatch;						/**< Mesh batch holding the cube geometry, the vertex array is created by it, can be a null pointer */
+	unsigned int					 mCubeMeshIndex;					/**< Index of the cube mesh within the mesh batch */
+	Renderer::IUniformBufferPtr		 mUniformBufferDynamicCs;			/**< Dynamic compute shader uniform buffer object (UBO) with the view frustum used for GPU culling, can be a null pointer */
+	Renderer::IProgramPtr			 mComputeProgram;					/**< Compute program used for GPU culling, can be a null pointer */
+	unsigned int					 mNumberOfBatches;					/**< Current number of batches */
+	BatchDrawInstanced				*mBatches;							/**< Batches, can be a null pointer */
 
 
 };
@@ -0,0 +1,117 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Shader start                                          ]
+//[-------------------------------------------------------]
+#ifndef RENDERER_NO_OPENGL
+if (0 == strcmp(mRenderer->getName(), "OpenGL"))
+{
+
+
+//[-------------------------------------------------------]
+//[ Define helper macro                                   ]
+//[-------------------------------------------------------]
+#define STRINGIFY(ME) #ME
+
+
+//[-------------------------------------------------------]
+//[ Compute shader source code                            ]
+//[-------------------------------------------------------]
+// One compute shader invocation per cube instance
+computeShaderSourceCode =
+"#version 430\n"	// OpenGL 4.3 - required for compute shaders and shader storage buffers
+STRINGIFY(
+// Input
+layout(local_size_x = 64) in;	// Must match "BatchDrawInstanced::NUMBER_OF_THREADS_PER_GROUP"
+
+// Shader storage buffers
+layout(std430, binding = 0) readonly buffer PerInstanceDataBuffer	// Per instance data of all cube instances, same layout as the texture buffer used by the vertex shader
+{
+	vec4 PerInstanceData[];
+};
+layout(std430, binding = 1) writeonly buffer VisiblePerInstanceDataBuffer	// Receives the tightly packed per instance data of the visible cube instances
+{
+	vec4 VisiblePerInstanceData[];
+};
+layout(std430, binding = 2) buffer DrawArgumentsBuffer	// Indirect draw arguments, see "Renderer::DrawIndexedInstancedArguments"
+{
+	uint IndexCountPerInstance;
+	uint InstanceCount;	// Must be reset to zero before the dispatch
+	uint StartIndexLocation;
+	uint BaseVertexLocation;
+	uint StartInstanceLocation;
+};
+
+// Uniforms
+layout(std140) uniform UniformBlockDynamicCs
+{
+	vec4  FrustumPlanes[6];	// Normalized view frustum planes, xyz=Normal, w=Distance
+	float RadiusScale;		// Bounding sphere radius scale
+};
+
+// Programs
+void main()
+{
+	// Get the index of the cube instance, the dispatch might be two dimensional in case there are more groups than a single dimension can hold
+	uint instance = gl_GlobalInvocationID.y * gl_NumWorkGroups.x * gl_WorkGroupSize.x + gl_GlobalInvocationID.x;
+	if (instance >= uint(PerInstanceData.length()) / 2u)
+	{
+		return;
+	}
+
+	// Get the per instance position (xyz=Position, w=Slice of the 2D texture array to use)
+	vec4 perInstancePositionTexture = PerInstanceData[instance * 2u];
+
+	// Get the per instance rotation quaternion (xyz) and scale (w)
+	vec4 perInstanceRotationScale = PerInstanceData[instance * 2u + 1u];
+
+	// Bounding sphere test against the view frustum planes
+	// -> The cube has an edge length of one, so the bounding sphere radius is half of the cube diagonal
+	float radius = 0.8660254 * abs(perInstanceRotationScale.w) * RadiusScale;
+	for (int i = 0; i < 6; ++i)
+	{
+		if (dot(FrustumPlanes[i].xyz, perInstancePositionTexture.xyz) + FrustumPlanes[i].w + radius < 0.0)
+		{
+			// The cube instance is outside the view frustum
+			return;
+		}
+	}
+
+	// Append the visible cube instance
+	uint visibleInstance = atomicAdd(InstanceCount, 1u);
+	VisiblePerInstanceData[visibleInstance * 2u] = perInstancePositionTexture;
+	VisiblePerInstanceData[visibleInstance * 2u + 1u] = perInstanceRotationScale;
+}
+);	// STRINGIFY
+
+
+//[-------------------------------------------------------]
+//[ Undefine helper macro                                 ]
+//[-------------------------------------------------------]
+#undef STRINGIFY
+
+
+//[-------------------------------------------------------]
+//[ Shader end                                            ]
+//[-------------------------------------------------------]
+}
+#endif
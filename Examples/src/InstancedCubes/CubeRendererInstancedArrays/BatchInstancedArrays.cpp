@@ -22,10 +22,10 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "InstancedCubes/CubeRendererInstancedArrays/BatchInstancedArrays.h"
-#include "Framework/Quaternion.h"
-#include "Framework/EulerAngles.h"
+#include "InstancedCubes/ICubeRenderer.h"
 
 #include <stdlib.h> // For rand()
+#include <string.h> // For memcpy()
 
 
 //[-------------------------------------------------------]
@@ -36,7 +36,9 @@
 *    Default constructor
 */
 BatchInstancedArrays::BatchInstancedArrays() :
-	mNumberOfCubeInstances(0)
+	mNumberOfCubeInstances(0),
+	mVisiblePerInstanceData(nullptr),
+	mCulledInstanceBuffer(false)
 {
 	// Nothing to do in here
 }
@@ -48,13 +50,19 @@ BatchInstancedArrays::BatchInstancedArrays() :
 BatchInstancedArrays::~BatchInstancedArrays()
 {
 	// The renderer resource pointers are released automatically
+
+	// Destroy the per instance data of the visible cube instances
+	if (nullptr != mVisiblePerInstanceData)
+	{
+		delete [] mVisiblePerInstanceData;
+	}
 }
 
 /**
 *  @brief
 *    Initialize the batch
 */
-void BatchInstancedArrays::initialize(Renderer::IVertexBuffer &vertexBuffer, Renderer::IIndexBuffer &indexBuffer, Renderer::IProgram &program, unsigned int numberOfCubeInstances, bool alphaBlending, unsigned int numberOfTextures, unsigned int sceneRadius)
+void BatchInstancedArrays::initialize(Renderer::IVertexBuffer &vertexBuffer, Renderer::IIndexBuffer &indexBuffer, Renderer::IProgram &program, unsigned int numberOfCubeInstances, bool alphaBlending, unsigned int numberOfTextures, unsigned int sceneRadius, RendererToolkit::IJobSystem *jobSystem)
 {
 	// Begin debug event
 	RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(&program.getRenderer())
@@ -62,10 +70,18 @@ void BatchInstancedArrays::initialize(Renderer::IVertexBuffer &vertexBuffer, Ren
 	// Release previous data if required
 	mBlendState = nullptr;
 	mVertexArray = nullptr;
+	mVertexBufferPerInstanceData = nullptr;
 
 	// Set owner renderer instance
 	mRenderer = &vertexBuffer.getRenderer();
 
+	if (nullptr != mVisiblePerInstanceData)
+	{
+		delete [] mVisiblePerInstanceData;
+		mVisiblePerInstanceData = nullptr;
+	}
+	mCulledInstanceBuffer = false;
+
 	// Set the number of cube instance
 	mNumberOfCubeInstances = numberOfCubeInstances;
 
@@ -73,56 +89,18 @@ void BatchInstancedArrays::initialize(Renderer::IVertexBuffer &vertexBuffer, Ren
 		// Allocate the local per instance data
 		const unsigned int numberOfElements = mNumberOfCubeInstances * 2 * 4;
 		float *data = new float[numberOfElements];
-		float *dataCurrent = data;
-
-		// Set data
-		// -> Layout: [Position][Rotation][Position][Rotation]...
-		//    - Position: xyz=Position, w=Slice of the 2D texture array to use
-		//    - Rotation: Rotation quaternion (xyz) and scale (w)
-		//      -> We don't need to store the w component of the quaternion. It's normalized and storing
-		//         three components while recomputing the fourths component is be sufficient.
-		Quaternion quaternion;	// Identity rotation quaternion
-		for (unsigned int i = 0; i < mNumberOfCubeInstances; ++i)
-		{
-			{ // Position
-				// r=x
-				*dataCurrent = -static_cast<int>(sceneRadius) + 2 * sceneRadius * (rand() % 65536) / 65536.0f;
-				++dataCurrent;
-				// g=y
-				*dataCurrent = -static_cast<int>(sceneRadius) + 2 * sceneRadius * (rand() % 65536) / 65536.0f;
-				++dataCurrent;
-				// b=z
-				*dataCurrent = -static_cast<int>(sceneRadius) + 2 * sceneRadius * (rand() % 65536) / 65536.0f;
-				++dataCurrent;
-				// a=Slice of the 2D texture array to use
-				*dataCurrent = static_cast<float>(rand() % numberOfTextures); // Choose a random texture
-				++dataCurrent;
-			}
 
-			{ // Rotation
-				EulerAngles::toQuaternion((rand() % 65536) / 65536.0f, (rand() % 65536) / 65536.0f * 2, (rand() % 65536) / 65536.0f * 3, quaternion);
-
-				// r=x
-				*dataCurrent = quaternion.x;
-				++dataCurrent;
-				// g=y
-				*dataCurrent = quaternion.y;
-				++dataCurrent;
-				// b=z
-				*dataCurrent = quaternion.z;
-				++dataCurrent;
-				// a=scale
-				*dataCurrent = 2.0f * (rand() % 65536) / 65536.0f;
-				++dataCurrent;
-			}
-		}
+		// Set random per instance data, see "ICubeRenderer::generatePerInstanceData()" for the data layout
+		ICubeRenderer::generatePerInstanceData(data, mNumberOfCubeInstances, numberOfTextures, sceneRadius, static_cast<unsigned int>(rand()), jobSystem);
 
 		// Create the vertex buffer object (VBO) instance containing the per-instance-data
-		Renderer::IVertexBuffer *vertexBufferPerInstanceData = mRenderer->createVertexBuffer(sizeof(float) * numberOfElements, data, Renderer::BufferUsage::STATIC_DRAW);
+		// -> The visible cube instances are streamed into the vertex buffer each frame
+		mVertexBufferPerInstanceData = mRenderer->createVertexBuffer(sizeof(float) * numberOfElements, data, Renderer::BufferUsage::DYNAMIC_DRAW);
 
 		{ // Create vertex array object (VAO)
 			// -> The vertex array object (VAO) keeps a reference to the used vertex buffer object (VBO)
-			// -> This means that there's no need to keep an own vertex buffer object (VBO) reference
+			// -> This means that there's usually no need to keep an own vertex buffer object (VBO) reference, we need
+			//    one for the per instance data in order to stream the visible cube instances into it
 			// -> When the vertex array object (VAO) is destroyed, it automatically decreases the
 			//    reference of the used vertex buffer objects (VBO). If the reference counter of a
 			//    vertex buffer object (VBO) reaches zero, it's automatically destroyed.
@@ -177,7 +155,7 @@ void BatchInstancedArrays::initialize(Renderer::IVertexBuffer &vertexBuffer, Ren
 					"TEXCOORD",								// semantic[64] (char)
 					1,										// semanticIndex (unsigned int)
 					// Data source
-					vertexBufferPerInstanceData,			// vertexBuffer (Renderer::IVertexBuffer *)
+					mVertexBufferPerInstanceData,			// vertexBuffer (Renderer::IVertexBuffer *)
 					0,										// offset (unsigned int)
 					sizeof(float) * 4 * 2,					// stride (unsigned int)
 					// Data source, instancing part
@@ -190,7 +168,7 @@ void BatchInstancedArrays::initialize(Renderer::IVertexBuffer &vertexBuffer, Ren
 					"TEXCOORD",								// semantic[64] (char)
 					2,										// semanticIndex (unsigned int)
 					// Data source
-					vertexBufferPerInstanceData,			// vertexBuffer (Renderer::IVertexBuffer *)
+					mVertexBufferPerInstanceData,			// vertexBuffer (Renderer::IVertexBuffer *)
 					sizeof(float) * 4,						// offset (unsigned int)
 					sizeof(float) * 4 * 2,					// stride (unsigned int)
 					// Data source, instancing part
@@ -200,6 +178,10 @@ void BatchInstancedArrays::initialize(Renderer::IVertexBuffer &vertexBuffer, Ren
 			mVertexArray = program.createVertexArray(sizeof(vertexArray) / sizeof(Renderer::VertexArrayAttribute), vertexArray, &indexBuffer);
 		}
 
+		// Initialize the frustum culling, the per instance data of the visible cube instances is written into a buffer of the same size
+		mFrustumCulling.initialize(mNumberOfCubeInstances, data, jobSystem);
+		mVisiblePerInstanceData = new float[numberOfElements];
+
 		// Free local per instance data
 		delete [] data;
 	}
@@ -220,14 +202,44 @@ void BatchInstancedArrays::initialize(Renderer::IVertexBuffer &vertexBuffer, Ren
 *  @brief
 *    Draw the batch
 */
-void BatchInstancedArrays::draw()
+unsigned int BatchInstancedArrays::draw(const FrustumCulling::Frustum *frustum)
 {
+	unsigned int numberOfDrawnCubeInstances = 0;
+
 	// Is there a valid renderer owner instance?
-	if (nullptr != mRenderer)
+	if (nullptr != mRenderer && nullptr != mVertexBufferPerInstanceData)
 	{
 		// Begin debug event
 		RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(mRenderer)
 
+		// Frustum culling
+		numberOfDrawnCubeInstances = mNumberOfCubeInstances;
+		if (nullptr != frustum)
+		{
+			// Stream the tightly packed visible cube instances into the vertex buffer
+			// -> When the vertex buffer can't be mapped, all cube instances are drawn
+			const unsigned int numberOfVisibleCubeInstances = mFrustumCulling.cull(*frustum, mVisiblePerInstanceData);
+			Renderer::MappedSubresource mappedSubresource;
+			if (mRenderer->map(*mVertexBufferPerInstanceData, 0, Renderer::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			{
+				memcpy(mappedSubresource.data, mVisiblePerInstanceData, sizeof(float) * FrustumCulling::NUMBER_OF_FLOATS_PER_INSTANCE * numberOfVisibleCubeInstances);
+				mRenderer->unmap(*mVertexBufferPerInstanceData, 0);
+				numberOfDrawnCubeInstances = numberOfVisibleCubeInstances;
+				mCulledInstanceBuffer = true;
+			}
+		}
+		else if (mCulledInstanceBuffer)
+		{
+			// Restore the per instance data of all cube instances
+			Renderer::MappedSubresource mappedSubresource;
+			if (mRenderer->map(*mVertexBufferPerInstanceData, 0, Renderer::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			{
+				memcpy(mappedSubresource.data, mFrustumCulling.getPerInstanceData(), sizeof(float) * FrustumCulling::NUMBER_OF_FLOATS_PER_INSTANCE * mNumberOfCubeInstances);
+				mRenderer->unmap(*mVertexBufferPerInstanceData, 0);
+				mCulledInstanceBuffer = false;
+			}
+		}
+
 		{ // Setup input assembly (IA)
 			// Set the used vertex array
 			mRenderer->iaSetVertexArray(mVertexArray);
@@ -238,11 +250,17 @@ void BatchInstancedArrays::draw()
 
 		// Use instancing in order to draw multiple cubes with just a single draw call
 		// -> Draw calls are one of the most expensive rendering, avoid them if possible
-		mRenderer->drawIndexedInstanced(0, 36, 0, 0, 24, mNumberOfCubeInstances);
+		if (numberOfDrawnCubeInstances > 0)
+		{
+			mRenderer->drawIndexedInstanced(0, 36, 0, 0, 24, numberOfDrawnCubeInstances);
+		}
 
 		// End debug event
 		RENDERER_END_DEBUG_EVENT(mRenderer)
 	}
+
+	// Done
+	return numberOfDrawnCubeInstances;
 }
 
 
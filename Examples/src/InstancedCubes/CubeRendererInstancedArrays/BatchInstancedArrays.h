@@ -29,6 +29,8 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "InstancedCubes/FrustumCulling.h"
+
 #include <Renderer/Renderer.h>
 
 
@@ -77,14 +79,22 @@ public:
 	*    Number of textures
 	*  @param[in] sceneRadius
 	*    Scene radius
+	*  @param[in] jobSystem
+	*    Job system used to generate and cull the cube instances in parallel, can be a null pointer
 	*/
-	void initialize(Renderer::IVertexBuffer &vertexBuffer, Renderer::IIndexBuffer &indexBuffer, Renderer::IProgram &program, unsigned int numberOfCubeInstances, bool alphaBlending, unsigned int numberOfTextures, unsigned int sceneRadius);
+	void initialize(Renderer::IVertexBuffer &vertexBuffer, Renderer::IIndexBuffer &indexBuffer, Renderer::IProgram &program, unsigned int numberOfCubeInstances, bool alphaBlending, unsigned int numberOfTextures, unsigned int sceneRadius, RendererToolkit::IJobSystem *jobSystem);
 
 	/**
 	*  @brief
 	*    Draw the batch
+	*
+	*  @param[in] frustum
+	*    View frustum to cull the instances against, can be a null pointer in which case all instances are drawn
+	*
+	*  @return
+	*    The number of drawn instances
 	*/
-	void draw();
+	unsigned int draw(const FrustumCulling::Frustum *frustum);
 
 
 //[-------------------------------------------------------]
@@ -117,10 +127,14 @@ private:
 //[ Private data                                          ]
 //[-------------------------------------------------------]
 private:
-	Renderer::IRendererPtr	  mRenderer;				/**< Owner renderer instance, can be a null pointer */
-	unsigned int			  mNumberOfCubeInstances;	/**< Number of cube instances */
-	Renderer::IVertexArrayPtr mVertexArray;				/**< Vertex array object (VAO), can be a null pointer */
-	Renderer::IBlendStatePtr  mBlendState;				/**< Blend state, can be a null pointer */
+	Renderer::IRendererPtr		mRenderer;						/**< Owner renderer instance, can be a null pointer */
+	unsigned int				mNumberOfCubeInstances;			/**< Number of cube instances */
+	Renderer::IVertexBufferPtr	mVertexBufferPerInstanceData;	/**< Vertex buffer object (VBO) with per instance data, can be a null pointer */
+	Renderer::IVertexArrayPtr	mVertexArray;					/**< Vertex array object (VAO), can be a null pointer */
+	Renderer::IBlendStatePtr	mBlendState;					/**< Blend state, can be a null pointer */
+	FrustumCulling				mFrustumCulling;				/**< Frustum culling of the cube instances */
+	float					   *mVisiblePerInstanceData;		/**< Per instance data of the visible cube instances, streamed into the vertex buffer each frame, can be a null pointer */
+	bool						mCulledInstanceBuffer;			/**< Does the vertex buffer currently only contain the visible cube instances? */
 
 
 };
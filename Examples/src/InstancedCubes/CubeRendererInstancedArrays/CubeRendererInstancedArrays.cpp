@@ -38,7 +38,8 @@
 *  @brief
 *    Constructor
 */
-CubeRendererInstancedArrays::CubeRendererInstancedArrays(Renderer::IRenderer &renderer, unsigned int numberOfTextures, unsigned int sceneRadius) :
+CubeRendererInstancedArrays::CubeRendererInstancedArrays(Renderer::IRenderer &renderer, unsigned int numberOfTextures, unsigned int sceneRadius, RendererToolkit::IJobSystem *jobSystem) :
+	ICubeRenderer(jobSystem),
 	mRenderer(&renderer),
 	mNumberOfTextures(numberOfTextures),
 	mSceneRadius(sceneRadius),
@@ -120,16 +121,7 @@ CubeRendererInstancedArrays::CubeRendererInstancedArrays(Renderer::IRenderer &re
 		if (mRenderer->getCapabilities().uniformBuffer)
 		{
 			{ // Create and set constant program uniform buffer at once
-				// TODO(co) Uggly fixed hacked in model-view-projection matrix
-				// TODO(co) OpenGL matrix, Direct3D has minor differences within the projection matrix we have to compensate
-				static const float MVP[] =
-				{
-					 1.2803299f,	-0.97915620f,	-0.58038759f,	-0.57922798f,
-					 0.0f,			 1.9776078f,	-0.57472473f,	-0.573576453f,
-					-1.2803299f,	-0.97915620f,	-0.58038759f,	-0.57922798f,
-					 0.0f,			 0.0f,			 9.8198195f,	 10.0f
-				};
-				mUniformBufferStaticVs = shaderLanguage->createUniformBuffer(sizeof(MVP), MVP, Renderer::BufferUsage::STATIC_DRAW);
+				mUniformBufferStaticVs = shaderLanguage->createUniformBuffer(sizeof(MODEL_VIEW_PROJECTION), MODEL_VIEW_PROJECTION, Renderer::BufferUsage::STATIC_DRAW);
 			}
 
 			// Create dynamic uniform buffers
@@ -143,6 +135,7 @@ CubeRendererInstancedArrays::CubeRendererInstancedArrays(Renderer::IRenderer &re
 			const char *fragmentShaderSourceCode = nullptr;
 			#include "CubeRendererInstancedArrays_GLSL_110.h"
 			#include "CubeRendererInstancedArrays_GLSL_140.h"
+			#include "CubeRendererInstancedArrays_GLSL_ES2.h"
 			#include "CubeRendererInstancedArrays_HLSL_D3D10_D3D11.h"
 			#include "CubeRendererInstancedArrays_HLSL_D3D9.h"
 			#include "CubeRendererInstancedArrays_Null.h"
@@ -275,7 +268,7 @@ void CubeRendererInstancedArrays::setNumberOfCubes(unsigned int numberOfCubes)
 	for (int remaningNumberOfCubes = static_cast<int>(numberOfSolidCubes); batch < lastBatch; ++batch, remaningNumberOfCubes -= mMaximumNumberOfInstancesPerBatch)
 	{
 		const unsigned int numberOfCubes = (remaningNumberOfCubes > static_cast<int>(mMaximumNumberOfInstancesPerBatch)) ? mMaximumNumberOfInstancesPerBatch : remaningNumberOfCubes;
-		batch->initialize(*mVertexBuffer, *mIndexBuffer, *mProgram, numberOfCubes, false, mNumberOfTextures, mSceneRadius);
+		batch->initialize(*mVertexBuffer, *mIndexBuffer, *mProgram, numberOfCubes, false, mNumberOfTextures, mSceneRadius, mJobSystem);
 	}
 
 	// Initialize the transparent batches
@@ -284,7 +277,7 @@ void CubeRendererInstancedArrays::setNumberOfCubes(unsigned int numberOfCubes)
 	for (int remaningNumberOfCubes = static_cast<int>(numberOfTransparentCubes); batch < lastBatch; ++batch, remaningNumberOfCubes -= mMaximumNumberOfInstancesPerBatch)
 	{
 		const unsigned int numberOfCubes = (remaningNumberOfCubes > static_cast<int>(mMaximumNumberOfInstancesPerBatch)) ? mMaximumNumberOfInstancesPerBatch : remaningNumberOfCubes;
-		batch->initialize(*mVertexBuffer, *mIndexBuffer, *mProgram, numberOfCubes, true, mNumberOfTextures, mSceneRadius);
+		batch->initialize(*mVertexBuffer, *mIndexBuffer, *mProgram, numberOfCubes, true, mNumberOfTextures, mSceneRadius, mJobSystem);
 	}
 
 	// End debug event
@@ -330,18 +323,8 @@ void CubeRendererInstancedArrays::draw(float globalTimer, float globalScale, flo
 		// Set constant program uniform
 		if (nullptr == mUniformBufferStaticVs)
 		{
-			// TODO(co) Uggly fixed hacked in model-view-projection matrix
-			// TODO(co) OpenGL matrix, Direct3D has minor differences within the projection matrix we have to compensate
-			static const float MVP[] =
-			{
-				 1.2803299f,	-0.97915620f,	-0.58038759f,	-0.57922798f,
-				 0.0f,			 1.9776078f,	-0.57472473f,	-0.573576453f,
-				-1.2803299f,	-0.97915620f,	-0.58038759f,	-0.57922798f,
-				 0.0f,			 0.0f,			 9.8198195f,	 10.0f
-			};
-
 			// There's no uniform buffer: We have to set individual uniforms
-			mProgram->setUniformMatrix4fv(mProgram->getUniformHandle("MVP"), MVP);
+			mProgram->setUniformMatrix4fv(mProgram->getUniformHandle("MVP"), MODEL_VIEW_PROJECTION);
 		}
 
 		{ // Set program uniforms
@@ -373,15 +356,23 @@ void CubeRendererInstancedArrays::draw(float globalTimer, float globalScale, flo
 		}
 
 		// Draw the batches
+		mNumberOfVisibleCubes = 0;
 		if (nullptr != mBatches)
 		{
+			// Calculate the view frustum the batches cull their cube instances against
+			FrustumCulling::Frustum frustum;
+			if (mFrustumCulling)
+			{
+				calculateFrustum(globalTimer, globalScale, frustum);
+			}
+
 			// Loop though all batches
 			BatchInstancedArrays *batch     = mBatches;
 			BatchInstancedArrays *lastBatch = mBatches + mNumberOfBatches;
 			for (; batch < lastBatch; ++batch)
 			{
 				// Draw this batch
-				batch->draw();
+				mNumberOfVisibleCubes += batch->draw(mFrustumCulling ? &frustum : nullptr);
 			}
 		}
 
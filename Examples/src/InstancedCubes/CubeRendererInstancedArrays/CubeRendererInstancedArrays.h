@@ -69,8 +69,10 @@ public:
 	*    Number of textures, must be <ICubeRenderer::MAXIMUM_NUMBER_OF_TEXTURES
 	*  @param[in] sceneRadius
 	*    Scene radius
+	*  @param[in] jobSystem
+	*    Job system used to generate and cull the cube instances in parallel, can be a null pointer
 	*/
-	CubeRendererInstancedArrays(Renderer::IRenderer &renderer, unsigned int numberOfTextures, unsigned int sceneRadius);
+	CubeRendererInstancedArrays(Renderer::IRenderer &renderer, unsigned int numberOfTextures, unsigned int sceneRadius, RendererToolkit::IJobSystem *jobSystem);
 
 	/**
 	*  @brief
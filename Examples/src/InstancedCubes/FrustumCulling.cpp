@@ -0,0 +1,385 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "InstancedCubes/FrustumCulling.h"
+
+#include <Renderer/RendererToolkit.h>
+
+#include <math.h>
+#include <string.h> // For memcpy() and memmove()
+#include <thread>
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#define INSTANCEDCUBES_FRUSTUMCULLING_SSE
+	#include <xmmintrin.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Public static methods                                 ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Calculate the view frustum from a model-view-projection matrix
+*/
+void FrustumCulling::calculateFrustum(const float *modelViewProjection, float offsetX, float offsetY, float offsetZ, float radiusScale, Frustum &frustum)
+{
+	// Extract the planes from the rows of the model-view-projection matrix (see "Fast Extraction of Viewing Frustum Planes from the
+	// World-View-Projection Matrix" by Gil Gribb and Klaus Hartmann), the matrix is column major so row n is [n], [4 + n], [8 + n], [12 + n]
+	// -> The OpenGL clip space depth range [-w, w] is used, for Direct3D the near plane is slightly too far away which is just conservative
+	const float *m = modelViewProjection;
+	for (int i = 0; i < 6; ++i)
+	{
+		// Left, right, bottom, top, near, far: Row 3 +/- row 0, 1, 2
+		const int   row  = i / 2;
+		const float sign = (i % 2) ? -1.0f : 1.0f;
+		float *plane = frustum.planes[i];
+		plane[0] = m[3]  + sign * m[row];
+		plane[1] = m[7]  + sign * m[4 + row];
+		plane[2] = m[11] + sign * m[8 + row];
+		plane[3] = m[15] + sign * m[12 + row];
+
+		// Normalize the plane so that the signed distance can be compared with the bounding sphere radius
+		const float length = sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+		if (length > 0.0f)
+		{
+			plane[0] /= length;
+			plane[1] /= length;
+			plane[2] /= length;
+			plane[3] /= length;
+		}
+
+		// Fold the offset into the plane distance
+		plane[3] += plane[0] * offsetX + plane[1] * offsetY + plane[2] * offsetZ;
+	}
+
+	// A negative scale mirrors the instances, but the bounding sphere stays the same
+	frustum.radiusScale = fabs(radiusScale);
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Default constructor
+*/
+FrustumCulling::FrustumCulling() :
+	mNumberOfInstances(0),
+	mNumberOfPaddedInstances(0),
+	mBoundingSpheres(nullptr),
+	mPerInstanceData(nullptr),
+	mJobSystem(nullptr)
+{
+	// Nothing to do in here
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+FrustumCulling::~FrustumCulling()
+{
+	// Destroy the bounding spheres and the per instance data
+	if (nullptr != mBoundingSpheres)
+	{
+		delete [] mBoundingSpheres;
+	}
+	if (nullptr != mPerInstanceData)
+	{
+		delete [] mPerInstanceData;
+	}
+}
+
+/**
+*  @brief
+*    Initialize the instances to cull
+*/
+void FrustumCulling::initialize(unsigned int numberOfInstances, const float *perInstanceData, RendererToolkit::IJobSystem *jobSystem)
+{
+	// Set the job system to use
+	mJobSystem = jobSystem;
+
+	// Release previous data if required
+	if (nullptr != mBoundingSpheres)
+	{
+		delete [] mBoundingSpheres;
+		mBoundingSpheres = nullptr;
+	}
+	if (nullptr != mPerInstanceData)
+	{
+		delete [] mPerInstanceData;
+		mPerInstanceData = nullptr;
+	}
+
+	// Set the number of instances, the structure of arrays (SoA) is padded so SSE can always process four instances at once
+	mNumberOfInstances		 = numberOfInstances;
+	mNumberOfPaddedInstances = (numberOfInstances + 3) & ~3u;
+	if (mNumberOfInstances > 0)
+	{
+		// Copy the per instance data, it's required to write out the visible instances
+		mPerInstanceData = new float[mNumberOfInstances * NUMBER_OF_FLOATS_PER_INSTANCE];
+		memcpy(mPerInstanceData, perInstanceData, sizeof(float) * mNumberOfInstances * NUMBER_OF_FLOATS_PER_INSTANCE);
+
+		// Fill the bounding spheres, padding is zero initialized and masked out during culling
+		// -> The cube has an edge length of one, so the bounding sphere radius is half of the cube diagonal
+		static const float CUBE_RADIUS = 0.8660254f;	// sqrt(3) / 2
+		mBoundingSpheres = new float[mNumberOfPaddedInstances * 4];
+		memset(mBoundingSpheres, 0, sizeof(float) * mNumberOfPaddedInstances * 4);
+		float *positionsX = mBoundingSpheres;
+		float *positionsY = positionsX + mNumberOfPaddedInstances;
+		float *positionsZ = positionsY + mNumberOfPaddedInstances;
+		float *radii	  = positionsZ + mNumberOfPaddedInstances;
+		const float *perInstanceDataCurrent = perInstanceData;
+		for (unsigned int i = 0; i < mNumberOfInstances; ++i, perInstanceDataCurrent += NUMBER_OF_FLOATS_PER_INSTANCE)
+		{
+			positionsX[i] = perInstanceDataCurrent[0];
+			positionsY[i] = perInstanceDataCurrent[1];
+			positionsZ[i] = perInstanceDataCurrent[2];
+			radii[i]	  = CUBE_RADIUS * fabs(perInstanceDataCurrent[7]);	// Per instance scale
+		}
+	}
+}
+
+/**
+*  @brief
+*    Return the number of instances
+*/
+unsigned int FrustumCulling::getNumberOfInstances() const
+{
+	return mNumberOfInstances;
+}
+
+/**
+*  @brief
+*    Return the per instance data
+*/
+const float *FrustumCulling::getPerInstanceData() const
+{
+	return mPerInstanceData;
+}
+
+/**
+*  @brief
+*    Cull the instances against the given view frustum
+*/
+unsigned int FrustumCulling::cull(const Frustum &frustum, float *visiblePerInstanceData) const
+{
+	// Get the number of threads to use, each thread gets a range of instances which is a multiple of four
+	// -> When using the job system, the worker threads and the calling thread are culling
+	unsigned int numberOfThreads = (nullptr != mJobSystem) ? mJobSystem->getNumberOfWorkerThreads() + 1 : std::thread::hardware_concurrency();
+	if (0 == numberOfThreads)
+	{
+		numberOfThreads = 1;
+	}
+	else if (numberOfThreads > MAXIMUM_NUMBER_OF_THREADS)
+	{
+		numberOfThreads = MAXIMUM_NUMBER_OF_THREADS;
+	}
+	const unsigned int maximumNumberOfThreads = (mNumberOfInstances + MINIMUM_NUMBER_OF_INSTANCES_PER_THREAD - 1) / MINIMUM_NUMBER_OF_INSTANCES_PER_THREAD;
+	if (numberOfThreads > maximumNumberOfThreads)
+	{
+		numberOfThreads = maximumNumberOfThreads;
+	}
+
+	// Single threaded?
+	if (numberOfThreads <= 1)
+	{
+		unsigned int numberOfVisibleInstances = 0;
+		cullRange(frustum, 0, mNumberOfInstances, visiblePerInstanceData, numberOfVisibleInstances);
+		return numberOfVisibleInstances;
+	}
+
+	// Cull the ranges in parallel
+	// -> Each range writes its visible instances to the start of its own part of the output, so there are no write conflicts
+	const unsigned int numberOfInstancesPerThread = ((mNumberOfInstances / numberOfThreads) + 3) & ~3u;
+	unsigned int numberOfVisibleInstancesPerThread[MAXIMUM_NUMBER_OF_THREADS];
+	if (nullptr != mJobSystem)
+	{
+		// One job per range, the job system reuses its worker threads instead of creating new threads each frame
+		CullJobData cullJobData;
+		cullJobData.frustumCulling					 = this;
+		cullJobData.frustum							 = &frustum;
+		cullJobData.numberOfRanges					 = numberOfThreads;
+		cullJobData.numberOfInstancesPerRange		 = numberOfInstancesPerThread;
+		cullJobData.visiblePerInstanceData			 = visiblePerInstanceData;
+		cullJobData.numberOfVisibleInstancesPerRange = numberOfVisibleInstancesPerThread;
+		mJobSystem->parallelFor(&FrustumCulling::cullJob, &cullJobData, numberOfThreads, 1);
+	}
+	else
+	{
+		// The calling thread processes the first range
+		std::thread threads[MAXIMUM_NUMBER_OF_THREADS];
+		for (unsigned int i = 1; i < numberOfThreads; ++i)
+		{
+			const unsigned int firstInstance = i * numberOfInstancesPerThread;
+			const unsigned int lastInstance  = (i + 1 < numberOfThreads) ? firstInstance + numberOfInstancesPerThread : mNumberOfInstances;
+			threads[i] = std::thread(&FrustumCulling::cullRange, this, std::cref(frustum), firstInstance, lastInstance, visiblePerInstanceData + firstInstance * NUMBER_OF_FLOATS_PER_INSTANCE, std::ref(numberOfVisibleInstancesPerThread[i]));
+		}
+		cullRange(frustum, 0, numberOfInstancesPerThread, visiblePerInstanceData, numberOfVisibleInstancesPerThread[0]);
+
+		// Wait for the threads
+		for (unsigned int i = 1; i < numberOfThreads; ++i)
+		{
+			threads[i].join();
+		}
+	}
+
+	// Compact the visible instances of the ranges
+	unsigned int numberOfVisibleInstances = numberOfVisibleInstancesPerThread[0];
+	for (unsigned int i = 1; i < numberOfThreads; ++i)
+	{
+		memmove(visiblePerInstanceData + numberOfVisibleInstances * NUMBER_OF_FLOATS_PER_INSTANCE, visiblePerInstanceData + i * numberOfInstancesPerThread * NUMBER_OF_FLOATS_PER_INSTANCE, sizeof(float) * numberOfVisibleInstancesPerThread[i] * NUMBER_OF_FLOATS_PER_INSTANCE);
+		numberOfVisibleInstances += numberOfVisibleInstancesPerThread[i];
+	}
+
+	// Done
+	return numberOfVisibleInstances;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static methods                                ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Job function culling instance ranges
+*/
+void FrustumCulling::cullJob(void *data, unsigned int firstElement, unsigned int lastElement)
+{
+	const CullJobData &cullJobData = *static_cast<const CullJobData*>(data);
+	for (unsigned int i = firstElement; i < lastElement; ++i)
+	{
+		const unsigned int firstInstance = i * cullJobData.numberOfInstancesPerRange;
+		const unsigned int lastInstance  = (i + 1 < cullJobData.numberOfRanges) ? firstInstance + cullJobData.numberOfInstancesPerRange : cullJobData.frustumCulling->mNumberOfInstances;
+		cullJobData.frustumCulling->cullRange(*cullJobData.frustum, firstInstance, lastInstance, cullJobData.visiblePerInstanceData + firstInstance * NUMBER_OF_FLOATS_PER_INSTANCE, cullJobData.numberOfVisibleInstancesPerRange[i]);
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Cull a range of instances against the given view frustum
+*/
+void FrustumCulling::cullRange(const Frustum &frustum, unsigned int firstInstance, unsigned int lastInstance, float *visiblePerInstanceData, unsigned int &numberOfVisibleInstances) const
+{
+	const float *positionsX = mBoundingSpheres;
+	const float *positionsY = positionsX + mNumberOfPaddedInstances;
+	const float *positionsZ = positionsY + mNumberOfPaddedInstances;
+	const float *radii		= positionsZ + mNumberOfPaddedInstances;
+	float *visiblePerInstanceDataCurrent = visiblePerInstanceData;
+
+	#ifdef INSTANCEDCUBES_FRUSTUMCULLING_SSE
+		// Splat the frustum planes
+		__m128 planes[6][4];
+		for (int i = 0; i < 6; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				planes[i][j] = _mm_set1_ps(frustum.planes[i][j]);
+			}
+		}
+		const __m128 radiusScale = _mm_set1_ps(frustum.radiusScale);
+		const __m128 zero		 = _mm_setzero_ps();
+
+		// Test four bounding spheres at once
+		for (unsigned int i = firstInstance; i < lastInstance; i += 4)
+		{
+			const __m128 x = _mm_loadu_ps(positionsX + i);
+			const __m128 y = _mm_loadu_ps(positionsY + i);
+			const __m128 z = _mm_loadu_ps(positionsZ + i);
+			const __m128 r = _mm_mul_ps(_mm_loadu_ps(radii + i), radiusScale);
+
+			// A bounding sphere is visible if it's not completely behind one of the planes
+			__m128 visible = _mm_cmpeq_ps(zero, zero);	// All bits set
+			for (int j = 0; j < 6; ++j)
+			{
+				const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, planes[j][0]), _mm_mul_ps(y, planes[j][1])), _mm_add_ps(_mm_mul_ps(z, planes[j][2]), planes[j][3])), r);
+				visible = _mm_and_ps(visible, _mm_cmpge_ps(distance, zero));
+			}
+			int mask = _mm_movemask_ps(visible);
+
+			// Mask out the padding
+			if (lastInstance - i < 4)
+			{
+				mask &= (1 << (lastInstance - i)) - 1;
+			}
+
+			// Write out the visible instances
+			for (unsigned int j = 0; 0 != mask; ++j, mask >>= 1)
+			{
+				if (mask & 1)
+				{
+					memcpy(visiblePerInstanceDataCurrent, mPerInstanceData + (i + j) * NUMBER_OF_FLOATS_PER_INSTANCE, sizeof(float) * NUMBER_OF_FLOATS_PER_INSTANCE);
+					visiblePerInstanceDataCurrent += NUMBER_OF_FLOATS_PER_INSTANCE;
+				}
+			}
+		}
+	#else
+		// Test one bounding sphere at once
+		for (unsigned int i = firstInstance; i < lastInstance; ++i)
+		{
+			// A bounding sphere is visible if it's not completely behind one of the planes
+			const float radius = radii[i] * frustum.radiusScale;
+			bool visible = true;
+			for (int j = 0; j < 6 && visible; ++j)
+			{
+				const float *plane = frustum.planes[j];
+				visible = (positionsX[i] * plane[0] + positionsY[i] * plane[1] + positionsZ[i] * plane[2] + plane[3] + radius >= 0.0f);
+			}
+
+			// Write out the visible instance
+			if (visible)
+			{
+				memcpy(visiblePerInstanceDataCurrent, mPerInstanceData + i * NUMBER_OF_FLOATS_PER_INSTANCE, sizeof(float) * NUMBER_OF_FLOATS_PER_INSTANCE);
+				visiblePerInstanceDataCurrent += NUMBER_OF_FLOATS_PER_INSTANCE;
+			}
+		}
+	#endif
+
+	// Done
+	numberOfVisibleInstances = static_cast<unsigned int>((visiblePerInstanceDataCurrent - visiblePerInstanceData) / NUMBER_OF_FLOATS_PER_INSTANCE);
+}
+
+/**
+*  @brief
+*    Copy constructor
+*/
+FrustumCulling::FrustumCulling(const FrustumCulling &)
+{
+	// Not supported
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+FrustumCulling &FrustumCulling::operator =(const FrustumCulling &)
+{
+	// Not supported
+	return *this;
+}
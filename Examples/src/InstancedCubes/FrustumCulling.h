@@ -0,0 +1,270 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __INSTANCEDCUBES_FRUSTUMCULLING_H__
+#define __INSTANCEDCUBES_FRUSTUMCULLING_H__
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+	class IJobSystem;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Frustum culling of cube instances
+*
+*  @remarks
+*    The per instance data has the layout used by the cube renderers:
+*    - Layout: [Position][Rotation][Position][Rotation]...
+*      - Position: xyz=Position, w=Slice of the 2D texture array to use
+*      - Rotation: Rotation quaternion (xyz) and scale (w)
+*
+*    The bounding spheres of the instances are kept as structure of arrays (SoA) so they can be tested
+*    against the view frustum four at a time by using SSE. Large instance sets are split into ranges which
+*    are processed in parallel by the worker threads of the given job system or, if there's none, by temporary
+*    threads. The visible instances are written tightly packed into
+*    a given per instance data buffer so that the result can directly be streamed into the instance buffer
+*    used for drawing.
+*/
+class FrustumCulling
+{
+
+
+//[-------------------------------------------------------]
+//[ Public definitions                                    ]
+//[-------------------------------------------------------]
+public:
+	static const unsigned int NUMBER_OF_FLOATS_PER_INSTANCE = 2 * 4;	/**< Number of floats per instance within the per instance data */
+
+	/**
+	*  @brief
+	*    View frustum
+	*/
+	struct Frustum
+	{
+		float planes[6][4];	/**< Normalized view frustum planes (xyz=Normal pointing inside, w=Distance), left, right, bottom, top, near, far */
+		float radiusScale;	/**< Scale to apply to the bounding sphere radius of all instances */
+	};
+
+
+//[-------------------------------------------------------]
+//[ Public static methods                                 ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Calculate the view frustum from a model-view-projection matrix
+	*
+	*  @param[in]  modelViewProjection
+	*    Column major OpenGL style model-view-projection matrix (16 floats)
+	*  @param[in]  offsetX
+	*    X component of the world space offset added to all instance positions
+	*  @param[in]  offsetY
+	*    Y component of the world space offset added to all instance positions
+	*  @param[in]  offsetZ
+	*    Z component of the world space offset added to all instance positions
+	*  @param[in]  radiusScale
+	*    Scale to apply to the bounding sphere radius of all instances (e.g. a global scale)
+	*  @param[out] frustum
+	*    Receives the view frustum
+	*
+	*  @note
+	*    - The offset is folded into the frustum planes, this way animations which move all instances
+	*      at once don't require touching the per instance bounds
+	*/
+	static void calculateFrustum(const float *modelViewProjection, float offsetX, float offsetY, float offsetZ, float radiusScale, Frustum &frustum);
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Default constructor
+	*/
+	FrustumCulling();
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	~FrustumCulling();
+
+	/**
+	*  @brief
+	*    Initialize the instances to cull
+	*
+	*  @param[in] numberOfInstances
+	*    Number of instances
+	*  @param[in] perInstanceData
+	*    Per instance data, must contain "numberOfInstances" * "NUMBER_OF_FLOATS_PER_INSTANCE" floats, the data is copied
+	*  @param[in] jobSystem
+	*    Job system used to cull large instance sets in parallel, can be a null pointer, must stay valid as long as this instance is used
+	*/
+	void initialize(unsigned int numberOfInstances, const float *perInstanceData, RendererToolkit::IJobSystem *jobSystem);
+
+	/**
+	*  @brief
+	*    Return the number of instances
+	*
+	*  @return
+	*    The number of instances
+	*/
+	unsigned int getNumberOfInstances() const;
+
+	/**
+	*  @brief
+	*    Return the per instance data
+	*
+	*  @return
+	*    The per instance data of all instances, can be a null pointer, do not destroy the returned instance
+	*/
+	const float *getPerInstanceData() const;
+
+	/**
+	*  @brief
+	*    Cull the instances against the given view frustum
+	*
+	*  @param[in]  frustum
+	*    View frustum to cull against
+	*  @param[out] visiblePerInstanceData
+	*    Receives the per instance data of the visible instances tightly packed, must be able to hold the per instance data of all instances
+	*
+	*  @return
+	*    The number of visible instances
+	*/
+	unsigned int cull(const Frustum &frustum, float *visiblePerInstanceData) const;
+
+
+//[-------------------------------------------------------]
+//[ Private definitions                                   ]
+//[-------------------------------------------------------]
+private:
+	static const unsigned int MINIMUM_NUMBER_OF_INSTANCES_PER_THREAD = 16384;	/**< Minimum number of instances per thread, below this it's cheaper to cull on a single thread */
+	static const unsigned int MAXIMUM_NUMBER_OF_THREADS				 = 16;		/**< Maximum number of used threads */
+
+	/**
+	*  @brief
+	*    Data of the jobs culling the instance ranges
+	*/
+	struct CullJobData
+	{
+		const FrustumCulling *frustumCulling;						/**< Owner frustum culling instance, always valid */
+		const Frustum		 *frustum;								/**< View frustum to cull against, always valid */
+		unsigned int		  numberOfRanges;						/**< Number of instance ranges */
+		unsigned int		  numberOfInstancesPerRange;			/**< Number of instances per range, a multiple of four, the last range gets the remaining instances */
+		float				 *visiblePerInstanceData;				/**< Receives the per instance data of the visible instances, each range starts at the position of its first instance */
+		unsigned int		 *numberOfVisibleInstancesPerRange;		/**< Receives the number of visible instances of each range */
+	};
+
+
+//[-------------------------------------------------------]
+//[ Private static methods                                ]
+//[-------------------------------------------------------]
+private:
+	/**
+	*  @brief
+	*    Job function culling instance ranges
+	*
+	*  @param[in] data
+	*    "FrustumCulling::CullJobData" instance, must be valid
+	*  @param[in] firstElement
+	*    Index of the first instance range to cull
+	*  @param[in] lastElement
+	*    Index of the instance range after the last instance range to cull
+	*/
+	static void cullJob(void *data, unsigned int firstElement, unsigned int lastElement);
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	/**
+	*  @brief
+	*    Cull a range of instances against the given view frustum
+	*
+	*  @param[in]  frustum
+	*    View frustum to cull against
+	*  @param[in]  firstInstance
+	*    Index of the first instance to cull, must be a multiple of four
+	*  @param[in]  lastInstance
+	*    Index of the instance after the last instance to cull
+	*  @param[out] visiblePerInstanceData
+	*    Receives the per instance data of the visible instances of the range tightly packed
+	*  @param[out] numberOfVisibleInstances
+	*    Receives the number of visible instances of the range
+	*/
+	void cullRange(const Frustum &frustum, unsigned int firstInstance, unsigned int lastInstance, float *visiblePerInstanceData, unsigned int &numberOfVisibleInstances) const;
+
+	/**
+	*  @brief
+	*    Copy constructor
+	*
+	*  @param[in] source
+	*    Source to copy from
+	*/
+	explicit FrustumCulling(const FrustumCulling &source);
+
+	/**
+	*  @brief
+	*    Copy operator
+	*
+	*  @param[in] source
+	*    Source to copy from
+	*
+	*  @return
+	*    Reference to this instance
+	*/
+	FrustumCulling &operator =(const FrustumCulling &source);
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	unsigned int				 mNumberOfInstances;		/**< Number of instances */
+	unsigned int				 mNumberOfPaddedInstances;	/**< Number of instances rounded up to a multiple of four */
+	float						*mBoundingSpheres;			/**< Bounding spheres as structure of arrays (SoA): "mNumberOfPaddedInstances" x positions, y positions, z positions and radii, can be a null pointer */
+	float						*mPerInstanceData;			/**< Copy of the per instance data, can be a null pointer */
+	RendererToolkit::IJobSystem	*mJobSystem;				/**< Job system used to cull large instance sets in parallel, can be a null pointer */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __INSTANCEDCUBES_FRUSTUMCULLING_H__
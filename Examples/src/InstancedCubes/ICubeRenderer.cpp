@@ -22,6 +22,51 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "InstancedCubes/ICubeRenderer.h"
+#include "Framework/Quaternion.h"
+#include "Framework/EulerAngles.h"
+
+#include <Renderer/RendererToolkit.h>
+
+#include <math.h>
+
+
+//[-------------------------------------------------------]
+//[ Protected static data                                 ]
+//[-------------------------------------------------------]
+// TODO(co) Uggly fixed hacked in model-view-projection matrix
+// TODO(co) OpenGL matrix, Direct3D has minor differences within the projection matrix we have to compensate
+const float ICubeRenderer::MODEL_VIEW_PROJECTION[16] =
+{
+	 1.2803299f,	-0.97915620f,	-0.58038759f,	-0.57922798f,
+	 0.0f,			 1.9776078f,	-0.57472473f,	-0.573576453f,
+	-1.2803299f,	-0.97915620f,	-0.58038759f,	-0.57922798f,
+	 0.0f,			 0.0f,			 9.8198195f,	 10.0f
+};
+
+
+//[-------------------------------------------------------]
+//[ Public static methods                                 ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Generate random per instance data
+*/
+void ICubeRenderer::generatePerInstanceData(float *perInstanceData, unsigned int numberOfCubeInstances, unsigned int numberOfTextures, unsigned int sceneRadius, unsigned int seed, RendererToolkit::IJobSystem *jobSystem)
+{
+	GeneratePerInstanceDataJobData generatePerInstanceDataJobData;
+	generatePerInstanceDataJobData.perInstanceData  = perInstanceData;
+	generatePerInstanceDataJobData.numberOfTextures = numberOfTextures;
+	generatePerInstanceDataJobData.sceneRadius		= sceneRadius;
+	generatePerInstanceDataJobData.seed				= seed;
+	if (nullptr != jobSystem)
+	{
+		jobSystem->parallelFor(&ICubeRenderer::generatePerInstanceDataJob, &generatePerInstanceDataJobData, numberOfCubeInstances, NUMBER_OF_CUBE_INSTANCES_PER_JOB);
+	}
+	else if (numberOfCubeInstances > 0)
+	{
+		generatePerInstanceDataJob(&generatePerInstanceDataJobData, 0, numberOfCubeInstances);
+	}
+}
 
 
 //[-------------------------------------------------------]
@@ -36,15 +81,74 @@ ICubeRenderer::~ICubeRenderer()
 	// Nothing to do in here
 }
 
+/**
+*  @brief
+*    Set whether or not frustum culling is enabled
+*/
+void ICubeRenderer::setFrustumCulling(bool frustumCulling)
+{
+	mFrustumCulling = frustumCulling;
+}
+
+/**
+*  @brief
+*    Return whether or not frustum culling is enabled
+*/
+bool ICubeRenderer::isFrustumCulling() const
+{
+	return mFrustumCulling;
+}
+
+/**
+*  @brief
+*    Set whether or not the frustum culling should be performed on the GPU
+*/
+void ICubeRenderer::setGpuCulling(bool gpuCulling)
+{
+	mGpuCulling = gpuCulling;
+}
+
+/**
+*  @brief
+*    Return whether or not the frustum culling is performed on the GPU
+*/
+bool ICubeRenderer::isGpuCulling() const
+{
+	return (mGpuCulling && mGpuCullingSupported);
+}
+
+/**
+*  @brief
+*    Return whether or not the cube renderer supports GPU culling
+*/
+bool ICubeRenderer::isGpuCullingSupported() const
+{
+	return mGpuCullingSupported;
+}
+
+/**
+*  @brief
+*    Return the number of cubes drawn by the last "draw()"-call
+*/
+unsigned int ICubeRenderer::getNumberOfVisibleCubes() const
+{
+	return mNumberOfVisibleCubes;
+}
+
 
 //[-------------------------------------------------------]
 //[ Protected methods                                     ]
 //[-------------------------------------------------------]
 /**
 *  @brief
-*    Default constructor
+*    Constructor
 */
-ICubeRenderer::ICubeRenderer()
+ICubeRenderer::ICubeRenderer(RendererToolkit::IJobSystem *jobSystem) :
+	mFrustumCulling(true),
+	mGpuCulling(false),
+	mGpuCullingSupported(false),
+	mNumberOfVisibleCubes(0),
+	mJobSystem(jobSystem)
 {
 	// Nothing to do in here
 }
@@ -53,7 +157,12 @@ ICubeRenderer::ICubeRenderer()
 *  @brief
 *    Copy constructor
 */
-ICubeRenderer::ICubeRenderer(const ICubeRenderer &)
+ICubeRenderer::ICubeRenderer(const ICubeRenderer &) :
+	mFrustumCulling(true),
+	mGpuCulling(false),
+	mGpuCullingSupported(false),
+	mNumberOfVisibleCubes(0),
+	mJobSystem(nullptr)
 {
 	// Not supported
 }
@@ -67,3 +176,90 @@ ICubeRenderer &ICubeRenderer::operator =(const ICubeRenderer &)
 	// Not supported
 	return *this;
 }
+
+/**
+*  @brief
+*    Calculate the view frustum the cubes are culled against
+*/
+void ICubeRenderer::calculateFrustum(float globalTimer, float globalScale, FrustumCulling::Frustum &frustum)
+{
+	// Some movement in general, see vertex shaders
+	const float offsetX = static_cast<float>(sin(globalTimer * 0.0001f));
+	const float offsetY = static_cast<float>(sin(globalTimer * 0.0001f) * 2.0f);
+	const float offsetZ = static_cast<float>(cos(globalTimer * 0.0001f) * 0.5f);
+
+	// The cube rotation doesn't change the bounding sphere, the global scale does
+	FrustumCulling::calculateFrustum(MODEL_VIEW_PROJECTION, offsetX, offsetY, offsetZ, globalScale, frustum);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static methods                                ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Job function generating the per instance data of a range of cube instances
+*/
+void ICubeRenderer::generatePerInstanceDataJob(void *data, unsigned int firstElement, unsigned int lastElement)
+{
+	const GeneratePerInstanceDataJobData &generatePerInstanceDataJobData = *static_cast<const GeneratePerInstanceDataJobData*>(data);
+	const float sceneRadius = static_cast<float>(generatePerInstanceDataJobData.sceneRadius);
+
+	// Set data
+	// -> Layout: [Position][Rotation][Position][Rotation]...
+	//    - Position: xyz=Position, w=Slice of the 2D texture array to use
+	//    - Rotation: Rotation quaternion (xyz) and scale (w)
+	//      -> We don't need to store the w component of the quaternion. It's normalized and storing
+	//         three components while recomputing the fourths component is be sufficient.
+	float *dataCurrent = generatePerInstanceDataJobData.perInstanceData + firstElement * FrustumCulling::NUMBER_OF_FLOATS_PER_INSTANCE;
+	Quaternion quaternion;	// Identity rotation quaternion
+	for (unsigned int i = firstElement; i < lastElement; ++i)
+	{
+		// Each cube instance uses an own random number sequence, "rand()" can't be used by multiple threads
+		// -> Hash the seed and the instance index (MurmurHash3 finalizer) to get the start of a linear congruential generator sequence
+		unsigned int random = generatePerInstanceDataJobData.seed ^ (i * 0x9e3779b9u);
+		random ^= random >> 16;
+		random *= 0x85ebca6bu;
+		random ^= random >> 13;
+		random *= 0xc2b2ae35u;
+		random ^= random >> 16;
+		float randomValues[8];	// Random values between 0 and 1
+		for (int j = 0; j < 8; ++j)
+		{
+			random = random * 1664525u + 1013904223u;
+			randomValues[j] = (random >> 16) / 65536.0f;
+		}
+
+		{ // Position
+			// r=x
+			*dataCurrent = -sceneRadius + 2 * sceneRadius * randomValues[0];
+			++dataCurrent;
+			// g=y
+			*dataCurrent = -sceneRadius + 2 * sceneRadius * randomValues[1];
+			++dataCurrent;
+			// b=z
+			*dataCurrent = -sceneRadius + 2 * sceneRadius * randomValues[2];
+			++dataCurrent;
+			// a=Slice of the 2D texture array to use
+			*dataCurrent = static_cast<float>(static_cast<unsigned int>(randomValues[3] * generatePerInstanceDataJobData.numberOfTextures));	// Choose a random texture
+			++dataCurrent;
+		}
+
+		{ // Rotation
+			EulerAngles::toQuaternion(randomValues[4], randomValues[5] * 2, randomValues[6] * 3, quaternion);
+
+			// r=x
+			*dataCurrent = quaternion.x;
+			++dataCurrent;
+			// g=y
+			*dataCurrent = quaternion.y;
+			++dataCurrent;
+			// b=z
+			*dataCurrent = quaternion.z;
+			++dataCurrent;
+			// a=scale
+			*dataCurrent = 2.0f * randomValues[7];
+			++dataCurrent;
+		}
+	}
+}
@@ -26,6 +26,12 @@
 #define __INSTANCEDCUBES_ICUBERENDERER_H__
 
 
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "InstancedCubes/FrustumCulling.h"
+
+
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
@@ -37,6 +43,34 @@ class ICubeRenderer
 {
 
 
+//[-------------------------------------------------------]
+//[ Public static methods                                 ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Generate random per instance data
+	*
+	*  @param[out] perInstanceData
+	*    Receives the per instance data, must be able to hold "numberOfCubeInstances" * "FrustumCulling::NUMBER_OF_FLOATS_PER_INSTANCE" floats, see "FrustumCulling" for the layout
+	*  @param[in]  numberOfCubeInstances
+	*    Number of cube instances
+	*  @param[in]  numberOfTextures
+	*    Number of textures, must be valid
+	*  @param[in]  sceneRadius
+	*    Scene radius
+	*  @param[in]  seed
+	*    Seed of the random numbers, the same seed always results in the same per instance data
+	*  @param[in]  jobSystem
+	*    Job system used to generate the per instance data in parallel, can be a null pointer
+	*
+	*  @note
+	*    - Each cube instance uses an own random number sequence derived from the seed and the instance index, so the result
+	*      doesn't depend on how the cube instances are split across threads
+	*/
+	static void generatePerInstanceData(float *perInstanceData, unsigned int numberOfCubeInstances, unsigned int numberOfTextures, unsigned int sceneRadius, unsigned int seed, RendererToolkit::IJobSystem *jobSystem);
+
+
 //[-------------------------------------------------------]
 //[ Public methods                                        ]
 //[-------------------------------------------------------]
@@ -47,6 +81,66 @@ public:
 	*/
 	virtual ~ICubeRenderer();
 
+	/**
+	*  @brief
+	*    Set whether or not frustum culling is enabled
+	*
+	*  @param[in] frustumCulling
+	*    "true" to only draw the cubes inside the view frustum, else "false" to draw all cubes
+	*/
+	void setFrustumCulling(bool frustumCulling);
+
+	/**
+	*  @brief
+	*    Return whether or not frustum culling is enabled
+	*
+	*  @return
+	*    "true" if frustum culling is enabled, else "false"
+	*/
+	bool isFrustumCulling() const;
+
+	/**
+	*  @brief
+	*    Set whether or not the frustum culling should be performed on the GPU
+	*
+	*  @param[in] gpuCulling
+	*    "true" to cull the cubes by using a compute shader and draw them indirectly, else "false" to cull them on the CPU
+	*
+	*  @note
+	*    - Only has an effect if frustum culling is enabled and the cube renderer supports GPU culling
+	*/
+	void setGpuCulling(bool gpuCulling);
+
+	/**
+	*  @brief
+	*    Return whether or not the frustum culling is performed on the GPU
+	*
+	*  @return
+	*    "true" if the frustum culling is performed on the GPU, else "false"
+	*/
+	bool isGpuCulling() const;
+
+	/**
+	*  @brief
+	*    Return whether or not the cube renderer supports GPU culling
+	*
+	*  @return
+	*    "true" if the cube renderer supports GPU culling, else "false"
+	*/
+	bool isGpuCullingSupported() const;
+
+	/**
+	*  @brief
+	*    Return the number of cubes drawn by the last "draw()"-call
+	*
+	*  @return
+	*    The number of cubes drawn by the last "draw()"-call
+	*
+	*  @note
+	*    - When culling on the GPU, the number of visible cubes is only known on the GPU and all cubes are counted
+	*/
+	unsigned int getNumberOfVisibleCubes() const;
+
 
 //[-------------------------------------------------------]
 //[ Public virtual ICubeRenderer methods                  ]
@@ -85,9 +179,12 @@ public:
 protected:
 	/**
 	*  @brief
-	*    Default constructor
+	*    Constructor
+	*
+	*  @param[in] jobSystem
+	*    Job system used to generate and cull the cube instances in parallel, can be a null pointer, must stay valid as long as the cube renderer is used
 	*/
-	ICubeRenderer();
+	explicit ICubeRenderer(RendererToolkit::IJobSystem *jobSystem);
 
 	/**
 	*  @brief
@@ -110,12 +207,77 @@ protected:
 	*/
 	ICubeRenderer &operator =(const ICubeRenderer &source);
 
+	/**
+	*  @brief
+	*    Calculate the view frustum the cubes are culled against
+	*
+	*  @param[in]  globalTimer
+	*    Global timer
+	*  @param[in]  globalScale
+	*    Global scale
+	*  @param[out] frustum
+	*    Receives the view frustum
+	*
+	*  @note
+	*    - Must match the vertex shaders: The movement applied to all cubes is folded into the frustum
+	*/
+	static void calculateFrustum(float globalTimer, float globalScale, FrustumCulling::Frustum &frustum);
+
 
 //[-------------------------------------------------------]
 //[ Protected static data                                 ]
 //[-------------------------------------------------------]
 protected:
 	static const unsigned int MAXIMUM_NUMBER_OF_TEXTURES = 8;	/**< Maximum number of textures */
+	static const float		  MODEL_VIEW_PROJECTION[16];		/**< Model-view-projection matrix */
+
+
+//[-------------------------------------------------------]
+//[ Private definitions                                   ]
+//[-------------------------------------------------------]
+private:
+	static const unsigned int NUMBER_OF_CUBE_INSTANCES_PER_JOB = 16384;	/**< Number of cube instances generated by a single job */
+
+	/**
+	*  @brief
+	*    Data of the jobs generating the per instance data
+	*/
+	struct GeneratePerInstanceDataJobData
+	{
+		float		 *perInstanceData;	/**< Receives the per instance data, always valid */
+		unsigned int  numberOfTextures;	/**< Number of textures */
+		unsigned int  sceneRadius;		/**< Scene radius */
+		unsigned int  seed;				/**< Seed of the random numbers */
+	};
+
+
+//[-------------------------------------------------------]
+//[ Private static methods                                ]
+//[-------------------------------------------------------]
+private:
+	/**
+	*  @brief
+	*    Job function generating the per instance data of a range of cube instances
+	*
+	*  @param[in] data
+	*    "ICubeRenderer::GeneratePerInstanceDataJobData" instance, must be valid
+	*  @param[in] firstElement
+	*    Index of the first cube instance
+	*  @param[in] lastElement
+	*    Index of the cube instance after the last cube instance
+	*/
+	static void generatePerInstanceDataJob(void *data, unsigned int firstElement, unsigned int lastElement);
+
+
+//[-------------------------------------------------------]
+//[ Protected data                                        ]
+//[-------------------------------------------------------]
+protected:
+	bool						 mFrustumCulling;		/**< Is frustum culling enabled? */
+	bool						 mGpuCulling;			/**< Should the frustum culling be performed on the GPU? */
+	bool						 mGpuCullingSupported;	/**< Does the cube renderer support GPU culling? Set by the cube renderer implementation. */
+	unsigned int				 mNumberOfVisibleCubes;	/**< Number of cubes drawn by the last "draw()"-call */
+	RendererToolkit::IJobSystem	*mJobSystem;			/**< Job system used to generate and cull the cube instances in parallel, can be a null pointer */
 
 
 };
@@ -81,6 +81,10 @@ void InstancedCubes::onInitialization()
 		// Begin debug event
 		RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(renderer)
 
+		// The job system of the renderer toolkit is used to generate and cull the cube instances in parallel
+		// -> The renderer toolkit is also used to create the mesh batch of the draw instanced cube renderer
+		RendererToolkit::IJobSystem *jobSystem = nullptr;
+
 		{ // Create the font instance
 			// Get and check the renderer toolkit instance
 			RendererToolkit::IRendererToolkitPtr rendererToolkit(getRendererToolkit());
@@ -89,6 +93,9 @@ void InstancedCubes::onInitialization()
 				// Create the font instance
 				// -> In order to keep it simple, we use simple ASCII strings as filenames which are relative to the executable
 				mFont = rendererToolkit->createFontTexture("../Data/Font/LinBiolinum_R.otf");
+
+				// Get the job system, it's owned by the renderer toolkit instance which outlives the cube renderer
+				jobSystem = &rendererToolkit->getJobSystem();
 			}
 		}
 
@@ -97,12 +104,12 @@ void InstancedCubes::onInitialization()
 		if (renderer->getCapabilities().drawInstanced && renderer->getCapabilities().maximumNumberOf2DTextureArraySlices > 0 && renderer->getCapabilities().maximumTextureBufferSize > 0)
 		{
 			// Render cubes by using draw instanced (shader model 4 feature, build in shader variable holding the current instance ID)
-			mCubeRenderer = new CubeRendererDrawInstanced(*renderer, NUMBER_OF_TEXTURES, SCENE_RADIUS);
+			mCubeRenderer = new CubeRendererDrawInstanced(*renderer, NUMBER_OF_TEXTURES, SCENE_RADIUS, jobSystem, getRendererToolkit());
 		}
 		else if (renderer->getCapabilities().instancedArrays)
 		{
 			// Render cubes by using instanced arrays (shader model 3 feature, vertex array element advancing per-instance instead of per-vertex)
-			mCubeRenderer = new CubeRendererInstancedArrays(*renderer, NUMBER_OF_TEXTURES, SCENE_RADIUS);
+			mCubeRenderer = new CubeRendererInstancedArrays(*renderer, NUMBER_OF_TEXTURES, SCENE_RADIUS, jobSystem);
 		}
 
 		// Tell the cube renderer about the number of cubes
@@ -199,6 +206,24 @@ void InstancedCubes::onKeyDown(unsigned int key)
 			// Toggle display of statistics
 			mDisplayStatistics = !mDisplayStatistics;
 			break;
+
+		// Enable/disable frustum culling
+		case 'C':	// Windows virtual key code
+		case 'c':	// X11 key symbol
+			if (nullptr != mCubeRenderer)
+			{
+				mCubeRenderer->setFrustumCulling(!mCubeRenderer->isFrustumCulling());
+			}
+			break;
+
+		// Perform the frustum culling on the GPU or on the CPU
+		case 'G':	// Windows virtual key code
+		case 'g':	// X11 key symbol
+			if (nullptr != mCubeRenderer)
+			{
+				mCubeRenderer->setGpuCulling(!mCubeRenderer->isGpuCulling());
+			}
+			break;
 	}
 }
 
@@ -275,6 +300,18 @@ void InstancedCubes::onDraw()
 				// -> TODO(co) This number can get huge... had over 1 million cubes with >25 FPS... million cubes at ~2.4 FPS...
 				sprintf(text, "Cubes per second: %u", static_cast<unsigned int>(mFramesPerSecond) * mNumberOfCubeInstances);
 				mFont->drawText(text, Color4::WHITE, glm::value_ptr(glm::translate(glm::mat4(1.0f), glm::vec3(-0.95f, 0.8f, 0.0f))), 0.0025f, 0.0025f);
+
+				// Number of visible cubes
+				sprintf(text, "Visible cubes: %u (frustum culling %s, toggle with \"c\")", mCubeRenderer->getNumberOfVisibleCubes(), mCubeRenderer->isFrustumCulling() ? "on" : "off");
+				mFont->drawText(text, Color4::WHITE, glm::value_ptr(glm::translate(glm::mat4(1.0f), glm::vec3(-0.95f, 0.75f, 0.0f))), 0.0025f, 0.0025f);
+
+				// Where the frustum culling is performed
+				// -> When culling on the GPU, the number of visible cubes is only known on the GPU
+				if (mCubeRenderer->isGpuCullingSupported())
+				{
+					sprintf(text, "Culling on the %s (toggle with \"g\")", mCubeRenderer->isGpuCulling() ? "GPU, visible cubes are counted on the GPU" : "CPU");
+					mFont->drawText(text, Color4::WHITE, glm::value_ptr(glm::translate(glm::mat4(1.0f), glm::vec3(-0.95f, 0.7f, 0.0f))), 0.0025f, 0.0025f);
+				}
 			}
 			else
 			{
@@ -62,6 +62,8 @@ class ICubeRenderer;
 *    - Instanced arrays (shader model 3 feature, vertex array element advancing per-instance instead of per-vertex)
 *    - Draw instanced (shader model 4 feature, build in shader variable holding the current instance ID)
 *    - Renderer toolkit fonts
+*    - Multi-threaded SSE frustum culling with a per frame compacted instance buffer
+*    - GPU frustum culling by using a compute shader (CS) and indirect drawing
 */
 class InstancedCubes : public IApplicationRendererToolkit
 {
@@ -69,13 +69,13 @@ int programEntryPoint()
 		rendererName = "OpenGLES2";
 	#elif RENDERER_ONLY_DIRECT3D9
 		rendererName = "Direct3D9";
-	#elif RENDERER_ONLY_Direct3D10
+	#elif RENDERER_ONLY_DIRECT3D10
 		rendererName = "Direct3D10";
 	#elif RENDERER_ONLY_DIRECT3D11
 		rendererName = "Direct3D11";
+	#else
+		rendererName = "OpenGL";
 	#endif
-		
-	rendererName = "OpenGL";
 
 	// Create an instance of our application on the C runtime stack
 	// Basics
@@ -0,0 +1,111 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "MeshCooker/MeshCooker.h"
+#include "Framework/PlatformTypes.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+//[-------------------------------------------------------]
+//[ Program entry point                                   ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Mesh cooker command line tool
+*
+*  @remarks
+*    Usage: "MeshCooker [-nooptimize] [-lods <number of LODs>] <input asset> <output mesh>", e.g. "MeshCooker ../Data/Imrod/ImrodLowPoly.obj ../Data/Imrod/ImrodLowPoly.mesh"
+*/
+int main(int argc, char **argv)
+{
+	// Check the command line arguments
+	bool optimize = true;
+	unsigned int numberOfLods = 4;
+	bool validArguments = (argc >= 3);
+	for (int i = 1; i < argc - 2 && validArguments; ++i)
+	{
+		if (0 == strcmp(argv[i], "-nooptimize"))
+		{
+			optimize = false;
+		}
+		else if (0 == strcmp(argv[i], "-lods") && i + 1 < argc - 2)
+		{
+			numberOfLods = static_cast<unsigned int>(atoi(argv[++i]));
+		}
+		else
+		{
+			validArguments = false;
+		}
+	}
+	if (!validArguments)
+	{
+		printf("Usage: %s [-nooptimize] [-lods <number of LODs>] <input asset> <output mesh>\n", argv[0]);
+		printf("  Imports the input asset by using Assimp and writes it as cooked binary mesh (format version %u)\n", MeshFormat::VERSION);
+		printf("  -nooptimize: Skip the vertex cache, overdraw and vertex fetch optimization\n");
+		printf("  -lods:       Total number of levels of detail including the original mesh, each LOD halves the number of triangles (default: 4, 1 = no LODs)\n");
+		return 1;
+	}
+	const char *inputFilename  = argv[argc - 2];
+	const char *outputFilename = argv[argc - 1];
+
+	// Import the asset
+	MeshCooker meshCooker;
+	if (!meshCooker.loadAssimpMesh(inputFilename))
+	{
+		fprintf(stderr, "%s\n", meshCooker.getErrorString());
+		return 1;
+	}
+
+	// Optimize the mesh for the GPU
+	if (optimize)
+	{
+		MeshOptimizer::VertexCacheStatistics vertexCacheStatisticsBefore;
+		MeshOptimizer::VertexCacheStatistics vertexCacheStatisticsAfter;
+		meshCooker.optimize(vertexCacheStatisticsBefore, vertexCacheStatisticsAfter);
+		printf("Vertex cache (FIFO with %u entries): ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, %u -> %u transformed vertices\n", MeshOptimizer::DEFAULT_CACHE_SIZE,
+			vertexCacheStatisticsBefore.acmr, vertexCacheStatisticsAfter.acmr, vertexCacheStatisticsBefore.atvr, vertexCacheStatisticsAfter.atvr,
+			vertexCacheStatisticsBefore.numberOfTransformedVertices, vertexCacheStatisticsAfter.numberOfTransformedVertices);
+	}
+
+	// Generate the LODs
+	meshCooker.generateLods(numberOfLods);
+	for (unsigned int i = 0; i < meshCooker.getNumberOfLods(); ++i)
+	{
+		const MeshFormat::Lod &lod = meshCooker.getLods()[i];
+		printf("LOD %u: %u triangles, geometric error %f\n", i, lod.numberOfIndices / 3, lod.geometricError);
+	}
+
+	// Write the cooked mesh
+	if (!meshCooker.writeToFile(outputFilename))
+	{
+		fprintf(stderr, "Failed to write the cooked mesh \"%s\"\n", outputFilename);
+		return 1;
+	}
+
+	// Done
+	printf("Cooked \"%s\" into \"%s\": %u vertices, %u indices, %u sub-meshes, %u LODs\n", inputFilename, outputFilename, meshCooker.getNumberOfVertices(), meshCooker.getNumberOfIndices(), meshCooker.getNumberOfSubMeshes(), meshCooker.getNumberOfLods());
+	return 0;
+}
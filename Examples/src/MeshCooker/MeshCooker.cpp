@@ -0,0 +1,651 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Preprocessor                                          ]
+//[-------------------------------------------------------]
+#ifndef NO_ASSIMP
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "MeshCooker/MeshCooker.h"
+#include "Framework/PlatformTypes.h"
+
+#include <Renderer/Renderer.h>
+
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Align the given number of bytes to "MeshFormat::DATA_ALIGNMENT"
+*/
+static inline unsigned int alignToDataAlignment(unsigned int numberOfBytes)
+{
+	return (numberOfBytes + MeshFormat::DATA_ALIGNMENT - 1) & ~(MeshFormat::DATA_ALIGNMENT - 1);
+}
+
+/**
+*  @brief
+*    Write the given Assimp vector into the given float buffer and return the new float buffer position
+*/
+static inline float *writeVector(float *currentVertexBuffer, const aiVector3D &assimpVector, unsigned int numberOfComponents)
+{
+	*currentVertexBuffer = assimpVector.x;
+	++currentVertexBuffer;
+	*currentVertexBuffer = assimpVector.y;
+	++currentVertexBuffer;
+	if (numberOfComponents > 2)
+	{
+		*currentVertexBuffer = assimpVector.z;
+		++currentVertexBuffer;
+	}
+	return currentVertexBuffer;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Default constructor
+*/
+MeshCooker::MeshCooker() :
+	mNumberOfVertices(0),
+	mVertexData(nullptr),
+	mNumberOfIndices(0),
+	mIndexData(nullptr),
+	mNumberOfSubMeshes(0),
+	mSubMeshes(nullptr),
+	mNumberOfLods(0),
+	mLods(nullptr)
+{
+	mErrorString[0] = '\0';
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+MeshCooker::~MeshCooker()
+{
+	clear();
+}
+
+/**
+*  @brief
+*    Load an asset by using Assimp
+*/
+bool MeshCooker::loadAssimpMesh(const char *filename)
+{
+	// Clear previous data
+	clear();
+
+	// Create an instance of the Assimp importer class
+	Assimp::Importer assimpImporter;
+
+	// Load the given mesh
+	// -> "aiProcess_MakeLeftHanded" is added because the rasterizer states directly map to Direct3D
+	const aiScene *assimpScene = assimpImporter.ReadFile(filename, aiProcessPreset_TargetRealtime_MaxQuality | aiProcess_MakeLeftHanded);
+	if (nullptr != assimpScene && nullptr != assimpScene->mRootNode)
+	{
+		// Get the total number of vertices, indices and sub-meshes by using the Assimp root node
+		getNumberOfVerticesAndIndicesRecursive(*assimpScene, *assimpScene->mRootNode, mNumberOfVertices, mNumberOfIndices, mNumberOfSubMeshes);
+
+		// Allocate memory for the vertex, index and sub-mesh data
+		mVertexData = new float[mNumberOfVertices * MeshFormat::NUMBER_OF_COMPONENTS_PER_VERTEX];
+		mIndexData  = new unsigned int[mNumberOfIndices];
+		mSubMeshes  = new MeshFormat::SubMesh[mNumberOfSubMeshes];
+
+		{ // Fill the mesh data recursively
+			unsigned int numberOfFilledVertices  = 0;
+			unsigned int numberOfFilledIndices   = 0;
+			unsigned int numberOfFilledSubMeshes = 0;
+			fillMeshRecursive(*assimpScene, *assimpScene->mRootNode, aiMatrix4x4(), numberOfFilledVertices, numberOfFilledIndices, numberOfFilledSubMeshes);
+			mNumberOfVertices  = numberOfFilledVertices;
+			mNumberOfIndices   = numberOfFilledIndices;
+			mNumberOfSubMeshes = numberOfFilledSubMeshes;
+		}
+
+		// The original mesh is LOD 0
+		mNumberOfLods = 1;
+		mLods = new MeshFormat::Lod[mNumberOfLods];
+		mLods[0].startIndexLocation = 0;
+		mLods[0].numberOfIndices	= mNumberOfIndices;
+		mLods[0].geometricError		= 0.0f;
+
+		// Done
+		return true;
+	}
+	else
+	{
+		// Error!
+		snprintf(mErrorString, sizeof(mErrorString), "Failed to load in \"%s\": %s", filename, assimpImporter.GetErrorString());
+		OUTPUT_DEBUG_PRINTF("%s", mErrorString)
+		return false;
+	}
+}
+
+/**
+*  @brief
+*    Optimize the loaded data for the GPU
+*/
+void MeshCooker::optimize(MeshOptimizer::VertexCacheStatistics &vertexCacheStatisticsBefore, MeshOptimizer::VertexCacheStatistics &vertexCacheStatisticsAfter)
+{
+	memset(&vertexCacheStatisticsBefore, 0, sizeof(MeshOptimizer::VertexCacheStatistics));
+	memset(&vertexCacheStatisticsAfter,  0, sizeof(MeshOptimizer::VertexCacheStatistics));
+
+	// The vertex fetch optimization reorders the vertices, this would break already generated LODs
+	if (mNumberOfLods > 1)
+	{
+		// Error!
+		OUTPUT_DEBUG_STRING("Mesh cooker: The mesh must be optimized before the LODs are generated\n")
+		return;
+	}
+
+	// Optimize each sub-mesh individually
+	for (unsigned int i = 0; i < mNumberOfSubMeshes; ++i)
+	{
+		const MeshFormat::SubMesh &subMesh = mSubMeshes[i];
+		unsigned int *indices = mIndexData + subMesh.startIndexLocation;
+		float *vertexData = mVertexData + subMesh.minimumIndex * MeshFormat::NUMBER_OF_COMPONENTS_PER_VERTEX;
+
+		// The mesh optimizer expects indices relative to the first vertex of the sub-mesh
+		for (unsigned int j = 0; j < subMesh.numberOfIndices; ++j)
+		{
+			indices[j] -= subMesh.minimumIndex;
+		}
+
+		// Reject sub-meshes which aren't valid triangle lists, they are kept as they are
+		// -> Indices below the minimum index wrapped around and are caught by the range check as well
+		if (!MeshOptimizer::isValidTriangleList(indices, subMesh.numberOfIndices, subMesh.numberOfVertices))
+		{
+			// Error!
+			OUTPUT_DEBUG_PRINTF("Mesh cooker: Sub-mesh %u is no valid triangle list and is not optimized\n", i)
+			for (unsigned int j = 0; j < subMesh.numberOfIndices; ++j)
+			{
+				indices[j] += subMesh.minimumIndex;
+			}
+			continue;
+		}
+
+		// Statistics before the optimization
+		MeshOptimizer::VertexCacheStatistics vertexCacheStatistics;
+		MeshOptimizer::analyzeVertexCache(indices, subMesh.numberOfIndices, subMesh.numberOfVertices, MeshOptimizer::DEFAULT_CACHE_SIZE, vertexCacheStatistics);
+		MeshOptimizer::addVertexCacheStatistics(vertexCacheStatisticsBefore, vertexCacheStatistics);
+
+		// Optimize
+		MeshOptimizer::optimizeVertexCache(indices, subMesh.numberOfIndices, subMesh.numberOfVertices);
+		MeshOptimizer::optimizeOverdraw(indices, subMesh.numberOfIndices, vertexData, subMesh.numberOfVertices, MeshFormat::NUMBER_OF_COMPONENTS_PER_VERTEX);
+		MeshOptimizer::optimizeVertexFetch(vertexData, subMesh.numberOfVertices, MeshFormat::NUMBER_OF_COMPONENTS_PER_VERTEX, indices, subMesh.numberOfIndices);
+
+		// Statistics after the optimization
+		MeshOptimizer::analyzeVertexCache(indices, subMesh.numberOfIndices, subMesh.numberOfVertices, MeshOptimizer::DEFAULT_CACHE_SIZE, vertexCacheStatistics);
+		MeshOptimizer::addVertexCacheStatistics(vertexCacheStatisticsAfter, vertexCacheStatistics);
+
+		// Back to absolute indices
+		for (unsigned int j = 0; j < subMesh.numberOfIndices; ++j)
+		{
+			indices[j] += subMesh.minimumIndex;
+		}
+	}
+}
+
+/**
+*  @brief
+*    Generate a chain of levels of detail (LOD)
+*/
+void MeshCooker::generateLods(unsigned int numberOfLods, float reduction)
+{
+	// Anything to do?
+	if (0 == mNumberOfIndices || nullptr == mLods)
+	{
+		// Error!
+		return;
+	}
+
+	// Remove previously generated LODs, LOD 0 and its sub-meshes are at the start
+	mNumberOfIndices = mLods[0].numberOfIndices;
+	mNumberOfLods = 1;
+	if (numberOfLods <= 1)
+	{
+		// Done
+		return;
+	}
+
+	// Each LOD has at most as many indices as the previous one, so this is enough memory for all LODs
+	unsigned int *indexData = new unsigned int[mNumberOfIndices * numberOfLods];
+	memcpy(indexData, mIndexData, sizeof(unsigned int) * mNumberOfIndices);
+	MeshFormat::SubMesh *subMeshes = new MeshFormat::SubMesh[mNumberOfSubMeshes * numberOfLods];
+	memcpy(subMeshes, mSubMeshes, sizeof(MeshFormat::SubMesh) * mNumberOfSubMeshes);
+	MeshFormat::Lod *lods = new MeshFormat::Lod[numberOfLods];
+	lods[0] = mLods[0];
+
+	// Temporary relative indices
+	unsigned int maximumNumberOfSubMeshIndices = 0;
+	for (unsigned int i = 0; i < mNumberOfSubMeshes; ++i)
+	{
+		if (maximumNumberOfSubMeshIndices < mSubMeshes[i].numberOfIndices)
+		{
+			maximumNumberOfSubMeshIndices = mSubMeshes[i].numberOfIndices;
+		}
+	}
+	unsigned int *relativeIndices = new unsigned int[maximumNumberOfSubMeshIndices];
+
+	// Generate the LODs
+	unsigned int numberOfIndices = mNumberOfIndices;
+	float targetFactor = 1.0f;
+	for (unsigned int lod = 1; lod < numberOfLods; ++lod)
+	{
+		MeshFormat::Lod &currentLod = lods[lod];
+		currentLod.startIndexLocation = numberOfIndices;
+		currentLod.numberOfIndices	  = 0;
+		currentLod.geometricError	  = lods[lod - 1].geometricError;
+		targetFactor *= reduction;
+
+		// Simplify each sub-mesh of LOD 0 individually
+		for (unsigned int i = 0; i < mNumberOfSubMeshes; ++i)
+		{
+			const MeshFormat::SubMesh &originalSubMesh = subMeshes[i];
+			MeshFormat::SubMesh &subMesh = subMeshes[lod * mNumberOfSubMeshes + i];
+			subMesh = originalSubMesh;
+			subMesh.startIndexLocation = numberOfIndices;
+
+			// The mesh simplifier expects indices relative to the first vertex of the sub-mesh
+			for (unsigned int j = 0; j < originalSubMesh.numberOfIndices; ++j)
+			{
+				relativeIndices[j] = indexData[originalSubMesh.startIndexLocation + j] - originalSubMesh.minimumIndex;
+			}
+
+			// Simplify and optimize the result for the post-transform vertex cache
+			// -> The vertex order is shared by all LODs, so there's no vertex fetch optimization
+			// -> Sub-meshes which aren't valid triangle lists are rejected and copied over unchanged
+			unsigned int *indices = indexData + numberOfIndices;
+			float geometricError = 0.0f;
+			if (MeshOptimizer::isValidTriangleList(relativeIndices, originalSubMesh.numberOfIndices, originalSubMesh.numberOfVertices))
+			{
+				const unsigned int targetNumberOfIndices = static_cast<unsigned int>(static_cast<float>(originalSubMesh.numberOfIndices / 3) * targetFactor) * 3;
+				subMesh.numberOfIndices = MeshSimplifier::simplify(indices, relativeIndices, originalSubMesh.numberOfIndices, mVertexData + originalSubMesh.minimumIndex * MeshFormat::NUMBER_OF_COMPONENTS_PER_VERTEX, originalSubMesh.numberOfVertices, MeshFormat::NUMBER_OF_COMPONENTS_PER_VERTEX, targetNumberOfIndices, geometricError);
+				MeshOptimizer::optimizeVertexCache(indices, subMesh.numberOfIndices, originalSubMesh.numberOfVertices);
+			}
+			else
+			{
+				memcpy(indices, relativeIndices, sizeof(unsigned int) * originalSubMesh.numberOfIndices);
+			}
+
+			// Back to absolute indices
+			for (unsigned int j = 0; j < subMesh.numberOfIndices; ++j)
+			{
+				indices[j] += originalSubMesh.minimumIndex;
+			}
+
+			// Update the LOD
+			if (currentLod.geometricError < geometricError)
+			{
+				currentLod.geometricError = geometricError;
+			}
+			currentLod.numberOfIndices += subMesh.numberOfIndices;
+			numberOfIndices += subMesh.numberOfIndices;
+		}
+
+		// Stop if the mesh can't be simplified any further, there's no use in a LOD which is no coarser than the previous one
+		if (currentLod.numberOfIndices >= lods[lod - 1].numberOfIndices)
+		{
+			numberOfIndices = currentLod.startIndexLocation;
+			break;
+		}
+		++mNumberOfLods;
+	}
+
+	// Replace the data
+	delete [] relativeIndices;
+	delete [] mIndexData;
+	mIndexData = indexData;
+	mNumberOfIndices = numberOfIndices;
+	delete [] mSubMeshes;
+	mSubMeshes = subMeshes;
+	delete [] mLods;
+	mLods = lods;
+}
+
+/**
+*  @brief
+*    Clear the loaded data
+*/
+void MeshCooker::clear()
+{
+	mErrorString[0] = '\0';
+	mNumberOfVertices = 0;
+	delete [] mVertexData;
+	mVertexData = nullptr;
+	mNumberOfIndices = 0;
+	delete [] mIndexData;
+	mIndexData = nullptr;
+	mNumberOfSubMeshes = 0;
+	delete [] mSubMeshes;
+	mSubMeshes = nullptr;
+	mNumberOfLods = 0;
+	delete [] mLods;
+	mLods = nullptr;
+}
+
+/**
+*  @brief
+*    Serialize the loaded data into the cooked binary mesh format
+*/
+unsigned char *MeshCooker::serialize(unsigned int &numberOfBytes) const
+{
+	// Anything to serialize?
+	numberOfBytes = 0;
+	if (0 == mNumberOfVertices || 0 == mNumberOfIndices || 0 == mNumberOfLods)
+	{
+		// Error!
+		return nullptr;
+	}
+
+	// Use 16-bit indices whenever possible, they are supported by each renderer API and are more cache friendly
+	// -> 32-bit indices are only used when there are more vertices than a 16-bit index can address
+	const bool shortIndices = (mNumberOfVertices <= 65536);
+	const unsigned int numberOfBytesPerIndex = shortIndices ? sizeof(unsigned short) : sizeof(unsigned int);
+
+	// Setup the header
+	MeshFormat::Header header;
+	header.magic				  = MeshFormat::MAGIC;
+	header.version				  = MeshFormat::VERSION;
+	header.numberOfBytesPerVertex = sizeof(float) * MeshFormat::NUMBER_OF_COMPONENTS_PER_VERTEX;
+	header.numberOfVertices		  = mNumberOfVertices;
+	header.vertexDataOffset		  = alignToDataAlignment(sizeof(MeshFormat::Header) + sizeof(MeshFormat::SubMesh) * mNumberOfSubMeshes * mNumberOfLods + sizeof(MeshFormat::Lod) * mNumberOfLods);
+	header.indexBufferFormat	  = shortIndices ? Renderer::IndexBufferFormat::UNSIGNED_SHORT : Renderer::IndexBufferFormat::UNSIGNED_INT;
+	header.numberOfIndices		  = mNumberOfIndices;
+	header.indexDataOffset		  = alignToDataAlignment(header.vertexDataOffset + header.numberOfBytesPerVertex * mNumberOfVertices);
+	header.numberOfSubMeshes	  = mNumberOfSubMeshes;
+	header.numberOfLods			  = mNumberOfLods;
+
+	// Calculate the bounding box by using the sub-mesh bounding boxes of LOD 0
+	for (unsigned int component = 0; component < 3; ++component)
+	{
+		header.boundingBoxMinimum[component] = (mNumberOfSubMeshes > 0) ? mSubMeshes[0].boundingBoxMinimum[component] : 0.0f;
+		header.boundingBoxMaximum[component] = (mNumberOfSubMeshes > 0) ? mSubMeshes[0].boundingBoxMaximum[component] : 0.0f;
+		for (unsigned int i = 1; i < mNumberOfSubMeshes; ++i)
+		{
+			if (header.boundingBoxMinimum[component] > mSubMeshes[i].boundingBoxMinimum[component])
+			{
+				header.boundingBoxMinimum[component] = mSubMeshes[i].boundingBoxMinimum[component];
+			}
+			if (header.boundingBoxMaximum[component] < mSubMeshes[i].boundingBoxMaximum[component])
+			{
+				header.boundingBoxMaximum[component] = mSubMeshes[i].boundingBoxMaximum[component];
+			}
+		}
+	}
+	{ // The bounding sphere is centered at the bounding box center
+		const float halfX = (header.boundingBoxMaximum[0] - header.boundingBoxMinimum[0]) * 0.5f;
+		const float halfY = (header.boundingBoxMaximum[1] - header.boundingBoxMinimum[1]) * 0.5f;
+		const float halfZ = (header.boundingBoxMaximum[2] - header.boundingBoxMinimum[2]) * 0.5f;
+		header.boundingSphereRadius = sqrtf(halfX * halfX + halfY * halfY + halfZ * halfZ);
+	}
+
+	// Allocate the memory, zero it so that padding bytes are deterministic
+	numberOfBytes = header.indexDataOffset + numberOfBytesPerIndex * mNumberOfIndices;
+	unsigned char *data = new unsigned char[numberOfBytes];
+	memset(data, 0, numberOfBytes);
+
+	// Header, sub-mesh table and LOD table
+	memcpy(data, &header, sizeof(MeshFormat::Header));
+	memcpy(data + sizeof(MeshFormat::Header), mSubMeshes, sizeof(MeshFormat::SubMesh) * mNumberOfSubMeshes * mNumberOfLods);
+	memcpy(data + sizeof(MeshFormat::Header) + sizeof(MeshFormat::SubMesh) * mNumberOfSubMeshes * mNumberOfLods, mLods, sizeof(MeshFormat::Lod) * mNumberOfLods);
+
+	// Vertex data
+	memcpy(data + header.vertexDataOffset, mVertexData, header.numberOfBytesPerVertex * mNumberOfVertices);
+
+	// Index data
+	if (shortIndices)
+	{
+		unsigned short *indexData = reinterpret_cast<unsigned short*>(data + header.indexDataOffset);
+		for (unsigned int i = 0; i < mNumberOfIndices; ++i)
+		{
+			indexData[i] = static_cast<unsigned short>(mIndexData[i]);
+		}
+	}
+	else
+	{
+		memcpy(data + header.indexDataOffset, mIndexData, sizeof(unsigned int) * mNumberOfIndices);
+	}
+
+	// Done
+	return data;
+}
+
+/**
+*  @brief
+*    Write the loaded data as cooked binary mesh into a file
+*/
+bool MeshCooker::writeToFile(const char *filename) const
+{
+	bool result = false;	// Error by default
+
+	// Serialize
+	unsigned int numberOfBytes = 0;
+	unsigned char *data = serialize(numberOfBytes);
+	if (nullptr != data)
+	{
+		// Write the file
+		FILE *file = fopen(filename, "wb");
+		if (nullptr != file)
+		{
+			result = (fwrite(data, 1, numberOfBytes, file) == numberOfBytes);
+			if (0 != fclose(file))
+			{
+				result = false;
+			}
+		}
+
+		// Cleanup
+		delete [] data;
+	}
+
+	// Done
+	return result;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Get the total number of vertices, indices and sub-meshes by using a given Assimp node
+*/
+void MeshCooker::getNumberOfVerticesAndIndicesRecursive(const aiScene &assimpScene, const aiNode &assimpNode, unsigned int &numberOfVertices, unsigned int &numberOfIndices, unsigned int &numberOfSubMeshes)
+{
+	// Loop through all meshes this node is using
+	for (unsigned int i = 0; i < assimpNode.mNumMeshes; ++i)
+	{
+		// Get the used mesh
+		const aiMesh &assimpMesh = *assimpScene.mMeshes[assimpNode.mMeshes[i]];
+
+		// Update the number of vertices
+		numberOfVertices += assimpMesh.mNumVertices;
+
+		// Loop through all mesh faces and update the number of indices
+		for (unsigned int j = 0; j < assimpMesh.mNumFaces; ++j)
+		{
+			numberOfIndices += assimpMesh.mFaces[j].mNumIndices;
+		}
+	}
+
+	// Each mesh instance becomes a sub-mesh
+	numberOfSubMeshes += assimpNode.mNumMeshes;
+
+	// Loop through all child nodes recursively
+	for (unsigned int i = 0; i < assimpNode.mNumChildren; ++i)
+	{
+		getNumberOfVerticesAndIndicesRecursive(assimpScene, *assimpNode.mChildren[i], numberOfVertices, numberOfIndices, numberOfSubMeshes);
+	}
+}
+
+/**
+*  @brief
+*    Fill the mesh data recursively
+*/
+void MeshCooker::fillMeshRecursive(const aiScene &assimpScene, const aiNode &assimpNode, const aiMatrix4x4 &assimpTransformation, unsigned int &numberOfVertices, unsigned int &numberOfIndices, unsigned int &numberOfSubMeshes)
+{
+	// Get the absolute transformation matrix of this Assimp node
+	const aiMatrix4x4 currentAssimpTransformation = assimpTransformation * assimpNode.mTransformation;
+	const aiMatrix3x3 currentAssimpNormalTransformation = aiMatrix3x3(currentAssimpTransformation);
+
+	// Loop through all meshes this node is using
+	for (unsigned int i = 0; i < assimpNode.mNumMeshes; ++i)
+	{
+		// Get the used mesh
+		const aiMesh &assimpMesh = *assimpScene.mMeshes[assimpNode.mMeshes[i]];
+
+		// Get the start vertex inside the our vertex buffer
+		const unsigned int starVertex = numberOfVertices;
+
+		// Setup the sub-mesh
+		MeshFormat::SubMesh &subMesh = mSubMeshes[numberOfSubMeshes];
+		subMesh.startIndexLocation = numberOfIndices;
+		subMesh.numberOfIndices	   = 0;
+		subMesh.minimumIndex	   = starVertex;
+		subMesh.numberOfVertices   = assimpMesh.mNumVertices;
+		subMesh.materialIndex	   = assimpMesh.mMaterialIndex;
+		for (unsigned int component = 0; component < 3; ++component)
+		{
+			subMesh.boundingBoxMinimum[component] = 0.0f;
+			subMesh.boundingBoxMaximum[component] = 0.0f;
+		}
+		++numberOfSubMeshes;
+
+		// Loop through the Assimp mesh vertices
+		// -> Missing vertex attributes are set to zero, "aiProcessPreset_TargetRealtime_MaxQuality" is
+		//    unable to generate tangent space or texture coordinates for meshes without texture coordinates
+		const aiVector3D assimpZero(0.0f, 0.0f, 0.0f);
+		float *currentVertexBuffer = mVertexData + numberOfVertices * MeshFormat::NUMBER_OF_COMPONENTS_PER_VERTEX;
+		for (unsigned int j = 0; j < assimpMesh.mNumVertices; ++j)
+		{
+			{ // Position
+				// Get the Assimp mesh vertex position
+				aiVector3D assimpVertex = assimpMesh.mVertices[j];
+
+				// Transform the Assimp mesh vertex position into global space
+				assimpVertex *= currentAssimpTransformation;
+
+				// Update the sub-mesh bounding box
+				for (unsigned int component = 0; component < 3; ++component)
+				{
+					if (0 == j || subMesh.boundingBoxMinimum[component] > assimpVertex[component])
+					{
+						subMesh.boundingBoxMinimum[component] = assimpVertex[component];
+					}
+					if (0 == j || subMesh.boundingBoxMaximum[component] < assimpVertex[component])
+					{
+						subMesh.boundingBoxMaximum[component] = assimpVertex[component];
+					}
+				}
+
+				// Set our vertex buffer position
+				currentVertexBuffer = writeVector(currentVertexBuffer, assimpVertex, 3);
+			}
+
+			{ // Texture coordinate
+				// Set our vertex buffer texture coordinate
+				currentVertexBuffer = writeVector(currentVertexBuffer, assimpMesh.HasTextureCoords(0) ? assimpMesh.mTextureCoords[0][j] : assimpZero, 2);
+			}
+
+			{ // Tangent
+				// Get the Assimp mesh vertex tangent
+				aiVector3D assimpTangent = assimpMesh.HasTangentsAndBitangents() ? assimpMesh.mTangents[j] : assimpZero;
+
+				// Transform the Assimp mesh vertex tangent into global space
+				assimpTangent *= currentAssimpNormalTransformation;
+
+				// Set our vertex buffer tangent
+				currentVertexBuffer = writeVector(currentVertexBuffer, assimpTangent, 3);
+			}
+
+			{ // Binormal
+				// Get the Assimp mesh vertex binormal
+				aiVector3D assimpBinormal = assimpMesh.HasTangentsAndBitangents() ? assimpMesh.mBitangents[j] : assimpZero;
+
+				// Transform the Assimp mesh vertex binormal into global space
+				assimpBinormal *= currentAssimpNormalTransformation;
+
+				// Set our vertex buffer binormal
+				currentVertexBuffer = writeVector(currentVertexBuffer, assimpBinormal, 3);
+			}
+
+			{ // Normal
+				// Get the Assimp mesh vertex normal
+				aiVector3D assimpNormal = assimpMesh.HasNormals() ? assimpMesh.mNormals[j] : assimpZero;
+
+				// Transform the Assimp mesh vertex normal into global space
+				assimpNormal *= currentAssimpNormalTransformation;
+
+				// Set our vertex buffer normal
+				currentVertexBuffer = writeVector(currentVertexBuffer, assimpNormal, 3);
+			}
+		}
+		numberOfVertices += assimpMesh.mNumVertices;
+
+		// Loop through all Assimp mesh faces
+		unsigned int *currentIndexBuffer = mIndexData + numberOfIndices;
+		for (unsigned int j = 0; j < assimpMesh.mNumFaces; ++j)
+		{
+			// Get the Assimp face
+			const aiFace &assimpFace = assimpMesh.mFaces[j];
+
+			// Loop through all indices of the Assimp face and set our indices
+			for (unsigned int assimpIndex = 0; assimpIndex < assimpFace.mNumIndices; ++assimpIndex, ++currentIndexBuffer)
+			{
+				//					  Assimp mesh vertex index				 Where the Assimp mesh starts within the our vertex buffer
+				*currentIndexBuffer = assimpFace.mIndices[assimpIndex] + starVertex;
+			}
+
+			// Update the number if processed indices
+			numberOfIndices += assimpFace.mNumIndices;
+			subMesh.numberOfIndices += assimpFace.mNumIndices;
+		}
+	}
+
+	// Loop through all child nodes recursively
+	for (unsigned int assimpChild = 0; assimpChild < assimpNode.mNumChildren; ++assimpChild)
+	{
+		fillMeshRecursive(assimpScene, *assimpNode.mChildren[assimpChild], currentAssimpTransformation, numberOfVertices, numberOfIndices, numberOfSubMeshes);
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Preprocessor                                          ]
+//[-------------------------------------------------------]
+#endif // NO_ASSIMP
@@ -0,0 +1,332 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __MESHCOOKER_MESHCOOKER_H__
+#define __MESHCOOKER_MESHCOOKER_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "MeshCooker/MeshFormat.h"
+#include "MeshCooker/MeshOptimizer.h"
+#include "MeshCooker/MeshSimplifier.h"
+
+#include <assimp/vector3.h>	// Required by "assimp/matrix4x4.h" below
+#include <assimp/matrix4x4.h>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+struct aiNode;
+struct aiScene;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Mesh cooker, turns an asset which can be loaded by Assimp into the cooked binary mesh format described in "MeshCooker/MeshFormat.h"
+*
+*  @remarks
+*    The Assimp import and post-processing is expensive. The idea is to do this work once offline
+*    by using the mesh cooker command line tool and to just map the cooked mesh at runtime.
+*    The mesh cooker is also used at runtime when a mesh is loaded directly from an asset
+*    so both ways result in identical data.
+*
+*  @verbatim
+*    Usage example:
+*
+*    MeshCooker meshCooker;
+*    if (meshCooker.loadAssimpMesh("../Data/Imrod/ImrodLowPoly.obj"))
+*    {
+*        MeshOptimizer::VertexCacheStatistics before, after;
+*        meshCooker.optimize(before, after);
+*        meshCooker.generateLods(4);
+*        meshCooker.writeToFile("../Data/Imrod/ImrodLowPoly.mesh");
+*    }
+*  @endverbatim
+*/
+class MeshCooker
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Default constructor
+	*/
+	MeshCooker();
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	~MeshCooker();
+
+	/**
+	*  @brief
+	*    Load an asset by using Assimp
+	*
+	*  @param[in] filename
+	*    ASCII filename of the asset to load in, must be valid
+	*
+	*  @return
+	*    "true" if all went fine, else "false" (use "getErrorString()" to get a human readable reason)
+	*
+	*  @note
+	*    - The node hierarchy is flattened, each Assimp mesh referenced by a node becomes a sub-mesh
+	*    - Previously loaded data is cleared
+	*/
+	bool loadAssimpMesh(const char *filename);
+
+	/**
+	*  @brief
+	*    Optimize the loaded data for the GPU
+	*
+	*  @param[out] vertexCacheStatisticsBefore
+	*    Receives the vertex cache statistics before the optimization
+	*  @param[out] vertexCacheStatisticsAfter
+	*    Receives the vertex cache statistics after the optimization
+	*
+	*  @remarks
+	*    Each sub-mesh is optimized individually by using "MeshOptimizer", in this order:
+	*    Post-transform vertex cache, overdraw and pre-transform vertex fetch. The sub-mesh ranges stay untouched.
+	*
+	*  @note
+	*    - Must be called before "generateLods()" because the vertices are reordered, does nothing if there are already LODs
+	*/
+	void optimize(MeshOptimizer::VertexCacheStatistics &vertexCacheStatisticsBefore, MeshOptimizer::VertexCacheStatistics &vertexCacheStatisticsAfter);
+
+	/**
+	*  @brief
+	*    Generate a chain of levels of detail (LOD)
+	*
+	*  @param[in] numberOfLods
+	*    Wished total number of LODs including the original mesh as LOD 0, there might be less LODs if the mesh can't be simplified any further
+	*  @param[in] reduction
+	*    Number of triangles of a LOD compared to the previous LOD, e.g. 0.5 halves the number of triangles with each LOD
+	*
+	*  @remarks
+	*    Each sub-mesh of LOD 0 is simplified individually by using "MeshSimplifier" and then optimized for the
+	*    post-transform vertex cache. All LODs share the vertex data and are appended to the index data.
+	*    Each LOD is simplified from LOD 0 so the stored geometric error is relative to the original mesh.
+	*
+	*  @note
+	*    - Previously generated LODs are replaced
+	*/
+	void generateLods(unsigned int numberOfLods, float reduction = 0.5f);
+
+	/**
+	*  @brief
+	*    Clear the loaded data
+	*/
+	void clear();
+
+	/**
+	*  @brief
+	*    Serialize the loaded data into the cooked binary mesh format
+	*
+	*  @param[out] numberOfBytes
+	*    Receives the number of bytes of the returned memory
+	*
+	*  @return
+	*    The cooked mesh, null pointer on error, destroy it via "delete []" if you no longer need it
+	*
+	*  @note
+	*    - 16-bit indices are used whenever possible, 32-bit indices only if there are too many vertices
+	*/
+	unsigned char *serialize(unsigned int &numberOfBytes) const;
+
+	/**
+	*  @brief
+	*    Write the loaded data as cooked binary mesh into a file
+	*
+	*  @param[in] filename
+	*    ASCII filename of the file to write, must be valid
+	*
+	*  @return
+	*    "true" if all went fine, else "false"
+	*/
+	bool writeToFile(const char *filename) const;
+
+	/**
+	*  @brief
+	*    Return a human readable description of the last error
+	*
+	*  @return
+	*    Human readable description of the last error, empty string if there was no error, do not destroy the returned string
+	*/
+	inline const char *getErrorString() const;
+
+	/**
+	*  @brief
+	*    Return the number of vertices
+	*
+	*  @return
+	*    The number of vertices
+	*/
+	inline unsigned int getNumberOfVertices() const;
+
+	/**
+	*  @brief
+	*    Return the vertex data
+	*
+	*  @return
+	*    The vertex data ("MeshFormat::NUMBER_OF_COMPONENTS_PER_VERTEX" floats per vertex), can be a null pointer, do not destroy the returned data
+	*/
+	inline float *getVertexData() const;
+
+	/**
+	*  @brief
+	*    Return the number of indices
+	*
+	*  @return
+	*    The number of indices
+	*/
+	inline unsigned int getNumberOfIndices() const;
+
+	/**
+	*  @brief
+	*    Return the index data
+	*
+	*  @return
+	*    The 32-bit index data, can be a null pointer, do not destroy the returned data
+	*/
+	inline unsigned int *getIndexData() const;
+
+	/**
+	*  @brief
+	*    Return the number of sub-meshes per LOD
+	*
+	*  @return
+	*    The number of sub-meshes per LOD
+	*/
+	inline unsigned int getNumberOfSubMeshes() const;
+
+	/**
+	*  @brief
+	*    Return the sub-meshes
+	*
+	*  @return
+	*    The sub-meshes ("getNumberOfSubMeshes()" sub-meshes of LOD 0 followed by the ones of the next LODs), can be a null pointer, do not destroy the returned data
+	*/
+	inline MeshFormat::SubMesh *getSubMeshes() const;
+
+	/**
+	*  @brief
+	*    Return the number of LODs
+	*
+	*  @return
+	*    The number of LODs, 0 if there's no data loaded
+	*/
+	inline unsigned int getNumberOfLods() const;
+
+	/**
+	*  @brief
+	*    Return the LODs
+	*
+	*  @return
+	*    The LODs, can be a null pointer, do not destroy the returned data
+	*/
+	inline MeshFormat::Lod *getLods() const;
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	MeshCooker(const MeshCooker &source);
+	MeshCooker &operator =(const MeshCooker &source);
+
+	/**
+	*  @brief
+	*    Get the total number of vertices, indices and sub-meshes by using a given Assimp node
+	*
+	*  @param[in]  assimpScene
+	*    Assimp scene
+	*  @param[in]  assimpNode
+	*    Assimp node to gather the data from
+	*  @param[out] numberOfVertices
+	*    Receives the number of vertices
+	*  @param[out] numberOfIndices
+	*    Receives the number of indices
+	*  @param[out] numberOfSubMeshes
+	*    Receives the number of sub-meshes
+	*/
+	void getNumberOfVerticesAndIndicesRecursive(const aiScene &assimpScene, const aiNode &assimpNode, unsigned int &numberOfVertices, unsigned int &numberOfIndices, unsigned int &numberOfSubMeshes);
+
+	/**
+	*  @brief
+	*    Fill the mesh data recursively
+	*
+	*  @param[in]  assimpScene
+	*    Assimp scene
+	*  @param[in]  assimpNode
+	*    Assimp node to gather the data from
+	*  @param[in]  assimpTransformation
+	*    Current absolute Assimp transformation matrix (local to global space)
+	*  @param[out] numberOfVertices
+	*    Receives the number of processed vertices
+	*  @param[out] numberOfIndices
+	*    Receives the number of processed indices
+	*  @param[out] numberOfSubMeshes
+	*    Receives the number of processed sub-meshes
+	*/
+	void fillMeshRecursive(const aiScene &assimpScene, const aiNode &assimpNode, const aiMatrix4x4 &assimpTransformation, unsigned int &numberOfVertices, unsigned int &numberOfIndices, unsigned int &numberOfSubMeshes);
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	char				 mErrorString[256];		/**< Human readable description of the last error */
+	unsigned int		 mNumberOfVertices;		/**< Number of vertices */
+	float				*mVertexData;			/**< Vertex data, can be a null pointer */
+	unsigned int		 mNumberOfIndices;		/**< Number of indices */
+	unsigned int		*mIndexData;			/**< 32-bit index data, can be a null pointer */
+	unsigned int		 mNumberOfSubMeshes;	/**< Number of sub-meshes per LOD */
+	MeshFormat::SubMesh *mSubMeshes;			/**< Sub-meshes of all LODs ("mNumberOfLods * mNumberOfSubMeshes"), can be a null pointer */
+	unsigned int		 mNumberOfLods;			/**< Number of LODs */
+	MeshFormat::Lod		*mLods;					/**< LODs, can be a null pointer */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "MeshCooker/MeshCooker.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __MESHCOOKER_MESHCOOKER_H__
@@ -0,0 +1,103 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Return a human readable description of the last error
+*/
+inline const char *MeshCooker::getErrorString() const
+{
+	return mErrorString;
+}
+
+/**
+*  @brief
+*    Return the number of vertices
+*/
+inline unsigned int MeshCooker::getNumberOfVertices() const
+{
+	return mNumberOfVertices;
+}
+
+/**
+*  @brief
+*    Return the vertex data
+*/
+inline float *MeshCooker::getVertexData() const
+{
+	return mVertexData;
+}
+
+/**
+*  @brief
+*    Return the number of indices
+*/
+inline unsigned int MeshCooker::getNumberOfIndices() const
+{
+	return mNumberOfIndices;
+}
+
+/**
+*  @brief
+*    Return the index data
+*/
+inline unsigned int *MeshCooker::getIndexData() const
+{
+	return mIndexData;
+}
+
+/**
+*  @brief
+*    Return the number of sub-meshes
+*/
+inline unsigned int MeshCooker::getNumberOfSubMeshes() const
+{
+	return mNumberOfSubMeshes;
+}
+
+/**
+*  @brief
+*    Return the sub-meshes
+*/
+inline MeshFormat::SubMesh *MeshCooker::getSubMeshes() const
+{
+	return mSubMeshes;
+}
+
+/**
+*  @brief
+*    Return the number of LODs
+*/
+inline unsigned int MeshCooker::getNumberOfLods() const
+{
+	return mNumberOfLods;
+}
+
+/**
+*  @brief
+*    Return the LODs
+*/
+inline MeshFormat::Lod *MeshCooker::getLods() const
+{
+	return mLods;
+}
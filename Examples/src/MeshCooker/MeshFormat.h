@@ -0,0 +1,132 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __MESHCOOKER_MESHFORMAT_H__
+#define __MESHCOOKER_MESHFORMAT_H__
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Cooked binary mesh format
+*
+*  @remarks
+*    File layout (little endian, all offsets in bytes relative to the start of the file):
+*    @code
+*    MeshFormat::Header
+*    MeshFormat::SubMesh[Header::numberOfLods * Header::numberOfSubMeshes]
+*    MeshFormat::Lod[Header::numberOfLods]
+*    <padding to "DATA_ALIGNMENT">
+*    Vertex data: Header::numberOfVertices * Header::numberOfBytesPerVertex, starts at Header::vertexDataOffset
+*    <padding to "DATA_ALIGNMENT">
+*    Index data: Header::numberOfIndices * <bytes per index>, starts at Header::indexDataOffset
+*    @endcode
+*
+*    The data is laid out in a way that the vertex and index data can be handed over to the renderer
+*    as it is, there's no need to touch or copy the data at runtime. Each vertex is interleaved and
+*    stores "NUMBER_OF_COMPONENTS_PER_VERTEX" floats (3 position, 2 texture coordinate, 3 tangent,
+*    3 binormal, 3 normal) in global mesh space. Indices are absolute, there's no base vertex.
+*
+*    Level of detail (LOD): All LODs share the vertex data, a LOD is just another range within the index
+*    data. LOD 0 is the original mesh and starts at index 0, the following LODs are getting coarser. The
+*    sub-mesh table stores the sub-meshes of LOD 0 first, followed by the sub-meshes of LOD 1 and so on.
+*
+*    Increase "VERSION" whenever the layout changes, the loader rejects files with a different version.
+*/
+namespace MeshFormat
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Definitions                                           ]
+	//[-------------------------------------------------------]
+	static const unsigned int MAGIC							  = 0x4853454D;	/**< "MESH" as four character code */
+	static const unsigned int VERSION						  = 2;			/**< Format version, increase it whenever the layout changes */
+	static const unsigned int DATA_ALIGNMENT				  = 16;			/**< Alignment of the vertex and index data in bytes */
+	static const unsigned int NUMBER_OF_COMPONENTS_PER_VERTEX = 14;			/**< Number of float components per vertex (3 position, 2 texture coordinate, 3 tangent, 3 binormal, 3 normal) */
+
+
+	//[-------------------------------------------------------]
+	//[ Structures                                            ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    File header
+	*/
+	struct Header
+	{
+		unsigned int magic;						/**< Must be "MeshFormat::MAGIC" */
+		unsigned int version;					/**< Must be "MeshFormat::VERSION" */
+		unsigned int numberOfBytesPerVertex;	/**< Number of bytes per vertex */
+		unsigned int numberOfVertices;			/**< Number of vertices */
+		unsigned int vertexDataOffset;			/**< Offset of the vertex data */
+		unsigned int indexBufferFormat;			/**< Index data format ("Renderer::IndexBufferFormat::Enum") */
+		unsigned int numberOfIndices;			/**< Number of indices */
+		unsigned int indexDataOffset;			/**< Offset of the index data */
+		unsigned int numberOfSubMeshes;			/**< Number of sub-meshes per LOD, the sub-mesh table directly follows the header */
+		unsigned int numberOfLods;				/**< Number of LODs, at least one, the LOD table directly follows the sub-mesh table */
+		float		 boundingBoxMinimum[3];		/**< Minimum of the axis aligned bounding box in mesh space */
+		float		 boundingBoxMaximum[3];		/**< Maximum of the axis aligned bounding box in mesh space */
+		float		 boundingSphereRadius;		/**< Radius of the bounding sphere around the bounding box center */
+	};
+
+	/**
+	*  @brief
+	*    Sub-mesh, a range within the index data
+	*/
+	struct SubMesh
+	{
+		unsigned int startIndexLocation;	/**< First index of the sub-mesh */
+		unsigned int numberOfIndices;		/**< Number of indices of the sub-mesh */
+		unsigned int minimumIndex;			/**< Lowest vertex index referenced by the sub-mesh */
+		unsigned int numberOfVertices;		/**< Number of vertices referenced by the sub-mesh, starting at "minimumIndex" */
+		unsigned int materialIndex;			/**< Material index of the source asset */
+		float		 boundingBoxMinimum[3];	/**< Minimum of the axis aligned bounding box in mesh space */
+		float		 boundingBoxMaximum[3];	/**< Maximum of the axis aligned bounding box in mesh space */
+	};
+
+	/**
+	*  @brief
+	*    Level of detail, a range within the index data covering all sub-meshes of the LOD
+	*/
+	struct Lod
+	{
+		unsigned int startIndexLocation;	/**< First index of the LOD */
+		unsigned int numberOfIndices;		/**< Number of indices of the LOD */
+		float		 geometricError;		/**< Geometric error in mesh space units compared to LOD 0, 0 for LOD 0 */
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // MeshFormat
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __MESHCOOKER_MESHFORMAT_H__
@@ -0,0 +1,548 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "MeshCooker/MeshOptimizer.h"
+#include "Framework/PlatformTypes.h"
+
+#include <math.h>
+#include <string.h>
+#include <stdlib.h>
+
+
+//[-------------------------------------------------------]
+//[ Local definitions                                     ]
+//[-------------------------------------------------------]
+// Tom Forsyth, "Linear-Speed Vertex Cache Optimisation", http://home.comcast.net/~tom_forsyth/papers/fast_vert_cache_opt.html
+static const unsigned int FORSYTH_CACHE_SIZE		  = 32;		/**< Size of the modelled LRU cache */
+static const unsigned int FORSYTH_VALENCE_TABLE_SIZE  = 32;		/**< Number of precomputed valence scores */
+static const float		  FORSYTH_CACHE_DECAY_POWER	  = 1.5f;
+static const float		  FORSYTH_LAST_TRIANGLE_SCORE = 0.75f;
+static const float		  FORSYTH_VALENCE_BOOST_SCALE = 2.0f;
+static const float		  FORSYTH_VALENCE_BOOST_POWER = 0.5f;
+static const unsigned int INVALID_INDEX				  = ~0u;
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Return the Forsyth score of a vertex
+*
+*  @param[in] cachePosition
+*    Position of the vertex inside the modelled cache, <0 if the vertex is not inside the cache
+*  @param[in] numberOfRemainingTriangles
+*    Number of not yet emitted triangles using this vertex
+*/
+static float getForsythVertexScore(int cachePosition, unsigned int numberOfRemainingTriangles)
+{
+	// Precomputed score tables
+	static float cacheScores[FORSYTH_CACHE_SIZE];
+	static float valenceScores[FORSYTH_VALENCE_TABLE_SIZE];
+	static bool initialized = false;
+	if (!initialized)
+	{
+		for (unsigned int i = 0; i < FORSYTH_CACHE_SIZE; ++i)
+		{
+			// The vertices of the last triangle get a fixed score, this avoids that the same triangle
+			// sequence is favored which would result in a strip-like order
+			cacheScores[i] = (i < 3) ? FORSYTH_LAST_TRIANGLE_SCORE : powf(1.0f - static_cast<float>(i - 3) / static_cast<float>(FORSYTH_CACHE_SIZE - 3), FORSYTH_CACHE_DECAY_POWER);
+		}
+		valenceScores[0] = 0.0f;
+		for (unsigned int i = 1; i < FORSYTH_VALENCE_TABLE_SIZE; ++i)
+		{
+			// Bonus points for having a low number of triangles left, so we get rid of lone vertices quickly
+			valenceScores[i] = FORSYTH_VALENCE_BOOST_SCALE * powf(static_cast<float>(i), -FORSYTH_VALENCE_BOOST_POWER);
+		}
+		initialized = true;
+	}
+
+	// No triangle needs this vertex anymore?
+	if (0 == numberOfRemainingTriangles)
+	{
+		return -1.0f;
+	}
+
+	// Calculate the score
+	const float cacheScore = (cachePosition >= 0) ? cacheScores[cachePosition] : 0.0f;
+	const float valenceScore = (numberOfRemainingTriangles < FORSYTH_VALENCE_TABLE_SIZE) ? valenceScores[numberOfRemainingTriangles] : FORSYTH_VALENCE_BOOST_SCALE * powf(static_cast<float>(numberOfRemainingTriangles), -FORSYTH_VALENCE_BOOST_POWER);
+	return cacheScore + valenceScore;
+}
+
+/**
+*  @brief
+*    Overdraw cluster sort key
+*/
+struct OverdrawCluster
+{
+	unsigned int startTriangle;		/**< First triangle of the cluster */
+	unsigned int numberOfTriangles;	/**< Number of triangles inside the cluster */
+	float		 sortKey;			/**< Sort key, clusters with higher keys are drawn first */
+};
+
+/**
+*  @brief
+*    "qsort()" compare function sorting overdraw clusters by descending sort key
+*/
+static int compareOverdrawClusters(const void *left, const void *right)
+{
+	const float leftSortKey  = static_cast<const OverdrawCluster*>(left)->sortKey;
+	const float rightSortKey = static_cast<const OverdrawCluster*>(right)->sortKey;
+	if (leftSortKey > rightSortKey)
+	{
+		return -1;
+	}
+	else if (leftSortKey < rightSortKey)
+	{
+		return 1;
+	}
+	else
+	{
+		// Stable order for equal keys
+		return (static_cast<const OverdrawCluster*>(left)->startTriangle < static_cast<const OverdrawCluster*>(right)->startTriangle) ? -1 : 1;
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static methods                                 ]
+//[-------------------------------------------------------]
+bool MeshOptimizer::isValidTriangleList(const unsigned int *indices, unsigned int numberOfIndices, unsigned int numberOfVertices)
+{
+	// Only complete triangles are supported
+	if (0 != numberOfIndices % 3)
+	{
+		return false;
+	}
+
+	// All indices must be inside the given vertex range
+	for (unsigned int i = 0; i < numberOfIndices; ++i)
+	{
+		if (indices[i] >= numberOfVertices)
+		{
+			return false;
+		}
+	}
+
+	// Valid triangle list
+	return true;
+}
+
+void MeshOptimizer::analyzeVertexCache(const unsigned int *indices, unsigned int numberOfIndices, unsigned int numberOfVertices, unsigned int cacheSize, VertexCacheStatistics &vertexCacheStatistics)
+{
+	vertexCacheStatistics.numberOfTriangles			  = numberOfIndices / 3;
+	vertexCacheStatistics.numberOfVertices			  = 0;
+	vertexCacheStatistics.numberOfTransformedVertices = 0;
+	vertexCacheStatistics.acmr						  = 0.0f;
+	vertexCacheStatistics.atvr						  = 0.0f;
+	if (0 != numberOfIndices % 3)
+	{
+		// Error! Not a triangle list.
+		vertexCacheStatistics.numberOfTriangles = 0;
+		return;
+	}
+
+	// Simulate a FIFO cache by using timestamps: A vertex is inside the cache if it was inserted less than "cacheSize" insertions ago
+	// -> Timestamp 0 means "never referenced"
+	unsigned int *cacheTimestamps = new unsigned int[numberOfVertices];
+	memset(cacheTimestamps, 0, sizeof(unsigned int) * numberOfVertices);
+	unsigned int timestamp = cacheSize + 1;
+	for (unsigned int i = 0; i < numberOfIndices; ++i)
+	{
+		const unsigned int vertex = indices[i];
+		if (0 == cacheTimestamps[vertex])
+		{
+			++vertexCacheStatistics.numberOfVertices;
+		}
+		if (timestamp - cacheTimestamps[vertex] > cacheSize)
+		{
+			// Cache miss, the vertex needs to be transformed
+			cacheTimestamps[vertex] = timestamp;
+			++timestamp;
+			++vertexCacheStatistics.numberOfTransformedVertices;
+		}
+	}
+	delete [] cacheTimestamps;
+
+	// Calculate the ratios
+	vertexCacheStatistics.acmr = (vertexCacheStatistics.numberOfTriangles > 0) ? static_cast<float>(vertexCacheStatistics.numberOfTransformedVertices) / static_cast<float>(vertexCacheStatistics.numberOfTriangles) : 0.0f;
+	vertexCacheStatistics.atvr = (vertexCacheStatistics.numberOfVertices  > 0) ? static_cast<float>(vertexCacheStatistics.numberOfTransformedVertices) / static_cast<float>(vertexCacheStatistics.numberOfVertices)  : 0.0f;
+}
+
+void MeshOptimizer::addVertexCacheStatistics(VertexCacheStatistics &vertexCacheStatistics, const VertexCacheStatistics &otherVertexCacheStatistics)
+{
+	vertexCacheStatistics.numberOfTriangles			  += otherVertexCacheStatistics.numberOfTriangles;
+	vertexCacheStatistics.numberOfVertices			  += otherVertexCacheStatistics.numberOfVertices;
+	vertexCacheStatistics.numberOfTransformedVertices += otherVertexCacheStatistics.numberOfTransformedVertices;
+	vertexCacheStatistics.acmr = (vertexCacheStatistics.numberOfTriangles > 0) ? static_cast<float>(vertexCacheStatistics.numberOfTransformedVertices) / static_cast<float>(vertexCacheStatistics.numberOfTriangles) : 0.0f;
+	vertexCacheStatistics.atvr = (vertexCacheStatistics.numberOfVertices  > 0) ? static_cast<float>(vertexCacheStatistics.numberOfTransformedVertices) / static_cast<float>(vertexCacheStatistics.numberOfVertices)  : 0.0f;
+}
+
+void MeshOptimizer::optimizeVertexCache(unsigned int *indices, unsigned int numberOfIndices, unsigned int numberOfVertices)
+{
+	const unsigned int numberOfTriangles = numberOfIndices / 3;
+	if (0 == numberOfTriangles || 0 == numberOfVertices || 0 != numberOfIndices % 3)
+	{
+		// Nothing to do in here
+		return;
+	}
+
+	// Build the vertex to triangle adjacency, the triangles of vertex "v" are "adjacency[offsets[v]]" ... "adjacency[offsets[v] + numberOfRemainingTriangles[v] - 1]"
+	unsigned int *numberOfRemainingTriangles = new unsigned int[numberOfVertices];
+	unsigned int *offsets					 = new unsigned int[numberOfVertices];
+	unsigned int *adjacency					 = new unsigned int[numberOfTriangles * 3];
+	memset(numberOfRemainingTriangles, 0, sizeof(unsigned int) * numberOfVertices);
+	for (unsigned int i = 0; i < numberOfIndices; ++i)
+	{
+		++numberOfRemainingTriangles[indices[i]];
+	}
+	{
+		unsigned int offset = 0;
+		for (unsigned int v = 0; v < numberOfVertices; ++v)
+		{
+			offsets[v] = offset;
+			offset += numberOfRemainingTriangles[v];
+			numberOfRemainingTriangles[v] = 0;
+		}
+	}
+	for (unsigned int i = 0; i < numberOfIndices; ++i)
+	{
+		const unsigned int vertex = indices[i];
+		adjacency[offsets[vertex] + numberOfRemainingTriangles[vertex]] = i / 3;
+		++numberOfRemainingTriangles[vertex];
+	}
+
+	// Initial vertex and triangle scores
+	int   *cachePositions  = new int[numberOfVertices];
+	float *vertexScores	   = new float[numberOfVertices];
+	float *triangleScores  = new float[numberOfTriangles];
+	bool  *emittedTriangles = new bool[numberOfTriangles];
+	for (unsigned int v = 0; v < numberOfVertices; ++v)
+	{
+		cachePositions[v] = -1;
+		vertexScores[v]	  = getForsythVertexScore(-1, numberOfRemainingTriangles[v]);
+	}
+	unsigned int bestTriangle = 0;
+	for (unsigned int t = 0; t < numberOfTriangles; ++t)
+	{
+		triangleScores[t]	= vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+		emittedTriangles[t] = false;
+		if (triangleScores[t] > triangleScores[bestTriangle])
+		{
+			bestTriangle = t;
+		}
+	}
+
+	// Emit the triangles one after another
+	unsigned int cache[FORSYTH_CACHE_SIZE + 3];
+	unsigned int newCache[FORSYTH_CACHE_SIZE + 3];
+	unsigned int cacheCount = 0;
+	unsigned int scanTriangle = 0;
+	unsigned int *newIndices = new unsigned int[numberOfTriangles * 3];
+	for (unsigned int outputTriangle = 0; outputTriangle < numberOfTriangles; ++outputTriangle)
+	{
+		// No candidate inside the cache? Fall back to the next not yet emitted triangle in input order, this keeps the algorithm linear.
+		if (INVALID_INDEX == bestTriangle)
+		{
+			while (emittedTriangles[scanTriangle])
+			{
+				++scanTriangle;
+			}
+			bestTriangle = scanTriangle;
+		}
+
+		// Emit the triangle
+		const unsigned int *triangle = &indices[bestTriangle * 3];
+		newIndices[outputTriangle * 3]	   = triangle[0];
+		newIndices[outputTriangle * 3 + 1] = triangle[1];
+		newIndices[outputTriangle * 3 + 2] = triangle[2];
+		emittedTriangles[bestTriangle] = true;
+
+		// Remove the triangle from the adjacency of its vertices
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			const unsigned int vertex = triangle[i];
+			unsigned int *vertexTriangles = &adjacency[offsets[vertex]];
+			const unsigned int last = numberOfRemainingTriangles[vertex] - 1;
+			for (unsigned int j = 0; j <= last; ++j)
+			{
+				if (vertexTriangles[j] == bestTriangle)
+				{
+					vertexTriangles[j] = vertexTriangles[last];
+					vertexTriangles[last] = bestTriangle;
+					break;
+				}
+			}
+			--numberOfRemainingTriangles[vertex];
+		}
+
+		// Update the modelled LRU cache: The triangle vertices are moved to the front
+		unsigned int newCacheCount = 0;
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			// Degenerated triangles may reference the same vertex multiple times
+			if (0 == i || triangle[i] != triangle[0])
+			{
+				if (2 != i || triangle[2] != triangle[1])
+				{
+					newCache[newCacheCount] = triangle[i];
+					++newCacheCount;
+				}
+			}
+		}
+		for (unsigned int i = 0; i < cacheCount; ++i)
+		{
+			const unsigned int vertex = cache[i];
+			if (vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2])
+			{
+				newCache[newCacheCount] = vertex;
+				++newCacheCount;
+			}
+		}
+
+		// Update the scores of all vertices which have been touched, including the ones just pushed out of the cache
+		for (unsigned int i = 0; i < newCacheCount; ++i)
+		{
+			const unsigned int vertex = newCache[i];
+			cachePositions[vertex] = (i < FORSYTH_CACHE_SIZE) ? static_cast<int>(i) : -1;
+			const float newScore = getForsythVertexScore(cachePositions[vertex], numberOfRemainingTriangles[vertex]);
+			const float scoreDelta = newScore - vertexScores[vertex];
+			vertexScores[vertex] = newScore;
+			const unsigned int *vertexTriangles = &adjacency[offsets[vertex]];
+			for (unsigned int j = 0; j < numberOfRemainingTriangles[vertex]; ++j)
+			{
+				triangleScores[vertexTriangles[j]] += scoreDelta;
+			}
+		}
+		cacheCount = (newCacheCount < FORSYTH_CACHE_SIZE) ? newCacheCount : FORSYTH_CACHE_SIZE;
+		memcpy(cache, newCache, sizeof(unsigned int) * cacheCount);
+
+		// Find the next best triangle, only triangles using vertices inside the cache are considered
+		bestTriangle = INVALID_INDEX;
+		float bestScore = -1.0f;
+		for (unsigned int i = 0; i < cacheCount; ++i)
+		{
+			const unsigned int vertex = cache[i];
+			const unsigned int *vertexTriangles = &adjacency[offsets[vertex]];
+			for (unsigned int j = 0; j < numberOfRemainingTriangles[vertex]; ++j)
+			{
+				const unsigned int t = vertexTriangles[j];
+				if (triangleScores[t] > bestScore)
+				{
+					bestScore	 = triangleScores[t];
+					bestTriangle = t;
+				}
+			}
+		}
+	}
+
+	// Copy the result
+	memcpy(indices, newIndices, sizeof(unsigned int) * numberOfTriangles * 3);
+
+	// Cleanup
+	delete [] newIndices;
+	delete [] emittedTriangles;
+	delete [] triangleScores;
+	delete [] vertexScores;
+	delete [] cachePositions;
+	delete [] adjacency;
+	delete [] offsets;
+	delete [] numberOfRemainingTriangles;
+}
+
+void MeshOptimizer::optimizeOverdraw(unsigned int *indices, unsigned int numberOfIndices, const float *vertexData, unsigned int numberOfVertices, unsigned int vertexStride, float threshold)
+{
+	const unsigned int numberOfTriangles = numberOfIndices / 3;
+	if (numberOfTriangles < 2 || 0 == numberOfVertices || 0 != numberOfIndices % 3)
+	{
+		// Nothing to do in here
+		return;
+	}
+
+	// Gather the vertex cache statistics of the current order, used to reject the result if it's worse than the given threshold
+	VertexCacheStatistics originalVertexCacheStatistics;
+	analyzeVertexCache(indices, numberOfIndices, numberOfVertices, DEFAULT_CACHE_SIZE, originalVertexCacheStatistics);
+
+	// Split the triangles into clusters, a new cluster starts at each triangle without any vertex cache hit
+	OverdrawCluster *clusters = new OverdrawCluster[numberOfTriangles];
+	unsigned int numberOfClusters = 0;
+	{
+		unsigned int *cacheTimestamps = new unsigned int[numberOfVertices];
+		memset(cacheTimestamps, 0, sizeof(unsigned int) * numberOfVertices);
+		unsigned int timestamp = DEFAULT_CACHE_SIZE + 1;
+		for (unsigned int t = 0; t < numberOfTriangles; ++t)
+		{
+			unsigned int numberOfCacheMisses = 0;
+			for (unsigned int i = 0; i < 3; ++i)
+			{
+				const unsigned int vertex = indices[t * 3 + i];
+				if (timestamp - cacheTimestamps[vertex] > DEFAULT_CACHE_SIZE)
+				{
+					cacheTimestamps[vertex] = timestamp;
+					++timestamp;
+					++numberOfCacheMisses;
+				}
+			}
+			if (0 == t || 3 == numberOfCacheMisses)
+			{
+				clusters[numberOfClusters].startTriangle	 = t;
+				clusters[numberOfClusters].numberOfTriangles = 0;
+				clusters[numberOfClusters].sortKey			 = 0.0f;
+				++numberOfClusters;
+			}
+			++clusters[numberOfClusters - 1].numberOfTriangles;
+		}
+		delete [] cacheTimestamps;
+	}
+	if (numberOfClusters < 2)
+	{
+		// Nothing to reorder
+		delete [] clusters;
+		return;
+	}
+
+	// Get the area weighted mesh centroid
+	float meshCentroid[3] = { 0.0f, 0.0f, 0.0f };
+	float meshArea = 0.0f;
+	float *triangleData = new float[numberOfTriangles * 7];	// Per triangle: Area weighted normal (3), centroid (3), area (1)
+	for (unsigned int t = 0; t < numberOfTriangles; ++t)
+	{
+		const float *p0 = &vertexData[indices[t * 3]	 * vertexStride];
+		const float *p1 = &vertexData[indices[t * 3 + 1] * vertexStride];
+		const float *p2 = &vertexData[indices[t * 3 + 2] * vertexStride];
+		const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+		const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+		float *currentTriangleData = &triangleData[t * 7];
+		currentTriangleData[0] = e1[1] * e2[2] - e1[2] * e2[1];
+		currentTriangleData[1] = e1[2] * e2[0] - e1[0] * e2[2];
+		currentTriangleData[2] = e1[0] * e2[1] - e1[1] * e2[0];
+		currentTriangleData[3] = (p0[0] + p1[0] + p2[0]) / 3.0f;
+		currentTriangleData[4] = (p0[1] + p1[1] + p2[1]) / 3.0f;
+		currentTriangleData[5] = (p0[2] + p1[2] + p2[2]) / 3.0f;
+		currentTriangleData[6] = sqrtf(currentTriangleData[0] * currentTriangleData[0] + currentTriangleData[1] * currentTriangleData[1] + currentTriangleData[2] * currentTriangleData[2]) * 0.5f;
+		meshCentroid[0] += currentTriangleData[3] * currentTriangleData[6];
+		meshCentroid[1] += currentTriangleData[4] * currentTriangleData[6];
+		meshCentroid[2] += currentTriangleData[5] * currentTriangleData[6];
+		meshArea += currentTriangleData[6];
+	}
+	if (meshArea > 0.0f)
+	{
+		meshCentroid[0] /= meshArea;
+		meshCentroid[1] /= meshArea;
+		meshCentroid[2] /= meshArea;
+	}
+
+	// Calculate the cluster sort keys: The more a cluster faces away from the mesh center, the more likely it occludes other clusters
+	for (unsigned int c = 0; c < numberOfClusters; ++c)
+	{
+		OverdrawCluster &cluster = clusters[c];
+		float clusterNormal[3]	 = { 0.0f, 0.0f, 0.0f };
+		float clusterCentroid[3] = { 0.0f, 0.0f, 0.0f };
+		float clusterArea = 0.0f;
+		for (unsigned int t = cluster.startTriangle; t < cluster.startTriangle + cluster.numberOfTriangles; ++t)
+		{
+			const float *currentTriangleData = &triangleData[t * 7];
+			clusterNormal[0]   += currentTriangleData[0];
+			clusterNormal[1]   += currentTriangleData[1];
+			clusterNormal[2]   += currentTriangleData[2];
+			clusterCentroid[0] += currentTriangleData[3] * currentTriangleData[6];
+			clusterCentroid[1] += currentTriangleData[4] * currentTriangleData[6];
+			clusterCentroid[2] += currentTriangleData[5] * currentTriangleData[6];
+			clusterArea		   += currentTriangleData[6];
+		}
+		const float normalLength = sqrtf(clusterNormal[0] * clusterNormal[0] + clusterNormal[1] * clusterNormal[1] + clusterNormal[2] * clusterNormal[2]);
+		if (normalLength > 0.0f && clusterArea > 0.0f)
+		{
+			cluster.sortKey = ((clusterCentroid[0] / clusterArea - meshCentroid[0]) * clusterNormal[0] +
+							   (clusterCentroid[1] / clusterArea - meshCentroid[1]) * clusterNormal[1] +
+							   (clusterCentroid[2] / clusterArea - meshCentroid[2]) * clusterNormal[2]) / normalLength;
+		}
+	}
+	delete [] triangleData;
+
+	// Sort the clusters and write the new triangle order
+	qsort(clusters, numberOfClusters, sizeof(OverdrawCluster), compareOverdrawClusters);
+	unsigned int *newIndices = new unsigned int[numberOfTriangles * 3];
+	{
+		unsigned int *currentNewIndices = newIndices;
+		for (unsigned int c = 0; c < numberOfClusters; ++c)
+		{
+			const unsigned int numberOfClusterIndices = clusters[c].numberOfTriangles * 3;
+			memcpy(currentNewIndices, &indices[clusters[c].startTriangle * 3], sizeof(unsigned int) * numberOfClusterIndices);
+			currentNewIndices += numberOfClusterIndices;
+		}
+	}
+	delete [] clusters;
+
+	// Only accept the new order if the vertex cache efficiency is still within the given threshold
+	VertexCacheStatistics newVertexCacheStatistics;
+	analyzeVertexCache(newIndices, numberOfTriangles * 3, numberOfVertices, DEFAULT_CACHE_SIZE, newVertexCacheStatistics);
+	if (newVertexCacheStatistics.acmr <= originalVertexCacheStatistics.acmr * threshold)
+	{
+		memcpy(indices, newIndices, sizeof(unsigned int) * numberOfTriangles * 3);
+	}
+	delete [] newIndices;
+}
+
+unsigned int MeshOptimizer::optimizeVertexFetch(float *vertexData, unsigned int numberOfVertices, unsigned int vertexStride, unsigned int *indices, unsigned int numberOfIndices)
+{
+	// Assign new vertex positions in the order the vertices are referenced
+	unsigned int *remap = new unsigned int[numberOfVertices];
+	memset(remap, 0xFF, sizeof(unsigned int) * numberOfVertices);
+	unsigned int numberOfReferencedVertices = 0;
+	for (unsigned int i = 0; i < numberOfIndices; ++i)
+	{
+		unsigned int &newVertex = remap[indices[i]];
+		if (INVALID_INDEX == newVertex)
+		{
+			newVertex = numberOfReferencedVertices;
+			++numberOfReferencedVertices;
+		}
+		indices[i] = newVertex;
+	}
+
+	// Unreferenced vertices are moved behind the referenced ones
+	unsigned int nextVertex = numberOfReferencedVertices;
+	for (unsigned int v = 0; v < numberOfVertices; ++v)
+	{
+		if (INVALID_INDEX == remap[v])
+		{
+			remap[v] = nextVertex;
+			++nextVertex;
+		}
+	}
+
+	// Reorder the vertex data
+	const unsigned int numberOfBytesPerVertex = sizeof(float) * vertexStride;
+	float *newVertexData = new float[numberOfVertices * vertexStride];
+	for (unsigned int v = 0; v < numberOfVertices; ++v)
+	{
+		memcpy(&newVertexData[remap[v] * vertexStride], &vertexData[v * vertexStride], numberOfBytesPerVertex);
+	}
+	memcpy(vertexData, newVertexData, numberOfBytesPerVertex * numberOfVertices);
+	delete [] newVertexData;
+	delete [] remap;
+
+	// Done
+	return numberOfReferencedVertices;
+}
@@ -0,0 +1,191 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __MESHCOOKER_MESHOPTIMIZER_H__
+#define __MESHCOOKER_MESHOPTIMIZER_H__
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Static mesh optimizer for indexed triangle lists
+*
+*  @remarks
+*    The recommended order is
+*    1. "optimizeVertexCache()": Reorder the triangles for the post-transform vertex cache (Tom Forsyth, "Linear-Speed Vertex Cache Optimisation")
+*    2. "optimizeOverdraw()":    Reorder clusters of triangles so that outward facing clusters are drawn first, without destroying the vertex cache efficiency
+*    3. "optimizeVertexFetch()": Reorder the vertices in the order they are referenced by the indices for pre-transform cache locality
+*
+*    All methods work on indices which are relative to the first vertex of the given vertex range, meaning
+*    the indices must be in the range [0, numberOfVertices).
+*
+*    The efficiency of the post-transform vertex cache is measured by
+*    - ACMR (average cache miss ratio): Transformed vertices per triangle, 3.0 is the worst case, 0.5 the theoretical optimum
+*    - ATVR (average transformed vertex ratio): Transformed vertices per referenced vertex, 1.0 is the optimum
+*/
+class MeshOptimizer
+{
+
+
+//[-------------------------------------------------------]
+//[ Public definitions                                    ]
+//[-------------------------------------------------------]
+public:
+	static const unsigned int DEFAULT_CACHE_SIZE = 16;	/**< Default FIFO cache size used for the vertex cache analysis, conservative value matching a wide range of GPUs */
+
+	/**
+	*  @brief
+	*    Vertex cache statistics
+	*/
+	struct VertexCacheStatistics
+	{
+		unsigned int numberOfTriangles;				/**< Number of triangles */
+		unsigned int numberOfVertices;				/**< Number of referenced vertices */
+		unsigned int numberOfTransformedVertices;	/**< Number of vertex shader invocations */
+		float		 acmr;							/**< Average cache miss ratio, transformed vertices per triangle */
+		float		 atvr;							/**< Average transformed vertex ratio, transformed vertices per referenced vertex */
+	};
+
+
+//[-------------------------------------------------------]
+//[ Public static methods                                 ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Check whether or not the given indices form a valid triangle list
+	*
+	*  @param[in] indices
+	*    Triangle list indices to check, must be valid
+	*  @param[in] numberOfIndices
+	*    Number of indices
+	*  @param[in] numberOfVertices
+	*    Number of vertices
+	*
+	*  @return
+	*    "true" if the number of indices is a multiple of three and all indices are smaller than "numberOfVertices", else "false"
+	*
+	*  @note
+	*    - The other methods don't touch triangle lists with a number of indices which isn't a multiple of three, sub-meshes should be rejected by using this method before handing them over
+	*/
+	static bool isValidTriangleList(const unsigned int *indices, unsigned int numberOfIndices, unsigned int numberOfVertices);
+
+	/**
+	*  @brief
+	*    Analyze the post-transform vertex cache efficiency by simulating a FIFO cache
+	*
+	*  @param[in]  indices
+	*    Triangle list indices, must be valid
+	*  @param[in]  numberOfIndices
+	*    Number of indices, must be a multiple of three
+	*  @param[in]  numberOfVertices
+	*    Number of vertices, all indices must be smaller than this
+	*  @param[in]  cacheSize
+	*    Number of FIFO cache entries
+	*  @param[out] vertexCacheStatistics
+	*    Receives the vertex cache statistics
+	*/
+	static void analyzeVertexCache(const unsigned int *indices, unsigned int numberOfIndices, unsigned int numberOfVertices, unsigned int cacheSize, VertexCacheStatistics &vertexCacheStatistics);
+
+	/**
+	*  @brief
+	*    Add vertex cache statistics
+	*
+	*  @param[in, out] vertexCacheStatistics
+	*    Vertex cache statistics to add to, ratios are updated
+	*  @param[in]      otherVertexCacheStatistics
+	*    Vertex cache statistics to add
+	*/
+	static void addVertexCacheStatistics(VertexCacheStatistics &vertexCacheStatistics, const VertexCacheStatistics &otherVertexCacheStatistics);
+
+	/**
+	*  @brief
+	*    Reorder the triangles for the post-transform vertex cache
+	*
+	*  @param[in, out] indices
+	*    Triangle list indices to reorder, must be valid
+	*  @param[in]      numberOfIndices
+	*    Number of indices, must be a multiple of three
+	*  @param[in]      numberOfVertices
+	*    Number of vertices, all indices must be smaller than this
+	*
+	*  @note
+	*    - Linear time, independent of a concrete cache size
+	*/
+	static void optimizeVertexCache(unsigned int *indices, unsigned int numberOfIndices, unsigned int numberOfVertices);
+
+	/**
+	*  @brief
+	*    Reorder clusters of triangles to reduce overdraw
+	*
+	*  @param[in, out] indices
+	*    Triangle list indices to reorder, must be valid, should already be optimized by "optimizeVertexCache()"
+	*  @param[in]      numberOfIndices
+	*    Number of indices, must be a multiple of three
+	*  @param[in]      vertexData
+	*    Vertex data, the first three floats of each vertex must be the position, must be valid
+	*  @param[in]      numberOfVertices
+	*    Number of vertices, all indices must be smaller than this
+	*  @param[in]      vertexStride
+	*    Number of floats per vertex
+	*  @param[in]      threshold
+	*    Maximum allowed ACMR degradation factor, e.g. 1.05 means that the ACMR may get 5% worse, else the original order is kept
+	*
+	*  @remarks
+	*    The triangles are split into clusters at the points where the vertex cache has no reuse to the
+	*    previous triangles, so the clusters can be reordered almost for free. Clusters facing away from
+	*    the mesh center are drawn first because they are more likely to occlude other clusters.
+	*/
+	static void optimizeOverdraw(unsigned int *indices, unsigned int numberOfIndices, const float *vertexData, unsigned int numberOfVertices, unsigned int vertexStride, float threshold = 1.05f);
+
+	/**
+	*  @brief
+	*    Reorder the vertices in the order they are referenced by the indices
+	*
+	*  @param[in, out] vertexData
+	*    Vertex data to reorder, must be valid
+	*  @param[in]      numberOfVertices
+	*    Number of vertices, all indices must be smaller than this
+	*  @param[in]      vertexStride
+	*    Number of floats per vertex
+	*  @param[in, out] indices
+	*    Triangle list indices to remap, must be valid
+	*  @param[in]      numberOfIndices
+	*    Number of indices
+	*
+	*  @return
+	*    Number of referenced vertices, unreferenced vertices are moved behind the referenced ones
+	*/
+	static unsigned int optimizeVertexFetch(float *vertexData, unsigned int numberOfVertices, unsigned int vertexStride, unsigned int *indices, unsigned int numberOfIndices);
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __MESHCOOKER_MESHOPTIMIZER_H__
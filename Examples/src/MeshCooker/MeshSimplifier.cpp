@@ -0,0 +1,391 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "MeshCooker/MeshSimplifier.h"
+
+#include <math.h>
+#include <string.h>
+#include <stdlib.h>
+
+
+//[-------------------------------------------------------]
+//[ Local definitions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Symmetric 4x4 error quadric, stored as 3x3 matrix A, vector b and scalar c so that the
+*    error of a position p is "p^T A p + 2 b^T p + c"
+*/
+struct Quadric
+{
+	double a00, a01, a02, a11, a12, a22;
+	double b0, b1, b2;
+	double c;
+	double weight;	/**< Summed weight (triangle area) of the planes, used to normalize the error */
+};
+
+/**
+*  @brief
+*    Edge collapse candidate
+*/
+struct CollapseCandidate
+{
+	float		 cost;		/**< Error introduced by the collapse */
+	unsigned int from;		/**< Vertex to remove */
+	unsigned int to;		/**< Vertex to move "from" onto */
+};
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Add the quadric of a plane to a quadric
+*
+*  @param[in, out] quadric
+*    Quadric to add the plane to
+*  @param[in]      normal
+*    Normalized plane normal
+*  @param[in]      distance
+*    Plane distance, "dot(normal, p) + distance = 0" for all positions on the plane
+*  @param[in]      weight
+*    Plane weight
+*/
+static void addPlaneToQuadric(Quadric &quadric, const double normal[3], double distance, double weight)
+{
+	quadric.a00	   += weight * normal[0] * normal[0];
+	quadric.a01	   += weight * normal[0] * normal[1];
+	quadric.a02	   += weight * normal[0] * normal[2];
+	quadric.a11	   += weight * normal[1] * normal[1];
+	quadric.a12	   += weight * normal[1] * normal[2];
+	quadric.a22	   += weight * normal[2] * normal[2];
+	quadric.b0	   += weight * normal[0] * distance;
+	quadric.b1	   += weight * normal[1] * distance;
+	quadric.b2	   += weight * normal[2] * distance;
+	quadric.c	   += weight * distance * distance;
+	quadric.weight += weight;
+}
+
+/**
+*  @brief
+*    Add a quadric to another one
+*/
+static void addQuadric(Quadric &quadric, const Quadric &otherQuadric)
+{
+	quadric.a00	   += otherQuadric.a00;
+	quadric.a01	   += otherQuadric.a01;
+	quadric.a02	   += otherQuadric.a02;
+	quadric.a11	   += otherQuadric.a11;
+	quadric.a12	   += otherQuadric.a12;
+	quadric.a22	   += otherQuadric.a22;
+	quadric.b0	   += otherQuadric.b0;
+	quadric.b1	   += otherQuadric.b1;
+	quadric.b2	   += otherQuadric.b2;
+	quadric.c	   += otherQuadric.c;
+	quadric.weight += otherQuadric.weight;
+}
+
+/**
+*  @brief
+*    Return the weight normalized error of a position, this is the weighted mean squared distance to the planes of the quadric
+*/
+static double evaluateQuadric(const Quadric &quadric, const float *position)
+{
+	const double x = position[0];
+	const double y = position[1];
+	const double z = position[2];
+	const double error = x * (quadric.a00 * x + 2.0 * (quadric.a01 * y + quadric.a02 * z + quadric.b0)) +
+						 y * (quadric.a11 * y + 2.0 * (quadric.a12 * z + quadric.b1)) +
+						 z * (quadric.a22 * z + 2.0 * quadric.b2) +
+						 quadric.c;
+	return (error > 0.0) ? ((quadric.weight > 0.0) ? error / quadric.weight : error) : 0.0;
+}
+
+/**
+*  @brief
+*    Calculate the not normalized normal of a triangle
+*/
+static void calculateTriangleNormal(const float *position0, const float *position1, const float *position2, double normal[3])
+{
+	const double edge0[3] = { position1[0] - position0[0], position1[1] - position0[1], position1[2] - position0[2] };
+	const double edge1[3] = { position2[0] - position0[0], position2[1] - position0[1], position2[2] - position0[2] };
+	normal[0] = edge0[1] * edge1[2] - edge0[2] * edge1[1];
+	normal[1] = edge0[2] * edge1[0] - edge0[0] * edge1[2];
+	normal[2] = edge0[0] * edge1[1] - edge0[1] * edge1[0];
+}
+
+/**
+*  @brief
+*    Build the vertex to triangle adjacency
+*
+*  @param[in]  indices
+*    Triangle list indices
+*  @param[in]  numberOfIndices
+*    Number of indices
+*  @param[in]  numberOfVertices
+*    Number of vertices
+*  @param[out] offsets
+*    Receives "numberOfVertices + 1" offsets into "triangles", the triangles of vertex i are "triangles[offsets[i]]" to "triangles[offsets[i + 1] - 1]"
+*  @param[out] triangles
+*    Receives "numberOfIndices" triangle indices
+*/
+static void buildAdjacency(const unsigned int *indices, unsigned int numberOfIndices, unsigned int numberOfVertices, unsigned int *offsets, unsigned int *triangles)
+{
+	memset(offsets, 0, sizeof(unsigned int) * (numberOfVertices + 1));
+	for (unsigned int i = 0; i < numberOfIndices; ++i)
+	{
+		++offsets[indices[i] + 1];
+	}
+	for (unsigned int i = 0; i < numberOfVertices; ++i)
+	{
+		offsets[i + 1] += offsets[i];
+	}
+	for (unsigned int i = 0; i < numberOfIndices; ++i)
+	{
+		triangles[offsets[indices[i]]++] = i / 3;
+	}
+
+	// The fill pass moved each offset to the start of the next vertex, move them back
+	for (unsigned int i = numberOfVertices; i > 0; --i)
+	{
+		offsets[i] = offsets[i - 1];
+	}
+	offsets[0] = 0;
+}
+
+/**
+*  @brief
+*    "qsort()" compare function sorting collapse candidates by ascending cost
+*/
+static int compareCollapseCandidates(const void *left, const void *right)
+{
+	const float leftCost  = static_cast<const CollapseCandidate*>(left)->cost;
+	const float rightCost = static_cast<const CollapseCandidate*>(right)->cost;
+	return (leftCost < rightCost) ? -1 : ((leftCost > rightCost) ? 1 : 0);
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static methods                                 ]
+//[-------------------------------------------------------]
+unsigned int MeshSimplifier::simplify(unsigned int *destinationIndices, const unsigned int *indices, unsigned int numberOfIndices, const float *vertexData, unsigned int numberOfVertices, unsigned int vertexStride, unsigned int targetNumberOfIndices, float &resultError)
+{
+	// Start with the original triangles
+	memcpy(destinationIndices, indices, sizeof(unsigned int) * numberOfIndices);
+	resultError = 0.0f;
+	if (numberOfIndices <= targetNumberOfIndices || 0 == numberOfVertices || 0 != numberOfIndices % 3)
+	{
+		// Nothing to do
+		return numberOfIndices;
+	}
+
+	// Vertex to triangle adjacency
+	unsigned int *adjacencyOffsets   = new unsigned int[numberOfVertices + 1];
+	unsigned int *adjacencyTriangles = new unsigned int[numberOfIndices];
+	buildAdjacency(indices, numberOfIndices, numberOfVertices, adjacencyOffsets, adjacencyTriangles);
+
+	// Setup the quadrics, each vertex gets the area weighted planes of its triangles
+	Quadric *quadrics = new Quadric[numberOfVertices];
+	memset(quadrics, 0, sizeof(Quadric) * numberOfVertices);
+	for (unsigned int i = 0; i < numberOfIndices; i += 3)
+	{
+		const float *position0 = &vertexData[indices[i] * vertexStride];
+		double normal[3];
+		calculateTriangleNormal(position0, &vertexData[indices[i + 1] * vertexStride], &vertexData[indices[i + 2] * vertexStride], normal);
+		const double length = sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+		if (length > 0.0)
+		{
+			normal[0] /= length;
+			normal[1] /= length;
+			normal[2] /= length;
+			const double distance = -(normal[0] * position0[0] + normal[1] * position0[1] + normal[2] * position0[2]);
+			const double area = length * 0.5;
+			for (unsigned int k = 0; k < 3; ++k)
+			{
+				addPlaneToQuadric(quadrics[indices[i + k]], normal, distance, area);
+			}
+		}
+	}
+
+	// Lock all vertices on open borders: A directed edge without an opposite directed edge is a border edge
+	unsigned char *locked = new unsigned char[numberOfVertices];
+	memset(locked, 0, sizeof(unsigned char) * numberOfVertices);
+	for (unsigned int i = 0; i < numberOfIndices; ++i)
+	{
+		const unsigned int vertex0 = indices[i];
+		const unsigned int vertex1 = indices[(i % 3 < 2) ? (i + 1) : (i - 2)];
+		bool opposite = false;
+		for (unsigned int a = adjacencyOffsets[vertex1]; a < adjacencyOffsets[vertex1 + 1] && !opposite; ++a)
+		{
+			const unsigned int *triangle = &indices[adjacencyTriangles[a] * 3];
+			for (unsigned int k = 0; k < 3; ++k)
+			{
+				if (triangle[k] == vertex1 && triangle[(k + 1) % 3] == vertex0)
+				{
+					opposite = true;
+					break;
+				}
+			}
+		}
+		if (!opposite)
+		{
+			locked[vertex0] = 1;
+			locked[vertex1] = 1;
+		}
+	}
+
+	// Collapse edges in passes, each pass performs a set of independent collapses starting with the cheapest ones
+	CollapseCandidate *collapseCandidates = new CollapseCandidate[numberOfIndices * 2];
+	unsigned int *remap = new unsigned int[numberOfVertices];
+	unsigned char *touched = new unsigned char[numberOfVertices];
+	double maximumError = 0.0;
+	unsigned int currentNumberOfIndices = numberOfIndices;
+	while (currentNumberOfIndices > targetNumberOfIndices)
+	{
+		// Update the adjacency to the current triangles
+		buildAdjacency(destinationIndices, currentNumberOfIndices, numberOfVertices, adjacencyOffsets, adjacencyTriangles);
+
+		// Gather and sort the collapse candidates, each edge can be collapsed in both directions
+		unsigned int numberOfCollapseCandidates = 0;
+		for (unsigned int i = 0; i < currentNumberOfIndices; ++i)
+		{
+			const unsigned int vertex0 = destinationIndices[i];
+			const unsigned int vertex1 = destinationIndices[(i % 3 < 2) ? (i + 1) : (i - 2)];
+			for (unsigned int direction = 0; direction < 2; ++direction)
+			{
+				const unsigned int from = direction ? vertex1 : vertex0;
+				const unsigned int to   = direction ? vertex0 : vertex1;
+				if (!locked[from])
+				{
+					Quadric quadric = quadrics[from];
+					addQuadric(quadric, quadrics[to]);
+					CollapseCandidate &collapseCandidate = collapseCandidates[numberOfCollapseCandidates++];
+					collapseCandidate.cost = static_cast<float>(evaluateQuadric(quadric, &vertexData[to * vertexStride]));
+					collapseCandidate.from = from;
+					collapseCandidate.to   = to;
+				}
+			}
+		}
+		qsort(collapseCandidates, numberOfCollapseCandidates, sizeof(CollapseCandidate), compareCollapseCandidates);
+
+		// Perform the collapses, a vertex touched by a collapse is not touched again within this pass so
+		// all the collapse decisions of this pass are based on the current geometry
+		for (unsigned int i = 0; i < numberOfVertices; ++i)
+		{
+			remap[i] = i;
+		}
+		memset(touched, 0, sizeof(unsigned char) * numberOfVertices);
+		const unsigned int numberOfTrianglesToRemove = (currentNumberOfIndices - targetNumberOfIndices + 2) / 3;
+		unsigned int numberOfRemovedTriangles = 0;
+		unsigned int numberOfCollapses = 0;
+		for (unsigned int c = 0; c < numberOfCollapseCandidates && numberOfRemovedTriangles < numberOfTrianglesToRemove; ++c)
+		{
+			const CollapseCandidate &collapseCandidate = collapseCandidates[c];
+			const unsigned int from = collapseCandidate.from;
+			const unsigned int to   = collapseCandidate.to;
+			if (touched[from] || touched[to])
+			{
+				continue;
+			}
+
+			// Reject the collapse if one of the remaining triangles would flip
+			bool flip = false;
+			unsigned int numberOfCollapsedTriangles = 0;
+			for (unsigned int a = adjacencyOffsets[from]; a < adjacencyOffsets[from + 1] && !flip; ++a)
+			{
+				const unsigned int *triangle = &destinationIndices[adjacencyTriangles[a] * 3];
+				if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+				{
+					// This triangle degenerates and is removed
+					++numberOfCollapsedTriangles;
+				}
+				else
+				{
+					double normalBefore[3];
+					double normalAfter[3];
+					calculateTriangleNormal(&vertexData[triangle[0] * vertexStride], &vertexData[triangle[1] * vertexStride], &vertexData[triangle[2] * vertexStride], normalBefore);
+					calculateTriangleNormal(&vertexData[((triangle[0] == from) ? to : triangle[0]) * vertexStride],
+											&vertexData[((triangle[1] == from) ? to : triangle[1]) * vertexStride],
+											&vertexData[((triangle[2] == from) ? to : triangle[2]) * vertexStride], normalAfter);
+					flip = (normalBefore[0] * normalAfter[0] + normalBefore[1] * normalAfter[1] + normalBefore[2] * normalAfter[2] <= 0.0);
+				}
+			}
+			if (flip || 0 == numberOfCollapsedTriangles)
+			{
+				continue;
+			}
+
+			// Collapse, touch the whole one-ring of the removed vertex because the shape of all its triangles changes
+			for (unsigned int a = adjacencyOffsets[from]; a < adjacencyOffsets[from + 1]; ++a)
+			{
+				const unsigned int *triangle = &destinationIndices[adjacencyTriangles[a] * 3];
+				touched[triangle[0]] = 1;
+				touched[triangle[1]] = 1;
+				touched[triangle[2]] = 1;
+			}
+			remap[from] = to;
+			addQuadric(quadrics[to], quadrics[from]);
+			if (maximumError < collapseCandidate.cost)
+			{
+				maximumError = collapseCandidate.cost;
+			}
+			numberOfRemovedTriangles += numberOfCollapsedTriangles;
+			++numberOfCollapses;
+		}
+		if (0 == numberOfCollapses)
+		{
+			// The mesh can't be simplified any further
+			break;
+		}
+
+		// Apply the collapses and remove the degenerated triangles
+		unsigned int newNumberOfIndices = 0;
+		for (unsigned int i = 0; i < currentNumberOfIndices; i += 3)
+		{
+			const unsigned int vertex0 = remap[destinationIndices[i]];
+			const unsigned int vertex1 = remap[destinationIndices[i + 1]];
+			const unsigned int vertex2 = remap[destinationIndices[i + 2]];
+			if (vertex0 != vertex1 && vertex1 != vertex2 && vertex2 != vertex0)
+			{
+				destinationIndices[newNumberOfIndices++] = vertex0;
+				destinationIndices[newNumberOfIndices++] = vertex1;
+				destinationIndices[newNumberOfIndices++] = vertex2;
+			}
+		}
+		currentNumberOfIndices = newNumberOfIndices;
+	}
+
+	// Cleanup
+	delete [] touched;
+	delete [] remap;
+	delete [] collapseCandidates;
+	delete [] locked;
+	delete [] quadrics;
+	delete [] adjacencyTriangles;
+	delete [] adjacencyOffsets;
+
+	// Done, the error is a squared distance
+	resultError = static_cast<float>(sqrt(maximumError));
+	return currentNumberOfIndices;
+}
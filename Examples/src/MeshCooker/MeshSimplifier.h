@@ -0,0 +1,89 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __MESHCOOKER_MESHSIMPLIFIER_H__
+#define __MESHCOOKER_MESHSIMPLIFIER_H__
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Static mesh simplifier for indexed triangle lists
+*
+*  @remarks
+*    Quadric error metric based edge collapse (Michael Garland and Paul S. Heckbert, "Surface Simplification Using
+*    Quadric Error Metrics"). Only the indices are touched: Each collapse moves one vertex onto one of its
+*    neighbours (half-edge collapse) so all levels of detail can share a single vertex buffer and only differ in
+*    their index buffer ranges.
+*
+*    Vertices on open borders are never moved. Since vertices along texture coordinate or normal seams are
+*    split, those seams are borders as well, which keeps the texture mapping intact.
+*
+*    Like "MeshOptimizer", all methods work on indices which are relative to the first vertex of the given
+*    vertex range, meaning the indices must be in the range [0, numberOfVertices).
+*/
+class MeshSimplifier
+{
+
+
+//[-------------------------------------------------------]
+//[ Public static methods                                 ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Simplify a triangle list
+	*
+	*  @param[out] destinationIndices
+	*    Receives the simplified triangle list indices, must be able to hold at least "numberOfIndices" indices
+	*  @param[in]  indices
+	*    Triangle list indices to simplify, must be valid
+	*  @param[in]  numberOfIndices
+	*    Number of indices, must be a multiple of three
+	*  @param[in]  vertexData
+	*    Vertex data, the first three floats of each vertex must be the position, must be valid
+	*  @param[in]  numberOfVertices
+	*    Number of vertices, all indices must be smaller than this
+	*  @param[in]  vertexStride
+	*    Number of floats per vertex
+	*  @param[in]  targetNumberOfIndices
+	*    Wished number of indices, the result may be above if the mesh can't be simplified any further
+	*  @param[out] resultError
+	*    Receives the geometric error of the simplified mesh as distance in vertex data units
+	*
+	*  @return
+	*    Number of written destination indices, a multiple of three
+	*/
+	static unsigned int simplify(unsigned int *destinationIndices, const unsigned int *indices, unsigned int numberOfIndices, const float *vertexData, unsigned int numberOfVertices, unsigned int vertexStride, unsigned int targetNumberOfIndices, float &resultError);
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __MESHCOOKER_MESHSIMPLIFIER_H__
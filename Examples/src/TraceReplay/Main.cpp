@@ -0,0 +1,200 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Framework/Stopwatch.h"
+#include "Framework/MemoryMappedFile.h"
+
+#include <TraceRenderer/TracePlayer.h>
+
+#include <Renderer/IRenderer.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+//[-------------------------------------------------------]
+//[ Global functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Create a renderer instance without a native window
+*
+*  @param[in] rendererName
+*    Case sensitive ASCII name of the renderer to instance, must be valid
+*
+*  @return
+*    The renderer instance, null pointer on error
+*/
+Renderer::IRenderer *createRendererInstance(const char *rendererName)
+{
+	// Null
+	#ifndef RENDERER_NO_NULL
+		if (0 == strcmp(rendererName, "Null"))
+		{
+			extern Renderer::IRenderer *createNullRendererInstance(handle, Renderer::IAllocator *);
+			return createNullRendererInstance(NULL_HANDLE, nullptr);
+		}
+	#endif
+
+	// OpenGL
+	#ifndef RENDERER_NO_OPENGL
+		if (0 == strcmp(rendererName, "OpenGL"))
+		{
+			extern Renderer::IRenderer *createOpenGLRendererInstance(handle, Renderer::IAllocator *);
+			return createOpenGLRendererInstance(NULL_HANDLE, nullptr);
+		}
+	#endif
+
+	// OpenGLES2
+	#ifndef RENDERER_NO_OPENGLES2
+		if (0 == strcmp(rendererName, "OpenGLES2"))
+		{
+			extern Renderer::IRenderer *createOpenGLES2RendererInstance(handle, Renderer::IAllocator *);
+			return createOpenGLES2RendererInstance(NULL_HANDLE, nullptr);
+		}
+	#endif
+
+	// Error!
+	return nullptr;
+}
+
+
+//[-------------------------------------------------------]
+//[ Program entry point                                   ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Trace replay command line tool
+*
+*  @remarks
+*    Usage: "TraceReplay [-renderer <renderer name>] [-loops <number of loops>] <trace file>", e.g. "TraceReplay -renderer Null FirstTriangle.trace"
+*
+*    Replays a renderer API call trace captured by the trace renderer (see environment variable "RENDERER_TRACE_FILENAME" of the examples)
+*    and prints the frame timings. Replaying with the null renderer measures the renderer API overhead of the application side in isolation.
+*/
+int main(int argc, char **argv)
+{
+	// Check the command line arguments
+	const char *rendererName = "Null";
+	unsigned int numberOfLoops = 1;
+	bool validArguments = (argc >= 2);
+	for (int i = 1; i < argc - 1 && validArguments; ++i)
+	{
+		if (0 == strcmp(argv[i], "-renderer") && i + 1 < argc - 1)
+		{
+			rendererName = argv[++i];
+		}
+		else if (0 == strcmp(argv[i], "-loops") && i + 1 < argc - 1)
+		{
+			numberOfLoops = static_cast<unsigned int>(atoi(argv[++i]));
+		}
+		else
+		{
+			validArguments = false;
+		}
+	}
+	if (!validArguments || 0 == numberOfLoops)
+	{
+		printf("Usage: %s [-renderer <renderer name>] [-loops <number of loops>] <trace file>\n", argv[0]);
+		printf("  Replays a renderer API call trace (format version %u) and prints the frame timings\n", TraceFormat::VERSION);
+		printf("  -renderer: Renderer to replay the trace with, \"Null\", \"OpenGL\" or \"OpenGLES2\" (default: Null)\n");
+		printf("  -loops:    Number of times the trace is replayed, each loop uses a new renderer instance (default: 1)\n");
+		return 1;
+	}
+	const char *traceFilename = argv[argc - 1];
+
+	// Map the trace file into memory
+	MemoryMappedFile memoryMappedFile;
+	if (!memoryMappedFile.open(traceFilename))
+	{
+		fprintf(stderr, "Failed to open the trace file \"%s\"\n", traceFilename);
+		return 1;
+	}
+
+	// Replay the trace
+	unsigned int numberOfFrames = 0;
+	unsigned int numberOfCommands = 0;
+	float minimumFrameTime = 0.0f;
+	float maximumFrameTime = 0.0f;
+	float totalTime = 0.0f;
+	for (unsigned int loop = 0; loop < numberOfLoops; ++loop)
+	{
+		// Create the renderer instance
+		Renderer::IRenderer *renderer = createRendererInstance(rendererName);
+		if (nullptr == renderer || !renderer->isInitialized())
+		{
+			fprintf(stderr, "Failed to create the renderer instance \"%s\"\n", rendererName);
+			if (nullptr != renderer)
+			{
+				renderer->addReference();
+				renderer->release();
+			}
+			return 1;
+		}
+		renderer->addReference();
+
+		{ // Scope for the trace player, which must be destroyed before the renderer instance
+			TraceRenderer::TracePlayer tracePlayer(*renderer, memoryMappedFile.getData(), memoryMappedFile.getNumberOfBytes());
+			if (!tracePlayer.isValid())
+			{
+				fprintf(stderr, "\"%s\" is no trace file of format version %u\n", traceFilename, TraceFormat::VERSION);
+				renderer->release();
+				return 1;
+			}
+			if (0 == loop)
+			{
+				printf("Replaying \"%s\" captured with the \"%s\" renderer by using the \"%s\" renderer\n", traceFilename, tracePlayer.getCapturedRendererName(), rendererName);
+			}
+
+			// Play frame by frame
+			Stopwatch stopwatch;
+			stopwatch.start();
+			while (tracePlayer.playFrame())
+			{
+				stopwatch.stop();
+				const float frameTime = stopwatch.getMilliseconds();
+				if (0 == numberOfFrames || frameTime < minimumFrameTime)
+				{
+					minimumFrameTime = frameTime;
+				}
+				if (0 == numberOfFrames || frameTime > maximumFrameTime)
+				{
+					maximumFrameTime = frameTime;
+				}
+				totalTime += frameTime;
+				++numberOfFrames;
+				stopwatch.start();
+			}
+			numberOfCommands += tracePlayer.getNumberOfPlayedCommands();
+		}
+
+		// Destroy the renderer instance
+		renderer->release();
+	}
+
+	// Done
+	printf("Replayed %u frames with %u commands: %.3f ms total, frame time min %.3f ms, avg %.3f ms, max %.3f ms\n", numberOfFrames, numberOfCommands, totalTime,
+		minimumFrameTime, (numberOfFrames > 0) ? totalTime / static_cast<float>(numberOfFrames) : 0.0f, maximumFrameTime);
+	return 0;
+}
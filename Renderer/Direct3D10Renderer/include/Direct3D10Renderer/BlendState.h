@@ -60,7 +60,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    Direct3D 10 blend state class
 	*/
-	class BlendState : public Renderer::IBlendState
+	class BlendState final : public Renderer::IBlendState
 	{
 
 
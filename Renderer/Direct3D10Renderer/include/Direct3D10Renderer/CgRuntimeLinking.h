@@ -29,6 +29,8 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <Renderer/AllocatorObject.h>
+
 __pragma(warning(push))
 	__pragma(warning(disable: 4668))	// warning C4668: '<x>' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
 	#include <Cg/cgD3D10.h>
@@ -49,7 +51,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    Cg runtime linking
 	*/
-	class CgRuntimeLinking
+	class CgRuntimeLinking : public Renderer::AllocatorObject<Renderer::AllocationTag::RENDERER>
 	{
 
 
@@ -60,7 +60,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    Direct3D 10 depth stencil state class
 	*/
-	class DepthStencilState : public Renderer::IDepthStencilState
+	class DepthStencilState final : public Renderer::IDepthStencilState
 	{
 
 
@@ -37,6 +37,15 @@ namespace Direct3D10Renderer
 		return mD3D10Device;
 	}
 
+	/**
+	*  @brief
+	*    Return the pool for the uniform buffer instances
+	*/
+	inline Renderer::ResourcePool &Direct3D10Renderer::getUniformBufferPool()
+	{
+		return mUniformBufferPool;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IRenderer methods            ]
@@ -30,6 +30,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Direct3D10Renderer/D3D10.h"
+#include <Renderer/AllocatorObject.h>
 
 
 //[-------------------------------------------------------]
@@ -46,7 +47,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    Direct3D 10 runtime linking
 	*/
-	class Direct3D10RuntimeLinking
+	class Direct3D10RuntimeLinking : public Renderer::AllocatorObject<Renderer::AllocationTag::RENDERER>
 	{
 
 
@@ -53,7 +53,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    Cg fragment shader ("pixel shader" in Direct3D terminology) class
 	*/
-	class FragmentShaderCg : public FragmentShader
+	class FragmentShaderCg final : public FragmentShader
 	{
 
 
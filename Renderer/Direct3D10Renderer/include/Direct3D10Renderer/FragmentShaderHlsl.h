@@ -52,7 +52,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    HLSL fragment shader ("pixel shader" in Direct3D terminology) class
 	*/
-	class FragmentShaderHlsl : public FragmentShader
+	class FragmentShaderHlsl final : public FragmentShader
 	{
 
 
@@ -52,7 +52,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    HLSL geometry shader class
 	*/
-	class GeometryShaderHlsl : public GeometryShader
+	class GeometryShaderHlsl final : public GeometryShader
 	{
 
 
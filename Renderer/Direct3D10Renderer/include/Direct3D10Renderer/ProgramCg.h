@@ -54,7 +54,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    Cg program class
 	*/
-	class ProgramCg : public Program
+	class ProgramCg final : public Program
 	{
 
 
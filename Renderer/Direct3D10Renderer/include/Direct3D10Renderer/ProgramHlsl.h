@@ -54,7 +54,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    HLSL program class
 	*/
-	class ProgramHlsl : public Program
+	class ProgramHlsl final : public Program
 	{
 
 
@@ -60,7 +60,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    Direct3D 10 rasterizer state class
 	*/
-	class RasterizerState : public Renderer::IRasterizerState
+	class RasterizerState final : public Renderer::IRasterizerState
 	{
 
 
@@ -60,7 +60,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    Direct3D 10 sampler state class
 	*/
-	class SamplerState : public Renderer::ISamplerState
+	class SamplerState final : public Renderer::ISamplerState
 	{
 
 
@@ -28,6 +28,15 @@ namespace Direct3D10Renderer
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Return the Direct3D 10 2D texture instance
+	*/
+	inline ID3D10Texture2D *Texture2D::getD3D10Texture2D() const
+	{
+		return mD3D10Texture2D;
+	}
+
 	/**
 	*  @brief
 	*    Return the Direct3D shader resource view instance
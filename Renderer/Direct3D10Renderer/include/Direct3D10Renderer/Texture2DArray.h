@@ -57,7 +57,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    Direct3D 10 2D array texture class
 	*/
-	class Texture2DArray : public Renderer::ITexture2DArray
+	class Texture2DArray final : public Renderer::ITexture2DArray
 	{
 
 
@@ -115,11 +115,19 @@ namespace Direct3D10Renderer
 		virtual void setDebugName(const char *name) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2DArray methods      ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void updateRegion(unsigned int mipmap, unsigned int slice, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data) override;
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		ID3D10ShaderResourceView *mD3D10ShaderResourceViewTexture;	/**< Direct3D 10 shader resource view, can be a null pointer */
+		ID3D10ShaderResourceView	 *mD3D10ShaderResourceViewTexture;	/**< Direct3D 10 shader resource view, can be a null pointer */
+		Renderer::TextureFormat::Enum mTextureFormat;					/**< Texture format */
 
 
 	};
@@ -59,7 +59,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    Direct3D 10 texture buffer object (TBO) class
 	*/
-	class TextureBuffer : public Renderer::ITextureBuffer
+	class TextureBuffer final : public Renderer::ITextureBuffer
 	{
 
 
@@ -60,7 +60,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    Direct3D 10 texture collection class
 	*/
-	class TextureCollection : public Renderer::ITextureCollection
+	class TextureCollection final : public Renderer::ITextureCollection
 	{
 
 
@@ -57,7 +57,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    Direct3D 10 uniform buffer object (UBO, "constant buffer" in Direct3D terminology) interface
 	*/
-	class UniformBuffer : public Renderer::IUniformBuffer
+	class UniformBuffer final : public Renderer::IUniformBuffer
 	{
 
 
@@ -55,7 +55,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    Cg vertex shader class
 	*/
-	class VertexShaderCg : public VertexShader
+	class VertexShaderCg final : public VertexShader
 	{
 
 
@@ -54,7 +54,7 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    HLSL vertex shader class
 	*/
-	class VertexShaderHlsl : public VertexShader
+	class VertexShaderHlsl final : public VertexShader
 	{
 
 
@@ -33,7 +33,9 @@
 #include "Direct3D10Renderer/VertexArray.h"
 #include "Direct3D10Renderer/SwapChain.h"
 #include "Direct3D10Renderer/Framebuffer.h"
+#include "Direct3D10Renderer/Fence.h"
 #include "Direct3D10Renderer/IndexBuffer.h"
+#include "Direct3D10Renderer/IndirectBuffer.h"
 #include "Direct3D10Renderer/SamplerState.h"
 #include "Direct3D10Renderer/VertexBuffer.h"
 #include "Direct3D10Renderer/UniformBuffer.h"
@@ -65,9 +67,9 @@
 #else
 	#define DIRECT3D10RENDERER_API_EXPORT
 #endif
-DIRECT3D10RENDERER_API_EXPORT Renderer::IRenderer *createDirect3D10RendererInstance(handle nativeWindowHandle)
+DIRECT3D10RENDERER_API_EXPORT Renderer::IRenderer *createDirect3D10RendererInstance(handle nativeWindowHandle, Renderer::IAllocator *allocator)
 {
-	return new Direct3D10Renderer::Direct3D10Renderer(nativeWindowHandle);
+	return new ((nullptr != allocator) ? *allocator : Renderer::DefaultAllocator::getInstance()) Direct3D10Renderer::Direct3D10Renderer(nativeWindowHandle, allocator);
 }
 #undef DIRECT3D10RENDERER_API_EXPORT
 
@@ -86,18 +88,32 @@ namespace Direct3D10Renderer
 	*  @brief
 	*    Constructor
 	*/
-	Direct3D10Renderer::Direct3D10Renderer(handle nativeWindowHandle) :
-		mDirect3D10RuntimeLinking(new Direct3D10RuntimeLinking()),
+	Direct3D10Renderer::Direct3D10Renderer(handle nativeWindowHandle, Renderer::IAllocator *allocator) :
+		IRenderer(allocator),
+		mDirect3D10RuntimeLinking(new (getAllocator()) Direct3D10RuntimeLinking()),
 		mD3D10Device(nullptr),
 		mDirect3D9RuntimeLinking(nullptr),
 		mShaderLanguageHlsl(nullptr),
 		#ifndef DIRECT3D10RENDERER_NO_CG
-			mCgRuntimeLinking(new CgRuntimeLinking()),
+			mCgRuntimeLinking(new (getAllocator()) CgRuntimeLinking()),
 			mShaderLanguageCg(nullptr),
 		#endif
 		mD3D10QueryFlush(nullptr),
 		mMainSwapChain(nullptr),
-		mRenderTarget(nullptr)
+		mRenderTarget(nullptr),
+		mVertexBufferPool(getAllocator(), sizeof(VertexBuffer)),
+		mIndexBufferPool(getAllocator(), sizeof(IndexBuffer)),
+		mTextureBufferPool(getAllocator(), sizeof(TextureBuffer)),
+		mIndirectBufferPool(getAllocator(), sizeof(IndirectBuffer)),
+		mTexture2DPool(getAllocator(), sizeof(Texture2D)),
+		mTexture2DArrayPool(getAllocator(), sizeof(Texture2DArray)),
+		mRasterizerStatePool(getAllocator(), sizeof(RasterizerState)),
+		mDepthStencilStatePool(getAllocator(), sizeof(DepthStencilState)),
+		mBlendStatePool(getAllocator(), sizeof(BlendState)),
+		mSamplerStatePool(getAllocator(), sizeof(SamplerState)),
+		mTextureCollectionPool(getAllocator(), sizeof(TextureCollection)),
+		mSamplerStateCollectionPool(getAllocator(), sizeof(SamplerStateCollection)),
+		mUniformBufferPool(getAllocator(), sizeof(UniformBuffer))
 	{
 		// Begin debug event
 		RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(this)
@@ -137,7 +153,7 @@ namespace Direct3D10Renderer
 			{
 				#ifdef DIRECT3D10RENDERER_NO_DEBUG
 					// Create the Direct3D 9 runtime linking instance, we know there can't be one, yet
-					mDirect3D9RuntimeLinking = new Direct3D9RuntimeLinking();
+					mDirect3D9RuntimeLinking = new (getAllocator()) Direct3D9RuntimeLinking();
 
 					// Call the Direct3D 9 PIX function
 					if (mDirect3D9RuntimeLinking->isDirect3D9Avaiable())
@@ -325,7 +341,7 @@ namespace Direct3D10Renderer
 				// If required, create the HLSL shader language instance right now
 				if (nullptr == mShaderLanguageHlsl)
 				{
-					mShaderLanguageHlsl = new ShaderLanguageHlsl(*this);
+					mShaderLanguageHlsl = new (getAllocator()) ShaderLanguageHlsl(*this);
 					mShaderLanguageHlsl->addReference();	// Internal renderer reference
 				}
 
@@ -341,7 +357,7 @@ namespace Direct3D10Renderer
 						// If required, create the Cg shader language instance right now
 						if (nullptr == mShaderLanguageCg)
 						{
-							mShaderLanguageCg = new ShaderLanguageCg(*this);
+							mShaderLanguageCg = new (getAllocator()) ShaderLanguageCg(*this);
 							mShaderLanguageCg->addReference();	// Internal renderer reference
 						}
 
@@ -366,68 +382,74 @@ namespace Direct3D10Renderer
 	Renderer::ISwapChain *Direct3D10Renderer::createSwapChain(handle nativeWindowHandle)
 	{
 		// The provided native window handle must not be a null handle
-		return (NULL_HANDLE != nativeWindowHandle) ? new SwapChain(*this, nativeWindowHandle) : nullptr;
+		return (NULL_HANDLE != nativeWindowHandle) ? new (getAllocator()) SwapChain(*this, nativeWindowHandle) : nullptr;
 	}
 
 	Renderer::IFramebuffer *Direct3D10Renderer::createFramebuffer(unsigned int numberOfColorTextures, Renderer::ITexture **colorTextures, Renderer::ITexture *depthStencilTexture)
 	{
 		// Validation is done inside the framebuffer implementation
-		return new Framebuffer(*this, numberOfColorTextures, colorTextures, depthStencilTexture);
+		return new (getAllocator()) Framebuffer(*this, numberOfColorTextures, colorTextures, depthStencilTexture);
 	}
 
 	Renderer::IVertexBuffer *Direct3D10Renderer::createVertexBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
-		return new VertexBuffer(*this, numberOfBytes, data, bufferUsage);
+		return new (mVertexBufferPool) VertexBuffer(*this, numberOfBytes, data, bufferUsage);
 	}
 
 	Renderer::IIndexBuffer *Direct3D10Renderer::createIndexBuffer(unsigned int numberOfBytes, Renderer::IndexBufferFormat::Enum indexBufferFormat, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
-		return new IndexBuffer(*this, numberOfBytes, indexBufferFormat, data, bufferUsage);
+		return new (mIndexBufferPool) IndexBuffer(*this, numberOfBytes, indexBufferFormat, data, bufferUsage);
 	}
 
 	Renderer::ITextureBuffer *Direct3D10Renderer::createTextureBuffer(unsigned int numberOfBytes, Renderer::TextureFormat::Enum textureFormat, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
-		return new TextureBuffer(*this, numberOfBytes, textureFormat, data, bufferUsage);
+		return new (mTextureBufferPool) TextureBuffer(*this, numberOfBytes, textureFormat, data, bufferUsage);
 	}
 
-	Renderer::ITexture2D *Direct3D10Renderer::createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage)
+	Renderer::IIndirectBuffer *Direct3D10Renderer::createIndirectBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
-		return new Texture2D(*this, width, height, textureFormat, data, flags, textureUsage);
+		// Direct3D 10 has no indirect draw support, the indirect buffer is emulated within system memory
+		return new (mIndirectBufferPool) IndirectBuffer(*this, numberOfBytes, data, bufferUsage);
+	}
+
+	Renderer::ITexture2D *Direct3D10Renderer::createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage, unsigned int numberOfMultisamples)
+	{
+		return new (mTexture2DPool) Texture2D(*this, width, height, textureFormat, data, flags, textureUsage, numberOfMultisamples);
 	}
 
 	Renderer::ITexture2DArray *Direct3D10Renderer::createTexture2DArray(unsigned int width, unsigned int height, unsigned int numberOfSlices, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage)
 	{
-		return new Texture2DArray(*this, width, height, numberOfSlices, textureFormat, data, flags, textureUsage);
+		return new (mTexture2DArrayPool) Texture2DArray(*this, width, height, numberOfSlices, textureFormat, data, flags, textureUsage);
 	}
 
 	Renderer::IRasterizerState *Direct3D10Renderer::createRasterizerState(const Renderer::RasterizerState &rasterizerState)
 	{
-		return new RasterizerState(*this, rasterizerState);
+		return new (mRasterizerStatePool) RasterizerState(*this, rasterizerState);
 	}
 
 	Renderer::IDepthStencilState *Direct3D10Renderer::createDepthStencilState(const Renderer::DepthStencilState &depthStencilState)
 	{
-		return new DepthStencilState(*this, depthStencilState);
+		return new (mDepthStencilStatePool) DepthStencilState(*this, depthStencilState);
 	}
 
 	Renderer::IBlendState *Direct3D10Renderer::createBlendState(const Renderer::BlendState &blendState)
 	{
-		return new BlendState(*this, blendState);
+		return new (mBlendStatePool) BlendState(*this, blendState);
 	}
 
 	Renderer::ISamplerState *Direct3D10Renderer::createSamplerState(const Renderer::SamplerState &samplerState)
 	{
-		return new SamplerState(*this, samplerState);
+		return new (mSamplerStatePool) SamplerState(*this, samplerState);
 	}
 
 	Renderer::ITextureCollection *Direct3D10Renderer::createTextureCollection(unsigned int numberOfTextures, Renderer::ITexture **textures)
 	{
-		return new TextureCollection(*this, numberOfTextures, textures);
+		return new (mTextureCollectionPool) TextureCollection(*this, numberOfTextures, textures);
 	}
 
 	Renderer::ISamplerStateCollection *Direct3D10Renderer::createSamplerStateCollection(unsigned int numberOfSamplerStates, Renderer::ISamplerState **samplerStates)
 	{
-		return new SamplerStateCollection(*this, numberOfSamplerStates, samplerStates);
+		return new (mSamplerStateCollectionPool) SamplerStateCollection(*this, numberOfSamplerStates, samplerStates);
 	}
 
 
@@ -469,18 +491,13 @@ namespace Direct3D10Renderer
 				// Begin debug event
 				RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(this)
 
-				// Get the Direct3D 10 resource instance
-				// -> The user is asked to not manipulate the view, so the cast to "ID3D10Resource" is assumed to be safe in here
-				ID3D10Texture2D *d3d10Texture2D = nullptr;
+				// Get the Direct3D 10 2D texture instance
+				ID3D10Texture2D *d3d10Texture2D = static_cast<Texture2D&>(resource).getD3D10Texture2D();
 				D3D10_MAPPED_TEXTURE2D d3d10MappedTexture2D;
-				static_cast<Texture2D&>(resource).getD3D10ShaderResourceView()->GetResource(reinterpret_cast<ID3D10Resource**>(&d3d10Texture2D));
 				if (nullptr != d3d10Texture2D)
 				{
-					// Map the Direct3D 10 resource
+					// Map the Direct3D 10 2D texture
 					result = (S_OK == d3d10Texture2D->Map(subresource, static_cast<D3D10_MAP>(mapType), mapFlags, &d3d10MappedTexture2D));
-
-					// Release the Direct3D 10 resource instance
-					d3d10Texture2D->Release();
 				}
 				else
 				{
@@ -560,6 +577,7 @@ namespace Direct3D10Renderer
 				return result;
 			}
 
+			case Renderer::ResourceType::INDIRECT_BUFFER:
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::SWAP_CHAIN:
@@ -573,8 +591,10 @@ namespace Direct3D10Renderer
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			case Renderer::ResourceType::TEXTURE_COLLECTION:
 			case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+			case Renderer::ResourceType::FENCE:
 			default:
 				// Nothing we can map, set known return values
 				mappedSubresource.data		 = nullptr;
@@ -612,17 +632,12 @@ namespace Direct3D10Renderer
 				// Begin debug event
 				RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(this)
 
-				// Get the Direct3D 10 resource instance
-				// -> The user is asked to not manipulate the view, so the cast to "ID3D10Resource" is assumed to be safe in here
-				ID3D10Texture2D *d3d10Texture2D = nullptr;
-				static_cast<Texture2D&>(resource).getD3D10ShaderResourceView()->GetResource(reinterpret_cast<ID3D10Resource**>(&d3d10Texture2D));
+				// Get the Direct3D 10 2D texture instance
+				ID3D10Texture2D *d3d10Texture2D = static_cast<Texture2D&>(resource).getD3D10Texture2D();
 				if (nullptr != d3d10Texture2D)
 				{
-					// Unmap the Direct3D 10 resource
+					// Unmap the Direct3D 10 2D texture
 					d3d10Texture2D->Unmap(subresource);
-
-					// Release the Direct3D 10 resource instance
-					d3d10Texture2D->Release();
 				}
 
 				// End debug event
@@ -653,6 +668,7 @@ namespace Direct3D10Renderer
 				break;
 			}
 
+			case Renderer::ResourceType::INDIRECT_BUFFER:
 			case Renderer::ResourceType::PROGRAM:
 			case Renderer::ResourceType::VERTEX_ARRAY:
 			case Renderer::ResourceType::SWAP_CHAIN:
@@ -666,14 +682,89 @@ namespace Direct3D10Renderer
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			case Renderer::ResourceType::TEXTURE_COLLECTION:
 			case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+			case Renderer::ResourceType::FENCE:
 			default:
 				// Nothing we can unmap
 				break;
 		}
 	}
 
+	bool Direct3D10Renderer::copyResource(Renderer::IResource &destinationResource, Renderer::IResource &sourceResource)
+	{
+		// The resource types must match
+		if (destinationResource.getResourceType() != sourceResource.getResourceType())
+		{
+			// Error!
+			return false;
+		}
+
+		// Get the Direct3D 10 resource instances
+		ID3D10Resource *d3d10DestinationResource = nullptr;
+		ID3D10Resource *d3d10SourceResource = nullptr;
+		switch (destinationResource.getResourceType())
+		{
+			case Renderer::ResourceType::INDEX_BUFFER:
+				d3d10DestinationResource = static_cast<IndexBuffer&>(destinationResource).getD3D10Buffer();
+				d3d10SourceResource		= static_cast<IndexBuffer&>(sourceResource).getD3D10Buffer();
+				break;
+
+			case Renderer::ResourceType::VERTEX_BUFFER:
+				d3d10DestinationResource = static_cast<VertexBuffer&>(destinationResource).getD3D10Buffer();
+				d3d10SourceResource		= static_cast<VertexBuffer&>(sourceResource).getD3D10Buffer();
+				break;
+
+			case Renderer::ResourceType::TEXTURE_2D:
+				d3d10DestinationResource = static_cast<Texture2D&>(destinationResource).getD3D10Texture2D();
+				d3d10SourceResource		= static_cast<Texture2D&>(sourceResource).getD3D10Texture2D();
+				break;
+
+			case Renderer::ResourceType::PROGRAM:
+			case Renderer::ResourceType::VERTEX_ARRAY:
+			case Renderer::ResourceType::SWAP_CHAIN:
+			case Renderer::ResourceType::FRAMEBUFFER:
+			case Renderer::ResourceType::UNIFORM_BUFFER:
+			case Renderer::ResourceType::INDIRECT_BUFFER:
+			case Renderer::ResourceType::TEXTURE_BUFFER:
+			case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+			case Renderer::ResourceType::RASTERIZER_STATE:
+			case Renderer::ResourceType::DEPTH_STENCIL_STATE:
+			case Renderer::ResourceType::BLEND_STATE:
+			case Renderer::ResourceType::SAMPLER_STATE:
+			case Renderer::ResourceType::VERTEX_SHADER:
+			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
+			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
+			case Renderer::ResourceType::GEOMETRY_SHADER:
+			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
+			case Renderer::ResourceType::TEXTURE_COLLECTION:
+			case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+			case Renderer::ResourceType::FENCE:
+			default:
+				// Error!
+				return false;
+		}
+		if (nullptr == d3d10DestinationResource || nullptr == d3d10SourceResource)
+		{
+			// Error!
+			return false;
+		}
+
+		// Copy the resource
+		// -> The copy is performed asynchronously on the GPU, use a fence before mapping the destination resource for reading
+		mD3D10Device->CopyResource(d3d10DestinationResource, d3d10SourceResource);
+
+		// Done
+		return true;
+	}
+
+	void Direct3D10Renderer::setTextureResident(Renderer::ITexture &, Renderer::ISamplerState *, bool)
+	{
+		// Direct3D 10 has no bindless texture support
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ States                                                ]
@@ -828,6 +919,7 @@ namespace Direct3D10Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::RASTERIZER_STATE:
 				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
 				case Renderer::ResourceType::BLEND_STATE:
@@ -837,8 +929,10 @@ namespace Direct3D10Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Not handled in here
 					break;
@@ -1092,6 +1186,7 @@ namespace Direct3D10Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::RASTERIZER_STATE:
 				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
 				case Renderer::ResourceType::BLEND_STATE:
@@ -1101,8 +1196,10 @@ namespace Direct3D10Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Not handled in here
 					break;
@@ -1186,6 +1283,38 @@ namespace Direct3D10Renderer
 
 
 
+	//[-------------------------------------------------------]
+	//[ Stream-output (SO) stage                              ]
+	//[-------------------------------------------------------]
+	void Direct3D10Renderer::soSetTargets(unsigned int numberOfTargets, Renderer::IVertexBuffer **vertexBuffers, const unsigned int *)
+	{
+		// TODO(co) Direct3D 10 stream output support is not implemented, yet
+
+		// Are the given vertex buffers valid?
+		if (nullptr != vertexBuffers)
+		{
+			for (unsigned int i = 0; i < numberOfTargets; ++i)
+			{
+				if (nullptr != vertexBuffers[i])
+				{
+					// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+					DIRECT3D10RENDERER_RENDERERMATCHCHECK_RETURN(*this, *vertexBuffers[i])
+				}
+			}
+		}
+	}
+
+	void Direct3D10Renderer::soBegin(Renderer::PrimitiveTopology::Enum, bool)
+	{
+		// TODO(co) Direct3D 10 stream output support is not implemented, yet
+	}
+
+	void Direct3D10Renderer::soEnd()
+	{
+		// TODO(co) Direct3D 10 stream output support is not implemented, yet
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Rasterizer (RS) stage                                 ]
 	//[-------------------------------------------------------]
@@ -1297,6 +1426,7 @@ namespace Direct3D10Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::RASTERIZER_STATE:
 				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
 				case Renderer::ResourceType::BLEND_STATE:
@@ -1306,8 +1436,10 @@ namespace Direct3D10Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Not handled in here
 					break;
@@ -1451,6 +1583,7 @@ namespace Direct3D10Renderer
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::UNIFORM_BUFFER:
+					case Renderer::ResourceType::INDIRECT_BUFFER:
 					case Renderer::ResourceType::TEXTURE_BUFFER:
 					case Renderer::ResourceType::TEXTURE_2D:
 					case Renderer::ResourceType::TEXTURE_2D_ARRAY:
@@ -1463,8 +1596,10 @@ namespace Direct3D10Renderer
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 					case Renderer::ResourceType::TEXTURE_COLLECTION:
 					case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+					case Renderer::ResourceType::FENCE:
 					default:
 						// Not handled in here
 						break;
@@ -1524,6 +1659,82 @@ namespace Direct3D10Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Compute-shader (CS) stage                             ]
+	//[-------------------------------------------------------]
+	void Direct3D10Renderer::csSetTexture(unsigned int, Renderer::ITexture *texture)
+	{
+		// Direct3D 10 has no compute shader support
+
+		// Is the given texture valid?
+		if (nullptr != texture)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D10RENDERER_RENDERERMATCHCHECK_RETURN(*this, *texture)
+		}
+	}
+
+	void Direct3D10Renderer::csSetTextureCollection(unsigned int, Renderer::ITextureCollection *textureCollection)
+	{
+		// Direct3D 10 has no compute shader support
+
+		// Is the given texture collection valid?
+		if (nullptr != textureCollection)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D10RENDERER_RENDERERMATCHCHECK_RETURN(*this, *textureCollection)
+		}
+	}
+
+	void Direct3D10Renderer::csSetSamplerState(unsigned int, Renderer::ISamplerState *samplerState)
+	{
+		// Direct3D 10 has no compute shader support
+
+		// Is the given sampler state valid?
+		if (nullptr != samplerState)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D10RENDERER_RENDERERMATCHCHECK_RETURN(*this, *samplerState)
+		}
+	}
+
+	void Direct3D10Renderer::csSetSamplerStateCollection(unsigned int, Renderer::ISamplerStateCollection *samplerStateCollection)
+	{
+		// Direct3D 10 has no compute shader support
+
+		// Is the given sampler state collection valid?
+		if (nullptr != samplerStateCollection)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D10RENDERER_RENDERERMATCHCHECK_RETURN(*this, *samplerStateCollection)
+		}
+	}
+
+	void Direct3D10Renderer::csSetUniformBuffer(unsigned int, Renderer::IUniformBuffer *uniformBuffer)
+	{
+		// Direct3D 10 has no compute shader support
+
+		// Is the given uniform buffer valid?
+		if (nullptr != uniformBuffer)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D10RENDERER_RENDERERMATCHCHECK_RETURN(*this, *uniformBuffer)
+		}
+	}
+
+	void Direct3D10Renderer::csSetUnorderedAccessView(unsigned int, Renderer::IResource *resource)
+	{
+		// Direct3D 10 has no compute shader support
+
+		// Is the given resource valid?
+		if (nullptr != resource)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D10RENDERER_RENDERERMATCHCHECK_RETURN(*this, *resource)
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Operations                                            ]
 	//[-------------------------------------------------------]
@@ -1612,6 +1823,7 @@ namespace Direct3D10Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::TEXTURE_BUFFER:
 				case Renderer::ResourceType::TEXTURE_2D:
 				case Renderer::ResourceType::TEXTURE_2D_ARRAY:
@@ -1624,8 +1836,10 @@ namespace Direct3D10Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Not handled in here
 					break;
@@ -1653,6 +1867,70 @@ namespace Direct3D10Renderer
 		// Not required when using Direct3D 10
 	}
 
+	void Direct3D10Renderer::resolveMultisampleFramebuffer(Renderer::IRenderTarget &destinationRenderTarget, Renderer::IFramebuffer &sourceMultisampleFramebuffer)
+	{
+		// Security check: Are the given resources owned by this renderer? (calls "return" in case of a mismatch)
+		DIRECT3D10RENDERER_RENDERERMATCHCHECK_RETURN(*this, destinationRenderTarget)
+		DIRECT3D10RENDERER_RENDERERMATCHCHECK_RETURN(*this, sourceMultisampleFramebuffer)
+
+		// Get the Direct3D 10 source render target views
+		Framebuffer &sourceFramebuffer = static_cast<Framebuffer&>(sourceMultisampleFramebuffer);
+		ID3D10RenderTargetView **sourceD3D10RenderTargetViews = sourceFramebuffer.getD3D10RenderTargetViews();
+		unsigned int numberOfD3D10RenderTargetViews = sourceFramebuffer.getNumberOfD3D10RenderTargetViews();
+
+		// Get the Direct3D 10 destination render target views
+		ID3D10RenderTargetView *d3d10SwapChainRenderTargetView = nullptr;
+		ID3D10RenderTargetView **destinationD3D10RenderTargetViews = nullptr;
+		switch (destinationRenderTarget.getResourceType())
+		{
+			case Renderer::ResourceType::SWAP_CHAIN:
+				// A swap chain has only a single color buffer
+				d3d10SwapChainRenderTargetView = static_cast<SwapChain&>(destinationRenderTarget).getD3D10RenderTargetView();
+				destinationD3D10RenderTargetViews = &d3d10SwapChainRenderTargetView;
+				numberOfD3D10RenderTargetViews = 1;
+				break;
+
+			case Renderer::ResourceType::FRAMEBUFFER:
+			{
+				Framebuffer &destinationFramebuffer = static_cast<Framebuffer&>(destinationRenderTarget);
+				destinationD3D10RenderTargetViews = destinationFramebuffer.getD3D10RenderTargetViews();
+				if (numberOfD3D10RenderTargetViews > destinationFramebuffer.getNumberOfD3D10RenderTargetViews())
+				{
+					numberOfD3D10RenderTargetViews = destinationFramebuffer.getNumberOfD3D10RenderTargetViews();
+				}
+				break;
+			}
+
+			default:
+				// Error!
+				return;
+		}
+
+		// Resolve the color buffers
+		for (unsigned int i = 0; i < numberOfD3D10RenderTargetViews; ++i)
+		{
+			if (nullptr != sourceD3D10RenderTargetViews[i] && nullptr != destinationD3D10RenderTargetViews[i])
+			{
+				// Get the Direct3D 10 resources
+				ID3D10Resource *sourceD3D10Resource = nullptr;
+				ID3D10Resource *destinationD3D10Resource = nullptr;
+				sourceD3D10RenderTargetViews[i]->GetResource(&sourceD3D10Resource);
+				destinationD3D10RenderTargetViews[i]->GetResource(&destinationD3D10Resource);
+
+				// Get the DXGI format of the destination 2D texture
+				D3D10_TEXTURE2D_DESC d3d10Texture2DDesc;
+				static_cast<ID3D10Texture2D*>(destinationD3D10Resource)->GetDesc(&d3d10Texture2DDesc);
+
+				// Resolve the multisample resource into the non-multisample resource
+				mD3D10Device->ResolveSubresource(destinationD3D10Resource, 0, sourceD3D10Resource, 0, d3d10Texture2DDesc.Format);
+
+				// Release our Direct3D 10 resource references
+				destinationD3D10Resource->Release();
+				sourceD3D10Resource->Release();
+			}
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Draw call                                             ]
@@ -1701,10 +1979,90 @@ namespace Direct3D10Renderer
 		);
 	}
 
+	void Direct3D10Renderer::multiDrawIndexedIndirect(Renderer::IIndirectBuffer &indirectBuffer, unsigned int indirectBufferOffset, unsigned int numberOfDraws)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		DIRECT3D10RENDERER_RENDERERMATCHCHECK_RETURN(*this, indirectBuffer)
+
+		// Direct3D 10 has no indirect draw support, emulate the multi-draw by using a loop
+		// -> Do not read behind the end of the emulation data
+		// -> "startInstanceLocation" is ignored, "Direct3D10Renderer::drawIndexedInstanced()" always starts at instance zero
+		const IndirectBuffer &direct3D10IndirectBuffer = static_cast<const IndirectBuffer&>(indirectBuffer);
+		const unsigned int maximumNumberOfDraws = (indirectBufferOffset < direct3D10IndirectBuffer.getNumberOfBytes()) ? (direct3D10IndirectBuffer.getNumberOfBytes() - indirectBufferOffset) / sizeof(Renderer::DrawIndexedInstancedArguments) : 0;
+		const Renderer::DrawIndexedInstancedArguments *drawArguments = reinterpret_cast<const Renderer::DrawIndexedInstancedArguments*>(direct3D10IndirectBuffer.getEmulationData() + indirectBufferOffset);
+		const Renderer::DrawIndexedInstancedArguments *drawArgumentsEnd = drawArguments + ((numberOfDraws < maximumNumberOfDraws) ? numberOfDraws : maximumNumberOfDraws);
+		for (; drawArguments < drawArgumentsEnd; ++drawArguments)
+		{
+			if (1 == drawArguments->instanceCount)
+			{
+				drawIndexed(drawArguments->startIndexLocation, drawArguments->indexCountPerInstance, drawArguments->baseVertexLocation, 0, 0);
+			}
+			else if (drawArguments->instanceCount > 1)
+			{
+				drawIndexedInstanced(drawArguments->startIndexLocation, drawArguments->indexCountPerInstance, drawArguments->baseVertexLocation, 0, 0, drawArguments->instanceCount);
+			}
+		}
+	}
+
+	void Direct3D10Renderer::drawAuto()
+	{
+		// TODO(co) Direct3D 10 stream output support is not implemented, yet
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Compute                                               ]
+	//[-------------------------------------------------------]
+	void Direct3D10Renderer::dispatch(unsigned int, unsigned int, unsigned int)
+	{
+		// Direct3D 10 has no compute shader support
+	}
+
+	void Direct3D10Renderer::memoryBarrier(unsigned int)
+	{
+		// Direct3D 10 has no compute shader support
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Synchronization                                       ]
 	//[-------------------------------------------------------]
+	Renderer::IFence *Direct3D10Renderer::insertFence()
+	{
+		return new (getAllocator()) Fence(*this);
+	}
+
+	bool Direct3D10Renderer::isFenceSignaled(Renderer::IFence &fence)
+	{
+		// Poll the Direct3D 10 event query without waiting
+		// -> Flush the command stream, else the fence might never be signaled
+		ID3D10Query *d3d10Query = static_cast<Fence&>(fence).getD3D10Query();
+		return (nullptr != d3d10Query && S_OK == d3d10Query->GetData(nullptr, 0, 0));
+	}
+
+	bool Direct3D10Renderer::waitFence(Renderer::IFence &fence, unsigned int timeout)
+	{
+		ID3D10Query *d3d10Query = static_cast<Fence&>(fence).getD3D10Query();
+		if (nullptr != d3d10Query)
+		{
+			// Direct3D 10 has no blocking wait for event queries, so spin-wait until the event query is signaled or the timeout (in milliseconds) is reached
+			const DWORD startTime = ::GetTickCount();
+			HRESULT hResult = S_FALSE;
+			while (S_FALSE == (hResult = d3d10Query->GetData(nullptr, 0, 0)))
+			{
+				if (~0u != timeout && ::GetTickCount() - startTime >= timeout)
+				{
+					// Timeout reached
+					return false;
+				}
+			}
+			return (S_OK == hResult);
+		}
+
+		// Error!
+		return false;
+	}
+
 	void Direct3D10Renderer::flush()
 	{
 		mD3D10Device->Flush();
@@ -1744,6 +2102,19 @@ namespace Direct3D10Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Swap chain                                            ]
+	//[-------------------------------------------------------]
+	void Direct3D10Renderer::presentSwapChains(unsigned int numberOfSwapChains, Renderer::ISwapChain **swapChains)
+	{
+		// DXGI has no way to present multiple swap chains at once, the swap chains are already sharing the device and with it all resources
+		for (unsigned int i = 0; i < numberOfSwapChains; ++i)
+		{
+			swapChains[i]->present();
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Debug                                                 ]
 	//[-------------------------------------------------------]
@@ -1763,7 +2134,7 @@ namespace Direct3D10Renderer
 			// Create the Direct3D 9 runtime linking instance, in case there's no one, yet
 			if (nullptr == mDirect3D9RuntimeLinking)
 			{
-				mDirect3D9RuntimeLinking = new Direct3D9RuntimeLinking();
+				mDirect3D9RuntimeLinking = new (getAllocator()) Direct3D9RuntimeLinking();
 			}
 
 			// Call the Direct3D 9 PIX function
@@ -1780,7 +2151,7 @@ namespace Direct3D10Renderer
 			// Create the Direct3D 9 runtime linking instance, in case there's no one, yet
 			if (nullptr == mDirect3D9RuntimeLinking)
 			{
-				mDirect3D9RuntimeLinking = new Direct3D9RuntimeLinking();
+				mDirect3D9RuntimeLinking = new (getAllocator()) Direct3D9RuntimeLinking();
 			}
 
 			// Call the Direct3D 9 PIX function
@@ -1797,7 +2168,7 @@ namespace Direct3D10Renderer
 			// Create the Direct3D 9 runtime linking instance, in case there's no one, yet
 			if (nullptr == mDirect3D9RuntimeLinking)
 			{
-				mDirect3D9RuntimeLinking = new Direct3D9RuntimeLinking();
+				mDirect3D9RuntimeLinking = new (getAllocator()) Direct3D9RuntimeLinking();
 			}
 
 			// Call the Direct3D 9 PIX function
@@ -1834,6 +2205,9 @@ namespace Direct3D10Renderer
 		// Maximum number of 2D texture array slices (usually 512, in case there's no support for 2D texture arrays it's 0)
 		mCapabilities.maximumNumberOf2DTextureArraySlices = 512;
 
+		// Maximum number of multisamples per texel of a render target texture (always at least 1, usually 8)
+		mCapabilities.maximumNumberOfMultisamples = 4;
+
 		// Uniform buffer object (UBO, "constant buffer" in Direct3D terminology) supported?
 		mCapabilities.uniformBuffer = true;
 
@@ -1852,6 +2226,9 @@ namespace Direct3D10Renderer
 		// Base vertex supported for draw calls?
 		mCapabilities.baseVertex = true;
 
+		// Native multi-draw indirect supported? (Direct3D 10 has no indirect draw support, "Direct3D10Renderer::multiDrawIndexedIndirect()" uses a loop)
+		mCapabilities.multiDrawIndirect = false;
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = true;
 
@@ -0,0 +1,102 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Direct3D10Renderer/Fence.h"
+#include "Direct3D10Renderer/Guid.h"	// For "WKPDID_D3DDebugObjectName"
+#include "Direct3D10Renderer/D3D10.h"
+#include "Direct3D10Renderer/Direct3D10Renderer.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Direct3D10Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	Fence::Fence(Direct3D10Renderer &direct3D10Renderer) :
+		Renderer::IFence(direct3D10Renderer),
+		mD3D10Query(nullptr)
+	{
+		// Direct3D 10 query description
+		D3D10_QUERY_DESC d3d10QueryDesc;
+		d3d10QueryDesc.Query	 = D3D10_QUERY_EVENT;
+		d3d10QueryDesc.MiscFlags = 0;
+
+		// Create the Direct3D 10 event query and insert it into the command stream
+		direct3D10Renderer.getD3D10Device()->CreateQuery(&d3d10QueryDesc, &mD3D10Query);
+		if (nullptr != mD3D10Query)
+		{
+			mD3D10Query->End();
+		}
+
+		// Assign a default name to the resource for debugging purposes
+		#ifndef DIRECT3D10RENDERER_NO_DEBUG
+			setDebugName("Fence");
+		#endif
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	Fence::~Fence()
+	{
+		// Release the Direct3D 10 event query
+		if (nullptr != mD3D10Query)
+		{
+			mD3D10Query->Release();
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IResource methods            ]
+	//[-------------------------------------------------------]
+	void Fence::setDebugName(const char *name)
+	{
+		#ifndef DIRECT3D10RENDERER_NO_DEBUG
+			// Valid Direct3D 10 event query?
+			if (nullptr != mD3D10Query)
+			{
+				// Set the debug name
+				// -> First: Ensure that there's no previous private data, else we might get slapped with a warning!
+				mD3D10Query->SetPrivateData(WKPDID_D3DDebugObjectName, 0, nullptr);
+				mD3D10Query->SetPrivateData(WKPDID_D3DDebugObjectName, strlen(name), name);
+			}
+		#endif
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Direct3D10Renderer
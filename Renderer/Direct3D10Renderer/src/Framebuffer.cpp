@@ -62,8 +62,8 @@ namespace Direct3D10Renderer
 		// Add a reference to the used color textures
 		if (mNumberOfColorTextures > 0)
 		{
-			mColorTextures = new Renderer::ITexture*[mNumberOfColorTextures];
-			mD3D10RenderTargetViews = new ID3D10RenderTargetView*[mNumberOfColorTextures];
+			mColorTextures = getRenderer().getAllocator().allocateArray<Renderer::ITexture*>(mNumberOfColorTextures, Renderer::AllocationTag::RESOURCE);
+			mD3D10RenderTargetViews = getRenderer().getAllocator().allocateArray<ID3D10RenderTargetView*>(mNumberOfColorTextures, Renderer::AllocationTag::RESOURCE);
 
 			// Loop through all color textures
 			ID3D10RenderTargetView **d3d10RenderTargetView = mD3D10RenderTargetViews;
@@ -104,7 +104,7 @@ namespace Direct3D10Renderer
 							// Create the Direct3D 10 render target view instance
 							D3D10_RENDER_TARGET_VIEW_DESC d3d10RenderTargetViewDesc;
 							d3d10RenderTargetViewDesc.Format			 = d3d10Texture2DDesc.Format;
-							d3d10RenderTargetViewDesc.ViewDimension		 = D3D10_RTV_DIMENSION_TEXTURE2D;
+							d3d10RenderTargetViewDesc.ViewDimension		 = (d3d10Texture2DDesc.SampleDesc.Count > 1) ? D3D10_RTV_DIMENSION_TEXTURE2DMS : D3D10_RTV_DIMENSION_TEXTURE2D;
 							d3d10RenderTargetViewDesc.Texture2D.MipSlice = 0;
 							direct3D10Renderer.getD3D10Device()->CreateRenderTargetView(d3d10Resource, &d3d10RenderTargetViewDesc, d3d10RenderTargetView);
 
@@ -120,6 +120,7 @@ namespace Direct3D10Renderer
 						case Renderer::ResourceType::INDEX_BUFFER:
 						case Renderer::ResourceType::VERTEX_BUFFER:
 						case Renderer::ResourceType::UNIFORM_BUFFER:
+						case Renderer::ResourceType::INDIRECT_BUFFER:
 						case Renderer::ResourceType::TEXTURE_BUFFER:
 						case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 						case Renderer::ResourceType::RASTERIZER_STATE:
@@ -131,8 +132,10 @@ namespace Direct3D10Renderer
 						case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 						case Renderer::ResourceType::GEOMETRY_SHADER:
 						case Renderer::ResourceType::FRAGMENT_SHADER:
+						case Renderer::ResourceType::COMPUTE_SHADER:
 						case Renderer::ResourceType::TEXTURE_COLLECTION:
 						case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+						case Renderer::ResourceType::FENCE:
 						default:
 							RENDERER_OUTPUT_DEBUG_PRINTF("Direct3D 10 error: The type of the given color texture at index %d is not supported", colorTexture - colorTextures)
 							*d3d10RenderTargetView = nullptr;
@@ -179,7 +182,7 @@ namespace Direct3D10Renderer
 					// Create the Direct3D 10 render target view instance
 					D3D10_DEPTH_STENCIL_VIEW_DESC d3d10DepthStencilViewDesc;
 					d3d10DepthStencilViewDesc.Format			 = d3d10Texture2DDesc.Format;
-					d3d10DepthStencilViewDesc.ViewDimension		 = D3D10_DSV_DIMENSION_TEXTURE2D;
+					d3d10DepthStencilViewDesc.ViewDimension		 = (d3d10Texture2DDesc.SampleDesc.Count > 1) ? D3D10_DSV_DIMENSION_TEXTURE2DMS : D3D10_DSV_DIMENSION_TEXTURE2D;
 					d3d10DepthStencilViewDesc.Texture2D.MipSlice = 0;
 					direct3D10Renderer.getD3D10Device()->CreateDepthStencilView(d3d10Resource, &d3d10DepthStencilViewDesc, &mD3D10DepthStencilView);
 
@@ -195,6 +198,7 @@ namespace Direct3D10Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::TEXTURE_BUFFER:
 				case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 				case Renderer::ResourceType::RASTERIZER_STATE:
@@ -206,8 +210,10 @@ namespace Direct3D10Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					RENDERER_OUTPUT_DEBUG_STRING("Direct3D 10 error: The type of the given depth stencil texture is not supported")
 					break;
@@ -251,7 +257,7 @@ namespace Direct3D10Renderer
 			}
 
 			// Cleanup
-			delete [] mD3D10RenderTargetViews;
+			getRenderer().getAllocator().deallocateArray(mD3D10RenderTargetViews, Renderer::AllocationTag::RESOURCE);
 		}
 		if (nullptr != mColorTextures)
 		{
@@ -267,7 +273,7 @@ namespace Direct3D10Renderer
 			}
 
 			// Cleanup
-			delete [] mColorTextures;
+			getRenderer().getAllocator().deallocateArray(mColorTextures, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Release the reference to the used depth stencil texture
@@ -292,7 +298,7 @@ namespace Direct3D10Renderer
 		#ifndef DIRECT3D10RENDERER_NO_DEBUG
 			{ // Assign a debug name to the Direct3D 10 render target view, do also add the index to the name
 				const size_t nameLength = strlen(name) + 5;	// Direct3D 10 supports 8 render targets ("D3D10_SIMULTANEOUS_RENDER_TARGET_COUNT", so: One digit + one [ + one ] + one space + terminating zero = 5 characters)
-				char *nameWithIndex = new char[nameLength];
+				char *nameWithIndex = getRenderer().getAllocator().allocateArray<char>(nameLength, Renderer::AllocationTag::TEMPORARY);
 				ID3D10RenderTargetView **d3d10RenderTargetViewsEnd = mD3D10RenderTargetViews + mNumberOfColorTextures;
 				for (ID3D10RenderTargetView **d3d10RenderTargetView = mD3D10RenderTargetViews; d3d10RenderTargetView < d3d10RenderTargetViewsEnd; ++d3d10RenderTargetView)
 				{
@@ -302,7 +308,7 @@ namespace Direct3D10Renderer
 					(*d3d10RenderTargetView)->SetPrivateData(WKPDID_D3DDebugObjectName, 0, nullptr);
 					(*d3d10RenderTargetView)->SetPrivateData(WKPDID_D3DDebugObjectName, nameLength, nameWithIndex);
 				}
-				delete [] nameWithIndex;
+				getRenderer().getAllocator().deallocateArray(nameWithIndex, Renderer::AllocationTag::TEMPORARY);
 			}
 
 			// Assign a debug name to the Direct3D 10 depth stencil view
@@ -47,6 +47,9 @@ namespace Direct3D10Renderer
 		mD3D10Buffer(nullptr),
 		mDXGIFormat(DXGI_FORMAT_UNKNOWN)
 	{
+		// Set the estimated number of bytes of the index buffer
+		setNumberOfBytes(numberOfBytes);
+
 		// "Renderer::IndexBufferFormat::UNSIGNED_CHAR" is not supported by Direct3D 10
 		if (Renderer::IndexBufferFormat::UNSIGNED_CHAR == indexBufferFormat)
 		{
@@ -108,6 +111,9 @@ namespace Direct3D10Renderer
 	//[-------------------------------------------------------]
 	void IndexBuffer::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D10RENDERER_NO_DEBUG
 			// Valid Direct3D 10 index buffer?
 			if (nullptr != mD3D10Buffer)
@@ -26,6 +26,7 @@
 #include "Direct3D10Renderer/IndexBuffer.h"
 #include "Direct3D10Renderer/VertexBuffer.h"
 #include "Direct3D10Renderer/VertexShaderCg.h"
+#include "Direct3D10Renderer/Direct3D10Renderer.h"
 #include "Direct3D10Renderer/GeometryShaderCg.h"
 #include "Direct3D10Renderer/FragmentShaderCg.h"
 #include "Direct3D10Renderer/CgRuntimeLinking.h"
@@ -100,7 +101,7 @@ namespace Direct3D10Renderer
 		if (nullptr != mVertexShaderCg && nullptr != mVertexShaderCg->getD3DBlobVertexShader())
 		{
 			// TODO(co) Add security check: Is the given resource one of the currently used renderer?
-			return new VertexArray(*mDirect3D10Renderer, *mVertexShaderCg->getD3DBlobVertexShader(), numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
+			return new (mDirect3D10Renderer->getAllocator()) VertexArray(*mDirect3D10Renderer, *mVertexShaderCg->getD3DBlobVertexShader(), numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
 		}
 		else
 		{
@@ -100,7 +100,7 @@ namespace Direct3D10Renderer
 		if (nullptr != mVertexShaderHlsl && nullptr != mVertexShaderHlsl->getD3DBlobVertexShader())
 		{
 			// TODO(co) Add security check: Is the given resource one of the currently used renderer?
-			return new VertexArray(*mDirect3D10Renderer, *mVertexShaderHlsl->getD3DBlobVertexShader(), numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
+			return new (mDirect3D10Renderer->getAllocator()) VertexArray(*mDirect3D10Renderer, *mVertexShaderHlsl->getD3DBlobVertexShader(), numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
 		}
 		else
 		{
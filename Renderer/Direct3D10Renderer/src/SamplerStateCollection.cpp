@@ -43,8 +43,8 @@ namespace Direct3D10Renderer
 	SamplerStateCollection::SamplerStateCollection(Direct3D10Renderer &direct3D10Renderer, unsigned int numberOfSamplerStates, Renderer::ISamplerState **samplerStates) :
 		Renderer::ISamplerStateCollection(direct3D10Renderer),
 		mNumberOfD3D10SamplerStates(numberOfSamplerStates),
-		mD3D10SamplerStates((numberOfSamplerStates > 0) ? new ID3D10SamplerState*[numberOfSamplerStates] : nullptr),
-		mSamplerStates((numberOfSamplerStates > 0) ? new Renderer::ISamplerState*[numberOfSamplerStates] : nullptr)
+		mD3D10SamplerStates(direct3D10Renderer.getAllocator().allocateArray<ID3D10SamplerState*>(numberOfSamplerStates, Renderer::AllocationTag::RESOURCE)),
+		mSamplerStates(direct3D10Renderer.getAllocator().allocateArray<Renderer::ISamplerState*>(numberOfSamplerStates, Renderer::AllocationTag::RESOURCE))
 	{
 		// Loop through all given textures and gather the Direct3D 10 shader resource views
 		ID3D10SamplerState		**currentD3D10SamplerState = mD3D10SamplerStates;
@@ -84,7 +84,7 @@ namespace Direct3D10Renderer
 		// Release the allocated memory
 		if (nullptr != mD3D10SamplerStates)
 		{
-			delete [] mD3D10SamplerStates;
+			getRenderer().getAllocator().deallocateArray(mD3D10SamplerStates, Renderer::AllocationTag::RESOURCE);
 		}
 		if (nullptr != mSamplerStates)
 		{
@@ -97,7 +97,7 @@ namespace Direct3D10Renderer
 			}
 
 			// Release the allocated memory
-			delete [] mSamplerStates;
+			getRenderer().getAllocator().deallocateArray(mSamplerStates, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
@@ -30,6 +30,8 @@
 #include "Direct3D10Renderer/FragmentShaderCg.h"
 #include "Direct3D10Renderer/Direct3D10Renderer.h"
 
+#include <Renderer/IComputeShader.h>
+
 __pragma(warning(push))
 	__pragma(warning(disable: 4668))	// warning C4668: '<x>' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
 	#include <Cg/cgD3D10.h>
@@ -102,7 +104,7 @@ namespace Direct3D10Renderer
 
 	Renderer::IVertexShader *ShaderLanguageCg::createVertexShader(const char *sourceCode, const char *, const char *, const char *)
 	{
-		return (nullptr != mCgContext) ? new VertexShaderCg(getDirect3D10Renderer(), *mCgContext, sourceCode) : nullptr;
+		return (nullptr != mCgContext) ? new (getDirect3D10Renderer().getAllocator()) VertexShaderCg(getDirect3D10Renderer(), *mCgContext, sourceCode) : nullptr;
 	}
 
 	Renderer::ITessellationControlShader *ShaderLanguageCg::createTessellationControlShader(const char *, const char *, const char *, const char *)
@@ -119,12 +121,12 @@ namespace Direct3D10Renderer
 
 	Renderer::IGeometryShader *ShaderLanguageCg::createGeometryShader(const char *sourceCode, Renderer::GsInputPrimitiveTopology::Enum, Renderer::GsOutputPrimitiveTopology::Enum, unsigned int, const char *, const char *, const char *)
 	{
-		return (nullptr != mCgContext) ? new GeometryShaderCg(getDirect3D10Renderer(), *mCgContext, sourceCode) : nullptr;
+		return (nullptr != mCgContext) ? new (getDirect3D10Renderer().getAllocator()) GeometryShaderCg(getDirect3D10Renderer(), *mCgContext, sourceCode) : nullptr;
 	}
 
 	Renderer::IFragmentShader *ShaderLanguageCg::createFragmentShader(const char *sourceCode, const char *, const char *, const char *)
 	{
-		return (nullptr != mCgContext) ? new FragmentShaderCg(getDirect3D10Renderer(), *mCgContext, sourceCode) : nullptr;
+		return (nullptr != mCgContext) ? new (getDirect3D10Renderer().getAllocator()) FragmentShaderCg(getDirect3D10Renderer(), *mCgContext, sourceCode) : nullptr;
 	}
 
 	Renderer::IProgram *ShaderLanguageCg::createProgram(Renderer::IVertexShader *vertexShader, Renderer::ITessellationControlShader *tessellationControlShader, Renderer::ITessellationEvaluationShader *tessellationEvaluationShader, Renderer::IGeometryShader *geometryShader, Renderer::IFragmentShader *fragmentShader)
@@ -159,7 +161,7 @@ namespace Direct3D10Renderer
 			else
 			{
 				// Create the program instance
-				return new ProgramCg(getDirect3D10Renderer(), static_cast<VertexShaderCg*>(vertexShader), static_cast<GeometryShaderCg*>(geometryShader), static_cast<FragmentShaderCg*>(fragmentShader));
+				return new (getDirect3D10Renderer().getAllocator()) ProgramCg(getDirect3D10Renderer(), static_cast<VertexShaderCg*>(vertexShader), static_cast<GeometryShaderCg*>(geometryShader), static_cast<FragmentShaderCg*>(fragmentShader));
 			}
 
 			// Error! Shader language mismatch!
@@ -185,6 +187,24 @@ namespace Direct3D10Renderer
 		return nullptr;
 	}
 
+	Renderer::IComputeShader *ShaderLanguageCg::createComputeShader(const char *, const char *, const char *, const char *)
+	{
+		// Error! Direct3D 10 has no compute shader support.
+		return nullptr;
+	}
+
+	Renderer::IProgram *ShaderLanguageCg::createComputeProgram(Renderer::IComputeShader *computeShader)
+	{
+		// Error! Direct3D 10 has no compute shader support.
+		// -> Ensure a correct reference counter behaviour, even in the situation of an error
+		if (nullptr != computeShader)
+		{
+			computeShader->addReference();
+			computeShader->release();
+		}
+		return nullptr;
+	}
+
 	Renderer::IUniformBuffer *ShaderLanguageCg::createUniformBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
 		// There's no point in creating a special "UniformBufferCg"-version (tried it at first)
@@ -193,7 +213,7 @@ namespace Direct3D10Renderer
 		//    "When the next program bind operation occurs, each buffer index which is set to a valid buffer handle is bound (along with the program) for use by the 3D API"
 		//    -> This behaviour is not handy, asking Cg for the Direct3D 11 buffer and using it directly is not really working as well
 		//    -> Save us all the trouble and just use Direct3D 11 uniform buffers directly, issues resolved
-		return new UniformBuffer(getDirect3D10Renderer(), numberOfBytes, data, bufferUsage);
+		return new (getDirect3D10Renderer().getUniformBufferPool()) UniformBuffer(getDirect3D10Renderer(), numberOfBytes, data, bufferUsage);
 	}
 
 
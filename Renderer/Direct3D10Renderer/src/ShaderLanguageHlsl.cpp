@@ -30,6 +30,8 @@
 #include "Direct3D10Renderer/FragmentShaderHlsl.h"
 #include "Direct3D10Renderer/Direct3D10RuntimeLinking.h"
 
+#include <Renderer/IComputeShader.h>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -118,7 +120,7 @@ namespace Direct3D10Renderer
 	Renderer::IVertexShader *ShaderLanguageHlsl::createVertexShader(const char *sourceCode, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::vertexShader", we know there's vertex shader support
-		return new VertexShaderHlsl(getDirect3D10Renderer(), sourceCode);
+		return new (getDirect3D10Renderer().getAllocator()) VertexShaderHlsl(getDirect3D10Renderer(), sourceCode);
 	}
 
 	Renderer::ITessellationControlShader *ShaderLanguageHlsl::createTessellationControlShader(const char *, const char *, const char *, const char *)
@@ -140,13 +142,13 @@ namespace Direct3D10Renderer
 		// Ignore "numberOfOutputVertices", it's directly set within HLSL
 
 		// There's no need to check for "Renderer::Capabilities::maximumNumberOfGsOutputVertices", we know there's geometry shader support
-		return new GeometryShaderHlsl(getDirect3D10Renderer(), sourceCode);
+		return new (getDirect3D10Renderer().getAllocator()) GeometryShaderHlsl(getDirect3D10Renderer(), sourceCode);
 	}
 
 	Renderer::IFragmentShader *ShaderLanguageHlsl::createFragmentShader(const char *sourceCode, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::fragmentShader", we know there's fragment shader support
-		return new FragmentShaderHlsl(getDirect3D10Renderer(), sourceCode);
+		return new (getDirect3D10Renderer().getAllocator()) FragmentShaderHlsl(getDirect3D10Renderer(), sourceCode);
 	}
 
 	Renderer::IProgram *ShaderLanguageHlsl::createProgram(Renderer::IVertexShader *vertexShader, Renderer::ITessellationControlShader *tessellationControlShader, Renderer::ITessellationEvaluationShader *tessellationEvaluationShader, Renderer::IGeometryShader *geometryShader, Renderer::IFragmentShader *fragmentShader)
@@ -178,7 +180,7 @@ namespace Direct3D10Renderer
 		else
 		{
 			// Create the program
-			return new ProgramHlsl(getDirect3D10Renderer(), static_cast<VertexShaderHlsl*>(vertexShader), static_cast<GeometryShaderHlsl*>(geometryShader), static_cast<FragmentShaderHlsl*>(fragmentShader));
+			return new (getDirect3D10Renderer().getAllocator()) ProgramHlsl(getDirect3D10Renderer(), static_cast<VertexShaderHlsl*>(vertexShader), static_cast<GeometryShaderHlsl*>(geometryShader), static_cast<FragmentShaderHlsl*>(fragmentShader));
 		}
 
 		// Error! Shader language mismatch!
@@ -203,9 +205,27 @@ namespace Direct3D10Renderer
 		return nullptr;
 	}
 
+	Renderer::IComputeShader *ShaderLanguageHlsl::createComputeShader(const char *, const char *, const char *, const char *)
+	{
+		// Error! Direct3D 10 has no compute shader support.
+		return nullptr;
+	}
+
+	Renderer::IProgram *ShaderLanguageHlsl::createComputeProgram(Renderer::IComputeShader *computeShader)
+	{
+		// Error! Direct3D 10 has no compute shader support.
+		// -> Ensure a correct reference counter behaviour, even in the situation of an error
+		if (nullptr != computeShader)
+		{
+			computeShader->addReference();
+			computeShader->release();
+		}
+		return nullptr;
+	}
+
 	Renderer::IUniformBuffer *ShaderLanguageHlsl::createUniformBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
-		return new UniformBuffer(getDirect3D10Renderer(), numberOfBytes, data, bufferUsage);
+		return new (getDirect3D10Renderer().getUniformBufferPool()) UniformBuffer(getDirect3D10Renderer(), numberOfBytes, data, bufferUsage);
 	}
 
 
@@ -45,7 +45,9 @@ namespace Direct3D10Renderer
 		ISwapChain(direct3D10Renderer),
 		mDxgiSwapChain(nullptr),
 		mD3D10RenderTargetView(nullptr),
-		mD3D10DepthStencilView(nullptr)
+		mD3D10DepthStencilView(nullptr),
+		mSwapInterval(0),
+		mFramePacer(direct3D10Renderer)
 	{
 		// Get the Direct3D 10 device instance
 		ID3D10Device *d3d10Device = direct3D10Renderer.getD3D10Device();
@@ -159,6 +161,9 @@ namespace Direct3D10Renderer
 	//[-------------------------------------------------------]
 	void SwapChain::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D10RENDERER_NO_DEBUG
 			// Assign a debug name to the DXGI swap chain
 			if (nullptr != mDxgiSwapChain)
@@ -265,7 +270,9 @@ namespace Direct3D10Renderer
 		// Is there a valid swap chain?
 		if (nullptr != mDxgiSwapChain)
 		{
-			mDxgiSwapChain->Present(0, 0);
+			mFramePacer.beginPresent();
+			mDxgiSwapChain->Present(static_cast<UINT>(mSwapInterval), 0);
+			mFramePacer.endPresent();
 		}
 	}
 
@@ -345,6 +352,46 @@ namespace Direct3D10Renderer
 		}
 	}
 
+	int SwapChain::getSwapInterval() const
+	{
+		return mSwapInterval;
+	}
+
+	bool SwapChain::setSwapInterval(int swapInterval)
+	{
+		// DXGI 1.0 has no adaptive vertical synchronization, fall back to regular vertical synchronization
+		if (swapInterval < 0)
+		{
+			swapInterval = -swapInterval;
+		}
+
+		// "IDXGISwapChain::Present()" accepts sync intervals between 0 and 4
+		if (swapInterval > 4)
+		{
+			// Error!
+			return false;
+		}
+
+		// Done
+		mSwapInterval = swapInterval;
+		return true;
+	}
+
+	unsigned int SwapChain::getMaximumFrameLatency() const
+	{
+		return mFramePacer.getMaximumFrameLatency();
+	}
+
+	void SwapChain::setMaximumFrameLatency(unsigned int maximumFrameLatency)
+	{
+		mFramePacer.setMaximumFrameLatency(maximumFrameLatency);
+	}
+
+	const Renderer::PresentStatistics &SwapChain::getPresentStatistics() const
+	{
+		return mFramePacer.getPresentStatistics();
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -406,6 +453,10 @@ namespace Direct3D10Renderer
 				UINT height = 1;
 				getSafeWidthAndHeight(width, height);
 
+				// Set the estimated number of bytes of the swap chain
+				// -> Back buffer with 32 bit color and a 32 bit depth stencil buffer
+				setNumberOfBytes(static_cast<unsigned long long>(width) * height * (4 + 4));
+
 				// Create depth stencil texture
 				ID3D10Texture2D *d3d10Texture2DDepthStencil = nullptr;
 				D3D10_TEXTURE2D_DESC d3d10Texture2DDesc;
@@ -44,8 +44,12 @@ namespace Direct3D10Renderer
 	*/
 	Texture2DArray::Texture2DArray(Direct3D10Renderer &direct3D10Renderer, unsigned int width, unsigned int height, unsigned int numberOfSlices, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage) :
 		ITexture2DArray(direct3D10Renderer, width, height, numberOfSlices),
-		mD3D10ShaderResourceViewTexture(nullptr)
+		mD3D10ShaderResourceViewTexture(nullptr),
+		mTextureFormat(textureFormat)
 	{
+		// Set the estimated number of bytes of the texture array
+		setNumberOfBytes(calculateNumberOfBytes(width, height, numberOfSlices, Mapping::getDirect3D10Size(textureFormat), 0 != (flags & Renderer::TextureFlag::MIPMAPS), 1));
+
 		// Begin debug event
 		RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(&direct3D10Renderer)
 
@@ -144,6 +148,9 @@ namespace Direct3D10Renderer
 	//[-------------------------------------------------------]
 	void Texture2DArray::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D10RENDERER_NO_DEBUG
 			// Valid Direct3D 10 shader resource view?
 			if (nullptr != mD3D10ShaderResourceViewTexture)
@@ -174,6 +181,39 @@ namespace Direct3D10Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2DArray methods      ]
+	//[-------------------------------------------------------]
+	void Texture2DArray::updateRegion(unsigned int mipmap, unsigned int slice, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data)
+	{
+		// Valid Direct3D 10 shader resource view and data given?
+		if (nullptr != mD3D10ShaderResourceViewTexture && nullptr != data && slice < getNumberOfSlices())
+		{
+			// Get the Direct3D 10 resource referenced by the Direct3D resource view
+			ID3D10Resource *d3d10Resource = nullptr;
+			mD3D10ShaderResourceViewTexture->GetResource(&d3d10Resource);
+			if (nullptr != d3d10Resource)
+			{
+				// Get the number of mipmaps
+				D3D10_SHADER_RESOURCE_VIEW_DESC d3d10ShaderResourceViewDesc;
+				mD3D10ShaderResourceViewTexture->GetDesc(&d3d10ShaderResourceViewDesc);
+				const unsigned int numberOfMipmaps = d3d10ShaderResourceViewDesc.Texture2DArray.MipLevels;
+				if (mipmap < numberOfMipmaps)
+				{
+					// Update Direct3D 10 subresource data of the given region
+					const D3D10_BOX d3d10Box = { x, y, 0, x + width, y + height, 1 };
+					const unsigned int bytesPerRow   = width * Mapping::getDirect3D10Size(mTextureFormat);
+					const unsigned int bytesPerSlice = bytesPerRow * height;
+					static_cast<Direct3D10Renderer&>(getRenderer()).getD3D10Device()->UpdateSubresource(d3d10Resource, D3D10CalcSubresource(mipmap, slice, numberOfMipmaps), &d3d10Box, data, bytesPerRow, bytesPerSlice);
+				}
+
+				// Release the Direct3D 10 resource instance
+				d3d10Resource->Release();
+			}
+		}
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -47,6 +47,9 @@ namespace Direct3D10Renderer
 		mD3D10Buffer(nullptr),
 		mD3D10ShaderResourceViewTexture(nullptr)
 	{
+		// Set the estimated number of bytes of the texture buffer
+		setNumberOfBytes(numberOfBytes);
+
 		{ // Buffer part
 			// Direct3D 10 buffer description
 			D3D10_BUFFER_DESC d3d10BufferDesc;
@@ -117,6 +120,9 @@ namespace Direct3D10Renderer
 	//[-------------------------------------------------------]
 	void TextureBuffer::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D10RENDERER_NO_DEBUG
 			// Assign a debug name to the shader resource view
 			if (nullptr != mD3D10ShaderResourceViewTexture)
@@ -68,7 +68,7 @@ namespace Direct3D10Renderer
 		// Add a reference to the used vertex buffers
 		if (numberOfAttributes > 0)
 		{
-			mVertexBuffers = new VertexBuffer*[numberOfAttributes];
+			mVertexBuffers = getRenderer().getAllocator().allocateArray<VertexBuffer*>(numberOfAttributes, Renderer::AllocationTag::RESOURCE);
 
 			// Loop through all attributes
 			VertexBuffer **vertexBuffers = mVertexBuffers;
@@ -93,7 +93,7 @@ namespace Direct3D10Renderer
 		// -> Direct3D 10 don't like it when the first parameter of "D3D10Device::CreateInputLayout()" is a null pointer:
 		//      "D3D10: ERROR: ID3D10Device::CreateInputLayout: NULL pDesc specified! [ STATE_CREATION ERROR #164: CREATEINPUTLAYOUT_NULLDESC ]"
 		//    Handle this case.
-		D3D10_INPUT_ELEMENT_DESC *d3d10InputElementDescs   = numberOfAttributes ? new D3D10_INPUT_ELEMENT_DESC[numberOfAttributes] : new D3D10_INPUT_ELEMENT_DESC[1];
+		D3D10_INPUT_ELEMENT_DESC *d3d10InputElementDescs   = getRenderer().getAllocator().allocateArray<D3D10_INPUT_ELEMENT_DESC>(numberOfAttributes ? numberOfAttributes : 1, Renderer::AllocationTag::TEMPORARY);
 		D3D10_INPUT_ELEMENT_DESC *d3d10InputElementDesc    = d3d10InputElementDescs;
 		D3D10_INPUT_ELEMENT_DESC *d3d10InputElementDescEnd = d3d10InputElementDescs + numberOfAttributes;
 		for (; d3d10InputElementDesc < d3d10InputElementDescEnd; ++d3d10InputElementDesc, ++attributes)
@@ -131,7 +131,7 @@ namespace Direct3D10Renderer
 				else
 				{
 					// Error! Clean up and get us out of here right now!
-					delete [] d3d10InputElementDescs;
+					getRenderer().getAllocator().deallocateArray(d3d10InputElementDescs, Renderer::AllocationTag::TEMPORARY);
 					return;	// Ugly return, but we haven't much choice in here
 				}
 			}
@@ -160,7 +160,7 @@ namespace Direct3D10Renderer
 		direct3D10Renderer.getD3D10Device()->CreateInputLayout(d3d10InputElementDescs, numberOfAttributes, d3dBlob.GetBufferPointer(), d3dBlob.GetBufferSize(), &mD3D10InputLayout);
 
 		// Destroy Direct3D 10 input element descriptions
-		delete [] d3d10InputElementDescs;
+		getRenderer().getAllocator().deallocateArray(d3d10InputElementDescs, Renderer::AllocationTag::TEMPORARY);
 
 		// Valid Direct3D 10 input layout?
 		if (nullptr != mD3D10InputLayout && numberOfAttributes > 0)
@@ -169,15 +169,15 @@ namespace Direct3D10Renderer
 			mNumberOfSlots = numberOfUsedSlots;
 
 			// Buffers
-			mD3D10Buffers = new ID3D10Buffer*[mNumberOfSlots];
+			mD3D10Buffers = getRenderer().getAllocator().allocateArray<ID3D10Buffer*>(mNumberOfSlots, Renderer::AllocationTag::RESOURCE);
 			memcpy(mD3D10Buffers, d3d10BufferAtSlot, sizeof(ID3D10Buffer*) * mNumberOfSlots);
 
 			// Strides
-			mStrides = new UINT[mNumberOfSlots];
+			mStrides = getRenderer().getAllocator().allocateArray<UINT>(mNumberOfSlots, Renderer::AllocationTag::RESOURCE);
 			memcpy(mStrides, strideAtSlot, sizeof(UINT) * mNumberOfSlots);
 
 			// Offsets
-			mOffsets = new UINT[mNumberOfSlots];
+			mOffsets = getRenderer().getAllocator().allocateArray<UINT>(mNumberOfSlots, Renderer::AllocationTag::RESOURCE);
 			memset(mOffsets, 0, sizeof(UINT) * mNumberOfSlots);
 		}
 
@@ -208,9 +208,9 @@ namespace Direct3D10Renderer
 		// Cleanup Direct3D 10 input slot data
 		if (nullptr != mD3D10Buffers)
 		{
-			delete [] mD3D10Buffers;
-			delete [] mStrides;
-			delete [] mOffsets;
+			getRenderer().getAllocator().deallocateArray(mD3D10Buffers, Renderer::AllocationTag::RESOURCE);
+			getRenderer().getAllocator().deallocateArray(mStrides, Renderer::AllocationTag::RESOURCE);
+			getRenderer().getAllocator().deallocateArray(mOffsets, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Release the reference to the used vertex buffers
@@ -224,7 +224,7 @@ namespace Direct3D10Renderer
 			}
 
 			// Cleanup
-			delete [] mVertexBuffers;
+			getRenderer().getAllocator().deallocateArray(mVertexBuffers, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Release our Direct3D 10 device reference
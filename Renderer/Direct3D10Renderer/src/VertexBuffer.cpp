@@ -46,6 +46,9 @@ namespace Direct3D10Renderer
 		IVertexBuffer(direct3D10Renderer),
 		mD3D10Buffer(nullptr)
 	{
+		// Set the estimated number of bytes of the vertex buffer
+		setNumberOfBytes(numberOfBytes);
+
 		// Direct3D 10 buffer description
 		D3D10_BUFFER_DESC d3d10BufferDesc;
 		d3d10BufferDesc.ByteWidth        = numberOfBytes;
@@ -96,6 +99,9 @@ namespace Direct3D10Renderer
 	//[-------------------------------------------------------]
 	void VertexBuffer::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D10RENDERER_NO_DEBUG
 			// Valid Direct3D 10 vertex buffer?
 			if (nullptr != mD3D10Buffer)
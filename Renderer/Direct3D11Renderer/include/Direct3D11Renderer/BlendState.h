@@ -60,7 +60,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Direct3D 11 blend state class
 	*/
-	class BlendState : public Renderer::IBlendState
+	class BlendState final : public Renderer::IBlendState
 	{
 
 
@@ -733,6 +733,20 @@ enum D3D11_CPU_ACCESS_FLAG
 	D3D11_CPU_ACCESS_READ	= 0x20000L
 };
 
+// "Microsoft DirectX SDK (June 2010)" -> "D3D11.h"
+enum D3D11_RESOURCE_MISC_FLAG
+{
+	D3D11_RESOURCE_MISC_GENERATE_MIPS					= 0x1L,
+	D3D11_RESOURCE_MISC_SHARED							= 0x2L,
+	D3D11_RESOURCE_MISC_TEXTURECUBE						= 0x4L,
+	D3D11_RESOURCE_MISC_DRAWINDIRECT_ARGS				= 0x10L,
+	D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS			= 0x20L,
+	D3D11_RESOURCE_MISC_BUFFER_STRUCTURED				= 0x40L,
+	D3D11_RESOURCE_MISC_RESOURCE_CLAMP					= 0x80L,
+	D3D11_RESOURCE_MISC_SHARED_KEYEDMUTEX				= 0x100L,
+	D3D11_RESOURCE_MISC_GDI_COMPATIBLE					= 0x200L
+};
+
 // "Microsoft DirectX SDK (June 2010)" -> "D3D11.h"
 struct D3D11_BUFFER_DESC
 {
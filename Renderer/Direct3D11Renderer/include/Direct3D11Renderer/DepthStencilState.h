@@ -60,7 +60,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Direct3D 11 depth stencil state class
 	*/
-	class DepthStencilState : public Renderer::IDepthStencilState
+	class DepthStencilState final : public Renderer::IDepthStencilState
 	{
 
 
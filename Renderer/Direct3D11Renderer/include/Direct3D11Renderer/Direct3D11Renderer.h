@@ -30,6 +30,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <Renderer/IRenderer.h>
+#include <Renderer/ResourcePool.h>
 
 
 //[-------------------------------------------------------]
@@ -67,7 +68,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Direct3D 11 renderer class
 	*/
-	class Direct3D11Renderer : public Renderer::IRenderer
+	class Direct3D11Renderer final : public Renderer::IRenderer
 	{
 
 
@@ -81,11 +82,13 @@ namespace Direct3D11Renderer
 		*
 		*  @param[in] nativeWindowHandle
 		*    Optional native main window handle, can be a null handle
+		*  @param[in] allocator
+		*    Allocator to use, can be a null pointer ("Renderer::DefaultAllocator" is used in this case), must stay valid as long as the renderer instance exists
 		*
 		*  @note
 		*    - Do never ever use a not properly initialized renderer! Use "Renderer::IRenderer::isInitialized()" to check the initialization state.
 		*/
-		explicit Direct3D11Renderer(handle nativeWindowHandle);
+		Direct3D11Renderer(handle nativeWindowHandle, Renderer::IAllocator *allocator);
 
 		/**
 		*  @brief
@@ -111,6 +114,15 @@ namespace Direct3D11Renderer
 		*/
 		inline ID3D11DeviceContext *getD3D11DeviceContext() const;
 
+		/**
+		*  @brief
+		*    Return the pool for the uniform buffer instances
+		*
+		*  @return
+		*    The pool for the uniform buffer instances, used by the shader languages which are creating the uniform buffers
+		*/
+		inline Renderer::ResourcePool &getUniformBufferPool();
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IRenderer methods            ]
@@ -133,7 +145,8 @@ namespace Direct3D11Renderer
 		virtual Renderer::IVertexBuffer *createVertexBuffer(unsigned int numberOfBytes, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
 		virtual Renderer::IIndexBuffer *createIndexBuffer(unsigned int numberOfBytes, Renderer::IndexBufferFormat::Enum indexBufferFormat, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
 		virtual Renderer::ITextureBuffer *createTextureBuffer(unsigned int numberOfBytes, Renderer::TextureFormat::Enum textureFormat, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
-		virtual Renderer::ITexture2D *createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, Renderer::TextureUsage::Enum textureUsage = Renderer::TextureUsage::DEFAULT) override;
+		virtual Renderer::IIndirectBuffer *createIndirectBuffer(unsigned int numberOfBytes, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
+		virtual Renderer::ITexture2D *createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, Renderer::TextureUsage::Enum textureUsage = Renderer::TextureUsage::DEFAULT, unsigned int numberOfMultisamples = 1) override;
 		virtual Renderer::ITexture2DArray *createTexture2DArray(unsigned int width, unsigned int height, unsigned int numberOfSlices, Renderer::TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, Renderer::TextureUsage::Enum textureUsage = Renderer::TextureUsage::DEFAULT) override;
 		virtual Renderer::IRasterizerState *createRasterizerState(const Renderer::RasterizerState &rasterizerState) override;
 		virtual Renderer::IDepthStencilState *createDepthStencilState(const Renderer::DepthStencilState &depthStencilState) override;
@@ -146,6 +159,8 @@ namespace Direct3D11Renderer
 		//[-------------------------------------------------------]
 		virtual bool map(Renderer::IResource &resource, unsigned int subresource, Renderer::MapType::Enum mapType, unsigned int mapFlags, Renderer::MappedSubresource &mappedSubresource) override;
 		virtual void unmap(Renderer::IResource &resource, unsigned int subresource) override;
+		virtual bool copyResource(Renderer::IResource &destinationResource, Renderer::IResource &sourceResource) override;
+		virtual void setTextureResident(Renderer::ITexture &texture, Renderer::ISamplerState *samplerState, bool resident) override;
 		//[-------------------------------------------------------]
 		//[ States                                                ]
 		//[-------------------------------------------------------]
@@ -188,6 +203,12 @@ namespace Direct3D11Renderer
 		virtual void gsSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection) override;
 		virtual void gsSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer) override;
 		//[-------------------------------------------------------]
+		//[ Stream-output (SO) stage                              ]
+		//[-------------------------------------------------------]
+		virtual void soSetTargets(unsigned int numberOfTargets, Renderer::IVertexBuffer **vertexBuffers, const unsigned int *offsets = nullptr) override;
+		virtual void soBegin(Renderer::PrimitiveTopology::Enum primitiveTopology, bool rasterizerDiscard = true) override;
+		virtual void soEnd() override;
+		//[-------------------------------------------------------]
 		//[ Rasterizer (RS) stage                                 ]
 		//[-------------------------------------------------------]
 		virtual void rsSetViewports(unsigned int numberOfViewports, const Renderer::Viewport *viewports) override;
@@ -209,11 +230,21 @@ namespace Direct3D11Renderer
 		virtual void omSetDepthStencilState(Renderer::IDepthStencilState *depthStencilState) override;
 		virtual void omSetBlendState(Renderer::IBlendState *blendState) override;
 		//[-------------------------------------------------------]
+		//[ Compute-shader (CS) stage                             ]
+		//[-------------------------------------------------------]
+		virtual void csSetTexture(unsigned int unit, Renderer::ITexture *texture) override;
+		virtual void csSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection) override;
+		virtual void csSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState) override;
+		virtual void csSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection) override;
+		virtual void csSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer) override;
+		virtual void csSetUnorderedAccessView(unsigned int unit, Renderer::IResource *resource) override;
+		//[-------------------------------------------------------]
 		//[ Operations                                            ]
 		//[-------------------------------------------------------]
 		virtual void clear(unsigned int flags, const float color[4], float z, unsigned int stencil) override;
 		virtual bool beginScene() override;
 		virtual void endScene() override;
+		virtual void resolveMultisampleFramebuffer(Renderer::IRenderTarget &destinationRenderTarget, Renderer::IFramebuffer &sourceMultisampleFramebuffer) override;
 		//[-------------------------------------------------------]
 		//[ Draw call                                             ]
 		//[-------------------------------------------------------]
@@ -221,12 +252,26 @@ namespace Direct3D11Renderer
 		virtual void drawInstanced(unsigned int startVertexLocation, unsigned int numberOfVertices, unsigned int numberOfInstances) override;
 		virtual void drawIndexed(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int minimumIndex, unsigned int numberOfVertices) override;
 		virtual void drawIndexedInstanced(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int minimumIndex, unsigned int numberOfVertices, unsigned int numberOfInstances) override;
+		virtual void multiDrawIndexedIndirect(Renderer::IIndirectBuffer &indirectBuffer, unsigned int indirectBufferOffset = 0, unsigned int numberOfDraws = 1) override;
+		virtual void drawAuto() override;
+		//[-------------------------------------------------------]
+		//[ Compute                                               ]
+		//[-------------------------------------------------------]
+		virtual void dispatch(unsigned int groupCountX, unsigned int groupCountY, unsigned int groupCountZ) override;
+		virtual void memoryBarrier(unsigned int flags) override;
 		//[-------------------------------------------------------]
 		//[ Synchronization                                       ]
 		//[-------------------------------------------------------]
+		virtual Renderer::IFence *insertFence() override;
+		virtual bool isFenceSignaled(Renderer::IFence &fence) override;
+		virtual bool waitFence(Renderer::IFence &fence, unsigned int timeout = ~0u) override;
 		virtual void flush() override;
 		virtual void finish() override;
 		//[-------------------------------------------------------]
+		//[ Swap chain                                            ]
+		//[-------------------------------------------------------]
+		virtual void presentSwapChains(unsigned int numberOfSwapChains, Renderer::ISwapChain **swapChains) override;
+		//[-------------------------------------------------------]
 		//[ Debug                                                 ]
 		//[-------------------------------------------------------]
 		virtual bool isDebugEnabled() override;
@@ -265,6 +310,22 @@ namespace Direct3D11Renderer
 		//[-------------------------------------------------------]
 		SwapChain				*mMainSwapChain;	/**< In case the optional native main window handle within the "Direct3D11Renderer"-constructor was not a null handle, this holds the instance of the main swap chain (we keep a reference to it), can be a null pointer */
 		Renderer::IRenderTarget *mRenderTarget;		/**< Currently set render target (we keep a reference to it), can be a null pointer */
+		//[-------------------------------------------------------]
+		//[ Resource pools                                        ]
+		//[-------------------------------------------------------]
+		Renderer::ResourcePool mVertexBufferPool;			/**< Pool for the vertex buffer instances */
+		Renderer::ResourcePool mIndexBufferPool;			/**< Pool for the index buffer instances */
+		Renderer::ResourcePool mTextureBufferPool;			/**< Pool for the texture buffer instances */
+		Renderer::ResourcePool mIndirectBufferPool;			/**< Pool for the indirect buffer instances */
+		Renderer::ResourcePool mTexture2DPool;				/**< Pool for the 2D texture instances */
+		Renderer::ResourcePool mTexture2DArrayPool;			/**< Pool for the 2D array texture instances */
+		Renderer::ResourcePool mRasterizerStatePool;		/**< Pool for the rasterizer state instances */
+		Renderer::ResourcePool mDepthStencilStatePool;		/**< Pool for the depth stencil state instances */
+		Renderer::ResourcePool mBlendStatePool;				/**< Pool for the blend state instances */
+		Renderer::ResourcePool mSamplerStatePool;			/**< Pool for the sampler state instances */
+		Renderer::ResourcePool mTextureCollectionPool;		/**< Pool for the texture collection instances */
+		Renderer::ResourcePool mSamplerStateCollectionPool;	/**< Pool for the sampler state collection instances */
+		Renderer::ResourcePool mUniformBufferPool;			/**< Pool for the uniform buffer instances */
 
 
 	};
@@ -46,6 +46,15 @@ namespace Direct3D11Renderer
 		return mD3D11DeviceContext;
 	}
 
+	/**
+	*  @brief
+	*    Return the pool for the uniform buffer instances
+	*/
+	inline Renderer::ResourcePool &Direct3D11Renderer::getUniformBufferPool()
+	{
+		return mUniformBufferPool;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IRenderer methods            ]
@@ -30,6 +30,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Direct3D11Renderer/D3D11.h"	// It's safe to include this header in here because "Direct3D11RuntimeLinking.h" should not included by users
+#include <Renderer/AllocatorObject.h>
 
 
 //[-------------------------------------------------------]
@@ -46,7 +47,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Direct3D 11 runtime linking
 	*/
-	class Direct3D11RuntimeLinking
+	class Direct3D11RuntimeLinking : public Renderer::AllocatorObject<Renderer::AllocationTag::RENDERER>
 	{
 
 
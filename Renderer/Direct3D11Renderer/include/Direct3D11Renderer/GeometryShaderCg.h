@@ -53,7 +53,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Cg geometry shader class
 	*/
-	class GeometryShaderCg : public GeometryShader
+	class GeometryShaderCg final : public GeometryShader
 	{
 
 
@@ -52,7 +52,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    HLSL geometry shader class
 	*/
-	class GeometryShaderHlsl : public GeometryShader
+	class GeometryShaderHlsl final : public GeometryShader
 	{
 
 
@@ -56,7 +56,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Cg program class
 	*/
-	class ProgramCg : public Program
+	class ProgramCg final : public Program
 	{
 
 
@@ -56,7 +56,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    HLSL program class
 	*/
-	class ProgramHlsl : public Program
+	class ProgramHlsl final : public Program
 	{
 
 
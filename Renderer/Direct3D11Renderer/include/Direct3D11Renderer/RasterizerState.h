@@ -60,7 +60,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Direct3D 11 rasterizer state class
 	*/
-	class RasterizerState : public Renderer::IRasterizerState
+	class RasterizerState final : public Renderer::IRasterizerState
 	{
 
 
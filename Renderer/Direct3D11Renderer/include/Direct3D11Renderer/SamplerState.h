@@ -60,7 +60,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Direct3D 11 sampler state class
 	*/
-	class SamplerState : public Renderer::ISamplerState
+	class SamplerState final : public Renderer::ISamplerState
 	{
 
 
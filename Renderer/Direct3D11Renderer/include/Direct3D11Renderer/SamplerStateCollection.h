@@ -60,7 +60,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Direct3D 11 sampler state collection class
 	*/
-	class SamplerStateCollection : public Renderer::ISamplerStateCollection
+	class SamplerStateCollection final : public Renderer::ISamplerStateCollection
 	{
 
 
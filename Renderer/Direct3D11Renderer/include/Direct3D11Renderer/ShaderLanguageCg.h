@@ -57,7 +57,7 @@ namespace Direct3D11Renderer
 	*      "INSTANCEID" within a vertex shader totally fails. It's just buggy. No issues with Cg & OpenGL.
 	*      -> Used Cg version: "Cg Toolkit 3.1 - April 2012 (3.1.0013)"
 	*/
-	class ShaderLanguageCg : public ShaderLanguage
+	class ShaderLanguageCg final : public ShaderLanguage
 	{
 
 
@@ -99,6 +99,8 @@ namespace Direct3D11Renderer
 		virtual Renderer::IGeometryShader *createGeometryShader(const char *sourceCode, Renderer::GsInputPrimitiveTopology::Enum gsInputPrimitiveTopology, Renderer::GsOutputPrimitiveTopology::Enum gsOutputPrimitiveTopology, unsigned int numberOfOutputVertices, const char *profile = nullptr, const char *arguments = nullptr, const char *entry = nullptr) override;
 		virtual Renderer::IFragmentShader *createFragmentShader(const char *sourceCode, const char *profile = nullptr, const char *arguments = nullptr, const char *entry = nullptr) override;
 		virtual Renderer::IProgram *createProgram(Renderer::IVertexShader *vertexShader, Renderer::ITessellationControlShader *tessellationControlShader, Renderer::ITessellationEvaluationShader *tessellationEvaluationShader, Renderer::IGeometryShader *geometryShader, Renderer::IFragmentShader *fragmentShader) override;
+		virtual Renderer::IComputeShader *createComputeShader(const char *sourceCode, const char *profile = nullptr, const char *arguments = nullptr, const char *entry = nullptr) override;
+		virtual Renderer::IProgram *createComputeProgram(Renderer::IComputeShader *computeShader) override;
 		virtual Renderer::IUniformBuffer *createUniformBuffer(unsigned int numberOfBytes, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
 
 
@@ -30,6 +30,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <Renderer/ISwapChain.h>
+#include <Renderer/FramePacer.h>
 #include <Renderer/PlatformTypes.h>
 
 
@@ -59,7 +60,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Direct3D 11 swap chain class
 	*/
-	class SwapChain : public Renderer::ISwapChain
+	class SwapChain final : public Renderer::ISwapChain
 	{
 
 
@@ -141,6 +142,11 @@ namespace Direct3D11Renderer
 		virtual void resizeBuffers() override;
 		virtual bool getFullscreenState() const override;
 		virtual void setFullscreenState(bool fullscreen) override;
+		virtual int getSwapInterval() const override;
+		virtual bool setSwapInterval(int swapInterval) override;
+		virtual unsigned int getMaximumFrameLatency() const override;
+		virtual void setMaximumFrameLatency(unsigned int maximumFrameLatency) override;
+		virtual const Renderer::PresentStatistics &getPresentStatistics() const override;
 
 
 	//[-------------------------------------------------------]
@@ -182,9 +188,11 @@ namespace Direct3D11Renderer
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		IDXGISwapChain		   *mDxgiSwapChain;			/**< The DXGI swap chain instance, null pointer on error */
-		ID3D11RenderTargetView *mD3D11RenderTargetView;	/**< The Direct3D 11 render target view instance, null pointer on error */
-		ID3D11DepthStencilView *mD3D11DepthStencilView;	/**< The Direct3D 11 depth stencil view instance, null pointer on error */
+		IDXGISwapChain			*mDxgiSwapChain;			/**< The DXGI swap chain instance, null pointer on error */
+		ID3D11RenderTargetView	*mD3D11RenderTargetView;	/**< The Direct3D 11 render target view instance, null pointer on error */
+		ID3D11DepthStencilView	*mD3D11DepthStencilView;	/**< The Direct3D 11 depth stencil view instance, null pointer on error */
+		int						 mSwapInterval;				/**< Swap interval, see "Renderer::ISwapChain::setSwapInterval()" */
+		Renderer::FramePacer	 mFramePacer;				/**< Frame pacer enforcing the maximum frame latency and recording the present intervals */
 
 
 	};
@@ -52,7 +52,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    HLSL tessellation control shader ("hull shader" in Direct3D terminology) class
 	*/
-	class TessellationControlShaderHlsl : public TessellationControlShader
+	class TessellationControlShaderHlsl final : public TessellationControlShader
 	{
 
 
@@ -52,7 +52,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    HLSL tessellation evaluation shader ("domain shader" in Direct3D terminology) class
 	*/
-	class TessellationEvaluationShaderHlsl : public TessellationEvaluationShader
+	class TessellationEvaluationShaderHlsl final : public TessellationEvaluationShader
 	{
 
 
@@ -36,6 +36,7 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+struct ID3D11Texture2D;
 struct ID3D11ShaderResourceView;
 namespace Direct3D11Renderer
 {
@@ -57,7 +58,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Direct3D 11 2D texture class
 	*/
-	class Texture2D : public Renderer::ITexture2D
+	class Texture2D final : public Renderer::ITexture2D
 	{
 
 
@@ -83,8 +84,10 @@ namespace Direct3D11Renderer
 		*    Texture flags, see "Renderer::TextureFlag::Enum"
 		*  @param[in] textureUsage
 		*    Indication of the texture usage (only relevant for Direct3D, OpenGL has no texture usage indication)
+		*  @param[in] numberOfMultisamples
+		*    The number of multisamples per pixel, 1 for a non-multisample texture (valid values: 1, 2, 4, 8)
 		*/
-		Texture2D(Direct3D11Renderer &direct3D11Renderer, unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage = Renderer::TextureUsage::DEFAULT);
+		Texture2D(Direct3D11Renderer &direct3D11Renderer, unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage = Renderer::TextureUsage::DEFAULT, unsigned int numberOfMultisamples = 1);
 
 		/**
 		*  @brief
@@ -92,6 +95,15 @@ namespace Direct3D11Renderer
 		*/
 		virtual ~Texture2D();
 
+		/**
+		*  @brief
+		*    Return the Direct3D 11 2D texture instance
+		*
+		*  @return
+		*    The Direct3D 11 2D texture instance, can be a null pointer, do not release the returned instance unless you added an own reference to it
+		*/
+		inline ID3D11Texture2D *getD3D11Texture2D() const;
+
 		/**
 		*  @brief
 		*    Return the Direct3D shader resource view instance
@@ -113,11 +125,20 @@ namespace Direct3D11Renderer
 		virtual void setDebugName(const char *name) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2D methods           ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void updateRegion(unsigned int mipmap, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data) override;
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		ID3D11ShaderResourceView *mD3D11ShaderResourceViewTexture;	/**< Direct3D 11 shader resource view, can be a null pointer */
+		ID3D11Texture2D				 *mD3D11Texture2D;					/**< Direct3D 11 2D texture instance, can be a null pointer */
+		ID3D11ShaderResourceView	 *mD3D11ShaderResourceViewTexture;	/**< Direct3D 11 shader resource view, can be a null pointer (always a null pointer for staging textures) */
+		Renderer::TextureFormat::Enum mTextureFormat;					/**< Texture format */
 
 
 	};
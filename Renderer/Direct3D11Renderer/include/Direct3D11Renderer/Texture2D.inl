@@ -28,6 +28,15 @@ namespace Direct3D11Renderer
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Return the Direct3D 11 2D texture instance
+	*/
+	inline ID3D11Texture2D *Texture2D::getD3D11Texture2D() const
+	{
+		return mD3D11Texture2D;
+	}
+
 	/**
 	*  @brief
 	*    Return the Direct3D shader resource view instance
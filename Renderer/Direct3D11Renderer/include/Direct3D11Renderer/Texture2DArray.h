@@ -57,7 +57,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Direct3D 11 2D array texture class
 	*/
-	class Texture2DArray : public Renderer::ITexture2DArray
+	class Texture2DArray final : public Renderer::ITexture2DArray
 	{
 
 
@@ -115,11 +115,19 @@ namespace Direct3D11Renderer
 		virtual void setDebugName(const char *name) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2DArray methods      ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void updateRegion(unsigned int mipmap, unsigned int slice, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data) override;
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		ID3D11ShaderResourceView *mD3D11ShaderResourceViewTexture;	/**< Direct3D 11 shader resource view, can be a null pointer */
+		ID3D11ShaderResourceView	 *mD3D11ShaderResourceViewTexture;	/**< Direct3D 11 shader resource view, can be a null pointer */
+		Renderer::TextureFormat::Enum mTextureFormat;					/**< Texture format */
 
 
 	};
@@ -60,7 +60,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Direct3D 11 texture collection class
 	*/
-	class TextureCollection : public Renderer::ITextureCollection
+	class TextureCollection final : public Renderer::ITextureCollection
 	{
 
 
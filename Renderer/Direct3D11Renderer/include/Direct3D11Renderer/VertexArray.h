@@ -66,7 +66,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Direct3D 11 vertex array class
 	*/
-	class VertexArray : public Renderer::IVertexArray
+	class VertexArray final : public Renderer::IVertexArray
 	{
 
 
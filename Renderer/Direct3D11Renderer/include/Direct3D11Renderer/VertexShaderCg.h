@@ -55,7 +55,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Cg vertex shader class
 	*/
-	class VertexShaderCg : public VertexShader
+	class VertexShaderCg final : public VertexShader
 	{
 
 
@@ -54,7 +54,7 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    HLSL vertex shader class
 	*/
-	class VertexShaderHlsl : public VertexShader
+	class VertexShaderHlsl final : public VertexShader
 	{
 
 
@@ -33,10 +33,12 @@
 #include "Direct3D11Renderer/VertexArray.h"
 #include "Direct3D11Renderer/SwapChain.h"
 #include "Direct3D11Renderer/Framebuffer.h"
+#include "Direct3D11Renderer/Fence.h"
 #include "Direct3D11Renderer/IndexBuffer.h"
 #include "Direct3D11Renderer/SamplerState.h"
 #include "Direct3D11Renderer/VertexBuffer.h"
 #include "Direct3D11Renderer/UniformBuffer.h"
+#include "Direct3D11Renderer/IndirectBuffer.h"
 #include "Direct3D11Renderer/TextureBuffer.h"
 #include "Direct3D11Renderer/Texture2DArray.h"
 #include "Direct3D11Renderer/RasterizerState.h"
@@ -69,9 +71,9 @@
 #else
 	#define DIRECT3D11RENDERER_API_EXPORT
 #endif
-DIRECT3D11RENDERER_API_EXPORT Renderer::IRenderer *createDirect3D11RendererInstance(handle nativeWindowHandle)
+DIRECT3D11RENDERER_API_EXPORT Renderer::IRenderer *createDirect3D11RendererInstance(handle nativeWindowHandle, Renderer::IAllocator *allocator)
 {
-	return new Direct3D11Renderer::Direct3D11Renderer(nativeWindowHandle);
+	return new ((nullptr != allocator) ? *allocator : Renderer::DefaultAllocator::getInstance()) Direct3D11Renderer::Direct3D11Renderer(nativeWindowHandle, allocator);
 }
 #undef DIRECT3D11RENDERER_API_EXPORT
 
@@ -90,19 +92,33 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Constructor
 	*/
-	Direct3D11Renderer::Direct3D11Renderer(handle nativeWindowHandle) :
+	Direct3D11Renderer::Direct3D11Renderer(handle nativeWindowHandle, Renderer::IAllocator *allocator) :
+		IRenderer(allocator),
 		mDirect3D9RuntimeLinking(nullptr),
-		mDirect3D11RuntimeLinking(new Direct3D11RuntimeLinking()),
+		mDirect3D11RuntimeLinking(new (getAllocator()) Direct3D11RuntimeLinking()),
 		mD3D11Device(nullptr),
 		mD3D11DeviceContext(nullptr),
 		mShaderLanguageHlsl(nullptr),
 		#ifndef DIRECT3D11RENDERER_NO_CG
-			mCgRuntimeLinking(new CgRuntimeLinking()),
+			mCgRuntimeLinking(new (getAllocator()) CgRuntimeLinking()),
 			mShaderLanguageCg(nullptr),
 		#endif
 		mD3D11QueryFlush(nullptr),
 		mMainSwapChain(nullptr),
-		mRenderTarget(nullptr)
+		mRenderTarget(nullptr),
+		mVertexBufferPool(getAllocator(), sizeof(VertexBuffer)),
+		mIndexBufferPool(getAllocator(), sizeof(IndexBuffer)),
+		mTextureBufferPool(getAllocator(), sizeof(TextureBuffer)),
+		mIndirectBufferPool(getAllocator(), sizeof(IndirectBuffer)),
+		mTexture2DPool(getAllocator(), sizeof(Texture2D)),
+		mTexture2DArrayPool(getAllocator(), sizeof(Texture2DArray)),
+		mRasterizerStatePool(getAllocator(), sizeof(RasterizerState)),
+		mDepthStencilStatePool(getAllocator(), sizeof(DepthStencilState)),
+		mBlendStatePool(getAllocator(), sizeof(BlendState)),
+		mSamplerStatePool(getAllocator(), sizeof(SamplerState)),
+		mTextureCollectionPool(getAllocator(), sizeof(TextureCollection)),
+		mSamplerStateCollectionPool(getAllocator(), sizeof(SamplerStateCollection)),
+		mUniformBufferPool(getAllocator(), sizeof(UniformBuffer))
 	{
 		// Begin debug event
 		RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(this)
@@ -152,7 +168,7 @@ namespace Direct3D11Renderer
 			{
 				#ifdef DIRECT3D11RENDERER_NO_DEBUG
 					// Create the Direct3D 9 runtime linking instance, we know there can't be one, yet
-					mDirect3D9RuntimeLinking = new Direct3D9RuntimeLinking();
+					mDirect3D9RuntimeLinking = new (getAllocator()) Direct3D9RuntimeLinking();
 
 					// Call the Direct3D 9 PIX function
 					if (mDirect3D9RuntimeLinking->isDirect3D9Avaiable())
@@ -345,7 +361,7 @@ namespace Direct3D11Renderer
 				// If required, create the HLSL shader language instance right now
 				if (nullptr == mShaderLanguageHlsl)
 				{
-					mShaderLanguageHlsl = new ShaderLanguageHlsl(*this);
+					mShaderLanguageHlsl = new (getAllocator()) ShaderLanguageHlsl(*this);
 					mShaderLanguageHlsl->addReference();	// Internal renderer reference
 				}
 
@@ -361,7 +377,7 @@ namespace Direct3D11Renderer
 						// If required, create the Cg shader language instance right now
 						if (nullptr == mShaderLanguageCg)
 						{
-							mShaderLanguageCg = new ShaderLanguageCg(*this);
+							mShaderLanguageCg = new (getAllocator()) ShaderLanguageCg(*this);
 							mShaderLanguageCg->addReference();	// Internal renderer reference
 						}
 
@@ -386,68 +402,73 @@ namespace Direct3D11Renderer
 	Renderer::ISwapChain *Direct3D11Renderer::createSwapChain(handle nativeWindowHandle)
 	{
 		// The provided native window handle must not be a null handle
-		return (NULL_HANDLE != nativeWindowHandle) ? new SwapChain(*this, nativeWindowHandle) : nullptr;
+		return (NULL_HANDLE != nativeWindowHandle) ? new (getAllocator()) SwapChain(*this, nativeWindowHandle) : nullptr;
 	}
 
 	Renderer::IFramebuffer *Direct3D11Renderer::createFramebuffer(unsigned int numberOfColorTextures, Renderer::ITexture **colorTextures, Renderer::ITexture *depthStencilTexture)
 	{
 		// Validation is done inside the framebuffer implementation
-		return new Framebuffer(*this, numberOfColorTextures, colorTextures, depthStencilTexture);
+		return new (getAllocator()) Framebuffer(*this, numberOfColorTextures, colorTextures, depthStencilTexture);
 	}
 
 	Renderer::IVertexBuffer *Direct3D11Renderer::createVertexBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
-		return new VertexBuffer(*this, numberOfBytes, data, bufferUsage);
+		return new (mVertexBufferPool) VertexBuffer(*this, numberOfBytes, data, bufferUsage);
 	}
 
 	Renderer::IIndexBuffer *Direct3D11Renderer::createIndexBuffer(unsigned int numberOfBytes, Renderer::IndexBufferFormat::Enum indexBufferFormat, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
-		return new IndexBuffer(*this, numberOfBytes, indexBufferFormat, data, bufferUsage);
+		return new (mIndexBufferPool) IndexBuffer(*this, numberOfBytes, indexBufferFormat, data, bufferUsage);
 	}
 
 	Renderer::ITextureBuffer *Direct3D11Renderer::createTextureBuffer(unsigned int numberOfBytes, Renderer::TextureFormat::Enum textureFormat, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
-		return new TextureBuffer(*this, numberOfBytes, textureFormat, data, bufferUsage);
+		return new (mTextureBufferPool) TextureBuffer(*this, numberOfBytes, textureFormat, data, bufferUsage);
 	}
 
-	Renderer::ITexture2D *Direct3D11Renderer::createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage)
+	Renderer::IIndirectBuffer *Direct3D11Renderer::createIndirectBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
-		return new Texture2D(*this, width, height, textureFormat, data, flags, textureUsage);
+		return new (mIndirectBufferPool) IndirectBuffer(*this, numberOfBytes, data, bufferUsage);
+	}
+
+	Renderer::ITexture2D *Direct3D11Renderer::createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage, unsigned int numberOfMultisamples)
+	{
+		return new (mTexture2DPool) Texture2D(*this, width, height, textureFormat, data, flags, textureUsage, numberOfMultisamples);
 	}
 
 	Renderer::ITexture2DArray *Direct3D11Renderer::createTexture2DArray(unsigned int width, unsigned int height, unsigned int numberOfSlices, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage)
 	{
-		return new Texture2DArray(*this, width, height, numberOfSlices, textureFormat, data, flags, textureUsage);
+		return new (mTexture2DArrayPool) Texture2DArray(*this, width, height, numberOfSlices, textureFormat, data, flags, textureUsage);
 	}
 
 	Renderer::IRasterizerState *Direct3D11Renderer::createRasterizerState(const Renderer::RasterizerState &rasterizerState)
 	{
-		return new RasterizerState(*this, rasterizerState);
+		return new (mRasterizerStatePool) RasterizerState(*this, rasterizerState);
 	}
 
 	Renderer::IDepthStencilState *Direct3D11Renderer::createDepthStencilState(const Renderer::DepthStencilState &depthStencilState)
 	{
-		return new DepthStencilState(*this, depthStencilState);
+		return new (mDepthStencilStatePool) DepthStencilState(*this, depthStencilState);
 	}
 
 	Renderer::IBlendState *Direct3D11Renderer::createBlendState(const Renderer::BlendState &blendState)
 	{
-		return new BlendState(*this, blendState);
+		return new (mBlendStatePool) BlendState(*this, blendState);
 	}
 
 	Renderer::ISamplerState *Direct3D11Renderer::createSamplerState(const Renderer::SamplerState &samplerState)
 	{
-		return new SamplerState(*this, samplerState);
+		return new (mSamplerStatePool) SamplerState(*this, samplerState);
 	}
 
 	Renderer::ITextureCollection *Direct3D11Renderer::createTextureCollection(unsigned int numberOfTextures, Renderer::ITexture **textures)
 	{
-		return new TextureCollection(*this, numberOfTextures, textures);
+		return new (mTextureCollectionPool) TextureCollection(*this, numberOfTextures, textures);
 	}
 
 	Renderer::ISamplerStateCollection *Direct3D11Renderer::createSamplerStateCollection(unsigned int numberOfSamplerStates, Renderer::ISamplerState **samplerStates)
 	{
-		return new SamplerStateCollection(*this, numberOfSamplerStates, samplerStates);
+		return new (mSamplerStateCollectionPool) SamplerStateCollection(*this, numberOfSamplerStates, samplerStates);
 	}
 
 
@@ -471,6 +492,9 @@ namespace Direct3D11Renderer
 			case Renderer::ResourceType::UNIFORM_BUFFER:
 				return (S_OK == mD3D11DeviceContext->Map(static_cast<UniformBuffer&>(resource).getD3D11Buffer(), subresource, static_cast<D3D11_MAP>(mapType), mapFlags, reinterpret_cast<D3D11_MAPPED_SUBRESOURCE*>(&mappedSubresource)));
 
+			case Renderer::ResourceType::INDIRECT_BUFFER:
+				return (S_OK == mD3D11DeviceContext->Map(static_cast<IndirectBuffer&>(resource).getD3D11Buffer(), subresource, static_cast<D3D11_MAP>(mapType), mapFlags, reinterpret_cast<D3D11_MAPPED_SUBRESOURCE*>(&mappedSubresource)));
+
 			case Renderer::ResourceType::TEXTURE_BUFFER:
 				return (S_OK == mD3D11DeviceContext->Map(static_cast<TextureBuffer&>(resource).getD3D11Buffer(), subresource, static_cast<D3D11_MAP>(mapType), mapFlags, reinterpret_cast<D3D11_MAPPED_SUBRESOURCE*>(&mappedSubresource)));
 
@@ -481,16 +505,12 @@ namespace Direct3D11Renderer
 				// Begin debug event
 				RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(this)
 
-				// Get the Direct3D 11 resource instance
-				ID3D11Resource *d3d11Resource = nullptr;
-				static_cast<Texture2D&>(resource).getD3D11ShaderResourceView()->GetResource(&d3d11Resource);
-				if (nullptr != d3d11Resource)
+				// Get the Direct3D 11 2D texture instance
+				ID3D11Texture2D *d3d11Texture2D = static_cast<Texture2D&>(resource).getD3D11Texture2D();
+				if (nullptr != d3d11Texture2D)
 				{
-					// Map the Direct3D 11 resource
-					result = (S_OK == mD3D11DeviceContext->Map(d3d11Resource, subresource, static_cast<D3D11_MAP>(mapType), mapFlags, reinterpret_cast<D3D11_MAPPED_SUBRESOURCE*>(&mappedSubresource)));
-
-					// Release the Direct3D 11 resource instance
-					d3d11Resource->Release();
+					// Map the Direct3D 11 2D texture
+					result = (S_OK == mD3D11DeviceContext->Map(d3d11Texture2D, subresource, static_cast<D3D11_MAP>(mapType), mapFlags, reinterpret_cast<D3D11_MAPPED_SUBRESOURCE*>(&mappedSubresource)));
 				}
 
 				// End debug event
@@ -539,8 +559,10 @@ namespace Direct3D11Renderer
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			case Renderer::ResourceType::TEXTURE_COLLECTION:
 			case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+			case Renderer::ResourceType::FENCE:
 			default:
 				// Nothing we can map, set known return values
 				mappedSubresource.data		 = nullptr;
@@ -569,22 +591,22 @@ namespace Direct3D11Renderer
 				mD3D11DeviceContext->Unmap(static_cast<UniformBuffer&>(resource).getD3D11Buffer(), subresource);
 				break;
 
+			case Renderer::ResourceType::INDIRECT_BUFFER:
+				mD3D11DeviceContext->Unmap(static_cast<IndirectBuffer&>(resource).getD3D11Buffer(), subresource);
+				break;
+
 			case Renderer::ResourceType::TEXTURE_BUFFER:
 				mD3D11DeviceContext->Unmap(static_cast<TextureBuffer&>(resource).getD3D11Buffer(), subresource);
 				break;
 
 			case Renderer::ResourceType::TEXTURE_2D:
 			{
-				// Get the Direct3D 11 resource instance
-				ID3D11Resource *d3d11Resource = nullptr;
-				static_cast<Texture2D&>(resource).getD3D11ShaderResourceView()->GetResource(&d3d11Resource);
-				if (nullptr != d3d11Resource)
+				// Get the Direct3D 11 2D texture instance
+				ID3D11Texture2D *d3d11Texture2D = static_cast<Texture2D&>(resource).getD3D11Texture2D();
+				if (nullptr != d3d11Texture2D)
 				{
-					// Unmap the Direct3D 11 resource
-					mD3D11DeviceContext->Unmap(d3d11Resource, subresource);
-
-					// Release the Direct3D 11 resource instance
-					d3d11Resource->Release();
+					// Unmap the Direct3D 11 2D texture
+					mD3D11DeviceContext->Unmap(d3d11Texture2D, subresource);
 				}
 				break;
 			}
@@ -618,14 +640,89 @@ namespace Direct3D11Renderer
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			case Renderer::ResourceType::TEXTURE_COLLECTION:
 			case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+			case Renderer::ResourceType::FENCE:
 			default:
 				// Nothing we can unmap
 				break;
 		}
 	}
 
+	bool Direct3D11Renderer::copyResource(Renderer::IResource &destinationResource, Renderer::IResource &sourceResource)
+	{
+		// The resource types must match
+		if (destinationResource.getResourceType() != sourceResource.getResourceType())
+		{
+			// Error!
+			return false;
+		}
+
+		// Get the Direct3D 11 resource instances
+		ID3D11Resource *d3d11DestinationResource = nullptr;
+		ID3D11Resource *d3d11SourceResource = nullptr;
+		switch (destinationResource.getResourceType())
+		{
+			case Renderer::ResourceType::INDEX_BUFFER:
+				d3d11DestinationResource = static_cast<IndexBuffer&>(destinationResource).getD3D11Buffer();
+				d3d11SourceResource		= static_cast<IndexBuffer&>(sourceResource).getD3D11Buffer();
+				break;
+
+			case Renderer::ResourceType::VERTEX_BUFFER:
+				d3d11DestinationResource = static_cast<VertexBuffer&>(destinationResource).getD3D11Buffer();
+				d3d11SourceResource		= static_cast<VertexBuffer&>(sourceResource).getD3D11Buffer();
+				break;
+
+			case Renderer::ResourceType::TEXTURE_2D:
+				d3d11DestinationResource = static_cast<Texture2D&>(destinationResource).getD3D11Texture2D();
+				d3d11SourceResource		= static_cast<Texture2D&>(sourceResource).getD3D11Texture2D();
+				break;
+
+			case Renderer::ResourceType::PROGRAM:
+			case Renderer::ResourceType::VERTEX_ARRAY:
+			case Renderer::ResourceType::SWAP_CHAIN:
+			case Renderer::ResourceType::FRAMEBUFFER:
+			case Renderer::ResourceType::UNIFORM_BUFFER:
+			case Renderer::ResourceType::INDIRECT_BUFFER:
+			case Renderer::ResourceType::TEXTURE_BUFFER:
+			case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+			case Renderer::ResourceType::RASTERIZER_STATE:
+			case Renderer::ResourceType::DEPTH_STENCIL_STATE:
+			case Renderer::ResourceType::BLEND_STATE:
+			case Renderer::ResourceType::SAMPLER_STATE:
+			case Renderer::ResourceType::VERTEX_SHADER:
+			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
+			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
+			case Renderer::ResourceType::GEOMETRY_SHADER:
+			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
+			case Renderer::ResourceType::TEXTURE_COLLECTION:
+			case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+			case Renderer::ResourceType::FENCE:
+			default:
+				// Error!
+				return false;
+		}
+		if (nullptr == d3d11DestinationResource || nullptr == d3d11SourceResource)
+		{
+			// Error!
+			return false;
+		}
+
+		// Copy the resource
+		// -> The copy is performed asynchronously on the GPU, use a fence before mapping the destination resource for reading
+		mD3D11DeviceContext->CopyResource(d3d11DestinationResource, d3d11SourceResource);
+
+		// Done
+		return true;
+	}
+
+	void Direct3D11Renderer::setTextureResident(Renderer::ITexture &, Renderer::ISamplerState *, bool)
+	{
+		// Direct3D 11 has no bindless texture support
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ States                                                ]
@@ -797,6 +894,7 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::RASTERIZER_STATE:
 				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
 				case Renderer::ResourceType::BLEND_STATE:
@@ -806,8 +904,10 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Not handled in here
 					break;
@@ -937,6 +1037,7 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::RASTERIZER_STATE:
 				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
 				case Renderer::ResourceType::BLEND_STATE:
@@ -946,8 +1047,10 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Not handled in here
 					break;
@@ -1082,6 +1185,7 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::RASTERIZER_STATE:
 				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
 				case Renderer::ResourceType::BLEND_STATE:
@@ -1091,8 +1195,10 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Not handled in here
 					break;
@@ -1228,6 +1334,7 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::RASTERIZER_STATE:
 				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
 				case Renderer::ResourceType::BLEND_STATE:
@@ -1237,8 +1344,10 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Not handled in here
 					break;
@@ -1320,6 +1429,38 @@ namespace Direct3D11Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Stream-output (SO) stage                              ]
+	//[-------------------------------------------------------]
+	void Direct3D11Renderer::soSetTargets(unsigned int numberOfTargets, Renderer::IVertexBuffer **vertexBuffers, const unsigned int *)
+	{
+		// TODO(co) Direct3D 11 stream output support is not implemented, yet
+
+		// Are the given vertex buffers valid?
+		if (nullptr != vertexBuffers)
+		{
+			for (unsigned int i = 0; i < numberOfTargets; ++i)
+			{
+				if (nullptr != vertexBuffers[i])
+				{
+					// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+					DIRECT3D11RENDERER_RENDERERMATCHCHECK_RETURN(*this, *vertexBuffers[i])
+				}
+			}
+		}
+	}
+
+	void Direct3D11Renderer::soBegin(Renderer::PrimitiveTopology::Enum, bool)
+	{
+		// TODO(co) Direct3D 11 stream output support is not implemented, yet
+	}
+
+	void Direct3D11Renderer::soEnd()
+	{
+		// TODO(co) Direct3D 11 stream output support is not implemented, yet
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Rasterizer (RS) stage                                 ]
 	//[-------------------------------------------------------]
@@ -1416,6 +1557,7 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::RASTERIZER_STATE:
 				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
 				case Renderer::ResourceType::BLEND_STATE:
@@ -1425,8 +1567,10 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Not handled in here
 					break;
@@ -1570,6 +1714,7 @@ namespace Direct3D11Renderer
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::UNIFORM_BUFFER:
+					case Renderer::ResourceType::INDIRECT_BUFFER:
 					case Renderer::ResourceType::TEXTURE_BUFFER:
 					case Renderer::ResourceType::TEXTURE_2D:
 					case Renderer::ResourceType::TEXTURE_2D_ARRAY:
@@ -1582,8 +1727,10 @@ namespace Direct3D11Renderer
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 					case Renderer::ResourceType::TEXTURE_COLLECTION:
 					case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+					case Renderer::ResourceType::FENCE:
 					default:
 						// Not handled in here
 						break;
@@ -1641,6 +1788,82 @@ namespace Direct3D11Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Compute-shader (CS) stage                             ]
+	//[-------------------------------------------------------]
+	void Direct3D11Renderer::csSetTexture(unsigned int, Renderer::ITexture *texture)
+	{
+		// TODO(co) Direct3D 11 compute shader support is not implemented, yet
+
+		// Is the given texture valid?
+		if (nullptr != texture)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D11RENDERER_RENDERERMATCHCHECK_RETURN(*this, *texture)
+		}
+	}
+
+	void Direct3D11Renderer::csSetTextureCollection(unsigned int, Renderer::ITextureCollection *textureCollection)
+	{
+		// TODO(co) Direct3D 11 compute shader support is not implemented, yet
+
+		// Is the given texture collection valid?
+		if (nullptr != textureCollection)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D11RENDERER_RENDERERMATCHCHECK_RETURN(*this, *textureCollection)
+		}
+	}
+
+	void Direct3D11Renderer::csSetSamplerState(unsigned int, Renderer::ISamplerState *samplerState)
+	{
+		// TODO(co) Direct3D 11 compute shader support is not implemented, yet
+
+		// Is the given sampler state valid?
+		if (nullptr != samplerState)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D11RENDERER_RENDERERMATCHCHECK_RETURN(*this, *samplerState)
+		}
+	}
+
+	void Direct3D11Renderer::csSetSamplerStateCollection(unsigned int, Renderer::ISamplerStateCollection *samplerStateCollection)
+	{
+		// TODO(co) Direct3D 11 compute shader support is not implemented, yet
+
+		// Is the given sampler state collection valid?
+		if (nullptr != samplerStateCollection)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D11RENDERER_RENDERERMATCHCHECK_RETURN(*this, *samplerStateCollection)
+		}
+	}
+
+	void Direct3D11Renderer::csSetUniformBuffer(unsigned int, Renderer::IUniformBuffer *uniformBuffer)
+	{
+		// TODO(co) Direct3D 11 compute shader support is not implemented, yet
+
+		// Is the given uniform buffer valid?
+		if (nullptr != uniformBuffer)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D11RENDERER_RENDERERMATCHCHECK_RETURN(*this, *uniformBuffer)
+		}
+	}
+
+	void Direct3D11Renderer::csSetUnorderedAccessView(unsigned int, Renderer::IResource *resource)
+	{
+		// TODO(co) Direct3D 11 compute shader support is not implemented, yet
+
+		// Is the given resource valid?
+		if (nullptr != resource)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D11RENDERER_RENDERERMATCHCHECK_RETURN(*this, *resource)
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Operations                                            ]
 	//[-------------------------------------------------------]
@@ -1729,6 +1952,7 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::TEXTURE_BUFFER:
 				case Renderer::ResourceType::TEXTURE_2D:
 				case Renderer::ResourceType::TEXTURE_2D_ARRAY:
@@ -1741,8 +1965,10 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Not handled in here
 					break;
@@ -1770,6 +1996,70 @@ namespace Direct3D11Renderer
 		// Not required when using Direct3D 11
 	}
 
+	void Direct3D11Renderer::resolveMultisampleFramebuffer(Renderer::IRenderTarget &destinationRenderTarget, Renderer::IFramebuffer &sourceMultisampleFramebuffer)
+	{
+		// Security check: Are the given resources owned by this renderer? (calls "return" in case of a mismatch)
+		DIRECT3D11RENDERER_RENDERERMATCHCHECK_RETURN(*this, destinationRenderTarget)
+		DIRECT3D11RENDERER_RENDERERMATCHCHECK_RETURN(*this, sourceMultisampleFramebuffer)
+
+		// Get the Direct3D 11 source render target views
+		Framebuffer &sourceFramebuffer = static_cast<Framebuffer&>(sourceMultisampleFramebuffer);
+		ID3D11RenderTargetView **sourceD3D11RenderTargetViews = sourceFramebuffer.getD3D11RenderTargetViews();
+		unsigned int numberOfD3D11RenderTargetViews = sourceFramebuffer.getNumberOfD3D11RenderTargetViews();
+
+		// Get the Direct3D 11 destination render target views
+		ID3D11RenderTargetView *d3d11SwapChainRenderTargetView = nullptr;
+		ID3D11RenderTargetView **destinationD3D11RenderTargetViews = nullptr;
+		switch (destinationRenderTarget.getResourceType())
+		{
+			case Renderer::ResourceType::SWAP_CHAIN:
+				// A swap chain has only a single color buffer
+				d3d11SwapChainRenderTargetView = static_cast<SwapChain&>(destinationRenderTarget).getD3D11RenderTargetView();
+				destinationD3D11RenderTargetViews = &d3d11SwapChainRenderTargetView;
+				numberOfD3D11RenderTargetViews = 1;
+				break;
+
+			case Renderer::ResourceType::FRAMEBUFFER:
+			{
+				Framebuffer &destinationFramebuffer = static_cast<Framebuffer&>(destinationRenderTarget);
+				destinationD3D11RenderTargetViews = destinationFramebuffer.getD3D11RenderTargetViews();
+				if (numberOfD3D11RenderTargetViews > destinationFramebuffer.getNumberOfD3D11RenderTargetViews())
+				{
+					numberOfD3D11RenderTargetViews = destinationFramebuffer.getNumberOfD3D11RenderTargetViews();
+				}
+				break;
+			}
+
+			default:
+				// Error!
+				return;
+		}
+
+		// Resolve the color buffers
+		for (unsigned int i = 0; i < numberOfD3D11RenderTargetViews; ++i)
+		{
+			if (nullptr != sourceD3D11RenderTargetViews[i] && nullptr != destinationD3D11RenderTargetViews[i])
+			{
+				// Get the Direct3D 11 resources
+				ID3D11Resource *sourceD3D11Resource = nullptr;
+				ID3D11Resource *destinationD3D11Resource = nullptr;
+				sourceD3D11RenderTargetViews[i]->GetResource(&sourceD3D11Resource);
+				destinationD3D11RenderTargetViews[i]->GetResource(&destinationD3D11Resource);
+
+				// Get the DXGI format of the destination 2D texture
+				D3D11_TEXTURE2D_DESC d3d11Texture2DDesc;
+				static_cast<ID3D11Texture2D*>(destinationD3D11Resource)->GetDesc(&d3d11Texture2DDesc);
+
+				// Resolve the multisample resource into the non-multisample resource
+				mD3D11DeviceContext->ResolveSubresource(destinationD3D11Resource, 0, sourceD3D11Resource, 0, d3d11Texture2DDesc.Format);
+
+				// Release our Direct3D 11 resource references
+				destinationD3D11Resource->Release();
+				sourceD3D11Resource->Release();
+			}
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Draw call                                             ]
@@ -1818,10 +2108,81 @@ namespace Direct3D11Renderer
 		);
 	}
 
+	void Direct3D11Renderer::multiDrawIndexedIndirect(Renderer::IIndirectBuffer &indirectBuffer, unsigned int indirectBufferOffset, unsigned int numberOfDraws)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		DIRECT3D11RENDERER_RENDERERMATCHCHECK_RETURN(*this, indirectBuffer)
+
+		// Direct3D 11 has no multi-draw indirect, but at least there's no need to touch the draw arguments on the CPU side
+		ID3D11Buffer *d3d11Buffer = static_cast<IndirectBuffer&>(indirectBuffer).getD3D11Buffer();
+		if (nullptr != d3d11Buffer)
+		{
+			for (unsigned int i = 0; i < numberOfDraws; ++i, indirectBufferOffset += sizeof(Renderer::DrawIndexedInstancedArguments))
+			{
+				mD3D11DeviceContext->DrawIndexedInstancedIndirect(d3d11Buffer, indirectBufferOffset);
+			}
+		}
+	}
+
+	void Direct3D11Renderer::drawAuto()
+	{
+		// TODO(co) Direct3D 11 stream output support is not implemented, yet
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Compute                                               ]
+	//[-------------------------------------------------------]
+	void Direct3D11Renderer::dispatch(unsigned int, unsigned int, unsigned int)
+	{
+		// TODO(co) Direct3D 11 compute shader support is not implemented, yet
+	}
+
+	void Direct3D11Renderer::memoryBarrier(unsigned int)
+	{
+		// TODO(co) Direct3D 11 compute shader support is not implemented, yet
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Synchronization                                       ]
 	//[-------------------------------------------------------]
+	Renderer::IFence *Direct3D11Renderer::insertFence()
+	{
+		return new (getAllocator()) Fence(*this);
+	}
+
+	bool Direct3D11Renderer::isFenceSignaled(Renderer::IFence &fence)
+	{
+		// Poll the Direct3D 11 event query without waiting
+		// -> Flush the command stream, else the fence might never be signaled
+		ID3D11Query *d3d11Query = static_cast<Fence&>(fence).getD3D11Query();
+		return (nullptr != d3d11Query && S_OK == mD3D11DeviceContext->GetData(d3d11Query, nullptr, 0, 0));
+	}
+
+	bool Direct3D11Renderer::waitFence(Renderer::IFence &fence, unsigned int timeout)
+	{
+		ID3D11Query *d3d11Query = static_cast<Fence&>(fence).getD3D11Query();
+		if (nullptr != d3d11Query)
+		{
+			// Direct3D 11 has no blocking wait for event queries, so spin-wait until the event query is signaled or the timeout (in milliseconds) is reached
+			const DWORD startTime = ::GetTickCount();
+			HRESULT hResult = S_FALSE;
+			while (S_FALSE == (hResult = mD3D11DeviceContext->GetData(d3d11Query, nullptr, 0, 0)))
+			{
+				if (~0u != timeout && ::GetTickCount() - startTime >= timeout)
+				{
+					// Timeout reached
+					return false;
+				}
+			}
+			return (S_OK == hResult);
+		}
+
+		// Error!
+		return false;
+	}
+
 	void Direct3D11Renderer::flush()
 	{
 		mD3D11DeviceContext->Flush();
@@ -1861,6 +2222,19 @@ namespace Direct3D11Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Swap chain                                            ]
+	//[-------------------------------------------------------]
+	void Direct3D11Renderer::presentSwapChains(unsigned int numberOfSwapChains, Renderer::ISwapChain **swapChains)
+	{
+		// DXGI has no way to present multiple swap chains at once, the swap chains are already sharing the device and with it all resources
+		for (unsigned int i = 0; i < numberOfSwapChains; ++i)
+		{
+			swapChains[i]->present();
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Debug                                                 ]
 	//[-------------------------------------------------------]
@@ -1880,7 +2254,7 @@ namespace Direct3D11Renderer
 			// Create the Direct3D 9 runtime linking instance, in case there's no one, yet
 			if (nullptr == mDirect3D9RuntimeLinking)
 			{
-				mDirect3D9RuntimeLinking = new Direct3D9RuntimeLinking();
+				mDirect3D9RuntimeLinking = new (getAllocator()) Direct3D9RuntimeLinking();
 			}
 
 			// Call the Direct3D 9 PIX function
@@ -1897,7 +2271,7 @@ namespace Direct3D11Renderer
 			// Create the Direct3D 9 runtime linking instance, in case there's no one, yet
 			if (nullptr == mDirect3D9RuntimeLinking)
 			{
-				mDirect3D9RuntimeLinking = new Direct3D9RuntimeLinking();
+				mDirect3D9RuntimeLinking = new (getAllocator()) Direct3D9RuntimeLinking();
 			}
 
 			// Call the Direct3D 9 PIX function
@@ -1914,7 +2288,7 @@ namespace Direct3D11Renderer
 			// Create the Direct3D 9 runtime linking instance, in case there's no one, yet
 			if (nullptr == mDirect3D9RuntimeLinking)
 			{
-				mDirect3D9RuntimeLinking = new Direct3D9RuntimeLinking();
+				mDirect3D9RuntimeLinking = new (getAllocator()) Direct3D9RuntimeLinking();
 			}
 
 			// Call the Direct3D 9 PIX function
@@ -1955,6 +2329,9 @@ namespace Direct3D11Renderer
 				// Maximum number of 2D texture array slices (usually 512, in case there's no support for 2D texture arrays it's 0)
 				mCapabilities.maximumNumberOf2DTextureArraySlices = 0;
 
+				// Maximum number of multisamples per texel of a render target texture (always at least 1, usually 8)
+				mCapabilities.maximumNumberOfMultisamples = 2;
+
 				// Maximum texture buffer (TBO) size in texel (>65536, typically much larger than that of one-dimensional texture, in case there's no support for texture buffer it's 0)
 				mCapabilities.maximumTextureBufferSize = 0;	// TODO(co) http://msdn.microsoft.com/en-us/library/ff476876%28v=vs.85%29.aspx does not mention the texture buffer?
 
@@ -1984,6 +2361,9 @@ namespace Direct3D11Renderer
 				// Maximum number of 2D texture array slices (usually 512, in case there's no support for 2D texture arrays it's 0)
 				mCapabilities.maximumNumberOf2DTextureArraySlices = 0;
 
+				// Maximum number of multisamples per texel of a render target texture (always at least 1, usually 8)
+				mCapabilities.maximumNumberOfMultisamples = 2;
+
 				// Maximum texture buffer (TBO) size in texel (>65536, typically much larger than that of one-dimensional texture, in case there's no support for texture buffer it's 0)
 				mCapabilities.maximumTextureBufferSize = 0;	// TODO(co) http://msdn.microsoft.com/en-us/library/ff476876%28v=vs.85%29.aspx does not mention the texture buffer?
 
@@ -2013,6 +2393,9 @@ namespace Direct3D11Renderer
 				// Maximum number of 2D texture array slices (usually 512, in case there's no support for 2D texture arrays it's 0)
 				mCapabilities.maximumNumberOf2DTextureArraySlices = 0;
 
+				// Maximum number of multisamples per texel of a render target texture (always at least 1, usually 8)
+				mCapabilities.maximumNumberOfMultisamples = 4;
+
 				// Maximum texture buffer (TBO) size in texel (>65536, typically much larger than that of one-dimensional texture, in case there's no support for texture buffer it's 0)
 				mCapabilities.maximumTextureBufferSize = 0;	// TODO(co) http://msdn.microsoft.com/en-us/library/ff476876%28v=vs.85%29.aspx does not mention the texture buffer?
 
@@ -2042,6 +2425,9 @@ namespace Direct3D11Renderer
 				// Maximum number of 2D texture array slices (usually 512, in case there's no support for 2D texture arrays it's 0)
 				mCapabilities.maximumNumberOf2DTextureArraySlices = 512;
 
+				// Maximum number of multisamples per texel of a render target texture (always at least 1, usually 8)
+				mCapabilities.maximumNumberOfMultisamples = 4;
+
 				// Maximum texture buffer (TBO) size in texel (>65536, typically much larger than that of one-dimensional texture, in case there's no support for texture buffer it's 0)
 				mCapabilities.maximumTextureBufferSize = 2000;	// TODO(co) http://msdn.microsoft.com/en-us/library/ff476876%28v=vs.85%29.aspx does not mention the texture buffer?
 
@@ -2071,6 +2457,9 @@ namespace Direct3D11Renderer
 				// Maximum number of 2D texture array slices (usually 512, in case there's no support for 2D texture arrays it's 0)
 				mCapabilities.maximumNumberOf2DTextureArraySlices = 512;
 
+				// Maximum number of multisamples per texel of a render target texture (always at least 1, usually 8)
+				mCapabilities.maximumNumberOfMultisamples = 4;
+
 				// Maximum texture buffer (TBO) size in texel (>65536, typically much larger than that of one-dimensional texture, in case there's no support for texture buffer it's 0)
 				mCapabilities.maximumTextureBufferSize = 2000;	// TODO(co) http://msdn.microsoft.com/en-us/library/ff476876%28v=vs.85%29.aspx does not mention the texture buffer?
 
@@ -2100,6 +2489,9 @@ namespace Direct3D11Renderer
 				// Maximum number of 2D texture array slices (usually 512, in case there's no support for 2D texture arrays it's 0)
 				mCapabilities.maximumNumberOf2DTextureArraySlices = 512;
 
+				// Maximum number of multisamples per texel of a render target texture (always at least 1, usually 8)
+				mCapabilities.maximumNumberOfMultisamples = 8;
+
 				// Maximum texture buffer (TBO) size in texel (>65536, typically much larger than that of one-dimensional texture, in case there's no support for texture buffer it's 0)
 				mCapabilities.maximumTextureBufferSize = 2000;	// TODO(co) http://msdn.microsoft.com/en-us/library/ff476876%28v=vs.85%29.aspx does not mention the texture buffer?
 
@@ -2128,6 +2520,9 @@ namespace Direct3D11Renderer
 		// Base vertex supported for draw calls?
 		mCapabilities.baseVertex = true;
 
+		// Native multi-draw indirect supported? (Direct3D 11 has only single draw indirect, "Direct3D11Renderer::multiDrawIndexedIndirect()" uses a loop)
+		mCapabilities.multiDrawIndirect = false;
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = true;
 
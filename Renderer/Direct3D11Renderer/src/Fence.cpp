@@ -0,0 +1,102 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Direct3D11Renderer/Fence.h"
+#include "Direct3D11Renderer/Guid.h"	// For "WKPDID_D3DDebugObjectName"
+#include "Direct3D11Renderer/D3D11.h"
+#include "Direct3D11Renderer/Direct3D11Renderer.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Direct3D11Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	Fence::Fence(Direct3D11Renderer &direct3D11Renderer) :
+		Renderer::IFence(direct3D11Renderer),
+		mD3D11Query(nullptr)
+	{
+		// Direct3D 11 query description
+		D3D11_QUERY_DESC d3d11QueryDesc;
+		d3d11QueryDesc.Query	 = D3D11_QUERY_EVENT;
+		d3d11QueryDesc.MiscFlags = 0;
+
+		// Create the Direct3D 11 event query and insert it into the command stream
+		direct3D11Renderer.getD3D11Device()->CreateQuery(&d3d11QueryDesc, &mD3D11Query);
+		if (nullptr != mD3D11Query)
+		{
+			direct3D11Renderer.getD3D11DeviceContext()->End(mD3D11Query);
+		}
+
+		// Assign a default name to the resource for debugging purposes
+		#ifndef DIRECT3D11RENDERER_NO_DEBUG
+			setDebugName("Fence");
+		#endif
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	Fence::~Fence()
+	{
+		// Release the Direct3D 11 event query
+		if (nullptr != mD3D11Query)
+		{
+			mD3D11Query->Release();
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IResource methods            ]
+	//[-------------------------------------------------------]
+	void Fence::setDebugName(const char *name)
+	{
+		#ifndef DIRECT3D11RENDERER_NO_DEBUG
+			// Valid Direct3D 11 event query?
+			if (nullptr != mD3D11Query)
+			{
+				// Set the debug name
+				// -> First: Ensure that there's no previous private data, else we might get slapped with a warning!
+				mD3D11Query->SetPrivateData(WKPDID_D3DDebugObjectName, 0, nullptr);
+				mD3D11Query->SetPrivateData(WKPDID_D3DDebugObjectName, strlen(name), name);
+			}
+		#endif
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Direct3D11Renderer
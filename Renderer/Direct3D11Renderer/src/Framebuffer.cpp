@@ -62,8 +62,8 @@ namespace Direct3D11Renderer
 		// Add a reference to the used color textures
 		if (mNumberOfColorTextures > 0)
 		{
-			mColorTextures = new Renderer::ITexture*[mNumberOfColorTextures];
-			mD3D11RenderTargetViews = new ID3D11RenderTargetView*[mNumberOfColorTextures];
+			mColorTextures = getRenderer().getAllocator().allocateArray<Renderer::ITexture*>(mNumberOfColorTextures, Renderer::AllocationTag::RESOURCE);
+			mD3D11RenderTargetViews = getRenderer().getAllocator().allocateArray<ID3D11RenderTargetView*>(mNumberOfColorTextures, Renderer::AllocationTag::RESOURCE);
 
 			// Loop through all color textures
 			ID3D11RenderTargetView **d3d11RenderTargetView = mD3D11RenderTargetViews;
@@ -104,7 +104,7 @@ namespace Direct3D11Renderer
 							// Create the Direct3D 11 render target view instance
 							D3D11_RENDER_TARGET_VIEW_DESC d3d11RenderTargetViewDesc;
 							d3d11RenderTargetViewDesc.Format			 = d3d11Texture2DDesc.Format;
-							d3d11RenderTargetViewDesc.ViewDimension		 = D3D11_RTV_DIMENSION_TEXTURE2D;
+							d3d11RenderTargetViewDesc.ViewDimension		 = (d3d11Texture2DDesc.SampleDesc.Count > 1) ? D3D11_RTV_DIMENSION_TEXTURE2DMS : D3D11_RTV_DIMENSION_TEXTURE2D;
 							d3d11RenderTargetViewDesc.Texture2D.MipSlice = 0;
 							direct3D11Renderer.getD3D11Device()->CreateRenderTargetView(d3d11Resource, &d3d11RenderTargetViewDesc, d3d11RenderTargetView);
 
@@ -120,6 +120,7 @@ namespace Direct3D11Renderer
 						case Renderer::ResourceType::INDEX_BUFFER:
 						case Renderer::ResourceType::VERTEX_BUFFER:
 						case Renderer::ResourceType::UNIFORM_BUFFER:
+						case Renderer::ResourceType::INDIRECT_BUFFER:
 						case Renderer::ResourceType::TEXTURE_BUFFER:
 						case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 						case Renderer::ResourceType::RASTERIZER_STATE:
@@ -131,8 +132,10 @@ namespace Direct3D11Renderer
 						case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 						case Renderer::ResourceType::GEOMETRY_SHADER:
 						case Renderer::ResourceType::FRAGMENT_SHADER:
+						case Renderer::ResourceType::COMPUTE_SHADER:
 						case Renderer::ResourceType::TEXTURE_COLLECTION:
 						case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+						case Renderer::ResourceType::FENCE:
 						default:
 							RENDERER_OUTPUT_DEBUG_PRINTF("Direct3D 11 error: The type of the given color texture at index %d is not supported", colorTexture - colorTextures)
 							*d3d11RenderTargetView = nullptr;
@@ -179,7 +182,7 @@ namespace Direct3D11Renderer
 					// Create the Direct3D 11 render target view instance
 					D3D11_DEPTH_STENCIL_VIEW_DESC d3d11DepthStencilViewDesc;
 					d3d11DepthStencilViewDesc.Format			 = d3d11Texture2DDesc.Format;
-					d3d11DepthStencilViewDesc.ViewDimension		 = D3D11_DSV_DIMENSION_TEXTURE2D;
+					d3d11DepthStencilViewDesc.ViewDimension		 = (d3d11Texture2DDesc.SampleDesc.Count > 1) ? D3D11_DSV_DIMENSION_TEXTURE2DMS : D3D11_DSV_DIMENSION_TEXTURE2D;
 					d3d11DepthStencilViewDesc.Texture2D.MipSlice = 0;
 					direct3D11Renderer.getD3D11Device()->CreateDepthStencilView(d3d11Resource, &d3d11DepthStencilViewDesc, &mD3D11DepthStencilView);
 
@@ -195,6 +198,7 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::TEXTURE_BUFFER:
 				case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 				case Renderer::ResourceType::RASTERIZER_STATE:
@@ -206,8 +210,10 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					RENDERER_OUTPUT_DEBUG_STRING("Direct3D 11 error: The type of the given depth stencil texture is not supported")
 					break;
@@ -251,7 +257,7 @@ namespace Direct3D11Renderer
 			}
 
 			// Cleanup
-			delete [] mD3D11RenderTargetViews;
+			getRenderer().getAllocator().deallocateArray(mD3D11RenderTargetViews, Renderer::AllocationTag::RESOURCE);
 		}
 		if (nullptr != mColorTextures)
 		{
@@ -267,7 +273,7 @@ namespace Direct3D11Renderer
 			}
 
 			// Cleanup
-			delete [] mColorTextures;
+			getRenderer().getAllocator().deallocateArray(mColorTextures, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Release the reference to the used depth stencil texture
@@ -292,7 +298,7 @@ namespace Direct3D11Renderer
 		#ifndef DIRECT3D11RENDERER_NO_DEBUG
 			{ // Assign a debug name to the Direct3D 11 render target view, do also add the index to the name
 				const size_t nameLength = strlen(name) + 5;	// Direct3D 11 supports 8 render targets ("D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT", so: One digit + one [ + one ] + one space + terminating zero = 5 characters)
-				char *nameWithIndex = new char[nameLength];
+				char *nameWithIndex = getRenderer().getAllocator().allocateArray<char>(nameLength, Renderer::AllocationTag::TEMPORARY);
 				ID3D11RenderTargetView **d3d11RenderTargetViewsEnd = mD3D11RenderTargetViews + mNumberOfColorTextures;
 				for (ID3D11RenderTargetView **d3d11RenderTargetView = mD3D11RenderTargetViews; d3d11RenderTargetView < d3d11RenderTargetViewsEnd; ++d3d11RenderTargetView)
 				{
@@ -302,7 +308,7 @@ namespace Direct3D11Renderer
 					(*d3d11RenderTargetView)->SetPrivateData(WKPDID_D3DDebugObjectName, 0, nullptr);
 					(*d3d11RenderTargetView)->SetPrivateData(WKPDID_D3DDebugObjectName, nameLength, nameWithIndex);
 				}
-				delete [] nameWithIndex;
+				getRenderer().getAllocator().deallocateArray(nameWithIndex, Renderer::AllocationTag::TEMPORARY);
 			}
 
 			// Assign a debug name to the Direct3D 11 depth stencil view
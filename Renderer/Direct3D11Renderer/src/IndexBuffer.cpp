@@ -47,6 +47,9 @@ namespace Direct3D11Renderer
 		mD3D11Buffer(nullptr),
 		mDXGIFormat(DXGI_FORMAT_UNKNOWN)
 	{
+		// Set the estimated number of bytes of the index buffer
+		setNumberOfBytes(numberOfBytes);
+
 		// "Renderer::IndexBufferFormat::UnsignedChar" is not supported by Direct3D 11
 		if (Renderer::IndexBufferFormat::UNSIGNED_CHAR == indexBufferFormat)
 		{
@@ -109,6 +112,9 @@ namespace Direct3D11Renderer
 	//[-------------------------------------------------------]
 	void IndexBuffer::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D11RENDERER_NO_DEBUG
 			// Valid Direct3D 11 index buffer?
 			if (nullptr != mD3D11Buffer)
@@ -26,6 +26,7 @@
 #include "Direct3D11Renderer/IndexBuffer.h"
 #include "Direct3D11Renderer/VertexBuffer.h"
 #include "Direct3D11Renderer/VertexShaderCg.h"
+#include "Direct3D11Renderer/Direct3D11Renderer.h"
 #include "Direct3D11Renderer/GeometryShaderCg.h"
 #include "Direct3D11Renderer/FragmentShaderCg.h"
 #include "Direct3D11Renderer/CgRuntimeLinking.h"
@@ -119,7 +120,7 @@ namespace Direct3D11Renderer
 		if (nullptr != mVertexShaderCg && nullptr != mVertexShaderCg->getD3DBlobVertexShader())
 		{
 			// TODO(co) Add security check: Is the given resource one of the currently used renderer?
-			return new VertexArray(getDirect3D11Renderer(), *mVertexShaderCg->getD3DBlobVertexShader(), numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
+			return new (getDirect3D11Renderer().getAllocator()) VertexArray(getDirect3D11Renderer(), *mVertexShaderCg->getD3DBlobVertexShader(), numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
 		}
 		else
 		{
@@ -119,7 +119,7 @@ namespace Direct3D11Renderer
 		if (nullptr != mVertexShaderHlsl && nullptr != mVertexShaderHlsl->getD3DBlobVertexShader())
 		{
 			// TODO(co) Add security check: Is the given resource one of the currently used renderer?
-			return new VertexArray(getDirect3D11Renderer(), *mVertexShaderHlsl->getD3DBlobVertexShader(), numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
+			return new (getDirect3D11Renderer().getAllocator()) VertexArray(getDirect3D11Renderer(), *mVertexShaderHlsl->getD3DBlobVertexShader(), numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
 		}
 		else
 		{
@@ -43,8 +43,8 @@ namespace Direct3D11Renderer
 	SamplerStateCollection::SamplerStateCollection(Direct3D11Renderer &direct3D11Renderer, unsigned int numberOfSamplerStates, Renderer::ISamplerState **samplerStates) :
 		Renderer::ISamplerStateCollection(direct3D11Renderer),
 		mNumberOfD3D11SamplerStates(numberOfSamplerStates),
-		mD3D11SamplerStates((numberOfSamplerStates > 0) ? new ID3D11SamplerState*[numberOfSamplerStates] : nullptr),
-		mSamplerStates((numberOfSamplerStates > 0) ? new Renderer::ISamplerState*[numberOfSamplerStates] : nullptr)
+		mD3D11SamplerStates(direct3D11Renderer.getAllocator().allocateArray<ID3D11SamplerState*>(numberOfSamplerStates, Renderer::AllocationTag::RESOURCE)),
+		mSamplerStates(direct3D11Renderer.getAllocator().allocateArray<Renderer::ISamplerState*>(numberOfSamplerStates, Renderer::AllocationTag::RESOURCE))
 	{
 		// Loop through all given textures and gather the Direct3D 11 shader resource views
 		ID3D11SamplerState		**currentD3D11SamplerState = mD3D11SamplerStates;
@@ -84,7 +84,7 @@ namespace Direct3D11Renderer
 		// Release the allocated memory
 		if (nullptr != mD3D11SamplerStates)
 		{
-			delete [] mD3D11SamplerStates;
+			getRenderer().getAllocator().deallocateArray(mD3D11SamplerStates, Renderer::AllocationTag::RESOURCE);
 		}
 		if (nullptr != mSamplerStates)
 		{
@@ -97,7 +97,7 @@ namespace Direct3D11Renderer
 			}
 
 			// Release the allocated memory
-			delete [] mSamplerStates;
+			getRenderer().getAllocator().deallocateArray(mSamplerStates, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
@@ -32,6 +32,8 @@
 #include "Direct3D11Renderer/TessellationControlShaderCg.h"
 #include "Direct3D11Renderer/TessellationEvaluationShaderCg.h"
 
+#include <Renderer/IComputeShader.h>
+
 __pragma(warning(push))
 	__pragma(warning(disable: 4668))	// warning C4668: '<x>' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
 	#include <Cg/cgD3D11.h>
@@ -104,27 +106,27 @@ namespace Direct3D11Renderer
 
 	Renderer::IVertexShader *ShaderLanguageCg::createVertexShader(const char *sourceCode, const char *, const char *, const char *)
 	{
-		return (nullptr != mCGcontext) ? new VertexShaderCg(getDirect3D11Renderer(), *mCGcontext, sourceCode) : nullptr;
+		return (nullptr != mCGcontext) ? new (getDirect3D11Renderer().getAllocator()) VertexShaderCg(getDirect3D11Renderer(), *mCGcontext, sourceCode) : nullptr;
 	}
 
 	Renderer::ITessellationControlShader *ShaderLanguageCg::createTessellationControlShader(const char *sourceCode, const char *, const char *, const char *)
 	{
-		return (nullptr != mCGcontext) ? new TessellationControlShaderCg(getDirect3D11Renderer(), *mCGcontext, sourceCode) : nullptr;
+		return (nullptr != mCGcontext) ? new (getDirect3D11Renderer().getAllocator()) TessellationControlShaderCg(getDirect3D11Renderer(), *mCGcontext, sourceCode) : nullptr;
 	}
 
 	Renderer::ITessellationEvaluationShader *ShaderLanguageCg::createTessellationEvaluationShader(const char *sourceCode, const char *, const char *, const char *)
 	{
-		return (nullptr != mCGcontext) ? new TessellationEvaluationShaderCg(getDirect3D11Renderer(), *mCGcontext, sourceCode) : nullptr;
+		return (nullptr != mCGcontext) ? new (getDirect3D11Renderer().getAllocator()) TessellationEvaluationShaderCg(getDirect3D11Renderer(), *mCGcontext, sourceCode) : nullptr;
 	}
 
 	Renderer::IGeometryShader *ShaderLanguageCg::createGeometryShader(const char *sourceCode, Renderer::GsInputPrimitiveTopology::Enum, Renderer::GsOutputPrimitiveTopology::Enum, unsigned int, const char *, const char *, const char *)
 	{
-		return (nullptr != mCGcontext) ? new GeometryShaderCg(getDirect3D11Renderer(), *mCGcontext, sourceCode) : nullptr;
+		return (nullptr != mCGcontext) ? new (getDirect3D11Renderer().getAllocator()) GeometryShaderCg(getDirect3D11Renderer(), *mCGcontext, sourceCode) : nullptr;
 	}
 
 	Renderer::IFragmentShader *ShaderLanguageCg::createFragmentShader(const char *sourceCode, const char *, const char *, const char *)
 	{
-		return (nullptr != mCGcontext) ? new FragmentShaderCg(getDirect3D11Renderer(), *mCGcontext, sourceCode) : nullptr;
+		return (nullptr != mCGcontext) ? new (getDirect3D11Renderer().getAllocator()) FragmentShaderCg(getDirect3D11Renderer(), *mCGcontext, sourceCode) : nullptr;
 	}
 
 	Renderer::IProgram *ShaderLanguageCg::createProgram(Renderer::IVertexShader *vertexShader, Renderer::ITessellationControlShader *tessellationControlShader, Renderer::ITessellationEvaluationShader *tessellationEvaluationShader, Renderer::IGeometryShader *geometryShader, Renderer::IFragmentShader *fragmentShader)
@@ -159,7 +161,7 @@ namespace Direct3D11Renderer
 			else
 			{
 				// Create the program instance
-				return new ProgramCg(getDirect3D11Renderer(), static_cast<VertexShaderCg*>(vertexShader), static_cast<TessellationControlShaderCg*>(tessellationControlShader), static_cast<TessellationEvaluationShaderCg*>(tessellationEvaluationShader), static_cast<GeometryShaderCg*>(geometryShader), static_cast<FragmentShaderCg*>(fragmentShader));
+				return new (getDirect3D11Renderer().getAllocator()) ProgramCg(getDirect3D11Renderer(), static_cast<VertexShaderCg*>(vertexShader), static_cast<TessellationControlShaderCg*>(tessellationControlShader), static_cast<TessellationEvaluationShaderCg*>(tessellationEvaluationShader), static_cast<GeometryShaderCg*>(geometryShader), static_cast<FragmentShaderCg*>(fragmentShader));
 			}
 
 			// Error! Shader language mismatch!
@@ -195,6 +197,24 @@ namespace Direct3D11Renderer
 		return nullptr;
 	}
 
+	Renderer::IComputeShader *ShaderLanguageCg::createComputeShader(const char *, const char *, const char *, const char *)
+	{
+		// Error! Cg has no compute shader profiles, use HLSL instead.
+		return nullptr;
+	}
+
+	Renderer::IProgram *ShaderLanguageCg::createComputeProgram(Renderer::IComputeShader *computeShader)
+	{
+		// Error! Cg has no compute shader profiles, use HLSL instead.
+		// -> Ensure a correct reference counter behaviour, even in the situation of an error
+		if (nullptr != computeShader)
+		{
+			computeShader->addReference();
+			computeShader->release();
+		}
+		return nullptr;
+	}
+
 	Renderer::IUniformBuffer *ShaderLanguageCg::createUniformBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
 		// There's no point in creating a special "UniformBufferCg"-version (tried it at first)
@@ -203,7 +223,7 @@ namespace Direct3D11Renderer
 		//    "When the next program bind operation occurs, each buffer index which is set to a valid buffer handle is bound (along with the program) for use by the 3D API"
 		//    -> This behaviour is not handy, asking Cg for the Direct3D 11 buffer and using it directly is not really working as well
 		//    -> Save us all the trouble and just use Direct3D 11 uniform buffers directly, issues resolved
-		return new UniformBuffer(getDirect3D11Renderer(), numberOfBytes, data, bufferUsage);
+		return new (getDirect3D11Renderer().getUniformBufferPool()) UniformBuffer(getDirect3D11Renderer(), numberOfBytes, data, bufferUsage);
 	}
 
 
@@ -32,6 +32,8 @@
 #include "Direct3D11Renderer/TessellationControlShaderHlsl.h"
 #include "Direct3D11Renderer/TessellationEvaluationShaderHlsl.h"
 
+#include <Renderer/IComputeShader.h>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -121,7 +123,7 @@ namespace Direct3D11Renderer
 	Renderer::IVertexShader *ShaderLanguageHlsl::createVertexShader(const char *sourceCode, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::vertexShader", we know there's vertex shader support
-		return new VertexShaderHlsl(getDirect3D11Renderer(), sourceCode);
+		return new (getDirect3D11Renderer().getAllocator()) VertexShaderHlsl(getDirect3D11Renderer(), sourceCode);
 	}
 
 	Renderer::ITessellationControlShader *ShaderLanguageHlsl::createTessellationControlShader(const char *sourceCode, const char *, const char *, const char *)
@@ -129,7 +131,7 @@ namespace Direct3D11Renderer
 		// "hull shader" in Direct3D terminology
 
 		// There's no need to check for "Renderer::Capabilities::maximumNumberOfPatchVertices", we know there's tessellation control shader support
-		return new TessellationControlShaderHlsl(getDirect3D11Renderer(), sourceCode);
+		return new (getDirect3D11Renderer().getAllocator()) TessellationControlShaderHlsl(getDirect3D11Renderer(), sourceCode);
 	}
 
 	Renderer::ITessellationEvaluationShader *ShaderLanguageHlsl::createTessellationEvaluationShader(const char *sourceCode, const char *, const char *, const char *)
@@ -137,7 +139,7 @@ namespace Direct3D11Renderer
 		// "domain shader" in Direct3D terminology
 
 		// There's no need to check for "Renderer::Capabilities::maximumNumberOfPatchVertices", we know there's tessellation evaluation shader support
-		return new TessellationEvaluationShaderHlsl(getDirect3D11Renderer(), sourceCode);
+		return new (getDirect3D11Renderer().getAllocator()) TessellationEvaluationShaderHlsl(getDirect3D11Renderer(), sourceCode);
 	}
 
 	Renderer::IGeometryShader *ShaderLanguageHlsl::createGeometryShader(const char *sourceCode, Renderer::GsInputPrimitiveTopology::Enum, Renderer::GsOutputPrimitiveTopology::Enum, unsigned int, const char *, const char *, const char *)
@@ -147,13 +149,13 @@ namespace Direct3D11Renderer
 		// Ignore "numberOfOutputVertices", it's directly set within HLSL
 
 		// There's no need to check for "Renderer::Capabilities::maximumNumberOfGsOutputVertices", we know there's geometry shader support
-		return new GeometryShaderHlsl(getDirect3D11Renderer(), sourceCode);
+		return new (getDirect3D11Renderer().getAllocator()) GeometryShaderHlsl(getDirect3D11Renderer(), sourceCode);
 	}
 
 	Renderer::IFragmentShader *ShaderLanguageHlsl::createFragmentShader(const char *sourceCode, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::fragmentShader", we know there's fragment shader support
-		return new FragmentShaderHlsl(getDirect3D11Renderer(), sourceCode);
+		return new (getDirect3D11Renderer().getAllocator()) FragmentShaderHlsl(getDirect3D11Renderer(), sourceCode);
 	}
 
 	Renderer::IProgram *ShaderLanguageHlsl::createProgram(Renderer::IVertexShader *vertexShader, Renderer::ITessellationControlShader *tessellationControlShader, Renderer::ITessellationEvaluationShader *tessellationEvaluationShader, Renderer::IGeometryShader *geometryShader, Renderer::IFragmentShader *fragmentShader)
@@ -185,7 +187,7 @@ namespace Direct3D11Renderer
 		else
 		{
 			// Create the program
-			return new ProgramHlsl(getDirect3D11Renderer(), static_cast<VertexShaderHlsl*>(vertexShader), static_cast<TessellationControlShaderHlsl*>(tessellationControlShader), static_cast<TessellationEvaluationShaderHlsl*>(tessellationEvaluationShader), static_cast<GeometryShaderHlsl*>(geometryShader), static_cast<FragmentShaderHlsl*>(fragmentShader));
+			return new (getDirect3D11Renderer().getAllocator()) ProgramHlsl(getDirect3D11Renderer(), static_cast<VertexShaderHlsl*>(vertexShader), static_cast<TessellationControlShaderHlsl*>(tessellationControlShader), static_cast<TessellationEvaluationShaderHlsl*>(tessellationEvaluationShader), static_cast<GeometryShaderHlsl*>(geometryShader), static_cast<FragmentShaderHlsl*>(fragmentShader));
 		}
 
 		// Error! Shader language mismatch!
@@ -220,9 +222,27 @@ namespace Direct3D11Renderer
 		return nullptr;
 	}
 
+	Renderer::IComputeShader *ShaderLanguageHlsl::createComputeShader(const char *, const char *, const char *, const char *)
+	{
+		// TODO(co) Direct3D 11 compute shader ("cs_5_0") support is not implemented, yet.
+		return nullptr;
+	}
+
+	Renderer::IProgram *ShaderLanguageHlsl::createComputeProgram(Renderer::IComputeShader *computeShader)
+	{
+		// TODO(co) Direct3D 11 compute shader ("cs_5_0") support is not implemented, yet.
+		// -> Ensure a correct reference counter behaviour, even in the situation of an error
+		if (nullptr != computeShader)
+		{
+			computeShader->addReference();
+			computeShader->release();
+		}
+		return nullptr;
+	}
+
 	Renderer::IUniformBuffer *ShaderLanguageHlsl::createUniformBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
-		return new UniformBuffer(getDirect3D11Renderer(), numberOfBytes, data, bufferUsage);
+		return new (getDirect3D11Renderer().getUniformBufferPool()) UniformBuffer(getDirect3D11Renderer(), numberOfBytes, data, bufferUsage);
 	}
 
 
@@ -45,7 +45,9 @@ namespace Direct3D11Renderer
 		ISwapChain(direct3D11Renderer),
 		mDxgiSwapChain(nullptr),
 		mD3D11RenderTargetView(nullptr),
-		mD3D11DepthStencilView(nullptr)
+		mD3D11DepthStencilView(nullptr),
+		mSwapInterval(0),
+		mFramePacer(direct3D11Renderer)
 	{
 		// Get the Direct3D 11 device instance
 		ID3D11Device *d3d11Device = direct3D11Renderer.getD3D11Device();
@@ -159,6 +161,9 @@ namespace Direct3D11Renderer
 	//[-------------------------------------------------------]
 	void SwapChain::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D11RENDERER_NO_DEBUG
 			// Assign a debug name to the DXGI swap chain
 			if (nullptr != mDxgiSwapChain)
@@ -265,7 +270,9 @@ namespace Direct3D11Renderer
 		// Is there a valid swap chain?
 		if (nullptr != mDxgiSwapChain)
 		{
-			mDxgiSwapChain->Present(0, 0);
+			mFramePacer.beginPresent();
+			mDxgiSwapChain->Present(static_cast<UINT>(mSwapInterval), 0);
+			mFramePacer.endPresent();
 		}
 	}
 
@@ -344,6 +351,46 @@ namespace Direct3D11Renderer
 		}
 	}
 
+	int SwapChain::getSwapInterval() const
+	{
+		return mSwapInterval;
+	}
+
+	bool SwapChain::setSwapInterval(int swapInterval)
+	{
+		// DXGI 1.0 has no adaptive vertical synchronization, fall back to regular vertical synchronization
+		if (swapInterval < 0)
+		{
+			swapInterval = -swapInterval;
+		}
+
+		// "IDXGISwapChain::Present()" accepts sync intervals between 0 and 4
+		if (swapInterval > 4)
+		{
+			// Error!
+			return false;
+		}
+
+		// Done
+		mSwapInterval = swapInterval;
+		return true;
+	}
+
+	unsigned int SwapChain::getMaximumFrameLatency() const
+	{
+		return mFramePacer.getMaximumFrameLatency();
+	}
+
+	void SwapChain::setMaximumFrameLatency(unsigned int maximumFrameLatency)
+	{
+		mFramePacer.setMaximumFrameLatency(maximumFrameLatency);
+	}
+
+	const Renderer::PresentStatistics &SwapChain::getPresentStatistics() const
+	{
+		return mFramePacer.getPresentStatistics();
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -405,6 +452,10 @@ namespace Direct3D11Renderer
 				UINT height = 1;
 				getSafeWidthAndHeight(width, height);
 
+				// Set the estimated number of bytes of the swap chain
+				// -> Back buffer with 32 bit color and a 32 bit depth stencil buffer
+				setNumberOfBytes(static_cast<unsigned long long>(width) * height * (4 + 4));
+
 				// Create depth stencil texture
 				ID3D11Texture2D *d3d11Texture2DDepthStencil = nullptr;
 				D3D11_TEXTURE2D_DESC d3d11Texture2DDesc;
@@ -42,15 +42,20 @@ namespace Direct3D11Renderer
 	*  @brief
 	*    Constructor
 	*/
-	Texture2D::Texture2D(Direct3D11Renderer &direct3D11Renderer, unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage) :
+	Texture2D::Texture2D(Direct3D11Renderer &direct3D11Renderer, unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage, unsigned int numberOfMultisamples) :
 		ITexture2D(direct3D11Renderer, width, height),
-		mD3D11ShaderResourceViewTexture(nullptr)
+		mD3D11Texture2D(nullptr),
+		mD3D11ShaderResourceViewTexture(nullptr),
+		mTextureFormat(textureFormat)
 	{
+		// Set the estimated number of bytes of the texture, multisample textures have no mipmaps
+		setNumberOfBytes(calculateNumberOfBytes(width, height, 1, Mapping::getDirect3D11Size(textureFormat), (numberOfMultisamples <= 1 && 0 != (flags & Renderer::TextureFlag::MIPMAPS)), numberOfMultisamples));
+
 		// Begin debug event
 		RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(&direct3D11Renderer)
 
-		// Generate mipmaps?
-		const bool mipmaps = (flags & Renderer::TextureFlag::MIPMAPS);
+		// Generate mipmaps? (multisample textures can't have mipmaps)
+		const bool mipmaps = ((flags & Renderer::TextureFlag::MIPMAPS) && numberOfMultisamples <= 1);
 
 		// Direct3D 11 2D texture description
 		D3D11_TEXTURE2D_DESC d3d11Texture2DDesc;
@@ -59,7 +64,7 @@ namespace Direct3D11Renderer
 		d3d11Texture2DDesc.MipLevels		  = mipmaps ? 0u : 1u;	// 0 = Let Direct3D 11 allocate the complete mipmap chain for us
 		d3d11Texture2DDesc.ArraySize		  = 1;
 		d3d11Texture2DDesc.Format			  = static_cast<DXGI_FORMAT>(Mapping::getDirect3D11Format(textureFormat));
-		d3d11Texture2DDesc.SampleDesc.Count	  = 1;
+		d3d11Texture2DDesc.SampleDesc.Count	  = numberOfMultisamples;
 		d3d11Texture2DDesc.SampleDesc.Quality = 0;
 		d3d11Texture2DDesc.Usage			  = static_cast<D3D11_USAGE>(textureUsage);	// These constants directly map to Direct3D constants, do not change them
 		d3d11Texture2DDesc.BindFlags		  = D3D11_BIND_SHADER_RESOURCE;
@@ -72,44 +77,52 @@ namespace Direct3D11Renderer
 			d3d11Texture2DDesc.BindFlags |= D3D11_BIND_RENDER_TARGET;
 		}
 
+		// Staging textures can't be bound to a pipeline stage, they are used for GPU to CPU readback
+		const bool staging = (Renderer::TextureUsage::STAGING == textureUsage);
+		if (staging)
+		{
+			d3d11Texture2DDesc.BindFlags	  = 0;
+			d3d11Texture2DDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ | D3D11_CPU_ACCESS_WRITE;
+		}
+
 		// Create the Direct3D 11 2D texture instance
 		// -> Do not provide the data at once or creating mipmaps will get somewhat complicated
-		ID3D11Texture2D *d3d11Texture2D = nullptr;
-		direct3D11Renderer.getD3D11Device()->CreateTexture2D(&d3d11Texture2DDesc, nullptr, &d3d11Texture2D);
-		if (nullptr != d3d11Texture2D)
+		direct3D11Renderer.getD3D11Device()->CreateTexture2D(&d3d11Texture2DDesc, nullptr, &mD3D11Texture2D);
+		if (nullptr != mD3D11Texture2D)
 		{
 			// Calculate the number of mipmaps
 			const unsigned int numberOfMipmaps = mipmaps ? getNumberOfMipmaps(width, height) : 1;
 
-			// Data given?
-			if (nullptr != data)
+			// Data given? (multisample and staging textures can't be initialized by uploading data)
+			if (nullptr != data && numberOfMultisamples <= 1 && !staging)
 			{
 				{ // Update Direct3D 11 subresource data of the base-map
 					const unsigned int bytesPerRow   = width * Mapping::getDirect3D11Size(textureFormat);
 					const unsigned int bytesPerSlice = bytesPerRow * height;
-					direct3D11Renderer.getD3D11DeviceContext()->UpdateSubresource(d3d11Texture2D, 0, nullptr, data, bytesPerRow, bytesPerSlice);
+					direct3D11Renderer.getD3D11DeviceContext()->UpdateSubresource(mD3D11Texture2D, 0, nullptr, data, bytesPerRow, bytesPerSlice);
 				}
 
 				// Let Direct3D 11 generate the mipmaps for us automatically?
 				if (mipmaps)
 				{
-					D3DX11FilterTexture(direct3D11Renderer.getD3D11DeviceContext(), d3d11Texture2D, 0, D3DX11_DEFAULT);
+					D3DX11FilterTexture(direct3D11Renderer.getD3D11DeviceContext(), mD3D11Texture2D, 0, D3DX11_DEFAULT);
 				}
 			}
 
-			// Direct3D 11 shader resource view description
-			D3D11_SHADER_RESOURCE_VIEW_DESC d3d11ShaderResourceViewDesc;
-			::ZeroMemory(&d3d11ShaderResourceViewDesc, sizeof(d3d11ShaderResourceViewDesc));
-			d3d11ShaderResourceViewDesc.Format					  = d3d11Texture2DDesc.Format;
-			d3d11ShaderResourceViewDesc.ViewDimension			  = D3D11_SRV_DIMENSION_TEXTURE2D;
-			d3d11ShaderResourceViewDesc.Texture2D.MipLevels		  = numberOfMipmaps;
-			d3d11ShaderResourceViewDesc.Texture2D.MostDetailedMip = 0;
-
-			// Create the Direct3D 11 shader resource view instance
-			direct3D11Renderer.getD3D11Device()->CreateShaderResourceView(d3d11Texture2D, &d3d11ShaderResourceViewDesc, &mD3D11ShaderResourceViewTexture);
-
-			// Release the Direct3D 11 2D texture instance
-			d3d11Texture2D->Release();
+			// Staging textures can't have a shader resource view
+			if (!staging)
+			{
+				// Direct3D 11 shader resource view description
+				D3D11_SHADER_RESOURCE_VIEW_DESC d3d11ShaderResourceViewDesc;
+				::ZeroMemory(&d3d11ShaderResourceViewDesc, sizeof(d3d11ShaderResourceViewDesc));
+				d3d11ShaderResourceViewDesc.Format					  = d3d11Texture2DDesc.Format;
+				d3d11ShaderResourceViewDesc.ViewDimension			  = (numberOfMultisamples > 1) ? D3D11_SRV_DIMENSION_TEXTURE2DMS : D3D11_SRV_DIMENSION_TEXTURE2D;
+				d3d11ShaderResourceViewDesc.Texture2D.MipLevels		  = numberOfMipmaps;
+				d3d11ShaderResourceViewDesc.Texture2D.MostDetailedMip = 0;
+
+				// Create the Direct3D 11 shader resource view instance
+				direct3D11Renderer.getD3D11Device()->CreateShaderResourceView(mD3D11Texture2D, &d3d11ShaderResourceViewDesc, &mD3D11ShaderResourceViewTexture);
+			}
 		}
 
 		// Assign a default name to the resource for debugging purposes
@@ -131,6 +144,10 @@ namespace Direct3D11Renderer
 		{
 			mD3D11ShaderResourceViewTexture->Release();
 		}
+		if (nullptr != mD3D11Texture2D)
+		{
+			mD3D11Texture2D->Release();
+		}
 	}
 
 
@@ -139,6 +156,9 @@ namespace Direct3D11Renderer
 	//[-------------------------------------------------------]
 	void Texture2D::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D11RENDERER_NO_DEBUG
 			// Valid Direct3D 11 shader resource view?
 			if (nullptr != mD3D11ShaderResourceViewTexture)
@@ -147,28 +167,45 @@ namespace Direct3D11Renderer
 				// -> First: Ensure that there's no previous private data, else we might get slapped with a warning!
 				mD3D11ShaderResourceViewTexture->SetPrivateData(WKPDID_D3DDebugObjectName, 0, nullptr);
 				mD3D11ShaderResourceViewTexture->SetPrivateData(WKPDID_D3DDebugObjectName, strlen(name), name);
+			}
 
-				// Do also set the given debug name to the Direct3D 11 resource referenced by the Direct3D resource view
-				// -> In our use case, this resource is tightly coupled with the view
-				// -> In principle the user can assign another resource to the view, but our interface documentation
-				//    asks the user to not do so, so we ignore this situation when assigning the name
-				ID3D11Resource *d3d11Resource = nullptr;
-				mD3D11ShaderResourceViewTexture->GetResource(&d3d11Resource);
-				if (nullptr != d3d11Resource)
-				{
-					// Set the debug name
-					// -> First: Ensure that there's no previous private data, else we might get slapped with a warning!
-					d3d11Resource->SetPrivateData(WKPDID_D3DDebugObjectName, 0, nullptr);
-					d3d11Resource->SetPrivateData(WKPDID_D3DDebugObjectName, strlen(name), name);
-
-					// Release the Direct3D 11 resource instance
-					d3d11Resource->Release();
-				}
+			// Valid Direct3D 11 2D texture?
+			if (nullptr != mD3D11Texture2D)
+			{
+				// Set the debug name
+				// -> First: Ensure that there's no previous private data, else we might get slapped with a warning!
+				mD3D11Texture2D->SetPrivateData(WKPDID_D3DDebugObjectName, 0, nullptr);
+				mD3D11Texture2D->SetPrivateData(WKPDID_D3DDebugObjectName, strlen(name), name);
 			}
 		#endif
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2D methods           ]
+	//[-------------------------------------------------------]
+	void Texture2D::updateRegion(unsigned int mipmap, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data)
+	{
+		// Valid Direct3D 11 2D texture and data given?
+		if (nullptr != mD3D11Texture2D && nullptr != data)
+		{
+			// Get the number of mipmaps
+			D3D11_TEXTURE2D_DESC d3d11Texture2DDesc;
+			mD3D11Texture2D->GetDesc(&d3d11Texture2DDesc);
+
+			// Multisample and staging textures can't be updated by uploading data
+			if (mipmap < d3d11Texture2DDesc.MipLevels && 1 == d3d11Texture2DDesc.SampleDesc.Count && D3D11_USAGE_STAGING != d3d11Texture2DDesc.Usage)
+			{
+				// Update Direct3D 11 subresource data of the given region
+				const D3D11_BOX d3d11Box = { x, y, 0, x + width, y + height, 1 };
+				const unsigned int bytesPerRow   = width * Mapping::getDirect3D11Size(mTextureFormat);
+				const unsigned int bytesPerSlice = bytesPerRow * height;
+				static_cast<Direct3D11Renderer&>(getRenderer()).getD3D11DeviceContext()->UpdateSubresource(mD3D11Texture2D, D3D11CalcSubresource(mipmap, 0, d3d11Texture2DDesc.MipLevels), &d3d11Box, data, bytesPerRow, bytesPerSlice);
+			}
+		}
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
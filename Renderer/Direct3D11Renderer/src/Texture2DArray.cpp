@@ -44,8 +44,12 @@ namespace Direct3D11Renderer
 	*/
 	Texture2DArray::Texture2DArray(Direct3D11Renderer &direct3D11Renderer, unsigned int width, unsigned int height, unsigned int numberOfSlices, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage) :
 		ITexture2DArray(direct3D11Renderer, width, height, numberOfSlices),
-		mD3D11ShaderResourceViewTexture(nullptr)
+		mD3D11ShaderResourceViewTexture(nullptr),
+		mTextureFormat(textureFormat)
 	{
+		// Set the estimated number of bytes of the texture array
+		setNumberOfBytes(calculateNumberOfBytes(width, height, numberOfSlices, Mapping::getDirect3D11Size(textureFormat), 0 != (flags & Renderer::TextureFlag::MIPMAPS), 1));
+
 		// Begin debug event
 		RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(&direct3D11Renderer)
 
@@ -144,6 +148,9 @@ namespace Direct3D11Renderer
 	//[-------------------------------------------------------]
 	void Texture2DArray::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D11RENDERER_NO_DEBUG
 			// Valid Direct3D 11 shader resource view?
 			if (nullptr != mD3D11ShaderResourceViewTexture)
@@ -174,6 +181,39 @@ namespace Direct3D11Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2DArray methods      ]
+	//[-------------------------------------------------------]
+	void Texture2DArray::updateRegion(unsigned int mipmap, unsigned int slice, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data)
+	{
+		// Valid Direct3D 11 shader resource view and data given?
+		if (nullptr != mD3D11ShaderResourceViewTexture && nullptr != data && slice < getNumberOfSlices())
+		{
+			// Get the Direct3D 11 resource referenced by the Direct3D resource view
+			ID3D11Resource *d3d11Resource = nullptr;
+			mD3D11ShaderResourceViewTexture->GetResource(&d3d11Resource);
+			if (nullptr != d3d11Resource)
+			{
+				// Get the number of mipmaps
+				D3D11_SHADER_RESOURCE_VIEW_DESC d3d11ShaderResourceViewDesc;
+				mD3D11ShaderResourceViewTexture->GetDesc(&d3d11ShaderResourceViewDesc);
+				const unsigned int numberOfMipmaps = d3d11ShaderResourceViewDesc.Texture2DArray.MipLevels;
+				if (mipmap < numberOfMipmaps)
+				{
+					// Update Direct3D 11 subresource data of the given region
+					const D3D11_BOX d3d11Box = { x, y, 0, x + width, y + height, 1 };
+					const unsigned int bytesPerRow   = width * Mapping::getDirect3D11Size(mTextureFormat);
+					const unsigned int bytesPerSlice = bytesPerRow * height;
+					static_cast<Direct3D11Renderer&>(getRenderer()).getD3D11DeviceContext()->UpdateSubresource(d3d11Resource, D3D11CalcSubresource(mipmap, slice, numberOfMipmaps), &d3d11Box, data, bytesPerRow, bytesPerSlice);
+				}
+
+				// Release the Direct3D 11 resource instance
+				d3d11Resource->Release();
+			}
+		}
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
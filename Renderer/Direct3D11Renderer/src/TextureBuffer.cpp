@@ -47,6 +47,9 @@ namespace Direct3D11Renderer
 		mD3D11Buffer(nullptr),
 		mD3D11ShaderResourceViewTexture(nullptr)
 	{
+		// Set the estimated number of bytes of the texture buffer
+		setNumberOfBytes(numberOfBytes);
+
 		{ // Buffer part
 			// Direct3D 11 buffer description
 			D3D11_BUFFER_DESC d3d11BufferDesc;
@@ -120,6 +123,9 @@ namespace Direct3D11Renderer
 	//[-------------------------------------------------------]
 	void TextureBuffer::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D11RENDERER_NO_DEBUG
 			// Assign a debug name to the shader resource view
 			if (nullptr != mD3D11ShaderResourceViewTexture)
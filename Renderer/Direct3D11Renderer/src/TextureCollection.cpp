@@ -45,8 +45,8 @@ namespace Direct3D11Renderer
 	TextureCollection::TextureCollection(Direct3D11Renderer &direct3D11Renderer, unsigned int numberOfTextures, Renderer::ITexture **textures) :
 		Renderer::ITextureCollection(direct3D11Renderer),
 		mNumberOfD3D11ShaderResourceViews(numberOfTextures),
-		mD3D11ShaderResourceViews((numberOfTextures > 0) ? new ID3D11ShaderResourceView*[numberOfTextures] : nullptr),
-		mTextures((numberOfTextures > 0) ? new Renderer::ITexture*[numberOfTextures] : nullptr)
+		mD3D11ShaderResourceViews(direct3D11Renderer.getAllocator().allocateArray<ID3D11ShaderResourceView*>(numberOfTextures, Renderer::AllocationTag::RESOURCE)),
+		mTextures(direct3D11Renderer.getAllocator().allocateArray<Renderer::ITexture*>(numberOfTextures, Renderer::AllocationTag::RESOURCE))
 	{
 		// Loop through all given textures and gather the Direct3D 11 shader resource views
 		ID3D11ShaderResourceView **currentD3D11ShaderResourceView = mD3D11ShaderResourceViews;
@@ -94,6 +94,7 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::RASTERIZER_STATE:
 				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
 				case Renderer::ResourceType::BLEND_STATE:
@@ -103,8 +104,10 @@ namespace Direct3D11Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Not handled in here
 					break;
@@ -121,7 +124,7 @@ namespace Direct3D11Renderer
 		// Release the allocated memory
 		if (nullptr != mD3D11ShaderResourceViews)
 		{
-			delete [] mD3D11ShaderResourceViews;
+			getRenderer().getAllocator().deallocateArray(mD3D11ShaderResourceViews, Renderer::AllocationTag::RESOURCE);
 		}
 		if (nullptr != mTextures)
 		{
@@ -134,7 +137,7 @@ namespace Direct3D11Renderer
 			}
 
 			// Release the allocated memory
-			delete [] mTextures;
+			getRenderer().getAllocator().deallocateArray(mTextures, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
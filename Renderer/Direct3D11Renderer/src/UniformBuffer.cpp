@@ -46,6 +46,9 @@ namespace Direct3D11Renderer
 		Renderer::IUniformBuffer(direct3D11Renderer),
 		mD3D11Buffer(nullptr)
 	{
+		// Set the estimated number of bytes of the uniform buffer
+		setNumberOfBytes(numberOfBytes);
+
 		// TODO(co) Uniform buffer byte alignment: Is it fine to support the user in here (ease of use) or is this 100% the responsibility of the user? (possible negative side effects)
 		// Check the given number of bytes, if we don't do this we might get told
 		//   "... the ByteWidth (value = <x>) must be a multiple of 16 and be less than or equal to 65536"
@@ -109,6 +112,9 @@ namespace Direct3D11Renderer
 	//[-------------------------------------------------------]
 	void UniformBuffer::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D11RENDERER_NO_DEBUG
 			// Valid Direct3D 11 uniform buffer?
 			if (nullptr != mD3D11Buffer)
@@ -68,7 +68,7 @@ namespace Direct3D11Renderer
 		// Add a reference to the used vertex buffers
 		if (numberOfAttributes > 0)
 		{
-			mVertexBuffers = new VertexBuffer*[numberOfAttributes];
+			mVertexBuffers = getRenderer().getAllocator().allocateArray<VertexBuffer*>(numberOfAttributes, Renderer::AllocationTag::RESOURCE);
 
 			// Loop through all attributes
 			VertexBuffer **vertexBuffers = mVertexBuffers;
@@ -93,7 +93,7 @@ namespace Direct3D11Renderer
 		// -> Direct3D 11 don't like it when the first parameter of "D3D10Device::CreateInputLayout()" is a null pointer:
 		//      "D3D11: ERROR: ID3D11Device::CreateInputLayout: NULL pDesc specified! [ STATE_CREATION ERROR #164: CREATEINPUTLAYOUT_NULLDESC ]"
 		//    Handle this case.
-		D3D11_INPUT_ELEMENT_DESC *d3d11InputElementDescs   = numberOfAttributes ? new D3D11_INPUT_ELEMENT_DESC[numberOfAttributes] : new D3D11_INPUT_ELEMENT_DESC[1];
+		D3D11_INPUT_ELEMENT_DESC *d3d11InputElementDescs   = getRenderer().getAllocator().allocateArray<D3D11_INPUT_ELEMENT_DESC>(numberOfAttributes ? numberOfAttributes : 1, Renderer::AllocationTag::TEMPORARY);
 		D3D11_INPUT_ELEMENT_DESC *d3d11InputElementDesc    = d3d11InputElementDescs;
 		D3D11_INPUT_ELEMENT_DESC *d3d11InputElementDescEnd = d3d11InputElementDescs + numberOfAttributes;
 		for (; d3d11InputElementDesc < d3d11InputElementDescEnd; ++d3d11InputElementDesc, ++attributes)
@@ -131,7 +131,7 @@ namespace Direct3D11Renderer
 				else
 				{
 					// Error! Clean up and get us out of here right now!
-					delete [] d3d11InputElementDescs;
+					getRenderer().getAllocator().deallocateArray(d3d11InputElementDescs, Renderer::AllocationTag::TEMPORARY);
 					return;	// Ugly return, but we haven't much choice in here
 				}
 			}
@@ -160,7 +160,7 @@ namespace Direct3D11Renderer
 		direct3D11Renderer.getD3D11Device()->CreateInputLayout(d3d11InputElementDescs, numberOfAttributes, d3dBlob.GetBufferPointer(), d3dBlob.GetBufferSize(), &mD3D11InputLayout);
 
 		// Destroy Direct3D 11 input element descriptions
-		delete [] d3d11InputElementDescs;
+		getRenderer().getAllocator().deallocateArray(d3d11InputElementDescs, Renderer::AllocationTag::TEMPORARY);
 
 		// Valid Direct3D 11 input layout?
 		if (nullptr != mD3D11InputLayout && numberOfAttributes > 0)
@@ -169,15 +169,15 @@ namespace Direct3D11Renderer
 			mNumberOfSlots = numberOfUsedSlots;
 
 			// Buffers
-			mD3D11Buffers = new ID3D11Buffer*[mNumberOfSlots];
+			mD3D11Buffers = getRenderer().getAllocator().allocateArray<ID3D11Buffer*>(mNumberOfSlots, Renderer::AllocationTag::RESOURCE);
 			memcpy(mD3D11Buffers, d3d11BufferAtSlot, sizeof(ID3D11Buffer*) * mNumberOfSlots);
 
 			// Strides
-			mStrides = new UINT[mNumberOfSlots];
+			mStrides = getRenderer().getAllocator().allocateArray<UINT>(mNumberOfSlots, Renderer::AllocationTag::RESOURCE);
 			memcpy(mStrides, strideAtSlot, sizeof(UINT) * mNumberOfSlots);
 
 			// Offsets
-			mOffsets = new UINT[mNumberOfSlots];
+			mOffsets = getRenderer().getAllocator().allocateArray<UINT>(mNumberOfSlots, Renderer::AllocationTag::RESOURCE);
 			memset(mOffsets, 0, sizeof(UINT) * mNumberOfSlots);
 		}
 
@@ -208,9 +208,9 @@ namespace Direct3D11Renderer
 		// Cleanup Direct3D 11 input slot data
 		if (nullptr != mD3D11Buffers)
 		{
-			delete [] mD3D11Buffers;
-			delete [] mStrides;
-			delete [] mOffsets;
+			getRenderer().getAllocator().deallocateArray(mD3D11Buffers, Renderer::AllocationTag::RESOURCE);
+			getRenderer().getAllocator().deallocateArray(mStrides, Renderer::AllocationTag::RESOURCE);
+			getRenderer().getAllocator().deallocateArray(mOffsets, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Release the reference to the used vertex buffers
@@ -224,7 +224,7 @@ namespace Direct3D11Renderer
 			}
 
 			// Cleanup
-			delete [] mVertexBuffers;
+			getRenderer().getAllocator().deallocateArray(mVertexBuffers, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Release our Direct3D 11 device context reference
@@ -46,6 +46,9 @@ namespace Direct3D11Renderer
 		IVertexBuffer(direct3D11Renderer),
 		mD3D11Buffer(nullptr)
 	{
+		// Set the estimated number of bytes of the vertex buffer
+		setNumberOfBytes(numberOfBytes);
+
 		// Direct3D 11 buffer description
 		D3D11_BUFFER_DESC d3d11BufferDesc;
 		d3d11BufferDesc.ByteWidth           = numberOfBytes;
@@ -97,6 +100,9 @@ namespace Direct3D11Renderer
 	//[-------------------------------------------------------]
 	void VertexBuffer::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D11RENDERER_NO_DEBUG
 			// Valid Direct3D 11 vertex buffer?
 			if (nullptr != mD3D11Buffer)
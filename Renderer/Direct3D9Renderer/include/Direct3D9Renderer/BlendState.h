@@ -57,7 +57,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    Direct3D 9 blend state class
 	*/
-	class BlendState : public Renderer::IBlendState
+	class BlendState final : public Renderer::IBlendState
 	{
 
 
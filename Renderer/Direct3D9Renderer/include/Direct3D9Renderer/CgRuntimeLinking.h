@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <Renderer/AllocatorObject.h>
 #include <Cg/cgD3D9.h>
 
 
@@ -46,7 +47,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    Cg runtime linking
 	*/
-	class CgRuntimeLinking
+	class CgRuntimeLinking : public Renderer::AllocatorObject<Renderer::AllocationTag::RENDERER>
 	{
 
 
@@ -57,7 +57,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    Direct3D 9 depth stencil state class
 	*/
-	class DepthStencilState : public Renderer::IDepthStencilState
+	class DepthStencilState final : public Renderer::IDepthStencilState
 	{
 
 
@@ -30,6 +30,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <Renderer/IRenderer.h>
+#include <Renderer/ResourcePool.h>
 
 
 //[-------------------------------------------------------]
@@ -69,7 +70,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    Direct3D 9 renderer class
 	*/
-	class Direct3D9Renderer : public Renderer::IRenderer
+	class Direct3D9Renderer final : public Renderer::IRenderer
 	{
 
 
@@ -83,11 +84,13 @@ namespace Direct3D9Renderer
 		*
 		*  @param[in] nativeWindowHandle
 		*    Optional native main window handle, can be a null handle
+		*  @param[in] allocator
+		*    Allocator to use, can be a null pointer ("Renderer::DefaultAllocator" is used in this case), must stay valid as long as the renderer instance exists
 		*
 		*  @note
 		*    - Do never ever use a not properly initialized renderer! Use "Renderer::IRenderer::isInitialized()" to check the initialization state.
 		*/
-		explicit Direct3D9Renderer(handle nativeWindowHandle);
+		Direct3D9Renderer(handle nativeWindowHandle, Renderer::IAllocator *allocator);
 
 		/**
 		*  @brief
@@ -135,7 +138,8 @@ namespace Direct3D9Renderer
 		virtual Renderer::IVertexBuffer *createVertexBuffer(unsigned int numberOfBytes, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
 		virtual Renderer::IIndexBuffer *createIndexBuffer(unsigned int numberOfBytes, Renderer::IndexBufferFormat::Enum indexBufferFormat, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
 		virtual Renderer::ITextureBuffer *createTextureBuffer(unsigned int numberOfBytes, Renderer::TextureFormat::Enum textureFormat, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
-		virtual Renderer::ITexture2D *createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, Renderer::TextureUsage::Enum textureUsage = Renderer::TextureUsage::DEFAULT) override;
+		virtual Renderer::IIndirectBuffer *createIndirectBuffer(unsigned int numberOfBytes, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
+		virtual Renderer::ITexture2D *createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, Renderer::TextureUsage::Enum textureUsage = Renderer::TextureUsage::DEFAULT, unsigned int numberOfMultisamples = 1) override;
 		virtual Renderer::ITexture2DArray *createTexture2DArray(unsigned int width, unsigned int height, unsigned int numberOfSlices, Renderer::TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, Renderer::TextureUsage::Enum textureUsage = Renderer::TextureUsage::DEFAULT) override;
 		virtual Renderer::IRasterizerState *createRasterizerState(const Renderer::RasterizerState &rasterizerState) override;
 		virtual Renderer::IDepthStencilState *createDepthStencilState(const Renderer::DepthStencilState &depthStencilState) override;
@@ -148,6 +152,8 @@ namespace Direct3D9Renderer
 		//[-------------------------------------------------------]
 		virtual bool map(Renderer::IResource &resource, unsigned int subresource, Renderer::MapType::Enum mapType, unsigned int mapFlags, Renderer::MappedSubresource &mappedSubresource) override;
 		virtual void unmap(Renderer::IResource &resource, unsigned int subresource) override;
+		virtual bool copyResource(Renderer::IResource &destinationResource, Renderer::IResource &sourceResource) override;
+		virtual void setTextureResident(Renderer::ITexture &texture, Renderer::ISamplerState *samplerState, bool resident) override;
 		//[-------------------------------------------------------]
 		//[ States                                                ]
 		//[-------------------------------------------------------]
@@ -190,6 +196,12 @@ namespace Direct3D9Renderer
 		virtual void gsSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection) override;
 		virtual void gsSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer) override;
 		//[-------------------------------------------------------]
+		//[ Stream-output (SO) stage                              ]
+		//[-------------------------------------------------------]
+		virtual void soSetTargets(unsigned int numberOfTargets, Renderer::IVertexBuffer **vertexBuffers, const unsigned int *offsets = nullptr) override;
+		virtual void soBegin(Renderer::PrimitiveTopology::Enum primitiveTopology, bool rasterizerDiscard = true) override;
+		virtual void soEnd() override;
+		//[-------------------------------------------------------]
 		//[ Rasterizer (RS) stage                                 ]
 		//[-------------------------------------------------------]
 		virtual void rsSetViewports(unsigned int numberOfViewports, const Renderer::Viewport *viewports) override;
@@ -211,11 +223,21 @@ namespace Direct3D9Renderer
 		virtual void omSetDepthStencilState(Renderer::IDepthStencilState *depthStencilState) override;
 		virtual void omSetBlendState(Renderer::IBlendState *blendState) override;
 		//[-------------------------------------------------------]
+		//[ Compute-shader (CS) stage                             ]
+		//[-------------------------------------------------------]
+		virtual void csSetTexture(unsigned int unit, Renderer::ITexture *texture) override;
+		virtual void csSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection) override;
+		virtual void csSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState) override;
+		virtual void csSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection) override;
+		virtual void csSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer) override;
+		virtual void csSetUnorderedAccessView(unsigned int unit, Renderer::IResource *resource) override;
+		//[-------------------------------------------------------]
 		//[ Operations                                            ]
 		//[-------------------------------------------------------]
 		virtual void clear(unsigned int flags, const float color[4], float z, unsigned int stencil) override;
 		virtual bool beginScene() override;
 		virtual void endScene() override;
+		virtual void resolveMultisampleFramebuffer(Renderer::IRenderTarget &destinationRenderTarget, Renderer::IFramebuffer &sourceMultisampleFramebuffer) override;
 		//[-------------------------------------------------------]
 		//[ Draw call                                             ]
 		//[-------------------------------------------------------]
@@ -223,12 +245,26 @@ namespace Direct3D9Renderer
 		virtual void drawInstanced(unsigned int startVertexLocation, unsigned int numberOfVertices, unsigned int numberOfInstances) override;
 		virtual void drawIndexed(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int minimumIndex, unsigned int numberOfVertices) override;
 		virtual void drawIndexedInstanced(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int minimumIndex, unsigned int numberOfVertices, unsigned int numberOfInstances) override;
+		virtual void multiDrawIndexedIndirect(Renderer::IIndirectBuffer &indirectBuffer, unsigned int indirectBufferOffset = 0, unsigned int numberOfDraws = 1) override;
+		virtual void drawAuto() override;
+		//[-------------------------------------------------------]
+		//[ Compute                                               ]
+		//[-------------------------------------------------------]
+		virtual void dispatch(unsigned int groupCountX, unsigned int groupCountY, unsigned int groupCountZ) override;
+		virtual void memoryBarrier(unsigned int flags) override;
 		//[-------------------------------------------------------]
 		//[ Synchronization                                       ]
 		//[-------------------------------------------------------]
+		virtual Renderer::IFence *insertFence() override;
+		virtual bool isFenceSignaled(Renderer::IFence &fence) override;
+		virtual bool waitFence(Renderer::IFence &fence, unsigned int timeout = ~0u) override;
 		virtual void flush() override;
 		virtual void finish() override;
 		//[-------------------------------------------------------]
+		//[ Swap chain                                            ]
+		//[-------------------------------------------------------]
+		virtual void presentSwapChains(unsigned int numberOfSwapChains, Renderer::ISwapChain **swapChains) override;
+		//[-------------------------------------------------------]
 		//[ Debug                                                 ]
 		//[-------------------------------------------------------]
 		virtual bool isDebugEnabled() override;
@@ -280,6 +316,19 @@ namespace Direct3D9Renderer
 		DepthStencilState			 *mDepthStencilState;			/**< Currently set depth stencil state (we keep a reference to it), can be a null pointer */
 		Renderer::IBlendState		 *mDefaultBlendState;			/**< Default blend state (we keep a reference to it), can be a null pointer */
 		BlendState					 *mBlendState;					/**< Currently set blend state (we keep a reference to it), can be a null pointer */
+		//[-------------------------------------------------------]
+		//[ Resource pools                                        ]
+		//[-------------------------------------------------------]
+		Renderer::ResourcePool mVertexBufferPool;			/**< Pool for the vertex buffer instances */
+		Renderer::ResourcePool mIndexBufferPool;			/**< Pool for the index buffer instances */
+		Renderer::ResourcePool mIndirectBufferPool;			/**< Pool for the indirect buffer instances */
+		Renderer::ResourcePool mTexture2DPool;				/**< Pool for the 2D texture instances */
+		Renderer::ResourcePool mRasterizerStatePool;		/**< Pool for the rasterizer state instances */
+		Renderer::ResourcePool mDepthStencilStatePool;		/**< Pool for the depth stencil state instances */
+		Renderer::ResourcePool mBlendStatePool;				/**< Pool for the blend state instances */
+		Renderer::ResourcePool mSamplerStatePool;			/**< Pool for the sampler state instances */
+		Renderer::ResourcePool mTextureCollectionPool;		/**< Pool for the texture collection instances */
+		Renderer::ResourcePool mSamplerStateCollectionPool;	/**< Pool for the sampler state collection instances */
 
 
 	};
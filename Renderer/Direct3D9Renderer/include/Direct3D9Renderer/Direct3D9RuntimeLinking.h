@@ -30,6 +30,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Direct3D9Renderer/d3d9.h"
+#include <Renderer/AllocatorObject.h>
 
 
 //[-------------------------------------------------------]
@@ -46,7 +47,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    Direct3D 9 runtime linking
 	*/
-	class Direct3D9RuntimeLinking
+	class Direct3D9RuntimeLinking : public Renderer::AllocatorObject<Renderer::AllocationTag::RENDERER>
 	{
 
 
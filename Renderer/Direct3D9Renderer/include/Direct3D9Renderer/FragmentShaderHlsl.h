@@ -53,7 +53,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    HLSL fragment shader ("pixel shader" in Direct3D terminology) class
 	*/
-	class FragmentShaderHlsl : public FragmentShader
+	class FragmentShaderHlsl final : public FragmentShader
 	{
 
 
@@ -0,0 +1,140 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __DIRECT3D9RENDERER_INDIRECTBUFFER_H__
+#define __DIRECT3D9RENDERER_INDIRECTBUFFER_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/BufferTypes.h>
+#include <Renderer/IIndirectBuffer.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Direct3D9Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Forward declarations                                  ]
+	//[-------------------------------------------------------]
+	class Direct3D9Renderer;
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Direct3D 9 indirect buffer object class
+	*
+	*  @note
+	*    - Direct3D 9 has no indirect draw support, the draw arguments are kept within system memory
+	*/
+	class IndirectBuffer final : public Renderer::IIndirectBuffer
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] direct3D9Renderer
+		*    Owner Direct3D 9 renderer instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the indirect buffer, must be valid
+		*  @param[in] data
+		*    Indirect buffer data, can be a null pointer (empty buffer)
+		*  @param[in] bufferUsage
+		*    Indication of the buffer usage
+		*/
+		IndirectBuffer(Direct3D9Renderer &direct3D9Renderer, unsigned int numberOfBytes, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~IndirectBuffer();
+
+		/**
+		*  @brief
+		*    Return the system memory emulation data
+		*
+		*  @return
+		*    The system memory emulation data, do not destroy the returned data
+		*/
+		inline const unsigned char *getEmulationData() const;
+
+		/**
+		*  @brief
+		*    Return the number of bytes within the indirect buffer
+		*
+		*  @return
+		*    The number of bytes within the indirect buffer
+		*/
+		inline unsigned int getNumberOfBytes() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IIndirectBuffer methods      ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void copyDataFrom(unsigned int numberOfBytes, const void *data) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		unsigned char *mEmulationData;	/**< System memory emulation data, always valid */
+		unsigned int   mNumberOfBytes;	/**< Number of bytes within the indirect buffer */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Direct3D9Renderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "Direct3D9Renderer/IndirectBuffer.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __DIRECT3D9RENDERER_INDIRECTBUFFER_H__
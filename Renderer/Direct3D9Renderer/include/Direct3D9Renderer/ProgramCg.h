@@ -53,7 +53,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    Cg program class
 	*/
-	class ProgramCg : public Program
+	class ProgramCg final : public Program
 	{
 
 
@@ -58,7 +58,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    HLSL program class
 	*/
-	class ProgramHlsl : public Program
+	class ProgramHlsl final : public Program
 	{
 
 
@@ -59,7 +59,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    Direct3D 9 sampler state collection class
 	*/
-	class SamplerStateCollection : public Renderer::ISamplerStateCollection
+	class SamplerStateCollection final : public Renderer::ISamplerStateCollection
 	{
 
 
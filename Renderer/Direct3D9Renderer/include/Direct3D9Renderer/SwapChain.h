@@ -30,6 +30,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <Renderer/ISwapChain.h>
+#include <Renderer/FramePacer.h>
 #include <Renderer/PlatformTypes.h>
 
 
@@ -58,7 +59,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    Direct3D 9 swap chain class
 	*/
-	class SwapChain : public Renderer::ISwapChain
+	class SwapChain final : public Renderer::ISwapChain
 	{
 
 
@@ -140,6 +141,11 @@ namespace Direct3D9Renderer
 		virtual void resizeBuffers() override;
 		virtual bool getFullscreenState() const override;
 		virtual void setFullscreenState(bool fullscreen) override;
+		virtual int getSwapInterval() const override;
+		virtual bool setSwapInterval(int swapInterval) override;
+		virtual unsigned int getMaximumFrameLatency() const override;
+		virtual void setMaximumFrameLatency(unsigned int maximumFrameLatency) override;
+		virtual const Renderer::PresentStatistics &getPresentStatistics() const override;
 
 
 	//[-------------------------------------------------------]
@@ -174,9 +180,11 @@ namespace Direct3D9Renderer
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		IDirect3DSwapChain9	*mDirect3DSwapChain9;			/**< The Direct3D 9 swap chain instance, null pointer on error */
-		IDirect3DSurface9	*mDirect3DSurface9RenderTarget;	/**< The Direct3D 9 render target surface instance, null pointer on error */
-		IDirect3DSurface9	*mDirect3DSurface9DepthStencil;	/**< The Direct3D 9 depth stencil surface instance, null pointer on error */
+		IDirect3DSwapChain9		*mDirect3DSwapChain9;			/**< The Direct3D 9 swap chain instance, null pointer on error */
+		IDirect3DSurface9		*mDirect3DSurface9RenderTarget;	/**< The Direct3D 9 render target surface instance, null pointer on error */
+		IDirect3DSurface9		*mDirect3DSurface9DepthStencil;	/**< The Direct3D 9 depth stencil surface instance, null pointer on error */
+		int						 mSwapInterval;					/**< Swap interval, see "Renderer::ISwapChain::setSwapInterval()" */
+		Renderer::FramePacer	 mFramePacer;					/**< Frame pacer enforcing the maximum frame latency and recording the present intervals */
 
 
 	};
@@ -57,7 +57,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    Direct3D 9 2D texture class
 	*/
-	class Texture2D : public Renderer::ITexture2D
+	class Texture2D final : public Renderer::ITexture2D
 	{
 
 
@@ -109,11 +109,19 @@ namespace Direct3D9Renderer
 		virtual void setDebugName(const char *name) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2D methods           ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void updateRegion(unsigned int mipmap, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data) override;
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		IDirect3DTexture9 *mDirect3DTexture9;	/**< Direct3D 9 texture instance, can be a null pointer */
+		IDirect3DTexture9			 *mDirect3DTexture9;	/**< Direct3D 9 texture instance, can be a null pointer */
+		Renderer::TextureFormat::Enum mTextureFormat;		/**< Texture format */
 
 
 	};
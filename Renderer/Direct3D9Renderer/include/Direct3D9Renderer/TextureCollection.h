@@ -59,7 +59,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    Direct3D 9 texture collection class
 	*/
-	class TextureCollection : public Renderer::ITextureCollection
+	class TextureCollection final : public Renderer::ITextureCollection
 	{
 
 
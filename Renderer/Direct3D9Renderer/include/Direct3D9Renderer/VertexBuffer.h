@@ -57,7 +57,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    Direct3D 9 vertex buffer object (VBO, "array buffer" in OpenGL terminology) class
 	*/
-	class VertexBuffer : public Renderer::IVertexBuffer
+	class VertexBuffer final : public Renderer::IVertexBuffer
 	{
 
 
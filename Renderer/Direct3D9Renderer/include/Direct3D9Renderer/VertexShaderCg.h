@@ -53,7 +53,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    Cg vertex shader class
 	*/
-	class VertexShaderCg : public VertexShader
+	class VertexShaderCg final : public VertexShader
 	{
 
 
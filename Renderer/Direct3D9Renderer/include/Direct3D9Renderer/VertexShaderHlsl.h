@@ -53,7 +53,7 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    HLSL vertex shader class
 	*/
-	class VertexShaderHlsl : public VertexShader
+	class VertexShaderHlsl final : public VertexShader
 	{
 
 
@@ -32,7 +32,9 @@
 #include "Direct3D9Renderer/VertexArray.h"
 #include "Direct3D9Renderer/SwapChain.h"
 #include "Direct3D9Renderer/Framebuffer.h"
+#include "Direct3D9Renderer/Fence.h"
 #include "Direct3D9Renderer/IndexBuffer.h"
+#include "Direct3D9Renderer/IndirectBuffer.h"
 #include "Direct3D9Renderer/SamplerState.h"
 #include "Direct3D9Renderer/VertexBuffer.h"
 #include "Direct3D9Renderer/RasterizerState.h"
@@ -59,9 +61,9 @@
 #else
 	#define DIRECT3D9RENDERER_API_EXPORT
 #endif
-DIRECT3D9RENDERER_API_EXPORT Renderer::IRenderer *createDirect3D9RendererInstance(handle nativeWindowHandle)
+DIRECT3D9RENDERER_API_EXPORT Renderer::IRenderer *createDirect3D9RendererInstance(handle nativeWindowHandle, Renderer::IAllocator *allocator)
 {
-	return new Direct3D9Renderer::Direct3D9Renderer(nativeWindowHandle);
+	return new ((nullptr != allocator) ? *allocator : Renderer::DefaultAllocator::getInstance()) Direct3D9Renderer::Direct3D9Renderer(nativeWindowHandle, allocator);
 }
 #undef DIRECT3D9RENDERER_API_EXPORT
 
@@ -80,13 +82,14 @@ namespace Direct3D9Renderer
 	*  @brief
 	*    Constructor
 	*/
-	Direct3D9Renderer::Direct3D9Renderer(handle nativeWindowHandle) :
-		mDirect3D9RuntimeLinking(new Direct3D9RuntimeLinking()),
+	Direct3D9Renderer::Direct3D9Renderer(handle nativeWindowHandle, Renderer::IAllocator *allocator) :
+		IRenderer(allocator),
+		mDirect3D9RuntimeLinking(new (getAllocator()) Direct3D9RuntimeLinking()),
 		mDirect3D9(nullptr),
 		mDirect3DDevice9(nullptr),
 		mShaderLanguageHlsl(nullptr),
 		#ifndef DIRECT3D9RENDERER_NO_CG
-			mCgRuntimeLinking(new CgRuntimeLinking()),
+			mCgRuntimeLinking(new (getAllocator()) CgRuntimeLinking()),
 			mShaderLanguageCg(nullptr),
 		#endif
 		mDirect3DQuery9Flush(nullptr),
@@ -99,7 +102,17 @@ namespace Direct3D9Renderer
 		mDefaultDepthStencilState(nullptr),
 		mDepthStencilState(nullptr),
 		mDefaultBlendState(nullptr),
-		mBlendState(nullptr)
+		mBlendState(nullptr),
+		mVertexBufferPool(getAllocator(), sizeof(VertexBuffer)),
+		mIndexBufferPool(getAllocator(), sizeof(IndexBuffer)),
+		mIndirectBufferPool(getAllocator(), sizeof(IndirectBuffer)),
+		mTexture2DPool(getAllocator(), sizeof(Texture2D)),
+		mRasterizerStatePool(getAllocator(), sizeof(RasterizerState)),
+		mDepthStencilStatePool(getAllocator(), sizeof(DepthStencilState)),
+		mBlendStatePool(getAllocator(), sizeof(BlendState)),
+		mSamplerStatePool(getAllocator(), sizeof(SamplerState)),
+		mTextureCollectionPool(getAllocator(), sizeof(TextureCollection)),
+		mSamplerStateCollectionPool(getAllocator(), sizeof(SamplerStateCollection))
 	{
 		// Is Direct3D 9 available?
 		if (mDirect3D9RuntimeLinking->isDirect3D9Avaiable())
@@ -385,7 +398,7 @@ namespace Direct3D9Renderer
 				// If required, create the HLSL shader language instance right now
 				if (nullptr == mShaderLanguageHlsl)
 				{
-					mShaderLanguageHlsl = new ShaderLanguageHlsl(*this);
+					mShaderLanguageHlsl = new (getAllocator()) ShaderLanguageHlsl(*this);
 					mShaderLanguageHlsl->addReference();	// Internal renderer reference
 				}
 
@@ -401,7 +414,7 @@ namespace Direct3D9Renderer
 						// If required, create the Cg shader language instance right now
 						if (nullptr == mShaderLanguageCg)
 						{
-							mShaderLanguageCg = new ShaderLanguageCg(*this);
+							mShaderLanguageCg = new (getAllocator()) ShaderLanguageCg(*this);
 							mShaderLanguageCg->addReference();	// Internal renderer reference
 						}
 
@@ -426,25 +439,25 @@ namespace Direct3D9Renderer
 	Renderer::ISwapChain *Direct3D9Renderer::createSwapChain(handle nativeWindowHandle)
 	{
 		// The provided native window handle must not be a null handle
-		return (NULL_HANDLE != nativeWindowHandle) ? new SwapChain(*this, nativeWindowHandle) : nullptr;
+		return (NULL_HANDLE != nativeWindowHandle) ? new (getAllocator()) SwapChain(*this, nativeWindowHandle) : nullptr;
 	}
 
 	Renderer::IFramebuffer *Direct3D9Renderer::createFramebuffer(unsigned int numberOfColorTextures, Renderer::ITexture **colorTextures, Renderer::ITexture *depthStencilTexture)
 	{
 		// Validation is done inside the framebuffer implementation
-		return new Framebuffer(*this, numberOfColorTextures, colorTextures, depthStencilTexture);
+		return new (getAllocator()) Framebuffer(*this, numberOfColorTextures, colorTextures, depthStencilTexture);
 	}
 
 	Renderer::IVertexBuffer *Direct3D9Renderer::createVertexBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
 		// TODO(co) Security checks
-		return new VertexBuffer(*this, numberOfBytes, data, bufferUsage);
+		return new (mVertexBufferPool) VertexBuffer(*this, numberOfBytes, data, bufferUsage);
 	}
 
 	Renderer::IIndexBuffer *Direct3D9Renderer::createIndexBuffer(unsigned int numberOfBytes, Renderer::IndexBufferFormat::Enum indexBufferFormat, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
 		// TODO(co) Security checks
-		return new IndexBuffer(*this, numberOfBytes, indexBufferFormat, data, bufferUsage);
+		return new (mIndexBufferPool) IndexBuffer(*this, numberOfBytes, indexBufferFormat, data, bufferUsage);
 	}
 
 	Renderer::ITextureBuffer *Direct3D9Renderer::createTextureBuffer(unsigned int, Renderer::TextureFormat::Enum, const void *, Renderer::BufferUsage::Enum)
@@ -453,12 +466,18 @@ namespace Direct3D9Renderer
 		return nullptr;
 	}
 
-	Renderer::ITexture2D *Direct3D9Renderer::createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage)
+	Renderer::IIndirectBuffer *Direct3D9Renderer::createIndirectBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
-		// Check whether or not the given texture dimension is valid
-		if (width > 0 && height > 0)
+		// Direct3D 9 has no indirect draw support, the indirect buffer is emulated within system memory
+		return new (mIndirectBufferPool) IndirectBuffer(*this, numberOfBytes, data, bufferUsage);
+	}
+
+	Renderer::ITexture2D *Direct3D9Renderer::createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage, unsigned int numberOfMultisamples)
+	{
+		// Check whether or not the given texture dimension is valid, Direct3D 9 has no multisample texture support (only multisample surfaces)
+		if (width > 0 && height > 0 && numberOfMultisamples <= 1)
 		{
-			return new Texture2D(*this, width, height, textureFormat, data, flags, textureUsage);
+			return new (mTexture2DPool) Texture2D(*this, width, height, textureFormat, data, flags, textureUsage);
 		}
 		else
 		{
@@ -474,32 +493,32 @@ namespace Direct3D9Renderer
 
 	Renderer::IRasterizerState *Direct3D9Renderer::createRasterizerState(const Renderer::RasterizerState &rasterizerState)
 	{
-		return new RasterizerState(*this, rasterizerState);
+		return new (mRasterizerStatePool) RasterizerState(*this, rasterizerState);
 	}
 
 	Renderer::IDepthStencilState *Direct3D9Renderer::createDepthStencilState(const Renderer::DepthStencilState &depthStencilState)
 	{
-		return new DepthStencilState(*this, depthStencilState);
+		return new (mDepthStencilStatePool) DepthStencilState(*this, depthStencilState);
 	}
 
 	Renderer::IBlendState *Direct3D9Renderer::createBlendState(const Renderer::BlendState &blendState)
 	{
-		return new BlendState(*this, blendState);
+		return new (mBlendStatePool) BlendState(*this, blendState);
 	}
 
 	Renderer::ISamplerState *Direct3D9Renderer::createSamplerState(const Renderer::SamplerState &samplerState)
 	{
-		return new SamplerState(*this, samplerState);
+		return new (mSamplerStatePool) SamplerState(*this, samplerState);
 	}
 
 	Renderer::ITextureCollection *Direct3D9Renderer::createTextureCollection(unsigned int numberOfTextures, Renderer::ITexture **textures)
 	{
-		return new TextureCollection(*this, numberOfTextures, textures);
+		return new (mTextureCollectionPool) TextureCollection(*this, numberOfTextures, textures);
 	}
 
 	Renderer::ISamplerStateCollection *Direct3D9Renderer::createSamplerStateCollection(unsigned int numberOfSamplerStates, Renderer::ISamplerState **samplerStates)
 	{
-		return new SamplerStateCollection(*this, numberOfSamplerStates, samplerStates);
+		return new (mSamplerStateCollectionPool) SamplerStateCollection(*this, numberOfSamplerStates, samplerStates);
 	}
 
 
@@ -634,6 +653,7 @@ namespace Direct3D9Renderer
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::UNIFORM_BUFFER:
+			case Renderer::ResourceType::INDIRECT_BUFFER:
 			case Renderer::ResourceType::TEXTURE_BUFFER:
 			case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 			case Renderer::ResourceType::RASTERIZER_STATE:
@@ -645,8 +665,10 @@ namespace Direct3D9Renderer
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			case Renderer::ResourceType::TEXTURE_COLLECTION:
 			case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+			case Renderer::ResourceType::FENCE:
 			default:
 				// Nothing we can map, set known return values
 				mappedSubresource.data		 = nullptr;
@@ -680,6 +702,7 @@ namespace Direct3D9Renderer
 			case Renderer::ResourceType::SWAP_CHAIN:
 			case Renderer::ResourceType::FRAMEBUFFER:
 			case Renderer::ResourceType::UNIFORM_BUFFER:
+			case Renderer::ResourceType::INDIRECT_BUFFER:
 			case Renderer::ResourceType::TEXTURE_BUFFER:
 			case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 			case Renderer::ResourceType::RASTERIZER_STATE:
@@ -691,14 +714,27 @@ namespace Direct3D9Renderer
 			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 			case Renderer::ResourceType::GEOMETRY_SHADER:
 			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
 			case Renderer::ResourceType::TEXTURE_COLLECTION:
 			case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+			case Renderer::ResourceType::FENCE:
 			default:
 				// Nothing we can unmap
 				break;
 		}
 	}
 
+	bool Direct3D9Renderer::copyResource(Renderer::IResource &, Renderer::IResource &)
+	{
+		// TODO(co) Direct3D 9 copy resource support is not implemented, yet (e.g. "IDirect3DDevice9::GetRenderTargetData()" for render target textures)
+		return false;
+	}
+
+	void Direct3D9Renderer::setTextureResident(Renderer::ITexture &, Renderer::ISamplerState *, bool)
+	{
+		// Direct3D 9 has no bindless texture support
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ States                                                ]
@@ -851,6 +887,7 @@ namespace Direct3D9Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::TEXTURE_BUFFER:
 				case Renderer::ResourceType::RASTERIZER_STATE:
 				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
@@ -861,8 +898,10 @@ namespace Direct3D9Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Not handled in here
 					break;
@@ -919,6 +958,7 @@ namespace Direct3D9Renderer
 						case Renderer::ResourceType::INDEX_BUFFER:
 						case Renderer::ResourceType::VERTEX_BUFFER:
 						case Renderer::ResourceType::UNIFORM_BUFFER:
+						case Renderer::ResourceType::INDIRECT_BUFFER:
 						case Renderer::ResourceType::TEXTURE_BUFFER:
 						case Renderer::ResourceType::RASTERIZER_STATE:
 						case Renderer::ResourceType::DEPTH_STENCIL_STATE:
@@ -929,8 +969,10 @@ namespace Direct3D9Renderer
 						case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 						case Renderer::ResourceType::GEOMETRY_SHADER:
 						case Renderer::ResourceType::FRAGMENT_SHADER:
+						case Renderer::ResourceType::COMPUTE_SHADER:
 						case Renderer::ResourceType::TEXTURE_COLLECTION:
 						case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+						case Renderer::ResourceType::FENCE:
 						default:
 							// Not handled in here
 							break;
@@ -1226,6 +1268,38 @@ namespace Direct3D9Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Stream-output (SO) stage                              ]
+	//[-------------------------------------------------------]
+	void Direct3D9Renderer::soSetTargets(unsigned int numberOfTargets, Renderer::IVertexBuffer **vertexBuffers, const unsigned int *)
+	{
+		// Direct3D 9 has no stream output support
+
+		// Are the given vertex buffers valid?
+		if (nullptr != vertexBuffers)
+		{
+			for (unsigned int i = 0; i < numberOfTargets; ++i)
+			{
+				if (nullptr != vertexBuffers[i])
+				{
+					// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+					DIRECT3D9RENDERER_RENDERERMATCHCHECK_RETURN(*this, *vertexBuffers[i])
+				}
+			}
+		}
+	}
+
+	void Direct3D9Renderer::soBegin(Renderer::PrimitiveTopology::Enum, bool)
+	{
+		// Direct3D 9 has no stream output support
+	}
+
+	void Direct3D9Renderer::soEnd()
+	{
+		// Direct3D 9 has no stream output support
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Rasterizer (RS) stage                                 ]
 	//[-------------------------------------------------------]
@@ -1358,6 +1432,7 @@ namespace Direct3D9Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::TEXTURE_BUFFER:
 				case Renderer::ResourceType::RASTERIZER_STATE:
 				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
@@ -1368,8 +1443,10 @@ namespace Direct3D9Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Not handled in here
 					break;
@@ -1425,6 +1502,7 @@ namespace Direct3D9Renderer
 						case Renderer::ResourceType::INDEX_BUFFER:
 						case Renderer::ResourceType::VERTEX_BUFFER:
 						case Renderer::ResourceType::UNIFORM_BUFFER:
+						case Renderer::ResourceType::INDIRECT_BUFFER:
 						case Renderer::ResourceType::TEXTURE_BUFFER:
 						case Renderer::ResourceType::RASTERIZER_STATE:
 						case Renderer::ResourceType::DEPTH_STENCIL_STATE:
@@ -1435,8 +1513,10 @@ namespace Direct3D9Renderer
 						case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 						case Renderer::ResourceType::GEOMETRY_SHADER:
 						case Renderer::ResourceType::FRAGMENT_SHADER:
+						case Renderer::ResourceType::COMPUTE_SHADER:
 						case Renderer::ResourceType::TEXTURE_COLLECTION:
 						case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+						case Renderer::ResourceType::FENCE:
 						default:
 							// Not handled in here
 							break;
@@ -1631,6 +1711,7 @@ namespace Direct3D9Renderer
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::UNIFORM_BUFFER:
+					case Renderer::ResourceType::INDIRECT_BUFFER:
 					case Renderer::ResourceType::TEXTURE_BUFFER:
 					case Renderer::ResourceType::TEXTURE_2D:
 					case Renderer::ResourceType::TEXTURE_2D_ARRAY:
@@ -1643,8 +1724,10 @@ namespace Direct3D9Renderer
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 					case Renderer::ResourceType::TEXTURE_COLLECTION:
 					case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+					case Renderer::ResourceType::FENCE:
 					default:
 						// Not handled in here
 						break;
@@ -1787,6 +1870,82 @@ namespace Direct3D9Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Compute-shader (CS) stage                             ]
+	//[-------------------------------------------------------]
+	void Direct3D9Renderer::csSetTexture(unsigned int, Renderer::ITexture *texture)
+	{
+		// Direct3D 9 has no compute shader support
+
+		// Is the given texture valid?
+		if (nullptr != texture)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D9RENDERER_RENDERERMATCHCHECK_RETURN(*this, *texture)
+		}
+	}
+
+	void Direct3D9Renderer::csSetTextureCollection(unsigned int, Renderer::ITextureCollection *textureCollection)
+	{
+		// Direct3D 9 has no compute shader support
+
+		// Is the given texture collection valid?
+		if (nullptr != textureCollection)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D9RENDERER_RENDERERMATCHCHECK_RETURN(*this, *textureCollection)
+		}
+	}
+
+	void Direct3D9Renderer::csSetSamplerState(unsigned int, Renderer::ISamplerState *samplerState)
+	{
+		// Direct3D 9 has no compute shader support
+
+		// Is the given sampler state valid?
+		if (nullptr != samplerState)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D9RENDERER_RENDERERMATCHCHECK_RETURN(*this, *samplerState)
+		}
+	}
+
+	void Direct3D9Renderer::csSetSamplerStateCollection(unsigned int, Renderer::ISamplerStateCollection *samplerStateCollection)
+	{
+		// Direct3D 9 has no compute shader support
+
+		// Is the given sampler state collection valid?
+		if (nullptr != samplerStateCollection)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D9RENDERER_RENDERERMATCHCHECK_RETURN(*this, *samplerStateCollection)
+		}
+	}
+
+	void Direct3D9Renderer::csSetUniformBuffer(unsigned int, Renderer::IUniformBuffer *uniformBuffer)
+	{
+		// Direct3D 9 has no compute shader support
+
+		// Is the given uniform buffer valid?
+		if (nullptr != uniformBuffer)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D9RENDERER_RENDERERMATCHCHECK_RETURN(*this, *uniformBuffer)
+		}
+	}
+
+	void Direct3D9Renderer::csSetUnorderedAccessView(unsigned int, Renderer::IResource *resource)
+	{
+		// Direct3D 9 has no compute shader support
+
+		// Is the given resource valid?
+		if (nullptr != resource)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			DIRECT3D9RENDERER_RENDERERMATCHCHECK_RETURN(*this, *resource)
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Operations                                            ]
 	//[-------------------------------------------------------]
@@ -1891,6 +2050,15 @@ namespace Direct3D9Renderer
 		mDirect3DDevice9->EndScene();
 	}
 
+	void Direct3D9Renderer::resolveMultisampleFramebuffer(Renderer::IRenderTarget &destinationRenderTarget, Renderer::IFramebuffer &sourceMultisampleFramebuffer)
+	{
+		// Direct3D 9 has no multisample texture support
+
+		// Security check: Are the given resources owned by this renderer? (calls "return" in case of a mismatch)
+		DIRECT3D9RENDERER_RENDERERMATCHCHECK_RETURN(*this, destinationRenderTarget)
+		DIRECT3D9RENDERER_RENDERERMATCHCHECK_RETURN(*this, sourceMultisampleFramebuffer)
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Draw call                                             ]
@@ -2055,10 +2223,91 @@ namespace Direct3D9Renderer
 		}
 	}
 
+	void Direct3D9Renderer::multiDrawIndexedIndirect(Renderer::IIndirectBuffer &indirectBuffer, unsigned int indirectBufferOffset, unsigned int numberOfDraws)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		DIRECT3D9RENDERER_RENDERERMATCHCHECK_RETURN(*this, indirectBuffer)
+
+		// Direct3D 9 has no indirect draw support, emulate the multi-draw by using a loop
+		// -> Do not read behind the end of the emulation data
+		// -> "startInstanceLocation" is ignored, the stream source frequency always starts at instance zero
+		// -> The draw arguments have no vertex range, the index count is passed as "numberOfVertices"-hint which is only relevant for software vertex processing
+		const IndirectBuffer &direct3D9IndirectBuffer = static_cast<const IndirectBuffer&>(indirectBuffer);
+		const unsigned int maximumNumberOfDraws = (indirectBufferOffset < direct3D9IndirectBuffer.getNumberOfBytes()) ? (direct3D9IndirectBuffer.getNumberOfBytes() - indirectBufferOffset) / sizeof(Renderer::DrawIndexedInstancedArguments) : 0;
+		const Renderer::DrawIndexedInstancedArguments *drawArguments = reinterpret_cast<const Renderer::DrawIndexedInstancedArguments*>(direct3D9IndirectBuffer.getEmulationData() + indirectBufferOffset);
+		const Renderer::DrawIndexedInstancedArguments *drawArgumentsEnd = drawArguments + ((numberOfDraws < maximumNumberOfDraws) ? numberOfDraws : maximumNumberOfDraws);
+		for (; drawArguments < drawArgumentsEnd; ++drawArguments)
+		{
+			if (1 == drawArguments->instanceCount)
+			{
+				drawIndexed(drawArguments->startIndexLocation, drawArguments->indexCountPerInstance, drawArguments->baseVertexLocation, 0, drawArguments->indexCountPerInstance);
+			}
+			else if (drawArguments->instanceCount > 1)
+			{
+				drawIndexedInstanced(drawArguments->startIndexLocation, drawArguments->indexCountPerInstance, drawArguments->baseVertexLocation, 0, drawArguments->indexCountPerInstance, drawArguments->instanceCount);
+			}
+		}
+	}
+
+	void Direct3D9Renderer::drawAuto()
+	{
+		// Direct3D 9 has no stream output support
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Compute                                               ]
+	//[-------------------------------------------------------]
+	void Direct3D9Renderer::dispatch(unsigned int, unsigned int, unsigned int)
+	{
+		// Direct3D 9 has no compute shader support
+	}
+
+	void Direct3D9Renderer::memoryBarrier(unsigned int)
+	{
+		// Direct3D 9 has no compute shader support
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Synchronization                                       ]
 	//[-------------------------------------------------------]
+	Renderer::IFence *Direct3D9Renderer::insertFence()
+	{
+		return new (getAllocator()) Fence(*this);
+	}
+
+	bool Direct3D9Renderer::isFenceSignaled(Renderer::IFence &fence)
+	{
+		// Poll the Direct3D 9 event query without waiting
+		// -> Flush the command stream, else the fence might never be signaled
+		IDirect3DQuery9 *direct3DQuery9 = static_cast<Fence&>(fence).getDirect3DQuery9();
+		return (nullptr != direct3DQuery9 && S_OK == direct3DQuery9->GetData(nullptr, 0, D3DGETDATA_FLUSH));
+	}
+
+	bool Direct3D9Renderer::waitFence(Renderer::IFence &fence, unsigned int timeout)
+	{
+		IDirect3DQuery9 *direct3DQuery9 = static_cast<Fence&>(fence).getDirect3DQuery9();
+		if (nullptr != direct3DQuery9)
+		{
+			// Direct3D 9 has no blocking wait for event queries, so spin-wait until the event query is signaled or the timeout (in milliseconds) is reached
+			const DWORD startTime = ::GetTickCount();
+			HRESULT hResult = S_FALSE;
+			while (S_FALSE == (hResult = direct3DQuery9->GetData(nullptr, 0, D3DGETDATA_FLUSH)))
+			{
+				if (~0u != timeout && ::GetTickCount() - startTime >= timeout)
+				{
+					// Timeout reached
+					return false;
+				}
+			}
+			return (S_OK == hResult);
+		}
+
+		// Error!
+		return false;
+	}
+
 	void Direct3D9Renderer::flush()
 	{
 		// Create the Direct3D 9 query instance used for flush right now?
@@ -2097,6 +2346,19 @@ namespace Direct3D9Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Swap chain                                            ]
+	//[-------------------------------------------------------]
+	void Direct3D9Renderer::presentSwapChains(unsigned int numberOfSwapChains, Renderer::ISwapChain **swapChains)
+	{
+		// Direct3D 9 has no way to present multiple additional swap chains at once, the swap chains are already sharing the device and with it all resources
+		for (unsigned int i = 0; i < numberOfSwapChains; ++i)
+		{
+			swapChains[i]->present();
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Debug                                                 ]
 	//[-------------------------------------------------------]
@@ -2185,6 +2447,9 @@ namespace Direct3D9Renderer
 		// Base vertex supported for draw calls?
 		mCapabilities.baseVertex = true;
 
+		// Native multi-draw indirect supported? (Direct3D 9 has no indirect draw support, "Direct3D9Renderer::multiDrawIndexedIndirect()" uses a loop)
+		mCapabilities.multiDrawIndirect = false;
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = true;
 
@@ -0,0 +1,73 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Direct3D9Renderer/Fence.h"
+#include "Direct3D9Renderer/d3d9.h"
+#include "Direct3D9Renderer/Direct3D9Renderer.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Direct3D9Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	Fence::Fence(Direct3D9Renderer &direct3D9Renderer) :
+		Renderer::IFence(direct3D9Renderer),
+		mDirect3DQuery9(nullptr)
+	{
+		// Create the Direct3D 9 event query and insert it into the command stream
+		direct3D9Renderer.getDirect3DDevice9()->CreateQuery(D3DQUERYTYPE_EVENT, &mDirect3DQuery9);
+		if (nullptr != mDirect3DQuery9)
+		{
+			mDirect3DQuery9->Issue(D3DISSUE_END);
+		}
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	Fence::~Fence()
+	{
+		// Release the Direct3D 9 event query
+		if (nullptr != mDirect3DQuery9)
+		{
+			mDirect3DQuery9->Release();
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Direct3D9Renderer
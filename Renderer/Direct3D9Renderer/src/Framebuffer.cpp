@@ -58,8 +58,8 @@ namespace Direct3D9Renderer
 		// Add a reference to the used color textures
 		if (mNumberOfColorTextures > 0)
 		{
-			mColorTextures = new Renderer::ITexture*[mNumberOfColorTextures];
-			mDirect3D9ColorSurfaces = new IDirect3DSurface9*[mNumberOfColorTextures];
+			mColorTextures = getRenderer().getAllocator().allocateArray<Renderer::ITexture*>(mNumberOfColorTextures, Renderer::AllocationTag::RESOURCE);
+			mDirect3D9ColorSurfaces = getRenderer().getAllocator().allocateArray<IDirect3DSurface9*>(mNumberOfColorTextures, Renderer::AllocationTag::RESOURCE);
 
 			// Loop through all color textures
 			IDirect3DSurface9 **direct3D9ColorSurface = mDirect3D9ColorSurfaces;
@@ -101,6 +101,7 @@ namespace Direct3D9Renderer
 						case Renderer::ResourceType::INDEX_BUFFER:
 						case Renderer::ResourceType::VERTEX_BUFFER:
 						case Renderer::ResourceType::UNIFORM_BUFFER:
+						case Renderer::ResourceType::INDIRECT_BUFFER:
 						case Renderer::ResourceType::TEXTURE_BUFFER:
 						case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 						case Renderer::ResourceType::RASTERIZER_STATE:
@@ -112,8 +113,10 @@ namespace Direct3D9Renderer
 						case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 						case Renderer::ResourceType::GEOMETRY_SHADER:
 						case Renderer::ResourceType::FRAGMENT_SHADER:
+						case Renderer::ResourceType::COMPUTE_SHADER:
 						case Renderer::ResourceType::TEXTURE_COLLECTION:
 						case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+						case Renderer::ResourceType::FENCE:
 						default:
 							RENDERER_OUTPUT_DEBUG_PRINTF("Direct3D 9 error: The type of the given color texture at index %d is not supported", colorTexture - colorTextures)
 							*direct3D9ColorSurface = nullptr;
@@ -161,6 +164,7 @@ namespace Direct3D9Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::TEXTURE_BUFFER:
 				case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 				case Renderer::ResourceType::RASTERIZER_STATE:
@@ -172,8 +176,10 @@ namespace Direct3D9Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					RENDERER_OUTPUT_DEBUG_STRING("Direct3D 9 error: The type of the given depth stencil texture is not supported")
 					break;
@@ -212,7 +218,7 @@ namespace Direct3D9Renderer
 			}
 
 			// Cleanup
-			delete [] mDirect3D9ColorSurfaces;
+			getRenderer().getAllocator().deallocateArray(mDirect3D9ColorSurfaces, Renderer::AllocationTag::RESOURCE);
 		}
 		if (nullptr != mColorTextures)
 		{
@@ -228,7 +234,7 @@ namespace Direct3D9Renderer
 			}
 
 			// Cleanup
-			delete [] mColorTextures;
+			getRenderer().getAllocator().deallocateArray(mColorTextures, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Release the reference to the used depth stencil texture
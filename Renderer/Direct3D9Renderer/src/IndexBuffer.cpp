@@ -46,6 +46,9 @@ namespace Direct3D9Renderer
 		IIndexBuffer(direct3D9Renderer),
 		mDirect3DIndexBuffer9(nullptr)
 	{
+		// Set the estimated number of bytes of the index buffer
+		setNumberOfBytes(numberOfBytes);
+
 		// "Renderer::IndexBufferFormat::UNSIGNED_CHAR" is not supported by Direct3D 9
 		if (Renderer::IndexBufferFormat::UNSIGNED_CHAR == indexBufferFormat)
 		{
@@ -89,6 +92,9 @@ namespace Direct3D9Renderer
 	//[-------------------------------------------------------]
 	void IndexBuffer::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D9RENDERER_NO_DEBUG
 			// Valid Direct3D 9 index buffer?
 			if (nullptr != mDirect3DIndexBuffer9)
@@ -283,10 +283,12 @@ namespace Direct3D9Renderer
 		// BYTE
 		static const unsigned char MAPPING[] =
 		{
-			D3DDECLTYPE_FLOAT1,	// Renderer::VertexArrayFormat::FLOAT_1
-			D3DDECLTYPE_FLOAT2,	// Renderer::VertexArrayFormat::FLOAT_2
-			D3DDECLTYPE_FLOAT3,	// Renderer::VertexArrayFormat::FLOAT_3
-			D3DDECLTYPE_FLOAT4	// Renderer::VertexArrayFormat::FLOAT_4
+			D3DDECLTYPE_FLOAT1,		// Renderer::VertexArrayFormat::FLOAT_1
+			D3DDECLTYPE_FLOAT2,		// Renderer::VertexArrayFormat::FLOAT_2
+			D3DDECLTYPE_FLOAT3,		// Renderer::VertexArrayFormat::FLOAT_3
+			D3DDECLTYPE_FLOAT4,		// Renderer::VertexArrayFormat::FLOAT_4
+			D3DDECLTYPE_FLOAT16_2,	// Renderer::VertexArrayFormat::HALF_2
+			D3DDECLTYPE_FLOAT16_4	// Renderer::VertexArrayFormat::HALF_4
 		};
 		return MAPPING[vertexArrayFormat];
 	}
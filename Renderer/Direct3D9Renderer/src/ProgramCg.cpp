@@ -25,6 +25,7 @@
 #include "Direct3D9Renderer/IndexBuffer.h"
 #include "Direct3D9Renderer/VertexArray.h"
 #include "Direct3D9Renderer/VertexShaderCg.h"
+#include "Direct3D9Renderer/Direct3D9Renderer.h"
 #include "Direct3D9Renderer/FragmentShaderCg.h"
 #include "Direct3D9Renderer/CgRuntimeLinking.h"
 
@@ -84,7 +85,7 @@ namespace Direct3D9Renderer
 	Renderer::IVertexArray *ProgramCg::createVertexArray(unsigned int numberOfAttributes, const Renderer::VertexArrayAttribute *attributes, Renderer::IIndexBuffer *indexBuffer)
 	{
 		// TODO(co) Add security check: Is the given resource one of the currently used renderer?
-		return new VertexArray(*mDirect3D9Renderer, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
+		return new (mDirect3D9Renderer->getAllocator()) VertexArray(*mDirect3D9Renderer, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
 	}
 
 	int ProgramCg::getAttributeLocation(const char *)
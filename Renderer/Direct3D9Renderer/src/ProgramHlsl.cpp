@@ -136,7 +136,7 @@ namespace Direct3D9Renderer
 	Renderer::IVertexArray *ProgramHlsl::createVertexArray(unsigned int numberOfAttributes, const Renderer::VertexArrayAttribute *attributes, Renderer::IIndexBuffer *indexBuffer)
 	{
 		// TODO(co) Add security check: Is the given resource one of the currently used renderer?
-		return new VertexArray(*mDirect3D9Renderer, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
+		return new (mDirect3D9Renderer->getAllocator()) VertexArray(*mDirect3D9Renderer, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
 	}
 
 	int ProgramHlsl::getAttributeLocation(const char *)
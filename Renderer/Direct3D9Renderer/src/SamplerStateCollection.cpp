@@ -43,7 +43,7 @@ namespace Direct3D9Renderer
 	SamplerStateCollection::SamplerStateCollection(Direct3D9Renderer &direct3D9Renderer, unsigned int numberOfSamplerStates, Renderer::ISamplerState **samplerStates) :
 		Renderer::ISamplerStateCollection(direct3D9Renderer),
 		mNumberOfSamplerStates(numberOfSamplerStates),
-		mSamplerStates((numberOfSamplerStates > 0) ? new Renderer::ISamplerState*[numberOfSamplerStates] : nullptr)
+		mSamplerStates(direct3D9Renderer.getAllocator().allocateArray<Renderer::ISamplerState*>(numberOfSamplerStates, Renderer::AllocationTag::RESOURCE))
 	{
 		// Loop through all given textures
 		Renderer::ISamplerState **currentSamplerState = mSamplerStates;
@@ -86,7 +86,7 @@ namespace Direct3D9Renderer
 			}
 
 			// Release the allocated memory
-			delete [] mSamplerStates;
+			getRenderer().getAllocator().deallocateArray(mSamplerStates, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
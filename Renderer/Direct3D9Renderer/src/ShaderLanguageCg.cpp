@@ -28,6 +28,8 @@
 #include "Direct3D9Renderer/FragmentShaderCg.h"
 #include "Direct3D9Renderer/Direct3D9Renderer.h"
 
+#include <Renderer/IComputeShader.h>
+
 #include <Cg/cgD3D9.h>
 
 
@@ -98,7 +100,7 @@ namespace Direct3D9Renderer
 
 	Renderer::IVertexShader *ShaderLanguageCg::createVertexShader(const char *sourceCode, const char *, const char *, const char *)
 	{
-		return (nullptr != mCGcontext) ? new VertexShaderCg(getDirect3D9Renderer(), *mCGcontext, sourceCode) : nullptr;
+		return (nullptr != mCGcontext) ? new (getDirect3D9Renderer().getAllocator()) VertexShaderCg(getDirect3D9Renderer(), *mCGcontext, sourceCode) : nullptr;
 	}
 
 	Renderer::ITessellationControlShader *ShaderLanguageCg::createTessellationControlShader(const char *, const char *, const char *, const char *)
@@ -121,7 +123,7 @@ namespace Direct3D9Renderer
 
 	Renderer::IFragmentShader *ShaderLanguageCg::createFragmentShader(const char *sourceCode, const char *, const char *, const char *)
 	{
-		return (nullptr != mCGcontext) ? new FragmentShaderCg(getDirect3D9Renderer(), *mCGcontext, sourceCode) : nullptr;
+		return (nullptr != mCGcontext) ? new (getDirect3D9Renderer().getAllocator()) FragmentShaderCg(getDirect3D9Renderer(), *mCGcontext, sourceCode) : nullptr;
 	}
 
 	Renderer::IProgram *ShaderLanguageCg::createProgram(Renderer::IVertexShader *vertexShader, Renderer::ITessellationControlShader *tessellationControlShader, Renderer::ITessellationEvaluationShader *tessellationEvaluationShader, Renderer::IGeometryShader *geometryShader, Renderer::IFragmentShader *fragmentShader)
@@ -156,7 +158,7 @@ namespace Direct3D9Renderer
 			else
 			{
 				// Create the program instance
-				return new ProgramCg(*mDirect3D9Renderer, static_cast<VertexShaderCg*>(vertexShader), static_cast<FragmentShaderCg*>(fragmentShader));
+				return new (mDirect3D9Renderer->getAllocator()) ProgramCg(*mDirect3D9Renderer, static_cast<VertexShaderCg*>(vertexShader), static_cast<FragmentShaderCg*>(fragmentShader));
 			}
 
 			// Error! Shader language mismatch!
@@ -177,6 +179,24 @@ namespace Direct3D9Renderer
 		return nullptr;
 	}
 
+	Renderer::IComputeShader *ShaderLanguageCg::createComputeShader(const char *, const char *, const char *, const char *)
+	{
+		// Error! Direct3D 9 has no compute shader support.
+		return nullptr;
+	}
+
+	Renderer::IProgram *ShaderLanguageCg::createComputeProgram(Renderer::IComputeShader *computeShader)
+	{
+		// Error! Direct3D 9 has no compute shader support.
+		// -> Ensure a correct reference counter behaviour, even in the situation of an error
+		if (nullptr != computeShader)
+		{
+			computeShader->addReference();
+			computeShader->release();
+		}
+		return nullptr;
+	}
+
 	Renderer::IUniformBuffer *ShaderLanguageCg::createUniformBuffer(unsigned int, const void *, Renderer::BufferUsage::Enum)
 	{
 		// Error! Direct3D 9 has no uniform buffer support.
@@ -28,6 +28,8 @@
 #include "Direct3D9Renderer/FragmentShaderHlsl.h"
 #include "Direct3D9Renderer/Direct3D9RuntimeLinking.h"
 
+#include <Renderer/IComputeShader.h>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -108,7 +110,7 @@ namespace Direct3D9Renderer
 	Renderer::IVertexShader *ShaderLanguageHlsl::createVertexShader(const char *sourceCode, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::vertexShader", we know there's vertex shader support
-		return new VertexShaderHlsl(*mDirect3D9Renderer, sourceCode);
+		return new (mDirect3D9Renderer->getAllocator()) VertexShaderHlsl(*mDirect3D9Renderer, sourceCode);
 	}
 
 	Renderer::ITessellationControlShader *ShaderLanguageHlsl::createTessellationControlShader(const char *, const char *, const char *, const char *)
@@ -132,7 +134,7 @@ namespace Direct3D9Renderer
 	Renderer::IFragmentShader *ShaderLanguageHlsl::createFragmentShader(const char *sourceCode, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::fragmentShader", we know there's fragment shader support
-		return new FragmentShaderHlsl(*mDirect3D9Renderer, sourceCode);
+		return new (mDirect3D9Renderer->getAllocator()) FragmentShaderHlsl(*mDirect3D9Renderer, sourceCode);
 	}
 
 	Renderer::IProgram *ShaderLanguageHlsl::createProgram(Renderer::IVertexShader *vertexShader, Renderer::ITessellationControlShader *tessellationControlShader, Renderer::ITessellationEvaluationShader *tessellationEvaluationShader, Renderer::IGeometryShader *geometryShader, Renderer::IFragmentShader *fragmentShader)
@@ -164,7 +166,7 @@ namespace Direct3D9Renderer
 		else
 		{
 			// Create the program
-			return new ProgramHlsl(*mDirect3D9Renderer, static_cast<VertexShaderHlsl*>(vertexShader), static_cast<FragmentShaderHlsl*>(fragmentShader));
+			return new (mDirect3D9Renderer->getAllocator()) ProgramHlsl(*mDirect3D9Renderer, static_cast<VertexShaderHlsl*>(vertexShader), static_cast<FragmentShaderHlsl*>(fragmentShader));
 		}
 
 		// Error! Shader language mismatch!
@@ -184,6 +186,24 @@ namespace Direct3D9Renderer
 		return nullptr;
 	}
 
+	Renderer::IComputeShader *ShaderLanguageHlsl::createComputeShader(const char *, const char *, const char *, const char *)
+	{
+		// Error! Direct3D 9 has no compute shader support.
+		return nullptr;
+	}
+
+	Renderer::IProgram *ShaderLanguageHlsl::createComputeProgram(Renderer::IComputeShader *computeShader)
+	{
+		// Error! Direct3D 9 has no compute shader support.
+		// -> Ensure a correct reference counter behaviour, even in the situation of an error
+		if (nullptr != computeShader)
+		{
+			computeShader->addReference();
+			computeShader->release();
+		}
+		return nullptr;
+	}
+
 	Renderer::IUniformBuffer *ShaderLanguageHlsl::createUniformBuffer(unsigned int, const void *, Renderer::BufferUsage::Enum)
 	{
 		// Error! Direct3D 9 has no uniform buffer support.
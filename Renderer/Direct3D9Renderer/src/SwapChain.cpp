@@ -45,7 +45,9 @@ namespace Direct3D9Renderer
 		ISwapChain(direct3D9Renderer),
 		mDirect3DSwapChain9(nullptr),
 		mDirect3DSurface9RenderTarget(nullptr),
-		mDirect3DSurface9DepthStencil(nullptr)
+		mDirect3DSurface9DepthStencil(nullptr),
+		mSwapInterval(1),
+		mFramePacer(direct3D9Renderer)
 	{
 		// Get the Direct3D 9 device instance
 		IDirect3DDevice9 *direct3DDevice9 = direct3D9Renderer.getDirect3DDevice9();
@@ -88,6 +90,7 @@ namespace Direct3D9Renderer
 		d3dPresentParameters.hDeviceWindow			= hWnd;
 		d3dPresentParameters.Windowed				= TRUE;
 		d3dPresentParameters.EnableAutoDepthStencil = FALSE;
+		d3dPresentParameters.PresentationInterval	= (0 == mSwapInterval) ? D3DPRESENT_INTERVAL_IMMEDIATE : D3DPRESENT_INTERVAL_ONE;
 
 		// Create the Direct3D 9 swap chain
 		// -> Direct3D 9 now also automatically fills the given present parameters instance with the chosen settings
@@ -102,6 +105,10 @@ namespace Direct3D9Renderer
 				&mDirect3DSurface9DepthStencil, nullptr);
 		}
 
+		// Set the estimated number of bytes of the swap chain
+		// -> Back buffer with 32 bit color and a 32 bit depth stencil buffer
+		setNumberOfBytes(static_cast<unsigned long long>(width) * height * (4 + 4));
+
 		// Assign a default name to the resource for debugging purposes
 		#ifndef DIRECT3D9RENDERER_NO_DEBUG
 			setDebugName("Swap chain");
@@ -138,6 +145,9 @@ namespace Direct3D9Renderer
 	//[-------------------------------------------------------]
 	void SwapChain::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D9RENDERER_NO_DEBUG
 			// "IDirect3DSwapChain9" is not derived from "IDirect3DResource9", meaning we can't use the "IDirect3DResource9::SetPrivateData()"-method
 
@@ -237,7 +247,9 @@ namespace Direct3D9Renderer
 		// Is there a valid swap chain?
 		if (nullptr != mDirect3DSwapChain9)
 		{
+			mFramePacer.beginPresent();
 			mDirect3DSwapChain9->Present(nullptr, nullptr, nullptr, nullptr, 0);
+			mFramePacer.endPresent();
 		}
 	}
 
@@ -301,6 +313,7 @@ namespace Direct3D9Renderer
 			d3dPresentParameters.Windowed				= TRUE;
 			d3dPresentParameters.EnableAutoDepthStencil = TRUE;
 			d3dPresentParameters.AutoDepthStencilFormat = D3DFMT_D24X8;
+			d3dPresentParameters.PresentationInterval	= (0 == mSwapInterval) ? D3DPRESENT_INTERVAL_IMMEDIATE : D3DPRESENT_INTERVAL_ONE;
 
 			// Create the Direct3D 9 swap chain
 			// -> Direct3D 9 now also automatically fills the given present parameters instance with the chosen settings
@@ -314,6 +327,10 @@ namespace Direct3D9Renderer
 					D3DFMT_D24S8, d3dPresentParameters.MultiSampleType, d3dPresentParameters.MultiSampleQuality, FALSE,
 					&mDirect3DSurface9DepthStencil, nullptr);
 			}
+
+			// Set the estimated number of bytes of the swap chain
+			// -> Back buffer with 32 bit color and a 32 bit depth stencil buffer
+			setNumberOfBytes(static_cast<unsigned long long>(width) * height * (4 + 4));
 		}
 	}
 
@@ -328,6 +345,45 @@ namespace Direct3D9Renderer
 		// TODO(co) Implement me
 	}
 
+	int SwapChain::getSwapInterval() const
+	{
+		return mSwapInterval;
+	}
+
+	bool SwapChain::setSwapInterval(int swapInterval)
+	{
+		// Windowed Direct3D 9 swap chains can only present at once or once per vertical blank, there's no adaptive vertical synchronization
+		if (swapInterval < -1 || swapInterval > 1)
+		{
+			// Error!
+			return false;
+		}
+		if (mSwapInterval != swapInterval)
+		{
+			// The presentation interval is fixed at swap chain creation, recreate the swap chain
+			mSwapInterval = swapInterval;
+			resizeBuffers();
+		}
+
+		// Done
+		return true;
+	}
+
+	unsigned int SwapChain::getMaximumFrameLatency() const
+	{
+		return mFramePacer.getMaximumFrameLatency();
+	}
+
+	void SwapChain::setMaximumFrameLatency(unsigned int maximumFrameLatency)
+	{
+		mFramePacer.setMaximumFrameLatency(maximumFrameLatency);
+	}
+
+	const Renderer::PresentStatistics &SwapChain::getPresentStatistics() const
+	{
+		return mFramePacer.getPresentStatistics();
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -44,8 +44,12 @@ namespace Direct3D9Renderer
 	*/
 	Texture2D::Texture2D(Direct3D9Renderer &direct3D9Renderer, unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage) :
 		ITexture2D(direct3D9Renderer, width, height),
-		mDirect3DTexture9(nullptr)
+		mDirect3DTexture9(nullptr),
+		mTextureFormat(textureFormat)
 	{
+		// Set the estimated number of bytes of the texture
+		setNumberOfBytes(calculateNumberOfBytes(width, height, 1, Mapping::getDirect3D9Size(textureFormat), 0 != (flags & Renderer::TextureFlag::MIPMAPS), 1));
+
 		// Begin debug event
 		RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(&direct3D9Renderer)
 
@@ -123,6 +127,9 @@ namespace Direct3D9Renderer
 	//[-------------------------------------------------------]
 	void Texture2D::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D9RENDERER_NO_DEBUG
 			// Valid Direct3D 9 texture?
 			if (nullptr != mDirect3DTexture9)
@@ -156,6 +163,31 @@ namespace Direct3D9Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2D methods           ]
+	//[-------------------------------------------------------]
+	void Texture2D::updateRegion(unsigned int mipmap, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data)
+	{
+		// Valid Direct3D 9 texture and data given?
+		if (nullptr != mDirect3DTexture9 && nullptr != data)
+		{
+			// Get the surface
+			IDirect3DSurface9 *direct3DSurface9 = nullptr;
+			mDirect3DTexture9->GetSurfaceLevel(mipmap, &direct3DSurface9);
+			if (nullptr != direct3DSurface9)
+			{
+				// Upload the texture data into the given region
+				const RECT destinationRect[] = { static_cast<LONG>(x), static_cast<LONG>(y), static_cast<LONG>(x + width), static_cast<LONG>(y + height) };
+				const RECT sourceRect[] = { 0, 0, static_cast<LONG>(width), static_cast<LONG>(height) };
+				D3DXLoadSurfaceFromMemory(direct3DSurface9, nullptr, destinationRect, data, static_cast<D3DFORMAT>(Mapping::getDirect3D9Format(mTextureFormat)), width * Mapping::getDirect3D9Size(mTextureFormat), nullptr, sourceRect, D3DX_FILTER_NONE, 0);
+
+				// Release the surface
+				direct3DSurface9->Release();
+			}
+		}
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
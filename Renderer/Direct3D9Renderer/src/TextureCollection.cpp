@@ -44,7 +44,7 @@ namespace Direct3D9Renderer
 	TextureCollection::TextureCollection(Direct3D9Renderer &direct3D9Renderer, unsigned int numberOfTextures, Renderer::ITexture **textures) :
 		Renderer::ITextureCollection(direct3D9Renderer),
 		mNumberOfTextures(numberOfTextures),
-		mTextures((numberOfTextures > 0) ? new Renderer::ITexture*[numberOfTextures] : nullptr)
+		mTextures(direct3D9Renderer.getAllocator().allocateArray<Renderer::ITexture*>(numberOfTextures, Renderer::AllocationTag::RESOURCE))
 	{
 		// Loop through all given textures
 		Renderer::ITexture **currentTexture = mTextures;
@@ -87,7 +87,7 @@ namespace Direct3D9Renderer
 			}
 
 			// Release the allocated memory
-			delete [] mTextures;
+			getRenderer().getAllocator().deallocateArray(mTextures, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
@@ -69,7 +69,7 @@ namespace Direct3D9Renderer
 		// Add a reference to the used vertex buffers
 		if (numberOfAttributes > 0)
 		{
-			mVertexBuffers = new VertexBuffer*[numberOfAttributes];
+			mVertexBuffers = getRenderer().getAllocator().allocateArray<VertexBuffer*>(numberOfAttributes, Renderer::AllocationTag::RESOURCE);
 
 			// Loop through all attributes
 			VertexBuffer **vertexBuffers = mVertexBuffers;
@@ -94,16 +94,16 @@ namespace Direct3D9Renderer
 
 		// Vertex buffer at slot
 		unsigned int numberOfUsedSlots = 0;
-		IDirect3DVertexBuffer9 **direct3DVertexBuffer9AtSlot = new IDirect3DVertexBuffer9*[maximumNumberOfStreams];
+		IDirect3DVertexBuffer9 **direct3DVertexBuffer9AtSlot = getRenderer().getAllocator().allocateArray<IDirect3DVertexBuffer9*>(maximumNumberOfStreams, Renderer::AllocationTag::TEMPORARY);
 		memset(direct3DVertexBuffer9AtSlot, 0, sizeof(IDirect3DVertexBuffer9*) * maximumNumberOfStreams);
-		unsigned int *strideAtSlot = new unsigned int[maximumNumberOfStreams];
+		unsigned int *strideAtSlot = getRenderer().getAllocator().allocateArray<unsigned int>(maximumNumberOfStreams, Renderer::AllocationTag::TEMPORARY);
 		memset(strideAtSlot, 0, sizeof(unsigned int) * maximumNumberOfStreams);
-		unsigned int *instancesPerElementAtSlot = new unsigned int[maximumNumberOfStreams];
+		unsigned int *instancesPerElementAtSlot = getRenderer().getAllocator().allocateArray<unsigned int>(maximumNumberOfStreams, Renderer::AllocationTag::TEMPORARY);
 		memset(instancesPerElementAtSlot, 0, sizeof(unsigned int) * maximumNumberOfStreams);
 
 		// Create Direct3D 9 vertex elements
 		// -> While doing so, collect the per slot vertex buffer, stride and instances per element information
-		D3DVERTEXELEMENT9 *d3dVertexElements   = new D3DVERTEXELEMENT9[numberOfAttributes + 1];	// +1 for D3DDECL_END()
+		D3DVERTEXELEMENT9 *d3dVertexElements   = getRenderer().getAllocator().allocateArray<D3DVERTEXELEMENT9>(numberOfAttributes + 1, Renderer::AllocationTag::TEMPORARY);	// +1 for D3DDECL_END()
 		D3DVERTEXELEMENT9 *d3dVertexElement    = d3dVertexElements;
 		D3DVERTEXELEMENT9 *d3dVertexElementEnd = d3dVertexElements + numberOfAttributes;
 		for (; d3dVertexElement < d3dVertexElementEnd; ++d3dVertexElement, ++attributes)
@@ -144,7 +144,7 @@ namespace Direct3D9Renderer
 				else
 				{
 					// Error! Clean up and get us out of here right now!
-					delete [] d3dVertexElements;
+					getRenderer().getAllocator().deallocateArray(d3dVertexElements, Renderer::AllocationTag::TEMPORARY);
 					return;	// Ugly return, but we haven't much choice in here
 				}
 			}
@@ -169,7 +169,7 @@ namespace Direct3D9Renderer
 		direct3D9Renderer.getDirect3DDevice9()->CreateVertexDeclaration(d3dVertexElements, &mDirect3DVertexDeclaration9);
 
 		// Destroy Direct3D 9 vertex elements
-		delete [] d3dVertexElements;
+		getRenderer().getAllocator().deallocateArray(d3dVertexElements, Renderer::AllocationTag::TEMPORARY);
 
 		// Valid Direct3D 9 input layout?
 		if (nullptr != mDirect3DVertexDeclaration9 && numberOfAttributes > 0)
@@ -178,22 +178,22 @@ namespace Direct3D9Renderer
 			mNumberOfSlots = numberOfUsedSlots;
 
 			// Buffers
-			mDirect3DVertexBuffer9 = new IDirect3DVertexBuffer9*[mNumberOfSlots];
+			mDirect3DVertexBuffer9 = getRenderer().getAllocator().allocateArray<IDirect3DVertexBuffer9*>(mNumberOfSlots, Renderer::AllocationTag::RESOURCE);
 			memcpy(mDirect3DVertexBuffer9, direct3DVertexBuffer9AtSlot, sizeof(IDirect3DVertexBuffer9*) * mNumberOfSlots);
 
 			// Strides
-			mStrides = new unsigned int[mNumberOfSlots];
+			mStrides = getRenderer().getAllocator().allocateArray<unsigned int>(mNumberOfSlots, Renderer::AllocationTag::RESOURCE);
 			memcpy(mStrides, strideAtSlot, sizeof(unsigned int) * mNumberOfSlots);
 
 			// Instances per element
-			mInstancesPerElement = new unsigned int[mNumberOfSlots];
+			mInstancesPerElement = getRenderer().getAllocator().allocateArray<unsigned int>(mNumberOfSlots, Renderer::AllocationTag::RESOURCE);
 			memcpy(mInstancesPerElement, instancesPerElementAtSlot, sizeof(unsigned int) * mNumberOfSlots);
 		}
 
 		// Cleanup
-		delete [] instancesPerElementAtSlot;
-		delete [] strideAtSlot;
-		delete [] direct3DVertexBuffer9AtSlot;
+		getRenderer().getAllocator().deallocateArray(instancesPerElementAtSlot, Renderer::AllocationTag::TEMPORARY);
+		getRenderer().getAllocator().deallocateArray(strideAtSlot, Renderer::AllocationTag::TEMPORARY);
+		getRenderer().getAllocator().deallocateArray(direct3DVertexBuffer9AtSlot, Renderer::AllocationTag::TEMPORARY);
 	}
 
 	/**
@@ -217,9 +217,9 @@ namespace Direct3D9Renderer
 		// Cleanup Direct3D 9 input slot data
 		if (nullptr != mDirect3DVertexBuffer9)
 		{
-			delete [] mDirect3DVertexBuffer9;
-			delete [] mStrides;
-			delete [] mInstancesPerElement;
+			getRenderer().getAllocator().deallocateArray(mDirect3DVertexBuffer9, Renderer::AllocationTag::RESOURCE);
+			getRenderer().getAllocator().deallocateArray(mStrides, Renderer::AllocationTag::RESOURCE);
+			getRenderer().getAllocator().deallocateArray(mInstancesPerElement, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Release the reference to the used vertex buffers
@@ -233,7 +233,7 @@ namespace Direct3D9Renderer
 			}
 
 			// Cleanup
-			delete [] mVertexBuffers;
+			getRenderer().getAllocator().deallocateArray(mVertexBuffers, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Release our Direct3D 9 device reference
@@ -46,6 +46,9 @@ namespace Direct3D9Renderer
 		IVertexBuffer(direct3D9Renderer),
 		mDirect3DVertexBuffer9(nullptr)
 	{
+		// Set the estimated number of bytes of the vertex buffer
+		setNumberOfBytes(numberOfBytes);
+
 		// Create the Direct3D 9 vertex buffer
 		direct3D9Renderer.getDirect3DDevice9()->CreateVertexBuffer(numberOfBytes, Mapping::getDirect3D9Usage(bufferUsage), 0, D3DPOOL_DEFAULT, &mDirect3DVertexBuffer9, nullptr);
 
@@ -81,6 +84,9 @@ namespace Direct3D9Renderer
 	//[-------------------------------------------------------]
 	void VertexBuffer::setDebugName(const char *name)
 	{
+		// Account the memory of this resource to the debug name within the renderer statistics
+		IResource::setDebugName(name);
+
 		#ifndef DIRECT3D9RENDERER_NO_DEBUG
 			// Valid Direct3D 9 vertex buffer?
 			if (nullptr != mDirect3DVertexBuffer9)
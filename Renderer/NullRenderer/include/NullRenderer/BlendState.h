@@ -52,7 +52,7 @@ namespace NullRenderer
 	*  @brief
 	*    Null blend state class
 	*/
-	class BlendState : public Renderer::IBlendState
+	class BlendState final : public Renderer::IBlendState
 	{
 
 
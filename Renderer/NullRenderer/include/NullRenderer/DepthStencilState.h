@@ -52,7 +52,7 @@ namespace NullRenderer
 	*  @brief
 	*    Null depth stencil state class
 	*/
-	class DepthStencilState : public Renderer::IDepthStencilState
+	class DepthStencilState final : public Renderer::IDepthStencilState
 	{
 
 
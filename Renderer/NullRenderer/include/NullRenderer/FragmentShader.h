@@ -52,7 +52,7 @@ namespace NullRenderer
 	*  @brief
 	*    Null fragment shader ("pixel shader" in Direct3D terminology) class
 	*/
-	class FragmentShader : public Renderer::IFragmentShader
+	class FragmentShader final : public Renderer::IFragmentShader
 	{
 
 
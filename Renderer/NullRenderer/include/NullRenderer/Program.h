@@ -44,6 +44,7 @@ namespace NullRenderer
 	//[-------------------------------------------------------]
 	class NullRenderer;
 	class VertexShader;
+	class ComputeShader;
 	class GeometryShader;
 	class FragmentShader;
 	class TessellationControlShader;
@@ -57,7 +58,7 @@ namespace NullRenderer
 	*  @brief
 	*    Null program class
 	*/
-	class Program : public Renderer::IProgram
+	class Program final : public Renderer::IProgram
 	{
 
 
@@ -87,6 +88,20 @@ namespace NullRenderer
 		*/
 		Program(NullRenderer &nullRenderer, VertexShader *vertexShader, TessellationControlShader *tessellationControlShader, TessellationEvaluationShader *tessellationEvaluationShader, GeometryShader *geometryShader, FragmentShader *fragmentShader);
 
+		/**
+		*  @brief
+		*    Compute program constructor
+		*
+		*  @param[in] nullRenderer
+		*    Owner null renderer instance
+		*  @param[in] computeShader
+		*    Compute shader the program is using, must be valid
+		*
+		*  @note
+		*    - The program keeps a reference to the provided shader and releases it when no longer required
+		*/
+		Program(NullRenderer &nullRenderer, ComputeShader &computeShader);
+
 		/**
 		*  @brief
 		*    Destructor
@@ -99,6 +114,7 @@ namespace NullRenderer
 	//[-------------------------------------------------------]
 	public:
 		virtual Renderer::IVertexArray *createVertexArray(unsigned int numberOfAttributes, const Renderer::VertexArrayAttribute *attributes, Renderer::IIndexBuffer *indexBuffer = nullptr) override;
+		virtual bool setStreamOutputVaryings(unsigned int numberOfVaryings, const char **varyingNames, bool interleaved = true) override;
 
 
 	};
@@ -52,7 +52,7 @@ namespace NullRenderer
 	*  @brief
 	*    Null rasterizer state class
 	*/
-	class RasterizerState : public Renderer::IRasterizerState
+	class RasterizerState final : public Renderer::IRasterizerState
 	{
 
 
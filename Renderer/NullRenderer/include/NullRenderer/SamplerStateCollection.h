@@ -59,7 +59,7 @@ namespace NullRenderer
 	*  @brief
 	*    Null sampler state collection class
 	*/
-	class SamplerStateCollection : public Renderer::ISamplerStateCollection
+	class SamplerStateCollection final : public Renderer::ISamplerStateCollection
 	{
 
 
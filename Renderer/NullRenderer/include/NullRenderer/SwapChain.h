@@ -30,6 +30,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <Renderer/ISwapChain.h>
+#include <Renderer/FramePacer.h>
 
 
 //[-------------------------------------------------------]
@@ -55,7 +56,7 @@ namespace NullRenderer
 	*  @brief
 	*    Null swap chain class
 	*/
-	class SwapChain : public Renderer::ISwapChain
+	class SwapChain final : public Renderer::ISwapChain
 	{
 
 
@@ -97,13 +98,20 @@ namespace NullRenderer
 		virtual void resizeBuffers() override;
 		virtual bool getFullscreenState() const override;
 		virtual void setFullscreenState(bool fullscreen) override;
+		virtual int getSwapInterval() const override;
+		virtual bool setSwapInterval(int swapInterval) override;
+		virtual unsigned int getMaximumFrameLatency() const override;
+		virtual void setMaximumFrameLatency(unsigned int maximumFrameLatency) override;
+		virtual const Renderer::PresentStatistics &getPresentStatistics() const override;
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		handle mNativeWindowHandle;	/**< Native window handle window, can be a null handle */
+		handle					 mNativeWindowHandle;	/**< Native window handle window, can be a null handle */
+		int						 mSwapInterval;			/**< Swap interval, see "Renderer::ISwapChain::setSwapInterval()" */
+		Renderer::FramePacer	 mFramePacer;			/**< Frame pacer recording the present intervals */
 
 
 	};
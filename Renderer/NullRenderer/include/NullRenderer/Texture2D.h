@@ -52,7 +52,7 @@ namespace NullRenderer
 	*  @brief
 	*    Null 2D texture class
 	*/
-	class Texture2D : public Renderer::ITexture2D
+	class Texture2D final : public Renderer::ITexture2D
 	{
 
 
@@ -80,6 +80,13 @@ namespace NullRenderer
 		virtual ~Texture2D();
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2D methods           ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void updateRegion(unsigned int mipmap, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data) override;
+
+
 	};
 
 
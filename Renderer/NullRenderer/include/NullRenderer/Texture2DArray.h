@@ -52,7 +52,7 @@ namespace NullRenderer
 	*  @brief
 	*    Null 2D array texture class
 	*/
-	class Texture2DArray : public Renderer::ITexture2DArray
+	class Texture2DArray final : public Renderer::ITexture2DArray
 	{
 
 
@@ -82,6 +82,13 @@ namespace NullRenderer
 		virtual ~Texture2DArray();
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2DArray methods      ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void updateRegion(unsigned int mipmap, unsigned int slice, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data) override;
+
+
 	};
 
 
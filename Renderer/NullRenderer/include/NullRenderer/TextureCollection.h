@@ -59,7 +59,7 @@ namespace NullRenderer
 	*  @brief
 	*    Null texture collection class
 	*/
-	class TextureCollection : public Renderer::ITextureCollection
+	class TextureCollection final : public Renderer::ITextureCollection
 	{
 
 
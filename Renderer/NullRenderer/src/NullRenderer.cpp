@@ -27,6 +27,7 @@
 #include "NullRenderer/Texture2D.h"
 #include "NullRenderer/Texture2DArray.h"
 #include "NullRenderer/IndexBuffer.h"
+#include "NullRenderer/IndirectBuffer.h"
 #include "NullRenderer/BlendState.h"
 #include "NullRenderer/SamplerState.h"
 #include "NullRenderer/TextureBuffer.h"
@@ -40,6 +41,7 @@
 #include "NullRenderer/SamplerStateCollection.h"
 #include "NullRenderer/ShaderLanguage.h"
 #include "NullRenderer/UniformBuffer.h"
+#include "NullRenderer/Fence.h"
 
 #include <string.h>
 
@@ -53,9 +55,9 @@
 #else
 	#define NULLRENDERER_API_EXPORT
 #endif
-NULLRENDERER_API_EXPORT Renderer::IRenderer *createNullRendererInstance(handle nativeWindowHandle)
+NULLRENDERER_API_EXPORT Renderer::IRenderer *createNullRendererInstance(handle nativeWindowHandle, Renderer::IAllocator *allocator)
 {
-	return new NullRenderer::NullRenderer(nativeWindowHandle);
+	return new ((nullptr != allocator) ? *allocator : Renderer::DefaultAllocator::getInstance()) NullRenderer::NullRenderer(nativeWindowHandle, allocator);
 }
 #undef NULLRENDERER_API_EXPORT
 
@@ -74,10 +76,24 @@ namespace NullRenderer
 	*  @brief
 	*    Constructor
 	*/
-	NullRenderer::NullRenderer(handle nativeWindowHandle) :
+	NullRenderer::NullRenderer(handle nativeWindowHandle, Renderer::IAllocator *allocator) :
+		IRenderer(allocator),
 		mShaderLanguage(nullptr),
 		mMainSwapChain(nullptr),
-		mRenderTarget(nullptr)
+		mRenderTarget(nullptr),
+		mVertexBufferPool(getAllocator(), sizeof(VertexBuffer)),
+		mIndexBufferPool(getAllocator(), sizeof(IndexBuffer)),
+		mTextureBufferPool(getAllocator(), sizeof(TextureBuffer)),
+		mIndirectBufferPool(getAllocator(), sizeof(IndirectBuffer)),
+		mTexture2DPool(getAllocator(), sizeof(Texture2D)),
+		mTexture2DArrayPool(getAllocator(), sizeof(Texture2DArray)),
+		mRasterizerStatePool(getAllocator(), sizeof(RasterizerState)),
+		mDepthStencilStatePool(getAllocator(), sizeof(DepthStencilState)),
+		mBlendStatePool(getAllocator(), sizeof(BlendState)),
+		mSamplerStatePool(getAllocator(), sizeof(SamplerState)),
+		mTextureCollectionPool(getAllocator(), sizeof(TextureCollection)),
+		mSamplerStateCollectionPool(getAllocator(), sizeof(SamplerStateCollection)),
+		mUniformBufferPool(getAllocator(), sizeof(UniformBuffer))
 	{
 		// Initialize the capabilities
 		initializeCapabilities();
@@ -140,6 +156,15 @@ namespace NullRenderer
 		}
 	}
 
+	/**
+	*  @brief
+	*    Return the pool for the uniform buffer instances
+	*/
+	Renderer::ResourcePool &NullRenderer::getUniformBufferPool()
+	{
+		return mUniformBufferPool;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IRenderer methods            ]
@@ -195,7 +220,7 @@ namespace NullRenderer
 				// If required, create the null shader language instance right now
 				if (nullptr == mShaderLanguage)
 				{
-					mShaderLanguage = new ShaderLanguage(*this);
+					mShaderLanguage = new (getAllocator()) ShaderLanguage(*this);
 					mShaderLanguage->addReference();	// Internal renderer reference
 				}
 
@@ -218,7 +243,7 @@ namespace NullRenderer
 	Renderer::ISwapChain *NullRenderer::createSwapChain(handle nativeWindowHandle)
 	{
 		// The provided native window handle must not be a null handle
-		return (NULL_HANDLE != nativeWindowHandle) ? new SwapChain(*this, nativeWindowHandle) : nullptr;
+		return (NULL_HANDLE != nativeWindowHandle) ? new (getAllocator()) SwapChain(*this, nativeWindowHandle) : nullptr;
 	}
 
 	Renderer::IFramebuffer *NullRenderer::createFramebuffer(unsigned int numberOfColorTextures, Renderer::ITexture **colorTextures, Renderer::ITexture *depthStencilTexture)
@@ -251,62 +276,67 @@ namespace NullRenderer
 		}
 
 		// Create the framebuffer instance
-		return new Framebuffer(*this);
+		return new (getAllocator()) Framebuffer(*this);
 	}
 
 	Renderer::IVertexBuffer *NullRenderer::createVertexBuffer(unsigned int, const void *, Renderer::BufferUsage::Enum)
 	{
-		return new VertexBuffer(*this);
+		return new (mVertexBufferPool) VertexBuffer(*this);
 	}
 
 	Renderer::IIndexBuffer *NullRenderer::createIndexBuffer(unsigned int, Renderer::IndexBufferFormat::Enum, const void *, Renderer::BufferUsage::Enum)
 	{
-		return new IndexBuffer(*this);
+		return new (mIndexBufferPool) IndexBuffer(*this);
 	}
 
 	Renderer::ITextureBuffer *NullRenderer::createTextureBuffer(unsigned int, Renderer::TextureFormat::Enum, const void *, Renderer::BufferUsage::Enum)
 	{
-		return new TextureBuffer(*this);
+		return new (mTextureBufferPool) TextureBuffer(*this);
+	}
+
+	Renderer::IIndirectBuffer *NullRenderer::createIndirectBuffer(unsigned int, const void *, Renderer::BufferUsage::Enum)
+	{
+		return new (mIndirectBufferPool) IndirectBuffer(*this);
 	}
 
-	Renderer::ITexture2D *NullRenderer::createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum, void *, unsigned int, Renderer::TextureUsage::Enum)
+	Renderer::ITexture2D *NullRenderer::createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum, void *, unsigned int, Renderer::TextureUsage::Enum, unsigned int)
 	{
-		return new Texture2D(*this, width, height);
+		return new (mTexture2DPool) Texture2D(*this, width, height);
 	}
 
 	Renderer::ITexture2DArray *NullRenderer::createTexture2DArray(unsigned int width, unsigned int height, unsigned int numberOfSlices, Renderer::TextureFormat::Enum, void *, unsigned int, Renderer::TextureUsage::Enum)
 	{
-		return new Texture2DArray(*this, width, height, numberOfSlices);
+		return new (mTexture2DArrayPool) Texture2DArray(*this, width, height, numberOfSlices);
 	}
 
 	Renderer::IRasterizerState *NullRenderer::createRasterizerState(const Renderer::RasterizerState &)
 	{
-		return new RasterizerState(*this);
+		return new (mRasterizerStatePool) RasterizerState(*this);
 	}
 
 	Renderer::IDepthStencilState *NullRenderer::createDepthStencilState(const Renderer::DepthStencilState &)
 	{
-		return new DepthStencilState(*this);
+		return new (mDepthStencilStatePool) DepthStencilState(*this);
 	}
 
 	Renderer::IBlendState *NullRenderer::createBlendState(const Renderer::BlendState &)
 	{
-		return new BlendState(*this);
+		return new (mBlendStatePool) BlendState(*this);
 	}
 
 	Renderer::ISamplerState *NullRenderer::createSamplerState(const Renderer::SamplerState &)
 	{
-		return new SamplerState(*this);
+		return new (mSamplerStatePool) SamplerState(*this);
 	}
 
 	Renderer::ITextureCollection *NullRenderer::createTextureCollection(unsigned int numberOfTextures, Renderer::ITexture **textures)
 	{
-		return new TextureCollection(*this, numberOfTextures, textures);
+		return new (mTextureCollectionPool) TextureCollection(*this, numberOfTextures, textures);
 	}
 
 	Renderer::ISamplerStateCollection *NullRenderer::createSamplerStateCollection(unsigned int numberOfSamplerStates, Renderer::ISamplerState **samplerStates)
 	{
-		return new SamplerStateCollection(*this, numberOfSamplerStates, samplerStates);
+		return new (mSamplerStateCollectionPool) SamplerStateCollection(*this, numberOfSamplerStates, samplerStates);
 	}
 
 
@@ -324,6 +354,17 @@ namespace NullRenderer
 		// Nothing to do in here
 	}
 
+	bool NullRenderer::copyResource(Renderer::IResource &, Renderer::IResource &)
+	{
+		// Nothing to do in here
+		return true;
+	}
+
+	void NullRenderer::setTextureResident(Renderer::ITexture &, Renderer::ISamplerState *, bool)
+	{
+		// Nothing to do in here
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ States                                                ]
@@ -574,6 +615,37 @@ namespace NullRenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Stream-output (SO) stage                              ]
+	//[-------------------------------------------------------]
+	void NullRenderer::soSetTargets(unsigned int numberOfTargets, Renderer::IVertexBuffer **vertexBuffers, const unsigned int *)
+	{
+		// Nothing to do in here, the following is just for debugging
+		// Are the given vertex buffers valid?
+		if (nullptr != vertexBuffers)
+		{
+			for (unsigned int i = 0; i < numberOfTargets; ++i)
+			{
+				if (nullptr != vertexBuffers[i])
+				{
+					// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+					NULLRENDERER_RENDERERMATCHCHECK_RETURN(*this, *vertexBuffers[i])
+				}
+			}
+		}
+	}
+
+	void NullRenderer::soBegin(Renderer::PrimitiveTopology::Enum, bool)
+	{
+		// Nothing to do in here
+	}
+
+	void NullRenderer::soEnd()
+	{
+		// Nothing to do in here
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Rasterizer (RS) stage                                 ]
 	//[-------------------------------------------------------]
@@ -718,6 +790,70 @@ namespace NullRenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Compute-shader (CS) stage                             ]
+	//[-------------------------------------------------------]
+	void NullRenderer::csSetTexture(unsigned int, Renderer::ITexture *texture)
+	{
+		// Nothing to do in here, the following is just for debugging
+		if (nullptr != texture)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			NULLRENDERER_RENDERERMATCHCHECK_RETURN(*this, *texture)
+		}
+	}
+
+	void NullRenderer::csSetTextureCollection(unsigned int, Renderer::ITextureCollection *textureCollection)
+	{
+		// Nothing to do in here, the following is just for debugging
+		if (nullptr != textureCollection)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			NULLRENDERER_RENDERERMATCHCHECK_RETURN(*this, *textureCollection)
+		}
+	}
+
+	void NullRenderer::csSetSamplerState(unsigned int, Renderer::ISamplerState *samplerState)
+	{
+		// Nothing to do in here, the following is just for debugging
+		if (nullptr != samplerState)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			NULLRENDERER_RENDERERMATCHCHECK_RETURN(*this, *samplerState)
+		}
+	}
+
+	void NullRenderer::csSetSamplerStateCollection(unsigned int, Renderer::ISamplerStateCollection *samplerStateCollection)
+	{
+		// Nothing to do in here, the following is just for debugging
+		if (nullptr != samplerStateCollection)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			NULLRENDERER_RENDERERMATCHCHECK_RETURN(*this, *samplerStateCollection)
+		}
+	}
+
+	void NullRenderer::csSetUniformBuffer(unsigned int, Renderer::IUniformBuffer *uniformBuffer)
+	{
+		// Nothing to do in here, the following is just for debugging
+		if (nullptr != uniformBuffer)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			NULLRENDERER_RENDERERMATCHCHECK_RETURN(*this, *uniformBuffer)
+		}
+	}
+
+	void NullRenderer::csSetUnorderedAccessView(unsigned int, Renderer::IResource *resource)
+	{
+		// Nothing to do in here, the following is just for debugging
+		if (nullptr != resource)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			NULLRENDERER_RENDERERMATCHCHECK_RETURN(*this, *resource)
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Operations                                            ]
 	//[-------------------------------------------------------]
@@ -739,6 +875,15 @@ namespace NullRenderer
 		// Nothing to do in here
 	}
 
+	void NullRenderer::resolveMultisampleFramebuffer(Renderer::IRenderTarget &destinationRenderTarget, Renderer::IFramebuffer &sourceMultisampleFramebuffer)
+	{
+		// Nothing to do in here, the following is just for debugging
+
+		// Security check: Are the given resources owned by this renderer? (calls "return" in case of a mismatch)
+		NULLRENDERER_RENDERERMATCHCHECK_RETURN(*this, destinationRenderTarget)
+		NULLRENDERER_RENDERERMATCHCHECK_RETURN(*this, sourceMultisampleFramebuffer)
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Draw call                                             ]
@@ -763,10 +908,54 @@ namespace NullRenderer
 		// Nothing to do in here
 	}
 
+	void NullRenderer::multiDrawIndexedIndirect(Renderer::IIndirectBuffer &indirectBuffer, unsigned int, unsigned int)
+	{
+		// Nothing to do in here, the following is just for debugging
+
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		NULLRENDERER_RENDERERMATCHCHECK_RETURN(*this, indirectBuffer)
+	}
+
+	void NullRenderer::drawAuto()
+	{
+		// Nothing to do in here
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Compute                                               ]
+	//[-------------------------------------------------------]
+	void NullRenderer::dispatch(unsigned int, unsigned int, unsigned int)
+	{
+		// Nothing to do in here
+	}
+
+	void NullRenderer::memoryBarrier(unsigned int)
+	{
+		// Nothing to do in here
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Synchronization                                       ]
 	//[-------------------------------------------------------]
+	Renderer::IFence *NullRenderer::insertFence()
+	{
+		return new (getAllocator()) Fence(*this);
+	}
+
+	bool NullRenderer::isFenceSignaled(Renderer::IFence &)
+	{
+		// There's nothing to wait for, the fence is always signaled
+		return true;
+	}
+
+	bool NullRenderer::waitFence(Renderer::IFence &, unsigned int)
+	{
+		// There's nothing to wait for, the fence is always signaled
+		return true;
+	}
+
 	void NullRenderer::flush()
 	{
 		// Nothing to do in here
@@ -778,6 +967,19 @@ namespace NullRenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Swap chain                                            ]
+	//[-------------------------------------------------------]
+	void NullRenderer::presentSwapChains(unsigned int numberOfSwapChains, Renderer::ISwapChain **swapChains)
+	{
+		// There's nothing to batch in here
+		for (unsigned int i = 0; i < numberOfSwapChains; ++i)
+		{
+			swapChains[i]->present();
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Debug                                                 ]
 	//[-------------------------------------------------------]
@@ -826,6 +1028,9 @@ namespace NullRenderer
 		// Maximum number of 2D texture array slices (usually 512, in case there's no support for 2D texture arrays it's 0)
 		mCapabilities.maximumNumberOf2DTextureArraySlices = 42;
 
+		// Maximum number of multisamples per texel of a render target texture (always at least 1, usually 8)
+		mCapabilities.maximumNumberOfMultisamples = 8;
+
 		// Uniform buffer object (UBO, "constant buffer" in Direct3D terminology) supported?
 		mCapabilities.uniformBuffer = true;
 
@@ -844,6 +1049,9 @@ namespace NullRenderer
 		// Base vertex supported for draw calls?
 		mCapabilities.baseVertex = true;
 
+		// Native multi-draw indirect supported?
+		mCapabilities.multiDrawIndirect = true;
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = true;
 
@@ -855,6 +1063,12 @@ namespace NullRenderer
 
 		// Is there support for fragment shaders (FS)?
 		mCapabilities.fragmentShader = true;
+
+		// Is there support for compute shaders (CS)?
+		mCapabilities.computeShader = true;
+
+		// Maximum number of stream output ("transform feedback" in OpenGL terminology) target vertex buffers (usually 0 for no stream output support or 4)
+		mCapabilities.maximumNumberOfStreamOutputTargets = 4;
 	}
 
 
@@ -26,6 +26,7 @@
 #include "NullRenderer/IndexBuffer.h"
 #include "NullRenderer/VertexBuffer.h"
 #include "NullRenderer/VertexShader.h"
+#include "NullRenderer/ComputeShader.h"
 #include "NullRenderer/GeometryShader.h"
 #include "NullRenderer/FragmentShader.h"
 #include "NullRenderer/TessellationControlShader.h"
@@ -80,6 +81,19 @@ namespace NullRenderer
 		}
 	}
 
+	/**
+	*  @brief
+	*    Compute program constructor
+	*/
+	Program::Program(NullRenderer &nullRenderer, ComputeShader &computeShader) :
+		IProgram(reinterpret_cast<Renderer::IRenderer&>(nullRenderer))
+	{
+		// We don't keep a reference to the shader in here
+		// -> Ensure a correct reference counter behaviour
+		computeShader.addReference();
+		computeShader.release();
+	}
+
 	/**
 	*  @brief
 	*    Destructor
@@ -112,7 +126,13 @@ namespace NullRenderer
 		}
 
 		// Create the vertex array instance
-		return new VertexArray(reinterpret_cast<NullRenderer&>(getRenderer()));
+		return new (getRenderer().getAllocator()) VertexArray(reinterpret_cast<NullRenderer&>(getRenderer()));
+	}
+
+	bool Program::setStreamOutputVaryings(unsigned int, const char **, bool)
+	{
+		// Nothing to do in here
+		return true;
 	}
 
 
@@ -43,7 +43,7 @@ namespace NullRenderer
 	SamplerStateCollection::SamplerStateCollection(NullRenderer &nullRenderer, unsigned int numberOfSamplerStates, Renderer::ISamplerState **samplerStates) :
 		Renderer::ISamplerStateCollection(nullRenderer),
 		mNumberOfSamplerStates(numberOfSamplerStates),
-		mSamplerStates((numberOfSamplerStates > 0) ? new Renderer::ISamplerState*[numberOfSamplerStates] : nullptr)
+		mSamplerStates(nullRenderer.getAllocator().allocateArray<Renderer::ISamplerState*>(numberOfSamplerStates, Renderer::AllocationTag::RESOURCE))
 	{
 		// Loop through all given textures
 		Renderer::ISamplerState **currentSamplerState = mSamplerStates;
@@ -86,7 +86,7 @@ namespace NullRenderer
 			}
 
 			// Release the allocated memory
-			delete [] mSamplerStates;
+			getRenderer().getAllocator().deallocateArray(mSamplerStates, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
@@ -22,9 +22,11 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "NullRenderer/ShaderLanguage.h"
+#include "NullRenderer/NullRenderer.h"
 #include "NullRenderer/Program.h"
 #include "NullRenderer/VertexShader.h"
 #include "NullRenderer/UniformBuffer.h"
+#include "NullRenderer/ComputeShader.h"
 #include "NullRenderer/GeometryShader.h"
 #include "NullRenderer/FragmentShader.h"
 #include "NullRenderer/TessellationControlShader.h"
@@ -78,31 +80,31 @@ namespace NullRenderer
 	Renderer::IVertexShader *ShaderLanguage::createVertexShader(const char *, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::vertexShader", we know there's vertex shader support
-		return new VertexShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		return new (getRenderer().getAllocator()) VertexShader(reinterpret_cast<NullRenderer&>(getRenderer()));
 	}
 
 	Renderer::ITessellationControlShader *ShaderLanguage::createTessellationControlShader(const char *, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::maximumNumberOfPatchVertices", we know there's tessellation control shader support
-		return new TessellationControlShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		return new (getRenderer().getAllocator()) TessellationControlShader(reinterpret_cast<NullRenderer&>(getRenderer()));
 	}
 
 	Renderer::ITessellationEvaluationShader *ShaderLanguage::createTessellationEvaluationShader(const char *, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::maximumNumberOfPatchVertices", we know there's tessellation evaluation shader support
-		return new TessellationEvaluationShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		return new (getRenderer().getAllocator()) TessellationEvaluationShader(reinterpret_cast<NullRenderer&>(getRenderer()));
 	}
 
 	Renderer::IGeometryShader *ShaderLanguage::createGeometryShader(const char *, Renderer::GsInputPrimitiveTopology::Enum, Renderer::GsOutputPrimitiveTopology::Enum, unsigned int, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::maximumNumberOfGsOutputVertices", we know there's geometry shader support
-		return new GeometryShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		return new (getRenderer().getAllocator()) GeometryShader(reinterpret_cast<NullRenderer&>(getRenderer()));
 	}
 
 	Renderer::IFragmentShader *ShaderLanguage::createFragmentShader(const char *, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::fragmentShader", we know there's fragment shader support
-		return new FragmentShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		return new (getRenderer().getAllocator()) FragmentShader(reinterpret_cast<NullRenderer&>(getRenderer()));
 	}
 
 	Renderer::IProgram *ShaderLanguage::createProgram(Renderer::IVertexShader *vertexShader, Renderer::ITessellationControlShader *tessellationControlShader, Renderer::ITessellationEvaluationShader *tessellationEvaluationShader, Renderer::IGeometryShader *geometryShader, Renderer::IFragmentShader *fragmentShader)
@@ -133,7 +135,7 @@ namespace NullRenderer
 		}
 		else
 		{
-			return new Program(reinterpret_cast<NullRenderer&>(getRenderer()), static_cast<VertexShader*>(vertexShader), static_cast<TessellationControlShader*>(tessellationControlShader), static_cast<TessellationEvaluationShader*>(tessellationEvaluationShader), static_cast<GeometryShader*>(geometryShader), static_cast<FragmentShader*>(fragmentShader));
+			return new (getRenderer().getAllocator()) Program(reinterpret_cast<NullRenderer&>(getRenderer()), static_cast<VertexShader*>(vertexShader), static_cast<TessellationControlShader*>(tessellationControlShader), static_cast<TessellationEvaluationShader*>(tessellationEvaluationShader), static_cast<GeometryShader*>(geometryShader), static_cast<FragmentShader*>(fragmentShader));
 		}
 
 		// Error! Shader language mismatch!
@@ -168,9 +170,41 @@ namespace NullRenderer
 		return nullptr;
 	}
 
+	Renderer::IComputeShader *ShaderLanguage::createComputeShader(const char *, const char *, const char *, const char *)
+	{
+		// There's no need to check for "Renderer::Capabilities::computeShader", we know there's compute shader support
+		return new (getRenderer().getAllocator()) ComputeShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+	}
+
+	Renderer::IProgram *ShaderLanguage::createComputeProgram(Renderer::IComputeShader *computeShader)
+	{
+		// The compute shader and program language must match!
+		// -> Optimization: Comparing the shader language name by directly comparing the pointer address of
+		//    the name is safe because we know that we always reference to one and the same name address
+		// TODO(co) Add security check: Is the given resource one of the currently used renderer?
+		if (nullptr == computeShader)
+		{
+			// Error! A compute program requires a compute shader!
+		}
+		else if (computeShader->getShaderLanguageName() != NAME)
+		{
+			// Error! Compute shader language mismatch!
+			// -> Ensure a correct reference counter behaviour, even in the situation of an error
+			computeShader->addReference();
+			computeShader->release();
+		}
+		else
+		{
+			return new (getRenderer().getAllocator()) Program(reinterpret_cast<NullRenderer&>(getRenderer()), *static_cast<ComputeShader*>(computeShader));
+		}
+
+		// Error!
+		return nullptr;
+	}
+
 	Renderer::IUniformBuffer *ShaderLanguage::createUniformBuffer(unsigned int, const void *, Renderer::BufferUsage::Enum)
 	{
-		return new UniformBuffer(reinterpret_cast<NullRenderer&>(getRenderer()));
+		return new (reinterpret_cast<NullRenderer&>(getRenderer()).getUniformBufferPool()) UniformBuffer(reinterpret_cast<NullRenderer&>(getRenderer()));
 	}
 
 
@@ -47,7 +47,9 @@ namespace NullRenderer
 	*/
 	SwapChain::SwapChain(NullRenderer &nullRenderer, handle nativeWindowHandle) :
 		ISwapChain(nullRenderer),
-		mNativeWindowHandle(nativeWindowHandle)
+		mNativeWindowHandle(nativeWindowHandle),
+		mSwapInterval(0),
+		mFramePacer(nullRenderer)
 	{
 		// Nothing to do in here
 	}
@@ -138,7 +140,9 @@ namespace NullRenderer
 
 	void SwapChain::present()
 	{
-		// Nothing to do in here
+		// Nothing to present, but the present intervals are of interest nevertheless
+		mFramePacer.beginPresent();
+		mFramePacer.endPresent();
 	}
 
 	void SwapChain::resizeBuffers()
@@ -157,6 +161,33 @@ namespace NullRenderer
 		// We don't support fullscreen state change, so, nothing to do in here
 	}
 
+	int SwapChain::getSwapInterval() const
+	{
+		return mSwapInterval;
+	}
+
+	bool SwapChain::setSwapInterval(int swapInterval)
+	{
+		// There's no vertical blank to wait for, just remember the swap interval
+		mSwapInterval = swapInterval;
+		return true;
+	}
+
+	unsigned int SwapChain::getMaximumFrameLatency() const
+	{
+		return mFramePacer.getMaximumFrameLatency();
+	}
+
+	void SwapChain::setMaximumFrameLatency(unsigned int maximumFrameLatency)
+	{
+		mFramePacer.setMaximumFrameLatency(maximumFrameLatency);
+	}
+
+	const Renderer::PresentStatistics &SwapChain::getPresentStatistics() const
+	{
+		return mFramePacer.getPresentStatistics();
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -54,6 +54,15 @@ namespace NullRenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2D methods           ]
+	//[-------------------------------------------------------]
+	void Texture2D::updateRegion(unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, const void *)
+	{
+		// Nothing to do in here
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -54,6 +54,15 @@ namespace NullRenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2DArray methods      ]
+	//[-------------------------------------------------------]
+	void Texture2DArray::updateRegion(unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, const void *)
+	{
+		// Nothing to do in here
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -44,7 +44,7 @@ namespace NullRenderer
 	TextureCollection::TextureCollection(NullRenderer &nullRenderer, unsigned int numberOfTextures, Renderer::ITexture **textures) :
 		Renderer::ITextureCollection(nullRenderer),
 		mNumberOfTextures(numberOfTextures),
-		mTextures((numberOfTextures > 0) ? new Renderer::ITexture*[numberOfTextures] : nullptr)
+		mTextures(nullRenderer.getAllocator().allocateArray<Renderer::ITexture*>(numberOfTextures, Renderer::AllocationTag::RESOURCE))
 	{
 		// Loop through all given textures
 		Renderer::ITexture **currentTexture = mTextures;
@@ -87,7 +87,7 @@ namespace NullRenderer
 			}
 
 			// Release the allocated memory
-			delete [] mTextures;
+			getRenderer().getAllocator().deallocateArray(mTextures, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
@@ -53,7 +53,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    OpenGL ES 2 blend state class
 	*/
-	class BlendState : public Renderer::IBlendState
+	class BlendState final : public Renderer::IBlendState
 	{
 
 
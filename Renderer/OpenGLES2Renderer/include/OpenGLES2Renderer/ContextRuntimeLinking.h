@@ -81,10 +81,12 @@ namespace OpenGLES2Renderer
 		*  @brief
 		*    Constructor
 		*
+		*  @param[in] allocator
+		*    Allocator to use, must stay valid as long as the context instance exists
 		*  @param[in] nativeWindowHandle
 		*    Handle of a native OS window which is valid as long as the renderer instance exists, "NULL_HANDLE" if there's no such window
 		*/
-		explicit ContextRuntimeLinking(handle nativeWindowHandle);
+		ContextRuntimeLinking(Renderer::IAllocator &allocator, handle nativeWindowHandle);
 
 		/**
 		*  @brief
@@ -53,7 +53,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    OpenGL ES 2 depth stencil state class
 	*/
-	class DepthStencilState : public Renderer::IDepthStencilState
+	class DepthStencilState final : public Renderer::IDepthStencilState
 	{
 
 
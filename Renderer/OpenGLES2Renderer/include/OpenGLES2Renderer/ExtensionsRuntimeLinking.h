@@ -92,6 +92,8 @@ namespace OpenGLES2Renderer
 		inline virtual bool isGL_EXT_texture_filter_anisotropic() const override;
 		inline virtual bool isGL_EXT_texture_array() const override;
 		inline virtual bool isGL_EXT_Cg_shader() const override;
+		inline virtual bool isGL_EXT_instanced_arrays() const override;
+		inline virtual bool isGL_EXT_draw_instanced() const override;
 		// AMD
 		inline virtual bool isGL_AMD_compressed_3DC_texture() const override;
 		// NV
@@ -124,6 +126,8 @@ namespace OpenGLES2Renderer
 		bool mGL_EXT_texture_filter_anisotropic;
 		bool mGL_EXT_texture_array;
 		bool mGL_EXT_Cg_shader;
+		bool mGL_EXT_instanced_arrays;
+		bool mGL_EXT_draw_instanced;
 		// AMD
 		bool mGL_AMD_compressed_3DC_texture;
 		// NV
@@ -202,6 +206,17 @@ namespace OpenGLES2Renderer
 	#define GL_CG_VERTEX_SHADER_EXT		0x890E
 	#define GL_CG_FRAGMENT_SHADER_EXT	0x890F
 
+	// GL_EXT_instanced_arrays
+	#define GL_VERTEX_ATTRIB_ARRAY_DIVISOR_EXT	0x88FE
+	FNDEF_EX(void,	glVertexAttribDivisorEXT,	(GLuint index, GLuint divisor));
+	#define glVertexAttribDivisorEXT	FNPTR(glVertexAttribDivisorEXT)
+
+	// GL_EXT_draw_instanced (also part of GL_EXT_instanced_arrays)
+	FNDEF_EX(void,	glDrawArraysInstancedEXT,	(GLenum mode, GLint start, GLsizei count, GLsizei primcount));
+	FNDEF_EX(void,	glDrawElementsInstancedEXT,	(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount));
+	#define glDrawArraysInstancedEXT	FNPTR(glDrawArraysInstancedEXT)
+	#define glDrawElementsInstancedEXT	FNPTR(glDrawElementsInstancedEXT)
+
 
 	//[-------------------------------------------------------]
 	//[ AMD definitions                                       ]
@@ -314,6 +329,9 @@ namespace OpenGLES2Renderer
 	// GL_OES_depth32
 	#define GL_DEPTH_COMPONENT32_OES	0x81A7
 
+	// GL_OES_vertex_half_float
+	#define GL_HALF_FLOAT_OES	0x8D61
+
 	// GL_OES_vertex_array_object
 	FNDEF_EX(void,	glBindVertexArrayOES,		(GLuint array));
 	FNDEF_EX(void,	glDeleteVertexArraysOES,	(GLsizei n, const GLuint *arrays));
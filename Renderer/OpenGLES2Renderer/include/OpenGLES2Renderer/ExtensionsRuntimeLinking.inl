@@ -59,6 +59,16 @@ namespace OpenGLES2Renderer
 		return mGL_EXT_Cg_shader;
 	}
 
+	inline bool ExtensionsRuntimeLinking::isGL_EXT_instanced_arrays() const
+	{
+		return mGL_EXT_instanced_arrays;
+	}
+
+	inline bool ExtensionsRuntimeLinking::isGL_EXT_draw_instanced() const
+	{
+		return mGL_EXT_draw_instanced;
+	}
+
 	// AMD
 	inline bool ExtensionsRuntimeLinking::isGL_AMD_compressed_3DC_texture() const
 	{
@@ -46,7 +46,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    Cg fragment shader ("pixel shader" in Direct3D terminology) class
 	*/
-	class FragmentShaderCg : public FragmentShader
+	class FragmentShaderCg final : public FragmentShader
 	{
 
 
@@ -46,7 +46,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    GLSL fragment shader ("pixel shader" in Direct3D terminology) class
 	*/
-	class FragmentShaderGlsl : public FragmentShader
+	class FragmentShaderGlsl final : public FragmentShader
 	{
 
 
@@ -59,7 +59,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    OpenGL ES 2 framebuffer class
 	*/
-	class Framebuffer : public Renderer::IFramebuffer
+	class Framebuffer final : public Renderer::IFramebuffer
 	{
 
 
@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <Renderer/AllocatorObject.h>
 #include <Renderer/PlatformTypes.h>
 
 #include <GLES2/gl2.h>
@@ -68,7 +69,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    Abstract OpenGL ES context base interface
 	*/
-	class IContext
+	class IContext : public Renderer::AllocatorObject<Renderer::AllocationTag::RENDERER>
 	{
 
 
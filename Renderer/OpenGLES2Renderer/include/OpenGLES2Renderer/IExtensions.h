@@ -26,6 +26,12 @@
 #define __OPENGLES2RENDERER_EXTENSIONS_H__
 
 
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/AllocatorObject.h>
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -43,7 +49,7 @@ namespace OpenGLES2Renderer
 	*  @note
 	*    - Extensions are only optional, so do always take into account that an extension may not be available
 	*/
-	class IExtensions
+	class IExtensions : public Renderer::AllocatorObject<Renderer::AllocationTag::RENDERER>
 	{
 
 
@@ -72,6 +78,8 @@ namespace OpenGLES2Renderer
 		virtual bool isGL_EXT_texture_filter_anisotropic() const = 0;
 		virtual bool isGL_EXT_texture_array() const = 0;
 		virtual bool isGL_EXT_Cg_shader() const = 0;
+		virtual bool isGL_EXT_instanced_arrays() const = 0;
+		virtual bool isGL_EXT_draw_instanced() const = 0;
 		// AMD
 		virtual bool isGL_AMD_compressed_3DC_texture() const = 0;
 		// NV
@@ -54,7 +54,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    OpenGL ES 2 index buffer object (IBO, "element array buffer" in OpenGL terminology) class
 	*/
-	class IndexBuffer : public Renderer::IIndexBuffer
+	class IndexBuffer final : public Renderer::IIndexBuffer
 	{
 
 
@@ -103,6 +103,15 @@ namespace OpenGLES2Renderer
 		*/
 		inline unsigned int getOpenGLES2Type() const;
 
+		/**
+		*  @brief
+		*    Return the number of bytes per index
+		*
+		*  @return
+		*    The number of bytes per index, used to compute the byte offset of the start index location
+		*/
+		inline unsigned int getIndexSize() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -110,6 +119,7 @@ namespace OpenGLES2Renderer
 	private:
 		unsigned int mOpenGLES2ElementArrayBuffer;	/**< OpenGL ES 2 element array buffer, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim) */
 		unsigned int mOpenGLES2Type;				/**< OpenGL ES 2 element array buffer data type (type "GLenum" not used in here in order to keep the header slim) */
+		unsigned int mIndexSize;					/**< Number of bytes per index */
 
 
 	};
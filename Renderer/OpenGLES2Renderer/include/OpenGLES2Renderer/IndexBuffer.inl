@@ -46,6 +46,15 @@ namespace OpenGLES2Renderer
 		return mOpenGLES2Type;
 	}
 
+	/**
+	*  @brief
+	*    Return the number of bytes per index
+	*/
+	inline unsigned int IndexBuffer::getIndexSize() const
+	{
+		return mIndexSize;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -185,6 +185,18 @@ namespace OpenGLES2Renderer
 		*/
 		static unsigned int getOpenGLES2Type(Renderer::IndexBufferFormat::Enum indexBufferFormat);
 
+		/**
+		*  @brief
+		*    "Renderer::IndexBufferFormat" to number of bytes per element
+		*
+		*  @param[in] indexBufferFormat
+		*    "Renderer::IndexBufferFormat" to map
+		*
+		*  @return
+		*    Number of bytes per element
+		*/
+		static unsigned int getOpenGLES2Size(Renderer::IndexBufferFormat::Enum indexBufferFormat);
+
 		//[-------------------------------------------------------]
 		//[ Renderer::TextureFormat                               ]
 		//[-------------------------------------------------------]
@@ -224,6 +236,18 @@ namespace OpenGLES2Renderer
 		*/
 		static unsigned int getOpenGLES2Type(Renderer::TextureFormat::Enum textureFormat);
 
+		/**
+		*  @brief
+		*    "Renderer::TextureFormat" to number of bytes per texel when using the OpenGL ES 2 format and type
+		*
+		*  @param[in] textureFormat
+		*    "Renderer::TextureFormat" to map
+		*
+		*  @return
+		*    Number of bytes per texel
+		*/
+		static unsigned int getOpenGLES2Size(Renderer::TextureFormat::Enum textureFormat);
+
 		//[-------------------------------------------------------]
 		//[ Renderer::PrimitiveTopology                           ]
 		//[-------------------------------------------------------]
@@ -53,7 +53,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    Cg program class
 	*/
-	class ProgramCg : public Program
+	class ProgramCg final : public Program
 	{
 
 
@@ -53,7 +53,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    GLSL program class
 	*/
-	class ProgramGlsl : public Program
+	class ProgramGlsl final : public Program
 	{
 
 
@@ -53,7 +53,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    OpenGL ES 2 rasterizer state class
 	*/
-	class RasterizerState : public Renderer::IRasterizerState
+	class RasterizerState final : public Renderer::IRasterizerState
 	{
 
 
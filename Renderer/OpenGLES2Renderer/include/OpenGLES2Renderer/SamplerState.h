@@ -52,7 +52,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    OpenGL ES 2 sampler state class
 	*/
-	class SamplerState : public Renderer::ISamplerState
+	class SamplerState final : public Renderer::ISamplerState
 	{
 
 
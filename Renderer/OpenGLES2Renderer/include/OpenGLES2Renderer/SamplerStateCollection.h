@@ -59,7 +59,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    OpenGL ES 2 sampler state collection class
 	*/
-	class SamplerStateCollection : public Renderer::ISamplerStateCollection
+	class SamplerStateCollection final : public Renderer::ISamplerStateCollection
 	{
 
 
@@ -64,6 +64,8 @@ namespace OpenGLES2Renderer
 		*  @brief
 		*    Creates, loads and compiles a shader
 		*
+		*  @param[in] allocator
+		*    Allocator to use for temporary data
 		*  @param[in] shaderType
 		*    Shader type (for example "GL_VERTEX_SHADER", type "GLenum" not used in here in order to keep the header slim)
 		*  @param[in] shaderSource
@@ -72,7 +74,7 @@ namespace OpenGLES2Renderer
 		*  @return
 		*    The OpenGL ES 2 shader, 0 on error, destroy the returned resource if you no longer need it (type "GLuint" not used in here in order to keep the header slim)
 		*/
-		static unsigned int loadShader(unsigned int shaderType, const char *shaderSource);
+		static unsigned int loadShader(Renderer::IAllocator &allocator, unsigned int shaderType, const char *shaderSource);
 
 
 	//[-------------------------------------------------------]
@@ -30,6 +30,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <Renderer/ITexture2D.h>
+#include <Renderer/TextureTypes.h>
 
 
 //[-------------------------------------------------------]
@@ -52,7 +53,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    OpenGL ES 2 2D texture class
 	*/
-	class Texture2D : public Renderer::ITexture2D
+	class Texture2D final : public Renderer::ITexture2D
 	{
 
 
@@ -95,11 +96,19 @@ namespace OpenGLES2Renderer
 		inline unsigned int getOpenGLES2Texture() const;
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2D methods           ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void updateRegion(unsigned int mipmap, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data) override;
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		unsigned int mOpenGLES2Texture;	/**< OpenGL ES 2 texture, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim) */
+		unsigned int				  mOpenGLES2Texture;	/**< OpenGL ES 2 texture, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim) */
+		Renderer::TextureFormat::Enum mTextureFormat;		/**< Texture format */
 
 
 	};
@@ -59,7 +59,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    OpenGL ES 2 texture collection class
 	*/
-	class TextureCollection : public Renderer::ITextureCollection
+	class TextureCollection final : public Renderer::ITextureCollection
 	{
 
 
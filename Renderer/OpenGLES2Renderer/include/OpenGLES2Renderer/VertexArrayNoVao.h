@@ -59,7 +59,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    OpenGL ES 2 vertex array class, traditional version
 	*/
-	class VertexArrayNoVao : public VertexArray
+	class VertexArrayNoVao final : public VertexArray
 	{
 
 
@@ -108,6 +108,7 @@ namespace OpenGLES2Renderer
 		unsigned int					mNumberOfAttributes;	/**< Number of attributes (position, color, texture coordinate, normal...), having zero attributes is valid */
 		Renderer::VertexArrayAttribute *mAttributes;			/**< At least "mNumberOfAttributes" instances of vertex array attributes, can be a null pointer in case there are zero attributes */
 		int							   *mAttributeLocations;	/**< Attribute locations, can be a null pointer in case there are zero attributes */
+		bool							mIsGL_EXT_instanced_arrays;	/**< Is the "GL_EXT_instanced_arrays"-extension supported? */
 
 
 	};
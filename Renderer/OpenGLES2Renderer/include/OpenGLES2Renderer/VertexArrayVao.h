@@ -60,7 +60,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    OpenGL ES 2 vertex array class, effective vertex array object (VAO)
 	*/
-	class VertexArrayVao : public VertexArray
+	class VertexArrayVao final : public VertexArray
 	{
 
 
@@ -46,7 +46,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    Cg vertex shader class
 	*/
-	class VertexShaderCg : public VertexShader
+	class VertexShaderCg final : public VertexShader
 	{
 
 
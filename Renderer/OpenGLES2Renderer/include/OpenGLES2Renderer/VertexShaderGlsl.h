@@ -46,7 +46,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    GLSL vertex shader class
 	*/
-	class VertexShaderGlsl : public VertexShader
+	class VertexShaderGlsl final : public VertexShader
 	{
 
 
@@ -45,12 +45,12 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    Constructor
 	*/
-	ContextRuntimeLinking::ContextRuntimeLinking(handle nativeWindowHandle) :
+	ContextRuntimeLinking::ContextRuntimeLinking(Renderer::IAllocator &allocator, handle nativeWindowHandle) :
 		IContext(nativeWindowHandle),
 		mEGLSharedLibrary(nullptr),
 		mGLESSharedLibrary(nullptr),
 		mEntryPointsRegistered(false),
-		mExtensions(new ExtensionsRuntimeLinking())
+		mExtensions(new (allocator) ExtensionsRuntimeLinking())
 	{
 		// Load the shared libraries
 		if (loadSharedLibraries())
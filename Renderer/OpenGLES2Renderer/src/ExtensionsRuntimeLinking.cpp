@@ -51,6 +51,8 @@ namespace OpenGLES2Renderer
 		mGL_EXT_texture_filter_anisotropic(false),
 		mGL_EXT_texture_array(false),
 		mGL_EXT_Cg_shader(false),
+		mGL_EXT_instanced_arrays(false),
+		mGL_EXT_draw_instanced(false),
 		// AMD
 		mGL_AMD_compressed_3DC_texture(false),
 		// NV
@@ -135,6 +137,25 @@ namespace OpenGLES2Renderer
 			mGL_EXT_texture_array = result;
 		}
 		mGL_EXT_Cg_shader = (nullptr != strstr(extensions, "GL_EXT_Cg_shader"));
+		mGL_EXT_instanced_arrays = (nullptr != strstr(extensions, "GL_EXT_instanced_arrays"));
+		if (mGL_EXT_instanced_arrays)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glDrawArraysInstancedEXT)
+			IMPORT_FUNC(glDrawElementsInstancedEXT)
+			IMPORT_FUNC(glVertexAttribDivisorEXT)
+			mGL_EXT_instanced_arrays = result;
+		}
+		mGL_EXT_draw_instanced = (nullptr != strstr(extensions, "GL_EXT_draw_instanced"));
+		if (mGL_EXT_draw_instanced)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glDrawArraysInstancedEXT)
+			IMPORT_FUNC(glDrawElementsInstancedEXT)
+			mGL_EXT_draw_instanced = result;
+		}
 
 		//[-------------------------------------------------------]
 		//[ AMD                                                   ]
@@ -43,7 +43,7 @@ namespace OpenGLES2Renderer
 	*/
 	FragmentShaderCg::FragmentShaderCg(OpenGLES2Renderer &openGLES2Renderer, const char *sourceCode) :
 		FragmentShader(openGLES2Renderer),
-		mOpenGLES2Shader(ShaderLanguage::loadShader(GL_CG_FRAGMENT_SHADER_EXT, sourceCode))
+		mOpenGLES2Shader(ShaderLanguage::loadShader(openGLES2Renderer.getAllocator(), GL_CG_FRAGMENT_SHADER_EXT, sourceCode))
 	{
 		// Nothing to do in here
 	}
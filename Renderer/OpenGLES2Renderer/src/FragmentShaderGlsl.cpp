@@ -43,7 +43,7 @@ namespace OpenGLES2Renderer
 	*/
 	FragmentShaderGlsl::FragmentShaderGlsl(OpenGLES2Renderer &openGLES2Renderer, const char *sourceCode) :
 		FragmentShader(openGLES2Renderer),
-		mOpenGLES2Shader(ShaderLanguage::loadShader(GL_FRAGMENT_SHADER, sourceCode))
+		mOpenGLES2Shader(ShaderLanguage::loadShader(openGLES2Renderer.getAllocator(), GL_FRAGMENT_SHADER, sourceCode))
 	{
 		// Nothing to do in here
 	}
@@ -68,7 +68,7 @@ namespace OpenGLES2Renderer
 		// Are there any color textures? (usually there are, so we just keep the "glBindFramebuffer()" above without trying to make this method implementation more complex)
 		if (mNumberOfColorTextures > 0)
 		{
-			mColorTextures = new Renderer::ITexture*[mNumberOfColorTextures];
+			mColorTextures = getRenderer().getAllocator().allocateArray<Renderer::ITexture*>(mNumberOfColorTextures, Renderer::AllocationTag::RESOURCE);
 
 			// Loop through all framebuffer color attachments
 			// -> "GL_COLOR_ATTACHMENT0" and "GL_COLOR_ATTACHMENT0_NV" have the same value
@@ -122,6 +122,7 @@ namespace OpenGLES2Renderer
 						case Renderer::ResourceType::INDEX_BUFFER:
 						case Renderer::ResourceType::VERTEX_BUFFER:
 						case Renderer::ResourceType::UNIFORM_BUFFER:
+						case Renderer::ResourceType::INDIRECT_BUFFER:
 						case Renderer::ResourceType::TEXTURE_BUFFER:
 						case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 						case Renderer::ResourceType::RASTERIZER_STATE:
@@ -133,8 +134,10 @@ namespace OpenGLES2Renderer
 						case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 						case Renderer::ResourceType::GEOMETRY_SHADER:
 						case Renderer::ResourceType::FRAGMENT_SHADER:
+						case Renderer::ResourceType::COMPUTE_SHADER:
 						case Renderer::ResourceType::TEXTURE_COLLECTION:
 						case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+						case Renderer::ResourceType::FENCE:
 						default:
 							RENDERER_OUTPUT_DEBUG_PRINTF("OpenGL ES 2 error: The type of the given color texture at index %d is not supported", colorTexture - colorTextures)
 							break;
@@ -241,7 +244,7 @@ namespace OpenGLES2Renderer
 			}
 
 			// Cleanup
-			delete [] mColorTextures;
+			getRenderer().getAllocator().deallocateArray(mColorTextures, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Release the reference to the used depth stencil texture
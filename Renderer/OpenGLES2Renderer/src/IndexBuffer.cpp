@@ -44,8 +44,12 @@ namespace OpenGLES2Renderer
 	IndexBuffer::IndexBuffer(OpenGLES2Renderer &openGLES2Renderer, unsigned int numberOfBytes, Renderer::IndexBufferFormat::Enum indexBufferFormat, const void *data, Renderer::BufferUsage::Enum bufferUsage) :
 		IIndexBuffer(openGLES2Renderer),
 		mOpenGLES2ElementArrayBuffer(0),
-		mOpenGLES2Type(GL_UNSIGNED_SHORT)
+		mOpenGLES2Type(GL_UNSIGNED_SHORT),
+		mIndexSize(2)
 	{
+		// Set the estimated number of bytes of the index buffer
+		setNumberOfBytes(numberOfBytes);
+
 		// "GL_UNSIGNED_INT" is only allowed when the "GL_OES_element_index_uint" extension is there
 		if (Renderer::IndexBufferFormat::UNSIGNED_INT != indexBufferFormat || openGLES2Renderer.getContext().getExtensions().isGL_OES_element_index_uint())
 		{
@@ -54,6 +58,7 @@ namespace OpenGLES2Renderer
 
 			// Set the OpenGL ES 2 index buffer data type
 			mOpenGLES2Type = Mapping::getOpenGLES2Type(indexBufferFormat);
+			mIndexSize = Mapping::getOpenGLES2Size(indexBufferFormat);
 
 			#ifndef OPENGLES2RENDERER_NO_STATE_CLEANUP
 				// Backup the currently bound OpenGL ES 2 element array buffer
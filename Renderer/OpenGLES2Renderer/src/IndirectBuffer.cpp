@@ -0,0 +1,92 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "OpenGLES2Renderer/IndirectBuffer.h"
+#include "OpenGLES2Renderer/OpenGLES2Renderer.h"
+
+#include <string.h>	// For "memcpy()" and "memset()"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace OpenGLES2Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	IndirectBuffer::IndirectBuffer(OpenGLES2Renderer &openGLES2Renderer, unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum) :
+		IIndirectBuffer(reinterpret_cast<Renderer::IRenderer&>(openGLES2Renderer)),
+		mEmulationData(openGLES2Renderer.getAllocator().allocateArray<unsigned char>(numberOfBytes, Renderer::AllocationTag::RESOURCE)),
+		mNumberOfBytes(numberOfBytes)
+	{
+		// Set the estimated number of bytes of the indirect buffer, which is emulated in system memory
+		setNumberOfBytes(numberOfBytes);
+
+		// Copy the data into the system memory
+		if (nullptr != data)
+		{
+			memcpy(mEmulationData, data, numberOfBytes);
+		}
+		else
+		{
+			// Empty buffer: No draws
+			memset(mEmulationData, 0, numberOfBytes);
+		}
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	IndirectBuffer::~IndirectBuffer()
+	{
+		// Destroy the system memory emulation data
+		getRenderer().getAllocator().deallocateArray(mEmulationData, Renderer::AllocationTag::RESOURCE);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IIndirectBuffer methods      ]
+	//[-------------------------------------------------------]
+	void IndirectBuffer::copyDataFrom(unsigned int numberOfBytes, const void *data)
+	{
+		// Ignore a null pointer, see "Renderer::IIndirectBuffer::copyDataFrom()"
+		if (nullptr != data)
+		{
+			// Copy the data into the system memory, but do not write behind the end of the emulation data
+			memcpy(mEmulationData, data, (numberOfBytes < mNumberOfBytes) ? numberOfBytes : mNumberOfBytes);
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // OpenGLES2Renderer
@@ -22,6 +22,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "OpenGLES2Renderer/Mapping.h"
+#include "OpenGLES2Renderer/IExtensions.h"	// For "GL_HALF_FLOAT_OES"
 
 #include <GLES2/gl2.h>
 
@@ -228,7 +229,9 @@ namespace OpenGLES2Renderer
 			1,	// Renderer::VertexArrayFormat::FLOAT_1
 			2,	// Renderer::VertexArrayFormat::FLOAT_2
 			3,	// Renderer::VertexArrayFormat::FLOAT_3
-			4	// Renderer::VertexArrayFormat::FLOAT_4
+			4,	// Renderer::VertexArrayFormat::FLOAT_4
+			2,	// Renderer::VertexArrayFormat::HALF_2
+			4	// Renderer::VertexArrayFormat::HALF_4
 		};
 		return MAPPING[vertexArrayFormat];
 	}
@@ -241,10 +244,12 @@ namespace OpenGLES2Renderer
 	{
 		static const GLenum MAPPING[] =
 		{
-			GL_FLOAT,	// Renderer::VertexArrayFormat::FLOAT_1
-			GL_FLOAT,	// Renderer::VertexArrayFormat::FLOAT_2
-			GL_FLOAT,	// Renderer::VertexArrayFormat::FLOAT_3
-			GL_FLOAT	// Renderer::VertexArrayFormat::FLOAT_4
+			GL_FLOAT,			// Renderer::VertexArrayFormat::FLOAT_1
+			GL_FLOAT,			// Renderer::VertexArrayFormat::FLOAT_2
+			GL_FLOAT,			// Renderer::VertexArrayFormat::FLOAT_3
+			GL_FLOAT,			// Renderer::VertexArrayFormat::FLOAT_4
+			GL_HALF_FLOAT_OES,	// Renderer::VertexArrayFormat::HALF_2 - "GL_OES_vertex_half_float" required
+			GL_HALF_FLOAT_OES	// Renderer::VertexArrayFormat::HALF_4 - "GL_OES_vertex_half_float" required
 		};
 		return MAPPING[vertexArrayFormat];
 	}
@@ -294,6 +299,21 @@ namespace OpenGLES2Renderer
 		return MAPPING[indexBufferFormat];
 	}
 
+	/**
+	*  @brief
+	*    "Renderer::IndexBufferFormat" to number of bytes per element
+	*/
+	unsigned int Mapping::getOpenGLES2Size(Renderer::IndexBufferFormat::Enum indexBufferFormat)
+	{
+		static const GLuint MAPPING[] =
+		{
+			1,	// Renderer::IndexBufferFormat::UNSIGNED_CHAR  - One byte per element, unsigned char (may not be supported by each API)
+			2,	// Renderer::IndexBufferFormat::UNSIGNED_SHORT - Two bytes per element, unsigned short
+			4	// Renderer::IndexBufferFormat::UNSIGNED_INT   - Four bytes per element, unsigned int (may not be supported by each API)
+		};
+		return MAPPING[indexBufferFormat];
+	}
+
 	/**
 	*  @brief
 	*    "Renderer::TextureFormat" to OpenGL ES 2 internal format
@@ -345,6 +365,23 @@ namespace OpenGLES2Renderer
 		return MAPPING[textureFormat];
 	}
 
+	/**
+	*  @brief
+	*    "Renderer::TextureFormat" to number of bytes per texel when using the OpenGL ES 2 format and type
+	*/
+	unsigned int Mapping::getOpenGLES2Size(Renderer::TextureFormat::Enum textureFormat)
+	{
+		static const GLuint MAPPING[] =
+		{
+			1,	// Renderer::TextureFormat::A8            - 8-bit pixel format, all bits alpha
+			3,	// Renderer::TextureFormat::R8G8B8        - 24-bit pixel format, 8 bits for red, green and blue
+			4,	// Renderer::TextureFormat::R8G8B8A8      - 32-bit pixel format, 8 bits for red, green, blue and alpha
+			16,	// Renderer::TextureFormat::R16G16B16A16F - 64-bit float format using 16 bits for the each channel (red, green, blue, alpha) - Not supported by OpenGL ES 2, "GL_FLOAT" is used
+			16	// Renderer::TextureFormat::R32G32B32A32F - 128-bit float format using 32 bits for the each channel (red, green, blue, alpha) - Not supported by OpenGL ES 2
+		};
+		return MAPPING[textureFormat];
+	}
+
 	/**
 	*  @brief
 	*    "Renderer::PrimitiveTopology" to OpenGL ES 2 type
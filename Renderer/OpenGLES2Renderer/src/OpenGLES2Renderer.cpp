@@ -29,6 +29,7 @@
 #include "OpenGLES2Renderer/BlendState.h"
 #include "OpenGLES2Renderer/IExtensions.h"
 #include "OpenGLES2Renderer/IndexBuffer.h"
+#include "OpenGLES2Renderer/IndirectBuffer.h"
 #include "OpenGLES2Renderer/SamplerState.h"
 #include "OpenGLES2Renderer/VertexBuffer.h"
 #include "OpenGLES2Renderer/VertexArrayVao.h"
@@ -56,9 +57,9 @@
 #else
 	#define OPENGLES2RENDERER_API_EXPORT
 #endif
-OPENGLES2RENDERER_API_EXPORT Renderer::IRenderer *createOpenGLES2RendererInstance(handle nativeWindowHandle)
+OPENGLES2RENDERER_API_EXPORT Renderer::IRenderer *createOpenGLES2RendererInstance(handle nativeWindowHandle, Renderer::IAllocator *allocator)
 {
-	return new OpenGLES2Renderer::OpenGLES2Renderer(nativeWindowHandle);
+	return new ((nullptr != allocator) ? *allocator : Renderer::DefaultAllocator::getInstance()) OpenGLES2Renderer::OpenGLES2Renderer(nativeWindowHandle, allocator);
 }
 #undef OPENGLES2RENDERER_API_EXPORT
 
@@ -77,8 +78,9 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    Constructor
 	*/
-	OpenGLES2Renderer::OpenGLES2Renderer(handle nativeWindowHandle) :
-		mContext(new ContextRuntimeLinking(nativeWindowHandle)),
+	OpenGLES2Renderer::OpenGLES2Renderer(handle nativeWindowHandle, Renderer::IAllocator *allocator) :
+		IRenderer(allocator),
+		mContext(new (getAllocator()) ContextRuntimeLinking(getAllocator(), nativeWindowHandle)),
 		mShaderLanguageGlsl(nullptr),
 		#ifndef OPENGLES2RENDERER_NO_CG
 			mShaderLanguageCg(nullptr),
@@ -94,7 +96,18 @@ namespace OpenGLES2Renderer
 		mDepthStencilState(nullptr),
 		mDefaultBlendState(nullptr),
 		mBlendState(nullptr),
-		mOpenGLES2Program(0)
+		mOpenGLES2Program(0),
+		mVertexBufferPool(getAllocator(), sizeof(VertexBuffer)),
+		mIndexBufferPool(getAllocator(), sizeof(IndexBuffer)),
+		mIndirectBufferPool(getAllocator(), sizeof(IndirectBuffer)),
+		mTexture2DPool(getAllocator(), sizeof(Texture2D)),
+		mTexture2DArrayPool(getAllocator(), sizeof(Texture2DArray)),
+		mRasterizerStatePool(getAllocator(), sizeof(RasterizerState)),
+		mDepthStencilStatePool(getAllocator(), sizeof(DepthStencilState)),
+		mBlendStatePool(getAllocator(), sizeof(BlendState)),
+		mSamplerStatePool(getAllocator(), sizeof(SamplerState)),
+		mTextureCollectionPool(getAllocator(), sizeof(TextureCollection)),
+		mSamplerStateCollectionPool(getAllocator(), sizeof(SamplerStateCollection))
 	{
 		// Initialize the context
 		if (mContext->initialize(0))
@@ -308,7 +321,7 @@ namespace OpenGLES2Renderer
 				// If required, create the GLSL shader language instance right now
 				if (nullptr == mShaderLanguageGlsl)
 				{
-					mShaderLanguageGlsl = new ShaderLanguageGlsl(*this);
+					mShaderLanguageGlsl = new (getAllocator()) ShaderLanguageGlsl(*this);
 					mShaderLanguageGlsl->addReference();	// Internal renderer reference
 				}
 
@@ -322,7 +335,7 @@ namespace OpenGLES2Renderer
 					// -> "GL_EXT_Cg_shader" required for Cg support
 					if (nullptr == mShaderLanguageCg && mContext->getExtensions().isGL_EXT_Cg_shader())
 					{
-						mShaderLanguageCg = new ShaderLanguageCg(*this);
+						mShaderLanguageCg = new (getAllocator()) ShaderLanguageCg(*this);
 						mShaderLanguageCg->addReference();	// Internal renderer reference
 					}
 
@@ -346,23 +359,23 @@ namespace OpenGLES2Renderer
 	Renderer::ISwapChain *OpenGLES2Renderer::createSwapChain(handle nativeWindowHandle)
 	{
 		// The provided native window handle must not be a null handle
-		return (NULL_HANDLE != nativeWindowHandle) ? new SwapChain(*this, nativeWindowHandle) : nullptr;
+		return (NULL_HANDLE != nativeWindowHandle) ? new (getAllocator()) SwapChain(*this, nativeWindowHandle) : nullptr;
 	}
 
 	Renderer::IFramebuffer *OpenGLES2Renderer::createFramebuffer(unsigned int numberOfColorTextures, Renderer::ITexture **colorTextures, Renderer::ITexture *depthStencilTexture)
 	{
 		// Validation is done inside the framebuffer implementation
-		return new Framebuffer(*this, numberOfColorTextures, colorTextures, depthStencilTexture);
+		return new (getAllocator()) Framebuffer(*this, numberOfColorTextures, colorTextures, depthStencilTexture);
 	}
 
 	Renderer::IVertexBuffer *OpenGLES2Renderer::createVertexBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
-		return new VertexBuffer(*this, numberOfBytes, data, bufferUsage);
+		return new (mVertexBufferPool) VertexBuffer(*this, numberOfBytes, data, bufferUsage);
 	}
 
 	Renderer::IIndexBuffer *OpenGLES2Renderer::createIndexBuffer(unsigned int numberOfBytes, Renderer::IndexBufferFormat::Enum indexBufferFormat, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
-		return new IndexBuffer(*this, numberOfBytes, indexBufferFormat, data, bufferUsage);
+		return new (mIndexBufferPool) IndexBuffer(*this, numberOfBytes, indexBufferFormat, data, bufferUsage);
 	}
 
 	Renderer::ITextureBuffer *OpenGLES2Renderer::createTextureBuffer(unsigned int, Renderer::TextureFormat::Enum, const void *, Renderer::BufferUsage::Enum)
@@ -371,14 +384,20 @@ namespace OpenGLES2Renderer
 		return nullptr;
 	}
 
-	Renderer::ITexture2D *OpenGLES2Renderer::createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum)
+	Renderer::IIndirectBuffer *OpenGLES2Renderer::createIndirectBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
+	{
+		// OpenGL ES 2 has no indirect draw support, the indirect buffer is emulated within system memory
+		return new (mIndirectBufferPool) IndirectBuffer(*this, numberOfBytes, data, bufferUsage);
+	}
+
+	Renderer::ITexture2D *OpenGLES2Renderer::createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum, unsigned int numberOfMultisamples)
 	{
 		// The indication of the texture usage is only relevant for Direct3D, OpenGL ES 2 has no texture usage indication
 
-		// Check whether or not the given texture dimension is valid
-		if (width > 0 && height > 0)
+		// Check whether or not the given texture dimension is valid, OpenGL ES 2 has no multisample texture support
+		if (width > 0 && height > 0 && numberOfMultisamples <= 1)
 		{
-			return new Texture2D(*this, width, height, textureFormat, data, flags);
+			return new (mTexture2DPool) Texture2D(*this, width, height, textureFormat, data, flags);
 		}
 		else
 		{
@@ -393,7 +412,7 @@ namespace OpenGLES2Renderer
 		// Check whether or not the given texture dimension is valid, "GL_EXT_texture_array" extension required
 		if (width > 0 && height > 0 && numberOfSlices > 0 && mContext->getExtensions().isGL_EXT_texture_array())
 		{
-			return new Texture2DArray(*this, width, height, numberOfSlices, textureFormat, data, flags);
+			return new (mTexture2DArrayPool) Texture2DArray(*this, width, height, numberOfSlices, textureFormat, data, flags);
 		}
 		else
 		{
@@ -403,32 +422,32 @@ namespace OpenGLES2Renderer
 
 	Renderer::IRasterizerState *OpenGLES2Renderer::createRasterizerState(const Renderer::RasterizerState &rasterizerState)
 	{
-		return new RasterizerState(*this, rasterizerState);
+		return new (mRasterizerStatePool) RasterizerState(*this, rasterizerState);
 	}
 
 	Renderer::IDepthStencilState *OpenGLES2Renderer::createDepthStencilState(const Renderer::DepthStencilState &depthStencilState)
 	{
-		return new DepthStencilState(*this, depthStencilState);
+		return new (mDepthStencilStatePool) DepthStencilState(*this, depthStencilState);
 	}
 
 	Renderer::IBlendState *OpenGLES2Renderer::createBlendState(const Renderer::BlendState &blendState)
 	{
-		return new BlendState(*this, blendState);
+		return new (mBlendStatePool) BlendState(*this, blendState);
 	}
 
 	Renderer::ISamplerState *OpenGLES2Renderer::createSamplerState(const Renderer::SamplerState &samplerState)
 	{
-		return new SamplerState(*this, samplerState);
+		return new (mSamplerStatePool) SamplerState(*this, samplerState);
 	}
 
 	Renderer::ITextureCollection *OpenGLES2Renderer::createTextureCollection(unsigned int numberOfTextures, Renderer::ITexture **textures)
 	{
-		return new TextureCollection(*this, numberOfTextures, textures);
+		return new (mTextureCollectionPool) TextureCollection(*this, numberOfTextures, textures);
 	}
 
 	Renderer::ISamplerStateCollection *OpenGLES2Renderer::createSamplerStateCollection(unsigned int numberOfSamplerStates, Renderer::ISamplerState **samplerStates)
 	{
-		return new SamplerStateCollection(*this, numberOfSamplerStates, samplerStates);
+		return new (mSamplerStateCollectionPool) SamplerStateCollection(*this, numberOfSamplerStates, samplerStates);
 	}
 
 
@@ -446,6 +465,17 @@ namespace OpenGLES2Renderer
 		// TODO(co) Implement me
 	}
 
+	bool OpenGLES2Renderer::copyResource(Renderer::IResource &, Renderer::IResource &)
+	{
+		// OpenGL ES 2 has no copy buffer and no pixel buffer object support
+		return false;
+	}
+
+	void OpenGLES2Renderer::setTextureResident(Renderer::ITexture &, Renderer::ISamplerState *, bool)
+	{
+		// OpenGL ES 2 has no bindless texture support
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ States                                                ]
@@ -776,6 +806,38 @@ namespace OpenGLES2Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Stream-output (SO) stage                              ]
+	//[-------------------------------------------------------]
+	void OpenGLES2Renderer::soSetTargets(unsigned int numberOfTargets, Renderer::IVertexBuffer **vertexBuffers, const unsigned int *)
+	{
+		// OpenGL ES 2 has no stream output support
+
+		// Are the given vertex buffers valid?
+		if (nullptr != vertexBuffers)
+		{
+			for (unsigned int i = 0; i < numberOfTargets; ++i)
+			{
+				if (nullptr != vertexBuffers[i])
+				{
+					// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+					OPENGLES2RENDERER_RENDERERMATCHCHECK_RETURN(*this, *vertexBuffers[i])
+				}
+			}
+		}
+	}
+
+	void OpenGLES2Renderer::soBegin(Renderer::PrimitiveTopology::Enum, bool)
+	{
+		// OpenGL ES 2 has no stream output support
+	}
+
+	void OpenGLES2Renderer::soEnd()
+	{
+		// OpenGL ES 2 has no stream output support
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Rasterizer (RS) stage                                 ]
 	//[-------------------------------------------------------]
@@ -925,6 +987,7 @@ namespace OpenGLES2Renderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::TEXTURE_BUFFER:
 				case Renderer::ResourceType::RASTERIZER_STATE:
 				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
@@ -935,8 +998,10 @@ namespace OpenGLES2Renderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Not handled in here
 					break;
@@ -1019,6 +1084,7 @@ namespace OpenGLES2Renderer
 						case Renderer::ResourceType::INDEX_BUFFER:
 						case Renderer::ResourceType::VERTEX_BUFFER:
 						case Renderer::ResourceType::UNIFORM_BUFFER:
+						case Renderer::ResourceType::INDIRECT_BUFFER:
 						case Renderer::ResourceType::TEXTURE_BUFFER:
 						case Renderer::ResourceType::RASTERIZER_STATE:
 						case Renderer::ResourceType::DEPTH_STENCIL_STATE:
@@ -1029,8 +1095,10 @@ namespace OpenGLES2Renderer
 						case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 						case Renderer::ResourceType::GEOMETRY_SHADER:
 						case Renderer::ResourceType::FRAGMENT_SHADER:
+						case Renderer::ResourceType::COMPUTE_SHADER:
 						case Renderer::ResourceType::TEXTURE_COLLECTION:
 						case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+						case Renderer::ResourceType::FENCE:
 						default:
 							// Not handled in here
 							break;
@@ -1233,6 +1301,7 @@ namespace OpenGLES2Renderer
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::UNIFORM_BUFFER:
+					case Renderer::ResourceType::INDIRECT_BUFFER:
 					case Renderer::ResourceType::TEXTURE_BUFFER:
 					case Renderer::ResourceType::TEXTURE_2D:
 					case Renderer::ResourceType::TEXTURE_2D_ARRAY:
@@ -1245,8 +1314,10 @@ namespace OpenGLES2Renderer
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 					case Renderer::ResourceType::TEXTURE_COLLECTION:
 					case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+					case Renderer::ResourceType::FENCE:
 					default:
 						// Not handled in here
 						break;
@@ -1370,6 +1441,82 @@ namespace OpenGLES2Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Compute-shader (CS) stage                             ]
+	//[-------------------------------------------------------]
+	void OpenGLES2Renderer::csSetTexture(unsigned int, Renderer::ITexture *texture)
+	{
+		// OpenGL ES 2 has no compute shader support
+
+		// Is the given texture valid?
+		if (nullptr != texture)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			OPENGLES2RENDERER_RENDERERMATCHCHECK_RETURN(*this, *texture)
+		}
+	}
+
+	void OpenGLES2Renderer::csSetTextureCollection(unsigned int, Renderer::ITextureCollection *textureCollection)
+	{
+		// OpenGL ES 2 has no compute shader support
+
+		// Is the given texture collection valid?
+		if (nullptr != textureCollection)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			OPENGLES2RENDERER_RENDERERMATCHCHECK_RETURN(*this, *textureCollection)
+		}
+	}
+
+	void OpenGLES2Renderer::csSetSamplerState(unsigned int, Renderer::ISamplerState *samplerState)
+	{
+		// OpenGL ES 2 has no compute shader support
+
+		// Is the given sampler state valid?
+		if (nullptr != samplerState)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			OPENGLES2RENDERER_RENDERERMATCHCHECK_RETURN(*this, *samplerState)
+		}
+	}
+
+	void OpenGLES2Renderer::csSetSamplerStateCollection(unsigned int, Renderer::ISamplerStateCollection *samplerStateCollection)
+	{
+		// OpenGL ES 2 has no compute shader support
+
+		// Is the given sampler state collection valid?
+		if (nullptr != samplerStateCollection)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			OPENGLES2RENDERER_RENDERERMATCHCHECK_RETURN(*this, *samplerStateCollection)
+		}
+	}
+
+	void OpenGLES2Renderer::csSetUniformBuffer(unsigned int, Renderer::IUniformBuffer *uniformBuffer)
+	{
+		// OpenGL ES 2 has no compute shader support
+
+		// Is the given uniform buffer valid?
+		if (nullptr != uniformBuffer)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			OPENGLES2RENDERER_RENDERERMATCHCHECK_RETURN(*this, *uniformBuffer)
+		}
+	}
+
+	void OpenGLES2Renderer::csSetUnorderedAccessView(unsigned int, Renderer::IResource *resource)
+	{
+		// OpenGL ES 2 has no compute shader support
+
+		// Is the given resource valid?
+		if (nullptr != resource)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			OPENGLES2RENDERER_RENDERERMATCHCHECK_RETURN(*this, *resource)
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Operations                                            ]
 	//[-------------------------------------------------------]
@@ -1440,6 +1587,11 @@ namespace OpenGLES2Renderer
 		// Not required when using OpenGL ES 2
 	}
 
+	void OpenGLES2Renderer::resolveMultisampleFramebuffer(Renderer::IRenderTarget &, Renderer::IFramebuffer &)
+	{
+		// OpenGL ES 2 has no multisample texture support
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Draw call                                             ]
@@ -1454,9 +1606,14 @@ namespace OpenGLES2Renderer
 		}
 	}
 
-	void OpenGLES2Renderer::drawInstanced(unsigned int, unsigned int, unsigned int)
+	void OpenGLES2Renderer::drawInstanced(unsigned int startVertexLocation, unsigned int numberOfVertices, unsigned int numberOfInstances)
 	{
-		// Error! OpenGL ES 2 has no instancing support!
+		// Is currently a vertex array set? Do also check whether or not the required "GL_EXT_instanced_arrays" or "GL_EXT_draw_instanced" extension is there.
+		if (nullptr != mVertexArray && (mCapabilities.instancedArrays || mCapabilities.drawInstanced))
+		{
+			// Draw
+			glDrawArraysInstancedEXT(mOpenGLES2PrimitiveTopology, static_cast<GLint>(startVertexLocation), static_cast<GLsizei>(numberOfVertices), static_cast<GLsizei>(numberOfInstances));
+		}
 	}
 
 	void OpenGLES2Renderer::drawIndexed(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int, unsigned int, unsigned int)
@@ -1472,21 +1629,96 @@ namespace OpenGLES2Renderer
 				// OpenGL ES 2 has no "GL_EXT_draw_range_elements" equivalent, so, we can't support "minimumIndex" & "numberOfVertices" in here
 
 				// Draw
-				glDrawElements(mOpenGLES2PrimitiveTopology, static_cast<GLsizei>(numberOfIndices), indexBuffer->getOpenGLES2Type(), reinterpret_cast<const GLvoid*>(startIndexLocation * sizeof(int)));
+				glDrawElements(mOpenGLES2PrimitiveTopology, static_cast<GLsizei>(numberOfIndices), indexBuffer->getOpenGLES2Type(), reinterpret_cast<const GLvoid*>(startIndexLocation * indexBuffer->getIndexSize()));
 			}
 		}
 	}
 
-	void OpenGLES2Renderer::drawIndexedInstanced(unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int)
+	void OpenGLES2Renderer::drawIndexedInstanced(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int, unsigned int, unsigned int, unsigned int numberOfInstances)
 	{
-		// OpenGL ES 2 has no "GL_ARB_draw_elements_base_vertex" equivalent, so, we can't support "baseVertexLocation" in here
-		// Error! OpenGL ES 2 has no instancing support!
+		// Is currently an vertex array set? Do also check whether or not the required "GL_EXT_instanced_arrays" or "GL_EXT_draw_instanced" extension is there.
+		if (nullptr != mVertexArray && (mCapabilities.instancedArrays || mCapabilities.drawInstanced))
+		{
+			// Get the used index buffer
+			IndexBuffer *indexBuffer = mVertexArray->getIndexBuffer();
+			if (nullptr != indexBuffer)
+			{
+				// OpenGL ES 2 has no "GL_ARB_draw_elements_base_vertex" equivalent, so, we can't support "baseVertexLocation" in here
+				// "minimumIndex" & "numberOfVertices" are not used, there's no instanced version of "glDrawRangeElements()"
+
+				// Draw
+				glDrawElementsInstancedEXT(mOpenGLES2PrimitiveTopology, static_cast<GLsizei>(numberOfIndices), indexBuffer->getOpenGLES2Type(), reinterpret_cast<const GLvoid*>(startIndexLocation * indexBuffer->getIndexSize()), static_cast<GLsizei>(numberOfInstances));
+			}
+		}
+	}
+
+	void OpenGLES2Renderer::multiDrawIndexedIndirect(Renderer::IIndirectBuffer &indirectBuffer, unsigned int indirectBufferOffset, unsigned int numberOfDraws)
+	{
+		// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+		OPENGLES2RENDERER_RENDERERMATCHCHECK_RETURN(*this, indirectBuffer)
+
+		// OpenGL ES 2 has no indirect draw support, emulate the multi-draw by using a loop
+		// -> Do not read behind the end of the emulation data
+		const IndirectBuffer &openGLES2IndirectBuffer = static_cast<const IndirectBuffer&>(indirectBuffer);
+		const unsigned int maximumNumberOfDraws = (indirectBufferOffset < openGLES2IndirectBuffer.getNumberOfBytes()) ? (openGLES2IndirectBuffer.getNumberOfBytes() - indirectBufferOffset) / sizeof(Renderer::DrawIndexedInstancedArguments) : 0;
+		const Renderer::DrawIndexedInstancedArguments *drawArguments = reinterpret_cast<const Renderer::DrawIndexedInstancedArguments*>(openGLES2IndirectBuffer.getEmulationData() + indirectBufferOffset);
+		const Renderer::DrawIndexedInstancedArguments *drawArgumentsEnd = drawArguments + ((numberOfDraws < maximumNumberOfDraws) ? numberOfDraws : maximumNumberOfDraws);
+		const bool instancing = (mCapabilities.instancedArrays || mCapabilities.drawInstanced);
+		for (; drawArguments < drawArgumentsEnd; ++drawArguments)
+		{
+			if (instancing)
+			{
+				drawIndexedInstanced(drawArguments->startIndexLocation, drawArguments->indexCountPerInstance, drawArguments->baseVertexLocation, 0, 0, drawArguments->instanceCount);
+			}
+			else if (1 == drawArguments->instanceCount)
+			{
+				// Without "GL_EXT_instanced_arrays" or "GL_EXT_draw_instanced" only draw arguments with a single instance can be processed
+				drawIndexed(drawArguments->startIndexLocation, drawArguments->indexCountPerInstance, drawArguments->baseVertexLocation, 0, 0);
+			}
+		}
+	}
+
+	void OpenGLES2Renderer::drawAuto()
+	{
+		// OpenGL ES 2 has no stream output support
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Compute                                               ]
+	//[-------------------------------------------------------]
+	void OpenGLES2Renderer::dispatch(unsigned int, unsigned int, unsigned int)
+	{
+		// OpenGL ES 2 has no compute shader support
+	}
+
+	void OpenGLES2Renderer::memoryBarrier(unsigned int)
+	{
+		// OpenGL ES 2 has no compute shader support
 	}
 
 
 	//[-------------------------------------------------------]
 	//[ Synchronization                                       ]
 	//[-------------------------------------------------------]
+	Renderer::IFence *OpenGLES2Renderer::insertFence()
+	{
+		// OpenGL ES 2 has no fence support
+		return nullptr;
+	}
+
+	bool OpenGLES2Renderer::isFenceSignaled(Renderer::IFence &)
+	{
+		// OpenGL ES 2 has no fence support
+		return false;
+	}
+
+	bool OpenGLES2Renderer::waitFence(Renderer::IFence &, unsigned int)
+	{
+		// OpenGL ES 2 has no fence support
+		return false;
+	}
+
 	void OpenGLES2Renderer::flush()
 	{
 		glFlush();
@@ -1498,6 +1730,19 @@ namespace OpenGLES2Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Swap chain                                            ]
+	//[-------------------------------------------------------]
+	void OpenGLES2Renderer::presentSwapChains(unsigned int numberOfSwapChains, Renderer::ISwapChain **swapChains)
+	{
+		// EGL has no way to swap multiple surfaces at once, the swap chains are already sharing the single EGL context
+		for (unsigned int i = 0; i < numberOfSwapChains; ++i)
+		{
+			swapChains[i]->present();
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Debug                                                 ]
 	//[-------------------------------------------------------]
@@ -1575,15 +1820,18 @@ namespace OpenGLES2Renderer
 		// Individual uniforms ("constants" in Direct3D terminology) supported? If not, only uniform buffer objects are supported.
 		mCapabilities.individualUniforms = true;
 
-		// Instanced arrays supported? (shader model 3 feature, vertex array element advancing per-instance instead of per-vertex, OpenGL ES 2 has no "GL_ARB_instanced_arrays" extension)
-		mCapabilities.instancedArrays = false;
+		// Instanced arrays supported? (shader model 3 feature, vertex array element advancing per-instance instead of per-vertex, "GL_EXT_instanced_arrays" required)
+		mCapabilities.instancedArrays = mContext->getExtensions().isGL_EXT_instanced_arrays();
 
-		// Draw instanced supported? (shader model 4 feature, build in shader variable holding the current instance ID, OpenGL ES 2 has no "GL_ARB_draw_instanced" extension)
-		mCapabilities.drawInstanced = false;
+		// Draw instanced supported? (shader model 4 feature, build in shader variable holding the current instance ID, "GL_EXT_draw_instanced" required)
+		mCapabilities.drawInstanced = mContext->getExtensions().isGL_EXT_draw_instanced();
 
 		// Base vertex supported for draw calls?
 		mCapabilities.baseVertex = false;	// OpenGL ES 2 has no "GL_ARB_draw_elements_base_vertex" extension equivalent
 
+		// Native multi-draw indirect supported?
+		mCapabilities.multiDrawIndirect = false;	// OpenGL ES 2 has no "GL_ARB_multi_draw_indirect" extension equivalent, a loop is used
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = true;
 
@@ -29,6 +29,8 @@
 #include "OpenGLES2Renderer/VertexArrayNoVao.h"
 #include "OpenGLES2Renderer/VertexArrayVao.h"
 
+#include <Renderer/VertexArrayTypes.h>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -72,18 +74,35 @@ namespace OpenGLES2Renderer
 	//[-------------------------------------------------------]
 	Renderer::IVertexArray *Program::createVertexArray(unsigned int numberOfAttributes, const Renderer::VertexArrayAttribute *attributes, Renderer::IIndexBuffer *indexBuffer)
 	{
+		const IExtensions &extensions = static_cast<OpenGLES2Renderer&>(getRenderer()).getContext().getExtensions();
+
+		// Half-float vertex attributes are only allowed when the "GL_OES_vertex_half_float" extension is there
+		if (!extensions.isGL_OES_vertex_half_float())
+		{
+			const Renderer::VertexArrayAttribute *attributeEnd = attributes + numberOfAttributes;
+			for (const Renderer::VertexArrayAttribute *attribute = attributes; attribute < attributeEnd; ++attribute)
+			{
+				if (Renderer::VertexArrayFormat::HALF_2 == attribute->vertexArrayFormat || Renderer::VertexArrayFormat::HALF_4 == attribute->vertexArrayFormat)
+				{
+					// Error!
+					RENDERER_OUTPUT_DEBUG_PRINTF("OpenGL ES 2 error: The vertex attribute \"%s\" is using a half-float format, but the \"GL_OES_vertex_half_float\" extension is not supported\n", attribute->name)
+					return nullptr;
+				}
+			}
+		}
+
 		// Is "GL_OES_vertex_array_object" there?
-		if (static_cast<OpenGLES2Renderer&>(getRenderer()).getContext().getExtensions().isGL_OES_vertex_array_object())
+		if (extensions.isGL_OES_vertex_array_object())
 		{
 			// Effective vertex array object (VAO)
 			// TODO(co) Add security check: Is the given resource one of the currently used renderer?
-			return new VertexArrayVao(*this, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
+			return new (getRenderer().getAllocator()) VertexArrayVao(*this, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
 		}
 		else
 		{
 			// Traditional version
 			// TODO(co) Add security check: Is the given resource one of the currently used renderer?
-			return new VertexArrayNoVao(*this, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
+			return new (getRenderer().getAllocator()) VertexArrayNoVao(*this, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
 		}
 	}
 
@@ -78,7 +78,7 @@ namespace OpenGLES2Renderer
 				if (informationLength > 1)
 				{
 					// Allocate memory for the information
-					char *informationLog = new char[static_cast<unsigned int>(informationLength)];
+					char *informationLog = getRenderer().getAllocator().allocateArray<char>(static_cast<unsigned int>(informationLength), Renderer::AllocationTag::TEMPORARY);
 
 					// Get the information
 					glGetProgramInfoLog(mOpenGLES2Program, informationLength, nullptr, informationLog);
@@ -87,7 +87,7 @@ namespace OpenGLES2Renderer
 					RENDERER_OUTPUT_DEBUG_STRING(informationLog)
 
 					// Cleanup information memory
-					delete [] informationLog;
+					getRenderer().getAllocator().deallocateArray(informationLog, Renderer::AllocationTag::TEMPORARY);
 				}
 			#endif
 		}
@@ -43,7 +43,7 @@ namespace OpenGLES2Renderer
 	SamplerStateCollection::SamplerStateCollection(OpenGLES2Renderer &openGLES2Renderer, unsigned int numberOfSamplerStates, Renderer::ISamplerState **samplerStates) :
 		Renderer::ISamplerStateCollection(openGLES2Renderer),
 		mNumberOfSamplerStates(numberOfSamplerStates),
-		mSamplerStates((numberOfSamplerStates > 0) ? new Renderer::ISamplerState*[numberOfSamplerStates] : nullptr)
+		mSamplerStates(openGLES2Renderer.getAllocator().allocateArray<Renderer::ISamplerState*>(numberOfSamplerStates, Renderer::AllocationTag::RESOURCE))
 	{
 		// Loop through all given textures
 		Renderer::ISamplerState **currentSamplerState = mSamplerStates;
@@ -86,7 +86,7 @@ namespace OpenGLES2Renderer
 			}
 
 			// Release the allocated memory
-			delete [] mSamplerStates;
+			getRenderer().getAllocator().deallocateArray(mSamplerStates, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
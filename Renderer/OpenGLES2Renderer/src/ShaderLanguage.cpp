@@ -40,7 +40,7 @@ namespace OpenGLES2Renderer
 	*  @brief
 	*    Creates, loads and compiles a shader
 	*/
-	unsigned int ShaderLanguage::loadShader(unsigned int shaderType, const char *shaderSource)
+	unsigned int ShaderLanguage::loadShader(Renderer::IAllocator &allocator, unsigned int shaderType, const char *shaderSource)
 	{
 		// Create the shader object
 		const GLuint openGLES2Shader = glCreateShader(shaderType);
@@ -69,7 +69,7 @@ namespace OpenGLES2Renderer
 				if (informationLength > 1)
 				{
 					// Allocate memory for the information
-					GLchar *informationLog = new GLchar[static_cast<unsigned int>(informationLength)];
+					GLchar *informationLog = allocator.allocateArray<GLchar>(static_cast<unsigned int>(informationLength), Renderer::AllocationTag::TEMPORARY);
 
 					// Get the information
 					glGetShaderInfoLog(openGLES2Shader, informationLength, nullptr, informationLog);
@@ -78,8 +78,11 @@ namespace OpenGLES2Renderer
 					RENDERER_OUTPUT_DEBUG_STRING(informationLog)
 
 					// Cleanup information memory
-					delete [] informationLog;
+					allocator.deallocateArray(informationLog, Renderer::AllocationTag::TEMPORARY);
 				}
+			#else
+				// Avoid "warning C4100: '<x>' : unreferenced formal parameter"-warning
+				static_cast<void>(allocator);
 			#endif
 
 			// Destroy the shader
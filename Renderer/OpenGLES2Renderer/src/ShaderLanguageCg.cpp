@@ -27,6 +27,8 @@
 #include "OpenGLES2Renderer/VertexShaderCg.h"
 #include "OpenGLES2Renderer/FragmentShaderCg.h"
 
+#include <Renderer/IComputeShader.h>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -74,7 +76,7 @@ namespace OpenGLES2Renderer
 
 	Renderer::IVertexShader *ShaderLanguageCg::createVertexShader(const char *sourceCode, const char *, const char *, const char *)
 	{
-		return new VertexShaderCg(getOpenGLES2Renderer(), sourceCode);
+		return new (getOpenGLES2Renderer().getAllocator()) VertexShaderCg(getOpenGLES2Renderer(), sourceCode);
 	}
 
 	Renderer::ITessellationControlShader *ShaderLanguageCg::createTessellationControlShader(const char *, const char *, const char *, const char *)
@@ -97,7 +99,7 @@ namespace OpenGLES2Renderer
 
 	Renderer::IFragmentShader *ShaderLanguageCg::createFragmentShader(const char *sourceCode, const char *, const char *, const char *)
 	{
-		return new FragmentShaderCg(getOpenGLES2Renderer(), sourceCode);
+		return new (getOpenGLES2Renderer().getAllocator()) FragmentShaderCg(getOpenGLES2Renderer(), sourceCode);
 	}
 
 	Renderer::IProgram *ShaderLanguageCg::createProgram(Renderer::IVertexShader *vertexShader, Renderer::ITessellationControlShader *tessellationControlShader, Renderer::ITessellationEvaluationShader *tessellationEvaluationShader, Renderer::IGeometryShader *geometryShader, Renderer::IFragmentShader *fragmentShader)
@@ -129,7 +131,7 @@ namespace OpenGLES2Renderer
 		else
 		{
 			// Create the program
-			return new ProgramCg(getOpenGLES2Renderer(), static_cast<VertexShaderCg*>(vertexShader), static_cast<FragmentShaderCg*>(fragmentShader));
+			return new (getOpenGLES2Renderer().getAllocator()) ProgramCg(getOpenGLES2Renderer(), static_cast<VertexShaderCg*>(vertexShader), static_cast<FragmentShaderCg*>(fragmentShader));
 		}
 
 		// Error! Shader language mismatch!
@@ -149,6 +151,24 @@ namespace OpenGLES2Renderer
 		return nullptr;
 	}
 
+	Renderer::IComputeShader *ShaderLanguageCg::createComputeShader(const char *, const char *, const char *, const char *)
+	{
+		// Error! OpenGL ES 2 has no compute shader support.
+		return nullptr;
+	}
+
+	Renderer::IProgram *ShaderLanguageCg::createComputeProgram(Renderer::IComputeShader *computeShader)
+	{
+		// Error! OpenGL ES 2 has no compute shader support.
+		// -> Ensure a correct reference counter behaviour, even in the situation of an error
+		if (nullptr != computeShader)
+		{
+			computeShader->addReference();
+			computeShader->release();
+		}
+		return nullptr;
+	}
+
 	Renderer::IUniformBuffer *ShaderLanguageCg::createUniformBuffer(unsigned int, const void *, Renderer::BufferUsage::Enum)
 	{
 		// Error! OpenGL ES 2 has no uniform buffer support.
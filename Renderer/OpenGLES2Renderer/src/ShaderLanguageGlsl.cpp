@@ -27,6 +27,8 @@
 #include "OpenGLES2Renderer/ProgramGlsl.h"
 #include "OpenGLES2Renderer/VertexShaderGlsl.h"
 
+#include <Renderer/IComputeShader.h>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -75,7 +77,7 @@ namespace OpenGLES2Renderer
 	Renderer::IVertexShader *ShaderLanguageGlsl::createVertexShader(const char *sourceCode, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::vertexShader", we know there's vertex shader support
-		return new VertexShaderGlsl(getOpenGLES2Renderer(), sourceCode);
+		return new (getOpenGLES2Renderer().getAllocator()) VertexShaderGlsl(getOpenGLES2Renderer(), sourceCode);
 	}
 
 	Renderer::ITessellationControlShader *ShaderLanguageGlsl::createTessellationControlShader(const char *, const char *, const char *, const char *)
@@ -99,7 +101,7 @@ namespace OpenGLES2Renderer
 	Renderer::IFragmentShader *ShaderLanguageGlsl::createFragmentShader(const char *sourceCode, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::fragmentShader", we know there's fragment shader support
-		return new FragmentShaderGlsl(getOpenGLES2Renderer(), sourceCode);
+		return new (getOpenGLES2Renderer().getAllocator()) FragmentShaderGlsl(getOpenGLES2Renderer(), sourceCode);
 	}
 
 	Renderer::IProgram *ShaderLanguageGlsl::createProgram(Renderer::IVertexShader *vertexShader, Renderer::ITessellationControlShader *tessellationControlShader, Renderer::ITessellationEvaluationShader *tessellationEvaluationShader, Renderer::IGeometryShader *geometryShader, Renderer::IFragmentShader *fragmentShader)
@@ -131,7 +133,7 @@ namespace OpenGLES2Renderer
 		else
 		{
 			// Create the program
-			return new ProgramGlsl(getOpenGLES2Renderer(), static_cast<VertexShaderGlsl*>(vertexShader), static_cast<FragmentShaderGlsl*>(fragmentShader));
+			return new (getOpenGLES2Renderer().getAllocator()) ProgramGlsl(getOpenGLES2Renderer(), static_cast<VertexShaderGlsl*>(vertexShader), static_cast<FragmentShaderGlsl*>(fragmentShader));
 		}
 
 		// Error! Shader language mismatch!
@@ -151,6 +153,24 @@ namespace OpenGLES2Renderer
 		return nullptr;
 	}
 
+	Renderer::IComputeShader *ShaderLanguageGlsl::createComputeShader(const char *, const char *, const char *, const char *)
+	{
+		// Error! OpenGL ES 2 has no compute shader support.
+		return nullptr;
+	}
+
+	Renderer::IProgram *ShaderLanguageGlsl::createComputeProgram(Renderer::IComputeShader *computeShader)
+	{
+		// Error! OpenGL ES 2 has no compute shader support.
+		// -> Ensure a correct reference counter behaviour, even in the situation of an error
+		if (nullptr != computeShader)
+		{
+			computeShader->addReference();
+			computeShader->release();
+		}
+		return nullptr;
+	}
+
 	Renderer::IUniformBuffer *ShaderLanguageGlsl::createUniformBuffer(unsigned int, const void *, Renderer::BufferUsage::Enum)
 	{
 		// Error! OpenGL ES 2 has no uniform buffer support.
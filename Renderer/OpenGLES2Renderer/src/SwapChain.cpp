@@ -42,9 +42,12 @@ namespace OpenGLES2Renderer
 	*/
 	SwapChain::SwapChain(OpenGLES2Renderer &openGLES2Renderer, handle nativeWindowHandle) :
 		ISwapChain(openGLES2Renderer),
-		mNativeWindowHandle(nativeWindowHandle)
+		mNativeWindowHandle(nativeWindowHandle),
+		mSwapInterval(1),	// EGL default
+		mFramePacer(openGLES2Renderer)
 	{
-		// TODO(co) Implement me
+		// Set the estimated number of bytes of the window framebuffer
+		resizeBuffers();
 	}
 
 	/**
@@ -140,13 +143,21 @@ namespace OpenGLES2Renderer
 	{
 		// TODO(co) Correct implementation
 		IContext &context = static_cast<OpenGLES2Renderer&>(getRenderer()).getContext();
+
 		// Swap buffers
+		mFramePacer.beginPresent();
 		eglSwapBuffers(context.getEGLDisplay(), context.getEGLDummySurface());
+		mFramePacer.endPresent();
 	}
 
 	void SwapChain::resizeBuffers()
 	{
-		// Nothing to do in here
+		// The window framebuffer is resized by the operating system, we just have to update the estimated number of bytes
+		// -> Front and back buffer with 32 bit color each and a 32 bit depth stencil buffer
+		unsigned int width  = 0;
+		unsigned int height = 0;
+		getWidthAndHeight(width, height);
+		setNumberOfBytes(static_cast<unsigned long long>(width) * height * (4 + 4 + 4));
 	}
 
 	bool SwapChain::getFullscreenState() const
@@ -160,6 +171,42 @@ namespace OpenGLES2Renderer
 		// TODO(co) Implement me
 	}
 
+	int SwapChain::getSwapInterval() const
+	{
+		return mSwapInterval;
+	}
+
+	bool SwapChain::setSwapInterval(int swapInterval)
+	{
+		// EGL has no adaptive vertical synchronization, fall back to regular vertical synchronization
+		// -> "eglSwapInterval()" sets the swap interval of the surface bound to the current context
+		IContext &context = static_cast<OpenGLES2Renderer&>(getRenderer()).getContext();
+		if (EGL_TRUE == eglSwapInterval(context.getEGLDisplay(), (swapInterval < 0) ? -swapInterval : swapInterval))
+		{
+			// Done
+			mSwapInterval = swapInterval;
+			return true;
+		}
+
+		// Error!
+		return false;
+	}
+
+	unsigned int SwapChain::getMaximumFrameLatency() const
+	{
+		return mFramePacer.getMaximumFrameLatency();
+	}
+
+	void SwapChain::setMaximumFrameLatency(unsigned int maximumFrameLatency)
+	{
+		mFramePacer.setMaximumFrameLatency(maximumFrameLatency);
+	}
+
+	const Renderer::PresentStatistics &SwapChain::getPresentStatistics() const
+	{
+		return mFramePacer.getPresentStatistics();
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -43,8 +43,12 @@ namespace OpenGLES2Renderer
 	*/
 	Texture2D::Texture2D(OpenGLES2Renderer &openGLES2Renderer, unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags) :
 		ITexture2D(openGLES2Renderer, width, height),
-		mOpenGLES2Texture(0)
+		mOpenGLES2Texture(0),
+		mTextureFormat(textureFormat)
 	{
+		// Set the estimated number of bytes of the texture
+		setNumberOfBytes(calculateNumberOfBytes(width, height, 1, Mapping::getOpenGLES2Size(textureFormat), 0 != (flags & Renderer::TextureFlag::MIPMAPS), 1));
+
 		// TODO(co) Check support formats
 
 		#ifndef OPENGLES2RENDERER_NO_STATE_CLEANUP
@@ -100,6 +104,45 @@ namespace OpenGLES2Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2D methods           ]
+	//[-------------------------------------------------------]
+	void Texture2D::updateRegion(unsigned int mipmap, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data)
+	{
+		// Check the given data
+		if (nullptr != data)
+		{
+			#ifndef OPENGLES2RENDERER_NO_STATE_CLEANUP
+				// Backup the currently set alignment
+				GLint openGLES2AlignmentBackup = 0;
+				glGetIntegerv(GL_UNPACK_ALIGNMENT, &openGLES2AlignmentBackup);
+
+				// Backup the currently bound OpenGL ES 2 texture
+				GLint openGLES2TextureBackup = 0;
+				glGetIntegerv(GL_TEXTURE_BINDING_2D, &openGLES2TextureBackup);
+			#endif
+
+			// Set correct alignment
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+			// Make this OpenGL ES 2 texture instance to the currently used one
+			glBindTexture(GL_TEXTURE_2D, mOpenGLES2Texture);
+
+			// Upload the region
+			// -> OpenGL ES 2 has no pixel buffer object support, the data is transferred synchronously
+			glTexSubImage2D(GL_TEXTURE_2D, static_cast<GLint>(mipmap), static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLsizei>(width), static_cast<GLsizei>(height), Mapping::getOpenGLES2Format(mTextureFormat), Mapping::getOpenGLES2Type(mTextureFormat), data);
+
+			#ifndef OPENGLES2RENDERER_NO_STATE_CLEANUP
+				// Be polite and restore the previous bound OpenGL ES 2 texture
+				glBindTexture(GL_TEXTURE_2D, openGLES2TextureBackup);
+
+				// Restore previous alignment
+				glPixelStorei(GL_UNPACK_ALIGNMENT, openGLES2AlignmentBackup);
+			#endif
+		}
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -43,8 +43,12 @@ namespace OpenGLES2Renderer
 	*/
 	Texture2DArray::Texture2DArray(OpenGLES2Renderer &openGLES2Renderer, unsigned int width, unsigned int height, unsigned int numberOfSlices, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags) :
 		ITexture2DArray(openGLES2Renderer, width, height, numberOfSlices),
-		mOpenGLES2Texture(0)
+		mOpenGLES2Texture(0),
+		mTextureFormat(textureFormat)
 	{
+		// Set the estimated number of bytes of the texture array
+		setNumberOfBytes(calculateNumberOfBytes(width, height, numberOfSlices, Mapping::getOpenGLES2Size(textureFormat), 0 != (flags & Renderer::TextureFlag::MIPMAPS), 1));
+
 		// TODO(co) Check support formats
 
 		#ifndef OPENGLES2RENDERER_NO_STATE_CLEANUP
@@ -100,6 +104,45 @@ namespace OpenGLES2Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2DArray methods      ]
+	//[-------------------------------------------------------]
+	void Texture2DArray::updateRegion(unsigned int mipmap, unsigned int slice, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data)
+	{
+		// Check the given data and slice
+		if (nullptr != data && slice < getNumberOfSlices())
+		{
+			#ifndef OPENGLES2RENDERER_NO_STATE_CLEANUP
+				// Backup the currently set alignment
+				GLint openGLES2AlignmentBackup = 0;
+				glGetIntegerv(GL_UNPACK_ALIGNMENT, &openGLES2AlignmentBackup);
+
+				// Backup the currently bound OpenGL ES 2 texture
+				GLint openGLES2TextureBackup = 0;
+				glGetIntegerv(GL_TEXTURE_2D_ARRAY_EXT, &openGLES2TextureBackup);
+			#endif
+
+			// Set correct alignment
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+			// Make this OpenGL ES 2 texture instance to the currently used one
+			glBindTexture(GL_TEXTURE_2D_ARRAY_EXT, mOpenGLES2Texture);
+
+			// Upload the region
+			// -> OpenGL ES 2 has no pixel buffer object support, the data is transferred synchronously
+			glTexSubImage3DOES(GL_TEXTURE_2D_ARRAY_EXT, static_cast<int>(mipmap), static_cast<int>(x), static_cast<int>(y), static_cast<int>(slice), static_cast<GLsizei>(width), static_cast<GLsizei>(height), 1, Mapping::getOpenGLES2Format(mTextureFormat), Mapping::getOpenGLES2Type(mTextureFormat), data);
+
+			#ifndef OPENGLES2RENDERER_NO_STATE_CLEANUP
+				// Be polite and restore the previous bound OpenGL ES 2 texture
+				glBindTexture(GL_TEXTURE_2D_ARRAY_EXT, openGLES2TextureBackup);
+
+				// Restore previous alignment
+				glPixelStorei(GL_UNPACK_ALIGNMENT, openGLES2AlignmentBackup);
+			#endif
+		}
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
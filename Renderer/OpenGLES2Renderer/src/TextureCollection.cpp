@@ -44,7 +44,7 @@ namespace OpenGLES2Renderer
 	TextureCollection::TextureCollection(OpenGLES2Renderer &openGLES2Renderer, unsigned int numberOfTextures, Renderer::ITexture **textures) :
 		Renderer::ITextureCollection(openGLES2Renderer),
 		mNumberOfTextures(numberOfTextures),
-		mTextures((numberOfTextures > 0) ? new Renderer::ITexture*[numberOfTextures] : nullptr)
+		mTextures(openGLES2Renderer.getAllocator().allocateArray<Renderer::ITexture*>(numberOfTextures, Renderer::AllocationTag::RESOURCE))
 	{
 		// Loop through all given textures
 		Renderer::ITexture **currentTexture = mTextures;
@@ -87,7 +87,7 @@ namespace OpenGLES2Renderer
 			}
 
 			// Release the allocated memory
-			delete [] mTextures;
+			getRenderer().getAllocator().deallocateArray(mTextures, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
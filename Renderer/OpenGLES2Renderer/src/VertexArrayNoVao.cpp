@@ -27,6 +27,8 @@
 #include "OpenGLES2Renderer/IExtensions.h"	// We need to include this in here for the definitions of the OpenGL ES 2 functions
 #include "OpenGLES2Renderer/IndexBuffer.h"
 #include "OpenGLES2Renderer/VertexBuffer.h"
+#include "OpenGLES2Renderer/IContext.h"
+#include "OpenGLES2Renderer/OpenGLES2Renderer.h"
 
 #include <GLES2/gl2.h>
 
@@ -50,8 +52,9 @@ namespace OpenGLES2Renderer
 	VertexArrayNoVao::VertexArrayNoVao(Program &program, unsigned int numberOfAttributes, const Renderer::VertexArrayAttribute *attributes, IndexBuffer *indexBuffer) :
 		VertexArray(program.getRenderer(), indexBuffer),
 		mNumberOfAttributes(numberOfAttributes),
-		mAttributes(numberOfAttributes ? new Renderer::VertexArrayAttribute[numberOfAttributes] : nullptr),
-		mAttributeLocations(numberOfAttributes ? new int[numberOfAttributes] : nullptr)
+		mAttributes(program.getRenderer().getAllocator().allocateArray<Renderer::VertexArrayAttribute>(numberOfAttributes, Renderer::AllocationTag::RESOURCE)),
+		mAttributeLocations(program.getRenderer().getAllocator().allocateArray<int>(numberOfAttributes, Renderer::AllocationTag::RESOURCE)),
+		mIsGL_EXT_instanced_arrays(static_cast<OpenGLES2Renderer&>(program.getRenderer()).getContext().getExtensions().isGL_EXT_instanced_arrays())
 	{
 		// Copy over the data
 		if (nullptr != mAttributes)
@@ -93,13 +96,13 @@ namespace OpenGLES2Renderer
 			}
 
 			// Cleanup
-			delete [] mAttributes;
+			getRenderer().getAllocator().deallocateArray(mAttributes, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Destroy the vertex array attribute locations
 		if (nullptr != mAttributeLocations)
 		{
-			delete [] mAttributeLocations;
+			getRenderer().getAllocator().deallocateArray(mAttributeLocations, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
@@ -128,6 +131,12 @@ namespace OpenGLES2Renderer
 				glBindBuffer(GL_ARRAY_BUFFER, static_cast<VertexBuffer*>(attribute->vertexBuffer)->getOpenGLES2ArrayBuffer());
 				glVertexAttribPointer(static_cast<GLuint>(*attributeLocation), Mapping::getOpenGLES2Size(attribute->vertexArrayFormat), Mapping::getOpenGLES2Type(attribute->vertexArrayFormat), GL_FALSE, static_cast<GLsizei>(attribute->stride), reinterpret_cast<GLvoid*>(attribute->offset));
 
+				// Per-instance instead of per-vertex requires "GL_EXT_instanced_arrays"
+				if (attribute->instancesPerElement > 0 && mIsGL_EXT_instanced_arrays)
+				{
+					glVertexAttribDivisorEXT(static_cast<GLuint>(*attributeLocation), attribute->instancesPerElement);
+				}
+
 				// Enable OpenGL ES 2 vertex attribute array
 				glEnableVertexAttribArray(static_cast<GLuint>(*attributeLocation));
 			}
@@ -157,15 +166,21 @@ namespace OpenGLES2Renderer
 		// No previous bound OpenGL element array buffer restore, there's not really a point in it
 
 		// Loop through all attributes
-		const int *attributeLocation    = mAttributeLocations;
-		const int *attributeLocationEnd = mAttributeLocations + mNumberOfAttributes;
-		for (; attributeLocation < attributeLocationEnd; ++attributeLocation)
+		const int *attributeLocation = mAttributeLocations;
+		const Renderer::VertexArrayAttribute *attributeEnd = mAttributes + mNumberOfAttributes;
+		for (const Renderer::VertexArrayAttribute *attribute = mAttributes; attribute < attributeEnd; ++attribute, ++attributeLocation)
 		{
 			// Is the attribute location valid?
 			if (*attributeLocation > -1)
 			{
 				// Disable OpenGL ES 2 vertex attribute array
 				glDisableVertexAttribArray(static_cast<GLuint>(*attributeLocation));
+
+				// Per-instance instead of per-vertex requires "GL_EXT_instanced_arrays"
+				if (attribute->instancesPerElement > 0 && mIsGL_EXT_instanced_arrays)
+				{
+					glVertexAttribDivisorEXT(static_cast<GLuint>(*attributeLocation), 0);
+				}
 			}
 		}
 	}
@@ -27,6 +27,8 @@
 #include "OpenGLES2Renderer/IExtensions.h"	// We need to include this in here for the definitions of the OpenGL ES 2 functions
 #include "OpenGLES2Renderer/IndexBuffer.h"
 #include "OpenGLES2Renderer/VertexBuffer.h"
+#include "OpenGLES2Renderer/IContext.h"
+#include "OpenGLES2Renderer/OpenGLES2Renderer.h"
 
 
 //[-------------------------------------------------------]
@@ -47,7 +49,7 @@ namespace OpenGLES2Renderer
 		VertexArray(program.getRenderer(), indexBuffer),
 		mOpenGLES2VertexArray(0),
 		mNumberOfVertexBuffers(numberOfAttributes),
-		mVertexBuffers((numberOfAttributes > 0) ? new VertexBuffer*[numberOfAttributes] : nullptr)	// Guaranteed to be filled below, so we don't need to care to initialize the content in here
+		mVertexBuffers(program.getRenderer().getAllocator().allocateArray<VertexBuffer*>(numberOfAttributes, Renderer::AllocationTag::RESOURCE))	// Guaranteed to be filled below, so we don't need to care to initialize the content in here
 	{
 		// Create the OpenGL ES 2 vertex array
 		glGenVertexArraysOES(1, &mOpenGLES2VertexArray);
@@ -88,6 +90,13 @@ namespace OpenGLES2Renderer
 					glBindBuffer(GL_ARRAY_BUFFER, (*vertexBuffers)->getOpenGLES2ArrayBuffer());
 					glVertexAttribPointer(static_cast<GLuint>(attributeLocation), Mapping::getOpenGLES2Size(attribute->vertexArrayFormat), Mapping::getOpenGLES2Type(attribute->vertexArrayFormat), GL_FALSE, static_cast<GLsizei>(attribute->stride), reinterpret_cast<GLvoid*>(attribute->offset));
 
+					// Per-instance instead of per-vertex requires "GL_EXT_instanced_arrays"
+					// -> The divisor is part of the vertex array object state, so it's only set once in here
+					if (attribute->instancesPerElement > 0 && static_cast<OpenGLES2Renderer&>(program.getRenderer()).getContext().getExtensions().isGL_EXT_instanced_arrays())
+					{
+						glVertexAttribDivisorEXT(static_cast<GLuint>(attributeLocation), attribute->instancesPerElement);
+					}
+
 					// Enable OpenGL ES 2 vertex attribute array
 					glEnableVertexAttribArray(static_cast<GLuint>(attributeLocation));
 				}
@@ -140,7 +149,7 @@ namespace OpenGLES2Renderer
 			}
 
 			// Cleanup
-			delete [] mVertexBuffers;
+			getRenderer().getAllocator().deallocateArray(mVertexBuffers, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
@@ -45,6 +45,9 @@ namespace OpenGLES2Renderer
 		IVertexBuffer(openGLES2Renderer),
 		mOpenGLES2ArrayBuffer(0)
 	{
+		// Set the estimated number of bytes of the vertex buffer
+		setNumberOfBytes(numberOfBytes);
+
 		// Create the OpenGL ES 2 array buffer
 		glGenBuffers(1, &mOpenGLES2ArrayBuffer);
 
@@ -43,7 +43,7 @@ namespace OpenGLES2Renderer
 	*/
 	VertexShaderCg::VertexShaderCg(OpenGLES2Renderer &openGLES2Renderer, const char *sourceCode) :
 		VertexShader(openGLES2Renderer),
-		mOpenGLES2Shader(ShaderLanguage::loadShader(GL_CG_VERTEX_SHADER_EXT, sourceCode))
+		mOpenGLES2Shader(ShaderLanguage::loadShader(openGLES2Renderer.getAllocator(), GL_CG_VERTEX_SHADER_EXT, sourceCode))
 	{
 		// Nothing to do in here
 	}
@@ -43,7 +43,7 @@ namespace OpenGLES2Renderer
 	*/
 	VertexShaderGlsl::VertexShaderGlsl(OpenGLES2Renderer &openGLES2Renderer, const char *sourceCode) :
 		VertexShader(openGLES2Renderer),
-		mOpenGLES2Shader(ShaderLanguage::loadShader(GL_VERTEX_SHADER, sourceCode))
+		mOpenGLES2Shader(ShaderLanguage::loadShader(openGLES2Renderer.getAllocator(), GL_VERTEX_SHADER, sourceCode))
 	{
 		// Nothing to do in here
 	}
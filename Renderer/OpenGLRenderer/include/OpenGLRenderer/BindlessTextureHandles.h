@@ -0,0 +1,221 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __OPENGLRENDERER_BINDLESSTEXTUREHANDLES_H__
+#define __OPENGLRENDERER_BINDLESSTEXTUREHANDLES_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/StlAllocator.h>
+
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class ISamplerState;
+}
+namespace OpenGLRenderer
+{
+	class OpenGLRenderer;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace OpenGLRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Bindless texture handles of an OpenGL texture
+	*
+	*  @remarks
+	*    A bindless texture handle is requested once per texture and sampler state pair and is kept until the texture gets
+	*    destroyed, as demanded by "GL_ARB_bindless_texture". The residency of each handle is reference counted so several
+	*    users can make the same handle resident without knowing of each other.
+	*
+	*  @note
+	*    - "GL_ARB_bindless_texture" required
+	*/
+	class BindlessTextureHandles
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] allocator
+		*    Allocator to allocate the handle table with, must stay valid as long as the bindless texture handles instance exists
+		*/
+		explicit BindlessTextureHandles(Renderer::IAllocator &allocator);
+
+		/**
+		*  @brief
+		*    Destructor
+		*
+		*  @note
+		*    - Call "release()" before the OpenGL texture is destroyed
+		*/
+		~BindlessTextureHandles();
+
+		/**
+		*  @brief
+		*    Return the bindless texture handle for the given sampler state, the handle is requested on first use
+		*
+		*  @param[in] openGLRenderer
+		*    Owner OpenGL renderer instance
+		*  @param[in] openGLTexture
+		*    OpenGL texture the handles are requested for (type "GLuint" not used in here in order to keep the header slim)
+		*  @param[in] samplerState
+		*    Sampler state to use, null pointer for the sampler state stored inside the texture
+		*
+		*  @return
+		*    The bindless texture handle, 0 on error (e.g. "GL_ARB_bindless_texture" not available)
+		*/
+		unsigned long long getHandle(OpenGLRenderer &openGLRenderer, unsigned int openGLTexture, Renderer::ISamplerState *samplerState);
+
+		/**
+		*  @brief
+		*    Make the bindless texture handle for the given sampler state resident or non-resident
+		*
+		*  @param[in] openGLRenderer
+		*    Owner OpenGL renderer instance
+		*  @param[in] openGLTexture
+		*    OpenGL texture the handles are requested for (type "GLuint" not used in here in order to keep the header slim)
+		*  @param[in] samplerState
+		*    Sampler state to use, null pointer for the sampler state stored inside the texture
+		*  @param[in] resident
+		*    "true" to add a residency reference, "false" to release a residency reference
+		*
+		*  @note
+		*    - The handle is made resident when the first residency reference is added and made non-resident when the last
+		*      residency reference is released
+		*/
+		void setResident(OpenGLRenderer &openGLRenderer, unsigned int openGLTexture, Renderer::ISamplerState *samplerState, bool resident);
+
+		/**
+		*  @brief
+		*    Make all bindless texture handles non-resident and release the sampler state references
+		*
+		*  @note
+		*    - Must be called before the OpenGL texture is destroyed
+		*/
+		void release();
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Bindless texture handle of a texture and sampler state pair
+		*/
+		struct Handle
+		{
+			Renderer::ISamplerState *samplerState;		/**< Sampler state (we keep a reference to it), can be a null pointer */
+			unsigned long long		 openGLHandle;		/**< OpenGL bindless texture handle (type "GLuint64" not used in here in order to keep the header slim) */
+			unsigned int			 numberOfResidents;	/**< Number of residency references */
+		};
+		typedef std::vector<Handle, Renderer::StlAllocator<Handle> > Handles;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		explicit BindlessTextureHandles(const BindlessTextureHandles &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		BindlessTextureHandles &operator =(const BindlessTextureHandles &source);
+
+		/**
+		*  @brief
+		*    Return the handle for the given sampler state, the handle is requested on first use
+		*
+		*  @param[in] openGLRenderer
+		*    Owner OpenGL renderer instance
+		*  @param[in] openGLTexture
+		*    OpenGL texture the handles are requested for (type "GLuint" not used in here in order to keep the header slim)
+		*  @param[in] samplerState
+		*    Sampler state to use, null pointer for the sampler state stored inside the texture
+		*
+		*  @return
+		*    The handle, null pointer on error
+		*/
+		Handle *getOrCreateHandle(OpenGLRenderer &openGLRenderer, unsigned int openGLTexture, Renderer::ISamplerState *samplerState);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Handles mHandles;	/**< Requested bindless texture handles, usually just one or two so a linear search is fine */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // OpenGLRenderer
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __OPENGLRENDERER_BINDLESSTEXTUREHANDLES_H__
@@ -53,7 +53,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    OpenGL blend state class
 	*/
-	class BlendState : public Renderer::IBlendState
+	class BlendState final : public Renderer::IBlendState
 	{
 
 
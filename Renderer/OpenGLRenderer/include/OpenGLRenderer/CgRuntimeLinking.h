@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <Renderer/AllocatorObject.h>
 #include <Cg/cgGL.h>
 
 
@@ -46,7 +47,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Cg runtime linking
 	*/
-	class CgRuntimeLinking
+	class CgRuntimeLinking : public Renderer::AllocatorObject<Renderer::AllocationTag::RENDERER>
 	{
 
 
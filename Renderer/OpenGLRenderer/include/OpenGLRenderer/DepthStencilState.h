@@ -53,7 +53,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    OpenGL depth stencil state class
 	*/
-	class DepthStencilState : public Renderer::IDepthStencilState
+	class DepthStencilState final : public Renderer::IDepthStencilState
 	{
 
 
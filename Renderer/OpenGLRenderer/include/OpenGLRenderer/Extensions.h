@@ -29,6 +29,8 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <Renderer/AllocatorObject.h>
+
 #ifdef WIN32
 	// Disable warnings in external headers, we can't fix them
 	__pragma(warning(push))
@@ -47,6 +49,56 @@
 #endif
 
 
+//[-------------------------------------------------------]
+//[ Definitions                                           ]
+//[-------------------------------------------------------]
+// GL_ARB_multi_draw_indirect (not yet part of the used "glext.h"-version)
+#ifndef GL_ARB_multi_draw_indirect
+	typedef void (APIENTRYP PFNGLMULTIDRAWARRAYSINDIRECTPROC) (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride);
+	typedef void (APIENTRYP PFNGLMULTIDRAWELEMENTSINDIRECTPROC) (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride);
+#endif
+
+// GL_ARB_compute_shader (not yet part of the used "glext.h"-version)
+#ifndef GL_ARB_compute_shader
+	#define GL_COMPUTE_SHADER				0x91B9
+	#define GL_DISPATCH_INDIRECT_BUFFER		0x90EE
+	typedef void (APIENTRYP PFNGLDISPATCHCOMPUTEPROC) (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z);
+	typedef void (APIENTRYP PFNGLDISPATCHCOMPUTEINDIRECTPROC) (GLintptr indirect);
+#endif
+
+// GL_ARB_shader_storage_buffer_object (not yet part of the used "glext.h"-version)
+#ifndef GL_ARB_shader_storage_buffer_object
+	#define GL_SHADER_STORAGE_BUFFER		0x90D2
+	#define GL_SHADER_STORAGE_BARRIER_BIT	0x2000
+#endif
+
+// GL_ARB_buffer_storage (not yet part of the used "glext.h"-version)
+#ifndef GL_ARB_buffer_storage
+	#define GL_MAP_PERSISTENT_BIT	0x0040
+	#define GL_MAP_COHERENT_BIT		0x0080
+	typedef void (APIENTRYP PFNGLBUFFERSTORAGEPROC) (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+#endif
+
+// GL_ARB_bindless_texture (not yet part of the used "glext.h"-version)
+#ifndef GL_ARB_bindless_texture
+	typedef GLuint64 (APIENTRYP PFNGLGETTEXTUREHANDLEARBPROC) (GLuint texture);
+	typedef GLuint64 (APIENTRYP PFNGLGETTEXTURESAMPLERHANDLEARBPROC) (GLuint texture, GLuint sampler);
+	typedef void (APIENTRYP PFNGLMAKETEXTUREHANDLERESIDENTARBPROC) (GLuint64 handle);
+	typedef void (APIENTRYP PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC) (GLuint64 handle);
+#endif
+
+// GL_ARB_multi_bind (not yet part of the used "glext.h"-version)
+#ifndef GL_ARB_multi_bind
+	typedef void (APIENTRYP PFNGLBINDTEXTURESPROC) (GLuint first, GLsizei count, const GLuint *textures);
+	typedef void (APIENTRYP PFNGLBINDSAMPLERSPROC) (GLuint first, GLsizei count, const GLuint *samplers);
+#endif
+
+// GLX_EXT_swap_control (not part of every "glxext.h"-version)
+#if defined(LINUX) && !defined(GLX_EXT_swap_control)
+	typedef void (*PFNGLXSWAPINTERVALEXTPROC) (Display *dpy, GLXDrawable drawable, int interval);
+#endif
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -76,7 +128,7 @@ namespace OpenGLRenderer
 	*    - OpenGL extension registry at http://oss.sgi.com/projects/ogl-sample/registry/ for more information about
 	*      the different extensions
 	*/
-	class Extensions
+	class Extensions : public Renderer::AllocatorObject<Renderer::AllocationTag::RENDERER>
 	{
 
 
@@ -117,6 +169,7 @@ namespace OpenGLRenderer
 		// WGL (Windows only)
 		bool isWGL_ARB_extensions_string() const;
 		bool isWGL_EXT_swap_control() const;
+		bool isWGL_EXT_swap_control_tear() const;
 		bool isWGL_ARB_pixel_format() const;
 		bool isWGL_ARB_render_texture() const;
 		bool isWGL_ARB_make_current_read() const;
@@ -125,6 +178,8 @@ namespace OpenGLRenderer
 		bool isWGL_NV_float_buffer() const;			// "GLX_NV_float_buffer" under Linux
 		// GLX (Linux only)
 		bool isGLX_SGI_swap_control() const;
+		bool isGLX_EXT_swap_control() const;
+		bool isGLX_EXT_swap_control_tear() const;
 		// EXT
 		bool isGL_EXT_compiled_vertex_array() const;
 		bool isGL_EXT_draw_range_elements() const;
@@ -186,7 +241,20 @@ namespace OpenGLRenderer
 		bool isGL_ARB_vertex_array_object() const;
 		bool isGL_ARB_sampler_objects() const;
 		bool isGL_ARB_draw_elements_base_vertex() const;
+		bool isGL_ARB_draw_indirect() const;
+		bool isGL_ARB_multi_draw_indirect() const;
+		bool isGL_ARB_shader_image_load_store() const;
+		bool isGL_ARB_shader_storage_buffer_object() const;
+		bool isGL_ARB_compute_shader() const;
+		bool isGL_ARB_texture_multisample() const;
+		bool isGL_ARB_pixel_buffer_object() const;
+		bool isGL_ARB_sync() const;
+		bool isGL_ARB_copy_buffer() const;
+		bool isGL_ARB_map_buffer_range() const;
+		bool isGL_ARB_buffer_storage() const;
 		bool isGL_ARB_debug_output() const;
+		bool isGL_ARB_multi_bind() const;
+		bool isGL_ARB_bindless_texture() const;
 		// ATI
 		bool isGL_ATI_meminfo() const;
 		bool isGL_ATI_separate_stencil() const;
@@ -285,6 +353,7 @@ namespace OpenGLRenderer
 		// WGL (Windows only)
 		bool mWGL_ARB_extensions_string;
 		bool mWGL_EXT_swap_control;
+		bool mWGL_EXT_swap_control_tear;
 		bool mWGL_ARB_pixel_format;
 		bool mWGL_ARB_render_texture;
 		bool mWGL_ARB_make_current_read;
@@ -293,6 +362,8 @@ namespace OpenGLRenderer
 		bool mWGL_NV_float_buffer;
 		// GLX (Linux only)
 		bool mGLX_SGI_swap_control;
+		bool mGLX_EXT_swap_control;
+		bool mGLX_EXT_swap_control_tear;
 		// EXT
 		bool mGL_EXT_compiled_vertex_array;
 		bool mGL_EXT_draw_range_elements;
@@ -354,7 +425,20 @@ namespace OpenGLRenderer
 		bool mGL_ARB_vertex_array_object;
 		bool mGL_ARB_sampler_objects;
 		bool mGL_ARB_draw_elements_base_vertex;
+		bool mGL_ARB_draw_indirect;
+		bool mGL_ARB_multi_draw_indirect;
+		bool mGL_ARB_shader_image_load_store;
+		bool mGL_ARB_shader_storage_buffer_object;
+		bool mGL_ARB_compute_shader;
+		bool mGL_ARB_texture_multisample;
+		bool mGL_ARB_pixel_buffer_object;
+		bool mGL_ARB_sync;
+		bool mGL_ARB_copy_buffer;
+		bool mGL_ARB_map_buffer_range;
+		bool mGL_ARB_buffer_storage;
 		bool mGL_ARB_debug_output;
+		bool mGL_ARB_multi_bind;
+		bool mGL_ARB_bindless_texture;
 		// ATI
 		bool mGL_ATI_meminfo;
 		bool mGL_ATI_separate_stencil;
@@ -423,6 +507,9 @@ namespace OpenGLRenderer
 	#if defined(LINUX) && !defined(APPLE)
 		// GLX_SGI_swap_control
 		FNDEF_EX(glXSwapIntervalSGI,	PFNGLXSWAPINTERVALSGIPROC);
+
+		// GLX_EXT_swap_control
+		FNDEF_EX(glXSwapIntervalEXT,	PFNGLXSWAPINTERVALEXTPROC);
 	#endif
 
 
@@ -499,6 +586,8 @@ namespace OpenGLRenderer
 	FNDEF_EX(glProgramUniform1iEXT,					PFNGLPROGRAMUNIFORM1IEXTPROC);
 	FNDEF_EX(glTextureImage2DEXT,					PFNGLTEXTUREIMAGE2DEXTPROC);
 	FNDEF_EX(glTextureImage3DEXT,					PFNGLTEXTUREIMAGE3DEXTPROC);
+	FNDEF_EX(glTextureSubImage2DEXT,				PFNGLTEXTURESUBIMAGE2DEXTPROC);
+	FNDEF_EX(glTextureSubImage3DEXT,				PFNGLTEXTURESUBIMAGE3DEXTPROC);
 	FNDEF_EX(glTextureParameteriEXT,				PFNGLTEXTUREPARAMETERIEXTPROC);
 	FNDEF_EX(glGenerateTextureMipmapEXT,			PFNGLGENERATETEXTUREMIPMAPEXTPROC);
 	FNDEF_EX(glVertexArrayVertexAttribOffsetEXT,	PFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC);
@@ -708,9 +797,52 @@ namespace OpenGLRenderer
 	FNDEF_EX(glDrawRangeElementsBaseVertex,		PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC);
 	FNDEF_EX(glDrawElementsInstancedBaseVertex,	PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC);
 
+	// GL_ARB_draw_indirect
+	FNDEF_EX(glDrawArraysIndirect,		PFNGLDRAWARRAYSINDIRECTPROC);
+	FNDEF_EX(glDrawElementsIndirect,	PFNGLDRAWELEMENTSINDIRECTPROC);
+
+	// GL_ARB_multi_draw_indirect
+	FNDEF_EX(glMultiDrawArraysIndirect,		PFNGLMULTIDRAWARRAYSINDIRECTPROC);
+	FNDEF_EX(glMultiDrawElementsIndirect,	PFNGLMULTIDRAWELEMENTSINDIRECTPROC);
+
+	// GL_ARB_shader_image_load_store
+	FNDEF_EX(glBindImageTexture,	PFNGLBINDIMAGETEXTUREPROC);
+	FNDEF_EX(glMemoryBarrier,		PFNGLMEMORYBARRIERPROC);
+
+	// GL_ARB_compute_shader
+	FNDEF_EX(glDispatchCompute,			PFNGLDISPATCHCOMPUTEPROC);
+	FNDEF_EX(glDispatchComputeIndirect,	PFNGLDISPATCHCOMPUTEINDIRECTPROC);
+
+	// GL_ARB_texture_multisample
+	FNDEF_EX(glTexImage2DMultisample,	PFNGLTEXIMAGE2DMULTISAMPLEPROC);
+
+	// GL_ARB_sync
+	FNDEF_EX(glFenceSync,		PFNGLFENCESYNCPROC);
+	FNDEF_EX(glDeleteSync,		PFNGLDELETESYNCPROC);
+	FNDEF_EX(glClientWaitSync,	PFNGLCLIENTWAITSYNCPROC);
+
+	// GL_ARB_copy_buffer
+	FNDEF_EX(glCopyBufferSubData,	PFNGLCOPYBUFFERSUBDATAPROC);
+
+	// GL_ARB_map_buffer_range
+	FNDEF_EX(glMapBufferRange,	PFNGLMAPBUFFERRANGEPROC);
+
+	// GL_ARB_buffer_storage
+	FNDEF_EX(glBufferStorage,	PFNGLBUFFERSTORAGEPROC);
+
 	// GL_ARB_debug_output
 	FNDEF_EX(glDebugMessageCallbackARB,	PFNGLDEBUGMESSAGECALLBACKARBPROC);
 
+	// GL_ARB_multi_bind
+	FNDEF_EX(glBindTextures,	PFNGLBINDTEXTURESPROC);
+	FNDEF_EX(glBindSamplers,	PFNGLBINDSAMPLERSPROC);
+
+	// GL_ARB_bindless_texture
+	FNDEF_EX(glGetTextureHandleARB,				PFNGLGETTEXTUREHANDLEARBPROC);
+	FNDEF_EX(glGetTextureSamplerHandleARB,		PFNGLGETTEXTURESAMPLERHANDLEARBPROC);
+	FNDEF_EX(glMakeTextureHandleResidentARB,	PFNGLMAKETEXTUREHANDLERESIDENTARBPROC);
+	FNDEF_EX(glMakeTextureHandleNonResidentARB,	PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC);
+
 
 	//[-------------------------------------------------------]
 	//[ ATI                                                   ]
@@ -53,7 +53,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Cg fragment shader ("pixel shader" in Direct3D terminology) class
 	*/
-	class FragmentShaderCg : public FragmentShader
+	class FragmentShaderCg final : public FragmentShader
 	{
 
 
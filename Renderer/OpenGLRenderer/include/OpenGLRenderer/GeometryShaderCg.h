@@ -53,7 +53,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Cg geometry shader class
 	*/
-	class GeometryShaderCg : public GeometryShader
+	class GeometryShaderCg final : public GeometryShader
 	{
 
 
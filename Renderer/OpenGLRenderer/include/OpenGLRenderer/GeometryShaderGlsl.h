@@ -47,7 +47,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    GLSL geometry shader class
 	*/
-	class GeometryShaderGlsl : public GeometryShader
+	class GeometryShaderGlsl final : public GeometryShader
 	{
 
 
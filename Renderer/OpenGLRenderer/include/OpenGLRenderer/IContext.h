@@ -26,6 +26,12 @@
 #define __OPENGLRENDERER_ICONTEXT_H__
 
 
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/AllocatorObject.h>
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -49,7 +55,7 @@ namespace OpenGLRenderer
 	*  @remarks
 	*    While the OpenGL specification is platform independent, creating an OpenGL context is not.
 	*/
-	class IContext
+	class IContext : public Renderer::AllocatorObject<Renderer::AllocationTag::RENDERER>
 	{
 
 
@@ -102,9 +108,12 @@ namespace OpenGLRenderer
 	protected:
 		/**
 		*  @brief
-		*    Default constructor
+		*    Constructor
+		*
+		*  @param[in] allocator
+		*    Allocator to use, must stay valid as long as the context instance exists
 		*/
-		IContext();
+		explicit IContext(Renderer::IAllocator &allocator);
 
 		/**
 		*  @brief
@@ -85,6 +85,15 @@ namespace OpenGLRenderer
 		*/
 		inline unsigned int getOpenGLType() const;
 
+		/**
+		*  @brief
+		*    Return the number of bytes per index
+		*
+		*  @return
+		*    The number of bytes per index, used to compute the byte offset of the start index location
+		*/
+		inline unsigned int getIndexSize() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -108,6 +117,7 @@ namespace OpenGLRenderer
 	protected:
 		unsigned int mOpenGLElementArrayBuffer;	/**< OpenGL element array buffer, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim) */
 		unsigned int mOpenGLType;				/**< OpenGL element array buffer data type (type "GLenum" not used in here in order to keep the header slim) */
+		unsigned int mIndexSize;				/**< Number of bytes per index */
 
 
 	};
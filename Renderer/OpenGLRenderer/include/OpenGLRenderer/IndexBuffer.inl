@@ -46,6 +46,15 @@ namespace OpenGLRenderer
 		return mOpenGLType;
 	}
 
+	/**
+	*  @brief
+	*    Return the number of bytes per index
+	*/
+	inline unsigned int IndexBuffer::getIndexSize() const
+	{
+		return mIndexSize;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -47,7 +47,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    OpenGL index buffer object (IBO, "element array buffer" in OpenGL terminology) class, effective direct state access (DSA)
 	*/
-	class IndexBufferDsa : public IndexBuffer
+	class IndexBufferDsa final : public IndexBuffer
 	{
 
 
@@ -0,0 +1,140 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __OPENGLRENDERER_INDIRECTBUFFER_H__
+#define __OPENGLRENDERER_INDIRECTBUFFER_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/IIndirectBuffer.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace OpenGLRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Forward declarations                                  ]
+	//[-------------------------------------------------------]
+	class OpenGLRenderer;
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Abstract OpenGL indirect buffer object interface
+	*/
+	class IndirectBuffer : public Renderer::IIndirectBuffer
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~IndirectBuffer();
+
+		/**
+		*  @brief
+		*    Return the OpenGL indirect buffer
+		*
+		*  @return
+		*    The OpenGL indirect buffer, zero if the indirect buffer is emulated within system memory, do not destroy the returned resource (type "GLuint" not used in here in order to keep the header slim)
+		*/
+		inline unsigned int getOpenGLIndirectBuffer() const;
+
+		/**
+		*  @brief
+		*    Return the system memory emulation data
+		*
+		*  @return
+		*    The system memory emulation data, null pointer if there's a native OpenGL indirect buffer, do not destroy the returned data
+		*/
+		inline const unsigned char *getEmulationData() const;
+
+		/**
+		*  @brief
+		*    Return the number of bytes within the indirect buffer
+		*
+		*  @return
+		*    The number of bytes within the indirect buffer
+		*/
+		inline unsigned int getNumberOfBytes() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] openGLRenderer
+		*    Owner OpenGL renderer instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the indirect buffer
+		*/
+		IndirectBuffer(OpenGLRenderer &openGLRenderer, unsigned int numberOfBytes);
+
+
+	//[-------------------------------------------------------]
+	//[ Protected data                                        ]
+	//[-------------------------------------------------------]
+	protected:
+		unsigned int   mOpenGLIndirectBuffer;	/**< OpenGL indirect buffer, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim) */
+		unsigned char *mEmulationData;			/**< System memory emulation data, can be a null pointer */
+		unsigned int   mNumberOfBytes;			/**< Number of bytes within the indirect buffer */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // OpenGLRenderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "OpenGLRenderer/IndirectBuffer.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __OPENGLRENDERER_INDIRECTBUFFER_H__
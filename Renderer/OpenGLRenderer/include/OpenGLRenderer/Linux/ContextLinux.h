@@ -66,10 +66,12 @@ namespace OpenGLRenderer
 		*  @brief
 		*    Constructor
 		*
+		*  @param[in] allocator
+		*    Allocator to use, must stay valid as long as the context instance exists
 		*  @param[in] nativeWindowHandle
 		*    Optional native main window handle, can be a null handle
 		*/
-		explicit ContextLinux(handle nativeWindowHandle);
+		ContextLinux(Renderer::IAllocator &allocator, handle nativeWindowHandle);
 
 		/**
 		*  @brief
@@ -95,6 +97,30 @@ namespace OpenGLRenderer
 		*/
 		inline GLXContext getRenderContext() const;
 
+		/**
+		*  @brief
+		*    Return the native window handle the render context is currently bound to
+		*
+		*  @return
+		*    The native window handle the render context is currently bound to, can be a null handle
+		*/
+		inline handle getCurrentNativeWindowHandle() const;
+
+		/**
+		*  @brief
+		*    Bind the render context to the given native window
+		*
+		*  @param[in] nativeWindowHandle
+		*    Native window handle to render into, a null handle for the primary window
+		*
+		*  @remarks
+		*    There's only a single render context which is shared by all swap chains, so all of them are sharing one
+		*    resource namespace and only the drawable the render context is bound to is exchanged. "glXMakeCurrent()"
+		*    flushes the render context and might synchronize with the X server, so nothing happens in case the
+		*    render context is already bound to the given native window.
+		*/
+		void makeCurrent(handle nativeWindowHandle);
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual OpenGLRenderer::IContext methods       ]
@@ -147,12 +173,13 @@ namespace OpenGLRenderer
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		OpenGLRuntimeLinking *mOpenGLRuntimeLinking;	/**< OpenGL runtime linking instance, always valid */
-		handle				  mNativeWindowHandle;		/**< OpenGL window, can be a null pointer (HWND) */
-		handle				  mDummyWindow;				/**< OpenGL dummy window, can be a null pointer (HWND) */
-		Display				 *mDisplay;					/**< The device context of the OpenGL dummy window, can be a null pointer */
-		XVisualInfo 		 *m_pDummyVisualInfo;
-		GLXContext			  mWindowRenderContext;		/**< The render context of the OpenGL dummy window, can be a null pointer */
+		OpenGLRuntimeLinking	*mOpenGLRuntimeLinking;			/**< OpenGL runtime linking instance, always valid */
+		handle					 mNativeWindowHandle;			/**< OpenGL window, can be a null pointer (HWND) */
+		handle					 mDummyWindow;					/**< OpenGL dummy window, can be a null pointer (HWND) */
+		Display					*mDisplay;						/**< The device context of the OpenGL dummy window, can be a null pointer */
+		XVisualInfo				*m_pDummyVisualInfo;
+		GLXContext				 mWindowRenderContext;			/**< The render context of the OpenGL dummy window, can be a null pointer */
+		handle					 mCurrentNativeWindowHandle;	/**< Native window handle the render context is currently bound to, can be a null handle */
 
 
 	};
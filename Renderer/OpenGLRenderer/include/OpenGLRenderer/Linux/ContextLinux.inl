@@ -46,6 +46,15 @@ namespace OpenGLRenderer
 		return mWindowRenderContext;
 	}
 
+	/**
+	*  @brief
+	*    Return the native window handle the render context is currently bound to
+	*/
+	inline handle ContextLinux::getCurrentNativeWindowHandle() const
+	{
+		return mCurrentNativeWindowHandle;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual OpenGLRenderer::IContext methods       ]
@@ -169,6 +169,18 @@ namespace OpenGLRenderer
 		*/
 		static unsigned int getOpenGLType(Renderer::IndexBufferFormat::Enum indexBufferFormat);
 
+		/**
+		*  @brief
+		*    "Renderer::IndexBufferFormat" to number of bytes per element
+		*
+		*  @param[in] indexBufferFormat
+		*    "Renderer::IndexBufferFormat" to map
+		*
+		*  @return
+		*    Number of bytes per element
+		*/
+		static unsigned int getOpenGLSize(Renderer::IndexBufferFormat::Enum indexBufferFormat);
+
 		//[-------------------------------------------------------]
 		//[ Renderer::TextureFormat                               ]
 		//[-------------------------------------------------------]
@@ -208,6 +220,18 @@ namespace OpenGLRenderer
 		*/
 		static unsigned int getOpenGLType(Renderer::TextureFormat::Enum textureFormat);
 
+		/**
+		*  @brief
+		*    "Renderer::TextureFormat" to number of bytes per texel when using the OpenGL format and type
+		*
+		*  @param[in] textureFormat
+		*    "Renderer::TextureFormat" to map
+		*
+		*  @return
+		*    Number of bytes per texel
+		*/
+		static unsigned int getOpenGLSize(Renderer::TextureFormat::Enum textureFormat);
+
 		//[-------------------------------------------------------]
 		//[ Renderer::PrimitiveTopology                           ]
 		//[-------------------------------------------------------]
@@ -223,6 +247,21 @@ namespace OpenGLRenderer
 		*/
 		static unsigned int getOpenGLType(Renderer::PrimitiveTopology::Enum prmitive);
 
+		//[-------------------------------------------------------]
+		//[ Renderer::MapType                                     ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    "Renderer::MapType" to OpenGL buffer access
+		*
+		*  @param[in] mapType
+		*    "Renderer::MapType" to map
+		*
+		*  @return
+		*    OpenGL buffer access (type "GLenum" not used in here in order to keep the header slim)
+		*/
+		static unsigned int getOpenGLMapType(Renderer::MapType::Enum mapType);
+
 
 	};
 
@@ -30,6 +30,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <Renderer/IRenderer.h>
+#include <Renderer/ResourcePool.h>
 
 
 //[-------------------------------------------------------]
@@ -47,6 +48,7 @@ namespace OpenGLRenderer
 	class VertexArray;
 	class RasterizerState;
 	class DepthStencilState;
+	class PixelUnpackBufferPool;
 	#ifndef OPENGLRENDERER_NO_CG
 		class CgRuntimeLinking;
 	#endif
@@ -67,7 +69,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    OpenGL renderer class
 	*/
-	class OpenGLRenderer : public Renderer::IRenderer
+	class OpenGLRenderer final : public Renderer::IRenderer
 	{
 
 
@@ -81,11 +83,13 @@ namespace OpenGLRenderer
 		*
 		*  @param[in] nativeWindowHandle
 		*    Optional native main window handle, can be a null handle
+		*  @param[in] allocator
+		*    Allocator to use, can be a null pointer ("Renderer::DefaultAllocator" is used in this case), must stay valid as long as the renderer instance exists
 		*
 		*  @note
 		*    - Do never ever use a not properly initialized renderer! Use "Renderer::IRenderer::isInitialized()" to check the initialization state.
 		*/
-		explicit OpenGLRenderer(handle nativeWindowHandle);
+		OpenGLRenderer(handle nativeWindowHandle, Renderer::IAllocator *allocator);
 
 		/**
 		*  @brief
@@ -102,6 +106,33 @@ namespace OpenGLRenderer
 		*/
 		inline const IContext &getContext() const;
 
+		/**
+		*  @brief
+		*    Return the OpenGL context instance
+		*
+		*  @return
+		*    The OpenGL context instance, do not free the memory the reference is pointing to
+		*/
+		inline IContext &getContext();
+
+		/**
+		*  @brief
+		*    Return the pool of pixel unpack buffers used for asynchronous texture uploads
+		*
+		*  @return
+		*    The pool of pixel unpack buffers, can be a null pointer if "GL_ARB_pixel_buffer_object" is not supported, do not free the memory the returned pointer is pointing to
+		*/
+		inline PixelUnpackBufferPool *getPixelUnpackBufferPool() const;
+
+		/**
+		*  @brief
+		*    Return the pool for the uniform buffer instances
+		*
+		*  @return
+		*    The pool for the uniform buffer instances, used by the shader languages which are creating the uniform buffers
+		*/
+		inline Renderer::ResourcePool &getUniformBufferPool();
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IRenderer methods            ]
@@ -124,7 +155,8 @@ namespace OpenGLRenderer
 		virtual Renderer::IVertexBuffer *createVertexBuffer(unsigned int numberOfBytes, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
 		virtual Renderer::IIndexBuffer *createIndexBuffer(unsigned int numberOfBytes, Renderer::IndexBufferFormat::Enum indexBufferFormat, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
 		virtual Renderer::ITextureBuffer *createTextureBuffer(unsigned int numberOfBytes, Renderer::TextureFormat::Enum textureFormat, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
-		virtual Renderer::ITexture2D *createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, Renderer::TextureUsage::Enum textureUsage = Renderer::TextureUsage::DEFAULT) override;
+		virtual Renderer::IIndirectBuffer *createIndirectBuffer(unsigned int numberOfBytes, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
+		virtual Renderer::ITexture2D *createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, Renderer::TextureUsage::Enum textureUsage = Renderer::TextureUsage::DEFAULT, unsigned int numberOfMultisamples = 1) override;
 		virtual Renderer::ITexture2DArray *createTexture2DArray(unsigned int width, unsigned int height, unsigned int numberOfSlices, Renderer::TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, Renderer::TextureUsage::Enum textureUsage = Renderer::TextureUsage::DEFAULT) override;
 		virtual Renderer::IRasterizerState *createRasterizerState(const Renderer::RasterizerState &rasterizerState) override;
 		virtual Renderer::IDepthStencilState *createDepthStencilState(const Renderer::DepthStencilState &depthStencilState) override;
@@ -137,6 +169,8 @@ namespace OpenGLRenderer
 		//[-------------------------------------------------------]
 		virtual bool map(Renderer::IResource &resource, unsigned int subresource, Renderer::MapType::Enum mapType, unsigned int mapFlags, Renderer::MappedSubresource &mappedSubresource) override;
 		virtual void unmap(Renderer::IResource &resource, unsigned int subresource) override;
+		virtual bool copyResource(Renderer::IResource &destinationResource, Renderer::IResource &sourceResource) override;
+		virtual void setTextureResident(Renderer::ITexture &texture, Renderer::ISamplerState *samplerState, bool resident) override;
 		//[-------------------------------------------------------]
 		//[ States                                                ]
 		//[-------------------------------------------------------]
@@ -179,6 +213,12 @@ namespace OpenGLRenderer
 		virtual void gsSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection) override;
 		virtual void gsSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer) override;
 		//[-------------------------------------------------------]
+		//[ Stream-output (SO) stage                              ]
+		//[-------------------------------------------------------]
+		virtual void soSetTargets(unsigned int numberOfTargets, Renderer::IVertexBuffer **vertexBuffers, const unsigned int *offsets = nullptr) override;
+		virtual void soBegin(Renderer::PrimitiveTopology::Enum primitiveTopology, bool rasterizerDiscard = true) override;
+		virtual void soEnd() override;
+		//[-------------------------------------------------------]
 		//[ Rasterizer (RS) stage                                 ]
 		//[-------------------------------------------------------]
 		virtual void rsSetViewports(unsigned int numberOfViewports, const Renderer::Viewport *viewports) override;
@@ -200,11 +240,21 @@ namespace OpenGLRenderer
 		virtual void omSetDepthStencilState(Renderer::IDepthStencilState *depthStencilState) override;
 		virtual void omSetBlendState(Renderer::IBlendState *blendState) override;
 		//[-------------------------------------------------------]
+		//[ Compute-shader (CS) stage                             ]
+		//[-------------------------------------------------------]
+		virtual void csSetTexture(unsigned int unit, Renderer::ITexture *texture) override;
+		virtual void csSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection) override;
+		virtual void csSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState) override;
+		virtual void csSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection) override;
+		virtual void csSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer) override;
+		virtual void csSetUnorderedAccessView(unsigned int unit, Renderer::IResource *resource) override;
+		//[-------------------------------------------------------]
 		//[ Operations                                            ]
 		//[-------------------------------------------------------]
 		virtual void clear(unsigned int flags, const float color[4], float z, unsigned int stencil) override;
 		virtual bool beginScene() override;
 		virtual void endScene() override;
+		virtual void resolveMultisampleFramebuffer(Renderer::IRenderTarget &destinationRenderTarget, Renderer::IFramebuffer &sourceMultisampleFramebuffer) override;
 		//[-------------------------------------------------------]
 		//[ Draw call                                             ]
 		//[-------------------------------------------------------]
@@ -212,12 +262,26 @@ namespace OpenGLRenderer
 		virtual void drawInstanced(unsigned int startVertexLocation, unsigned int numberOfVertices, unsigned int numberOfInstances) override;
 		virtual void drawIndexed(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int minimumIndex, unsigned int numberOfVertices) override;
 		virtual void drawIndexedInstanced(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int minimumIndex, unsigned int numberOfVertices, unsigned int numberOfInstances) override;
+		virtual void multiDrawIndexedIndirect(Renderer::IIndirectBuffer &indirectBuffer, unsigned int indirectBufferOffset = 0, unsigned int numberOfDraws = 1) override;
+		virtual void drawAuto() override;
+		//[-------------------------------------------------------]
+		//[ Compute                                               ]
+		//[-------------------------------------------------------]
+		virtual void dispatch(unsigned int groupCountX, unsigned int groupCountY, unsigned int groupCountZ) override;
+		virtual void memoryBarrier(unsigned int flags) override;
 		//[-------------------------------------------------------]
 		//[ Synchronization                                       ]
 		//[-------------------------------------------------------]
+		virtual Renderer::IFence *insertFence() override;
+		virtual bool isFenceSignaled(Renderer::IFence &fence) override;
+		virtual bool waitFence(Renderer::IFence &fence, unsigned int timeout = ~0u) override;
 		virtual void flush() override;
 		virtual void finish() override;
 		//[-------------------------------------------------------]
+		//[ Swap chain                                            ]
+		//[-------------------------------------------------------]
+		virtual void presentSwapChains(unsigned int numberOfSwapChains, Renderer::ISwapChain **swapChains) override;
+		//[-------------------------------------------------------]
 		//[ Debug                                                 ]
 		//[-------------------------------------------------------]
 		virtual bool isDebugEnabled() override;
@@ -242,6 +306,56 @@ namespace OpenGLRenderer
 		*/
 		void iaUnsetVertexArray();
 
+		/**
+		*  @brief
+		*    Map an OpenGL buffer
+		*
+		*  @param[in]  openGLTarget
+		*    OpenGL buffer target the OpenGL buffer is temporarily bound to (type "GLenum" not used in here in order to keep the header slim)
+		*  @param[in]  openGLBuffer
+		*    OpenGL buffer to map, can be zero (type "GLuint" not used in here in order to keep the header slim)
+		*  @param[in]  mapType
+		*    Map type
+		*  @param[in]  rowPitch
+		*    Row pitch to write into the mapped subresource
+		*  @param[in]  depthPitch
+		*    Depth pitch to write into the mapped subresource
+		*  @param[out] mappedSubresource
+		*    Receives the mapped subresource information
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*/
+		bool mapOpenGLBuffer(unsigned int openGLTarget, unsigned int openGLBuffer, Renderer::MapType::Enum mapType, unsigned int rowPitch, unsigned int depthPitch, Renderer::MappedSubresource &mappedSubresource);
+
+		/**
+		*  @brief
+		*    Unmap an OpenGL buffer
+		*
+		*  @param[in] openGLTarget
+		*    OpenGL buffer target the OpenGL buffer is temporarily bound to (type "GLenum" not used in here in order to keep the header slim)
+		*  @param[in] openGLBuffer
+		*    OpenGL buffer to unmap, can be zero (type "GLuint" not used in here in order to keep the header slim)
+		*/
+		void unmapOpenGLBuffer(unsigned int openGLTarget, unsigned int openGLBuffer);
+
+		/**
+		*  @brief
+		*    Copy the content of an OpenGL buffer into another OpenGL buffer
+		*
+		*  @param[in] destinationOpenGLBuffer
+		*    Destination OpenGL buffer (type "GLuint" not used in here in order to keep the header slim)
+		*  @param[in] sourceOpenGLBuffer
+		*    Source OpenGL buffer (type "GLuint" not used in here in order to keep the header slim)
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*
+		*  @note
+		*    - "GL_ARB_copy_buffer" required
+		*/
+		bool copyOpenGLBuffer(unsigned int destinationOpenGLBuffer, unsigned int sourceOpenGLBuffer);
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -254,12 +368,20 @@ namespace OpenGLRenderer
 			Renderer::IShaderLanguage *mShaderLanguageCg;		/**< Cg shader language instance (we keep a reference to it), can be a null pointer */
 		#endif
 		Renderer::ISamplerState		  *mDefaultSamplerState;	/**< Default rasterizer state (we keep a reference to it), can be a null pointer */
+		PixelUnpackBufferPool		  *mPixelUnpackBufferPool;	/**< Pool of pixel unpack buffers used for asynchronous texture uploads, can be a null pointer */
 		//[-------------------------------------------------------]
 		//[ Input-assembler (IA) stage                            ]
 		//[-------------------------------------------------------]
 		VertexArray	 *mVertexArray;				/**< Currently set vertex array (we keep a reference to it), can be a null pointer */
 		unsigned int  mOpenGLPrimitiveTopology;	/**< OpenGL primitive topology describing the type of primitive to render (type "GLenum" not used in here in order to keep the header slim) */
 		//[-------------------------------------------------------]
+		//[ Stream-output (SO) stage                              ]
+		//[-------------------------------------------------------]
+		unsigned int mNumberOfStreamOutputTargets;				/**< Number of currently set stream output targets */
+		unsigned int mOpenGLStreamOutputQuery;					/**< OpenGL query counting the primitives written by the last stream output, created on first use, can be zero (type "GLuint" not used in here in order to keep the header slim) */
+		unsigned int mNumberOfStreamOutputVerticesPerPrimitive;	/**< Number of vertices per primitive written by the last stream output, 0 if there was no stream output, yet */
+		bool		 mStreamOutputRasterizerDiscard;				/**< Is the rasterizer discard of the currently active stream output enabled? */
+		//[-------------------------------------------------------]
 		//[ Rasterizer (RS) stage                                 ]
 		//[-------------------------------------------------------]
 		Renderer::IRasterizerState *mDefaultRasterizerState;	/**< Default rasterizer state (we keep a reference to it), can be a null pointer */
@@ -277,6 +399,22 @@ namespace OpenGLRenderer
 		//[ States                                                ]
 		//[-------------------------------------------------------]
 		unsigned int mOpenGLProgram;	/**< Currently set OpenGL program, can be zero if no resource is set (type "GLuint" not used in here in order to keep the header slim) */
+		//[-------------------------------------------------------]
+		//[ Resource pools                                        ]
+		//[-------------------------------------------------------]
+		Renderer::ResourcePool mVertexBufferPool;			/**< Pool for the vertex buffer instances */
+		Renderer::ResourcePool mIndexBufferPool;			/**< Pool for the index buffer instances */
+		Renderer::ResourcePool mTextureBufferPool;			/**< Pool for the texture buffer instances */
+		Renderer::ResourcePool mIndirectBufferPool;			/**< Pool for the indirect buffer instances */
+		Renderer::ResourcePool mTexture2DPool;				/**< Pool for the 2D texture instances */
+		Renderer::ResourcePool mTexture2DArrayPool;			/**< Pool for the 2D array texture instances */
+		Renderer::ResourcePool mRasterizerStatePool;		/**< Pool for the rasterizer state instances */
+		Renderer::ResourcePool mDepthStencilStatePool;		/**< Pool for the depth stencil state instances */
+		Renderer::ResourcePool mBlendStatePool;				/**< Pool for the blend state instances */
+		Renderer::ResourcePool mSamplerStatePool;			/**< Pool for the sampler state instances */
+		Renderer::ResourcePool mTextureCollectionPool;		/**< Pool for the texture collection instances */
+		Renderer::ResourcePool mSamplerStateCollectionPool;	/**< Pool for the sampler state collection instances */
+		Renderer::ResourcePool mUniformBufferPool;			/**< Pool for the uniform buffer instances */
 
 
 	};
@@ -37,6 +37,33 @@ namespace OpenGLRenderer
 		return *mContext;
 	}
 
+	/**
+	*  @brief
+	*    Return the OpenGL context instance
+	*/
+	inline IContext &OpenGLRenderer::getContext()
+	{
+		return *mContext;
+	}
+
+	/**
+	*  @brief
+	*    Return the pool of pixel unpack buffers used for asynchronous texture uploads
+	*/
+	inline PixelUnpackBufferPool *OpenGLRenderer::getPixelUnpackBufferPool() const
+	{
+		return mPixelUnpackBufferPool;
+	}
+
+	/**
+	*  @brief
+	*    Return the pool for the uniform buffer instances
+	*/
+	inline Renderer::ResourcePool &OpenGLRenderer::getUniformBufferPool()
+	{
+		return mUniformBufferPool;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -29,6 +29,8 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <Renderer/AllocatorObject.h>
+
 #ifdef WIN32
 	// Disable warnings in external headers, we can't fix them
 	__pragma(warning(push))
@@ -58,7 +60,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    OpenGL runtime linking
 	*/
-	class OpenGLRuntimeLinking
+	class OpenGLRuntimeLinking : public Renderer::AllocatorObject<Renderer::AllocationTag::RENDERER>
 	{
 
 
@@ -151,7 +153,11 @@ namespace OpenGLRenderer
 	FNDEF_GL(void,		glGenTextures,		(GLsizei, GLuint *));
 	FNDEF_GL(void,		glDeleteTextures,	(GLsizei, const GLuint *));
 	FNDEF_GL(void,		glTexImage2D,		(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const GLvoid *));
+	FNDEF_GL(void,		glTexSubImage2D,	(GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const GLvoid *));
+	FNDEF_GL(void,		glGetTexImage,		(GLenum, GLint, GLenum, GLenum, GLvoid *));
 	FNDEF_GL(void,		glPixelStorei,		(GLenum, GLint));
+	FNDEF_GL(void,		glReadBuffer,		(GLenum));
+	FNDEF_GL(void,		glDrawBuffer,		(GLenum));
 	FNDEF_GL(void,		glDepthMask,		(GLboolean));
 	FNDEF_GL(void,		glViewport,			(GLint, GLint, GLsizei, GLsizei));
 	FNDEF_GL(void,		glDepthRange,		(GLclampd, GLclampd));
@@ -216,7 +222,11 @@ namespace OpenGLRenderer
 	#define glGenTextures		FNPTR(glGenTextures)
 	#define glDeleteTextures	FNPTR(glDeleteTextures)
 	#define glTexImage2D		FNPTR(glTexImage2D)
+	#define glTexSubImage2D		FNPTR(glTexSubImage2D)
+	#define glGetTexImage		FNPTR(glGetTexImage)
 	#define glPixelStorei		FNPTR(glPixelStorei)
+	#define glReadBuffer		FNPTR(glReadBuffer)
+	#define glDrawBuffer		FNPTR(glDrawBuffer)
 	#define glDepthMask			FNPTR(glDepthMask)
 	#define glViewport			FNPTR(glViewport)
 	#define glDepthRange		FNPTR(glDepthRange)
@@ -0,0 +1,194 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __OPENGLRENDERER_PIXELUNPACKBUFFERPOOL_H__
+#define __OPENGLRENDERER_PIXELUNPACKBUFFERPOOL_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/AllocatorObject.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace OpenGLRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Forward declarations                                  ]
+	//[-------------------------------------------------------]
+	class OpenGLRenderer;
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Pool of OpenGL pixel unpack buffers used for asynchronous texture uploads
+	*
+	*  @remarks
+	*    Texture data is copied into upload memory owned by a pixel unpack buffer and the texture upload
+	*    function is called with an offset into this buffer instead of a client memory pointer. The driver
+	*    is then free to return at once and to let the GPU transfer the data asynchronously.
+	*
+	*    The buffers are used in a round-robin fashion. When "GL_ARB_buffer_storage", "GL_ARB_map_buffer_range"
+	*    and "GL_ARB_sync" are available, the buffers are persistently mapped and a fence protects each buffer
+	*    against being overwritten while the GPU still reads from it. Else, the buffer storage is orphaned and
+	*    mapped for each upload.
+	*
+	*  @note
+	*    - "GL_ARB_pixel_buffer_object" required
+	*/
+	class PixelUnpackBufferPool : public Renderer::AllocatorObject<Renderer::AllocationTag::RENDERER>
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const unsigned int NUMBER_OF_BUFFERS		  = 4;					/**< Number of pixel unpack buffers within the pool */
+		static const unsigned int MAXIMUM_NUMBER_OF_BYTES = 64 * 1024 * 1024;	/**< Maximum number of bytes of a single upload, larger uploads are not performed through the pool */
+		static const unsigned int STORAGE_GRANULARITY	  = 256 * 1024;			/**< Buffer storage sizes are rounded up to a multiple of this number of bytes in order to reduce the number of reallocations */
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] openGLRenderer
+		*    Owner OpenGL renderer instance
+		*/
+		explicit PixelUnpackBufferPool(OpenGLRenderer &openGLRenderer);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		~PixelUnpackBufferPool();
+
+		/**
+		*  @brief
+		*    Begin an upload by copying the given data into a pixel unpack buffer
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to upload
+		*  @param[in] data
+		*    Data to upload, must be valid
+		*
+		*  @return
+		*    "true" if all went fine and the used pixel unpack buffer is bound to "GL_PIXEL_UNPACK_BUFFER_ARB", else "false"
+		*
+		*  @note
+		*    - On success, call the texture upload function with a null pointer as data (= offset zero inside the bound pixel
+		*      unpack buffer) and call "endUpload()" right after it
+		*    - On failure, upload directly from the given data
+		*/
+		bool beginUpload(unsigned int numberOfBytes, const void *data);
+
+		/**
+		*  @brief
+		*    End an upload which was successfully started by "beginUpload()"
+		*/
+		void endUpload();
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Pixel unpack buffer of the pool
+		*/
+		struct Buffer
+		{
+			unsigned int  openGLPixelUnpackBuffer;	/**< OpenGL pixel unpack buffer, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim) */
+			unsigned int  numberOfBytes;			/**< Number of bytes of the buffer storage */
+			void		 *mappedData;				/**< Persistently mapped buffer storage, can be a null pointer */
+			void		 *openGLSync;				/**< OpenGL sync object signaled as soon as the GPU is done reading the buffer, can be a null pointer (type "GLsync" not used in here in order to keep the header slim) */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		explicit PixelUnpackBufferPool(const PixelUnpackBufferPool &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		PixelUnpackBufferPool &operator =(const PixelUnpackBufferPool &source);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		bool		 mPersistentMapping;					/**< Are the pixel unpack buffers persistently mapped? */
+		Buffer		 mBuffers[NUMBER_OF_BUFFERS];			/**< Pixel unpack buffers */
+		unsigned int mCurrentBuffer;						/**< Index of the pixel unpack buffer used by the current or last upload */
+		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+			int		 mOpenGLPixelUnpackBufferBackup;		/**< OpenGL pixel unpack buffer which was bound before the current upload (type "GLint" not used in here in order to keep the header slim) */
+		#endif
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // OpenGLRenderer
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __OPENGLRENDERER_PIXELUNPACKBUFFERPOOL_H__
@@ -60,7 +60,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Cg program class
 	*/
-	class ProgramCg : public Program
+	class ProgramCg final : public Program
 	{
 
 
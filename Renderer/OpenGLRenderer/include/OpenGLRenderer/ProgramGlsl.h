@@ -43,6 +43,7 @@ namespace OpenGLRenderer
 	//[ Forward declarations                                  ]
 	//[-------------------------------------------------------]
 	class VertexShaderGlsl;
+	class ComputeShaderGlsl;
 	class GeometryShaderGlsl;
 	class FragmentShaderGlsl;
 	class TessellationControlShaderGlsl;
@@ -86,6 +87,20 @@ namespace OpenGLRenderer
 		*/
 		ProgramGlsl(OpenGLRenderer &openGLRenderer, VertexShaderGlsl *vertexShaderGlsl, TessellationControlShaderGlsl *tessellationControlShaderGlsl, TessellationEvaluationShaderGlsl *tessellationEvaluationShaderGlsl, GeometryShaderGlsl *geometryShaderGlsl, FragmentShaderGlsl *fragmentShaderGlsl);
 
+		/**
+		*  @brief
+		*    Compute program constructor
+		*
+		*  @param[in] openGLRenderer
+		*    Owner OpenGL renderer instance
+		*  @param[in] computeShaderGlsl
+		*    Compute shader the program is using
+		*
+		*  @note
+		*    - The program keeps a reference to the provided shader and releases it when no longer required
+		*/
+		ProgramGlsl(OpenGLRenderer &openGLRenderer, ComputeShaderGlsl &computeShaderGlsl);
+
 		/**
 		*  @brief
 		*    Destructor
@@ -107,6 +122,7 @@ namespace OpenGLRenderer
 	//[-------------------------------------------------------]
 	public:
 		virtual Renderer::IVertexArray *createVertexArray(unsigned int numberOfAttributes, const Renderer::VertexArrayAttribute *attributes, Renderer::IIndexBuffer *indexBuffer = nullptr) override;
+		virtual bool setStreamOutputVaryings(unsigned int numberOfVaryings, const char **varyingNames, bool interleaved = true) override;
 		virtual int getAttributeLocation(const char *attributeName) override;
 		virtual unsigned int getUniformBlockIndex(const char *uniformBlockName, unsigned int defaultIndex) override;
 		virtual handle getUniformHandle(const char *uniformName) override;
@@ -120,6 +136,20 @@ namespace OpenGLRenderer
 		virtual void setUniformMatrix4fv(handle uniformHandle, const float *value) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Link the OpenGL program and output the information log on failure
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*/
+		bool linkProgram();
+
+
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
@@ -46,7 +46,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    GLSL program class, effective direct state access (DSA)
 	*/
-	class ProgramGlslDsa : public ProgramGlsl
+	class ProgramGlslDsa final : public ProgramGlsl
 	{
 
 
@@ -76,6 +76,20 @@ namespace OpenGLRenderer
 		*/
 		ProgramGlslDsa(OpenGLRenderer &openGLRenderer, VertexShaderGlsl *vertexShaderGlsl, TessellationControlShaderGlsl *tessellationControlShaderGlsl, TessellationEvaluationShaderGlsl *tessellationEvaluationShaderGlsl, GeometryShaderGlsl *geometryShaderGlsl, FragmentShaderGlsl *fragmentShaderGlsl);
 
+		/**
+		*  @brief
+		*    Compute program constructor
+		*
+		*  @param[in] openGLRenderer
+		*    Owner OpenGL renderer instance
+		*  @param[in] computeShaderGlsl
+		*    Compute shader the program is using
+		*
+		*  @note
+		*    - The program keeps a reference to the provided shader and releases it when no longer required
+		*/
+		ProgramGlslDsa(OpenGLRenderer &openGLRenderer, ComputeShaderGlsl &computeShaderGlsl);
+
 		/**
 		*  @brief
 		*    Destructor
@@ -53,7 +53,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    OpenGL rasterizer state class
 	*/
-	class RasterizerState : public Renderer::IRasterizerState
+	class RasterizerState final : public Renderer::IRasterizerState
 	{
 
 
@@ -46,7 +46,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    OpenGL sampler state class, traditional bind version to emulate a sampler object
 	*/
-	class SamplerStateBind : public SamplerState
+	class SamplerStateBind final : public SamplerState
 	{
 
 
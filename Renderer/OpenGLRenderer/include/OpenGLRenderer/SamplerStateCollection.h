@@ -59,7 +59,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    OpenGL sampler state collection class
 	*/
-	class SamplerStateCollection : public Renderer::ISamplerStateCollection
+	class SamplerStateCollection final : public Renderer::ISamplerStateCollection
 	{
 
 
@@ -108,6 +108,19 @@ namespace OpenGLRenderer
 		*/
 		inline Renderer::ISamplerState **getSamplerStates() const;
 
+		/**
+		*  @brief
+		*    Return the OpenGL samplers
+		*
+		*  @return
+		*    The OpenGL samplers resolved at creation time (0 for no sampler state), there are "getNumberOfSamplerStates()" entries,
+		*    null pointer if "GL_ARB_sampler_objects" isn't available or if there are no sampler states
+		*
+		*  @remarks
+		*    Ready to be passed to "glBindSamplers()" ("GL_ARB_multi_bind")
+		*/
+		inline const unsigned int *getOpenGLSamplers() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -115,6 +128,7 @@ namespace OpenGLRenderer
 	private:
 		unsigned int			  mNumberOfSamplerStates;	/**< The number of sampler state instances */
 		Renderer::ISamplerState **mSamplerStates;			/**< Sampler state instances (we keep a reference to it), can be a null pointer */
+		unsigned int			 *mOpenGLSamplers;			/**< OpenGL samplers, there are "mNumberOfSamplerStates" entries, can be a null pointer */
 
 
 	};
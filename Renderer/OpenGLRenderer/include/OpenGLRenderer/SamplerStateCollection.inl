@@ -46,6 +46,15 @@ namespace OpenGLRenderer
 		return mSamplerStates;
 	}
 
+	/**
+	*  @brief
+	*    Return the OpenGL samplers
+	*/
+	inline const unsigned int *SamplerStateCollection::getOpenGLSamplers() const
+	{
+		return mOpenGLSamplers;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
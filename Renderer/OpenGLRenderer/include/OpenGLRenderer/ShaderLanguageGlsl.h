@@ -38,6 +38,16 @@
 	#endif
 #endif
 
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class IAllocator;
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -52,7 +62,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    GLSL shader language class
 	*/
-	class ShaderLanguageGlsl : public ShaderLanguage
+	class ShaderLanguageGlsl final : public ShaderLanguage
 	{
 
 
@@ -71,6 +81,8 @@ namespace OpenGLRenderer
 		*  @brief
 		*    Creates, loads and compiles a shader
 		*
+		*  @param[in] allocator
+		*    Allocator to use for temporary data
 		*  @param[in] shaderType
 		*    Shader type (for example "GL_VERTEX_SHADER_ARB", type GLenum not used in here in order to keep the header slim)
 		*  @param[in] shaderSource
@@ -79,7 +91,7 @@ namespace OpenGLRenderer
 		*  @return
 		*    The OpenGL shader, 0 on error, destroy the resource if you no longer need it (type "GLuint" not used in here in order to keep the header slim)
 		*/
-		static unsigned int loadShader(unsigned int shaderType, const char *shaderSource);
+		static unsigned int loadShader(Renderer::IAllocator &allocator, unsigned int shaderType, const char *shaderSource);
 
 
 	//[-------------------------------------------------------]
@@ -113,6 +125,8 @@ namespace OpenGLRenderer
 		virtual Renderer::IGeometryShader *createGeometryShader(const char *sourceCode, Renderer::GsInputPrimitiveTopology::Enum gsInputPrimitiveTopology, Renderer::GsOutputPrimitiveTopology::Enum gsOutputPrimitiveTopology, unsigned int numberOfOutputVertices, const char *profile = nullptr, const char *arguments = nullptr, const char *entry = nullptr) override;
 		virtual Renderer::IFragmentShader *createFragmentShader(const char *sourceCode, const char *profile = nullptr, const char *arguments = nullptr, const char *entry = nullptr) override;
 		virtual Renderer::IProgram *createProgram(Renderer::IVertexShader *vertexShader, Renderer::ITessellationControlShader *tessellationControlShader, Renderer::ITessellationEvaluationShader *tessellationEvaluationShader, Renderer::IGeometryShader *geometryShader, Renderer::IFragmentShader *fragmentShader) override;
+		virtual Renderer::IComputeShader *createComputeShader(const char *sourceCode, const char *profile = nullptr, const char *arguments = nullptr, const char *entry = nullptr) override;
+		virtual Renderer::IProgram *createComputeProgram(Renderer::IComputeShader *computeShader) override;
 		virtual Renderer::IUniformBuffer *createUniformBuffer(unsigned int numberOfBytes, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
 
 
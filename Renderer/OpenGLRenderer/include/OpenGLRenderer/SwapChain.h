@@ -30,6 +30,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <Renderer/ISwapChain.h>
+#include <Renderer/FramePacer.h>
 
 
 //[-------------------------------------------------------]
@@ -55,7 +56,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    OpenGL swap chain class
 	*/
-	class SwapChain : public Renderer::ISwapChain
+	class SwapChain final : public Renderer::ISwapChain
 	{
 
 
@@ -80,6 +81,15 @@ namespace OpenGLRenderer
 		*/
 		virtual ~SwapChain();
 
+		/**
+		*  @brief
+		*    Bind the render context shared by all swap chains to the native window of this swap chain
+		*
+		*  @note
+		*    - Nothing happens in case the render context is already bound to the native window of this swap chain
+		*/
+		void makeCurrent();
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IRenderTarget methods        ]
@@ -97,13 +107,23 @@ namespace OpenGLRenderer
 		virtual void resizeBuffers() override;
 		virtual bool getFullscreenState() const override;
 		virtual void setFullscreenState(bool fullscreen) override;
+		virtual int getSwapInterval() const override;
+		virtual bool setSwapInterval(int swapInterval) override;
+		virtual unsigned int getMaximumFrameLatency() const override;
+		virtual void setMaximumFrameLatency(unsigned int maximumFrameLatency) override;
+		virtual const Renderer::PresentStatistics &getPresentStatistics() const override;
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		handle mNativeWindowHandle;	/**< Native window handle window, can be a null handle */
+		handle					 mNativeWindowHandle;	/**< Native window handle window, can be a null handle */
+		#ifdef WIN32
+		handle					 mDeviceContext;		/**< Device context of the native window (HDC), can be a null handle */
+		#endif
+		int						 mSwapInterval;			/**< Swap interval, see "Renderer::ISwapChain::setSwapInterval()" */
+		Renderer::FramePacer	 mFramePacer;			/**< Frame pacer enforcing the maximum frame latency and recording the present intervals */
 
 
 	};
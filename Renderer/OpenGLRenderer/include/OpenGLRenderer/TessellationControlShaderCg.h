@@ -53,7 +53,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Cg tessellation control shader ("hull shader" in Direct3D terminology) class
 	*/
-	class TessellationControlShaderCg : public TessellationControlShader
+	class TessellationControlShaderCg final : public TessellationControlShader
 	{
 
 
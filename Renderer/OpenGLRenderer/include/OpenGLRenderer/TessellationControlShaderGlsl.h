@@ -46,7 +46,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    GLSL tessellation control shader ("hull shader" in Direct3D terminology) class
 	*/
-	class TessellationControlShaderGlsl : public TessellationControlShader
+	class TessellationControlShaderGlsl final : public TessellationControlShader
 	{
 
 
@@ -53,7 +53,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Cg tessellation evaluation shader ("domain shader" in Direct3D terminology) class
 	*/
-	class TessellationEvaluationShaderCg : public TessellationEvaluationShader
+	class TessellationEvaluationShaderCg final : public TessellationEvaluationShader
 	{
 
 
@@ -46,7 +46,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    GLSL tessellation evaluation shader ("domain shader" in Direct3D terminology) class
 	*/
-	class TessellationEvaluationShaderGlsl : public TessellationEvaluationShader
+	class TessellationEvaluationShaderGlsl final : public TessellationEvaluationShader
 	{
 
 
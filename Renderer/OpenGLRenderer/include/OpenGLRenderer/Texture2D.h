@@ -30,6 +30,9 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <Renderer/ITexture2D.h>
+#include <Renderer/TextureTypes.h>
+
+#include "OpenGLRenderer/BindlessTextureHandles.h"
 
 
 //[-------------------------------------------------------]
@@ -75,6 +78,83 @@ namespace OpenGLRenderer
 		*/
 		inline unsigned int getOpenGLTexture() const;
 
+		/**
+		*  @brief
+		*    Return the OpenGL internal texture format
+		*
+		*  @return
+		*    The OpenGL internal texture format, required e.g. when binding the texture as image for unordered access (type "GLenum" not used in here in order to keep the header slim)
+		*/
+		inline unsigned int getOpenGLInternalFormat() const;
+
+		/**
+		*  @brief
+		*    Return the number of multisamples per texel
+		*
+		*  @return
+		*    The number of multisamples per texel, 1 for a regular texture
+		*/
+		inline unsigned int getNumberOfMultisamples() const;
+
+		/**
+		*  @brief
+		*    Return the OpenGL texture target
+		*
+		*  @return
+		*    The OpenGL texture target, "GL_TEXTURE_2D" or "GL_TEXTURE_2D_MULTISAMPLE" (type "GLenum" not used in here in order to keep the header slim)
+		*/
+		inline unsigned int getOpenGLTextureTarget() const;
+
+		/**
+		*  @brief
+		*    Return the texture format
+		*
+		*  @return
+		*    The texture format
+		*/
+		inline Renderer::TextureFormat::Enum getTextureFormat() const;
+
+		/**
+		*  @brief
+		*    Return the OpenGL pixel pack buffer used for asynchronous GPU to CPU readback
+		*
+		*  @return
+		*    The OpenGL pixel pack buffer, zero if this texture was never used as copy destination, do not destroy the returned resource (type "GLuint" not used in here in order to keep the header slim)
+		*/
+		inline unsigned int getOpenGLPixelPackBuffer() const;
+
+		/**
+		*  @brief
+		*    Copy the content of a given 2D texture into the pixel pack buffer of this 2D texture (asynchronous GPU to CPU readback)
+		*
+		*  @param[in] sourceTexture2D
+		*    Source 2D texture, must have the same size and format as this 2D texture and must not be a multisample texture
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*
+		*  @note
+		*    - "GL_ARB_pixel_buffer_object" required
+		*    - The pixel pack buffer is created on first use, map this 2D texture in order to read back the copied content
+		*/
+		bool copyFromTexture2D(const Texture2D &sourceTexture2D);
+
+		/**
+		*  @brief
+		*    Return the bindless texture handles of the OpenGL texture
+		*
+		*  @return
+		*    The bindless texture handles of the OpenGL texture
+		*/
+		inline BindlessTextureHandles &getBindlessTextureHandles();
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture methods             ]
+	//[-------------------------------------------------------]
+	public:
+		virtual unsigned long long getBindlessHandle(Renderer::ISamplerState *samplerState) override;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -90,15 +170,25 @@ namespace OpenGLRenderer
 		*    The width of the texture
 		*  @param[in] height
 		*    The height of the texture
+		*  @param[in] textureFormat
+		*    Texture format
+		*  @param[in] numberOfMultisamples
+		*    Number of multisamples per texel, 1 for a regular texture
 		*/
-		Texture2D(OpenGLRenderer &openGLRenderer, unsigned int width, unsigned int height);
+		Texture2D(OpenGLRenderer &openGLRenderer, unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, unsigned int numberOfMultisamples = 1);
 
 
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		unsigned int mOpenGLTexture;	/**< OpenGL texture, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim) */
+		unsigned int mOpenGLTexture;			/**< OpenGL texture, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim) */
+		unsigned int mOpenGLInternalFormat;		/**< OpenGL internal texture format (type "GLenum" not used in here in order to keep the header slim) */
+		unsigned int mNumberOfMultisamples;		/**< Number of multisamples per texel, 1 for a regular texture */
+		unsigned int mOpenGLTextureTarget;		/**< OpenGL texture target, "GL_TEXTURE_2D" or "GL_TEXTURE_2D_MULTISAMPLE" (type "GLenum" not used in here in order to keep the header slim) */
+		Renderer::TextureFormat::Enum mTextureFormat;	/**< Texture format */
+		unsigned int mOpenGLPixelPackBuffer;	/**< OpenGL pixel pack buffer for asynchronous GPU to CPU readback, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim) */
+		BindlessTextureHandles mBindlessTextureHandles;	/**< Bindless texture handles of the OpenGL texture */
 
 
 	};
@@ -37,6 +37,60 @@ namespace OpenGLRenderer
 		return mOpenGLTexture;
 	}
 
+	/**
+	*  @brief
+	*    Return the OpenGL internal texture format
+	*/
+	inline unsigned int Texture2D::getOpenGLInternalFormat() const
+	{
+		return mOpenGLInternalFormat;
+	}
+
+	/**
+	*  @brief
+	*    Return the number of multisamples per texel
+	*/
+	inline unsigned int Texture2D::getNumberOfMultisamples() const
+	{
+		return mNumberOfMultisamples;
+	}
+
+	/**
+	*  @brief
+	*    Return the OpenGL texture target
+	*/
+	inline unsigned int Texture2D::getOpenGLTextureTarget() const
+	{
+		return mOpenGLTextureTarget;
+	}
+
+	/**
+	*  @brief
+	*    Return the texture format
+	*/
+	inline Renderer::TextureFormat::Enum Texture2D::getTextureFormat() const
+	{
+		return mTextureFormat;
+	}
+
+	/**
+	*  @brief
+	*    Return the OpenGL pixel pack buffer used for asynchronous GPU to CPU readback
+	*/
+	inline unsigned int Texture2D::getOpenGLPixelPackBuffer() const
+	{
+		return mOpenGLPixelPackBuffer;
+	}
+
+	/**
+	*  @brief
+	*    Return the bindless texture handles of the OpenGL texture
+	*/
+	inline BindlessTextureHandles &Texture2D::getBindlessTextureHandles()
+	{
+		return mBindlessTextureHandles;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -30,6 +30,9 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <Renderer/ITexture2DArray.h>
+#include <Renderer/TextureTypes.h>
+
+#include "OpenGLRenderer/BindlessTextureHandles.h"
 
 
 //[-------------------------------------------------------]
@@ -75,6 +78,22 @@ namespace OpenGLRenderer
 		*/
 		inline unsigned int getOpenGLTexture() const;
 
+		/**
+		*  @brief
+		*    Return the bindless texture handles of the OpenGL texture
+		*
+		*  @return
+		*    The bindless texture handles of the OpenGL texture
+		*/
+		inline BindlessTextureHandles &getBindlessTextureHandles();
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture methods             ]
+	//[-------------------------------------------------------]
+	public:
+		virtual unsigned long long getBindlessHandle(Renderer::ISamplerState *samplerState) override;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -92,15 +111,19 @@ namespace OpenGLRenderer
 		*    The height of the texture
 		*  @param[in] numberOfSlices
 		*    The number of slices
+		*  @param[in] textureFormat
+		*    Texture format
 		*/
-		Texture2DArray(OpenGLRenderer &openGLRenderer, unsigned int width, unsigned int height, unsigned int numberOfSlices);
+		Texture2DArray(OpenGLRenderer &openGLRenderer, unsigned int width, unsigned int height, unsigned int numberOfSlices, Renderer::TextureFormat::Enum textureFormat);
 
 
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		unsigned int mOpenGLTexture;	/**< OpenGL texture, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim) */
+		unsigned int				  mOpenGLTexture;	/**< OpenGL texture, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim) */
+		Renderer::TextureFormat::Enum mTextureFormat;	/**< Texture format */
+		BindlessTextureHandles		  mBindlessTextureHandles;	/**< Bindless texture handles of the OpenGL texture */
 
 
 	};
@@ -37,6 +37,15 @@ namespace OpenGLRenderer
 		return mOpenGLTexture;
 	}
 
+	/**
+	*  @brief
+	*    Return the bindless texture handles of the OpenGL texture
+	*/
+	inline BindlessTextureHandles &Texture2DArray::getBindlessTextureHandles()
+	{
+		return mBindlessTextureHandles;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
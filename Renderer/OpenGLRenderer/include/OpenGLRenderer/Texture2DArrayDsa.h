@@ -46,7 +46,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    OpenGL 2D array texture class, effective direct state access (DSA)
 	*/
-	class Texture2DArrayDsa : public Texture2DArray
+	class Texture2DArrayDsa final : public Texture2DArray
 	{
 
 
@@ -82,6 +82,13 @@ namespace OpenGLRenderer
 		virtual ~Texture2DArrayDsa();
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2DArray methods      ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void updateRegion(unsigned int mipmap, unsigned int slice, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data) override;
+
+
 	};
 
 
@@ -46,7 +46,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    OpenGL 2D texture class, traditional bind version
 	*/
-	class Texture2DBind : public Texture2D
+	class Texture2DBind final : public Texture2D
 	{
 
 
@@ -70,8 +70,10 @@ namespace OpenGLRenderer
 		*    Texture data, can be a null pointer
 		*  @param[in] flags
 		*    Texture flags, see "Renderer::TextureFlag::Enum"
+		*  @param[in] numberOfMultisamples
+		*    Number of multisamples per texel, 1 for a regular texture, in case of >1 "GL_ARB_texture_multisample" is required and data and mipmaps are ignored
 		*/
-		Texture2DBind(OpenGLRenderer &openGLRenderer, unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags);
+		Texture2DBind(OpenGLRenderer &openGLRenderer, unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, unsigned int numberOfMultisamples = 1);
 
 		/**
 		*  @brief
@@ -80,6 +82,13 @@ namespace OpenGLRenderer
 		virtual ~Texture2DBind();
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2D methods           ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void updateRegion(unsigned int mipmap, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data) override;
+
+
 	};
 
 
@@ -46,7 +46,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    OpenGL 2D texture class, effective direct state access (DSA)
 	*/
-	class Texture2DDsa : public Texture2D
+	class Texture2DDsa final : public Texture2D
 	{
 
 
@@ -80,6 +80,13 @@ namespace OpenGLRenderer
 		virtual ~Texture2DDsa();
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2D methods           ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void updateRegion(unsigned int mipmap, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data) override;
+
+
 	};
 
 
@@ -59,7 +59,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    OpenGL texture collection class
 	*/
-	class TextureCollection : public Renderer::ITextureCollection
+	class TextureCollection final : public Renderer::ITextureCollection
 	{
 
 
@@ -108,13 +108,37 @@ namespace OpenGLRenderer
 		*/
 		inline Renderer::ITexture **getTextures() const;
 
+		/**
+		*  @brief
+		*    Return the OpenGL textures
+		*
+		*  @return
+		*    The OpenGL textures resolved at creation time (0 for no texture), there are "getNumberOfTextures()" entries, can be a null pointer
+		*
+		*  @remarks
+		*    Ready to be passed to "glBindTextures()" ("GL_ARB_multi_bind"), so there's no need to evaluate the texture types
+		*    each time the texture collection is set
+		*/
+		inline const unsigned int *getOpenGLTextures() const;
+
+		/**
+		*  @brief
+		*    Return the OpenGL texture targets
+		*
+		*  @return
+		*    The OpenGL texture targets resolved at creation time ("GL_TEXTURE_2D" for no texture), there are "getNumberOfTextures()" entries, can be a null pointer
+		*/
+		inline const unsigned int *getOpenGLTextureTargets() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		unsigned int		 mNumberOfTextures;	/**< The number of texture instances */
-		Renderer::ITexture **mTextures;			/**< Texture instances (we keep a reference to it), can be a null pointer */
+		unsigned int		 mNumberOfTextures;			/**< The number of texture instances */
+		Renderer::ITexture **mTextures;					/**< Texture instances (we keep a reference to it), can be a null pointer */
+		unsigned int		*mOpenGLTextures;			/**< OpenGL textures, there are "mNumberOfTextures" entries, can be a null pointer */
+		unsigned int		*mOpenGLTextureTargets;		/**< OpenGL texture targets, there are "mNumberOfTextures" entries, can be a null pointer */
 
 
 	};
@@ -46,6 +46,24 @@ namespace OpenGLRenderer
 		return mTextures;
 	}
 
+	/**
+	*  @brief
+	*    Return the OpenGL textures
+	*/
+	inline const unsigned int *TextureCollection::getOpenGLTextures() const
+	{
+		return mOpenGLTextures;
+	}
+
+	/**
+	*  @brief
+	*    Return the OpenGL texture targets
+	*/
+	inline const unsigned int *TextureCollection::getOpenGLTextureTargets() const
+	{
+		return mOpenGLTextureTargets;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -48,7 +48,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Cg uniform buffer object (UBO, "constant buffer" in Direct3D terminology) class
 	*/
-	class UniformBufferCg : public UniformBuffer
+	class UniformBufferCg final : public UniformBuffer
 	{
 
 
@@ -48,7 +48,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    GLSL uniform buffer object (UBO, "constant buffer" in Direct3D terminology) class, traditional bind version
 	*/
-	class UniformBufferGlslBind : public UniformBufferGlsl
+	class UniformBufferGlslBind final : public UniformBufferGlsl
 	{
 
 
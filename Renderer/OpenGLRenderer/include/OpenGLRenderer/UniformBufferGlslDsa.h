@@ -48,7 +48,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    GLSL uniform buffer object (UBO, "constant buffer" in Direct3D terminology) class, effective direct state access (DSA)
 	*/
-	class UniformBufferGlslDsa : public UniformBufferGlsl
+	class UniformBufferGlslDsa final : public UniformBufferGlsl
 	{
 
 
@@ -71,7 +71,7 @@ namespace OpenGLRenderer
 	*    program is the only option to ensure a proper behaviour. It should still be possible to use this
 	*    vertex array for multiple programes with the same VAO signature.
 	*/
-	class VertexArrayCg : public VertexArray
+	class VertexArrayCg final : public VertexArray
 	{
 
 
@@ -53,7 +53,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Cg vertex shader class
 	*/
-	class VertexShaderCg : public VertexShader
+	class VertexShaderCg final : public VertexShader
 	{
 
 
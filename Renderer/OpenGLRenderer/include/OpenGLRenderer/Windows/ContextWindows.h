@@ -66,10 +66,12 @@ namespace OpenGLRenderer
 		*  @brief
 		*    Constructor
 		*
+		*  @param[in] allocator
+		*    Allocator to use, must stay valid as long as the context instance exists
 		*  @param[in] nativeWindowHandle
 		*    Optional native main window handle, can be a null handle
 		*/
-		explicit ContextWindows(handle nativeWindowHandle);
+		ContextWindows(Renderer::IAllocator &allocator, handle nativeWindowHandle);
 
 		/**
 		*  @brief
@@ -95,6 +97,44 @@ namespace OpenGLRenderer
 		*/
 		inline HGLRC getRenderContext() const;
 
+		/**
+		*  @brief
+		*    Return the device context the render context is currently bound to
+		*
+		*  @return
+		*    The device context the render context is currently bound to, can be a null pointer
+		*/
+		inline HDC getCurrentDeviceContext() const;
+
+		/**
+		*  @brief
+		*    Prepare the device context of an additional window so that the render context can be bound to it
+		*
+		*  @param[in] deviceContext
+		*    Device context of the additional window, must be valid
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (e.g. the window already has an other pixel format)
+		*
+		*  @note
+		*    - A render context can only be bound to device contexts with the pixel format it has been created for
+		*/
+		bool setupDeviceContext(HDC deviceContext) const;
+
+		/**
+		*  @brief
+		*    Bind the render context to the given device context
+		*
+		*  @param[in] deviceContext
+		*    Device context to render into, null pointer for the primary device context
+		*
+		*  @remarks
+		*    There's only a single render context which is shared by all swap chains, so all of them are sharing one
+		*    resource namespace and only the device context the render context is bound to is exchanged. "wglMakeCurrent()"
+		*    flushes the render context, so nothing happens in case the render context is already bound to the given device context.
+		*/
+		void makeCurrent(HDC deviceContext);
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual OpenGLRenderer::IContext methods       ]
@@ -152,6 +192,7 @@ namespace OpenGLRenderer
 		handle				  mDummyWindow;				/**< OpenGL dummy window, can be a null pointer (HWND) */
 		HDC					  mWindowDeviceContext;		/**< The device context of the OpenGL dummy window, can be a null pointer */
 		HGLRC				  mWindowRenderContext;		/**< The render context of the OpenGL dummy window, can be a null pointer */
+		HDC					  mCurrentDeviceContext;	/**< The device context the render context is currently bound to, can be a null pointer */
 
 
 	};
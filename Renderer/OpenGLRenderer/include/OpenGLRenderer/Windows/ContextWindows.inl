@@ -46,6 +46,15 @@ namespace OpenGLRenderer
 		return mWindowRenderContext;
 	}
 
+	/**
+	*  @brief
+	*    Return the device context the render context is currently bound to
+	*/
+	inline HDC ContextWindows::getCurrentDeviceContext() const
+	{
+		return mCurrentDeviceContext;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual OpenGLRenderer::IContext methods       ]
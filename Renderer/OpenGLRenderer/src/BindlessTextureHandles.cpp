@@ -0,0 +1,209 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "OpenGLRenderer/BindlessTextureHandles.h"
+#include "OpenGLRenderer/SamplerStateSo.h"
+#include "OpenGLRenderer/IContext.h"
+#include "OpenGLRenderer/Extensions.h"
+#include "OpenGLRenderer/OpenGLRenderer.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace OpenGLRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	BindlessTextureHandles::BindlessTextureHandles(Renderer::IAllocator &allocator) :
+		mHandles(Renderer::StlAllocator<Handle>(allocator, Renderer::AllocationTag::RESOURCE))
+	{
+		// Nothing to do in here
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	BindlessTextureHandles::~BindlessTextureHandles()
+	{
+		// The handles have to be released before the OpenGL texture is destroyed, just in case release the sampler state references
+		release();
+	}
+
+	unsigned long long BindlessTextureHandles::getHandle(OpenGLRenderer &openGLRenderer, unsigned int openGLTexture, Renderer::ISamplerState *samplerState)
+	{
+		const Handle *handle = getOrCreateHandle(openGLRenderer, openGLTexture, samplerState);
+		return (nullptr != handle) ? handle->openGLHandle : 0;
+	}
+
+	void BindlessTextureHandles::setResident(OpenGLRenderer &openGLRenderer, unsigned int openGLTexture, Renderer::ISamplerState *samplerState, bool resident)
+	{
+		Handle *handle = getOrCreateHandle(openGLRenderer, openGLTexture, samplerState);
+		if (nullptr != handle)
+		{
+			if (resident)
+			{
+				// Make the handle resident on the first residency reference
+				if (0 == handle->numberOfResidents)
+				{
+					glMakeTextureHandleResidentARB(handle->openGLHandle);
+				}
+				++handle->numberOfResidents;
+			}
+			else if (handle->numberOfResidents > 0)
+			{
+				// Make the handle non-resident on the last residency reference
+				--handle->numberOfResidents;
+				if (0 == handle->numberOfResidents)
+				{
+					glMakeTextureHandleNonResidentARB(handle->openGLHandle);
+				}
+			}
+		}
+	}
+
+	void BindlessTextureHandles::release()
+	{
+		const size_t numberOfHandles = mHandles.size();
+		for (size_t i = 0; i < numberOfHandles; ++i)
+		{
+			Handle &handle = mHandles[i];
+
+			// Make the handle non-resident, in case it's still resident
+			if (handle.numberOfResidents > 0)
+			{
+				glMakeTextureHandleNonResidentARB(handle.openGLHandle);
+			}
+
+			// Release the sampler state reference
+			if (nullptr != handle.samplerState)
+			{
+				handle.samplerState->release();
+			}
+		}
+		mHandles.clear();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Copy constructor
+	*/
+	BindlessTextureHandles::BindlessTextureHandles(const BindlessTextureHandles &source) :
+		mHandles(source.mHandles.get_allocator())
+	{
+		// Not supported
+	}
+
+	/**
+	*  @brief
+	*    Copy operator
+	*/
+	BindlessTextureHandles &BindlessTextureHandles::operator =(const BindlessTextureHandles &)
+	{
+		// Not supported
+		return *this;
+	}
+
+	BindlessTextureHandles::Handle *BindlessTextureHandles::getOrCreateHandle(OpenGLRenderer &openGLRenderer, unsigned int openGLTexture, Renderer::ISamplerState *samplerState)
+	{
+		// Is there already a handle for the given sampler state?
+		const size_t numberOfHandles = mHandles.size();
+		for (size_t i = 0; i < numberOfHandles; ++i)
+		{
+			if (mHandles[i].samplerState == samplerState)
+			{
+				return &mHandles[i];
+			}
+		}
+
+		// Is "GL_ARB_bindless_texture" there?
+		const Extensions &extensions = openGLRenderer.getContext().getExtensions();
+		if (!extensions.isGL_ARB_bindless_texture() || 0 == openGLTexture)
+		{
+			// Error!
+			return nullptr;
+		}
+
+		// Request the handle
+		GLuint64 openGLHandle = 0;
+		if (nullptr == samplerState)
+		{
+			openGLHandle = glGetTextureHandleARB(openGLTexture);
+		}
+		else
+		{
+			// Security check: Is the given resource owned by this renderer?
+			#ifndef OPENGLRENDERER_NO_RENDERERMATCHCHECK
+				if (&openGLRenderer != &samplerState->getRenderer())
+				{
+					// Output an error message and keep on going in order to keep a resonable behaviour even in case on an error
+					RENDERER_OUTPUT_DEBUG_STRING("OpenGL error: The given resource is owned by another renderer instance")
+
+					// Error!
+					return nullptr;
+				}
+			#endif
+
+			// Only sampler objects (SO) have an OpenGL sampler which can be combined with the texture
+			if (!extensions.isGL_ARB_sampler_objects())
+			{
+				// Error!
+				return nullptr;
+			}
+			openGLHandle = glGetTextureSamplerHandleARB(openGLTexture, static_cast<SamplerStateSo*>(samplerState)->getOpenGLSampler());
+		}
+		if (0 == openGLHandle)
+		{
+			// Error!
+			return nullptr;
+		}
+
+		// Add a sampler state reference, the handle is only valid as long as the OpenGL sampler exists
+		if (nullptr != samplerState)
+		{
+			samplerState->addReference();
+		}
+
+		// Register the handle
+		const Handle handle = { samplerState, openGLHandle, 0 };
+		mHandles.push_back(handle);
+		return &mHandles.back();
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // OpenGLRenderer
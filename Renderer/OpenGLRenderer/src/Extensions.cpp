@@ -79,6 +79,7 @@ namespace OpenGLRenderer
 	// WGL (Windows only)
 	bool Extensions::isWGL_ARB_extensions_string()			const { return mWGL_ARB_extensions_string;			}
 	bool Extensions::isWGL_EXT_swap_control()				const { return mWGL_EXT_swap_control;				}
+	bool Extensions::isWGL_EXT_swap_control_tear()			const { return mWGL_EXT_swap_control_tear;			}
 	bool Extensions::isWGL_ARB_pixel_format()				const { return mWGL_ARB_pixel_format;				}
 	bool Extensions::isWGL_ARB_render_texture()				const { return mWGL_ARB_render_texture;				}
 	bool Extensions::isWGL_ARB_make_current_read()			const { return mWGL_ARB_make_current_read;			}
@@ -87,6 +88,8 @@ namespace OpenGLRenderer
 	bool Extensions::isWGL_NV_float_buffer()				const { return mWGL_NV_float_buffer;				}
 	// GLX (Linux only)
 	bool Extensions::isGLX_SGI_swap_control()				const { return mGLX_SGI_swap_control;				}
+	bool Extensions::isGLX_EXT_swap_control()				const { return mGLX_EXT_swap_control;				}
+	bool Extensions::isGLX_EXT_swap_control_tear()			const { return mGLX_EXT_swap_control_tear;			}
 	// EXT
 	bool Extensions::isGL_EXT_compiled_vertex_array()		const { return mGL_EXT_compiled_vertex_array;		}
 	bool Extensions::isGL_EXT_draw_range_elements()			const { return mGL_EXT_draw_range_elements;			}
@@ -148,7 +151,20 @@ namespace OpenGLRenderer
 	bool Extensions::isGL_ARB_vertex_array_object()			const { return mGL_ARB_vertex_array_object;			}
 	bool Extensions::isGL_ARB_sampler_objects()				const { return mGL_ARB_sampler_objects;				}
 	bool Extensions::isGL_ARB_draw_elements_base_vertex()	const { return mGL_ARB_draw_elements_base_vertex;	}
+	bool Extensions::isGL_ARB_draw_indirect()				const { return mGL_ARB_draw_indirect;				}
+	bool Extensions::isGL_ARB_multi_draw_indirect()			const { return mGL_ARB_multi_draw_indirect;			}
+	bool Extensions::isGL_ARB_shader_image_load_store()		const { return mGL_ARB_shader_image_load_store;		}
+	bool Extensions::isGL_ARB_shader_storage_buffer_object()	const { return mGL_ARB_shader_storage_buffer_object;	}
+	bool Extensions::isGL_ARB_compute_shader()				const { return mGL_ARB_compute_shader;				}
+	bool Extensions::isGL_ARB_texture_multisample()			const { return mGL_ARB_texture_multisample;			}
+	bool Extensions::isGL_ARB_pixel_buffer_object()			const { return mGL_ARB_pixel_buffer_object;			}
+	bool Extensions::isGL_ARB_sync()						const { return mGL_ARB_sync;						}
+	bool Extensions::isGL_ARB_copy_buffer()					const { return mGL_ARB_copy_buffer;					}
+	bool Extensions::isGL_ARB_map_buffer_range()			const { return mGL_ARB_map_buffer_range;			}
+	bool Extensions::isGL_ARB_buffer_storage()				const { return mGL_ARB_buffer_storage;				}
 	bool Extensions::isGL_ARB_debug_output()				const { return mGL_ARB_debug_output;				}
+	bool Extensions::isGL_ARB_multi_bind()					const { return mGL_ARB_multi_bind;					}
+	bool Extensions::isGL_ARB_bindless_texture()			const { return mGL_ARB_bindless_texture;			}
 	// ATI
 	bool Extensions::isGL_ATI_meminfo()						const { return mGL_ATI_meminfo;						}
 	bool Extensions::isGL_ATI_separate_stencil()			const { return mGL_ATI_separate_stencil;			}
@@ -305,6 +321,7 @@ namespace OpenGLRenderer
 		// WGL (Windows only)
 		mWGL_ARB_extensions_string			= false;
 		mWGL_EXT_swap_control				= false;
+		mWGL_EXT_swap_control_tear			= false;
 		mWGL_ARB_pixel_format				= false;
 		mWGL_ARB_render_texture				= false;
 		mWGL_ARB_make_current_read			= false;
@@ -313,6 +330,8 @@ namespace OpenGLRenderer
 		mWGL_NV_float_buffer				= false;
 		// GLX (Linux only)
 		mGLX_SGI_swap_control				= false;
+		mGLX_EXT_swap_control				= false;
+		mGLX_EXT_swap_control_tear			= false;
 		// EXT
 		mGL_EXT_compiled_vertex_array		= false;
 		mGL_EXT_draw_range_elements			= false;
@@ -374,7 +393,20 @@ namespace OpenGLRenderer
 		mGL_ARB_vertex_array_object			= false;
 		mGL_ARB_sampler_objects				= false;
 		mGL_ARB_draw_elements_base_vertex	= false;
+		mGL_ARB_draw_indirect				= false;
+		mGL_ARB_multi_draw_indirect			= false;
+		mGL_ARB_shader_image_load_store		= false;
+		mGL_ARB_shader_storage_buffer_object	= false;
+		mGL_ARB_compute_shader				= false;
+		mGL_ARB_texture_multisample			= false;
+		mGL_ARB_pixel_buffer_object			= false;
+		mGL_ARB_sync						= false;
+		mGL_ARB_copy_buffer					= false;
+		mGL_ARB_map_buffer_range			= false;
+		mGL_ARB_buffer_storage				= false;
 		mGL_ARB_debug_output				= false;
+		mGL_ARB_multi_bind					= false;
+		mGL_ARB_bindless_texture			= false;
 		// ATI
 		mGL_ATI_meminfo						= false;
 		mGL_ATI_separate_stencil			= false;
@@ -655,6 +687,8 @@ namespace OpenGLRenderer
 			IMPORT_FUNC(glProgramUniform1iEXT)
 			IMPORT_FUNC(glTextureImage2DEXT)
 			IMPORT_FUNC(glTextureImage3DEXT)
+			IMPORT_FUNC(glTextureSubImage2DEXT)
+			IMPORT_FUNC(glTextureSubImage3DEXT)
 			IMPORT_FUNC(glTextureParameteriEXT)
 			IMPORT_FUNC(glGenerateTextureMipmapEXT)
 			IMPORT_FUNC(glVertexArrayVertexAttribOffsetEXT)
@@ -1061,6 +1095,110 @@ namespace OpenGLRenderer
 			mGL_ARB_draw_elements_base_vertex = result;
 		}
 
+		// GL_ARB_draw_indirect
+		mGL_ARB_draw_indirect = isSupported("GL_ARB_draw_indirect");
+		if (mGL_ARB_draw_indirect)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glDrawArraysIndirect)
+			IMPORT_FUNC(glDrawElementsIndirect)
+			mGL_ARB_draw_indirect = result;
+		}
+
+		// GL_ARB_multi_draw_indirect
+		// -> Builds upon "GL_ARB_draw_indirect", the indirect buffer binding point is shared
+		mGL_ARB_multi_draw_indirect = (mGL_ARB_draw_indirect && isSupported("GL_ARB_multi_draw_indirect"));
+		if (mGL_ARB_multi_draw_indirect)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glMultiDrawArraysIndirect)
+			IMPORT_FUNC(glMultiDrawElementsIndirect)
+			mGL_ARB_multi_draw_indirect = result;
+		}
+
+		// GL_ARB_shader_image_load_store
+		mGL_ARB_shader_image_load_store = isSupported("GL_ARB_shader_image_load_store");
+		if (mGL_ARB_shader_image_load_store)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glBindImageTexture)
+			IMPORT_FUNC(glMemoryBarrier)
+			mGL_ARB_shader_image_load_store = result;
+		}
+
+		// GL_ARB_shader_storage_buffer_object
+		// -> We don't use "glShaderStorageBlockBinding()", explicit "layout(binding=<x>)" is used inside the shaders instead
+		mGL_ARB_shader_storage_buffer_object = isSupported("GL_ARB_shader_storage_buffer_object");
+
+		// GL_ARB_compute_shader
+		mGL_ARB_compute_shader = isSupported("GL_ARB_compute_shader");
+		if (mGL_ARB_compute_shader)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glDispatchCompute)
+			IMPORT_FUNC(glDispatchComputeIndirect)
+			mGL_ARB_compute_shader = result;
+		}
+
+		// GL_ARB_texture_multisample
+		mGL_ARB_texture_multisample = isSupported("GL_ARB_texture_multisample");
+		if (mGL_ARB_texture_multisample)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glTexImage2DMultisample)
+			mGL_ARB_texture_multisample = result;
+		}
+
+		// GL_ARB_pixel_buffer_object
+		mGL_ARB_pixel_buffer_object = isSupported("GL_ARB_pixel_buffer_object");
+
+		// GL_ARB_sync
+		mGL_ARB_sync = isSupported("GL_ARB_sync");
+		if (mGL_ARB_sync)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glFenceSync)
+			IMPORT_FUNC(glDeleteSync)
+			IMPORT_FUNC(glClientWaitSync)
+			mGL_ARB_sync = result;
+		}
+
+		// GL_ARB_copy_buffer
+		mGL_ARB_copy_buffer = isSupported("GL_ARB_copy_buffer");
+		if (mGL_ARB_copy_buffer)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glCopyBufferSubData)
+			mGL_ARB_copy_buffer = result;
+		}
+
+		// GL_ARB_map_buffer_range
+		mGL_ARB_map_buffer_range = isSupported("GL_ARB_map_buffer_range");
+		if (mGL_ARB_map_buffer_range)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glMapBufferRange)
+			mGL_ARB_map_buffer_range = result;
+		}
+
+		// GL_ARB_buffer_storage
+		mGL_ARB_buffer_storage = isSupported("GL_ARB_buffer_storage");
+		if (mGL_ARB_buffer_storage)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glBufferStorage)
+			mGL_ARB_buffer_storage = result;
+		}
+
 		// GL_ARB_debug_output
 		mGL_ARB_debug_output = isSupported("GL_ARB_debug_output");
 		if (mGL_ARB_debug_output)
@@ -1071,6 +1209,30 @@ namespace OpenGLRenderer
 			mGL_ARB_debug_output = result;
 		}
 
+		// GL_ARB_multi_bind
+		mGL_ARB_multi_bind = isSupported("GL_ARB_multi_bind");
+		if (mGL_ARB_multi_bind)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glBindTextures)
+			IMPORT_FUNC(glBindSamplers)
+			mGL_ARB_multi_bind = result;
+		}
+
+		// GL_ARB_bindless_texture
+		mGL_ARB_bindless_texture = isSupported("GL_ARB_bindless_texture");
+		if (mGL_ARB_bindless_texture)
+		{
+			// Load the entry points
+			bool result = true;	// Success by default
+			IMPORT_FUNC(glGetTextureHandleARB)
+			IMPORT_FUNC(glGetTextureSamplerHandleARB)
+			IMPORT_FUNC(glMakeTextureHandleResidentARB)
+			IMPORT_FUNC(glMakeTextureHandleNonResidentARB)
+			mGL_ARB_bindless_texture = result;
+		}
+
 
 		//[-------------------------------------------------------]
 		//[ ATI                                                   ]
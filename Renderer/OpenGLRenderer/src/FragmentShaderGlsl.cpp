@@ -23,6 +23,7 @@
 //[-------------------------------------------------------]
 #include "OpenGLRenderer/FragmentShaderGlsl.h"
 #include "OpenGLRenderer/Extensions.h"
+#include "OpenGLRenderer/OpenGLRenderer.h"
 #include "OpenGLRenderer/ShaderLanguageGlsl.h"
 
 
@@ -42,7 +43,7 @@ namespace OpenGLRenderer
 	*/
 	FragmentShaderGlsl::FragmentShaderGlsl(OpenGLRenderer &openGLRenderer, const char *sourceCode) :
 		FragmentShader(openGLRenderer),
-		mOpenGLShader(ShaderLanguageGlsl::loadShader(GL_FRAGMENT_SHADER_ARB, sourceCode))
+		mOpenGLShader(ShaderLanguageGlsl::loadShader(openGLRenderer.getAllocator(), GL_FRAGMENT_SHADER_ARB, sourceCode))
 	{
 		// Nothing to do in here
 	}
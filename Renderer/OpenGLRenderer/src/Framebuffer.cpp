@@ -63,7 +63,7 @@ namespace OpenGLRenderer
 			}
 
 			// Cleanup
-			delete [] mColorTextures;
+			getRenderer().getAllocator().deallocateArray(mColorTextures, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Release the reference to the used depth stencil texture
@@ -99,7 +99,7 @@ namespace OpenGLRenderer
 		// Add a reference to the used color textures
 		if (mNumberOfColorTextures > 0)
 		{
-			mColorTextures = new Renderer::ITexture*[mNumberOfColorTextures];
+			mColorTextures = getRenderer().getAllocator().allocateArray<Renderer::ITexture*>(mNumberOfColorTextures, Renderer::AllocationTag::RESOURCE);
 
 			// Loop through all color textures
 			Renderer::ITexture **colorTexturesEnd = mColorTextures + mNumberOfColorTextures;
@@ -137,6 +137,7 @@ namespace OpenGLRenderer
 						case Renderer::ResourceType::INDEX_BUFFER:
 						case Renderer::ResourceType::VERTEX_BUFFER:
 						case Renderer::ResourceType::UNIFORM_BUFFER:
+						case Renderer::ResourceType::INDIRECT_BUFFER:
 						case Renderer::ResourceType::TEXTURE_BUFFER:
 						case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 						case Renderer::ResourceType::RASTERIZER_STATE:
@@ -148,8 +149,10 @@ namespace OpenGLRenderer
 						case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 						case Renderer::ResourceType::GEOMETRY_SHADER:
 						case Renderer::ResourceType::FRAGMENT_SHADER:
+						case Renderer::ResourceType::COMPUTE_SHADER:
 						case Renderer::ResourceType::TEXTURE_COLLECTION:
 						case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+						case Renderer::ResourceType::FENCE:
 						default:
 							// Nothing to do in here
 							break;
@@ -192,6 +195,7 @@ namespace OpenGLRenderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::TEXTURE_BUFFER:
 				case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 				case Renderer::ResourceType::RASTERIZER_STATE:
@@ -203,8 +207,10 @@ namespace OpenGLRenderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					// Nothing to do in here
 					break;
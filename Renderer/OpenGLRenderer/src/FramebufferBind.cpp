@@ -77,9 +77,12 @@ namespace OpenGLRenderer
 			switch ((*colorTexture)->getResourceType())
 			{
 				case Renderer::ResourceType::TEXTURE_2D:
-					// Set the OpenGL framebuffer color attachment
-					glFramebufferTexture2D(GL_FRAMEBUFFER, openGLAttachment, GL_TEXTURE_2D, static_cast<Texture2D*>(*colorTexture)->getOpenGLTexture(), 0);
+				{
+					// Set the OpenGL framebuffer color attachment, multisample textures are attached by using "GL_TEXTURE_2D_MULTISAMPLE"
+					const Texture2D *texture2D = static_cast<Texture2D*>(*colorTexture);
+					glFramebufferTexture2D(GL_FRAMEBUFFER, openGLAttachment, static_cast<GLenum>(texture2D->getOpenGLTextureTarget()), texture2D->getOpenGLTexture(), 0);
 					break;
+				}
 
 				case Renderer::ResourceType::PROGRAM:
 				case Renderer::ResourceType::VERTEX_ARRAY:
@@ -88,6 +91,7 @@ namespace OpenGLRenderer
 				case Renderer::ResourceType::INDEX_BUFFER:
 				case Renderer::ResourceType::VERTEX_BUFFER:
 				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
 				case Renderer::ResourceType::TEXTURE_BUFFER:
 				case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 				case Renderer::ResourceType::RASTERIZER_STATE:
@@ -99,8 +103,10 @@ namespace OpenGLRenderer
 				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 				case Renderer::ResourceType::GEOMETRY_SHADER:
 				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
 				case Renderer::ResourceType::TEXTURE_COLLECTION:
 				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
 				default:
 					RENDERER_OUTPUT_DEBUG_PRINTF("OpenGL error: The type of the given color texture at index %d is not supported", colorTexture - colorTextures)
 					break;
@@ -23,6 +23,7 @@
 //[-------------------------------------------------------]
 #include "OpenGLRenderer/GeometryShaderGlsl.h"
 #include "OpenGLRenderer/Extensions.h"
+#include "OpenGLRenderer/OpenGLRenderer.h"
 #include "OpenGLRenderer/ShaderLanguageGlsl.h"
 
 
@@ -42,7 +43,7 @@ namespace OpenGLRenderer
 	*/
 	GeometryShaderGlsl::GeometryShaderGlsl(OpenGLRenderer &openGLRenderer, const char *sourceCode, Renderer::GsInputPrimitiveTopology::Enum gsInputPrimitiveTopology, Renderer::GsOutputPrimitiveTopology::Enum gsOutputPrimitiveTopology, unsigned int numberOfOutputVertices) :
 		GeometryShader(openGLRenderer),
-		mOpenGLShader(ShaderLanguageGlsl::loadShader(GL_GEOMETRY_SHADER_ARB, sourceCode)),
+		mOpenGLShader(ShaderLanguageGlsl::loadShader(openGLRenderer.getAllocator(), GL_GEOMETRY_SHADER_ARB, sourceCode)),
 		mOpenGLGsInputPrimitiveTopology(gsInputPrimitiveTopology),	// The "Renderer::GsInputPrimitiveTopology::Enum" values directly map to OpenGL constants, do not change them
 		mOpenGLGsOutputPrimitiveTopology(gsOutputPrimitiveTopology),	// The "Renderer::GsOutputPrimitiveTopology::Enum" values directly map to OpenGL constants, do not change them
 		mNumberOfOutputVertices(numberOfOutputVertices)
@@ -51,13 +51,13 @@ namespace OpenGLRenderer
 	//[-------------------------------------------------------]
 	/**
 	*  @brief
-	*    Default constructor
+	*    Constructor
 	*/
-	IContext::IContext() :
+	IContext::IContext(Renderer::IAllocator &allocator) :
 		mExtensions(nullptr)
 	{
 		// We're using "this" in here, so we are not allowed to write the following within the initializer list
-		mExtensions = new Extensions(*this);
+		mExtensions = new (allocator) Extensions(*this);
 	}
 
 	/**
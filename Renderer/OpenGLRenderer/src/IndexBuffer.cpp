@@ -58,13 +58,15 @@ namespace OpenGLRenderer
 	IndexBuffer::IndexBuffer(OpenGLRenderer &openGLRenderer, Renderer::IndexBufferFormat::Enum indexBufferFormat) :
 		IIndexBuffer(reinterpret_cast<Renderer::IRenderer&>(openGLRenderer)),
 		mOpenGLElementArrayBuffer(0),
-		mOpenGLType(GL_UNSIGNED_SHORT)
+		mOpenGLType(GL_UNSIGNED_SHORT),
+		mIndexSize(2)
 	{
 		// Create the OpenGL element array buffer
 		glGenBuffersARB(1, &mOpenGLElementArrayBuffer);
 
 		// Set the OpenGL index buffer data type
 		mOpenGLType = Mapping::getOpenGLType(indexBufferFormat);
+		mIndexSize = Mapping::getOpenGLSize(indexBufferFormat);
 	}
 
 
@@ -43,6 +43,9 @@ namespace OpenGLRenderer
 	IndexBufferBind::IndexBufferBind(OpenGLRenderer &openGLRenderer, unsigned int numberOfBytes, Renderer::IndexBufferFormat::Enum indexBufferFormat, const void *data, Renderer::BufferUsage::Enum bufferUsage) :
 		IndexBuffer(openGLRenderer, indexBufferFormat)
 	{
+		// Set the estimated number of bytes of the index buffer
+		setNumberOfBytes(numberOfBytes);
+
 		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
 			// Backup the currently bound OpenGL element array buffer
 			GLint openGLElementArrayBufferBackup = 0;
@@ -0,0 +1,108 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "OpenGLRenderer/IndirectBufferBind.h"
+#include "OpenGLRenderer/Extensions.h"
+#include "OpenGLRenderer/OpenGLRuntimeLinking.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace OpenGLRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	IndirectBufferBind::IndirectBufferBind(OpenGLRenderer &openGLRenderer, unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage) :
+		IndirectBuffer(openGLRenderer, numberOfBytes)
+	{
+		// Set the estimated number of bytes of the indirect buffer
+		setNumberOfBytes(numberOfBytes);
+
+		// Create the OpenGL indirect buffer
+		glGenBuffersARB(1, &mOpenGLIndirectBuffer);
+
+		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+			// Backup the currently bound OpenGL indirect buffer
+			GLint openGLIndirectBufferBackup = 0;
+			glGetIntegerv(GL_DRAW_INDIRECT_BUFFER_BINDING, &openGLIndirectBufferBackup);
+		#endif
+
+		// Bind this OpenGL indirect buffer and upload the data
+		glBindBufferARB(GL_DRAW_INDIRECT_BUFFER, mOpenGLIndirectBuffer);
+		// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 2 constants, do not change them
+		glBufferDataARB(GL_DRAW_INDIRECT_BUFFER, static_cast<GLsizeiptrARB>(numberOfBytes), data, bufferUsage);
+
+		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+			// Be polite and restore the previous bound OpenGL indirect buffer
+			glBindBufferARB(GL_DRAW_INDIRECT_BUFFER, static_cast<GLuint>(openGLIndirectBufferBackup));
+		#endif
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	IndirectBufferBind::~IndirectBufferBind()
+	{
+		// Nothing to do in here
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IIndirectBuffer methods      ]
+	//[-------------------------------------------------------]
+	void IndirectBufferBind::copyDataFrom(unsigned int numberOfBytes, const void *data)
+	{
+		// Ignore a null pointer, see "Renderer::IIndirectBuffer::copyDataFrom()"
+		if (nullptr != data)
+		{
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Backup the currently bound OpenGL indirect buffer
+				GLint openGLIndirectBufferBackup = 0;
+				glGetIntegerv(GL_DRAW_INDIRECT_BUFFER_BINDING, &openGLIndirectBufferBackup);
+			#endif
+
+			// Bind this OpenGL indirect buffer and upload the data
+			glBindBufferARB(GL_DRAW_INDIRECT_BUFFER, mOpenGLIndirectBuffer);
+			glBufferSubDataARB(GL_DRAW_INDIRECT_BUFFER, 0, static_cast<GLsizeiptrARB>(numberOfBytes), data);
+
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Be polite and restore the previous bound OpenGL indirect buffer
+				glBindBufferARB(GL_DRAW_INDIRECT_BUFFER, static_cast<GLuint>(openGLIndirectBufferBackup));
+			#endif
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // OpenGLRenderer
@@ -42,13 +42,15 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Constructor
 	*/
-	ContextLinux::ContextLinux(handle nativeWindowHandle) :
-		mOpenGLRuntimeLinking(new OpenGLRuntimeLinking()),
+	ContextLinux::ContextLinux(Renderer::IAllocator &allocator, handle nativeWindowHandle) :
+		IContext(allocator),
+		mOpenGLRuntimeLinking(new (allocator) OpenGLRuntimeLinking()),
 		mNativeWindowHandle(nativeWindowHandle),
 		mDummyWindow(NULL_HANDLE),
 		mDisplay(nullptr),
 		m_pDummyVisualInfo(nullptr),
-		mWindowRenderContext(NULL_HANDLE)
+		mWindowRenderContext(NULL_HANDLE),
+		mCurrentNativeWindowHandle(NULL_HANDLE)
 	{
 		// Is OpenGL available?
 		if (mOpenGLRuntimeLinking->isOpenGLAvaiable())
@@ -104,6 +106,10 @@ namespace OpenGLRenderer
 							// Make the OpenGL context to the current one
 							int result = glXMakeCurrent(mDisplay, mNativeWindowHandle, mWindowRenderContext);
 							std::cout<<"make new context current: "<<result<<"\n";
+							if (result)
+							{
+								mCurrentNativeWindowHandle = mNativeWindowHandle;
+							}
 							std::cout<<"supported extensions: "<<glGetString(GL_EXTENSIONS)<<"\n";
 						}
 						
@@ -175,6 +181,28 @@ namespace OpenGLRenderer
 		delete mOpenGLRuntimeLinking;
 	}
 
+	/**
+	*  @brief
+	*    Bind the render context to the given native window
+	*/
+	void ContextLinux::makeCurrent(handle nativeWindowHandle)
+	{
+		// A null handle stands for the primary window
+		if (NULL_HANDLE == nativeWindowHandle)
+		{
+			nativeWindowHandle = mNativeWindowHandle;
+		}
+
+		// Exchange the drawable, but only if it's really required
+		if (mCurrentNativeWindowHandle != nativeWindowHandle && NULL_HANDLE != mWindowRenderContext)
+		{
+			if (glXMakeCurrent(mDisplay, nativeWindowHandle, mWindowRenderContext))
+			{
+				mCurrentNativeWindowHandle = nativeWindowHandle;
+			}
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private static methods                                ]
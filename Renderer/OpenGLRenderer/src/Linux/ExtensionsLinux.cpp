@@ -79,6 +79,20 @@ namespace OpenGLRenderer
 			mGLX_SGI_swap_control = false;
 		}
 
+		// GLX_EXT_swap_control
+		if (isSupported("GLX_EXT_swap_control"))
+		{
+			glXSwapIntervalEXT = reinterpret_cast<PFNGLXSWAPINTERVALEXTPROC>(glXGetProcAddressARB(reinterpret_cast<const GLubyte*>("glXSwapIntervalEXT")));
+			mGLX_EXT_swap_control = (nullptr != glXSwapIntervalEXT);
+		}
+		else
+		{
+			mGLX_EXT_swap_control = false;
+		}
+
+		// GLX_EXT_swap_control_tear
+		mGLX_EXT_swap_control_tear = (mGLX_EXT_swap_control && isSupported("GLX_EXT_swap_control_tear"));
+
 		// WGL_ARB_multisample
 		mWGL_ARB_multisample = isSupported("GLX_ARB_multisample");
 
@@ -252,7 +252,9 @@ namespace OpenGLRenderer
 			1,	// Renderer::VertexArrayFormat::FLOAT_1
 			2,	// Renderer::VertexArrayFormat::FLOAT_2
 			3,	// Renderer::VertexArrayFormat::FLOAT_3
-			4	// Renderer::VertexArrayFormat::FLOAT_4
+			4,	// Renderer::VertexArrayFormat::FLOAT_4
+			2,	// Renderer::VertexArrayFormat::HALF_2
+			4	// Renderer::VertexArrayFormat::HALF_4
 		};
 		return MAPPING[vertexArrayFormat];
 	}
@@ -265,10 +267,12 @@ namespace OpenGLRenderer
 	{
 		static const GLenum MAPPING[] =
 		{
-			GL_FLOAT,	// Renderer::VertexArrayFormat::FLOAT_1
-			GL_FLOAT,	// Renderer::VertexArrayFormat::FLOAT_2
-			GL_FLOAT,	// Renderer::VertexArrayFormat::FLOAT_3
-			GL_FLOAT	// Renderer::VertexArrayFormat::FLOAT_4
+			GL_FLOAT,			// Renderer::VertexArrayFormat::FLOAT_1
+			GL_FLOAT,			// Renderer::VertexArrayFormat::FLOAT_2
+			GL_FLOAT,			// Renderer::VertexArrayFormat::FLOAT_3
+			GL_FLOAT,			// Renderer::VertexArrayFormat::FLOAT_4
+			GL_HALF_FLOAT_ARB,	// Renderer::VertexArrayFormat::HALF_2 - "GL_ARB_half_float_vertex" required
+			GL_HALF_FLOAT_ARB	// Renderer::VertexArrayFormat::HALF_4 - "GL_ARB_half_float_vertex" required
 		};
 		return MAPPING[vertexArrayFormat];
 	}
@@ -288,6 +292,21 @@ namespace OpenGLRenderer
 		return MAPPING[indexBufferFormat];
 	}
 
+	/**
+	*  @brief
+	*    "Renderer::IndexBufferFormat" to number of bytes per element
+	*/
+	unsigned int Mapping::getOpenGLSize(Renderer::IndexBufferFormat::Enum indexBufferFormat)
+	{
+		static const GLuint MAPPING[] =
+		{
+			1,	// Renderer::IndexBufferFormat::UNSIGNED_CHAR  - One byte per element, unsigned char (may not be supported by each API)
+			2,	// Renderer::IndexBufferFormat::UNSIGNED_SHORT - Two bytes per element, unsigned short
+			4	// Renderer::IndexBufferFormat::UNSIGNED_INT   - Four bytes per element, unsigned int (may not be supported by each API)
+		};
+		return MAPPING[indexBufferFormat];
+	}
+
 	/**
 	*  @brief
 	*    "Renderer::TextureFormat" to OpenGL internal format
@@ -339,6 +358,23 @@ namespace OpenGLRenderer
 		return MAPPING[textureFormat];
 	}
 
+	/**
+	*  @brief
+	*    "Renderer::TextureFormat" to number of bytes per texel when using the OpenGL format and type
+	*/
+	unsigned int Mapping::getOpenGLSize(Renderer::TextureFormat::Enum textureFormat)
+	{
+		static const GLuint MAPPING[] =
+		{
+			1,	// Renderer::TextureFormat::A8            - 8-bit pixel format, all bits alpha
+			3,	// Renderer::TextureFormat::R8G8B8        - 24-bit pixel format, 8 bits for red, green and blue
+			4,	// Renderer::TextureFormat::R8G8B8A8      - 32-bit pixel format, 8 bits for red, green, blue and alpha
+			8,	// Renderer::TextureFormat::R16G16B16A16F - 64-bit float format using 16 bits for the each channel (red, green, blue, alpha)
+			16	// Renderer::TextureFormat::R32G32B32A32F - 128-bit float format using 32 bits for the each channel (red, green, blue, alpha)
+		};
+		return MAPPING[textureFormat];
+	}
+
 	/**
 	*  @brief
 	*    "Renderer::PrimitiveTopology" to OpenGL type
@@ -356,6 +392,23 @@ namespace OpenGLRenderer
 		return MAPPING[primitive - 1];	// Lookout! The "Renderer::PrimitiveTopology::Enum"-values start with 1, not 0
 	}
 
+	/**
+	*  @brief
+	*    "Renderer::MapType" to OpenGL buffer access
+	*/
+	unsigned int Mapping::getOpenGLMapType(Renderer::MapType::Enum mapType)
+	{
+		static const GLenum MAPPING[] =
+		{
+			GL_READ_ONLY_ARB,	// Renderer::MapType::READ
+			GL_WRITE_ONLY_ARB,	// Renderer::MapType::WRITE
+			GL_READ_WRITE_ARB,	// Renderer::MapType::READ_WRITE
+			GL_WRITE_ONLY_ARB,	// Renderer::MapType::WRITE_DISCARD
+			GL_WRITE_ONLY_ARB	// Renderer::MapType::WRITE_NO_OVERWRITE
+		};
+		return MAPPING[mapType - 1];	// Lookout! The "Renderer::MapType::Enum"-values start with 1, not 0
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -26,9 +26,12 @@
 #include "OpenGLRenderer/Mapping.h"
 #include "OpenGLRenderer/BlendState.h"
 #include "OpenGLRenderer/Extensions.h"
+#include "OpenGLRenderer/Fence.h"
+#include "OpenGLRenderer/PixelUnpackBufferPool.h"
 #include "OpenGLRenderer/ShaderLanguageGlsl.h"
 #include "OpenGLRenderer/ProgramGlsl.h"
-#include "OpenGLRenderer/UniformBufferGlsl.h"
+#include "OpenGLRenderer/UniformBufferGlslDsa.h"
+#include "OpenGLRenderer/UniformBufferGlslBind.h"
 #include "OpenGLRenderer/SamplerStateSo.h"
 #include "OpenGLRenderer/SamplerStateDsa.h"
 #include "OpenGLRenderer/SamplerStateBind.h"
@@ -46,6 +49,9 @@
 #include "OpenGLRenderer/VertexBufferBind.h"
 #include "OpenGLRenderer/TextureBufferDsa.h"
 #include "OpenGLRenderer/TextureBufferBind.h"
+#include "OpenGLRenderer/IndirectBufferDsa.h"
+#include "OpenGLRenderer/IndirectBufferBind.h"
+#include "OpenGLRenderer/IndirectBufferEmulation.h"
 #include "OpenGLRenderer/Texture2DArrayDsa.h"
 #include "OpenGLRenderer/Texture2DArrayBind.h"
 #include "OpenGLRenderer/DepthStencilState.h"
@@ -75,9 +81,9 @@
 #else
 	#define OPENGLRENDERER_API_EXPORT
 #endif
-OPENGLRENDERER_API_EXPORT Renderer::IRenderer *createOpenGLRendererInstance(handle nativeWindowHandle)
+OPENGLRENDERER_API_EXPORT Renderer::IRenderer *createOpenGLRendererInstance(handle nativeWindowHandle, Renderer::IAllocator *allocator)
 {
-	return new OpenGLRenderer::OpenGLRenderer(nativeWindowHandle);
+	return new ((nullptr != allocator) ? *allocator : Renderer::DefaultAllocator::getInstance()) OpenGLRenderer::OpenGLRenderer(nativeWindowHandle, allocator);
 }
 #undef OPENGLRENDERER_API_EXPORT
 
@@ -96,22 +102,28 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Constructor
 	*/
-	OpenGLRenderer::OpenGLRenderer(handle nativeWindowHandle) :
+	OpenGLRenderer::OpenGLRenderer(handle nativeWindowHandle, Renderer::IAllocator *allocator) :
+		IRenderer(allocator),
 		#ifdef WIN32
-			mContext(new ContextWindows(nativeWindowHandle)),
+			mContext(new (getAllocator()) ContextWindows(getAllocator(), nativeWindowHandle)),
 		#elif defined LINUX
-			mContext(new ContextLinux(nativeWindowHandle)),
+			mContext(new (getAllocator()) ContextLinux(getAllocator(), nativeWindowHandle)),
 		#else
 			#error "Unsupported platform"
 		#endif
 		mShaderLanguageGlsl(nullptr),
 		#ifndef OPENGLRENDERER_NO_CG
-			mCgRuntimeLinking(new CgRuntimeLinking()),
+			mCgRuntimeLinking(new (getAllocator()) CgRuntimeLinking()),
 			mShaderLanguageCg(nullptr),
 		#endif
 		mDefaultSamplerState(nullptr),
+		mPixelUnpackBufferPool(nullptr),
 		mVertexArray(nullptr),
 		mOpenGLPrimitiveTopology(0xFFFF),	// Unknown default setting
+		mNumberOfStreamOutputTargets(0),
+		mOpenGLStreamOutputQuery(0),
+		mNumberOfStreamOutputVerticesPerPrimitive(0),
+		mStreamOutputRasterizerDiscard(false),
 		mDefaultRasterizerState(nullptr),
 		mRasterizerState(nullptr),
 		mMainSwapChain(nullptr),
@@ -120,7 +132,20 @@ namespace OpenGLRenderer
 		mDepthStencilState(nullptr),
 		mDefaultBlendState(nullptr),
 		mBlendState(nullptr),
-		mOpenGLProgram(0)
+		mOpenGLProgram(0),
+		mVertexBufferPool(getAllocator(), Renderer::ResourcePool::getMaximumNumberOfBytes<VertexBufferDsa, VertexBufferBind>()),
+		mIndexBufferPool(getAllocator(), Renderer::ResourcePool::getMaximumNumberOfBytes<IndexBufferDsa, IndexBufferBind>()),
+		mTextureBufferPool(getAllocator(), Renderer::ResourcePool::getMaximumNumberOfBytes<TextureBufferDsa, TextureBufferBind>()),
+		mIndirectBufferPool(getAllocator(), Renderer::ResourcePool::getMaximumNumberOfBytes<IndirectBufferDsa, IndirectBufferBind, IndirectBufferEmulation>()),
+		mTexture2DPool(getAllocator(), Renderer::ResourcePool::getMaximumNumberOfBytes<Texture2DDsa, Texture2DBind>()),
+		mTexture2DArrayPool(getAllocator(), Renderer::ResourcePool::getMaximumNumberOfBytes<Texture2DArrayDsa, Texture2DArrayBind>()),
+		mRasterizerStatePool(getAllocator(), sizeof(RasterizerState)),
+		mDepthStencilStatePool(getAllocator(), sizeof(DepthStencilState)),
+		mBlendStatePool(getAllocator(), sizeof(BlendState)),
+		mSamplerStatePool(getAllocator(), Renderer::ResourcePool::getMaximumNumberOfBytes<SamplerStateSo, SamplerStateDsa, SamplerStateBind>()),
+		mTextureCollectionPool(getAllocator(), sizeof(TextureCollection)),
+		mSamplerStateCollectionPool(getAllocator(), sizeof(SamplerStateCollection)),
+		mUniformBufferPool(getAllocator(), Renderer::ResourcePool::getMaximumNumberOfBytes<UniformBufferGlslDsa, UniformBufferGlslBind>())
 	{
 		// Is the context initialized?
 		if (mContext->isInitialized())
@@ -134,6 +159,12 @@ namespace OpenGLRenderer
 			// Initialize the capabilities
 			initializeCapabilities();
 
+			// Create the pool of pixel unpack buffers used for asynchronous texture uploads
+			if (mContext->getExtensions().isGL_ARB_pixel_buffer_object())
+			{
+				mPixelUnpackBufferPool = new (getAllocator()) PixelUnpackBufferPool(*this);
+			}
+
 			// Add references to the default state objects and set them
 			if (nullptr != mDefaultRasterizerState)
 			{
@@ -232,6 +263,20 @@ namespace OpenGLRenderer
 			omSetBlendState(nullptr);
 		}
 
+		// Destroy the pool of pixel unpack buffers, in case we have one
+		if (nullptr != mPixelUnpackBufferPool)
+		{
+			delete mPixelUnpackBufferPool;
+			mPixelUnpackBufferPool = nullptr;
+		}
+
+		// Destroy the OpenGL stream output query, in case we have one
+		if (0 != mOpenGLStreamOutputQuery)
+		{
+			glDeleteQueriesARB(1, &mOpenGLStreamOutputQuery);
+			mOpenGLStreamOutputQuery = 0;
+		}
+
 		{ // For debugging: At this point there should be no resource instances left, validate this!
 			// -> Are the currently any resource instances?
 			const unsigned long numberOfCurrentResources = getStatistics().getNumberOfCurrentResources();
@@ -370,7 +415,7 @@ namespace OpenGLRenderer
 						// If required, create the GLSL shader language instance right now
 						if (nullptr == mShaderLanguageGlsl)
 						{
-							mShaderLanguageGlsl = new ShaderLanguageGlsl(*this);
+							mShaderLanguageGlsl = new (getAllocator()) ShaderLanguageGlsl(*this);
 							mShaderLanguageGlsl->addReference();	// Internal renderer reference
 						}
 
@@ -387,7 +432,7 @@ namespace OpenGLRenderer
 							// If required, create the Cg shader language instance right now
 							if (nullptr == mShaderLanguageCg)
 							{
-								mShaderLanguageCg = new ShaderLanguageCg(*this);
+								mShaderLanguageCg = new (getAllocator()) ShaderLanguageCg(*this);
 								mShaderLanguageCg->addReference();	// Internal renderer reference
 							}
 
@@ -415,7 +460,7 @@ namespace OpenGLRenderer
 	Renderer::ISwapChain *OpenGLRenderer::createSwapChain(handle nativeWindowHandle)
 	{
 		// The provided native window handle must not be a null handle
-		return (NULL_HANDLE != nativeWindowHandle) ? new SwapChain(*this, nativeWindowHandle) : nullptr;
+		return (NULL_HANDLE != nativeWindowHandle) ? new (getAllocator()) SwapChain(*this, nativeWindowHandle) : nullptr;
 	}
 
 	Renderer::IFramebuffer *OpenGLRenderer::createFramebuffer(unsigned int numberOfColorTextures, Renderer::ITexture **colorTextures, Renderer::ITexture *depthStencilTexture)
@@ -428,13 +473,13 @@ namespace OpenGLRenderer
 			{
 				// Effective direct state access (DSA)
 				// -> Validation is done inside the framebuffer implementation
-				return new FramebufferDsa(*this, numberOfColorTextures, colorTextures, depthStencilTexture);
+				return new (getAllocator()) FramebufferDsa(*this, numberOfColorTextures, colorTextures, depthStencilTexture);
 			}
 			else
 			{
 				// Traditional bind version
 				// -> Validation is done inside the framebuffer implementation
-				return new FramebufferBind(*this, numberOfColorTextures, colorTextures, depthStencilTexture);
+				return new (getAllocator()) FramebufferBind(*this, numberOfColorTextures, colorTextures, depthStencilTexture);
 			}
 		}
 		else
@@ -453,12 +498,12 @@ namespace OpenGLRenderer
 			if (mContext->getExtensions().isGL_EXT_direct_state_access())
 			{
 				// Effective direct state access (DSA)
-				return new VertexBufferDsa(*this, numberOfBytes, data, bufferUsage);
+				return new (mVertexBufferPool) VertexBufferDsa(*this, numberOfBytes, data, bufferUsage);
 			}
 			else
 			{
 				// Traditional bind version
-				return new VertexBufferBind(*this, numberOfBytes, data, bufferUsage);
+				return new (mVertexBufferPool) VertexBufferBind(*this, numberOfBytes, data, bufferUsage);
 			}
 		}
 		else
@@ -477,12 +522,12 @@ namespace OpenGLRenderer
 			if (mContext->getExtensions().isGL_EXT_direct_state_access())
 			{
 				// Effective direct state access (DSA)
-				return new IndexBufferDsa(*this, numberOfBytes, indexBufferFormat, data, bufferUsage);
+				return new (mIndexBufferPool) IndexBufferDsa(*this, numberOfBytes, indexBufferFormat, data, bufferUsage);
 			}
 			else
 			{
 				// Traditional bind version
-				return new IndexBufferBind(*this, numberOfBytes, indexBufferFormat, data, bufferUsage);
+				return new (mIndexBufferPool) IndexBufferBind(*this, numberOfBytes, indexBufferFormat, data, bufferUsage);
 			}
 		}
 		else
@@ -501,12 +546,12 @@ namespace OpenGLRenderer
 			if (mContext->getExtensions().isGL_EXT_direct_state_access())
 			{
 				// Effective direct state access (DSA)
-				return new TextureBufferDsa(*this, numberOfBytes, textureFormat, data, bufferUsage);
+				return new (mTextureBufferPool) TextureBufferDsa(*this, numberOfBytes, textureFormat, data, bufferUsage);
 			}
 			else
 			{
 				// Traditional bind version
-				return new TextureBufferBind(*this, numberOfBytes, textureFormat, data, bufferUsage);
+				return new (mTextureBufferPool) TextureBufferBind(*this, numberOfBytes, textureFormat, data, bufferUsage);
 			}
 		}
 		else
@@ -516,23 +561,54 @@ namespace OpenGLRenderer
 		}
 	}
 
-	Renderer::ITexture2D *OpenGLRenderer::createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum)
+	Renderer::IIndirectBuffer *OpenGLRenderer::createIndirectBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
+	{
+		// Is "GL_ARB_draw_indirect" there?
+		if (mContext->getExtensions().isGL_ARB_draw_indirect())
+		{
+			// Is "GL_EXT_direct_state_access" there?
+			if (mContext->getExtensions().isGL_EXT_direct_state_access())
+			{
+				// Effective direct state access (DSA)
+				return new (mIndirectBufferPool) IndirectBufferDsa(*this, numberOfBytes, data, bufferUsage);
+			}
+			else
+			{
+				// Traditional bind version
+				return new (mIndirectBufferPool) IndirectBufferBind(*this, numberOfBytes, data, bufferUsage);
+			}
+		}
+		else
+		{
+			// Emulate the indirect buffer within system memory, see "OpenGLRenderer::multiDrawIndexedIndirect()"
+			return new (mIndirectBufferPool) IndirectBufferEmulation(*this, numberOfBytes, data, bufferUsage);
+		}
+	}
+
+	Renderer::ITexture2D *OpenGLRenderer::createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum, unsigned int numberOfMultisamples)
 	{
 		// The indication of the texture usage is only relevant for Direct3D, OpenGL has no texture usage indication
 
-		// Check whether or not the given texture dimension is valid
-		if (width > 0 && height > 0)
+		// Check whether or not the given texture dimension and number of multisamples is valid
+		if (width > 0 && height > 0 && numberOfMultisamples > 0 && numberOfMultisamples <= mCapabilities.maximumNumberOfMultisamples)
 		{
+			// Multisample texture?
+			if (numberOfMultisamples > 1)
+			{
+				// "GL_EXT_direct_state_access" has no multisample texture image function, so we always use the traditional bind version
+				return new (mTexture2DPool) Texture2DBind(*this, width, height, textureFormat, data, flags, numberOfMultisamples);
+			}
+
 			// Is "GL_EXT_direct_state_access" there?
-			if (mContext->getExtensions().isGL_EXT_direct_state_access())
+			else if (mContext->getExtensions().isGL_EXT_direct_state_access())
 			{
 				// Effective direct state access (DSA)
-				return new Texture2DDsa(*this, width, height, textureFormat, data, flags);
+				return new (mTexture2DPool) Texture2DDsa(*this, width, height, textureFormat, data, flags);
 			}
 			else
 			{
 				// Traditional bind version
-				return new Texture2DBind(*this, width, height, textureFormat, data, flags);
+				return new (mTexture2DPool) Texture2DBind(*this, width, height, textureFormat, data, flags);
 			}
 		}
 		else
@@ -552,12 +628,12 @@ namespace OpenGLRenderer
 			if (mContext->getExtensions().isGL_EXT_direct_state_access())
 			{
 				// Effective direct state access (DSA)
-				return new Texture2DArrayDsa(*this, width, height, numberOfSlices, textureFormat, data, flags);
+				return new (mTexture2DArrayPool) Texture2DArrayDsa(*this, width, height, numberOfSlices, textureFormat, data, flags);
 			}
 			else
 			{
 				// Traditional bind version
-				return new Texture2DArrayBind(*this, width, height, numberOfSlices, textureFormat, data, flags);
+				return new (mTexture2DArrayPool) Texture2DArrayBind(*this, width, height, numberOfSlices, textureFormat, data, flags);
 			}
 		}
 		else
@@ -568,17 +644,17 @@ namespace OpenGLRenderer
 
 	Renderer::IRasterizerState *OpenGLRenderer::createRasterizerState(const Renderer::RasterizerState &rasterizerState)
 	{
-		return new RasterizerState(*this, rasterizerState);
+		return new (mRasterizerStatePool) RasterizerState(*this, rasterizerState);
 	}
 
 	Renderer::IDepthStencilState *OpenGLRenderer::createDepthStencilState(const Renderer::DepthStencilState &depthStencilState)
 	{
-		return new DepthStencilState(*this, depthStencilState);
+		return new (mDepthStencilStatePool) DepthStencilState(*this, depthStencilState);
 	}
 
 	Renderer::IBlendState *OpenGLRenderer::createBlendState(const Renderer::BlendState &blendState)
 	{
-		return new BlendState(*this, blendState);
+		return new (mBlendStatePool) BlendState(*this, blendState);
 	}
 
 	Renderer::ISamplerState *OpenGLRenderer::createSamplerState(const Renderer::SamplerState &samplerState)
@@ -587,7 +663,7 @@ namespace OpenGLRenderer
 		if (mContext->getExtensions().isGL_ARB_sampler_objects())
 		{
 			// Effective sampler object (SO)
-			return new SamplerStateSo(*this, samplerState);
+			return new (mSamplerStatePool) SamplerStateSo(*this, samplerState);
 		}
 		else
 		{
@@ -595,39 +671,210 @@ namespace OpenGLRenderer
 			if (mContext->getExtensions().isGL_EXT_direct_state_access())
 			{
 				// Direct state access (DSA) version to emulate a sampler object
-				return new SamplerStateDsa(*this, samplerState);
+				return new (mSamplerStatePool) SamplerStateDsa(*this, samplerState);
 			}
 			else
 			{
 				// Traditional bind version to emulate a sampler object
-				return new SamplerStateBind(*this, samplerState);
+				return new (mSamplerStatePool) SamplerStateBind(*this, samplerState);
 			}
 		}
 	}
 
 	Renderer::ITextureCollection *OpenGLRenderer::createTextureCollection(unsigned int numberOfTextures, Renderer::ITexture **textures)
 	{
-		return new TextureCollection(*this, numberOfTextures, textures);
+		return new (mTextureCollectionPool) TextureCollection(*this, numberOfTextures, textures);
 	}
 
 	Renderer::ISamplerStateCollection *OpenGLRenderer::createSamplerStateCollection(unsigned int numberOfSamplerStates, Renderer::ISamplerState **samplerStates)
 	{
-		return new SamplerStateCollection(*this, numberOfSamplerStates, samplerStates);
+		return new (mSamplerStateCollectionPool) SamplerStateCollection(*this, numberOfSamplerStates, samplerStates);
 	}
 
 
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
-	bool OpenGLRenderer::map(Renderer::IResource &, unsigned int, Renderer::MapType::Enum, unsigned int, Renderer::MappedSubresource &)
+	bool OpenGLRenderer::map(Renderer::IResource &resource, unsigned int, Renderer::MapType::Enum mapType, unsigned int, Renderer::MappedSubresource &mappedSubresource)
+	{
+		// TODO(co) Map support for the remaining resource types
+
+		// Evaluate the resource type
+		switch (resource.getResourceType())
+		{
+			case Renderer::ResourceType::INDEX_BUFFER:
+				// OpenGL buffer objects are not bound to a specific target, so we can use the array buffer target for mapping
+				// -> Binding to the element array buffer target would change the state of the currently bound vertex array object
+				return mapOpenGLBuffer(GL_ARRAY_BUFFER_ARB, static_cast<IndexBuffer&>(resource).getOpenGLElementArrayBuffer(), mapType, 0, 0, mappedSubresource);
+
+			case Renderer::ResourceType::VERTEX_BUFFER:
+				return mapOpenGLBuffer(GL_ARRAY_BUFFER_ARB, static_cast<VertexBuffer&>(resource).getOpenGLArrayBuffer(), mapType, 0, 0, mappedSubresource);
+
+			case Renderer::ResourceType::TEXTURE_2D:
+			{
+				// Only the pixel pack buffer filled by "Renderer::IRenderer::copyResource()" can be mapped
+				const Texture2D &texture2D = static_cast<Texture2D&>(resource);
+				const unsigned int rowPitch = texture2D.getWidth() * Mapping::getOpenGLSize(texture2D.getTextureFormat());
+				return mapOpenGLBuffer(GL_PIXEL_PACK_BUFFER_ARB, texture2D.getOpenGLPixelPackBuffer(), mapType, rowPitch, rowPitch * texture2D.getHeight(), mappedSubresource);
+			}
+
+			case Renderer::ResourceType::PROGRAM:
+			case Renderer::ResourceType::VERTEX_ARRAY:
+			case Renderer::ResourceType::SWAP_CHAIN:
+			case Renderer::ResourceType::FRAMEBUFFER:
+			case Renderer::ResourceType::UNIFORM_BUFFER:
+			case Renderer::ResourceType::INDIRECT_BUFFER:
+			case Renderer::ResourceType::TEXTURE_BUFFER:
+			case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+			case Renderer::ResourceType::RASTERIZER_STATE:
+			case Renderer::ResourceType::DEPTH_STENCIL_STATE:
+			case Renderer::ResourceType::BLEND_STATE:
+			case Renderer::ResourceType::SAMPLER_STATE:
+			case Renderer::ResourceType::VERTEX_SHADER:
+			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
+			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
+			case Renderer::ResourceType::GEOMETRY_SHADER:
+			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
+			case Renderer::ResourceType::TEXTURE_COLLECTION:
+			case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+			case Renderer::ResourceType::FENCE:
+			default:
+				// Nothing we can map, set known return values
+				mappedSubresource.data		 = nullptr;
+				mappedSubresource.rowPitch   = 0;
+				mappedSubresource.depthPitch = 0;
+
+				// Error!
+				return false;
+		}
+	}
+
+	void OpenGLRenderer::unmap(Renderer::IResource &resource, unsigned int)
 	{
-		// TODO(co) Implement me
-		return false;
+		// Evaluate the resource type
+		switch (resource.getResourceType())
+		{
+			case Renderer::ResourceType::INDEX_BUFFER:
+				unmapOpenGLBuffer(GL_ARRAY_BUFFER_ARB, static_cast<IndexBuffer&>(resource).getOpenGLElementArrayBuffer());
+				break;
+
+			case Renderer::ResourceType::VERTEX_BUFFER:
+				unmapOpenGLBuffer(GL_ARRAY_BUFFER_ARB, static_cast<VertexBuffer&>(resource).getOpenGLArrayBuffer());
+				break;
+
+			case Renderer::ResourceType::TEXTURE_2D:
+				unmapOpenGLBuffer(GL_PIXEL_PACK_BUFFER_ARB, static_cast<Texture2D&>(resource).getOpenGLPixelPackBuffer());
+				break;
+
+			case Renderer::ResourceType::PROGRAM:
+			case Renderer::ResourceType::VERTEX_ARRAY:
+			case Renderer::ResourceType::SWAP_CHAIN:
+			case Renderer::ResourceType::FRAMEBUFFER:
+			case Renderer::ResourceType::UNIFORM_BUFFER:
+			case Renderer::ResourceType::INDIRECT_BUFFER:
+			case Renderer::ResourceType::TEXTURE_BUFFER:
+			case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+			case Renderer::ResourceType::RASTERIZER_STATE:
+			case Renderer::ResourceType::DEPTH_STENCIL_STATE:
+			case Renderer::ResourceType::BLEND_STATE:
+			case Renderer::ResourceType::SAMPLER_STATE:
+			case Renderer::ResourceType::VERTEX_SHADER:
+			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
+			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
+			case Renderer::ResourceType::GEOMETRY_SHADER:
+			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
+			case Renderer::ResourceType::TEXTURE_COLLECTION:
+			case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+			case Renderer::ResourceType::FENCE:
+			default:
+				// Nothing we can unmap
+				break;
+		}
 	}
 
-	void OpenGLRenderer::unmap(Renderer::IResource &, unsigned int)
+	bool OpenGLRenderer::copyResource(Renderer::IResource &destinationResource, Renderer::IResource &sourceResource)
 	{
-		// TODO(co) Implement me
+		// The resource types must match
+		if (destinationResource.getResourceType() != sourceResource.getResourceType())
+		{
+			// Error!
+			return false;
+		}
+
+		// Evaluate the resource type
+		switch (destinationResource.getResourceType())
+		{
+			case Renderer::ResourceType::INDEX_BUFFER:
+				return copyOpenGLBuffer(static_cast<IndexBuffer&>(destinationResource).getOpenGLElementArrayBuffer(), static_cast<IndexBuffer&>(sourceResource).getOpenGLElementArrayBuffer());
+
+			case Renderer::ResourceType::VERTEX_BUFFER:
+				return copyOpenGLBuffer(static_cast<VertexBuffer&>(destinationResource).getOpenGLArrayBuffer(), static_cast<VertexBuffer&>(sourceResource).getOpenGLArrayBuffer());
+
+			case Renderer::ResourceType::TEXTURE_2D:
+				// "GL_ARB_pixel_buffer_object" required
+				// -> The content is copied into the pixel pack buffer of the destination 2D texture, which can be mapped for reading
+				return (mContext->getExtensions().isGL_ARB_pixel_buffer_object() && static_cast<Texture2D&>(destinationResource).copyFromTexture2D(static_cast<Texture2D&>(sourceResource)));
+
+			case Renderer::ResourceType::PROGRAM:
+			case Renderer::ResourceType::VERTEX_ARRAY:
+			case Renderer::ResourceType::SWAP_CHAIN:
+			case Renderer::ResourceType::FRAMEBUFFER:
+			case Renderer::ResourceType::UNIFORM_BUFFER:
+			case Renderer::ResourceType::INDIRECT_BUFFER:
+			case Renderer::ResourceType::TEXTURE_BUFFER:
+			case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+			case Renderer::ResourceType::RASTERIZER_STATE:
+			case Renderer::ResourceType::DEPTH_STENCIL_STATE:
+			case Renderer::ResourceType::BLEND_STATE:
+			case Renderer::ResourceType::SAMPLER_STATE:
+			case Renderer::ResourceType::VERTEX_SHADER:
+			case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
+			case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
+			case Renderer::ResourceType::GEOMETRY_SHADER:
+			case Renderer::ResourceType::FRAGMENT_SHADER:
+			case Renderer::ResourceType::COMPUTE_SHADER:
+			case Renderer::ResourceType::TEXTURE_COLLECTION:
+			case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+			case Renderer::ResourceType::FENCE:
+			default:
+				// Error!
+				return false;
+		}
+	}
+
+	void OpenGLRenderer::setTextureResident(Renderer::ITexture &texture, Renderer::ISamplerState *samplerState, bool resident)
+	{
+		// "GL_ARB_bindless_texture" required
+		if (mCapabilities.bindlessTexture)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			OPENGLRENDERER_RENDERERMATCHCHECK_RETURN(*this, texture)
+
+			// Evaluate the resource type, the residency is reference counted by the bindless texture handles of the texture
+			switch (texture.getResourceType())
+			{
+				case Renderer::ResourceType::TEXTURE_2D:
+				{
+					Texture2D &texture2D = static_cast<Texture2D&>(texture);
+					texture2D.getBindlessTextureHandles().setResident(*this, texture2D.getOpenGLTexture(), samplerState, resident);
+					break;
+				}
+
+				case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+				{
+					Texture2DArray &texture2DArray = static_cast<Texture2DArray&>(texture);
+					texture2DArray.getBindlessTextureHandles().setResident(*this, texture2DArray.getOpenGLTexture(), samplerState, resident);
+					break;
+				}
+
+				case Renderer::ResourceType::TEXTURE_BUFFER:
+				default:
+					// Not supported
+					break;
+			}
+		}
 	}
 
 
@@ -927,6 +1174,135 @@ namespace OpenGLRenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Stream-output (SO) stage                              ]
+	//[-------------------------------------------------------]
+	void OpenGLRenderer::soSetTargets(unsigned int numberOfTargets, Renderer::IVertexBuffer **vertexBuffers, const unsigned int *offsets)
+	{
+		// Is there stream output support?
+		if (0 == mCapabilities.maximumNumberOfStreamOutputTargets)
+		{
+			// Error! There's no stream output support!
+			return;
+		}
+
+		// Security check: Are the given vertex buffers valid?
+		if (nullptr == vertexBuffers)
+		{
+			numberOfTargets = 0;
+		}
+		else if (numberOfTargets > mCapabilities.maximumNumberOfStreamOutputTargets)
+		{
+			numberOfTargets = mCapabilities.maximumNumberOfStreamOutputTargets;
+		}
+
+		// Bind the OpenGL array buffers to the transform feedback binding points
+		for (unsigned int i = 0; i < numberOfTargets; ++i)
+		{
+			VertexBuffer *vertexBuffer = static_cast<VertexBuffer*>(vertexBuffers[i]);
+			if (nullptr != vertexBuffer)
+			{
+				// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+				OPENGLRENDERER_RENDERERMATCHCHECK_RETURN(*this, *vertexBuffer)
+
+				// Bind the buffer, "glBindBufferOffsetEXT()" is used for a non-zero start offset
+				if (nullptr != offsets && 0 != offsets[i])
+				{
+					glBindBufferOffsetEXT(GL_TRANSFORM_FEEDBACK_BUFFER_EXT, i, vertexBuffer->getOpenGLArrayBuffer(), static_cast<GLintptr>(offsets[i]));
+				}
+				else
+				{
+					glBindBufferBaseEXT(GL_TRANSFORM_FEEDBACK_BUFFER_EXT, i, vertexBuffer->getOpenGLArrayBuffer());
+				}
+			}
+			else
+			{
+				glBindBufferBaseEXT(GL_TRANSFORM_FEEDBACK_BUFFER_EXT, i, 0);
+			}
+		}
+
+		// Unbind the remaining previously set targets
+		for (unsigned int i = numberOfTargets; i < mNumberOfStreamOutputTargets; ++i)
+		{
+			glBindBufferBaseEXT(GL_TRANSFORM_FEEDBACK_BUFFER_EXT, i, 0);
+		}
+		mNumberOfStreamOutputTargets = numberOfTargets;
+	}
+
+	void OpenGLRenderer::soBegin(Renderer::PrimitiveTopology::Enum primitiveTopology, bool rasterizerDiscard)
+	{
+		// Is there stream output support?
+		if (0 == mCapabilities.maximumNumberOfStreamOutputTargets)
+		{
+			// Error! There's no stream output support!
+			return;
+		}
+
+		// Map the primitive topology to the OpenGL transform feedback primitive mode
+		GLenum openGLPrimitiveMode = GL_POINTS;
+		switch (primitiveTopology)
+		{
+			case Renderer::PrimitiveTopology::POINT_LIST:
+				openGLPrimitiveMode = GL_POINTS;
+				mNumberOfStreamOutputVerticesPerPrimitive = 1;
+				break;
+
+			case Renderer::PrimitiveTopology::LINE_LIST:
+				openGLPrimitiveMode = GL_LINES;
+				mNumberOfStreamOutputVerticesPerPrimitive = 2;
+				break;
+
+			case Renderer::PrimitiveTopology::TRIANGLE_LIST:
+				openGLPrimitiveMode = GL_TRIANGLES;
+				mNumberOfStreamOutputVerticesPerPrimitive = 3;
+				break;
+
+			default:
+				// Error! Transform feedback is only able to write point, line and triangle lists!
+				return;
+		}
+
+		// Create the OpenGL query counting the written primitives, in case we don't have one, yet
+		if (0 == mOpenGLStreamOutputQuery)
+		{
+			glGenQueriesARB(1, &mOpenGLStreamOutputQuery);
+		}
+
+		// Discard the primitives after the transform feedback?
+		mStreamOutputRasterizerDiscard = rasterizerDiscard;
+		if (mStreamOutputRasterizerDiscard)
+		{
+			glEnable(GL_RASTERIZER_DISCARD_EXT);
+		}
+
+		// Begin the transform feedback
+		glBeginQueryARB(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN_EXT, mOpenGLStreamOutputQuery);
+		glBeginTransformFeedbackEXT(openGLPrimitiveMode);
+	}
+
+	void OpenGLRenderer::soEnd()
+	{
+		// Is there stream output support?
+		if (0 == mCapabilities.maximumNumberOfStreamOutputTargets)
+		{
+			// Error! There's no stream output support!
+			return;
+		}
+
+		// End the transform feedback
+		// -> We don't read back the number of written primitives in here, this would stall the CPU, "OpenGLRenderer::drawAuto()" is doing this on demand
+		glEndTransformFeedbackEXT();
+		glEndQueryARB(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN_EXT);
+
+		// Enable the rasterizer again, in case it was disabled
+		if (mStreamOutputRasterizerDiscard)
+		{
+			glDisable(GL_RASTERIZER_DISCARD_EXT);
+			mStreamOutputRasterizerDiscard = false;
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Rasterizer (RS) stage                                 ]
 	//[-------------------------------------------------------]
@@ -1068,8 +1444,12 @@ namespace OpenGLRenderer
 						break;
 
 					case Renderer::ResourceType::TEXTURE_2D:
-						glBindMultiTextureEXT(unit, GL_TEXTURE_2D, static_cast<Texture2D*>(texture)->getOpenGLTexture());
+					{
+						// Multisample textures are bound to "GL_TEXTURE_2D_MULTISAMPLE"
+						const Texture2D *texture2D = static_cast<Texture2D*>(texture);
+						glBindMultiTextureEXT(unit, static_cast<GLenum>(texture2D->getOpenGLTextureTarget()), texture2D->getOpenGLTexture());
 						break;
+					}
 
 					case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 						// No extension check required, if we in here we already know it must exist
@@ -1083,6 +1463,7 @@ namespace OpenGLRenderer
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::UNIFORM_BUFFER:
+					case Renderer::ResourceType::INDIRECT_BUFFER:
 					case Renderer::ResourceType::RASTERIZER_STATE:
 					case Renderer::ResourceType::DEPTH_STENCIL_STATE:
 					case Renderer::ResourceType::BLEND_STATE:
@@ -1092,8 +1473,10 @@ namespace OpenGLRenderer
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 					case Renderer::ResourceType::TEXTURE_COLLECTION:
 					case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+					case Renderer::ResourceType::FENCE:
 					default:
 						// Not handled in here
 						break;
@@ -1136,8 +1519,12 @@ namespace OpenGLRenderer
 							break;
 
 						case Renderer::ResourceType::TEXTURE_2D:
-							glBindTexture(GL_TEXTURE_2D, static_cast<Texture2D*>(texture)->getOpenGLTexture());
+						{
+							// Multisample textures are bound to "GL_TEXTURE_2D_MULTISAMPLE"
+							const Texture2D *texture2D = static_cast<Texture2D*>(texture);
+							glBindTexture(static_cast<GLenum>(texture2D->getOpenGLTextureTarget()), texture2D->getOpenGLTexture());
 							break;
+						}
 
 						case Renderer::ResourceType::TEXTURE_2D_ARRAY:
 							// No extension check required, if we in here we already know it must exist
@@ -1151,6 +1538,7 @@ namespace OpenGLRenderer
 						case Renderer::ResourceType::INDEX_BUFFER:
 						case Renderer::ResourceType::VERTEX_BUFFER:
 						case Renderer::ResourceType::UNIFORM_BUFFER:
+						case Renderer::ResourceType::INDIRECT_BUFFER:
 						case Renderer::ResourceType::RASTERIZER_STATE:
 						case Renderer::ResourceType::DEPTH_STENCIL_STATE:
 						case Renderer::ResourceType::BLEND_STATE:
@@ -1160,8 +1548,10 @@ namespace OpenGLRenderer
 						case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 						case Renderer::ResourceType::GEOMETRY_SHADER:
 						case Renderer::ResourceType::FRAGMENT_SHADER:
+						case Renderer::ResourceType::COMPUTE_SHADER:
 						case Renderer::ResourceType::TEXTURE_COLLECTION:
 						case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+						case Renderer::ResourceType::FENCE:
 						default:
 							// Not handled in here
 							break;
@@ -1204,71 +1594,34 @@ namespace OpenGLRenderer
 			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
 			OPENGLRENDERER_RENDERERMATCHCHECK_RETURN(*this, *textureCollection)
 
+			// The OpenGL textures and texture targets were already resolved when the texture collection was created
+			// -> Security check: Is the given resource owned by this renderer?
+			//    Not required for the textures inside the texture collection, this is already done within the texture collection
+			const TextureCollection *openGLTextureCollection = static_cast<TextureCollection*>(textureCollection);
+			const unsigned int numberOfTextures = openGLTextureCollection->getNumberOfTextures();
+			const GLuint *openGLTextures = openGLTextureCollection->getOpenGLTextures();
+			const GLuint *openGLTextureTargets = openGLTextureCollection->getOpenGLTextureTargets();
+
+			// TODO(co) Some security checks might be wise *maximum number of texture units*
+			// Is "GL_ARB_multi_bind" there?
+			if (mContext->getExtensions().isGL_ARB_multi_bind())
+			{
+				// Effective multi-bind, bind all textures using a single call
+				// -> Each texture is bound to its own texture target, texture 0 unbinds all texture targets of a unit
+				glBindTextures(startUnit, static_cast<GLsizei>(numberOfTextures), openGLTextures);
+			}
+
 			// Is "GL_EXT_direct_state_access" there?
-			if (mContext->getExtensions().isGL_EXT_direct_state_access())
+			else if (mContext->getExtensions().isGL_EXT_direct_state_access())
 			{
-				// Effective direct state access (DSA)
+				// Direct state access (DSA)
 
 				// Loop through all textures within the given texture collection
 				// -> "GL_TEXTURE0_ARB" is the first texture unit, while nUnit we received is zero based
-				Renderer::ITexture **currentTexture = static_cast<TextureCollection*>(textureCollection)->getTextures();
-				Renderer::ITexture **textureEnd	    = currentTexture + static_cast<TextureCollection*>(textureCollection)->getNumberOfTextures();
-				for (GLenum unit = static_cast<GLenum>(GL_TEXTURE0_ARB + startUnit); currentTexture < textureEnd; ++currentTexture, ++unit)
+				const GLenum unit = static_cast<GLenum>(GL_TEXTURE0_ARB + startUnit);
+				for (unsigned int i = 0; i < numberOfTextures; ++i)
 				{
-					// Get the current texture
-					Renderer::ITexture *texture = *currentTexture;
-
-					// TODO(co) Some security checks might be wise *maximum number of texture units*
-					// Set a texture at that unit?
-					if (nullptr != texture)
-					{
-						// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
-						// -> Not required in here, this is already done within the texture collection
-
-						// Evaluate the texture type
-						switch (texture->getResourceType())
-						{
-							case Renderer::ResourceType::TEXTURE_BUFFER:
-								glBindMultiTextureEXT(unit, GL_TEXTURE_BUFFER_ARB, static_cast<TextureBuffer*>(texture)->getOpenGLTexture());
-								break;
-
-							case Renderer::ResourceType::TEXTURE_2D:
-								glBindMultiTextureEXT(unit, GL_TEXTURE_2D, static_cast<Texture2D*>(texture)->getOpenGLTexture());
-								break;
-
-							case Renderer::ResourceType::TEXTURE_2D_ARRAY:
-								// No extension check required, if we in here we already know it must exist
-								glBindMultiTextureEXT(unit, GL_TEXTURE_2D_ARRAY_EXT, static_cast<Texture2DArray*>(texture)->getOpenGLTexture());
-								break;
-
-							case Renderer::ResourceType::PROGRAM:
-							case Renderer::ResourceType::VERTEX_ARRAY:
-							case Renderer::ResourceType::SWAP_CHAIN:
-							case Renderer::ResourceType::FRAMEBUFFER:
-							case Renderer::ResourceType::INDEX_BUFFER:
-							case Renderer::ResourceType::VERTEX_BUFFER:
-							case Renderer::ResourceType::UNIFORM_BUFFER:
-							case Renderer::ResourceType::RASTERIZER_STATE:
-							case Renderer::ResourceType::DEPTH_STENCIL_STATE:
-							case Renderer::ResourceType::BLEND_STATE:
-							case Renderer::ResourceType::SAMPLER_STATE:
-							case Renderer::ResourceType::VERTEX_SHADER:
-							case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
-							case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
-							case Renderer::ResourceType::GEOMETRY_SHADER:
-							case Renderer::ResourceType::FRAGMENT_SHADER:
-							case Renderer::ResourceType::TEXTURE_COLLECTION:
-							case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
-							default:
-								// Not handled in here
-								break;
-						}
-					}
-					else
-					{
-						// Unbind the texture at the given texture unit
-						glBindMultiTextureEXT(unit, GL_TEXTURE_2D, 0);
-					}
+					glBindMultiTextureEXT(unit + i, openGLTextureTargets[i], openGLTextures[i]);
 				}
 			}
 			else
@@ -1286,66 +1639,11 @@ namespace OpenGLRenderer
 
 					// Loop through all textures within the given texture collection
 					// -> GL_TEXTURE0_ARB is the first texture unit, while nUnit we received is zero based
-					Renderer::ITexture **currentTexture = static_cast<TextureCollection*>(textureCollection)->getTextures();
-					Renderer::ITexture **textureEnd	    = currentTexture + static_cast<TextureCollection*>(textureCollection)->getNumberOfTextures();
-					for (GLenum unit = static_cast<GLenum>(GL_TEXTURE0_ARB + startUnit); currentTexture < textureEnd; ++currentTexture, ++unit)
+					const GLenum unit = static_cast<GLenum>(GL_TEXTURE0_ARB + startUnit);
+					for (unsigned int i = 0; i < numberOfTextures; ++i)
 					{
-						// Get the current texture
-						Renderer::ITexture *texture = *currentTexture;
-
-						// TODO(co) Some security checks might be wise *maximum number of texture units*
-						glActiveTextureARB(unit);
-
-						// Set a texture at that unit?
-						if (nullptr != texture)
-						{
-							// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
-							// -> Not required in here, this is already done within the texture collection
-
-							// Evaluate the texture
-							switch (texture->getResourceType())
-							{
-								case Renderer::ResourceType::TEXTURE_BUFFER:
-									glBindTexture(GL_TEXTURE_BUFFER_ARB, static_cast<TextureBuffer*>(texture)->getOpenGLTexture());
-									break;
-
-								case Renderer::ResourceType::TEXTURE_2D:
-									glBindTexture(GL_TEXTURE_2D, static_cast<Texture2D*>(texture)->getOpenGLTexture());
-									break;
-
-								case Renderer::ResourceType::TEXTURE_2D_ARRAY:
-									// No extension check required, if we in here we already know it must exist
-									glBindTexture(GL_TEXTURE_2D_ARRAY_EXT, static_cast<Texture2DArray*>(texture)->getOpenGLTexture());
-									break;
-
-								case Renderer::ResourceType::PROGRAM:
-								case Renderer::ResourceType::VERTEX_ARRAY:
-								case Renderer::ResourceType::SWAP_CHAIN:
-								case Renderer::ResourceType::FRAMEBUFFER:
-								case Renderer::ResourceType::INDEX_BUFFER:
-								case Renderer::ResourceType::VERTEX_BUFFER:
-								case Renderer::ResourceType::UNIFORM_BUFFER:
-								case Renderer::ResourceType::RASTERIZER_STATE:
-								case Renderer::ResourceType::DEPTH_STENCIL_STATE:
-								case Renderer::ResourceType::BLEND_STATE:
-								case Renderer::ResourceType::SAMPLER_STATE:
-								case Renderer::ResourceType::VERTEX_SHADER:
-								case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
-								case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
-								case Renderer::ResourceType::GEOMETRY_SHADER:
-								case Renderer::ResourceType::FRAGMENT_SHADER:
-								case Renderer::ResourceType::TEXTURE_COLLECTION:
-								case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
-								default:
-									// Not handled in here
-									break;
-							}
-						}
-						else
-						{
-							// Unbind the texture at the given texture unit
-							glBindTexture(GL_TEXTURE_2D, 0);
-						}
+						glActiveTextureARB(unit + i);
+						glBindTexture(openGLTextureTargets[i], openGLTextures[i]);
 					}
 
 					#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
@@ -1426,16 +1724,24 @@ namespace OpenGLRenderer
 			{
 				// Effective sampler object (SO)
 
-				// Loop through all sampler states within the given sampler state collection
-				Renderer::ISamplerState **currentSamplerState = static_cast<SamplerStateCollection*>(samplerStateCollection)->getSamplerStates();
-				Renderer::ISamplerState **samplerStateEnd	  = currentSamplerState + static_cast<SamplerStateCollection*>(samplerStateCollection)->getNumberOfSamplerStates();
-				for (unsigned int unit = startUnit; currentSamplerState < samplerStateEnd; ++currentSamplerState, ++unit)
-				{
-					// Get the current sampler state
-					Renderer::ISamplerState *samplerState = *currentSamplerState;
+				// The OpenGL samplers were already resolved when the sampler state collection was created
+				const SamplerStateCollection *openGLSamplerStateCollection = static_cast<SamplerStateCollection*>(samplerStateCollection);
+				const unsigned int numberOfSamplerStates = openGLSamplerStateCollection->getNumberOfSamplerStates();
+				const GLuint *openGLSamplers = openGLSamplerStateCollection->getOpenGLSamplers();
 
-					// Set a sampler state at that unit?
-					glBindSampler(unit, (nullptr != samplerState) ? static_cast<SamplerStateSo*>(samplerState)->getOpenGLSampler() : 0);
+				// Is "GL_ARB_multi_bind" there?
+				if (mContext->getExtensions().isGL_ARB_multi_bind())
+				{
+					// Effective multi-bind, bind all samplers using a single call
+					glBindSamplers(startUnit, static_cast<GLsizei>(numberOfSamplerStates), openGLSamplers);
+				}
+				else
+				{
+					// Loop through all samplers within the given sampler state collection
+					for (unsigned int i = 0; i < numberOfSamplerStates; ++i)
+					{
+						glBindSampler(startUnit + i, openGLSamplers[i]);
+					}
 				}
 			}
 			else
@@ -1576,14 +1882,9 @@ namespace OpenGLRenderer
 				{
 					case Renderer::ResourceType::SWAP_CHAIN:
 					{
-					#ifdef LINUX
-						// TODO(sw) put this handling into Context? (e.g. Context::makeCurrent(Renderer::ISwapChain::getNativeWindowHandle()))
-						ContextLinux *context = static_cast<ContextLinux*>(mContext);
-						Display *display = context->getDisplay();
-						Renderer::ISwapChain *chain = static_cast<Renderer::ISwapChain*>(mRenderTarget);
-						glXMakeCurrent(context->getDisplay(), chain->getNativeWindowHandle(), context->getRenderContext());
-					#endif
-						// TODO(co) Implement me
+						// Bind the render context shared by all swap chains to the native window of the swap chain
+						// -> Switching between framebuffers and the swap chain the render context is already bound to only requires a framebuffer bind
+						static_cast<SwapChain*>(mRenderTarget)->makeCurrent();
 						break;
 					}
 
@@ -1615,6 +1916,7 @@ namespace OpenGLRenderer
 					case Renderer::ResourceType::INDEX_BUFFER:
 					case Renderer::ResourceType::VERTEX_BUFFER:
 					case Renderer::ResourceType::UNIFORM_BUFFER:
+					case Renderer::ResourceType::INDIRECT_BUFFER:
 					case Renderer::ResourceType::TEXTURE_BUFFER:
 					case Renderer::ResourceType::TEXTURE_2D:
 					case Renderer::ResourceType::TEXTURE_2D_ARRAY:
@@ -1627,8 +1929,10 @@ namespace OpenGLRenderer
 					case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
 					case Renderer::ResourceType::GEOMETRY_SHADER:
 					case Renderer::ResourceType::FRAGMENT_SHADER:
+					case Renderer::ResourceType::COMPUTE_SHADER:
 					case Renderer::ResourceType::TEXTURE_COLLECTION:
 					case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+					case Renderer::ResourceType::FENCE:
 					default:
 						// Not handled in here
 						break;
@@ -1752,6 +2056,125 @@ namespace OpenGLRenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Compute-shader (CS) stage                             ]
+	//[-------------------------------------------------------]
+	void OpenGLRenderer::csSetTexture(unsigned int unit, Renderer::ITexture *texture)
+	{
+		// In OpenGL, all shaders share the same texture units
+		fsSetTexture(unit, texture);
+	}
+
+	void OpenGLRenderer::csSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection)
+	{
+		// In OpenGL, all shaders share the same texture units
+		fsSetTextureCollection(startUnit, textureCollection);
+	}
+
+	void OpenGLRenderer::csSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState)
+	{
+		// In OpenGL, all shaders share the same texture units
+		fsSetSamplerState(unit, samplerState);
+	}
+
+	void OpenGLRenderer::csSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection)
+	{
+		// In OpenGL, all shaders share the same texture units
+		fsSetSamplerStateCollection(startUnit, samplerStateCollection);
+	}
+
+	void OpenGLRenderer::csSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer)
+	{
+		// In OpenGL a single program is set instead of individual shaders
+		// -> This means that there are uniform binding slots per program, not slots per shader as in e.g. Direct3D 10
+		// -> Reuse the fragment shader version of this method
+		fsSetUniformBuffer(slot, uniformBuffer);
+	}
+
+	void OpenGLRenderer::csSetUnorderedAccessView(unsigned int unit, Renderer::IResource *resource)
+	{
+		// Is there compute shader support? ("Renderer::Capabilities::computeShader" includes the image and shader storage extensions)
+		if (!mCapabilities.computeShader)
+		{
+			// Error! There's no compute shader support!
+			return;
+		}
+
+		// Set a resource at that unit?
+		if (nullptr != resource)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			OPENGLRENDERER_RENDERERMATCHCHECK_RETURN(*this, *resource)
+
+			// Evaluate the resource type
+			// -> Buffers are bound to the given shader storage buffer binding point ("layout(std430, binding=<x>) buffer" in GLSL)
+			// -> Textures are bound to the given image unit ("layout(rgba8, binding=<x>) uniform image2D" in GLSL)
+			switch (resource->getResourceType())
+			{
+				case Renderer::ResourceType::INDEX_BUFFER:
+					glBindBufferBaseEXT(GL_SHADER_STORAGE_BUFFER, unit, static_cast<IndexBuffer*>(resource)->getOpenGLElementArrayBuffer());
+					break;
+
+				case Renderer::ResourceType::VERTEX_BUFFER:
+					glBindBufferBaseEXT(GL_SHADER_STORAGE_BUFFER, unit, static_cast<VertexBuffer*>(resource)->getOpenGLArrayBuffer());
+					break;
+
+				case Renderer::ResourceType::UNIFORM_BUFFER:
+					// Only GLSL uniform buffers are backed by an OpenGL buffer object
+					if (UniformBuffer::InternalResourceType::GLSL == static_cast<UniformBuffer*>(resource)->getInternalResourceType())
+					{
+						glBindBufferBaseEXT(GL_SHADER_STORAGE_BUFFER, unit, static_cast<UniformBufferGlsl*>(resource)->getOpenGLUniformBuffer());
+					}
+					break;
+
+				case Renderer::ResourceType::TEXTURE_BUFFER:
+					glBindBufferBaseEXT(GL_SHADER_STORAGE_BUFFER, unit, static_cast<TextureBuffer*>(resource)->getOpenGLTextureBuffer());
+					break;
+
+				case Renderer::ResourceType::INDIRECT_BUFFER:
+					// An emulated indirect buffer has no OpenGL buffer object, in this case zero is bound
+					glBindBufferBaseEXT(GL_SHADER_STORAGE_BUFFER, unit, static_cast<IndirectBuffer*>(resource)->getOpenGLIndirectBuffer());
+					break;
+
+				case Renderer::ResourceType::TEXTURE_2D:
+				{
+					const Texture2D *texture2D = static_cast<Texture2D*>(resource);
+					glBindImageTexture(unit, texture2D->getOpenGLTexture(), 0, GL_FALSE, 0, GL_READ_WRITE, texture2D->getOpenGLInternalFormat());
+					break;
+				}
+
+				case Renderer::ResourceType::PROGRAM:
+				case Renderer::ResourceType::VERTEX_ARRAY:
+				case Renderer::ResourceType::SWAP_CHAIN:
+				case Renderer::ResourceType::FRAMEBUFFER:
+				case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+				case Renderer::ResourceType::RASTERIZER_STATE:
+				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
+				case Renderer::ResourceType::BLEND_STATE:
+				case Renderer::ResourceType::SAMPLER_STATE:
+				case Renderer::ResourceType::VERTEX_SHADER:
+				case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
+				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
+				case Renderer::ResourceType::GEOMETRY_SHADER:
+				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
+				case Renderer::ResourceType::TEXTURE_COLLECTION:
+				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
+				default:
+					// Not handled in here
+					break;
+			}
+		}
+		else
+		{
+			// Unbind both kinds of unordered access views at the given unit, we don't know which one was used
+			glBindBufferBaseEXT(GL_SHADER_STORAGE_BUFFER, unit, 0);
+			glBindImageTexture(unit, 0, 0, GL_FALSE, 0, GL_READ_WRITE, GL_RGBA8);
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Operations                                            ]
 	//[-------------------------------------------------------]
@@ -1822,6 +2245,82 @@ namespace OpenGLRenderer
 		// Not required when using OpenGL
 	}
 
+	void OpenGLRenderer::resolveMultisampleFramebuffer(Renderer::IRenderTarget &destinationRenderTarget, Renderer::IFramebuffer &sourceMultisampleFramebuffer)
+	{
+		// Is there multisample support? ("Renderer::Capabilities::maximumNumberOfMultisamples" includes the framebuffer blit extension)
+		if (mCapabilities.maximumNumberOfMultisamples <= 1)
+		{
+			// Error! There's no multisample support!
+			return;
+		}
+
+		// Security check: Are the given resources owned by this renderer? (calls "return" in case of a mismatch)
+		OPENGLRENDERER_RENDERERMATCHCHECK_RETURN(*this, destinationRenderTarget)
+		OPENGLRENDERER_RENDERERMATCHCHECK_RETURN(*this, sourceMultisampleFramebuffer)
+
+		// Get the source framebuffer dimension, source and destination must have the same dimension
+		const Framebuffer &sourceFramebuffer = static_cast<Framebuffer&>(sourceMultisampleFramebuffer);
+		unsigned int width  = 0;
+		unsigned int height = 0;
+		sourceFramebuffer.getWidthAndHeight(width, height);
+
+		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+			// Backup the currently bound OpenGL read and draw framebuffers
+			GLint openGLReadFramebufferBackup = 0;
+			glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &openGLReadFramebufferBackup);
+			GLint openGLDrawFramebufferBackup = 0;
+			glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &openGLDrawFramebufferBackup);
+		#endif
+
+		// Bind the OpenGL multisample framebuffer to read from
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, sourceFramebuffer.getOpenGLFramebuffer());
+
+		// Evaluate the destination render target type
+		if (Renderer::ResourceType::FRAMEBUFFER == destinationRenderTarget.getResourceType())
+		{
+			// Bind the OpenGL framebuffer to draw into
+			const Framebuffer &destinationFramebuffer = static_cast<Framebuffer&>(destinationRenderTarget);
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, destinationFramebuffer.getOpenGLFramebuffer());
+
+			// Resolve each color attachment into the destination color attachment at the same index
+			const unsigned int numberOfColorTextures = (sourceFramebuffer.getNumberOfColorTextures() < destinationFramebuffer.getNumberOfColorTextures()) ? sourceFramebuffer.getNumberOfColorTextures() : destinationFramebuffer.getNumberOfColorTextures();
+			for (unsigned int i = 0; i < numberOfColorTextures; ++i)
+			{
+				glReadBuffer(GL_COLOR_ATTACHMENT0 + i);
+				glDrawBuffer(GL_COLOR_ATTACHMENT0 + i);
+				glBlitFramebufferEXT(0, 0, static_cast<GLint>(width), static_cast<GLint>(height), 0, 0, static_cast<GLint>(width), static_cast<GLint>(height), GL_COLOR_BUFFER_BIT, GL_NEAREST);
+			}
+
+			// The draw buffers are part of the framebuffer state, restore the ones set within "OpenGLRenderer::omSetRenderTarget()"
+			if (mContext->getExtensions().isGL_ARB_draw_buffers())
+			{
+				GLenum openGLDrawBuffers[16];
+				const unsigned int numberOfDrawBuffers = (destinationFramebuffer.getNumberOfColorTextures() < 16) ? destinationFramebuffer.getNumberOfColorTextures() : 16;
+				for (unsigned int i = 0; i < numberOfDrawBuffers; ++i)
+				{
+					openGLDrawBuffers[i] = GL_COLOR_ATTACHMENT0 + i;
+				}
+				glDrawBuffersARB(static_cast<GLsizei>(numberOfDrawBuffers), openGLDrawBuffers);
+			}
+		}
+		else
+		{
+			// Resolve the first color attachment into the back buffer of the default framebuffer
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+			glReadBuffer(GL_COLOR_ATTACHMENT0);
+			glBlitFramebufferEXT(0, 0, static_cast<GLint>(width), static_cast<GLint>(height), 0, 0, static_cast<GLint>(width), static_cast<GLint>(height), GL_COLOR_BUFFER_BIT, GL_NEAREST);
+		}
+
+		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+			// Be polite and restore the previous bound OpenGL read and draw framebuffers
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(openGLReadFramebufferBackup));
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, static_cast<GLuint>(openGLDrawFramebufferBackup));
+		#else
+			// Rebind the OpenGL framebuffer of the currently set render target
+			glBindFramebuffer(GL_FRAMEBUFFER, (nullptr != mRenderTarget && Renderer::ResourceType::FRAMEBUFFER == mRenderTarget->getResourceType()) ? static_cast<Framebuffer*>(mRenderTarget)->getOpenGLFramebuffer() : 0);
+		#endif
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Draw call                                             ]
@@ -1850,12 +2349,10 @@ namespace OpenGLRenderer
 		}
 	}
 
-	void OpenGLRenderer::drawIndexed(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int, unsigned int)
+	void OpenGLRenderer::drawIndexed(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int minimumIndex, unsigned int numberOfVertices)
 	{
 		// Tessellation support: "glPatchParameteri()" is called within "OpenGLRenderer::iaSetPrimitiveTopology()"
 
-		// "minimumIndex" & "numberOfVertices" are currently not used, might be used later on with the "GL_EXT_draw_range_elements"-extension if it's useful
-
 		// Is currently an vertex array set?
 		if (nullptr != mVertexArray)
 		{
@@ -1863,24 +2360,41 @@ namespace OpenGLRenderer
 			IndexBuffer *indexBuffer = mVertexArray->getIndexBuffer();
 			if (nullptr != indexBuffer)
 			{
+				// The start index location is given in indices, OpenGL wants to have a byte offset
+				const GLvoid *indices = reinterpret_cast<const GLvoid*>(startIndexLocation * indexBuffer->getIndexSize());
+
 				// Use base vertex location?
 				if (baseVertexLocation > 0)
 				{
 					// Is the "GL_ARB_draw_elements_base_vertex" extension there?
 					if (mContext->getExtensions().isGL_ARB_draw_elements_base_vertex())
 					{
-						// Draw with base vertex location
-						glDrawElementsBaseVertex(mOpenGLPrimitiveTopology, static_cast<GLsizei>(numberOfIndices), indexBuffer->getOpenGLType(), reinterpret_cast<const GLvoid*>(startIndexLocation * sizeof(int)), static_cast<GLint>(baseVertexLocation));
+						// Draw with base vertex location, provide the driver with the referenced vertex range if we know it
+						if (numberOfVertices > 0)
+						{
+							glDrawRangeElementsBaseVertex(mOpenGLPrimitiveTopology, minimumIndex, minimumIndex + numberOfVertices - 1, static_cast<GLsizei>(numberOfIndices), indexBuffer->getOpenGLType(), indices, static_cast<GLint>(baseVertexLocation));
+						}
+						else
+						{
+							glDrawElementsBaseVertex(mOpenGLPrimitiveTopology, static_cast<GLsizei>(numberOfIndices), indexBuffer->getOpenGLType(), indices, static_cast<GLint>(baseVertexLocation));
+						}
 					}
 					else
 					{
 						// Error!
 					}
 				}
+
+				// Is the "GL_EXT_draw_range_elements" extension there and do we know the referenced vertex range?
+				else if (numberOfVertices > 0 && mContext->getExtensions().isGL_EXT_draw_range_elements())
+				{
+					// Draw without base vertex location, the driver can use "minimumIndex" & "numberOfVertices" to limit the vertex data it has to look at
+					glDrawRangeElementsEXT(mOpenGLPrimitiveTopology, minimumIndex, minimumIndex + numberOfVertices - 1, static_cast<GLsizei>(numberOfIndices), indexBuffer->getOpenGLType(), indices);
+				}
 				else
 				{
 					// Draw without base vertex location
-					glDrawElements(mOpenGLPrimitiveTopology, static_cast<GLsizei>(numberOfIndices), indexBuffer->getOpenGLType(), reinterpret_cast<const GLvoid*>(startIndexLocation * sizeof(int)));
+					glDrawElements(mOpenGLPrimitiveTopology, static_cast<GLsizei>(numberOfIndices), indexBuffer->getOpenGLType(), indices);
 				}
 			}
 		}
@@ -1890,7 +2404,7 @@ namespace OpenGLRenderer
 	{
 		// Tessellation support: "glPatchParameteri()" is called within "OpenGLRenderer::iaSetPrimitiveTopology()"
 
-		// "minimumIndex" & "numberOfVertices" are currently not used, might be used later on with the "GL_EXT_draw_range_elements"-extension if it's useful
+		// "minimumIndex" & "numberOfVertices" are not used, there's no instanced version of "glDrawRangeElements()"
 
 		// Is currently an vertex array set? Do also check for the required "GL_ARB_draw_instanced" extension.
 		if (nullptr != mVertexArray && mContext->getExtensions().isGL_ARB_draw_instanced())
@@ -1899,6 +2413,9 @@ namespace OpenGLRenderer
 			IndexBuffer *indexBuffer = mVertexArray->getIndexBuffer();
 			if (nullptr != indexBuffer)
 			{
+				// The start index location is given in indices, OpenGL wants to have a byte offset
+				const GLvoid *indices = reinterpret_cast<const GLvoid*>(startIndexLocation * indexBuffer->getIndexSize());
+
 				// Use base vertex location?
 				if (baseVertexLocation > 0)
 				{
@@ -1906,7 +2423,7 @@ namespace OpenGLRenderer
 					if (mContext->getExtensions().isGL_ARB_draw_elements_base_vertex())
 					{
 						// Draw with base vertex location
-						glDrawElementsInstancedBaseVertex(mOpenGLPrimitiveTopology, static_cast<GLsizei>(numberOfIndices), indexBuffer->getOpenGLType(), reinterpret_cast<const GLvoid*>(startIndexLocation * sizeof(int)), static_cast<GLsizei>(numberOfInstances), static_cast<GLint>(baseVertexLocation));
+						glDrawElementsInstancedBaseVertex(mOpenGLPrimitiveTopology, static_cast<GLsizei>(numberOfIndices), indexBuffer->getOpenGLType(), indices, static_cast<GLsizei>(numberOfInstances), static_cast<GLint>(baseVertexLocation));
 					}
 					else
 					{
@@ -1916,16 +2433,168 @@ namespace OpenGLRenderer
 				else
 				{
 					// Draw without base vertex location
-					glDrawElementsInstancedARB(mOpenGLPrimitiveTopology, static_cast<GLsizei>(numberOfIndices), indexBuffer->getOpenGLType(), reinterpret_cast<const GLvoid*>(startIndexLocation * sizeof(int)), static_cast<GLsizei>(numberOfInstances));
+					glDrawElementsInstancedARB(mOpenGLPrimitiveTopology, static_cast<GLsizei>(numberOfIndices), indexBuffer->getOpenGLType(), indices, static_cast<GLsizei>(numberOfInstances));
 				}
 			}
 		}
 	}
 
+	void OpenGLRenderer::multiDrawIndexedIndirect(Renderer::IIndirectBuffer &indirectBuffer, unsigned int indirectBufferOffset, unsigned int numberOfDraws)
+	{
+		// Tessellation support: "glPatchParameteri()" is called within "OpenGLRenderer::iaSetPrimitiveTopology()"
+
+		// Is currently an vertex array set and is there anything to draw at all?
+		if (nullptr != mVertexArray && numberOfDraws > 0)
+		{
+			// Security check: Is the given resource owned by this renderer? (calls "return" in case of a mismatch)
+			OPENGLRENDERER_RENDERERMATCHCHECK_RETURN(*this, indirectBuffer)
+
+			// Get the used index buffer
+			IndexBuffer *indexBuffer = mVertexArray->getIndexBuffer();
+			if (nullptr != indexBuffer)
+			{
+				const IndirectBuffer &openGLIndirectBuffer = static_cast<const IndirectBuffer&>(indirectBuffer);
+
+				// Is the indirect buffer emulated within system memory?
+				const unsigned char *emulationData = openGLIndirectBuffer.getEmulationData();
+				if (nullptr == emulationData)
+				{
+					// "GL_ARB_draw_indirect" is there, else there would be no OpenGL indirect buffer
+
+					#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+						// Backup the currently bound OpenGL indirect buffer
+						GLint openGLIndirectBufferBackup = 0;
+						glGetIntegerv(GL_DRAW_INDIRECT_BUFFER_BINDING, &openGLIndirectBufferBackup);
+					#endif
+
+					// Bind the OpenGL indirect buffer, the indirect buffer offset is passed as pointer
+					glBindBufferARB(GL_DRAW_INDIRECT_BUFFER, openGLIndirectBuffer.getOpenGLIndirectBuffer());
+
+					// Is the "GL_ARB_multi_draw_indirect" extension there?
+					if (mContext->getExtensions().isGL_ARB_multi_draw_indirect())
+					{
+						// All draws using a single OpenGL call, the arguments are tightly packed so the stride can be zero
+						glMultiDrawElementsIndirect(mOpenGLPrimitiveTopology, indexBuffer->getOpenGLType(), reinterpret_cast<const GLvoid*>(indirectBufferOffset), static_cast<GLsizei>(numberOfDraws), 0);
+					}
+					else
+					{
+						// One OpenGL call per draw, but at least there's no need to touch the draw arguments on the CPU side
+						for (unsigned int i = 0; i < numberOfDraws; ++i, indirectBufferOffset += sizeof(Renderer::DrawIndexedInstancedArguments))
+						{
+							glDrawElementsIndirect(mOpenGLPrimitiveTopology, indexBuffer->getOpenGLType(), reinterpret_cast<const GLvoid*>(indirectBufferOffset));
+						}
+					}
+
+					#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+						// Be polite and restore the previous bound OpenGL indirect buffer
+						glBindBufferARB(GL_DRAW_INDIRECT_BUFFER, static_cast<GLuint>(openGLIndirectBufferBackup));
+					#endif
+				}
+				else
+				{
+					// Emulate the multi-draw by using a loop, do not read behind the end of the emulation data
+					const unsigned int maximumNumberOfDraws = (indirectBufferOffset < openGLIndirectBuffer.getNumberOfBytes()) ? (openGLIndirectBuffer.getNumberOfBytes() - indirectBufferOffset) / sizeof(Renderer::DrawIndexedInstancedArguments) : 0;
+					const Renderer::DrawIndexedInstancedArguments *drawArguments = reinterpret_cast<const Renderer::DrawIndexedInstancedArguments*>(emulationData + indirectBufferOffset);
+					const Renderer::DrawIndexedInstancedArguments *drawArgumentsEnd = drawArguments + ((numberOfDraws < maximumNumberOfDraws) ? numberOfDraws : maximumNumberOfDraws);
+					for (; drawArguments < drawArgumentsEnd; ++drawArguments)
+					{
+						// Avoid the need for "GL_ARB_draw_instanced" if possible, "startInstanceLocation" is ignored
+						if (1 == drawArguments->instanceCount)
+						{
+							drawIndexed(drawArguments->startIndexLocation, drawArguments->indexCountPerInstance, drawArguments->baseVertexLocation, 0, 0);
+						}
+						else if (drawArguments->instanceCount > 1)
+						{
+							drawIndexedInstanced(drawArguments->startIndexLocation, drawArguments->indexCountPerInstance, drawArguments->baseVertexLocation, 0, 0, drawArguments->instanceCount);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void OpenGLRenderer::drawAuto()
+	{
+		// Is currently a vertex array set and was there a stream output, yet?
+		if (nullptr != mVertexArray && 0 != mNumberOfStreamOutputVerticesPerPrimitive)
+		{
+			// "GL_EXT_transform_feedback" has no "draw auto" ("GL_ARB_transform_feedback2"), so we ask the transform feedback primitives written query for the number of vertices
+			// -> In case the stream output has not finished, yet, this waits for the GPU
+			GLuint numberOfPrimitives = 0;
+			glGetQueryObjectuivARB(mOpenGLStreamOutputQuery, GL_QUERY_RESULT_ARB, &numberOfPrimitives);
+
+			// Draw
+			if (numberOfPrimitives > 0)
+			{
+				glDrawArrays(mOpenGLPrimitiveTopology, 0, static_cast<GLsizei>(numberOfPrimitives * mNumberOfStreamOutputVerticesPerPrimitive));
+			}
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Compute                                               ]
+	//[-------------------------------------------------------]
+	void OpenGLRenderer::dispatch(unsigned int groupCountX, unsigned int groupCountY, unsigned int groupCountZ)
+	{
+		// "GL_ARB_compute_shader" required
+		if (mCapabilities.computeShader)
+		{
+			// The compute program must have been set by using "Renderer::IRenderer::setProgram()"
+			glDispatchCompute(groupCountX, groupCountY, groupCountZ);
+		}
+	}
+
+	void OpenGLRenderer::memoryBarrier(unsigned int flags)
+	{
+		// "GL_ARB_shader_image_load_store" required
+		if (mCapabilities.computeShader)
+		{
+			// The "Renderer::MemoryBarrierFlag::Enum" values directly map to OpenGL constants, do not change them
+			glMemoryBarrier(flags);
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Synchronization                                       ]
 	//[-------------------------------------------------------]
+	Renderer::IFence *OpenGLRenderer::insertFence()
+	{
+		// "GL_ARB_sync" required
+		return mContext->getExtensions().isGL_ARB_sync() ? new (getAllocator()) Fence(*this) : nullptr;
+	}
+
+	bool OpenGLRenderer::isFenceSignaled(Renderer::IFence &fence)
+	{
+		// Poll the OpenGL sync object without waiting
+		// -> Flush the command stream, else the fence might never be signaled
+		const GLsync openGLSync = static_cast<GLsync>(static_cast<Fence&>(fence).getOpenGLSync());
+		if (nullptr != openGLSync)
+		{
+			const GLenum openGLResult = glClientWaitSync(openGLSync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+			return (GL_ALREADY_SIGNALED == openGLResult || GL_CONDITION_SATISFIED == openGLResult);
+		}
+
+		// Error!
+		return false;
+	}
+
+	bool OpenGLRenderer::waitFence(Renderer::IFence &fence, unsigned int timeout)
+	{
+		const GLsync openGLSync = static_cast<GLsync>(static_cast<Fence&>(fence).getOpenGLSync());
+		if (nullptr != openGLSync)
+		{
+			// The OpenGL timeout is in nanoseconds
+			const GLuint64 openGLTimeout = (~0u == timeout) ? ~static_cast<GLuint64>(0) : static_cast<GLuint64>(timeout) * 1000000;
+			const GLenum openGLResult = glClientWaitSync(openGLSync, GL_SYNC_FLUSH_COMMANDS_BIT, openGLTimeout);
+			return (GL_ALREADY_SIGNALED == openGLResult || GL_CONDITION_SATISFIED == openGLResult);
+		}
+
+		// Error!
+		return false;
+	}
+
 	void OpenGLRenderer::flush()
 	{
 		glFlush();
@@ -1937,6 +2606,24 @@ namespace OpenGLRenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Swap chain                                            ]
+	//[-------------------------------------------------------]
+	void OpenGLRenderer::presentSwapChains(unsigned int numberOfSwapChains, Renderer::ISwapChain **swapChains)
+	{
+		// Submit the commands of all native windows at once
+		// -> All swap chains are sharing a single render context and swapping the buffers of a native window does not
+		//    require the render context to be bound to it, so there's no need to switch the native window in here
+		glFlush();
+
+		// Swap the buffers of all native windows in a row
+		for (unsigned int i = 0; i < numberOfSwapChains; ++i)
+		{
+			swapChains[i]->present();
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Debug                                                 ]
 	//[-------------------------------------------------------]
@@ -2007,6 +2694,18 @@ namespace OpenGLRenderer
 			mCapabilities.maximumNumberOf2DTextureArraySlices = 0;
 		}
 
+		// Maximum number of multisamples per texel of a render target texture (always at least 1, usually 8)
+		// -> "OpenGLRenderer::resolveMultisampleFramebuffer()" requires "GL_EXT_framebuffer_blit"
+		if (mContext->getExtensions().isGL_ARB_texture_multisample() && mContext->getExtensions().isGL_ARB_framebuffer_object() && mContext->getExtensions().isGL_EXT_framebuffer_blit())
+		{
+			glGetIntegerv(GL_MAX_COLOR_TEXTURE_SAMPLES, &openGLValue);
+			mCapabilities.maximumNumberOfMultisamples = (openGLValue > 1) ? static_cast<unsigned int>(openGLValue) : 1u;
+		}
+		else
+		{
+			mCapabilities.maximumNumberOfMultisamples = 1;
+		}
+
 		// Uniform buffer object (UBO, "constant buffer" in Direct3D terminology) supported?
 		mCapabilities.uniformBuffer = mContext->getExtensions().isGL_ARB_uniform_buffer_object();
 
@@ -2036,6 +2735,12 @@ namespace OpenGLRenderer
 		// Base vertex supported for draw calls?
 		mCapabilities.baseVertex = mContext->getExtensions().isGL_ARB_draw_elements_base_vertex();
 
+		// Native multi-draw indirect supported? (else "OpenGLRenderer::multiDrawIndexedIndirect()" uses a loop, "GL_ARB_multi_draw_indirect" required)
+		mCapabilities.multiDrawIndirect = mContext->getExtensions().isGL_ARB_multi_draw_indirect();
+
+		// Bindless textures supported? ("GL_ARB_bindless_texture" required)
+		mCapabilities.bindlessTexture = mContext->getExtensions().isGL_ARB_bindless_texture();
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = mContext->getExtensions().isGL_ARB_vertex_shader();
 
@@ -2063,6 +2768,22 @@ namespace OpenGLRenderer
 
 		// Is there support for fragment shaders (FS)?
 		mCapabilities.fragmentShader = mContext->getExtensions().isGL_ARB_fragment_shader();
+
+		// Is there support for compute shaders (CS)?
+		// -> Unordered access views require "GL_ARB_shader_image_load_store" and "GL_ARB_shader_storage_buffer_object", "glBindBufferBaseEXT()" is provided by "GL_EXT_transform_feedback"
+		mCapabilities.computeShader = (mContext->getExtensions().isGL_ARB_compute_shader() && mContext->getExtensions().isGL_ARB_shader_image_load_store() && mContext->getExtensions().isGL_ARB_shader_storage_buffer_object() && mContext->getExtensions().isGL_EXT_transform_feedback());
+
+		// Maximum number of stream output ("transform feedback" in OpenGL terminology) target vertex buffers (usually 0 for no stream output support or 4)
+		// -> "OpenGLRenderer::drawAuto()" requires "GL_ARB_occlusion_query" for the transform feedback primitives written query
+		if (mContext->getExtensions().isGL_EXT_transform_feedback() && mContext->getExtensions().isGL_ARB_occlusion_query())
+		{
+			glGetIntegerv(GL_MAX_TRANSFORM_FEEDBACK_SEPARATE_ATTRIBS_EXT, &openGLValue);
+			mCapabilities.maximumNumberOfStreamOutputTargets = static_cast<unsigned int>(openGLValue);
+		}
+		else
+		{
+			mCapabilities.maximumNumberOfStreamOutputTargets = 0;
+		}
 	}
 
 	/**
@@ -2102,6 +2823,126 @@ namespace OpenGLRenderer
 		}
 	}
 
+	/**
+	*  @brief
+	*    Map an OpenGL buffer
+	*/
+	bool OpenGLRenderer::mapOpenGLBuffer(unsigned int openGLTarget, unsigned int openGLBuffer, Renderer::MapType::Enum mapType, unsigned int rowPitch, unsigned int depthPitch, Renderer::MappedSubresource &mappedSubresource)
+	{
+		// Set known return values
+		mappedSubresource.data		 = nullptr;
+		mappedSubresource.rowPitch   = 0;
+		mappedSubresource.depthPitch = 0;
+
+		// "GL_ARB_vertex_buffer_object" required
+		if (0 != openGLBuffer && mContext->getExtensions().isGL_ARB_vertex_buffer_object())
+		{
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Backup the currently bound OpenGL buffer
+				GLint openGLBufferBackup = 0;
+				glGetIntegerv((GL_PIXEL_PACK_BUFFER_ARB == openGLTarget) ? GL_PIXEL_PACK_BUFFER_BINDING_ARB : GL_ARRAY_BUFFER_BINDING_ARB, &openGLBufferBackup);
+			#endif
+
+			// Map the OpenGL buffer
+			// -> In case the GPU is still writing into the buffer, this will stall, use a fence to avoid this
+			glBindBufferARB(openGLTarget, openGLBuffer);
+			mappedSubresource.data = glMapBufferARB(openGLTarget, Mapping::getOpenGLMapType(mapType));
+			if (nullptr != mappedSubresource.data)
+			{
+				mappedSubresource.rowPitch   = rowPitch;
+				mappedSubresource.depthPitch = depthPitch;
+			}
+
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Be polite and restore the previous bound OpenGL buffer
+				glBindBufferARB(openGLTarget, static_cast<GLuint>(openGLBufferBackup));
+			#else
+				// Unbind the OpenGL pixel pack buffer, else following pixel transfers would use it
+				if (GL_PIXEL_PACK_BUFFER_ARB == openGLTarget)
+				{
+					glBindBufferARB(openGLTarget, 0);
+				}
+			#endif
+		}
+
+		// Done
+		return (nullptr != mappedSubresource.data);
+	}
+
+	/**
+	*  @brief
+	*    Unmap an OpenGL buffer
+	*/
+	void OpenGLRenderer::unmapOpenGLBuffer(unsigned int openGLTarget, unsigned int openGLBuffer)
+	{
+		// "GL_ARB_vertex_buffer_object" required
+		if (0 != openGLBuffer && mContext->getExtensions().isGL_ARB_vertex_buffer_object())
+		{
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Backup the currently bound OpenGL buffer
+				GLint openGLBufferBackup = 0;
+				glGetIntegerv((GL_PIXEL_PACK_BUFFER_ARB == openGLTarget) ? GL_PIXEL_PACK_BUFFER_BINDING_ARB : GL_ARRAY_BUFFER_BINDING_ARB, &openGLBufferBackup);
+			#endif
+
+			// Unmap the OpenGL buffer
+			glBindBufferARB(openGLTarget, openGLBuffer);
+			glUnmapBufferARB(openGLTarget);
+
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Be polite and restore the previous bound OpenGL buffer
+				glBindBufferARB(openGLTarget, static_cast<GLuint>(openGLBufferBackup));
+			#else
+				// Unbind the OpenGL pixel pack buffer, else following pixel transfers would use it
+				if (GL_PIXEL_PACK_BUFFER_ARB == openGLTarget)
+				{
+					glBindBufferARB(openGLTarget, 0);
+				}
+			#endif
+		}
+	}
+
+	/**
+	*  @brief
+	*    Copy the content of an OpenGL buffer into another OpenGL buffer
+	*/
+	bool OpenGLRenderer::copyOpenGLBuffer(unsigned int destinationOpenGLBuffer, unsigned int sourceOpenGLBuffer)
+	{
+		// "GL_ARB_copy_buffer" required
+		if (0 != destinationOpenGLBuffer && 0 != sourceOpenGLBuffer && mContext->getExtensions().isGL_ARB_copy_buffer())
+		{
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Backup the currently bound OpenGL copy buffers
+				GLint openGLCopyReadBufferBackup = 0;
+				GLint openGLCopyWriteBufferBackup = 0;
+				glGetIntegerv(GL_COPY_READ_BUFFER, &openGLCopyReadBufferBackup);
+				glGetIntegerv(GL_COPY_WRITE_BUFFER, &openGLCopyWriteBufferBackup);
+			#endif
+
+			// Bind the OpenGL buffers to the dedicated copy targets, this doesn't change any other OpenGL state
+			glBindBufferARB(GL_COPY_READ_BUFFER, sourceOpenGLBuffer);
+			glBindBufferARB(GL_COPY_WRITE_BUFFER, destinationOpenGLBuffer);
+
+			// Copy as many bytes as both OpenGL buffers can hold
+			GLint sourceNumberOfBytes = 0;
+			GLint destinationNumberOfBytes = 0;
+			glGetBufferParameterivARB(GL_COPY_READ_BUFFER, GL_BUFFER_SIZE_ARB, &sourceNumberOfBytes);
+			glGetBufferParameterivARB(GL_COPY_WRITE_BUFFER, GL_BUFFER_SIZE_ARB, &destinationNumberOfBytes);
+			glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, (sourceNumberOfBytes < destinationNumberOfBytes) ? sourceNumberOfBytes : destinationNumberOfBytes);
+
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Be polite and restore the previous bound OpenGL copy buffers
+				glBindBufferARB(GL_COPY_READ_BUFFER, static_cast<GLuint>(openGLCopyReadBufferBackup));
+				glBindBufferARB(GL_COPY_WRITE_BUFFER, static_cast<GLuint>(openGLCopyWriteBufferBackup));
+			#endif
+
+			// Done
+			return true;
+		}
+
+		// Error!
+		return false;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -210,7 +210,11 @@ namespace OpenGLRenderer
 		IMPORT_FUNC(glGenTextures);
 		IMPORT_FUNC(glDeleteTextures);
 		IMPORT_FUNC(glTexImage2D);
+		IMPORT_FUNC(glTexSubImage2D);
+		IMPORT_FUNC(glGetTexImage);
 		IMPORT_FUNC(glPixelStorei);
+		IMPORT_FUNC(glReadBuffer);
+		IMPORT_FUNC(glDrawBuffer);
 		IMPORT_FUNC(glDepthMask);
 		IMPORT_FUNC(glViewport);
 		IMPORT_FUNC(glDepthRange);
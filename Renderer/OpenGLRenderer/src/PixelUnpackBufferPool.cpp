@@ -0,0 +1,198 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "OpenGLRenderer/PixelUnpackBufferPool.h"
+#include "OpenGLRenderer/IContext.h"
+#include "OpenGLRenderer/Extensions.h"
+#include "OpenGLRenderer/OpenGLRenderer.h"
+
+#include <string.h>	// For "memcpy()" and "memset()"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace OpenGLRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	PixelUnpackBufferPool::PixelUnpackBufferPool(OpenGLRenderer &openGLRenderer) :
+		mPersistentMapping(false),
+		mCurrentBuffer(0)
+		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+			, mOpenGLPixelUnpackBufferBackup(0)
+		#endif
+	{
+		// Persistently mapped buffers require immutable buffer storage, ranged mapping and fences
+		const Extensions &extensions = openGLRenderer.getContext().getExtensions();
+		mPersistentMapping = (extensions.isGL_ARB_buffer_storage() && extensions.isGL_ARB_map_buffer_range() && extensions.isGL_ARB_sync());
+
+		// The OpenGL pixel unpack buffers are created on first use
+		memset(mBuffers, 0, sizeof(Buffer) * NUMBER_OF_BUFFERS);
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	PixelUnpackBufferPool::~PixelUnpackBufferPool()
+	{
+		// Destroy the OpenGL sync objects and the OpenGL pixel unpack buffers
+		// -> Destroying a mapped OpenGL buffer implicitly unmaps it
+		for (unsigned int i = 0; i < NUMBER_OF_BUFFERS; ++i)
+		{
+			Buffer &buffer = mBuffers[i];
+			if (nullptr != buffer.openGLSync)
+			{
+				glDeleteSync(static_cast<GLsync>(buffer.openGLSync));
+			}
+
+			// Silently ignores 0's and names that do not correspond to existing buffer objects
+			glDeleteBuffersARB(1, &buffer.openGLPixelUnpackBuffer);
+		}
+	}
+
+	bool PixelUnpackBufferPool::beginUpload(unsigned int numberOfBytes, const void *data)
+	{
+		// Too large uploads would bloat the pool, let the caller upload directly
+		if (nullptr == data || 0 == numberOfBytes || numberOfBytes > MAXIMUM_NUMBER_OF_BYTES)
+		{
+			// Error!
+			return false;
+		}
+
+		// Use the next pixel unpack buffer
+		mCurrentBuffer = (mCurrentBuffer + 1) % NUMBER_OF_BUFFERS;
+		Buffer &buffer = mBuffers[mCurrentBuffer];
+
+		// Wait until the GPU is done reading the previous content of the pixel unpack buffer
+		// -> With a few buffers in flight this usually doesn't block at all
+		if (nullptr != buffer.openGLSync)
+		{
+			const GLsync openGLSync = static_cast<GLsync>(buffer.openGLSync);
+			glClientWaitSync(openGLSync, GL_SYNC_FLUSH_COMMANDS_BIT, ~static_cast<GLuint64>(0));
+			glDeleteSync(openGLSync);
+			buffer.openGLSync = nullptr;
+		}
+
+		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+			// Backup the currently bound OpenGL pixel unpack buffer
+			glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING_ARB, &mOpenGLPixelUnpackBufferBackup);
+		#endif
+
+		// Round the required storage size up in order to reduce the number of reallocations
+		const unsigned int storageNumberOfBytes = (numberOfBytes + STORAGE_GRANULARITY - 1) / STORAGE_GRANULARITY * STORAGE_GRANULARITY;
+
+		// Copy the data into the upload memory
+		if (mPersistentMapping)
+		{
+			// Is the immutable buffer storage too small? If so, replace the OpenGL pixel unpack buffer.
+			if (buffer.numberOfBytes < numberOfBytes)
+			{
+				glDeleteBuffersARB(1, &buffer.openGLPixelUnpackBuffer);
+				glGenBuffersARB(1, &buffer.openGLPixelUnpackBuffer);
+				glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, buffer.openGLPixelUnpackBuffer);
+				const GLbitfield openGLFlags = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+				glBufferStorage(GL_PIXEL_UNPACK_BUFFER_ARB, static_cast<GLsizeiptr>(storageNumberOfBytes), nullptr, openGLFlags);
+				buffer.mappedData = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER_ARB, 0, static_cast<GLsizeiptr>(storageNumberOfBytes), openGLFlags);
+				buffer.numberOfBytes = (nullptr != buffer.mappedData) ? storageNumberOfBytes : 0;
+			}
+			else
+			{
+				glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, buffer.openGLPixelUnpackBuffer);
+			}
+
+			// Copy the data into the persistently mapped upload memory, the mapping is coherent so there's no need to flush
+			if (nullptr != buffer.mappedData)
+			{
+				memcpy(buffer.mappedData, data, numberOfBytes);
+
+				// Done
+				return true;
+			}
+		}
+		else
+		{
+			// Create the OpenGL pixel unpack buffer right now?
+			if (0 == buffer.openGLPixelUnpackBuffer)
+			{
+				glGenBuffersARB(1, &buffer.openGLPixelUnpackBuffer);
+			}
+			glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, buffer.openGLPixelUnpackBuffer);
+
+			// Orphan the previous buffer storage so the driver doesn't need to wait for the GPU, then map the new buffer storage
+			if (buffer.numberOfBytes < storageNumberOfBytes)
+			{
+				buffer.numberOfBytes = storageNumberOfBytes;
+			}
+			glBufferDataARB(GL_PIXEL_UNPACK_BUFFER_ARB, static_cast<GLsizeiptrARB>(buffer.numberOfBytes), nullptr, GL_STREAM_DRAW_ARB);
+			void *mappedData = glMapBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, GL_WRITE_ONLY_ARB);
+			if (nullptr != mappedData)
+			{
+				memcpy(mappedData, data, numberOfBytes);
+				glUnmapBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB);
+
+				// Done
+				return true;
+			}
+		}
+
+		// Error, unbind the OpenGL pixel unpack buffer or the following upload would use it
+		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+			glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, static_cast<GLuint>(mOpenGLPixelUnpackBufferBackup));
+		#else
+			glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, 0);
+		#endif
+		return false;
+	}
+
+	void PixelUnpackBufferPool::endUpload()
+	{
+		// Insert a fence so we know when the GPU is done reading the pixel unpack buffer
+		if (mPersistentMapping)
+		{
+			mBuffers[mCurrentBuffer].openGLSync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		}
+
+		// A bound OpenGL pixel unpack buffer changes the meaning of the data pointer of all following texture uploads, so always unbind it
+		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+			// Be polite and restore the previous bound OpenGL pixel unpack buffer
+			glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, static_cast<GLuint>(mOpenGLPixelUnpackBufferBackup));
+		#else
+			glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, 0);
+		#endif
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // OpenGLRenderer
@@ -152,7 +152,7 @@ namespace OpenGLRenderer
 		if (nullptr != mCgProgram)
 		{
 			// TODO(co) Add security check: Is the given resource one of the currently used renderer?
-			return new VertexArrayCg(*this, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
+			return new (getRenderer().getAllocator()) VertexArrayCg(*this, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
 		}
 		else
 		{
@@ -27,6 +27,7 @@
 #include "OpenGLRenderer/IndexBuffer.h"
 #include "OpenGLRenderer/OpenGLRenderer.h"
 #include "OpenGLRenderer/VertexShaderGlsl.h"
+#include "OpenGLRenderer/ComputeShaderGlsl.h"
 #include "OpenGLRenderer/VertexArrayNoVao.h"
 #include "OpenGLRenderer/VertexArrayVaoDsa.h"
 #include "OpenGLRenderer/VertexArrayVaoBind.h"
@@ -107,34 +108,25 @@ namespace OpenGLRenderer
 		}
 
 		// Link the program
-		glLinkProgramARB(mOpenGLProgram);
-
-		// Check the link status
-		GLint linked = GL_FALSE;
-		glGetObjectParameterivARB(mOpenGLProgram, GL_OBJECT_LINK_STATUS_ARB, &linked);
-		if (GL_TRUE != linked)
-		{
-			// Error, program link failed!
-			#ifdef RENDERER_OUTPUT_DEBUG
-				// Get the length of the information (including a null termination)
-				GLint informationLength = 0;
-				glGetObjectParameterivARB(mOpenGLProgram, GL_OBJECT_INFO_LOG_LENGTH_ARB, &informationLength);
-				if (informationLength > 1)
-				{
-					// Allocate memory for the information
-					char *informationLog = new char[static_cast<unsigned int>(informationLength)];
-
-					// Get the information
-					glGetInfoLogARB(mOpenGLProgram, informationLength, nullptr, informationLog);
+		linkProgram();
+	}
 
-					// Ouput the debug string
-					RENDERER_OUTPUT_DEBUG_STRING(informationLog)
+	/**
+	*  @brief
+	*    Compute program constructor
+	*/
+	ProgramGlsl::ProgramGlsl(OpenGLRenderer &openGLRenderer, ComputeShaderGlsl &computeShaderGlsl) :
+		Program(openGLRenderer, InternalResourceType::GLSL),
+		mOpenGLProgram(glCreateProgramObjectARB())
+	{
+		// Attach the shader to the program
+		// -> We don't need to keep a reference to the shader, to add and release at once to ensure a nice behaviour
+		computeShaderGlsl.addReference();
+		glAttachObjectARB(mOpenGLProgram, computeShaderGlsl.getOpenGLShader());
+		computeShaderGlsl.release();
 
-					// Cleanup information memory
-					delete [] informationLog;
-				}
-			#endif
-		}
+		// Link the program
+		linkProgram();
 	}
 
 	/**
@@ -167,23 +159,39 @@ namespace OpenGLRenderer
 			{
 				// Effective direct state access (DSA)
 				// TODO(co) Add security check: Is the given resource one of the currently used renderer?
-				return new VertexArrayVaoDsa(*this, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
+				return new (getRenderer().getAllocator()) VertexArrayVaoDsa(*this, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
 			}
 			else
 			{
 				// Traditional bind version
 				// TODO(co) Add security check: Is the given resource one of the currently used renderer?
-				return new VertexArrayVaoBind(*this, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
+				return new (getRenderer().getAllocator()) VertexArrayVaoBind(*this, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
 			}
 		}
 		else
 		{
 			// Traditional version
 			// TODO(co) Add security check: Is the given resource one of the currently used renderer?
-			return new VertexArrayNoVao(*this, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
+			return new (getRenderer().getAllocator()) VertexArrayNoVao(*this, numberOfAttributes, attributes, static_cast<IndexBuffer*>(indexBuffer));
 		}
 	}
 
+	bool ProgramGlsl::setStreamOutputVaryings(unsigned int numberOfVaryings, const char **varyingNames, bool interleaved)
+	{
+		// Is "GL_EXT_transform_feedback" there?
+		if (static_cast<OpenGLRenderer&>(getRenderer()).getContext().getExtensions().isGL_EXT_transform_feedback())
+		{
+			// Set the captured varyings, zero varyings disable transform feedback for this program
+			glTransformFeedbackVaryingsEXT(mOpenGLProgram, static_cast<GLsizei>(numberOfVaryings), reinterpret_cast<const GLchar**>(varyingNames), interleaved ? GL_INTERLEAVED_ATTRIBS_EXT : GL_SEPARATE_ATTRIBS_EXT);
+
+			// The varyings are only taken into account during linking, so we have to relink the program
+			return linkProgram();
+		}
+
+		// Error! "GL_EXT_transform_feedback" is not there!
+		return false;
+	}
+
 	int ProgramGlsl::getAttributeLocation(const char *attributeName)
 	{
 		return glGetAttribLocationARB(mOpenGLProgram, attributeName);
@@ -412,6 +420,50 @@ namespace OpenGLRenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Link the OpenGL program and output the information log on failure
+	*/
+	bool ProgramGlsl::linkProgram()
+	{
+		// Link the program
+		glLinkProgramARB(mOpenGLProgram);
+
+		// Check the link status
+		GLint linked = GL_FALSE;
+		glGetObjectParameterivARB(mOpenGLProgram, GL_OBJECT_LINK_STATUS_ARB, &linked);
+		if (GL_TRUE != linked)
+		{
+			// Error, program link failed!
+			#ifdef RENDERER_OUTPUT_DEBUG
+				// Get the length of the information (including a null termination)
+				GLint informationLength = 0;
+				glGetObjectParameterivARB(mOpenGLProgram, GL_OBJECT_INFO_LOG_LENGTH_ARB, &informationLength);
+				if (informationLength > 1)
+				{
+					// Allocate memory for the information
+					char *informationLog = getRenderer().getAllocator().allocateArray<char>(static_cast<unsigned int>(informationLength), Renderer::AllocationTag::TEMPORARY);
+
+					// Get the information
+					glGetInfoLogARB(mOpenGLProgram, informationLength, nullptr, informationLog);
+
+					// Ouput the debug string
+					RENDERER_OUTPUT_DEBUG_STRING(informationLog)
+
+					// Cleanup information memory
+					getRenderer().getAllocator().deallocateArray(informationLog, Renderer::AllocationTag::TEMPORARY);
+				}
+			#endif
+		}
+
+		// Done
+		return (GL_TRUE == linked);
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
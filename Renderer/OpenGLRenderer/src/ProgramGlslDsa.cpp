@@ -45,6 +45,16 @@ namespace OpenGLRenderer
 		// Nothing to do in here
 	}
 
+	/**
+	*  @brief
+	*    Compute program constructor
+	*/
+	ProgramGlslDsa::ProgramGlslDsa(OpenGLRenderer &openGLRenderer, ComputeShaderGlsl &computeShaderGlsl) :
+		ProgramGlsl(openGLRenderer, computeShaderGlsl)
+	{
+		// Nothing to do in here
+	}
+
 	/**
 	*  @brief
 	*    Destructor
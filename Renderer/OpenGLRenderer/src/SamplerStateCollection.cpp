@@ -22,7 +22,9 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "OpenGLRenderer/SamplerStateCollection.h"
-#include "OpenGLRenderer/SamplerState.h"
+#include "OpenGLRenderer/SamplerStateSo.h"
+#include "OpenGLRenderer/Extensions.h"
+#include "OpenGLRenderer/IContext.h"
 #include "OpenGLRenderer/OpenGLRenderer.h"
 
 
@@ -43,7 +45,8 @@ namespace OpenGLRenderer
 	SamplerStateCollection::SamplerStateCollection(OpenGLRenderer &openGLRenderer, unsigned int numberOfSamplerStates, Renderer::ISamplerState **samplerStates) :
 		Renderer::ISamplerStateCollection(openGLRenderer),
 		mNumberOfSamplerStates(numberOfSamplerStates),
-		mSamplerStates((numberOfSamplerStates > 0) ? new Renderer::ISamplerState*[numberOfSamplerStates] : nullptr)
+		mSamplerStates(openGLRenderer.getAllocator().allocateArray<Renderer::ISamplerState*>(numberOfSamplerStates, Renderer::AllocationTag::RESOURCE)),
+		mOpenGLSamplers((numberOfSamplerStates > 0 && openGLRenderer.getContext().getExtensions().isGL_ARB_sampler_objects()) ? openGLRenderer.getAllocator().allocateArray<unsigned int>(numberOfSamplerStates, Renderer::AllocationTag::RESOURCE) : nullptr)
 	{
 		// Loop through all given textures
 		Renderer::ISamplerState **currentSamplerState = mSamplerStates;
@@ -57,6 +60,12 @@ namespace OpenGLRenderer
 			samplerState->addReference();
 			*currentSamplerState = samplerState;
 
+			// Resolve the OpenGL sampler right now, only sampler objects (SO) have one
+			if (nullptr != mOpenGLSamplers)
+			{
+				mOpenGLSamplers[currentSamplerState - mSamplerStates] = static_cast<SamplerStateSo*>(samplerState)->getOpenGLSampler();
+			}
+
 			// Security check: Is the given resource owned by this renderer?
 			#ifndef OPENGLRENDERER_NO_RENDERERMATCHCHECK
 				if (&openGLRenderer != &samplerState->getRenderer())
@@ -86,7 +95,8 @@ namespace OpenGLRenderer
 			}
 
 			// Release the allocated memory
-			delete [] mSamplerStates;
+			getRenderer().getAllocator().deallocateArray(mSamplerStates, Renderer::AllocationTag::RESOURCE);
+			getRenderer().getAllocator().deallocateArray(mOpenGLSamplers, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
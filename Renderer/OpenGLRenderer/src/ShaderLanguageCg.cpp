@@ -35,6 +35,7 @@
 #include "OpenGLRenderer/TessellationControlShaderCg.h"
 #include "OpenGLRenderer/TessellationEvaluationShaderCg.h"
 
+#include <Renderer/IComputeShader.h>
 #include <Renderer/PlatformTypes.h>	// For "RENDERER_OUTPUT_DEBUG_STRING()"
 
 #include <Cg/cgGL.h>
@@ -100,27 +101,27 @@ namespace OpenGLRenderer
 
 	Renderer::IVertexShader *ShaderLanguageCg::createVertexShader(const char *sourceCode, const char *profile, const char *, const char *)
 	{
-		return (nullptr != mCgContext) ? new VertexShaderCg(getOpenGLRenderer(), *mCgContext, sourceCode, profile) : nullptr;
+		return (nullptr != mCgContext) ? new (getOpenGLRenderer().getAllocator()) VertexShaderCg(getOpenGLRenderer(), *mCgContext, sourceCode, profile) : nullptr;
 	}
 
 	Renderer::ITessellationControlShader *ShaderLanguageCg::createTessellationControlShader(const char *sourceCode, const char *profile, const char *, const char *)
 	{
-		return (nullptr != mCgContext) ? new TessellationControlShaderCg(getOpenGLRenderer(), *mCgContext, sourceCode, profile) : nullptr;
+		return (nullptr != mCgContext) ? new (getOpenGLRenderer().getAllocator()) TessellationControlShaderCg(getOpenGLRenderer(), *mCgContext, sourceCode, profile) : nullptr;
 	}
 
 	Renderer::ITessellationEvaluationShader *ShaderLanguageCg::createTessellationEvaluationShader(const char *sourceCode, const char *profile, const char *, const char *)
 	{
-		return (nullptr != mCgContext) ? new TessellationEvaluationShaderCg(getOpenGLRenderer(), *mCgContext, sourceCode, profile) : nullptr;
+		return (nullptr != mCgContext) ? new (getOpenGLRenderer().getAllocator()) TessellationEvaluationShaderCg(getOpenGLRenderer(), *mCgContext, sourceCode, profile) : nullptr;
 	}
 
 	Renderer::IGeometryShader *ShaderLanguageCg::createGeometryShader(const char *sourceCode, Renderer::GsInputPrimitiveTopology::Enum, Renderer::GsOutputPrimitiveTopology::Enum, unsigned int, const char *profile, const char *, const char *)
 	{
-		return (nullptr != mCgContext) ? new GeometryShaderCg(getOpenGLRenderer(), *mCgContext, sourceCode, profile) : nullptr;
+		return (nullptr != mCgContext) ? new (getOpenGLRenderer().getAllocator()) GeometryShaderCg(getOpenGLRenderer(), *mCgContext, sourceCode, profile) : nullptr;
 	}
 
 	Renderer::IFragmentShader *ShaderLanguageCg::createFragmentShader(const char *sourceCode, const char *profile, const char *, const char *)
 	{
-		return (nullptr != mCgContext) ? new FragmentShaderCg(getOpenGLRenderer(), *mCgContext, sourceCode, profile) : nullptr;
+		return (nullptr != mCgContext) ? new (getOpenGLRenderer().getAllocator()) FragmentShaderCg(getOpenGLRenderer(), *mCgContext, sourceCode, profile) : nullptr;
 	}
 
 	Renderer::IProgram *ShaderLanguageCg::createProgram(Renderer::IVertexShader *vertexShader, Renderer::ITessellationControlShader *tessellationControlShader, Renderer::ITessellationEvaluationShader *tessellationEvaluationShader, Renderer::IGeometryShader *geometryShader, Renderer::IFragmentShader *fragmentShader)
@@ -155,7 +156,7 @@ namespace OpenGLRenderer
 			else
 			{
 				// Create the program instance
-				return new ProgramCg(getOpenGLRenderer(), static_cast<VertexShaderCg*>(vertexShader), static_cast<TessellationControlShaderCg*>(tessellationControlShader), static_cast<TessellationEvaluationShaderCg*>(tessellationEvaluationShader), static_cast<GeometryShaderCg*>(geometryShader), static_cast<FragmentShaderCg*>(fragmentShader));
+				return new (getOpenGLRenderer().getAllocator()) ProgramCg(getOpenGLRenderer(), static_cast<VertexShaderCg*>(vertexShader), static_cast<TessellationControlShaderCg*>(tessellationControlShader), static_cast<TessellationEvaluationShaderCg*>(tessellationEvaluationShader), static_cast<GeometryShaderCg*>(geometryShader), static_cast<FragmentShaderCg*>(fragmentShader));
 			}
 
 			// Error! Shader language mismatch!
@@ -191,6 +192,24 @@ namespace OpenGLRenderer
 		return nullptr;
 	}
 
+	Renderer::IComputeShader *ShaderLanguageCg::createComputeShader(const char *, const char *, const char *, const char *)
+	{
+		// Error! Cg has no compute shader profiles, use GLSL instead
+		return nullptr;
+	}
+
+	Renderer::IProgram *ShaderLanguageCg::createComputeProgram(Renderer::IComputeShader *computeShader)
+	{
+		// Error! Cg has no compute shader profiles, use GLSL instead
+		// -> Ensure a correct reference counter behaviour, even in the situation of an error
+		if (nullptr != computeShader)
+		{
+			computeShader->addReference();
+			computeShader->release();
+		}
+		return nullptr;
+	}
+
 	Renderer::IUniformBuffer *ShaderLanguageCg::createUniformBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
 		// TODO(co) Review Cg uniform buffer
@@ -203,12 +222,12 @@ namespace OpenGLRenderer
 			if (openGLRenderer.getContext().getExtensions().isGL_EXT_direct_state_access())
 			{
 				// Effective direct state access (DSA)
-				return new UniformBufferGlslDsa(openGLRenderer, numberOfBytes, data, bufferUsage);
+				return new (openGLRenderer.getUniformBufferPool()) UniformBufferGlslDsa(openGLRenderer, numberOfBytes, data, bufferUsage);
 			}
 			else
 			{
 				// Traditional bind version
-				return new UniformBufferGlslBind(openGLRenderer, numberOfBytes, data, bufferUsage);
+				return new (openGLRenderer.getUniformBufferPool()) UniformBufferGlslBind(openGLRenderer, numberOfBytes, data, bufferUsage);
 			}
 		}
 		else
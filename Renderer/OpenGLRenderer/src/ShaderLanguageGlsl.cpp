@@ -28,6 +28,7 @@
 #include "OpenGLRenderer/ProgramGlslDsa.h"
 #include "OpenGLRenderer/OpenGLRenderer.h"
 #include "OpenGLRenderer/VertexShaderGlsl.h"
+#include "OpenGLRenderer/ComputeShaderGlsl.h"
 #include "OpenGLRenderer/UniformBufferGlslDsa.h"
 #include "OpenGLRenderer/UniformBufferGlslBind.h"
 #include "OpenGLRenderer/GeometryShaderGlsl.h"
@@ -57,7 +58,7 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Creates, loads and compiles a shader
 	*/
-	unsigned int ShaderLanguageGlsl::loadShader(unsigned int shaderType, const char *shaderSource)
+	unsigned int ShaderLanguageGlsl::loadShader(Renderer::IAllocator &allocator, unsigned int shaderType, const char *shaderSource)
 	{
 		// Create the shader object
 		const GLuint openGLShader = glCreateShaderObjectARB(shaderType);
@@ -88,7 +89,7 @@ namespace OpenGLRenderer
 				if (informationLength > 1)
 				{
 					// Allocate memory for the information
-					GLchar *informationLog = new GLchar[static_cast<unsigned int>(informationLength)];
+					GLchar *informationLog = allocator.allocateArray<GLchar>(static_cast<unsigned int>(informationLength), Renderer::AllocationTag::TEMPORARY);
 
 					// Get the information
 					glGetInfoLogARB(openGLShader, informationLength, nullptr, informationLog);
@@ -97,8 +98,11 @@ namespace OpenGLRenderer
 					RENDERER_OUTPUT_DEBUG_STRING(informationLog)
 
 					// Cleanup information memory
-					delete [] informationLog;
+					allocator.deallocateArray(informationLog, Renderer::AllocationTag::TEMPORARY);
 				}
+			#else
+				// Avoid "warning C4100: '<x>' : unreferenced formal parameter"-warning
+				static_cast<void>(allocator);
 			#endif
 
 			// Destroy the shader
@@ -148,7 +152,7 @@ namespace OpenGLRenderer
 		OpenGLRenderer &openGLRenderer = getOpenGLRenderer();
 		if (openGLRenderer.getContext().getExtensions().isGL_ARB_vertex_shader())
 		{
-			return new VertexShaderGlsl(openGLRenderer, sourceCode);
+			return new (openGLRenderer.getAllocator()) VertexShaderGlsl(openGLRenderer, sourceCode);
 		}
 		else
 		{
@@ -163,7 +167,7 @@ namespace OpenGLRenderer
 		OpenGLRenderer &openGLRenderer = getOpenGLRenderer();
 		if (openGLRenderer.getContext().getExtensions().isGL_ARB_tessellation_shader())
 		{
-			return new TessellationControlShaderGlsl(openGLRenderer, sourceCode);
+			return new (openGLRenderer.getAllocator()) TessellationControlShaderGlsl(openGLRenderer, sourceCode);
 		}
 		else
 		{
@@ -178,7 +182,7 @@ namespace OpenGLRenderer
 		OpenGLRenderer &openGLRenderer = getOpenGLRenderer();
 		if (openGLRenderer.getContext().getExtensions().isGL_ARB_tessellation_shader())
 		{
-			return new TessellationEvaluationShaderGlsl(openGLRenderer, sourceCode);
+			return new (openGLRenderer.getAllocator()) TessellationEvaluationShaderGlsl(openGLRenderer, sourceCode);
 		}
 		else
 		{
@@ -197,7 +201,7 @@ namespace OpenGLRenderer
 			//   "layout(triangles) in;"
 			//   "layout(triangle_strip, max_vertices = 3) out;"
 			// -> To be able to support older GLSL versions, we have to provide this information also via OpenGL API functions
-			return new GeometryShaderGlsl(openGLRenderer, sourceCode, gsInputPrimitiveTopology, gsOutputPrimitiveTopology, numberOfOutputVertices);
+			return new (openGLRenderer.getAllocator()) GeometryShaderGlsl(openGLRenderer, sourceCode, gsInputPrimitiveTopology, gsOutputPrimitiveTopology, numberOfOutputVertices);
 		}
 		else
 		{
@@ -212,7 +216,7 @@ namespace OpenGLRenderer
 		OpenGLRenderer &openGLRenderer = getOpenGLRenderer();
 		if (openGLRenderer.getContext().getExtensions().isGL_ARB_fragment_shader())
 		{
-			return new FragmentShaderGlsl(openGLRenderer, sourceCode);
+			return new (openGLRenderer.getAllocator()) FragmentShaderGlsl(openGLRenderer, sourceCode);
 		}
 		else
 		{
@@ -254,12 +258,12 @@ namespace OpenGLRenderer
 		else if (openGLRenderer.getContext().getExtensions().isGL_EXT_direct_state_access())
 		{
 			// Effective direct state access (DSA)
-			return new ProgramGlslDsa(openGLRenderer, static_cast<VertexShaderGlsl*>(vertexShader), static_cast<TessellationControlShaderGlsl*>(tessellationControlShader), static_cast<TessellationEvaluationShaderGlsl*>(tessellationEvaluationShader), static_cast<GeometryShaderGlsl*>(geometryShader), static_cast<FragmentShaderGlsl*>(fragmentShader));
+			return new (openGLRenderer.getAllocator()) ProgramGlslDsa(openGLRenderer, static_cast<VertexShaderGlsl*>(vertexShader), static_cast<TessellationControlShaderGlsl*>(tessellationControlShader), static_cast<TessellationEvaluationShaderGlsl*>(tessellationEvaluationShader), static_cast<GeometryShaderGlsl*>(geometryShader), static_cast<FragmentShaderGlsl*>(fragmentShader));
 		}
 		else
 		{
 			// Traditional bind version
-			return new ProgramGlsl(openGLRenderer, static_cast<VertexShaderGlsl*>(vertexShader), static_cast<TessellationControlShaderGlsl*>(tessellationControlShader), static_cast<TessellationEvaluationShaderGlsl*>(tessellationEvaluationShader), static_cast<GeometryShaderGlsl*>(geometryShader), static_cast<FragmentShaderGlsl*>(fragmentShader));
+			return new (openGLRenderer.getAllocator()) ProgramGlsl(openGLRenderer, static_cast<VertexShaderGlsl*>(vertexShader), static_cast<TessellationControlShaderGlsl*>(tessellationControlShader), static_cast<TessellationEvaluationShaderGlsl*>(tessellationEvaluationShader), static_cast<GeometryShaderGlsl*>(geometryShader), static_cast<FragmentShaderGlsl*>(fragmentShader));
 		}
 
 		// Error! Shader language mismatch!
@@ -294,6 +298,57 @@ namespace OpenGLRenderer
 		return nullptr;
 	}
 
+	Renderer::IComputeShader *ShaderLanguageGlsl::createComputeShader(const char *sourceCode, const char *, const char *, const char *)
+	{
+		// Check whether or not there's compute shader support
+		OpenGLRenderer &openGLRenderer = getOpenGLRenderer();
+		if (openGLRenderer.getContext().getExtensions().isGL_ARB_compute_shader())
+		{
+			return new (openGLRenderer.getAllocator()) ComputeShaderGlsl(openGLRenderer, sourceCode);
+		}
+		else
+		{
+			// Error! There's no compute shader support!
+			return nullptr;
+		}
+	}
+
+	Renderer::IProgram *ShaderLanguageGlsl::createComputeProgram(Renderer::IComputeShader *computeShader)
+	{
+		OpenGLRenderer &openGLRenderer = getOpenGLRenderer();
+
+		// The compute shader and program language must match!
+		// -> Optimization: Comparing the shader language name by directly comparing the pointer address of
+		//    the name is safe because we know that we always reference to one and the same name address
+		// TODO(co) Add security check: Is the given resource one of the currently used renderer?
+		if (nullptr == computeShader)
+		{
+			// Error! A compute program requires a compute shader!
+		}
+		else if (computeShader->getShaderLanguageName() != NAME)
+		{
+			// Error! Compute shader language mismatch!
+			// -> Ensure a correct reference counter behaviour, even in the situation of an error
+			computeShader->addReference();
+			computeShader->release();
+		}
+
+		// Is "GL_EXT_direct_state_access" there?
+		else if (openGLRenderer.getContext().getExtensions().isGL_EXT_direct_state_access())
+		{
+			// Effective direct state access (DSA)
+			return new (openGLRenderer.getAllocator()) ProgramGlslDsa(openGLRenderer, *static_cast<ComputeShaderGlsl*>(computeShader));
+		}
+		else
+		{
+			// Traditional bind version
+			return new (openGLRenderer.getAllocator()) ProgramGlsl(openGLRenderer, *static_cast<ComputeShaderGlsl*>(computeShader));
+		}
+
+		// Error!
+		return nullptr;
+	}
+
 	Renderer::IUniformBuffer *ShaderLanguageGlsl::createUniformBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
 	{
 		// "GL_ARB_uniform_buffer_object" required
@@ -304,12 +359,12 @@ namespace OpenGLRenderer
 			if (openGLRenderer.getContext().getExtensions().isGL_EXT_direct_state_access())
 			{
 				// Effective direct state access (DSA)
-				return new UniformBufferGlslDsa(openGLRenderer, numberOfBytes, data, bufferUsage);
+				return new (openGLRenderer.getUniformBufferPool()) UniformBufferGlslDsa(openGLRenderer, numberOfBytes, data, bufferUsage);
 			}
 			else
 			{
 				// Traditional bind version
-				return new UniformBufferGlslBind(openGLRenderer, numberOfBytes, data, bufferUsage);
+				return new (openGLRenderer.getUniformBufferPool()) UniformBufferGlslBind(openGLRenderer, numberOfBytes, data, bufferUsage);
 			}
 		}
 		else
@@ -29,6 +29,7 @@
 	#include "OpenGLRenderer/Linux/ContextLinux.h"
 	#include "OpenGLRenderer/OpenGLRuntimeLinking.h" // for glxSwapBuffers
 #endif
+#include "OpenGLRenderer/Extensions.h"
 
 
 //[-------------------------------------------------------]
@@ -47,9 +48,35 @@ namespace OpenGLRenderer
 	*/
 	SwapChain::SwapChain(OpenGLRenderer &openGLRenderer, handle nativeWindowHandle) :
 		ISwapChain(openGLRenderer),
-		mNativeWindowHandle(nativeWindowHandle)
+		mNativeWindowHandle(nativeWindowHandle),
+		#ifdef WIN32
+			mDeviceContext(NULL_HANDLE),
+		#endif
+		mSwapInterval(1),	// There's no portable way to ask for the driver default, which usually is vertical synchronization
+		mFramePacer(openGLRenderer)
 	{
-		// TODO(co) Implement me
+		#ifdef WIN32
+			// Each native window has its own device context, the render context shared by all swap chains is bound to it
+			if (NULL_HANDLE != mNativeWindowHandle)
+			{
+				HDC deviceContext = ::GetDC(reinterpret_cast<HWND>(mNativeWindowHandle));
+				if (NULL_HANDLE != deviceContext)
+				{
+					if (static_cast<const ContextWindows&>(openGLRenderer.getContext()).setupDeviceContext(deviceContext))
+					{
+						mDeviceContext = reinterpret_cast<handle>(deviceContext);
+					}
+					else
+					{
+						// Error, the render context can't be bound to the native window!
+						::ReleaseDC(reinterpret_cast<HWND>(mNativeWindowHandle), deviceContext);
+					}
+				}
+			}
+		#endif
+
+		// Set the estimated number of bytes of the window framebuffer
+		resizeBuffers();
 	}
 
 	/**
@@ -58,7 +85,51 @@ namespace OpenGLRenderer
 	*/
 	SwapChain::~SwapChain()
 	{
-		// TODO(co) Implement me
+		// Don't leave the shared render context bound to the native window of this swap chain, bind it to the primary window instead
+		#ifdef WIN32
+			if (NULL_HANDLE != mDeviceContext)
+			{
+				ContextWindows &contextWindows = static_cast<ContextWindows&>(static_cast<OpenGLRenderer&>(getRenderer()).getContext());
+				if (contextWindows.getCurrentDeviceContext() == reinterpret_cast<HDC>(mDeviceContext))
+				{
+					contextWindows.makeCurrent(nullptr);
+				}
+				::ReleaseDC(reinterpret_cast<HWND>(mNativeWindowHandle), reinterpret_cast<HDC>(mDeviceContext));
+			}
+		#elif defined LINUX
+			if (NULL_HANDLE != mNativeWindowHandle)
+			{
+				ContextLinux &contextLinux = static_cast<ContextLinux&>(static_cast<OpenGLRenderer&>(getRenderer()).getContext());
+				if (contextLinux.getCurrentNativeWindowHandle() == mNativeWindowHandle)
+				{
+					contextLinux.makeCurrent(NULL_HANDLE);
+				}
+			}
+		#else
+			#error "Unsupported platform"
+		#endif
+	}
+
+	/**
+	*  @brief
+	*    Bind the render context shared by all swap chains to the native window of this swap chain
+	*/
+	void SwapChain::makeCurrent()
+	{
+		OpenGLRenderer &openGLRenderer = static_cast<OpenGLRenderer&>(getRenderer());
+		#ifdef WIN32
+			if (NULL_HANDLE != mDeviceContext)
+			{
+				static_cast<ContextWindows&>(openGLRenderer.getContext()).makeCurrent(reinterpret_cast<HDC>(mDeviceContext));
+			}
+		#elif defined LINUX
+			if (NULL_HANDLE != mNativeWindowHandle)
+			{
+				static_cast<ContextLinux&>(openGLRenderer.getContext()).makeCurrent(mNativeWindowHandle);
+			}
+		#else
+			#error "Unsupported platform"
+		#endif
 	}
 
 
@@ -137,20 +208,32 @@ namespace OpenGLRenderer
 
 	void SwapChain::present()
 	{
-		// TODO(co) Correct implementation
+		// Block in case the CPU is too many frames ahead of the GPU
+		mFramePacer.beginPresent();
+
+		// Swap front and back buffer
 		OpenGLRenderer &openGLRenderer = static_cast<OpenGLRenderer&>(getRenderer());
 		#ifdef WIN32
-			SwapBuffers(static_cast<const ContextWindows&>(openGLRenderer.getContext()).getDeviceContext());
+			// Swapping the buffers of a native window does not require the render context to be bound to it
+			SwapBuffers((NULL_HANDLE != mDeviceContext) ? reinterpret_cast<HDC>(mDeviceContext) : static_cast<const ContextWindows&>(openGLRenderer.getContext()).getDeviceContext());
 		#elif defined LINUX
 			glXSwapBuffers(static_cast<const ContextLinux&>(openGLRenderer.getContext()).getDisplay(), mNativeWindowHandle);
 		#else
 			#error "Unsupported platform"
 		#endif
+
+		// Insert the frame latency fence and record the present interval
+		mFramePacer.endPresent();
 	}
 
 	void SwapChain::resizeBuffers()
 	{
-		// Nothing to do in here
+		// The window framebuffer is resized by the operating system, we just have to update the estimated number of bytes
+		// -> Front and back buffer with 32 bit color each and a 32 bit depth stencil buffer
+		unsigned int width  = 0;
+		unsigned int height = 0;
+		getWidthAndHeight(width, height);
+		setNumberOfBytes(static_cast<unsigned long long>(width) * height * (4 + 4 + 4));
 	}
 
 	bool SwapChain::getFullscreenState() const
@@ -164,6 +247,95 @@ namespace OpenGLRenderer
 		// TODO(co) Implement me
 	}
 
+	int SwapChain::getSwapInterval() const
+	{
+		return mSwapInterval;
+	}
+
+	bool SwapChain::setSwapInterval(int swapInterval)
+	{
+		const Extensions &extensions = static_cast<OpenGLRenderer&>(getRenderer()).getContext().getExtensions();
+
+		// Adaptive vertical synchronization requires "WGL_EXT_swap_control_tear" or "GLX_EXT_swap_control_tear", fall back to regular vertical synchronization
+		int nativeSwapInterval = swapInterval;
+		#ifdef WIN32
+			if (nativeSwapInterval < 0 && !extensions.isWGL_EXT_swap_control_tear())
+			{
+				nativeSwapInterval = -nativeSwapInterval;
+			}
+
+			// "WGL_EXT_swap_control" sets the swap interval of the window associated with the current context
+			// -> The render context is shared by all swap chains, temporarily bind it to the native window of this swap chain
+			if (!extensions.isWGL_EXT_swap_control())
+			{
+				// Error!
+				return false;
+			}
+			ContextWindows &contextWindows = static_cast<ContextWindows&>(static_cast<OpenGLRenderer&>(getRenderer()).getContext());
+			const HDC previousDeviceContext = contextWindows.getCurrentDeviceContext();
+			makeCurrent();
+			const BOOL result = wglSwapIntervalEXT(nativeSwapInterval);
+			contextWindows.makeCurrent(previousDeviceContext);
+			if (FALSE == result)
+			{
+				// Error!
+				return false;
+			}
+		#elif defined LINUX
+			if (nativeSwapInterval < 0 && !extensions.isGLX_EXT_swap_control_tear())
+			{
+				nativeSwapInterval = -nativeSwapInterval;
+			}
+
+			// Prefer "GLX_EXT_swap_control", it sets the swap interval of the given drawable and accepts 0
+			if (extensions.isGLX_EXT_swap_control())
+			{
+				glXSwapIntervalEXT(static_cast<const ContextLinux&>(static_cast<OpenGLRenderer&>(getRenderer()).getContext()).getDisplay(), mNativeWindowHandle, nativeSwapInterval);
+			}
+			else if (extensions.isGLX_SGI_swap_control() && nativeSwapInterval > 0)
+			{
+				// "GLX_SGI_swap_control" sets the swap interval of the drawable associated with the current context and can't disable the vertical synchronization
+				// -> The render context is shared by all swap chains, temporarily bind it to the native window of this swap chain
+				ContextLinux &contextLinux = static_cast<ContextLinux&>(static_cast<OpenGLRenderer&>(getRenderer()).getContext());
+				const handle previousNativeWindowHandle = contextLinux.getCurrentNativeWindowHandle();
+				makeCurrent();
+				const int result = glXSwapIntervalSGI(nativeSwapInterval);
+				contextLinux.makeCurrent(previousNativeWindowHandle);
+				if (0 != result)
+				{
+					// Error!
+					return false;
+				}
+			}
+			else
+			{
+				// Error!
+				return false;
+			}
+		#else
+			#error "Unsupported platform"
+		#endif
+
+		// Done
+		mSwapInterval = swapInterval;
+		return true;
+	}
+
+	unsigned int SwapChain::getMaximumFrameLatency() const
+	{
+		return mFramePacer.getMaximumFrameLatency();
+	}
+
+	void SwapChain::setMaximumFrameLatency(unsigned int maximumFrameLatency)
+	{
+		mFramePacer.setMaximumFrameLatency(maximumFrameLatency);
+	}
+
+	const Renderer::PresentStatistics &SwapChain::getPresentStatistics() const
+	{
+		return mFramePacer.getPresentStatistics();
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -23,6 +23,7 @@
 //[-------------------------------------------------------]
 #include "OpenGLRenderer/TessellationControlShaderGlsl.h"
 #include "OpenGLRenderer/Extensions.h"
+#include "OpenGLRenderer/OpenGLRenderer.h"
 #include "OpenGLRenderer/ShaderLanguageGlsl.h"
 
 
@@ -42,7 +43,7 @@ namespace OpenGLRenderer
 	*/
 	TessellationControlShaderGlsl::TessellationControlShaderGlsl(OpenGLRenderer &openGLRenderer, const char *sourceCode) :
 		TessellationControlShader(openGLRenderer),
-		mOpenGLShader(ShaderLanguageGlsl::loadShader(GL_TESS_CONTROL_SHADER, sourceCode))
+		mOpenGLShader(ShaderLanguageGlsl::loadShader(openGLRenderer.getAllocator(), GL_TESS_CONTROL_SHADER, sourceCode))
 	{
 		// Nothing to do in here
 	}
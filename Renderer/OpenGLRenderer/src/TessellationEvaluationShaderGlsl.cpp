@@ -23,6 +23,7 @@
 //[-------------------------------------------------------]
 #include "OpenGLRenderer/TessellationEvaluationShaderGlsl.h"
 #include "OpenGLRenderer/Extensions.h"
+#include "OpenGLRenderer/OpenGLRenderer.h"
 #include "OpenGLRenderer/ShaderLanguageGlsl.h"
 
 
@@ -42,7 +43,7 @@ namespace OpenGLRenderer
 	*/
 	TessellationEvaluationShaderGlsl::TessellationEvaluationShaderGlsl(OpenGLRenderer &openGLRenderer, const char *sourceCode) :
 		TessellationEvaluationShader(openGLRenderer),
-		mOpenGLShader(ShaderLanguageGlsl::loadShader(GL_TESS_EVALUATION_SHADER, sourceCode))
+		mOpenGLShader(ShaderLanguageGlsl::loadShader(openGLRenderer.getAllocator(), GL_TESS_EVALUATION_SHADER, sourceCode))
 	{
 		// Nothing to do in here
 	}
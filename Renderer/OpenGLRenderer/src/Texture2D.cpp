@@ -22,7 +22,10 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "OpenGLRenderer/Texture2D.h"
+#include "OpenGLRenderer/Mapping.h"
+#include "OpenGLRenderer/Extensions.h"
 #include "OpenGLRenderer/OpenGLRuntimeLinking.h"
+#include "OpenGLRenderer/OpenGLRenderer.h"
 
 
 //[-------------------------------------------------------]
@@ -41,9 +44,88 @@ namespace OpenGLRenderer
 	*/
 	Texture2D::~Texture2D()
 	{
+		// Release the bindless texture handles, they have to be made non-resident before the OpenGL texture is destroyed
+		mBindlessTextureHandles.release();
+
 		// Destroy the OpenGL texture instance
 		// -> Silently ignores 0's and names that do not correspond to existing textures
 		glDeleteTextures(1, &mOpenGLTexture);
+
+		// Destroy the OpenGL pixel pack buffer instance, in case we have one
+		if (0 != mOpenGLPixelPackBuffer)
+		{
+			glDeleteBuffersARB(1, &mOpenGLPixelPackBuffer);
+		}
+	}
+
+	bool Texture2D::copyFromTexture2D(const Texture2D &sourceTexture2D)
+	{
+		// Multisample textures can't be read back directly, resolve them first
+		if (sourceTexture2D.getNumberOfMultisamples() > 1 || mNumberOfMultisamples > 1)
+		{
+			// Error!
+			return false;
+		}
+
+		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+			// Backup the currently set alignment
+			GLint openGLAlignmentBackup = 0;
+			glGetIntegerv(GL_PACK_ALIGNMENT, &openGLAlignmentBackup);
+
+			// Backup the currently bound OpenGL pixel pack buffer
+			GLint openGLPixelPackBufferBackup = 0;
+			glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING_ARB, &openGLPixelPackBufferBackup);
+
+			// Backup the currently bound OpenGL texture
+			GLint openGLTextureBackup = 0;
+			glGetIntegerv(GL_TEXTURE_BINDING_2D, &openGLTextureBackup);
+		#endif
+
+		// Create the OpenGL pixel pack buffer instance on first use
+		if (0 == mOpenGLPixelPackBuffer)
+		{
+			glGenBuffersARB(1, &mOpenGLPixelPackBuffer);
+			glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, mOpenGLPixelPackBuffer);
+			glBufferDataARB(GL_PIXEL_PACK_BUFFER_ARB, static_cast<GLsizeiptrARB>(getWidth() * getHeight() * Mapping::getOpenGLSize(mTextureFormat)), nullptr, GL_STREAM_READ_ARB);
+		}
+		else
+		{
+			glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, mOpenGLPixelPackBuffer);
+		}
+
+		// Set correct alignment, we want tightly packed rows
+		glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+		// Copy the base map of the source texture into the pixel pack buffer
+		// -> Because a pixel pack buffer is bound, the given pointer is an offset into the buffer and the call returns without waiting for the GPU
+		glBindTexture(GL_TEXTURE_2D, sourceTexture2D.getOpenGLTexture());
+		glGetTexImage(GL_TEXTURE_2D, 0, Mapping::getOpenGLFormat(mTextureFormat), Mapping::getOpenGLType(mTextureFormat), nullptr);
+
+		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+			// Be polite and restore the previous bound OpenGL texture
+			glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(openGLTextureBackup));
+
+			// Be polite and restore the previous bound OpenGL pixel pack buffer
+			glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, static_cast<GLuint>(openGLPixelPackBufferBackup));
+
+			// Restore previous alignment
+			glPixelStorei(GL_PACK_ALIGNMENT, openGLAlignmentBackup);
+		#else
+			// Unbind the OpenGL pixel pack buffer, else following pixel transfers would use it
+			glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, 0);
+		#endif
+
+		// Done
+		return true;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture methods             ]
+	//[-------------------------------------------------------]
+	unsigned long long Texture2D::getBindlessHandle(Renderer::ISamplerState *samplerState)
+	{
+		return mBindlessTextureHandles.getHandle(static_cast<OpenGLRenderer&>(getRenderer()), mOpenGLTexture, samplerState);
 	}
 
 
@@ -54,9 +136,15 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Constructor
 	*/
-	Texture2D::Texture2D(OpenGLRenderer &openGLRenderer, unsigned int width, unsigned int height) :
+	Texture2D::Texture2D(OpenGLRenderer &openGLRenderer, unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, unsigned int numberOfMultisamples) :
 		ITexture2D(reinterpret_cast<Renderer::IRenderer&>(openGLRenderer), width, height),
-		mOpenGLTexture(0)
+		mOpenGLTexture(0),
+		mOpenGLInternalFormat(Mapping::getOpenGLInternalFormat(textureFormat)),
+		mNumberOfMultisamples(numberOfMultisamples),
+		mOpenGLTextureTarget(static_cast<unsigned int>((numberOfMultisamples > 1) ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D)),
+		mTextureFormat(textureFormat),
+		mOpenGLPixelPackBuffer(0),
+		mBindlessTextureHandles(getRenderer().getAllocator())
 	{
 		// Create the OpenGL texture instance
 		glGenTextures(1, &mOpenGLTexture);
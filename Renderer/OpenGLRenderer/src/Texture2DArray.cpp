@@ -23,6 +23,7 @@
 //[-------------------------------------------------------]
 #include "OpenGLRenderer/Texture2DArray.h"
 #include "OpenGLRenderer/OpenGLRuntimeLinking.h"
+#include "OpenGLRenderer/OpenGLRenderer.h"
 
 
 //[-------------------------------------------------------]
@@ -41,12 +42,24 @@ namespace OpenGLRenderer
 	*/
 	Texture2DArray::~Texture2DArray()
 	{
+		// Release the bindless texture handles, they have to be made non-resident before the OpenGL texture is destroyed
+		mBindlessTextureHandles.release();
+
 		// Destroy the OpenGL texture instance
 		// -> Silently ignores 0's and names that do not correspond to existing textures
 		glDeleteTextures(1, &mOpenGLTexture);
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture methods             ]
+	//[-------------------------------------------------------]
+	unsigned long long Texture2DArray::getBindlessHandle(Renderer::ISamplerState *samplerState)
+	{
+		return mBindlessTextureHandles.getHandle(static_cast<OpenGLRenderer&>(getRenderer()), mOpenGLTexture, samplerState);
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
@@ -54,9 +67,11 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Constructor
 	*/
-	Texture2DArray::Texture2DArray(OpenGLRenderer &openGLRenderer, unsigned int width, unsigned int height, unsigned int numberOfSlices) :
+	Texture2DArray::Texture2DArray(OpenGLRenderer &openGLRenderer, unsigned int width, unsigned int height, unsigned int numberOfSlices, Renderer::TextureFormat::Enum textureFormat) :
 		ITexture2DArray(reinterpret_cast<Renderer::IRenderer&>(openGLRenderer), width, height, numberOfSlices),
-		mOpenGLTexture(0)
+		mOpenGLTexture(0),
+		mTextureFormat(textureFormat),
+		mBindlessTextureHandles(getRenderer().getAllocator())
 	{
 		// Create the OpenGL texture instance
 		glGenTextures(1, &mOpenGLTexture);
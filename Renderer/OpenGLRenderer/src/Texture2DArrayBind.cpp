@@ -25,6 +25,7 @@
 #include "OpenGLRenderer/IContext.h"
 #include "OpenGLRenderer/Extensions.h"
 #include "OpenGLRenderer/OpenGLRenderer.h"
+#include "OpenGLRenderer/PixelUnpackBufferPool.h"
 #include "OpenGLRenderer/OpenGLRuntimeLinking.h"
 #include "OpenGLRenderer/Texture2DArrayBind.h"
 
@@ -44,8 +45,11 @@ namespace OpenGLRenderer
 	*    Constructor
 	*/
 	Texture2DArrayBind::Texture2DArrayBind(OpenGLRenderer &openGLRenderer, unsigned int width, unsigned int height, unsigned int numberOfSlices, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags) :
-		Texture2DArray(openGLRenderer, width, height, numberOfSlices)
+		Texture2DArray(openGLRenderer, width, height, numberOfSlices, textureFormat)
 	{
+		// Set the estimated number of bytes of the texture array
+		setNumberOfBytes(calculateNumberOfBytes(width, height, numberOfSlices, Mapping::getOpenGLSize(textureFormat), 0 != (flags & Renderer::TextureFlag::MIPMAPS), 1));
+
 		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
 			// Backup the currently set alignment
 			GLint openGLAlignmentBackup = 0;
@@ -96,6 +100,58 @@ namespace OpenGLRenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2DArray methods      ]
+	//[-------------------------------------------------------]
+	void Texture2DArrayBind::updateRegion(unsigned int mipmap, unsigned int slice, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data)
+	{
+		// Check the given data and slice
+		if (nullptr != data && slice < getNumberOfSlices())
+		{
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Backup the currently set alignment
+				GLint openGLAlignmentBackup = 0;
+				glGetIntegerv(GL_UNPACK_ALIGNMENT, &openGLAlignmentBackup);
+
+				// Backup the currently bound OpenGL texture
+				GLint openGLTextureBackup = 0;
+				glGetIntegerv(GL_TEXTURE_BINDING_2D_ARRAY_EXT, &openGLTextureBackup);
+			#endif
+
+			// Set correct alignment
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+			// Make this OpenGL texture instance to the currently used one
+			glBindTexture(GL_TEXTURE_2D_ARRAY_EXT, mOpenGLTexture);
+
+			// Upload the region
+			// -> Go through the pool of pixel unpack buffers, if possible, so the GPU can transfer the data asynchronously
+			// -> When a pixel unpack buffer is bound, the data pointer is interpreted as offset into this buffer
+			PixelUnpackBufferPool *pixelUnpackBufferPool = static_cast<OpenGLRenderer&>(getRenderer()).getPixelUnpackBufferPool();
+			const unsigned int numberOfBytes = width * height * Mapping::getOpenGLSize(mTextureFormat);
+			const GLenum openGLFormat = Mapping::getOpenGLFormat(mTextureFormat);
+			const GLenum openGLType = Mapping::getOpenGLType(mTextureFormat);
+			if (nullptr != pixelUnpackBufferPool && pixelUnpackBufferPool->beginUpload(numberOfBytes, data))
+			{
+				glTexSubImage3DEXT(GL_TEXTURE_2D_ARRAY_EXT, static_cast<GLint>(mipmap), static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLint>(slice), static_cast<GLsizei>(width), static_cast<GLsizei>(height), 1, openGLFormat, openGLType, nullptr);
+				pixelUnpackBufferPool->endUpload();
+			}
+			else
+			{
+				glTexSubImage3DEXT(GL_TEXTURE_2D_ARRAY_EXT, static_cast<GLint>(mipmap), static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLint>(slice), static_cast<GLsizei>(width), static_cast<GLsizei>(height), 1, openGLFormat, openGLType, data);
+			}
+
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Be polite and restore the previous bound OpenGL texture
+				glBindTexture(GL_TEXTURE_2D_ARRAY_EXT, static_cast<GLuint>(openGLTextureBackup));
+
+				// Restore previous alignment
+				glPixelStorei(GL_UNPACK_ALIGNMENT, openGLAlignmentBackup);
+			#endif
+		}
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -26,6 +26,7 @@
 #include "OpenGLRenderer/IContext.h"
 #include "OpenGLRenderer/Extensions.h"
 #include "OpenGLRenderer/OpenGLRenderer.h"
+#include "OpenGLRenderer/PixelUnpackBufferPool.h"
 #include "OpenGLRenderer/OpenGLRuntimeLinking.h"
 
 
@@ -43,9 +44,36 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Constructor
 	*/
-	Texture2DBind::Texture2DBind(OpenGLRenderer &openGLRenderer, unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags) :
-		Texture2D(openGLRenderer, width, height)
+	Texture2DBind::Texture2DBind(OpenGLRenderer &openGLRenderer, unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, unsigned int numberOfMultisamples) :
+		Texture2D(openGLRenderer, width, height, textureFormat, numberOfMultisamples)
 	{
+		// Set the estimated number of bytes of the texture, multisample textures have no mipmaps
+		setNumberOfBytes(calculateNumberOfBytes(width, height, 1, Mapping::getOpenGLSize(textureFormat), (numberOfMultisamples <= 1 && 0 != (flags & Renderer::TextureFlag::MIPMAPS)), numberOfMultisamples));
+
+		// Multisample texture?
+		if (numberOfMultisamples > 1)
+		{
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Backup the currently bound OpenGL multisample texture
+				GLint openGLTextureBackup = 0;
+				glGetIntegerv(GL_TEXTURE_BINDING_2D_MULTISAMPLE, &openGLTextureBackup);
+			#endif
+
+			// Make this OpenGL texture instance to the currently used one
+			glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, mOpenGLTexture);
+
+			// Allocate the multisample storage, multisample textures have no mipmaps, no initial data and no sampler state
+			glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, static_cast<GLsizei>(numberOfMultisamples), static_cast<GLint>(mOpenGLInternalFormat), static_cast<GLsizei>(width), static_cast<GLsizei>(height), GL_TRUE);
+
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Be polite and restore the previous bound OpenGL multisample texture
+				glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, static_cast<GLuint>(openGLTextureBackup));
+			#endif
+
+			// Done
+			return;
+		}
+
 		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
 			// Backup the currently set alignment
 			GLint openGLAlignmentBackup = 0;
@@ -96,6 +124,58 @@ namespace OpenGLRenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2D methods           ]
+	//[-------------------------------------------------------]
+	void Texture2DBind::updateRegion(unsigned int mipmap, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data)
+	{
+		// Multisample textures can't be initialized by uploading data
+		if (nullptr != data && 1 == mNumberOfMultisamples)
+		{
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Backup the currently set alignment
+				GLint openGLAlignmentBackup = 0;
+				glGetIntegerv(GL_UNPACK_ALIGNMENT, &openGLAlignmentBackup);
+
+				// Backup the currently bound OpenGL texture
+				GLint openGLTextureBackup = 0;
+				glGetIntegerv(GL_TEXTURE_BINDING_2D, &openGLTextureBackup);
+			#endif
+
+			// Set correct alignment
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+			// Make this OpenGL texture instance to the currently used one
+			glBindTexture(GL_TEXTURE_2D, mOpenGLTexture);
+
+			// Upload the region
+			// -> Go through the pool of pixel unpack buffers, if possible, so the GPU can transfer the data asynchronously
+			// -> When a pixel unpack buffer is bound, the data pointer is interpreted as offset into this buffer
+			PixelUnpackBufferPool *pixelUnpackBufferPool = static_cast<OpenGLRenderer&>(getRenderer()).getPixelUnpackBufferPool();
+			const unsigned int numberOfBytes = width * height * Mapping::getOpenGLSize(mTextureFormat);
+			const GLenum openGLFormat = Mapping::getOpenGLFormat(mTextureFormat);
+			const GLenum openGLType = Mapping::getOpenGLType(mTextureFormat);
+			if (nullptr != pixelUnpackBufferPool && pixelUnpackBufferPool->beginUpload(numberOfBytes, data))
+			{
+				glTexSubImage2D(GL_TEXTURE_2D, static_cast<GLint>(mipmap), static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLsizei>(width), static_cast<GLsizei>(height), openGLFormat, openGLType, nullptr);
+				pixelUnpackBufferPool->endUpload();
+			}
+			else
+			{
+				glTexSubImage2D(GL_TEXTURE_2D, static_cast<GLint>(mipmap), static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLsizei>(width), static_cast<GLsizei>(height), openGLFormat, openGLType, data);
+			}
+
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Be polite and restore the previous bound OpenGL texture
+				glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(openGLTextureBackup));
+
+				// Restore previous alignment
+				glPixelStorei(GL_UNPACK_ALIGNMENT, openGLAlignmentBackup);
+			#endif
+		}
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
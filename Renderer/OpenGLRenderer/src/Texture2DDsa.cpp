@@ -26,6 +26,7 @@
 #include "OpenGLRenderer/IContext.h"
 #include "OpenGLRenderer/Extensions.h"
 #include "OpenGLRenderer/OpenGLRenderer.h"
+#include "OpenGLRenderer/PixelUnpackBufferPool.h"
 #include "OpenGLRenderer/OpenGLRuntimeLinking.h"
 
 
@@ -44,8 +45,11 @@ namespace OpenGLRenderer
 	*    Constructor
 	*/
 	Texture2DDsa::Texture2DDsa(OpenGLRenderer &openGLRenderer, unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags) :
-		Texture2D(openGLRenderer, width, height)
+		Texture2D(openGLRenderer, width, height, textureFormat)
 	{
+		// Set the estimated number of bytes of the texture
+		setNumberOfBytes(calculateNumberOfBytes(width, height, 1, Mapping::getOpenGLSize(textureFormat), 0 != (flags & Renderer::TextureFlag::MIPMAPS), 1));
+
 		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
 			// Backup the currently set alignment
 			GLint openGLAlignmentBackup = 0;
@@ -86,6 +90,48 @@ namespace OpenGLRenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2D methods           ]
+	//[-------------------------------------------------------]
+	void Texture2DDsa::updateRegion(unsigned int mipmap, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data)
+	{
+		// Multisample textures can't be initialized by uploading data
+		if (nullptr != data && 1 == mNumberOfMultisamples)
+		{
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Backup the currently set alignment
+				GLint openGLAlignmentBackup = 0;
+				glGetIntegerv(GL_UNPACK_ALIGNMENT, &openGLAlignmentBackup);
+			#endif
+
+			// Set correct alignment
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+			// Upload the region
+			// -> Go through the pool of pixel unpack buffers, if possible, so the GPU can transfer the data asynchronously
+			// -> When a pixel unpack buffer is bound, the data pointer is interpreted as offset into this buffer
+			PixelUnpackBufferPool *pixelUnpackBufferPool = static_cast<OpenGLRenderer&>(getRenderer()).getPixelUnpackBufferPool();
+			const unsigned int numberOfBytes = width * height * Mapping::getOpenGLSize(mTextureFormat);
+			const GLenum openGLFormat = Mapping::getOpenGLFormat(mTextureFormat);
+			const GLenum openGLType = Mapping::getOpenGLType(mTextureFormat);
+			if (nullptr != pixelUnpackBufferPool && pixelUnpackBufferPool->beginUpload(numberOfBytes, data))
+			{
+				glTextureSubImage2DEXT(mOpenGLTexture, GL_TEXTURE_2D, static_cast<GLint>(mipmap), static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLsizei>(width), static_cast<GLsizei>(height), openGLFormat, openGLType, nullptr);
+				pixelUnpackBufferPool->endUpload();
+			}
+			else
+			{
+				glTextureSubImage2DEXT(mOpenGLTexture, GL_TEXTURE_2D, static_cast<GLint>(mipmap), static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLsizei>(width), static_cast<GLsizei>(height), openGLFormat, openGLType, data);
+			}
+
+			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
+				// Restore previous alignment
+				glPixelStorei(GL_UNPACK_ALIGNMENT, openGLAlignmentBackup);
+			#endif
+		}
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
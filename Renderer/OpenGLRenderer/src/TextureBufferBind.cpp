@@ -44,6 +44,9 @@ namespace OpenGLRenderer
 	TextureBufferBind::TextureBufferBind(OpenGLRenderer &openGLRenderer, unsigned int numberOfBytes, Renderer::TextureFormat::Enum textureFormat, const void *data, Renderer::BufferUsage::Enum bufferUsage) :
 		TextureBuffer(openGLRenderer)
 	{
+		// Set the estimated number of bytes of the texture buffer
+		setNumberOfBytes(numberOfBytes);
+
 		{ // Buffer part
 			#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
 				// Backup the currently bound OpenGL texture buffer
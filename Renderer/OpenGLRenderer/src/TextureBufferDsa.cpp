@@ -44,6 +44,9 @@ namespace OpenGLRenderer
 	TextureBufferDsa::TextureBufferDsa(OpenGLRenderer &openGLRenderer, unsigned int numberOfBytes, Renderer::TextureFormat::Enum textureFormat, const void *data, Renderer::BufferUsage::Enum bufferUsage) :
 		TextureBuffer(openGLRenderer)
 	{
+		// Set the estimated number of bytes of the texture buffer
+		setNumberOfBytes(numberOfBytes);
+
 		{ // Buffer part
 			// Upload the data
 			// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 2 constants, do not change them
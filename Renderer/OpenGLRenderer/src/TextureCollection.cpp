@@ -22,6 +22,10 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "OpenGLRenderer/TextureCollection.h"
+#include "OpenGLRenderer/Texture2DArray.h"
+#include "OpenGLRenderer/TextureBuffer.h"
+#include "OpenGLRenderer/Extensions.h"
+#include "OpenGLRenderer/Texture2D.h"
 #include "OpenGLRenderer/OpenGLRenderer.h"
 
 #include <Renderer/ITexture.h>
@@ -44,7 +48,9 @@ namespace OpenGLRenderer
 	TextureCollection::TextureCollection(OpenGLRenderer &openGLRenderer, unsigned int numberOfTextures, Renderer::ITexture **textures) :
 		Renderer::ITextureCollection(openGLRenderer),
 		mNumberOfTextures(numberOfTextures),
-		mTextures((numberOfTextures > 0) ? new Renderer::ITexture*[numberOfTextures] : nullptr)
+		mTextures(openGLRenderer.getAllocator().allocateArray<Renderer::ITexture*>(numberOfTextures, Renderer::AllocationTag::RESOURCE)),
+		mOpenGLTextures(openGLRenderer.getAllocator().allocateArray<unsigned int>(numberOfTextures, Renderer::AllocationTag::RESOURCE)),
+		mOpenGLTextureTargets(openGLRenderer.getAllocator().allocateArray<unsigned int>(numberOfTextures, Renderer::AllocationTag::RESOURCE))
 	{
 		// Loop through all given textures
 		Renderer::ITexture **currentTexture = mTextures;
@@ -58,6 +64,58 @@ namespace OpenGLRenderer
 			texture->addReference();
 			*currentTexture = texture;
 
+			// Resolve the OpenGL texture and texture target right now, so setting the texture collection doesn't have to evaluate the texture types
+			// -> No texture at a unit is expressed by texture 0, just like "glBindTextures()" ("GL_ARB_multi_bind") expects it
+			const size_t index = static_cast<size_t>(currentTexture - mTextures);
+			mOpenGLTextures[index]		 = 0;
+			mOpenGLTextureTargets[index] = GL_TEXTURE_2D;
+			switch (texture->getResourceType())
+			{
+				case Renderer::ResourceType::TEXTURE_BUFFER:
+					mOpenGLTextures[index]		 = static_cast<TextureBuffer*>(texture)->getOpenGLTexture();
+					mOpenGLTextureTargets[index] = GL_TEXTURE_BUFFER_ARB;
+					break;
+
+				case Renderer::ResourceType::TEXTURE_2D:
+				{
+					// Multisample textures are bound to "GL_TEXTURE_2D_MULTISAMPLE"
+					const Texture2D *texture2D = static_cast<Texture2D*>(texture);
+					mOpenGLTextures[index]		 = texture2D->getOpenGLTexture();
+					mOpenGLTextureTargets[index] = texture2D->getOpenGLTextureTarget();
+					break;
+				}
+
+				case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+					mOpenGLTextures[index]		 = static_cast<Texture2DArray*>(texture)->getOpenGLTexture();
+					mOpenGLTextureTargets[index] = GL_TEXTURE_2D_ARRAY_EXT;
+					break;
+
+				case Renderer::ResourceType::PROGRAM:
+				case Renderer::ResourceType::VERTEX_ARRAY:
+				case Renderer::ResourceType::SWAP_CHAIN:
+				case Renderer::ResourceType::FRAMEBUFFER:
+				case Renderer::ResourceType::INDEX_BUFFER:
+				case Renderer::ResourceType::VERTEX_BUFFER:
+				case Renderer::ResourceType::UNIFORM_BUFFER:
+				case Renderer::ResourceType::INDIRECT_BUFFER:
+				case Renderer::ResourceType::RASTERIZER_STATE:
+				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
+				case Renderer::ResourceType::BLEND_STATE:
+				case Renderer::ResourceType::SAMPLER_STATE:
+				case Renderer::ResourceType::VERTEX_SHADER:
+				case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
+				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
+				case Renderer::ResourceType::GEOMETRY_SHADER:
+				case Renderer::ResourceType::FRAGMENT_SHADER:
+				case Renderer::ResourceType::COMPUTE_SHADER:
+				case Renderer::ResourceType::TEXTURE_COLLECTION:
+				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+				case Renderer::ResourceType::FENCE:
+				default:
+					// Not handled in here
+					break;
+			}
+
 			// Security check: Is the given resource owned by this renderer?
 			#ifndef OPENGLRENDERER_NO_RENDERERMATCHCHECK
 				if (&openGLRenderer != &texture->getRenderer())
@@ -87,7 +145,9 @@ namespace OpenGLRenderer
 			}
 
 			// Release the allocated memory
-			delete [] mTextures;
+			getRenderer().getAllocator().deallocateArray(mTextures, Renderer::AllocationTag::RESOURCE);
+			getRenderer().getAllocator().deallocateArray(mOpenGLTextures, Renderer::AllocationTag::RESOURCE);
+			getRenderer().getAllocator().deallocateArray(mOpenGLTextureTargets, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
@@ -43,6 +43,9 @@ namespace OpenGLRenderer
 	UniformBufferGlslBind::UniformBufferGlslBind(OpenGLRenderer &openGLRenderer, unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage) :
 		UniformBufferGlsl(openGLRenderer)
 	{
+		// Set the estimated number of bytes of the uniform buffer
+		setNumberOfBytes(numberOfBytes);
+
 		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
 			// Backup the currently bound OpenGL uniform buffer
 			GLint openGLUniformBufferBackup = 0;
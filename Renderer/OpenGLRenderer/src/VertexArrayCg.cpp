@@ -52,8 +52,8 @@ namespace OpenGLRenderer
 		VertexArray(static_cast<OpenGLRenderer&>(programCg.getRenderer()), indexBuffer, InternalResourceType::CG),
 		mProgramCg(&programCg),
 		mNumberOfAttributes(numberOfAttributes),
-		mAttributes(numberOfAttributes ? new Renderer::VertexArrayAttribute[numberOfAttributes] : nullptr),
-		mCgParameters(numberOfAttributes ? new CGparameter[numberOfAttributes] : nullptr)
+		mAttributes(programCg.getRenderer().getAllocator().allocateArray<Renderer::VertexArrayAttribute>(numberOfAttributes, Renderer::AllocationTag::RESOURCE)),
+		mCgParameters(programCg.getRenderer().getAllocator().allocateArray<CGparameter>(numberOfAttributes, Renderer::AllocationTag::RESOURCE))
 	{
 		// Acquire our Cg program reference
 		mProgramCg->addReference();
@@ -101,13 +101,13 @@ namespace OpenGLRenderer
 			}
 
 			// Cleanup
-			delete [] mAttributes;
+			getRenderer().getAllocator().deallocateArray(mAttributes, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Destroy the Cg parameters
 		if (nullptr != mCgParameters)
 		{
-			delete [] mCgParameters;
+			getRenderer().getAllocator().deallocateArray(mCgParameters, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Release our Cg program reference
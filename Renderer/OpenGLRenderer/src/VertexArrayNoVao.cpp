@@ -52,8 +52,8 @@ namespace OpenGLRenderer
 	VertexArrayNoVao::VertexArrayNoVao(Program &program, unsigned int numberOfAttributes, const Renderer::VertexArrayAttribute *attributes, IndexBuffer *indexBuffer) :
 		VertexArray(static_cast<OpenGLRenderer&>(program.getRenderer()), indexBuffer, InternalResourceType::NO_VAO),
 		mNumberOfAttributes(numberOfAttributes),
-		mAttributes(numberOfAttributes ? new Renderer::VertexArrayAttribute[numberOfAttributes] : nullptr),
-		mAttributeLocations(numberOfAttributes ? new int[numberOfAttributes] : nullptr),
+		mAttributes(program.getRenderer().getAllocator().allocateArray<Renderer::VertexArrayAttribute>(numberOfAttributes, Renderer::AllocationTag::RESOURCE)),
+		mAttributeLocations(program.getRenderer().getAllocator().allocateArray<int>(numberOfAttributes, Renderer::AllocationTag::RESOURCE)),
 		mIsGL_ARB_instanced_arrays(static_cast<OpenGLRenderer&>(program.getRenderer()).getContext().getExtensions().isGL_ARB_instanced_arrays())
 	{
 		// Copy over the data
@@ -96,13 +96,13 @@ namespace OpenGLRenderer
 			}
 
 			// Cleanup
-			delete [] mAttributes;
+			getRenderer().getAllocator().deallocateArray(mAttributes, Renderer::AllocationTag::RESOURCE);
 		}
 
 		// Destroy the vertex array attribute locations
 		if (nullptr != mAttributeLocations)
 		{
-			delete [] mAttributeLocations;
+			getRenderer().getAllocator().deallocateArray(mAttributeLocations, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
@@ -59,7 +59,7 @@ namespace OpenGLRenderer
 			}
 
 			// Cleanup
-			delete [] mVertexBuffers;
+			getRenderer().getAllocator().deallocateArray(mVertexBuffers, Renderer::AllocationTag::RESOURCE);
 		}
 	}
 
@@ -80,7 +80,7 @@ namespace OpenGLRenderer
 		// Add a reference to the used vertex buffers
 		if (numberOfAttributes > 0)
 		{
-			mVertexBuffers = new VertexBuffer*[numberOfAttributes];
+			mVertexBuffers = getRenderer().getAllocator().allocateArray<VertexBuffer*>(numberOfAttributes, Renderer::AllocationTag::RESOURCE);
 
 			// Loop through all attributes
 			VertexBuffer **vertexBuffers = mVertexBuffers;
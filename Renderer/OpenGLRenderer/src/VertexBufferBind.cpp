@@ -43,6 +43,9 @@ namespace OpenGLRenderer
 	VertexBufferBind::VertexBufferBind(OpenGLRenderer &openGLRenderer, unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage) :
 		VertexBuffer(openGLRenderer)
 	{
+		// Set the estimated number of bytes of the vertex buffer
+		setNumberOfBytes(numberOfBytes);
+
 		#ifndef OPENGLRENDERER_NO_STATE_CLEANUP
 			// Backup the currently bound OpenGL array buffer
 			GLint openGLArrayBufferBackup = 0;
@@ -23,6 +23,7 @@
 //[-------------------------------------------------------]
 #include "OpenGLRenderer/VertexShaderGlsl.h"
 #include "OpenGLRenderer/Extensions.h"
+#include "OpenGLRenderer/OpenGLRenderer.h"
 #include "OpenGLRenderer/ShaderLanguageGlsl.h"
 
 
@@ -42,7 +43,7 @@ namespace OpenGLRenderer
 	*/
 	VertexShaderGlsl::VertexShaderGlsl(OpenGLRenderer &openGLRenderer, const char *sourceCode) :
 		VertexShader(openGLRenderer),
-		mOpenGLShader(ShaderLanguageGlsl::loadShader(GL_VERTEX_SHADER_ARB, sourceCode))
+		mOpenGLShader(ShaderLanguageGlsl::loadShader(openGLRenderer.getAllocator(), GL_VERTEX_SHADER_ARB, sourceCode))
 	{
 		// Nothing to do in here
 	}
@@ -40,12 +40,14 @@ namespace OpenGLRenderer
 	*  @brief
 	*    Constructor
 	*/
-	ContextWindows::ContextWindows(handle nativeWindowHandle) :
-		mOpenGLRuntimeLinking(new OpenGLRuntimeLinking()),
+	ContextWindows::ContextWindows(Renderer::IAllocator &allocator, handle nativeWindowHandle) :
+		IContext(allocator),
+		mOpenGLRuntimeLinking(new (allocator) OpenGLRuntimeLinking()),
 		mNativeWindowHandle(nativeWindowHandle),
 		mDummyWindow(NULL_HANDLE),
 		mWindowDeviceContext(NULL_HANDLE),
-		mWindowRenderContext(NULL_HANDLE)
+		mWindowRenderContext(NULL_HANDLE),
+		mCurrentDeviceContext(NULL_HANDLE)
 	{
 		// Is OpenGL available?
 		if (mOpenGLRuntimeLinking->isOpenGLAvaiable())
@@ -133,7 +135,10 @@ namespace OpenGLRenderer
 							if (NULL_HANDLE != mWindowRenderContext)
 							{
 								// Make the OpenGL context to the current one
-								wglMakeCurrent(mWindowDeviceContext, mWindowRenderContext);
+								if (wglMakeCurrent(mWindowDeviceContext, mWindowRenderContext))
+								{
+									mCurrentDeviceContext = mWindowDeviceContext;
+								}
 							}
 						}
 						else
@@ -223,6 +228,49 @@ namespace OpenGLRenderer
 		delete mOpenGLRuntimeLinking;
 	}
 
+	/**
+	*  @brief
+	*    Prepare the device context of an additional window so that the render context can be bound to it
+	*/
+	bool ContextWindows::setupDeviceContext(HDC deviceContext) const
+	{
+		// The pixel format of a window can only be set once
+		const int pixelFormat = ::GetPixelFormat(mWindowDeviceContext);
+		const int currentPixelFormat = ::GetPixelFormat(deviceContext);
+		if (0 == currentPixelFormat)
+		{
+			// Use the pixel format of the primary device context
+			PIXELFORMATDESCRIPTOR pixelFormatDescriptor;
+			::DescribePixelFormat(mWindowDeviceContext, pixelFormat, sizeof(PIXELFORMATDESCRIPTOR), &pixelFormatDescriptor);
+			return (FALSE != ::SetPixelFormat(deviceContext, pixelFormat, &pixelFormatDescriptor));
+		}
+
+		// Done
+		return (currentPixelFormat == pixelFormat);
+	}
+
+	/**
+	*  @brief
+	*    Bind the render context to the given device context
+	*/
+	void ContextWindows::makeCurrent(HDC deviceContext)
+	{
+		// A null pointer stands for the primary device context
+		if (NULL_HANDLE == deviceContext)
+		{
+			deviceContext = mWindowDeviceContext;
+		}
+
+		// Exchange the device context, but only if it's really required
+		if (mCurrentDeviceContext != deviceContext && NULL_HANDLE != mWindowRenderContext)
+		{
+			if (wglMakeCurrent(deviceContext, mWindowRenderContext))
+			{
+				mCurrentDeviceContext = deviceContext;
+			}
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private static methods                                ]
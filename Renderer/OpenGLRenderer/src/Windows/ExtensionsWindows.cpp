@@ -86,6 +86,9 @@ namespace OpenGLRenderer
 			mWGL_EXT_swap_control = false;
 		}
 
+		// WGL_EXT_swap_control_tear
+		mWGL_EXT_swap_control_tear = (mWGL_EXT_swap_control && isSupported("WGL_EXT_swap_control_tear"));
+
 		// WGL_ARB_pixel_format
 		if (isSupported("WGL_ARB_pixel_format"))
 		{
@@ -0,0 +1,163 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERER_ALLOCATOROBJECT_H__
+#define __RENDERER_ALLOCATOROBJECT_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/IAllocator.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Base class for instances which are allocated by using an allocator
+	*
+	*  @remarks
+	*    Derived classes can only be created by using "new (allocator) Class(...)", the memory knows its allocator so a plain
+	*    "delete" (e.g. "delete this" inside "Renderer::RefCount::release()") returns the memory to the right allocator.
+	*
+	*    Usage example:
+	*    @code
+	*    class Extensions : public Renderer::AllocatorObject<Renderer::AllocationTag::RENDERER>
+	*    ...
+	*    mExtensions = new (getAllocator()) Extensions(*this);
+	*    ...
+	*    delete mExtensions;
+	*    @endcode
+	*
+	*  @note
+	*    - Used for renderer backend and renderer toolkit internals, the renderer interfaces and resources have own class-level allocation operators
+	*/
+	template <AllocationTag::Enum TAG>
+	class AllocatorObject
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Allocate the memory of an instance by using the given allocator
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate
+		*  @param[in] allocator
+		*    Allocator to allocate with, must stay valid as long as the instance exists
+		*
+		*  @return
+		*    The allocated memory, null pointer on error (no constructor is called in this case)
+		*/
+		static inline void *operator new(size_t numberOfBytes, IAllocator &allocator) throw();
+
+		/**
+		*  @brief
+		*    Deallocate the memory of an instance
+		*
+		*  @param[in] memory
+		*    Memory to deallocate, can be a null pointer
+		*/
+		static inline void operator delete(void *memory);
+
+		/**
+		*  @brief
+		*    Deallocate the memory of an instance, only called by the compiler when the constructor failed
+		*
+		*  @param[in] memory
+		*    Memory to deallocate, can be a null pointer
+		*  @param[in] allocator
+		*    Allocator the memory was allocated with
+		*/
+		static inline void operator delete(void *memory, IAllocator &allocator);
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		inline AllocatorObject();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline ~AllocatorObject();
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Allocate the memory of an instance from the global heap, not supported
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate
+		*
+		*  @return
+		*    Not implemented
+		*/
+		static void *operator new(size_t numberOfBytes);
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "Renderer/AllocatorObject.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERER_ALLOCATOROBJECT_H__
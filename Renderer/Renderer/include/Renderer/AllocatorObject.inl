@@ -0,0 +1,91 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Allocate the memory of an instance by using the given allocator
+	*/
+	template <AllocationTag::Enum TAG>
+	inline void *AllocatorObject<TAG>::operator new(size_t numberOfBytes, IAllocator &allocator) throw()
+	{
+		return IAllocator::allocateWithHeader(allocator, numberOfBytes, TAG);
+	}
+
+	/**
+	*  @brief
+	*    Deallocate the memory of an instance
+	*/
+	template <AllocationTag::Enum TAG>
+	inline void AllocatorObject<TAG>::operator delete(void *memory)
+	{
+		IAllocator::deallocateWithHeader(memory);
+	}
+
+	/**
+	*  @brief
+	*    Deallocate the memory of an instance, only called by the compiler when the constructor failed
+	*/
+	template <AllocationTag::Enum TAG>
+	inline void AllocatorObject<TAG>::operator delete(void *memory, IAllocator &)
+	{
+		IAllocator::deallocateWithHeader(memory);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Default constructor
+	*/
+	template <AllocationTag::Enum TAG>
+	inline AllocatorObject<TAG>::AllocatorObject()
+	{
+		// Nothing to do in here
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	template <AllocationTag::Enum TAG>
+	inline AllocatorObject<TAG>::~AllocatorObject()
+	{
+		// Nothing to do in here
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
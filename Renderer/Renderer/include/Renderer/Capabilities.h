@@ -56,12 +56,15 @@ namespace Renderer
 		unsigned int maximumNumberOfSimultaneousRenderTargets;	/**< Maximum number of simultaneous render targets (if <1 render to texture is not supported) */
 		unsigned int maximumTextureDimension;					/**< Maximum texture dimension (usually 2048, 4096, 8192 or 16384) */
 		unsigned int maximumNumberOf2DTextureArraySlices;		/**< Maximum number of 2D texture array slices (usually 512 up to 8192, in case there's no support for 2D texture arrays it's 0) */
+		unsigned int maximumNumberOfMultisamples;				/**< Maximum number of multisamples per texel of a render target texture (always at least 1, usually 8, all powers of two up to this value are supported) */
 		bool		 uniformBuffer;								/**< Uniform buffer object (UBO, "constant buffer" in Direct3D terminology) supported? */
 		unsigned int maximumTextureBufferSize;					/**< Maximum texture buffer (TBO) size in texel (>65536, typically much larger than that of one-dimensional texture, in case there's no support for texture buffer it's 0) */
 		bool		 individualUniforms;						/**< Individual uniforms ("constants" in Direct3D terminology) supported? If not, only uniform buffer objects are supported. */
 		bool		 instancedArrays;							/**< Instanced arrays supported? (shader model 3 feature, vertex array element advancing per-instance instead of per-vertex) */
 		bool		 drawInstanced;								/**< Draw instanced supported? (shader model 4 feature, build in shader variable holding the current instance ID) */
 		bool		 baseVertex;								/**< Base vertex supported for draw calls? */
+		bool		 multiDrawIndirect;							/**< Native multi-draw indirect supported? If not, "Renderer::IRenderer::multiDrawIndexedIndirect()" is emulated by using a loop. */
+		bool		 bindlessTexture;							/**< Bindless textures supported? (64 bit texture handles which can be written into buffers, see "Renderer::ITexture::getBindlessHandle()") */
 		// Vertex-shader (VS) stage
 		bool		 vertexShader;								/**< Is there support for vertex shaders (VS)? */
 		// Tessellation-control-shader (TCS) stage and tessellation-evaluation-shader (TES) stage
@@ -70,6 +73,9 @@ namespace Renderer
 		unsigned int maximumNumberOfGsOutputVertices;			/**< Maximum number of vertices a geometry shader (GS) can emit (usually 0 for no geometry shader support or 1024) */
 		// Fragment-shader (FS) stage
 		bool		 fragmentShader;							/**< Is there support for fragment shaders (FS)? */
+		// Compute-shader (CS) stage
+		bool		 computeShader;								/**< Is there support for compute shaders (CS)? */
+		unsigned int maximumNumberOfStreamOutputTargets;		/**< Maximum number of stream output ("transform feedback" in OpenGL terminology) target vertex buffers (usually 0 for no stream output support or 4) */
 
 
 	//[-------------------------------------------------------]
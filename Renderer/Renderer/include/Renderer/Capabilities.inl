@@ -37,15 +37,20 @@ namespace Renderer
 		maximumNumberOfSimultaneousRenderTargets(0),
 		maximumTextureDimension(0),
 		maximumNumberOf2DTextureArraySlices(0),
+		maximumNumberOfMultisamples(1),
 		uniformBuffer(false),
 		maximumTextureBufferSize(0),
 		individualUniforms(false),
 		instancedArrays(false),
 		drawInstanced(false),
 		baseVertex(false),
+		multiDrawIndirect(false),
+		bindlessTexture(false),
 		vertexShader(false),
 		maximumNumberOfPatchVertices(0),
-		maximumNumberOfGsOutputVertices(0)
+		maximumNumberOfGsOutputVertices(0),
+		computeShader(false),
+		maximumNumberOfStreamOutputTargets(0)
 	{
 		// Nothing to do in here
 	}
@@ -72,15 +77,20 @@ namespace Renderer
 		maximumNumberOfSimultaneousRenderTargets(0),
 		maximumTextureDimension(0),
 		maximumNumberOf2DTextureArraySlices(0),
+		maximumNumberOfMultisamples(1),
 		uniformBuffer(false),
 		maximumTextureBufferSize(0),
 		individualUniforms(false),
 		instancedArrays(false),
 		drawInstanced(false),
 		baseVertex(false),
+		multiDrawIndirect(false),
+		bindlessTexture(false),
 		vertexShader(false),
 		maximumNumberOfPatchVertices(0),
-		maximumNumberOfGsOutputVertices(0)
+		maximumNumberOfGsOutputVertices(0),
+		computeShader(false),
+		maximumNumberOfStreamOutputTargets(0)
 	{
 		// Not supported
 	}
@@ -0,0 +1,208 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERER_DEFAULTALLOCATOR_H__
+#define __RENDERER_DEFAULTALLOCATOR_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/IAllocator.h"
+#include "Renderer/PlatformTypes.h"
+
+#include <atomic>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Default malloc based allocator with per allocation tag statistics
+	*
+	*  @remarks
+	*    Each allocation is prefixed with a small header storing the number of bytes, so the statistics can be updated
+	*    on deallocation. The statistics are updated atomically, the allocator can be used from multiple threads.
+	*/
+	class DefaultAllocator : public IAllocator
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return the default allocator instance which is used when no allocator was passed at renderer creation
+		*
+		*  @return
+		*    The default allocator instance
+		*
+		*  @note
+		*    - When using shared libraries, each renderer backend has its own default allocator instance
+		*/
+		static inline DefaultAllocator &getInstance();
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		inline DefaultAllocator();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline virtual ~DefaultAllocator();
+
+		/**
+		*  @brief
+		*    Return the current number of bytes allocated with the given tag
+		*
+		*  @param[in] tag
+		*    Allocation tag
+		*
+		*  @return
+		*    The current number of bytes allocated with the given tag, the allocation headers and alignment padding are not included
+		*/
+		inline unsigned long long getCurrentNumberOfBytes(AllocationTag::Enum tag) const;
+
+		/**
+		*  @brief
+		*    Return the current number of allocations with the given tag
+		*
+		*  @param[in] tag
+		*    Allocation tag
+		*
+		*  @return
+		*    The current number of allocations with the given tag
+		*/
+		inline unsigned int getCurrentNumberOfAllocations(AllocationTag::Enum tag) const;
+
+		/**
+		*  @brief
+		*    Return the total number of allocations which were done with the given tag
+		*
+		*  @param[in] tag
+		*    Allocation tag
+		*
+		*  @return
+		*    The total number of allocations which were done with the given tag, a high number compared to the current number of allocations indicates heap churn
+		*/
+		inline unsigned int getTotalNumberOfAllocations(AllocationTag::Enum tag) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IAllocator methods           ]
+	//[-------------------------------------------------------]
+	public:
+		inline virtual void *allocate(unsigned int numberOfBytes, unsigned int alignment, AllocationTag::Enum tag) override;
+		inline virtual void deallocate(void *memory, AllocationTag::Enum tag) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Header in front of each allocation
+		*/
+		struct Header
+		{
+			void		 *memory;			/**< Memory returned by "malloc()", always valid */
+			unsigned int  numberOfBytes;	/**< Requested number of bytes */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		inline explicit DefaultAllocator(const DefaultAllocator &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		inline DefaultAllocator &operator =(const DefaultAllocator &source);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		std::atomic<unsigned long long> mCurrentNumberOfBytes[AllocationTag::NUMBER_OF_TAGS];			/**< Current number of bytes per allocation tag */
+		std::atomic<unsigned int>		mCurrentNumberOfAllocations[AllocationTag::NUMBER_OF_TAGS];	/**< Current number of allocations per allocation tag */
+		std::atomic<unsigned int>		mTotalNumberOfAllocations[AllocationTag::NUMBER_OF_TAGS];	/**< Total number of allocations per allocation tag */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "Renderer/DefaultAllocator.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERER_DEFAULTALLOCATOR_H__
@@ -0,0 +1,180 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <stdlib.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Return the default allocator instance which is used when no allocator was passed at renderer creation
+	*/
+	inline DefaultAllocator &DefaultAllocator::getInstance()
+	{
+		static DefaultAllocator defaultAllocator;
+		return defaultAllocator;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Default constructor
+	*/
+	inline DefaultAllocator::DefaultAllocator()
+	{
+		for (unsigned int i = 0; i < AllocationTag::NUMBER_OF_TAGS; ++i)
+		{
+			mCurrentNumberOfBytes[i] = 0;
+			mCurrentNumberOfAllocations[i] = 0;
+			mTotalNumberOfAllocations[i] = 0;
+		}
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline DefaultAllocator::~DefaultAllocator()
+	{
+		// Nothing to do in here
+	}
+
+	/**
+	*  @brief
+	*    Return the current number of bytes allocated with the given tag
+	*/
+	inline unsigned long long DefaultAllocator::getCurrentNumberOfBytes(AllocationTag::Enum tag) const
+	{
+		return mCurrentNumberOfBytes[tag];
+	}
+
+	/**
+	*  @brief
+	*    Return the current number of allocations with the given tag
+	*/
+	inline unsigned int DefaultAllocator::getCurrentNumberOfAllocations(AllocationTag::Enum tag) const
+	{
+		return mCurrentNumberOfAllocations[tag];
+	}
+
+	/**
+	*  @brief
+	*    Return the total number of allocations which were done with the given tag
+	*/
+	inline unsigned int DefaultAllocator::getTotalNumberOfAllocations(AllocationTag::Enum tag) const
+	{
+		return mTotalNumberOfAllocations[tag];
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IAllocator methods           ]
+	//[-------------------------------------------------------]
+	inline void *DefaultAllocator::allocate(unsigned int numberOfBytes, unsigned int alignment, AllocationTag::Enum tag)
+	{
+		// The header in front of the returned memory must be aligned as well
+		if (alignment < sizeof(void*))
+		{
+			alignment = sizeof(void*);
+		}
+
+		// Allocate the memory including the header and the alignment padding
+		void *memory = malloc(numberOfBytes + sizeof(Header) + alignment - 1);
+		if (nullptr != memory)
+		{
+			// Align the returned memory and write the header directly in front of it
+			const size_t address = (reinterpret_cast<size_t>(memory) + sizeof(Header) + alignment - 1) & ~static_cast<size_t>(alignment - 1);
+			Header *header = reinterpret_cast<Header*>(address) - 1;
+			header->memory = memory;
+			header->numberOfBytes = numberOfBytes;
+
+			// Update the statistics
+			mCurrentNumberOfBytes[tag] += numberOfBytes;
+			++mCurrentNumberOfAllocations[tag];
+			++mTotalNumberOfAllocations[tag];
+
+			// Done
+			return reinterpret_cast<void*>(address);
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	inline void DefaultAllocator::deallocate(void *memory, AllocationTag::Enum tag)
+	{
+		if (nullptr != memory)
+		{
+			// Update the statistics
+			const Header *header = static_cast<const Header*>(memory) - 1;
+			mCurrentNumberOfBytes[tag] -= header->numberOfBytes;
+			--mCurrentNumberOfAllocations[tag];
+
+			// Free the memory
+			free(header->memory);
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Copy constructor
+	*/
+	inline DefaultAllocator::DefaultAllocator(const DefaultAllocator &) :
+		IAllocator()
+	{
+		// Not supported
+	}
+
+	/**
+	*  @brief
+	*    Copy operator
+	*/
+	inline DefaultAllocator &DefaultAllocator::operator =(const DefaultAllocator &)
+	{
+		// Not supported
+		return *this;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
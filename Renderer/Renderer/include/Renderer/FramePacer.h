@@ -0,0 +1,205 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERER_FRAMEPACER_H__
+#define __RENDERER_FRAMEPACER_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/IFence.h"
+#include "Renderer/SwapChainTypes.h"
+
+#include <chrono>	// For "std::chrono::steady_clock"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Frame pacing helper for swap chain implementations
+	*
+	*  @remarks
+	*    Without a limit the CPU is free to queue up as many frames as the driver accepts, usually three or four, which
+	*    results in a high input latency and uneven frame times. The frame pacer puts a fence into the command stream
+	*    after each present and blocks the next presents as soon as the GPU is more than the maximum frame latency of
+	*    presents behind. Additionally, the present intervals are recorded.
+	*
+	*    Usage example:
+	*    @code
+	*    mFramePacer.beginPresent();
+	*    // Native present
+	*    mFramePacer.endPresent();
+	*    @endcode
+	*
+	*  @note
+	*    - Not thread safe, the same rules as for the owner renderer instance apply
+	*    - Without fence support (see "Renderer::IRenderer::insertFence()") the maximum frame latency can't be enforced,
+	*      the present intervals are recorded nevertheless
+	*/
+	class FramePacer
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const unsigned int MAXIMUM_FRAME_LATENCY = 16;	/**< Maximum supported frame latency */
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] renderer
+		*    Renderer instance to insert the fences into, the instance must stay valid as long as this frame pacer instance exists
+		*/
+		inline explicit FramePacer(IRenderer &renderer);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline ~FramePacer();
+
+		/**
+		*  @brief
+		*    Return the maximum frame latency
+		*
+		*  @return
+		*    The maximum number of presents the CPU is allowed to run ahead of the GPU, 0 if the driver decides
+		*/
+		inline unsigned int getMaximumFrameLatency() const;
+
+		/**
+		*  @brief
+		*    Set the maximum frame latency
+		*
+		*  @param[in] maximumFrameLatency
+		*    The maximum number of presents the CPU is allowed to run ahead of the GPU, 0 if the driver decides, clamped to "MAXIMUM_FRAME_LATENCY"
+		*/
+		inline void setMaximumFrameLatency(unsigned int maximumFrameLatency);
+
+		/**
+		*  @brief
+		*    Return the present statistics
+		*
+		*  @return
+		*    The present statistics
+		*/
+		inline const PresentStatistics &getPresentStatistics() const;
+
+		/**
+		*  @brief
+		*    Call this method right before the native present
+		*
+		*  @note
+		*    - Blocks until the GPU has finished the frame presented "maximum frame latency" presents ago
+		*/
+		inline void beginPresent();
+
+		/**
+		*  @brief
+		*    Call this method right after the native present
+		*/
+		inline void endPresent();
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		inline explicit FramePacer(const FramePacer &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		inline FramePacer &operator =(const FramePacer &source);
+
+		/**
+		*  @brief
+		*    Release all fences
+		*/
+		inline void releaseFences();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		IRenderer								*mRenderer;							/**< Renderer instance to insert the fences into, always valid */
+		unsigned int							 mMaximumFrameLatency;				/**< The maximum number of presents the CPU is allowed to run ahead of the GPU, 0 if the driver decides */
+		IFence									*mFences[MAXIMUM_FRAME_LATENCY];	/**< Fences inserted after the last presents (ring buffer), we keep a reference to the fences, null pointer entries are allowed */
+		unsigned int							 mNextFence;						/**< Index of the fence to wait for and overwrite during the next present */
+		std::chrono::steady_clock::time_point	 mLastPresentTime;					/**< Time the last present was finished, only valid if there was at least one present */
+		PresentStatistics						 mPresentStatistics;				/**< Present statistics */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "Renderer/FramePacer.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERER_FRAMEPACER_H__
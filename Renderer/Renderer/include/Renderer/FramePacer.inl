@@ -0,0 +1,230 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/IRenderer.h"
+
+#include <string.h>	// For "memset()"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	inline FramePacer::FramePacer(IRenderer &renderer) :
+		mRenderer(&renderer),
+		mMaximumFrameLatency(0),
+		mNextFence(0)
+	{
+		memset(mFences, 0, sizeof(mFences));
+		memset(&mPresentStatistics, 0, sizeof(PresentStatistics));
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline FramePacer::~FramePacer()
+	{
+		releaseFences();
+	}
+
+	/**
+	*  @brief
+	*    Return the maximum frame latency
+	*/
+	inline unsigned int FramePacer::getMaximumFrameLatency() const
+	{
+		return mMaximumFrameLatency;
+	}
+
+	/**
+	*  @brief
+	*    Set the maximum frame latency
+	*/
+	inline void FramePacer::setMaximumFrameLatency(unsigned int maximumFrameLatency)
+	{
+		if (maximumFrameLatency > MAXIMUM_FRAME_LATENCY)
+		{
+			maximumFrameLatency = MAXIMUM_FRAME_LATENCY;
+		}
+		if (mMaximumFrameLatency != maximumFrameLatency)
+		{
+			// The fences recorded so far belong to the old ring buffer size, start over
+			releaseFences();
+			mMaximumFrameLatency = maximumFrameLatency;
+		}
+	}
+
+	/**
+	*  @brief
+	*    Return the present statistics
+	*/
+	inline const PresentStatistics &FramePacer::getPresentStatistics() const
+	{
+		return mPresentStatistics;
+	}
+
+	/**
+	*  @brief
+	*    Call this method right before the native present
+	*/
+	inline void FramePacer::beginPresent()
+	{
+		mPresentStatistics.lastFrameLatencyWaitTime = 0.0f;
+
+		// Wait for the GPU to finish the frame presented "maximum frame latency" presents ago
+		// -> The fence to wait for is the one which is overwritten after the present
+		if (mMaximumFrameLatency > 0)
+		{
+			IFence *fence = mFences[mNextFence];
+			if (nullptr != fence)
+			{
+				const std::chrono::steady_clock::time_point waitStartTime = std::chrono::steady_clock::now();
+				mRenderer->waitFence(*fence);
+				mPresentStatistics.lastFrameLatencyWaitTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - waitStartTime).count();
+				fence->release();
+				mFences[mNextFence] = nullptr;
+			}
+		}
+	}
+
+	/**
+	*  @brief
+	*    Call this method right after the native present
+	*/
+	inline void FramePacer::endPresent()
+	{
+		// Insert a fence marking the end of the presented frame
+		if (mMaximumFrameLatency > 0)
+		{
+			IFence *fence = mRenderer->insertFence();
+			if (nullptr != fence)
+			{
+				fence->addReference();
+			}
+			if (nullptr != mFences[mNextFence])
+			{
+				mFences[mNextFence]->release();
+			}
+			mFences[mNextFence] = fence;
+			mNextFence = (mNextFence + 1) % mMaximumFrameLatency;
+		}
+
+		// Record the present interval
+		const std::chrono::steady_clock::time_point presentTime = std::chrono::steady_clock::now();
+		if (mPresentStatistics.numberOfPresents > 0)
+		{
+			const float presentInterval = std::chrono::duration<float, std::milli>(presentTime - mLastPresentTime).count();
+			mPresentStatistics.lastPresentInterval = presentInterval;
+			mPresentStatistics.presentIntervals[mPresentStatistics.nextPresentInterval] = presentInterval;
+			mPresentStatistics.nextPresentInterval = (mPresentStatistics.nextPresentInterval + 1) % PresentStatistics::NUMBER_OF_PRESENT_INTERVALS;
+			if (mPresentStatistics.numberOfPresentIntervals < PresentStatistics::NUMBER_OF_PRESENT_INTERVALS)
+			{
+				++mPresentStatistics.numberOfPresentIntervals;
+			}
+
+			// Update the average, minimum and maximum of the recorded present intervals
+			float sum = 0.0f;
+			float minimum = presentInterval;
+			float maximum = presentInterval;
+			for (unsigned int i = 0; i < mPresentStatistics.numberOfPresentIntervals; ++i)
+			{
+				const float currentPresentInterval = mPresentStatistics.presentIntervals[i];
+				sum += currentPresentInterval;
+				if (minimum > currentPresentInterval)
+				{
+					minimum = currentPresentInterval;
+				}
+				if (maximum < currentPresentInterval)
+				{
+					maximum = currentPresentInterval;
+				}
+			}
+			mPresentStatistics.averagePresentInterval = sum / mPresentStatistics.numberOfPresentIntervals;
+			mPresentStatistics.minimumPresentInterval = minimum;
+			mPresentStatistics.maximumPresentInterval = maximum;
+		}
+		mLastPresentTime = presentTime;
+		++mPresentStatistics.numberOfPresents;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Copy constructor
+	*/
+	inline FramePacer::FramePacer(const FramePacer &source) :
+		mRenderer(source.mRenderer),
+		mMaximumFrameLatency(0),
+		mNextFence(0)
+	{
+		// Not supported
+		memset(mFences, 0, sizeof(mFences));
+		memset(&mPresentStatistics, 0, sizeof(PresentStatistics));
+	}
+
+	/**
+	*  @brief
+	*    Copy operator
+	*/
+	inline FramePacer &FramePacer::operator =(const FramePacer &)
+	{
+		// Not supported
+		return *this;
+	}
+
+	/**
+	*  @brief
+	*    Release all fences
+	*/
+	inline void FramePacer::releaseFences()
+	{
+		for (unsigned int i = 0; i < MAXIMUM_FRAME_LATENCY; ++i)
+		{
+			if (nullptr != mFences[i])
+			{
+				mFences[i]->release();
+				mFences[i] = nullptr;
+			}
+		}
+		mNextFence = 0;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
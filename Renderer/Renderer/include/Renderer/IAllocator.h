@@ -0,0 +1,268 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERER_IALLOCATOR_H__
+#define __RENDERER_IALLOCATOR_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <stddef.h>	// For "size_t"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Definitions                                           ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Allocation tag, describes the lifetime and the owner of an allocation so an allocator is able to route it (e.g. short-lived data to a frame arena) and to gather per subsystem statistics
+	*
+	*  @note
+	*    - Not to be confused with "Renderer::ResourceMemoryTag" which is about the estimated GPU memory of the resources
+	*/
+	struct AllocationTag
+	{
+		enum Enum
+		{
+			RENDERER		= 0,	/**< Renderer instance data, lives as long as the renderer instance (e.g. trace buffer) */
+			RESOURCE		= 1,	/**< Resource data, lives as long as the owner resource (e.g. vertex array attributes, collection content) */
+			TEMPORARY		= 2,	/**< Short-lived data, released before the allocating call returns or at least within the current frame (e.g. shader information logs, texture conversion data) */
+			TOOLKIT			= 3,	/**< Renderer toolkit data, lives as long as the owner toolkit instance (e.g. font file data, mesh batch data) */
+			NUMBER_OF_TAGS	= 4		/**< Number of allocation tags */
+		};
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Abstract allocator interface, all renderer backends, resources and the renderer toolkit are using the allocator of the renderer instance
+	*
+	*  @note
+	*    - The allocator is passed at renderer creation, when no allocator is passed the malloc based "Renderer::DefaultAllocator" is used
+	*    - The allocator must be thread safe because e.g. the renderer toolkit is allocating from worker threads
+	*
+	*  @see
+	*    - "Renderer::IRenderer::getAllocator()"
+	*/
+	class IAllocator
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const unsigned int DEFAULT_ALIGNMENT = 16;	/**< Default alignment in bytes, sufficient for all basic types and SIMD data */
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Allocate memory which knows its allocator
+		*
+		*  @param[in] allocator
+		*    Allocator to allocate the memory with, must stay valid until the memory was deallocated
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate
+		*  @param[in] tag
+		*    Allocation tag
+		*
+		*  @return
+		*    The allocated uninitialized memory aligned to "DEFAULT_ALIGNMENT", null pointer on error, release the memory by using "deallocateWithHeader()"
+		*
+		*  @note
+		*    - The allocator and the tag are stored in a small header in front of the returned memory, this way class-level "operator delete()"
+		*      implementations are able to release instances without knowing the allocator (e.g. "delete this" inside "Renderer::RefCount::release()")
+		*/
+		static inline void *allocateWithHeader(IAllocator &allocator, size_t numberOfBytes, AllocationTag::Enum tag);
+
+		/**
+		*  @brief
+		*    Deallocate memory which was allocated by "allocateWithHeader()"
+		*
+		*  @param[in] memory
+		*    Memory to deallocate, can be a null pointer (nothing happens in this case)
+		*/
+		static inline void deallocateWithHeader(void *memory);
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline virtual ~IAllocator();
+
+		/**
+		*  @brief
+		*    Allocate an array of elements
+		*
+		*  @param[in] numberOfElements
+		*    Number of elements to allocate
+		*  @param[in] tag
+		*    Allocation tag, the same tag must be passed to "deallocateArray()"
+		*
+		*  @return
+		*    The uninitialized elements, null pointer on error or if "numberOfElements" is 0, release the memory by using "deallocateArray()"
+		*
+		*  @note
+		*    - Only for types without constructor and destructor, no constructors are called
+		*/
+		template <typename TYPE>
+		inline TYPE *allocateArray(unsigned int numberOfElements, AllocationTag::Enum tag);
+
+		/**
+		*  @brief
+		*    Deallocate an array of elements
+		*
+		*  @param[in] elements
+		*    Elements allocated by "allocateArray()", can be a null pointer (nothing happens in this case)
+		*  @param[in] tag
+		*    Allocation tag which was used to allocate the elements
+		*
+		*  @note
+		*    - No destructors are called
+		*/
+		template <typename TYPE>
+		inline void deallocateArray(TYPE *elements, AllocationTag::Enum tag);
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IAllocator methods           ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Allocate memory
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate
+		*  @param[in] alignment
+		*    Alignment of the memory in bytes, must be a power of two
+		*  @param[in] tag
+		*    Allocation tag, the same tag must be passed to "deallocate()"
+		*
+		*  @return
+		*    The allocated uninitialized memory, null pointer on error, release the memory by using "deallocate()"
+		*/
+		virtual void *allocate(unsigned int numberOfBytes, unsigned int alignment, AllocationTag::Enum tag) = 0;
+
+		/**
+		*  @brief
+		*    Deallocate memory
+		*
+		*  @param[in] memory
+		*    Memory allocated by "allocate()", can be a null pointer (nothing happens in this case)
+		*  @param[in] tag
+		*    Allocation tag which was used to allocate the memory
+		*/
+		virtual void deallocate(void *memory, AllocationTag::Enum tag) = 0;
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		inline IAllocator();
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		inline explicit IAllocator(const IAllocator &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		inline IAllocator &operator =(const IAllocator &source);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Header in front of memory allocated by "allocateWithHeader()"
+		*/
+		struct Header
+		{
+			IAllocator		   *allocator;	/**< Allocator the memory was allocated with, always valid */
+			AllocationTag::Enum	tag;		/**< Allocation tag the memory was allocated with */
+		};
+		static const size_t HEADER_SIZE = (sizeof(Header) + DEFAULT_ALIGNMENT - 1) & ~static_cast<size_t>(DEFAULT_ALIGNMENT - 1);	/**< Size of the header in bytes, keeps the memory behind the header aligned */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "Renderer/IAllocator.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERER_IALLOCATOR_H__
@@ -0,0 +1,135 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Allocate memory which knows its allocator
+	*/
+	inline void *IAllocator::allocateWithHeader(IAllocator &allocator, size_t numberOfBytes, AllocationTag::Enum tag)
+	{
+		Header *header = static_cast<Header*>(allocator.allocate(static_cast<unsigned int>(HEADER_SIZE + numberOfBytes), DEFAULT_ALIGNMENT, tag));
+		if (nullptr == header)
+		{
+			// Error!
+			return nullptr;
+		}
+		header->allocator = &allocator;
+		header->tag = tag;
+		return reinterpret_cast<unsigned char*>(header) + HEADER_SIZE;
+	}
+
+	/**
+	*  @brief
+	*    Deallocate memory which was allocated by "allocateWithHeader()"
+	*/
+	inline void IAllocator::deallocateWithHeader(void *memory)
+	{
+		if (nullptr != memory)
+		{
+			Header *header = reinterpret_cast<Header*>(static_cast<unsigned char*>(memory) - HEADER_SIZE);
+			header->allocator->deallocate(header, header->tag);
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline IAllocator::~IAllocator()
+	{
+		// Nothing to do in here
+	}
+
+	/**
+	*  @brief
+	*    Allocate an array of elements
+	*/
+	template <typename TYPE>
+	inline TYPE *IAllocator::allocateArray(unsigned int numberOfElements, AllocationTag::Enum tag)
+	{
+		return (numberOfElements > 0) ? static_cast<TYPE*>(allocate(static_cast<unsigned int>(sizeof(TYPE)) * numberOfElements, DEFAULT_ALIGNMENT, tag)) : nullptr;
+	}
+
+	/**
+	*  @brief
+	*    Deallocate an array of elements
+	*/
+	template <typename TYPE>
+	inline void IAllocator::deallocateArray(TYPE *elements, AllocationTag::Enum tag)
+	{
+		if (nullptr != elements)
+		{
+			deallocate(elements, tag);
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Default constructor
+	*/
+	inline IAllocator::IAllocator()
+	{
+		// Nothing to do in here
+	}
+
+	/**
+	*  @brief
+	*    Copy constructor
+	*/
+	inline IAllocator::IAllocator(const IAllocator &)
+	{
+		// Not supported
+	}
+
+	/**
+	*  @brief
+	*    Copy operator
+	*/
+	inline IAllocator &IAllocator::operator =(const IAllocator &)
+	{
+		// Not supported
+		return *this;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
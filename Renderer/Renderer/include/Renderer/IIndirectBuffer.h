@@ -0,0 +1,151 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERER_IINDIRECTBUFFER_H__
+#define __RENDERER_IINDIRECTBUFFER_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/IBuffer.h"
+#include "Renderer/IndirectBufferTypes.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Abstract indirect buffer object interface
+	*
+	*  @remarks
+	*    An indirect buffer holds a tightly packed array of "Renderer::DrawIndexedInstancedArguments" instances which are
+	*    consumed by "Renderer::IRenderer::multiDrawIndexedIndirect()". This way, thousands of draw calls can be issued
+	*    by using a single renderer API call.
+	*    OpenGL - http://www.opengl.org/wiki/Vertex_Rendering#Indirect_rendering
+	*      - Core in version:              4.3 ("GL_ARB_multi_draw_indirect")
+	*      - Adopted into core in version: 4.0 ("GL_ARB_draw_indirect")
+	*    Direct3D - "ID3D11DeviceContext::DrawIndexedInstancedIndirect()"-documentation - http://msdn.microsoft.com/en-us/library/windows/desktop/ff476410%28v=vs.85%29.aspx
+	*      - Direct3D version:              11
+	*    Renderer backends without native indirect draw support keep a copy of the draw arguments within system memory and emulate the multi-draw by using a loop
+	*/
+	class IIndirectBuffer : public IBuffer
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline virtual ~IIndirectBuffer();
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual IIndirectBuffer methods                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Copy data into the indirect buffer object
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to copy into the indirect buffer, must be valid and must not exceed the indirect buffer size
+		*  @param[in] data
+		*    Indirect buffer data ("Renderer::DrawIndexedInstancedArguments" instances), can be a null pointer (nothing happens)
+		*/
+		virtual void copyDataFrom(unsigned int numberOfBytes, const void *data) = 0;
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] renderer
+		*    Owner renderer instance
+		*/
+		inline explicit IIndirectBuffer(IRenderer &renderer);
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		inline explicit IIndirectBuffer(const IIndirectBuffer &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		inline IIndirectBuffer &operator =(const IIndirectBuffer &source);
+
+
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ Type definitions                                      ]
+	//[-------------------------------------------------------]
+	typedef SmartRefCount<IIndirectBuffer> IIndirectBufferPtr;
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "Renderer/IIndirectBuffer.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERER_IINDIRECTBUFFER_H__
@@ -95,6 +95,26 @@ namespace Renderer
 		*/
 		virtual IVertexArray *createVertexArray(unsigned int numberOfAttributes, const VertexArrayAttribute *attributes, IIndexBuffer *indexBuffer = nullptr) = 0;
 
+		/**
+		*  @brief
+		*    Set the varyings captured by stream output ("transform feedback" in OpenGL terminology)
+		*
+		*  @param[in] numberOfVaryings
+		*    Number of varyings to capture, zero to disable stream output for this program
+		*  @param[in] varyingNames
+		*    At least "numberOfVaryings" varying names (ASCII), the names are the vertex, tessellation evaluation or geometry shader output variable names, can be a null pointer in case there are zero varyings
+		*  @param[in] interleaved
+		*    "true" to write all varyings interleaved into the stream output target at slot 0, "false" to write each varying into its own stream output target (slot = varying index)
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (stream output not supported or the program could not be relinked)
+		*
+		*  @note
+		*    - Call this method directly after program creation, the program might get relinked which means that previously set uniform values and uniform block bindings are lost
+		*    - See "Renderer::IRenderer::soSetTargets()" and "Renderer::IRenderer::soBegin()" for how to capture the varyings
+		*/
+		inline virtual bool setStreamOutputVaryings(unsigned int numberOfVaryings, const char **varyingNames, bool interleaved = true);
+
 		// TODO(co) Cleanup
 		inline virtual int getAttributeLocation(const char *attributeName);
 		inline virtual unsigned int getUniformBlockIndex(const char *uniformBlockName, unsigned int defaultIndex);
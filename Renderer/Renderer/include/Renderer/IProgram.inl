@@ -52,6 +52,12 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Public virtual IProgram methods                       ]
 	//[-------------------------------------------------------]
+	inline bool IProgram::setStreamOutputVaryings(unsigned int, const char **, bool)
+	{
+		// Stream output is not supported by default
+		return false;
+	}
+
 	// TODO(co) Cleanup
 	inline int IProgram::getAttributeLocation(const char *) { return -1; };
 	inline unsigned int IProgram::getUniformBlockIndex(const char *, unsigned int defaultIndex) { return defaultIndex; };
@@ -30,6 +30,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Statistics.h"
+#include "Renderer/DefaultAllocator.h"
 #include "Renderer/BufferTypes.h"
 #include "Renderer/Capabilities.h"
 #include "Renderer/TextureTypes.h"
@@ -49,6 +50,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Forward declarations                                  ]
 	//[-------------------------------------------------------]
+	class IFence;
 	class ITexture;
 	class IProgram;
 	class IResource;
@@ -58,6 +60,7 @@ namespace Renderer
 	class IBlendState;
 	struct BlendState;
 	class IIndexBuffer;
+	class IComputeShader;
 	class IVertexArray;
 	class IFramebuffer;
 	class ISamplerState;
@@ -68,6 +71,7 @@ namespace Renderer
 	class ITextureBuffer;
 	class IShaderLanguage;
 	class ITexture2DArray;
+	class IIndirectBuffer;
 	class IRasterizerState;
 	struct RasterizerState;
 	struct ScissorRectangle;
@@ -92,6 +96,7 @@ namespace Renderer
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 		// Do not add this within the public "Renderer/Renderer.h"-header, it's for the internal implementation only
+		friend class IResource;
 		friend class IProgram;
 		friend class IVertexArray;
 		friend class ISwapChain;
@@ -99,6 +104,7 @@ namespace Renderer
 		friend class IIndexBuffer;
 		friend class IVertexBuffer;
 		friend class IUniformBuffer;
+		friend class IIndirectBuffer;
 		friend class ITextureBuffer;
 		friend class ITexture2D;
 		friend class ITexture2DArray;
@@ -111,8 +117,55 @@ namespace Renderer
 		friend class ITessellationEvaluationShader;
 		friend class IGeometryShader;
 		friend class IFragmentShader;
+		friend class IComputeShader;
 		friend class ITextureCollection;
 		friend class ISamplerStateCollection;
+		friend class IFence;
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Allocate the memory of a renderer instance by using an allocator
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate
+		*  @param[in] allocator
+		*    Allocator to allocate with, must stay valid as long as the renderer instance exists
+		*
+		*  @return
+		*    The allocated memory, null pointer on error (no constructor is called in this case)
+		*
+		*  @note
+		*    - Used by the renderer backend instance creation functions as "new (allocator) Renderer(...)", see "Renderer::IRenderer::IRenderer()" for the default allocator
+		*/
+		static inline void *operator new(size_t numberOfBytes, IAllocator &allocator) throw();
+
+		/**
+		*  @brief
+		*    Deallocate the memory of a renderer instance
+		*
+		*  @param[in] memory
+		*    Memory to deallocate, can be a null pointer
+		*
+		*  @note
+		*    - The memory is returned to the allocator it was allocated with
+		*/
+		static inline void operator delete(void *memory);
+
+		/**
+		*  @brief
+		*    Deallocate the memory of a renderer instance, only called by the compiler when the constructor failed
+		*
+		*  @param[in] memory
+		*    Memory to deallocate, can be a null pointer
+		*  @param[in] allocator
+		*    Allocator the memory was allocated with
+		*/
+		static inline void operator delete(void *memory, IAllocator &allocator);
 
 
 	//[-------------------------------------------------------]
@@ -150,6 +203,18 @@ namespace Renderer
 		*/
 		inline const Statistics &getStatistics() const;
 
+		/**
+		*  @brief
+		*    Return the allocator of the renderer instance
+		*
+		*  @return
+		*    The allocator of the renderer instance, used by the renderer backend, its resources and the renderer toolkit
+		*
+		*  @note
+		*    - Do not free the memory the returned reference is pointing to
+		*/
+		inline IAllocator &getAllocator() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual IRenderer methods                      ]
@@ -330,6 +395,25 @@ namespace Renderer
 		*/
 		virtual ITextureBuffer *createTextureBuffer(unsigned int numberOfBytes, TextureFormat::Enum textureFormat, const void *data = nullptr, BufferUsage::Enum bufferUsage = BufferUsage::DYNAMIC_DRAW) = 0;
 
+		/**
+		*  @brief
+		*    Create an indirect buffer object instance
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the indirect buffer, must be valid and should be a multiple of "sizeof(Renderer::DrawIndexedInstancedArguments)"
+		*  @param[in] data
+		*    Indirect buffer data ("Renderer::DrawIndexedInstancedArguments" instances), can be a null pointer (empty buffer), the data is internally copied and you have to free your memory if you no longer need it
+		*  @param[in] bufferUsage
+		*    Indication of the buffer usage
+		*
+		*  @return
+		*    The created indirect buffer instance, null pointer on error. Release the returned instance if you no longer need it.
+		*
+		*  @note
+		*    - Indirect buffers are always supported, renderer backends without native support emulate them within system memory
+		*/
+		virtual IIndirectBuffer *createIndirectBuffer(unsigned int numberOfBytes, const void *data = nullptr, BufferUsage::Enum bufferUsage = BufferUsage::DYNAMIC_DRAW) = 0;
+
 		/**
 		*  @brief
 		*    Create a 2D texture instance
@@ -346,14 +430,18 @@ namespace Renderer
 		*    Texture flags, see "Renderer::TextureFlag::Enum"
 		*  @param[in] textureUsage
 		*    Indication of the texture usage (only relevant for Direct3D, OpenGL has no texture usage indication)
+		*  @param[in] numberOfMultisamples
+		*    Number of multisamples per texel (1, 2, 4 or 8), must be <="Renderer::Capabilities::maximumNumberOfMultisamples", 1 for a regular texture
 		*
 		*  @return
 		*    The created 2D texture instance, null pointer on error. Release the returned instance if you no longer need it.
 		*
 		*  @note
 		*    - Only supported if "Renderer::Capabilities::maximumNumberOf2DTextureArraySlices" is not 0
+		*    - Multisampled textures are only supported as render targets ("Renderer::TextureFlag::RENDER_TARGET"), they have no
+		*      mipmaps and no initial data, use "Renderer::IRenderer::resolveMultisampleFramebuffer()" to get a regular texture
 		*/
-		virtual ITexture2D *createTexture2D(unsigned int width, unsigned int height, TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, TextureUsage::Enum textureUsage = TextureUsage::DEFAULT) = 0;
+		virtual ITexture2D *createTexture2D(unsigned int width, unsigned int height, TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, TextureUsage::Enum textureUsage = TextureUsage::DEFAULT, unsigned int numberOfMultisamples = 1) = 0;
 
 		/**
 		*  @brief
@@ -497,6 +585,47 @@ namespace Renderer
 		*/
 		virtual void unmap(IResource &resource, unsigned int subresource) = 0;
 
+		/**
+		*  @brief
+		*    Copy the content of a resource into another resource
+		*
+		*  @param[in] destinationResource
+		*    Destination resource, must be of the same type, size and format as the source resource, there's no internal resource validation, so, do only use valid resources in here!
+		*  @param[in] sourceResource
+		*    Source resource, there's no internal resource validation, so, do only use valid resources in here!
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (e.g. resource type not supported)
+		*
+		*  @note
+		*    - Supported resource types are 2D textures and index, vertex, uniform and indirect buffers
+		*    - The copy is executed asynchronously by the GPU, it's a building block for GPU to CPU readback without stalling the
+		*      pipeline: Copy into a 2D texture created with "Renderer::TextureUsage::STAGING" (or a buffer created with a
+		*      "*_READ"-buffer usage), insert a fence and map the destination resource as soon as the fence has been signaled
+		*/
+		virtual bool copyResource(IResource &destinationResource, IResource &sourceResource) = 0;
+
+		/**
+		*  @brief
+		*    Make the bindless handle of a texture resident or non-resident
+		*
+		*  @param[in] texture
+		*    Texture the bindless handle belongs to, there's no internal resource validation, so, do only use valid resources in here!
+		*  @param[in] samplerState
+		*    Sampler state the bindless handle was requested with, see "Renderer::ITexture::getBindlessHandle()", can be a null pointer
+		*  @param[in] resident
+		*    "true" to make the bindless handle resident, "false" to make it non-resident
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::bindlessTexture" is true, else nothing happens
+		*    - A bindless handle must be resident as long as shaders access the texture using it, keep the number of
+		*      resident textures at what's required by the upcoming draw calls to not waste video memory
+		*    - The residency is reference counted, each request to make a bindless handle resident must be balanced by
+		*      a request to make it non-resident
+		*    - When a texture is destroyed, its bindless handles are made non-resident automatically
+		*/
+		virtual void setTextureResident(ITexture &texture, ISamplerState *samplerState, bool resident) = 0;
+
 		//[-------------------------------------------------------]
 		//[ States                                                ]
 		//[-------------------------------------------------------]
@@ -784,6 +913,52 @@ namespace Renderer
 		*/
 		virtual void gsSetUniformBuffer(unsigned int slot, IUniformBuffer *uniformBuffer) = 0;
 
+		//[-------------------------------------------------------]
+		//[ Stream-output (SO) stage                              ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Set the stream output ("transform feedback" in OpenGL terminology) target vertex buffers
+		*
+		*  @param[in] numberOfTargets
+		*    Number of stream output targets, must be <="Renderer::Capabilities::maximumNumberOfStreamOutputTargets", 0 to unset all targets
+		*  @param[in] vertexBuffers
+		*    At least "numberOfTargets" vertex buffers receiving the captured varyings, can be a null pointer in case there are zero targets
+		*  @param[in] offsets
+		*    At least "numberOfTargets" offsets in bytes from the start of the vertex buffers, must be a multiple of four, can be a null pointer (all offsets are 0)
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::maximumNumberOfStreamOutputTargets" is not 0
+		*    - The captured varyings of the currently set program are defined by using "Renderer::IProgram::setStreamOutputVaryings()"
+		*    - The targets must not be changed between "Renderer::IRenderer::soBegin()" and "Renderer::IRenderer::soEnd()"
+		*/
+		virtual void soSetTargets(unsigned int numberOfTargets, IVertexBuffer **vertexBuffers, const unsigned int *offsets = nullptr) = 0;
+
+		/**
+		*  @brief
+		*    Begin capturing the varyings of the following draw calls into the set stream output targets
+		*
+		*  @param[in] primitiveTopology
+		*    Primitive topology written into the stream output targets, must be "Renderer::PrimitiveTopology::POINT_LIST", "Renderer::PrimitiveTopology::LINE_LIST" or
+		*    "Renderer::PrimitiveTopology::TRIANGLE_LIST" and must match the primitives reaching the stream output stage (strips are written as lists)
+		*  @param[in] rasterizerDiscard
+		*    "true" to discard the primitives after the stream output stage (nothing is rasterized, typical for e.g. skinning into a vertex buffer), else "false"
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::maximumNumberOfStreamOutputTargets" is not 0
+		*    - Each "Renderer::IRenderer::soBegin()" must be closed by a "Renderer::IRenderer::soEnd()", nesting is not allowed
+		*/
+		virtual void soBegin(PrimitiveTopology::Enum primitiveTopology, bool rasterizerDiscard = true) = 0;
+
+		/**
+		*  @brief
+		*    End capturing varyings into the set stream output targets
+		*
+		*  @see
+		*    - "Renderer::IRenderer::soBegin()"
+		*/
+		virtual void soEnd() = 0;
+
 		//[-------------------------------------------------------]
 		//[ Rasterizer (RS) stage                                 ]
 		//[-------------------------------------------------------]
@@ -926,6 +1101,85 @@ namespace Renderer
 		*/
 		virtual void omSetBlendState(IBlendState *blendState) = 0;
 
+		//[-------------------------------------------------------]
+		//[ Compute-shader (CS) stage                             ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Set the used compute shader texture resource at a certain texture unit
+		*
+		*  @param[in] unit
+		*    Texture unit
+		*  @param[in] texture
+		*    Texture to use, can be an null pointer (default: "nullptr")
+		*/
+		virtual void csSetTexture(unsigned int unit, ITexture *texture) = 0;
+
+		/**
+		*  @brief
+		*    Set the used compute shader texture resource at a certain texture unit by using a texture collection
+		*
+		*  @param[in] startUnit
+		*    Start texture unit, incremented automatically internally for every texture collection element
+		*  @param[in] textureCollection
+		*    Texture collection to use, can be an null pointer
+		*/
+		virtual void csSetTextureCollection(unsigned int startUnit, ITextureCollection *textureCollection) = 0;
+
+		/**
+		*  @brief
+		*    Set the used compute shader sampler state at a certain texture unit
+		*
+		*  @param[in] unit
+		*    Texture unit
+		*  @param[in] samplerState
+		*    Sampler state, can be a null pointer (default: "nullptr", see "Renderer::SamplerState" for the default values used in this case)
+		*/
+		virtual void csSetSamplerState(unsigned int unit, ISamplerState *samplerState) = 0;
+
+		/**
+		*  @brief
+		*    Set the used compute shader sampler state resource at a certain texture unit by using a sampler state collection
+		*
+		*  @param[in] startUnit
+		*    Start texture unit, incremented automatically internally for every sampler state collection element
+		*  @param[in] samplerStateCollection
+		*    Sampler state collection to use, can be an null pointer
+		*/
+		virtual void csSetSamplerStateCollection(unsigned int startUnit, ISamplerStateCollection *samplerStateCollection) = 0;
+
+		/**
+		*  @brief
+		*    Set the used compute shader uniform buffer object (UBO, "constant buffer" in Direct3D terminology) at a certain slot
+		*
+		*  @param[in] slot
+		*    Slot
+		*  @param[in] uniformBuffer
+		*    Uniform buffer, can be a null pointer (default: "nullptr")
+		*
+		*  @note
+		*    - Uniform buffer instances are created by using "Renderer::IShaderLanguage::createUniformBuffer()"
+		*    - Only supported if "Renderer::Capabilities::uniformBuffer" is true
+		*/
+		virtual void csSetUniformBuffer(unsigned int slot, IUniformBuffer *uniformBuffer) = 0;
+
+		/**
+		*  @brief
+		*    Set the used compute shader unordered access view (UAV, read/write resource) at a certain unit
+		*
+		*  @param[in] unit
+		*    Unordered access view unit
+		*  @param[in] resource
+		*    Resource to bind for unordered read/write access, can be a null pointer (default: "nullptr"), supported
+		*    are vertex, index, uniform, texture and indirect buffers as well as 2D textures
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::computeShader" is true
+		*    - Buffers are exposed as shader storage buffers, 2D textures as read/write images
+		*    - Use "Renderer::IRenderer::memoryBarrier()" before consuming the written data
+		*/
+		virtual void csSetUnorderedAccessView(unsigned int unit, IResource *resource) = 0;
+
 		//[-------------------------------------------------------]
 		//[ Operations                                            ]
 		//[-------------------------------------------------------]
@@ -976,6 +1230,23 @@ namespace Renderer
 		*/
 		virtual void endScene() = 0;
 
+		/**
+		*  @brief
+		*    Resolve a multisample framebuffer into a render target
+		*
+		*  @param[in] destinationRenderTarget
+		*    Render target receiving the resolved colors, usually a swap chain or a framebuffer with non-multisampled color textures
+		*  @param[in] sourceMultisampleFramebuffer
+		*    Framebuffer with multisampled color textures (see "Renderer::IRenderer::createTexture2D()") to resolve
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::maximumNumberOfMultisamples" is >1
+		*    - Source and destination must have the same dimension and color texture format
+		*    - In case the destination is a framebuffer, each source color texture is resolved into the destination color texture at the
+		*      same index, in case the destination is a swap chain the first source color texture is resolved into the back buffer
+		*/
+		virtual void resolveMultisampleFramebuffer(IRenderTarget &destinationRenderTarget, IFramebuffer &sourceMultisampleFramebuffer) = 0;
+
 		//[-------------------------------------------------------]
 		//[ Draw call                                             ]
 		//[-------------------------------------------------------]
@@ -1058,9 +1329,114 @@ namespace Renderer
 		*/
 		virtual void drawIndexedInstanced(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int minimumIndex, unsigned int numberOfVertices, unsigned int numberOfInstances) = 0;
 
+		/**
+		*  @brief
+		*    Render a number of indexed geometric primitive batches whose draw arguments are read from an indirect buffer
+		*
+		*  @param[in] indirectBuffer
+		*    Indirect buffer holding tightly packed "Renderer::DrawIndexedInstancedArguments" instances
+		*  @param[in] indirectBufferOffset
+		*    Offset in bytes to the first draw arguments inside the indirect buffer (usually 0), must be a multiple of four
+		*  @param[in] numberOfDraws
+		*    Number of draws, can be 0 (nothing happens)
+		*
+		*  @note
+		*    - This method draws indexed primitives from the current set of data input streams, the vertex array and primitive topology are shared by all draws
+		*    - Fails if no index and/or vertex array is set
+		*    - If "Renderer::Capabilities::multiDrawIndirect" is true the draws are issued by using a single renderer API call,
+		*      else the renderer emulates the multi-draw by using a loop
+		*    - "Renderer::DrawIndexedInstancedArguments::startInstanceLocation" is ignored when the multi-draw is emulated, use 0 for portable code
+		*/
+		virtual void multiDrawIndexedIndirect(IIndirectBuffer &indirectBuffer, unsigned int indirectBufferOffset = 0, unsigned int numberOfDraws = 1) = 0;
+
+		/**
+		*  @brief
+		*    Render the vertices written by the last stream output without knowing their number on the CPU side
+		*
+		*  @note
+		*    - This method draws non-indexed primitives from the current set of data input streams, the vertex array should read from the stream output target
+		*    - The number of vertices is the number of vertices written between the last "Renderer::IRenderer::soBegin()" and "Renderer::IRenderer::soEnd()"
+		*    - Only supported if "Renderer::Capabilities::maximumNumberOfStreamOutputTargets" is not 0
+		*    - A renderer backend might have to wait for the stream output to finish in order to get the number of written vertices
+		*/
+		virtual void drawAuto() = 0;
+
+		//[-------------------------------------------------------]
+		//[ Compute                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Execute the currently set compute program
+		*
+		*  @param[in] groupCountX
+		*    Number of thread groups dispatched in x direction
+		*  @param[in] groupCountY
+		*    Number of thread groups dispatched in y direction
+		*  @param[in] groupCountZ
+		*    Number of thread groups dispatched in z direction
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::computeShader" is true
+		*    - The program must have been created by using "Renderer::IShaderLanguage::createComputeProgram()"
+		*/
+		virtual void dispatch(unsigned int groupCountX, unsigned int groupCountY, unsigned int groupCountZ) = 0;
+
+		/**
+		*  @brief
+		*    Order memory transactions issued by previous dispatches against subsequent operations
+		*
+		*  @param[in] flags
+		*    Flags which indicate the kind of subsequent access which must see the written data, see "Renderer::MemoryBarrierFlag"
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::computeShader" is true, else nothing happens
+		*/
+		virtual void memoryBarrier(unsigned int flags) = 0;
+
 		//[-------------------------------------------------------]
 		//[ Synchronization                                       ]
 		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Insert a fence into the command stream (synchronization)
+		*
+		*  @return
+		*    The created fence instance, null pointer on error (e.g. no fence support). Release the returned instance if you no longer need it.
+		*
+		*  @note
+		*    - The fence becomes signaled as soon as all previously issued commands have been processed by the GPU
+		*/
+		virtual IFence *insertFence() = 0;
+
+		/**
+		*  @brief
+		*    Return whether or not a fence has been signaled (synchronization)
+		*
+		*  @param[in] fence
+		*    Fence to check, there's no internal resource validation, so, do only use valid resources in here!
+		*
+		*  @return
+		*    "true" if the fence has been signaled, else "false"
+		*
+		*  @note
+		*    - Does not block, use this to poll for e.g. asynchronous readback results one or two frames later
+		*/
+		virtual bool isFenceSignaled(IFence &fence) = 0;
+
+		/**
+		*  @brief
+		*    Wait until a fence has been signaled (synchronization)
+		*
+		*  @param[in] fence
+		*    Fence to wait for, there's no internal resource validation, so, do only use valid resources in here!
+		*  @param[in] timeout
+		*    Timeout in milliseconds, "~0u" for no timeout
+		*
+		*  @return
+		*    "true" if the fence has been signaled, "false" on timeout or error
+		*/
+		virtual bool waitFence(IFence &fence, unsigned int timeout = ~0u) = 0;
+
 		/**
 		*  @brief
 		*    Force the execution of render commands in finite time (synchronization)
@@ -1073,6 +1449,27 @@ namespace Renderer
 		*/
 		virtual void finish() = 0;
 
+		//[-------------------------------------------------------]
+		//[ Swap chain                                            ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Present the content of the current back buffers of multiple swap chains at once
+		*
+		*  @param[in] numberOfSwapChains
+		*    Number of swap chains to present
+		*  @param[in] swapChains
+		*    Swap chains to present, must hold "numberOfSwapChains" valid swap chains of this renderer (there's no internal null pointer test)
+		*
+		*  @remarks
+		*    Has the same effect as calling "Renderer::ISwapChain::present()" for each of the given swap chains in the given order,
+		*    but gives the renderer implementation the chance to batch the presents. When rendering into many native OS windows, first
+		*    render into all swap chains and then present all of them with a single call at the end of the frame. The OpenGL renderer
+		*    for example submits the commands of all windows at once and swaps the buffers without switching the window its single,
+		*    shared render context is currently bound to.
+		*/
+		virtual void presentSwapChains(unsigned int numberOfSwapChains, ISwapChain **swapChains) = 0;
+
 		//[-------------------------------------------------------]
 		//[ Debug                                                 ]
 		//[-------------------------------------------------------]
@@ -1149,9 +1546,12 @@ namespace Renderer
 	protected:
 		/**
 		*  @brief
-		*    Default constructor
+		*    Constructor
+		*
+		*  @param[in] allocator
+		*    Allocator to use, can be a null pointer ("Renderer::DefaultAllocator" is used in this case), must stay valid as long as the renderer instance exists
 		*/
-		inline IRenderer();
+		inline explicit IRenderer(IAllocator *allocator);
 
 		/**
 		*  @brief
@@ -1195,11 +1595,29 @@ namespace Renderer
 		Capabilities mCapabilities;	/**< Capabilities */
 
 
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Allocate the memory of a renderer instance from the global heap, not supported
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate
+		*
+		*  @return
+		*    Not implemented
+		*/
+		static void *operator new(size_t numberOfBytes);
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		Statistics mStatistics;	/**< Statistics */
+		Statistics  mStatistics;	/**< Statistics */
+		IAllocator *mAllocator;		/**< Allocator, always valid */
 
 
 	};
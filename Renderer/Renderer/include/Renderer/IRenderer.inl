@@ -25,6 +25,37 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Allocate the memory of a renderer instance by using an allocator
+	*/
+	inline void *IRenderer::operator new(size_t numberOfBytes, IAllocator &allocator) throw()
+	{
+		return IAllocator::allocateWithHeader(allocator, numberOfBytes, AllocationTag::RENDERER);
+	}
+
+	/**
+	*  @brief
+	*    Deallocate the memory of a renderer instance
+	*/
+	inline void IRenderer::operator delete(void *memory)
+	{
+		IAllocator::deallocateWithHeader(memory);
+	}
+
+	/**
+	*  @brief
+	*    Deallocate the memory of a renderer instance, only called by the compiler when the constructor failed
+	*/
+	inline void IRenderer::operator delete(void *memory, IAllocator &)
+	{
+		IAllocator::deallocateWithHeader(memory);
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -55,15 +86,25 @@ namespace Renderer
 		return mStatistics;
 	}
 
+	/**
+	*  @brief
+	*    Return the allocator of the renderer instance
+	*/
+	inline IAllocator &IRenderer::getAllocator() const
+	{
+		return *mAllocator;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
 	/**
 	*  @brief
-	*    Default constructor
+	*    Constructor
 	*/
-	inline IRenderer::IRenderer()
+	inline IRenderer::IRenderer(IAllocator *allocator) :
+		mAllocator((nullptr != allocator) ? allocator : &DefaultAllocator::getInstance())
 	{
 		// Nothing to do in here
 	}
@@ -72,7 +113,8 @@ namespace Renderer
 	*  @brief
 	*    Copy constructor
 	*/
-	inline IRenderer::IRenderer(const IRenderer &)
+	inline IRenderer::IRenderer(const IRenderer &source) :
+		mAllocator(source.mAllocator)
 	{
 		// Not supported
 	}
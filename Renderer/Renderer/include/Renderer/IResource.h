@@ -31,6 +31,7 @@
 //[-------------------------------------------------------]
 #include "Renderer/SmartRefCount.h"
 #include "Renderer/ResourceTypes.h"
+#include "Renderer/ResourcePool.h"
 
 
 //[-------------------------------------------------------]
@@ -57,6 +58,86 @@ namespace Renderer
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Allocate the memory of a resource instance by using an allocator
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate
+		*  @param[in] allocator
+		*    Allocator to allocate with, must stay valid as long as the resource instance exists
+		*
+		*  @return
+		*    The allocated memory, null pointer on error (no constructor is called in this case)
+		*
+		*  @note
+		*    - Used for resources without a resource pool as "new (renderer.getAllocator()) Resource(...)"
+		*/
+		static inline void *operator new(size_t numberOfBytes, IAllocator &allocator) throw();
+
+		/**
+		*  @brief
+		*    Allocate the memory of a resource instance from a resource pool
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate
+		*  @param[in] resourcePool
+		*    Resource pool to allocate from
+		*
+		*  @return
+		*    The allocated memory, null pointer on error (no constructor is called in this case)
+		*
+		*  @note
+		*    - Used by the renderer backends as "new (resourcePool) Resource(...)"
+		*/
+		static inline void *operator new(size_t numberOfBytes, ResourcePool &resourcePool) throw();
+
+		/**
+		*  @brief
+		*    Deallocate the memory of a resource instance
+		*
+		*  @param[in] memory
+		*    Memory to deallocate, can be a null pointer
+		*
+		*  @note
+		*    - The memory is returned to the resource pool or allocator it was allocated from, "Renderer::RefCount::release()" is not
+		*      required to know about resource pools and allocators
+		*/
+		static inline void operator delete(void *memory);
+
+		/**
+		*  @brief
+		*    Deallocate the memory of a resource instance which was allocated by using an allocator
+		*
+		*  @param[in] memory
+		*    Memory to deallocate, can be a null pointer
+		*  @param[in] allocator
+		*    Allocator the memory was allocated with
+		*
+		*  @note
+		*    - Only called by the compiler when the constructor of a resource instance allocated by using an allocator failed
+		*/
+		static inline void operator delete(void *memory, IAllocator &allocator);
+
+		/**
+		*  @brief
+		*    Deallocate the memory of a resource instance which was allocated from a resource pool
+		*
+		*  @param[in] memory
+		*    Memory to deallocate, can be a null pointer
+		*  @param[in] resourcePool
+		*    Resource pool the memory was allocated from
+		*
+		*  @note
+		*    - Only called by the compiler when the constructor of a resource instance allocated from a resource pool failed
+		*/
+		static inline void operator delete(void *memory, ResourcePool &resourcePool);
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -85,6 +166,21 @@ namespace Renderer
 		*/
 		inline IRenderer &getRenderer() const;
 
+		/**
+		*  @brief
+		*    Return the estimated number of bytes the resource occupies
+		*
+		*  @return
+		*    The estimated number of bytes the resource occupies, 0 for resources without noteworthy memory like states or shaders
+		*
+		*  @note
+		*    - An estimation by the renderer backend, e.g. driver padding and alignment are not taken into account
+		*
+		*  @see
+		*    - "Renderer::Statistics::currentNumberOfBytes"
+		*/
+		inline unsigned long long getNumberOfBytes() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual IResource methods                      ]
@@ -100,8 +196,13 @@ namespace Renderer
 		*  @param[in] name
 		*    ASCII name for debugging purposes, must be valid (there's no internal null pointer test)
 		*
+		*  @note
+		*    - The estimated memory of the resource is accounted to the debug name within the renderer statistics, renderer
+		*      backends overwriting this method must call this base implementation (only relevant for resources having memory)
+		*
 		*  @see
 		*    - "Renderer::IRenderer::isDebugEnabled()"
+		*    - "Renderer::Statistics::resourceMemoryTags"
 		*/
 		inline virtual void setDebugName(const char *name);
 
@@ -142,13 +243,48 @@ namespace Renderer
 		*/
 		inline IResource &operator =(const IResource &source);
 
+		/**
+		*  @brief
+		*    Set the estimated number of bytes the resource occupies
+		*
+		*  @param[in] numberOfBytes
+		*    Estimated number of bytes the resource occupies
+		*
+		*  @note
+		*    - Called by the renderer backends as soon as the size of the resource is known, usually inside the constructor
+		*    - Updates the memory statistics of the owner renderer
+		*/
+		inline void setNumberOfBytes(unsigned long long numberOfBytes);
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Allocate the memory of a resource instance from the global heap, not supported
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate
+		*
+		*  @return
+		*    Not implemented
+		*
+		*  @note
+		*    - Resource instances must either be allocated from a resource pool or by using an allocator
+		*/
+		static void *operator new(size_t numberOfBytes);
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		ResourceType::Enum  mResourceType;	/**< The resource type */
-		IRenderer		   *mRenderer;		/**< The owner renderer instance, always valid */
+		ResourceType::Enum  mResourceType;		/**< The resource type */
+		IRenderer		   *mRenderer;			/**< The owner renderer instance, always valid */
+		unsigned long long  mNumberOfBytes;		/**< Estimated number of bytes the resource occupies */
+		unsigned int		mResourceMemoryTag;	/**< Index of the resource memory tag within the renderer statistics the memory is accounted to, see "Renderer::Statistics::getResourceMemoryTag()" */
 
 
 	};
@@ -18,6 +18,14 @@
 \*********************************************************/
 
 
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#ifndef RENDERER_NO_STATISTICS
+	#include "Renderer/IRenderer.h"
+#endif
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -25,6 +33,55 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Allocate the memory of a resource instance by using an allocator
+	*/
+	inline void *IResource::operator new(size_t numberOfBytes, IAllocator &allocator) throw()
+	{
+		return ResourcePool::allocateUnpooled(allocator, numberOfBytes);
+	}
+
+	/**
+	*  @brief
+	*    Allocate the memory of a resource instance from a resource pool
+	*/
+	inline void *IResource::operator new(size_t numberOfBytes, ResourcePool &resourcePool) throw()
+	{
+		return resourcePool.allocate(numberOfBytes);
+	}
+
+	/**
+	*  @brief
+	*    Deallocate the memory of a resource instance
+	*/
+	inline void IResource::operator delete(void *memory)
+	{
+		ResourcePool::deallocate(memory);
+	}
+
+	/**
+	*  @brief
+	*    Deallocate the memory of a resource instance which was allocated by using an allocator
+	*/
+	inline void IResource::operator delete(void *memory, IAllocator &)
+	{
+		ResourcePool::deallocate(memory);
+	}
+
+	/**
+	*  @brief
+	*    Deallocate the memory of a resource instance which was allocated from a resource pool
+	*/
+	inline void IResource::operator delete(void *memory, ResourcePool &)
+	{
+		ResourcePool::deallocate(memory);
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -34,7 +91,13 @@ namespace Renderer
 	*/
 	inline IResource::~IResource()
 	{
-		// Nothing to do in here
+		#ifndef RENDERER_NO_STATISTICS
+			// Update the statistics
+			if (0 != mNumberOfBytes)
+			{
+				getRenderer().getStatistics().removeResourceMemory(mResourceType, mResourceMemoryTag, mNumberOfBytes);
+			}
+		#endif
 	}
 
 	/**
@@ -55,6 +118,15 @@ namespace Renderer
 		return *mRenderer;
 	}
 
+	/**
+	*  @brief
+	*    Return the estimated number of bytes the resource occupies
+	*/
+	inline unsigned long long IResource::getNumberOfBytes() const
+	{
+		return mNumberOfBytes;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual IResource methods                      ]
@@ -63,9 +135,23 @@ namespace Renderer
 	*  @brief
 	*    Assign a name to the resource for debugging purposes
 	*/
-	inline void IResource::setDebugName(const char *)
+	inline void IResource::setDebugName(const char *name)
 	{
-		// Nothing to do by default
+		#ifndef RENDERER_NO_STATISTICS
+			// Update the statistics: Move the memory of this resource over to the resource memory tag of the new debug name
+			// -> Resources without memory like states or shaders don't need a resource memory tag
+			if (0 != mNumberOfBytes)
+			{
+				Statistics &statistics = getRenderer().getStatistics();
+				const unsigned int resourceMemoryTag = statistics.getResourceMemoryTag(name);
+				if (mResourceMemoryTag != resourceMemoryTag)
+				{
+					statistics.removeResourceMemory(mResourceType, mResourceMemoryTag, mNumberOfBytes);
+					statistics.addResourceMemory(mResourceType, resourceMemoryTag, mNumberOfBytes);
+					mResourceMemoryTag = resourceMemoryTag;
+				}
+			}
+		#endif
 	}
 
 
@@ -78,7 +164,9 @@ namespace Renderer
 	*/
 	inline IResource::IResource(ResourceType::Enum resourceType, IRenderer &renderer) :
 		mResourceType(resourceType),
-		mRenderer(&renderer)
+		mRenderer(&renderer),
+		mNumberOfBytes(0),
+		mResourceMemoryTag(0)
 	{
 		// Nothing to do in here
 	}
@@ -89,7 +177,9 @@ namespace Renderer
 	*/
 	inline IResource::IResource(const IResource &source) :
 		mResourceType(source.getResourceType()),
-		mRenderer(&source.getRenderer())
+		mRenderer(&source.getRenderer()),
+		mNumberOfBytes(0),
+		mResourceMemoryTag(0)
 	{
 		// Not supported
 	}
@@ -104,6 +194,29 @@ namespace Renderer
 		return *this;
 	}
 
+	/**
+	*  @brief
+	*    Set the estimated number of bytes the resource occupies
+	*/
+	inline void IResource::setNumberOfBytes(unsigned long long numberOfBytes)
+	{
+		#ifndef RENDERER_NO_STATISTICS
+			// Update the statistics
+			Statistics &statistics = getRenderer().getStatistics();
+			if (0 != mNumberOfBytes)
+			{
+				statistics.removeResourceMemory(mResourceType, mResourceMemoryTag, mNumberOfBytes);
+			}
+			if (0 != numberOfBytes)
+			{
+				statistics.addResourceMemory(mResourceType, mResourceMemoryTag, numberOfBytes);
+			}
+		#endif
+
+		// Set the new number of bytes
+		mNumberOfBytes = numberOfBytes;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "Renderer/IAllocator.h"
 #include "Renderer/BufferTypes.h"
 #include "Renderer/SmartRefCount.h"
 #include "Renderer/GeometryShaderTypes.h"
@@ -49,6 +50,7 @@ namespace Renderer
 	class IRenderer;
 	class IVertexShader;
 	class IUniformBuffer;
+	class IComputeShader;
 	class IGeometryShader;
 	class IFragmentShader;
 	class ITessellationControlShader;
@@ -66,6 +68,51 @@ namespace Renderer
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Allocate the memory of a shader language instance by using an allocator
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate
+		*  @param[in] allocator
+		*    Allocator to allocate with, must stay valid as long as the shader language instance exists
+		*
+		*  @return
+		*    The allocated memory, null pointer on error (no constructor is called in this case)
+		*
+		*  @note
+		*    - Used by the renderer backends as "new (renderer.getAllocator()) ShaderLanguage(...)"
+		*/
+		static inline void *operator new(size_t numberOfBytes, IAllocator &allocator) throw();
+
+		/**
+		*  @brief
+		*    Deallocate the memory of a shader language instance
+		*
+		*  @param[in] memory
+		*    Memory to deallocate, can be a null pointer
+		*
+		*  @note
+		*    - The memory is returned to the allocator it was allocated with
+		*/
+		static inline void operator delete(void *memory);
+
+		/**
+		*  @brief
+		*    Deallocate the memory of a shader language instance, only called by the compiler when the constructor failed
+		*
+		*  @param[in] memory
+		*    Memory to deallocate, can be a null pointer
+		*  @param[in] allocator
+		*    Allocator the memory was allocated with
+		*/
+		static inline void operator delete(void *memory, IAllocator &allocator);
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -379,6 +426,50 @@ namespace Renderer
 		*/
 		virtual IProgram *createProgram(IVertexShader *vertexShader, ITessellationControlShader *tessellationControlShader, ITessellationEvaluationShader *tessellationEvaluationShader, IGeometryShader *geometryShader, IFragmentShader *fragmentShader) = 0;
 
+		/**
+		*  @brief
+		*    Create a compute shader and sets the shader source code
+		*
+		*  @param[in] sourceCode
+		*    Shader ASCII source code, if null pointer or empty string a null pointer will be returned
+		*  @param[in] profile
+		*    Shader ASCII profile to use, if null pointer or empty string, a default profile will be used which usually
+		*    tries to use the best available profile that runs on most hardware (Examples: "cs_5_0")
+		*  @param[in] arguments
+		*    Optional shader compiler ASCII arguments, can be a null pointer or empty string
+		*  @param[in] entry
+		*    ASCII entry point, if null pointer or empty string, "main" is used as default
+		*
+		*  @return
+		*    The created compute shader, a null pointer on error. Release the returned instance if you no longer need it.
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::computeShader" is "true"
+		*    - The data the given pointers are pointing to is internally copied and you have to free your memory if you no longer need it
+		*
+		*  @see
+		*    - "Renderer::IShaderLanguage::createVertexShader()" for more information
+		*/
+		virtual IComputeShader *createComputeShader(const char *sourceCode, const char *profile = nullptr, const char *arguments = nullptr, const char *entry = nullptr) = 0;
+
+		/**
+		*  @brief
+		*    Create a compute program and assigns a compute shader to it
+		*
+		*  @param[in] computeShader
+		*    Compute shader the program is using, must be valid, compute shader and program language must match!
+		*
+		*  @return
+		*    The created program, a null pointer on error. Release the returned instance if you no longer need it.
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::computeShader" is "true"
+		*    - A compute program can't be combined with the graphics pipeline shader stages, use "Renderer::IRenderer::dispatch()" to run it
+		*    - The program keeps a reference to the provided shader and releases it when no longer required,
+		*      so it's safe to directly hand over a fresh created resource without releasing it manually
+		*/
+		virtual IProgram *createComputeProgram(IComputeShader *computeShader) = 0;
+
 		/**
 		*  @brief
 		*    Create an uniform buffer object (UBO, "constant buffer" in Direct3D terminology) instance
@@ -434,6 +525,23 @@ namespace Renderer
 		inline IShaderLanguage &operator =(const IShaderLanguage &source);
 
 
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Allocate the memory of a shader language instance from the global heap, not supported
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate
+		*
+		*  @return
+		*    Not implemented
+		*/
+		static void *operator new(size_t numberOfBytes);
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
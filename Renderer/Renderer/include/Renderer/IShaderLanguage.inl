@@ -25,6 +25,37 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Allocate the memory of a shader language instance by using an allocator
+	*/
+	inline void *IShaderLanguage::operator new(size_t numberOfBytes, IAllocator &allocator) throw()
+	{
+		return IAllocator::allocateWithHeader(allocator, numberOfBytes, AllocationTag::RENDERER);
+	}
+
+	/**
+	*  @brief
+	*    Deallocate the memory of a shader language instance
+	*/
+	inline void IShaderLanguage::operator delete(void *memory)
+	{
+		IAllocator::deallocateWithHeader(memory);
+	}
+
+	/**
+	*  @brief
+	*    Deallocate the memory of a shader language instance, only called by the compiler when the constructor failed
+	*/
+	inline void IShaderLanguage::operator delete(void *memory, IAllocator &)
+	{
+		IAllocator::deallocateWithHeader(memory);
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -31,6 +31,7 @@
 //[-------------------------------------------------------]
 #include "Renderer/PlatformTypes.h"
 #include "Renderer/IRenderTarget.h"
+#include "Renderer/SwapChainTypes.h"
 
 
 //[-------------------------------------------------------]
@@ -108,6 +109,66 @@ namespace Renderer
 		*/
 		virtual void setFullscreenState(bool fullscreen) = 0;
 
+		/**
+		*  @brief
+		*    Return the swap interval
+		*
+		*  @return
+		*    The swap interval, see "setSwapInterval()"
+		*/
+		virtual int getSwapInterval() const = 0;
+
+		/**
+		*  @brief
+		*    Set the swap interval (vertical synchronization)
+		*
+		*  @param[in] swapInterval
+		*    Number of vertical blanks to wait for before the back buffer is presented, 0 to present at once (no vertical synchronization).
+		*    A negative value stands for adaptive vertical synchronization: Wait for the absolute number of vertical blanks, but present
+		*    at once (with tearing) in case the frame missed the vertical blank.
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (swap interval not supported, the previous swap interval stays active)
+		*
+		*  @note
+		*    - Adaptive vertical synchronization falls back to regular vertical synchronization in case it's not supported
+		*    - The default swap interval is defined by the renderer backend and the driver settings
+		*/
+		virtual bool setSwapInterval(int swapInterval) = 0;
+
+		/**
+		*  @brief
+		*    Return the maximum frame latency
+		*
+		*  @return
+		*    The maximum number of presents the CPU is allowed to run ahead of the GPU, 0 if the driver decides (default)
+		*/
+		virtual unsigned int getMaximumFrameLatency() const = 0;
+
+		/**
+		*  @brief
+		*    Set the maximum frame latency
+		*
+		*  @param[in] maximumFrameLatency
+		*    The maximum number of presents the CPU is allowed to run ahead of the GPU, 0 if the driver decides. Usually the driver
+		*    queues up to three or four frames, a lower frame latency reduces the input latency but gives the CPU and the GPU less
+		*    room to work in parallel.
+		*
+		*  @note
+		*    - "present()" blocks until the GPU has finished the frame presented "maximumFrameLatency" presents ago
+		*    - Enforced by using fences, so without fence support (see "Renderer::IRenderer::insertFence()") the driver decides
+		*/
+		virtual void setMaximumFrameLatency(unsigned int maximumFrameLatency) = 0;
+
+		/**
+		*  @brief
+		*    Return the present statistics
+		*
+		*  @return
+		*    The present statistics, e.g. the present-to-present intervals
+		*/
+		virtual const PresentStatistics &getPresentStatistics() const = 0;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -39,6 +39,12 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Forward declarations                                  ]
+	//[-------------------------------------------------------]
+	class ISamplerState;
+
+
 	//[-------------------------------------------------------]
 	//[ Classes                                               ]
 	//[-------------------------------------------------------]
@@ -71,6 +77,31 @@ namespace Renderer
 		*/
 		static inline unsigned int getNumberOfMipmaps(unsigned int width, unsigned int height);
 
+		/**
+		*  @brief
+		*    Calculate the estimated number of bytes of a texture
+		*
+		*  @param[in] width
+		*    Texture width
+		*  @param[in] height
+		*    Texture height
+		*  @param[in] numberOfSlices
+		*    Number of slices, 1 for a 2D texture
+		*  @param[in] numberOfBytesPerTexel
+		*    Number of bytes per texel
+		*  @param[in] mipmaps
+		*    Does the texture have a complete mipmap chain?
+		*  @param[in] numberOfMultisamples
+		*    Number of multisamples per texel, 1 if multisampling is not used
+		*
+		*  @return
+		*    Estimated number of bytes of the texture, see "Renderer::IResource::getNumberOfBytes()"
+		*
+		*  @note
+		*    - Do not add this within the public "Renderer/Renderer.h"-header, it's for the internal implementation only
+		*/
+		static inline unsigned long long calculateNumberOfBytes(unsigned int width, unsigned int height, unsigned int numberOfSlices, unsigned int numberOfBytesPerTexel, bool mipmaps, unsigned int numberOfMultisamples);
+
 
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
@@ -83,6 +114,31 @@ namespace Renderer
 		inline virtual ~ITexture();
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual ITexture methods                       ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return the bindless handle of the texture
+		*
+		*  @param[in] samplerState
+		*    Sampler state to sample the texture with, if null pointer the texture is sampled using its default sampling state
+		*
+		*  @return
+		*    64 bit bindless handle of the texture, can be written into e.g. a uniform buffer or texture buffer and used by
+		*    shaders to access the texture without binding it to a texture unit, 0 if bindless textures are not supported
+		*
+		*  @note
+		*    - Only supported if "Renderer::Capabilities::bindlessTexture" is true and only by 2D textures and 2D texture arrays
+		*    - Before a shader is allowed to access the texture using the handle, the handle must be made resident by using
+		*      "Renderer::IRenderer::setTextureResident()"
+		*    - Calling this method again with the same sampler state returns the same handle
+		*    - The default implementation returns 0
+		*/
+		inline virtual unsigned long long getBindlessHandle(ISamplerState *samplerState);
+
+
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
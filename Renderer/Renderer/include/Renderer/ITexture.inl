@@ -48,6 +48,31 @@ namespace Renderer
 		#undef MAX
 	}
 
+	/**
+	*  @brief
+	*    Calculate the estimated number of bytes of a texture
+	*/
+	inline unsigned long long ITexture::calculateNumberOfBytes(unsigned int width, unsigned int height, unsigned int numberOfSlices, unsigned int numberOfBytesPerTexel, bool mipmaps, unsigned int numberOfMultisamples)
+	{
+		// Top level mipmap
+		unsigned long long numberOfBytes = static_cast<unsigned long long>(width) * height * numberOfBytesPerTexel * numberOfMultisamples;
+
+		// Add the lower mipmaps, see "getNumberOfMipmaps()"
+		if (mipmaps)
+		{
+			const unsigned int numberOfMipmaps = getNumberOfMipmaps(width, height);
+			for (unsigned int mipmap = 1; mipmap < numberOfMipmaps; ++mipmap)
+			{
+				width  = (width  > 1) ? (width  / 2) : 1;
+				height = (height > 1) ? (height / 2) : 1;
+				numberOfBytes += static_cast<unsigned long long>(width) * height * numberOfBytesPerTexel * numberOfMultisamples;
+			}
+		}
+
+		// Done
+		return numberOfBytes * numberOfSlices;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
@@ -62,6 +87,20 @@ namespace Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual ITexture methods                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Return the bindless handle of the texture
+	*/
+	inline unsigned long long ITexture::getBindlessHandle(ISamplerState *)
+	{
+		// Bindless textures are not supported by default
+		return 0;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
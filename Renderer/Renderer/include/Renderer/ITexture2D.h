@@ -79,6 +79,35 @@ namespace Renderer
 		inline unsigned int getHeight() const;
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual ITexture2D methods                     ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Update a rectangular region of a mipmap of the 2D texture
+		*
+		*  @param[in] mipmap
+		*    Mipmap to update, 0 = base map
+		*  @param[in] x
+		*    X texel position of the upper left corner of the region to update
+		*  @param[in] y
+		*    Y texel position of the upper left corner of the region to update
+		*  @param[in] width
+		*    Width of the region to update, must be valid
+		*  @param[in] height
+		*    Height of the region to update, must be valid
+		*  @param[in] data
+		*    Tightly packed texel data of the region in the format of the texture, can be a null pointer (nothing happens)
+		*
+		*  @note
+		*    - The given data is copied before this method returns, the caller is free to reuse the memory at once
+		*    - If supported by the renderer implementation, the data is copied into upload memory and the
+		*      GPU transfers it asynchronously (e.g. OpenGL pixel buffer objects) so the render thread is not stalled
+		*/
+		virtual void updateRegion(unsigned int mipmap, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data) = 0;
+
+
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
@@ -0,0 +1,66 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERER_INDIRECTBUFFER_TYPES_H__
+#define __RENDERER_INDIRECTBUFFER_TYPES_H__
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Definitions                                           ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Draw indexed instanced arguments as stored inside an indirect buffer
+	*
+	*  @note
+	*    - The memory layout is identical to the OpenGL "DrawElementsIndirectCommand"-structure and to the arguments
+	*      of the Direct3D 11 "ID3D11DeviceContext::DrawIndexedInstancedIndirect()"-method, do not change it
+	*/
+	struct DrawIndexedInstancedArguments
+	{
+		unsigned int indexCountPerInstance;	/**< Number of indices to draw per instance */
+		unsigned int instanceCount;			/**< Number of instances to draw */
+		unsigned int startIndexLocation;	/**< First index location */
+		unsigned int baseVertexLocation;	/**< Value added to each index before reading a vertex from the vertex buffer */
+		unsigned int startInstanceLocation;	/**< Value added to each index before reading per-instance data from a vertex buffer */
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERER_INDIRECTBUFFER_TYPES_H__
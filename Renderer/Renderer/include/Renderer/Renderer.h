@@ -51,6 +51,7 @@ namespace Renderer
 			class IIndexBuffer;
 			class IVertexBuffer;
 			class IUniformBuffer;
+			class IIndirectBuffer;
 		class ITexture;
 			class ITexture2D;
 			class ITextureBuffer;
@@ -65,10 +66,12 @@ namespace Renderer
 			class ITessellationControlShader;
 			class ITessellationEvaluationShader;
 			class IGeometryShader;
+			class IComputeShader;
 			class IFragmentShader;
 		class ICollection;
 			class ITextureCollection;
 			class ISamplerStateCollection;
+		class IFence;
 
 
 	//[-------------------------------------------------------]
@@ -174,6 +177,21 @@ namespace Renderer
 				COLOR_DEPTH = COLOR | DEPTH
 			};
 		};
+		struct MemoryBarrierFlag
+		{
+			enum Enum
+			{
+				VERTEX_ARRAY        = 0x00000001,
+				INDEX_BUFFER        = 0x00000002,
+				UNIFORM_BUFFER      = 0x00000004,
+				TEXTURE_FETCH       = 0x00000008,
+				SHADER_IMAGE_ACCESS = 0x00000020,
+				COMMAND             = 0x00000040,
+				BUFFER_UPDATE       = 0x00000200,
+				SHADER_STORAGE      = 0x00002000,
+				ALL                 = 0xffffffff
+			};
+		};
 		struct PrimitiveTopology
 		{
 			enum Enum
@@ -281,20 +299,23 @@ namespace Renderer
 				INDEX_BUFFER				   = 4,
 				VERTEX_BUFFER				   = 5,
 				UNIFORM_BUFFER				   = 6,
-				TEXTURE_BUFFER				   = 7,
-				TEXTURE_2D					   = 8,
-				TEXTURE_2D_ARRAY			   = 9,
-				RASTERIZER_STATE			   = 10,
-				DEPTH_STENCIL_STATE			   = 11,
-				BLEND_STATE					   = 12,
-				SAMPLER_STATE				   = 13,
-				VERTEX_SHADER				   = 14,
-				TESSELLATION_CONTROL_SHADER	   = 15,
-				TESSELLATION_EVALUATION_SHADER = 16,
-				GEOMETRY_SHADER				   = 17,
-				FRAGMENT_SHADER				   = 18,
-				TEXTURE_COLLECTION			   = 19,
-				SAMPLER_STATE_COLLECTION	   = 20
+				INDIRECT_BUFFER				   = 7,
+				TEXTURE_BUFFER				   = 8,
+				TEXTURE_2D					   = 9,
+				TEXTURE_2D_ARRAY			   = 10,
+				RASTERIZER_STATE			   = 11,
+				DEPTH_STENCIL_STATE			   = 12,
+				BLEND_STATE					   = 13,
+				SAMPLER_STATE				   = 14,
+				VERTEX_SHADER				   = 15,
+				TESSELLATION_CONTROL_SHADER	   = 16,
+				TESSELLATION_EVALUATION_SHADER = 17,
+				GEOMETRY_SHADER				   = 18,
+				FRAGMENT_SHADER				   = 19,
+				COMPUTE_SHADER				   = 20,
+				TEXTURE_COLLECTION			   = 21,
+				SAMPLER_STATE_COLLECTION	   = 22,
+				FENCE						   = 23
 			};
 		};
 	#endif
@@ -419,7 +440,9 @@ namespace Renderer
 				FLOAT_1 = 0,
 				FLOAT_2 = 1,
 				FLOAT_3 = 2,
-				FLOAT_4 = 3
+				FLOAT_4 = 3,
+				HALF_2  = 4,
+				HALF_4  = 5
 			};
 		};
 		struct VertexArrayAttribute
@@ -449,6 +472,37 @@ namespace Renderer
 		};
 	#endif
 
+	// Renderer/IndirectBufferTypes.h
+	#ifndef __RENDERER_INDIRECTBUFFER_TYPES_H__
+	#define __RENDERER_INDIRECTBUFFER_TYPES_H__
+		struct DrawIndexedInstancedArguments
+		{
+			unsigned int indexCountPerInstance;
+			unsigned int instanceCount;
+			unsigned int startIndexLocation;
+			unsigned int baseVertexLocation;
+			unsigned int startInstanceLocation;
+		};
+	#endif
+
+	// Renderer/SwapChainTypes.h
+	#ifndef __RENDERER_SWAPCHAIN_TYPES_H__
+	#define __RENDERER_SWAPCHAIN_TYPES_H__
+		struct PresentStatistics
+		{
+			static const unsigned int NUMBER_OF_PRESENT_INTERVALS = 128;
+			unsigned int numberOfPresents;
+			float		 lastPresentInterval;
+			float		 averagePresentInterval;
+			float		 minimumPresentInterval;
+			float		 maximumPresentInterval;
+			float		 lastFrameLatencyWaitTime;
+			unsigned int numberOfPresentIntervals;
+			unsigned int nextPresentInterval;
+			float		 presentIntervals[NUMBER_OF_PRESENT_INTERVALS];
+		};
+	#endif
+
 	// Renderer/SamplerStateTypes.h
 	#ifndef __RENDERER_SAMPLERSTATE_TYPES_H__
 	#define __RENDERER_SAMPLERSTATE_TYPES_H__
@@ -756,6 +810,289 @@ namespace Renderer
 	#endif
 
 
+	//[-------------------------------------------------------]
+	//[ Allocator                                             ]
+	//[-------------------------------------------------------]
+	// Renderer/IAllocator.h
+	#ifndef __RENDERER_IALLOCATOR_H__
+	#define __RENDERER_IALLOCATOR_H__
+		typedef decltype(sizeof(0)) size_t;
+		struct AllocationTag
+		{
+			enum Enum
+			{
+				RENDERER		= 0,
+				RESOURCE		= 1,
+				TEMPORARY		= 2,
+				TOOLKIT			= 3,
+				NUMBER_OF_TAGS	= 4
+			};
+		};
+		class IAllocator
+		{
+		public:
+			static const unsigned int DEFAULT_ALIGNMENT = 16;
+		public:
+			static void *allocateWithHeader(IAllocator &allocator, size_t numberOfBytes, AllocationTag::Enum tag)
+			{
+				Header *header = static_cast<Header*>(allocator.allocate(static_cast<unsigned int>(HEADER_SIZE + numberOfBytes), DEFAULT_ALIGNMENT, tag));
+				if (nullptr == header)
+				{
+					return nullptr;
+				}
+				header->allocator = &allocator;
+				header->tag = tag;
+				return reinterpret_cast<unsigned char*>(header) + HEADER_SIZE;
+			}
+			static void deallocateWithHeader(void *memory)
+			{
+				if (nullptr != memory)
+				{
+					Header *header = reinterpret_cast<Header*>(static_cast<unsigned char*>(memory) - HEADER_SIZE);
+					header->allocator->deallocate(header, header->tag);
+				}
+			}
+		public:
+			virtual ~IAllocator()
+			{
+			}
+			template <typename TYPE>
+			TYPE *allocateArray(unsigned int numberOfElements, AllocationTag::Enum tag)
+			{
+				return (numberOfElements > 0) ? static_cast<TYPE*>(allocate(static_cast<unsigned int>(sizeof(TYPE)) * numberOfElements, DEFAULT_ALIGNMENT, tag)) : nullptr;
+			}
+			template <typename TYPE>
+			void deallocateArray(TYPE *elements, AllocationTag::Enum tag)
+			{
+				if (nullptr != elements)
+				{
+					deallocate(elements, tag);
+				}
+			}
+		public:
+			virtual void *allocate(unsigned int numberOfBytes, unsigned int alignment, AllocationTag::Enum tag) = 0;
+			virtual void deallocate(void *memory, AllocationTag::Enum tag) = 0;
+		protected:
+			IAllocator()
+			{
+			}
+			explicit IAllocator(const IAllocator &source);
+			IAllocator &operator =(const IAllocator &source);
+		private:
+			struct Header
+			{
+				IAllocator		   *allocator;
+				AllocationTag::Enum tag;
+			};
+			static const size_t HEADER_SIZE = (sizeof(Header) + DEFAULT_ALIGNMENT - 1) & ~static_cast<size_t>(DEFAULT_ALIGNMENT - 1);
+		};
+	#endif
+
+	// Renderer/AllocatorObject.h
+	#ifndef __RENDERER_ALLOCATOROBJECT_H__
+	#define __RENDERER_ALLOCATOROBJECT_H__
+		template <AllocationTag::Enum TAG>
+		class AllocatorObject
+		{
+		public:
+			static void *operator new(size_t numberOfBytes, IAllocator &allocator) throw()
+			{
+				return IAllocator::allocateWithHeader(allocator, numberOfBytes, TAG);
+			}
+			static void operator delete(void *memory)
+			{
+				IAllocator::deallocateWithHeader(memory);
+			}
+			static void operator delete(void *memory, IAllocator &)
+			{
+				IAllocator::deallocateWithHeader(memory);
+			}
+		protected:
+			AllocatorObject()
+			{
+			}
+			~AllocatorObject()
+			{
+			}
+		private:
+			static void *operator new(size_t numberOfBytes);
+		};
+	#endif
+
+	// Renderer/ResourcePool.h
+	#ifndef __RENDERER_RESOURCEPOOL_H__
+	#define __RENDERER_RESOURCEPOOL_H__
+		class ResourcePool
+		{
+		public:
+			static const unsigned int DEFAULT_NUMBER_OF_SLOTS_PER_SLAB = 64;
+		public:
+			static void *allocateUnpooled(IAllocator &allocator, size_t numberOfBytes)
+			{
+				SlotHeader *slotHeader = static_cast<SlotHeader*>(allocator.allocate(static_cast<unsigned int>(SLOT_HEADER_SIZE + numberOfBytes), IAllocator::DEFAULT_ALIGNMENT, AllocationTag::RESOURCE));
+				if (nullptr == slotHeader)
+				{
+					return nullptr;
+				}
+				slotHeader->slab = nullptr;
+				slotHeader->allocator = &allocator;
+				return reinterpret_cast<unsigned char*>(slotHeader) + SLOT_HEADER_SIZE;
+			}
+			static void deallocate(void *memory)
+			{
+				if (nullptr != memory)
+				{
+					SlotHeader *slotHeader = reinterpret_cast<SlotHeader*>(static_cast<unsigned char*>(memory) - SLOT_HEADER_SIZE);
+					Slab *slab = slotHeader->slab;
+					if (nullptr == slab)
+					{
+						slotHeader->allocator->deallocate(slotHeader, AllocationTag::RESOURCE);
+					}
+					else
+					{
+						--slab->numberOfUsedSlots;
+						ResourcePool *resourcePool = slab->resourcePool;
+						if (nullptr != resourcePool)
+						{
+							slotHeader->nextFreeSlot = resourcePool->mFirstFreeSlot;
+							resourcePool->mFirstFreeSlot = slotHeader;
+							--resourcePool->mNumberOfUsedSlots;
+						}
+						else if (0 == slab->numberOfUsedSlots)
+						{
+							slab->allocator->deallocate(slab, AllocationTag::RESOURCE);
+						}
+					}
+				}
+			}
+			template <typename TYPE0, typename TYPE1>
+			static size_t getMaximumNumberOfBytes()
+			{
+				return (sizeof(TYPE0) > sizeof(TYPE1)) ? sizeof(TYPE0) : sizeof(TYPE1);
+			}
+			template <typename TYPE0, typename TYPE1, typename TYPE2>
+			static size_t getMaximumNumberOfBytes()
+			{
+				const size_t numberOfBytes = getMaximumNumberOfBytes<TYPE0, TYPE1>();
+				return (numberOfBytes > sizeof(TYPE2)) ? numberOfBytes : sizeof(TYPE2);
+			}
+		public:
+			ResourcePool(IAllocator &allocator, size_t numberOfBytesPerSlot, unsigned int numberOfSlotsPerSlab = DEFAULT_NUMBER_OF_SLOTS_PER_SLAB) :
+				mAllocator(&allocator),
+				mNumberOfBytesPerSlot(numberOfBytesPerSlot),
+				mSlotStride((SLOT_HEADER_SIZE + numberOfBytesPerSlot + IAllocator::DEFAULT_ALIGNMENT - 1) & ~static_cast<size_t>(IAllocator::DEFAULT_ALIGNMENT - 1)),
+				mNumberOfSlotsPerSlab((numberOfSlotsPerSlab > 0) ? numberOfSlotsPerSlab : 1),
+				mNumberOfSlabs(0),
+				mNumberOfUsedSlots(0),
+				mFirstSlab(nullptr),
+				mFirstFreeSlot(nullptr)
+			{
+			}
+			~ResourcePool()
+			{
+				Slab *slab = mFirstSlab;
+				while (nullptr != slab)
+				{
+					Slab *nextSlab = slab->nextSlab;
+					if (0 == slab->numberOfUsedSlots)
+					{
+						mAllocator->deallocate(slab, AllocationTag::RESOURCE);
+					}
+					else
+					{
+						slab->resourcePool = nullptr;
+					}
+					slab = nextSlab;
+				}
+			}
+			inline size_t getNumberOfBytesPerSlot() const
+			{
+				return mNumberOfBytesPerSlot;
+			}
+			inline unsigned int getNumberOfSlabs() const
+			{
+				return mNumberOfSlabs;
+			}
+			inline unsigned int getNumberOfUsedSlots() const
+			{
+				return mNumberOfUsedSlots;
+			}
+			void *allocate(size_t numberOfBytes)
+			{
+				if (numberOfBytes > mNumberOfBytesPerSlot)
+				{
+					return allocateUnpooled(*mAllocator, numberOfBytes);
+				}
+				if (nullptr == mFirstFreeSlot && !addSlab())
+				{
+					return nullptr;
+				}
+				SlotHeader *slotHeader = mFirstFreeSlot;
+				mFirstFreeSlot = slotHeader->nextFreeSlot;
+				slotHeader->nextFreeSlot = nullptr;
+				++slotHeader->slab->numberOfUsedSlots;
+				++mNumberOfUsedSlots;
+				return reinterpret_cast<unsigned char*>(slotHeader) + SLOT_HEADER_SIZE;
+			}
+		private:
+			struct Slab;
+			struct SlotHeader
+			{
+				Slab *slab;
+				union
+				{
+					SlotHeader *nextFreeSlot;
+					IAllocator *allocator;
+				};
+			};
+			struct Slab
+			{
+				Slab		 *nextSlab;
+				ResourcePool *resourcePool;
+				IAllocator	 *allocator;
+				unsigned int  numberOfUsedSlots;
+			};
+			static const size_t SLOT_HEADER_SIZE = (sizeof(SlotHeader) + IAllocator::DEFAULT_ALIGNMENT - 1) & ~static_cast<size_t>(IAllocator::DEFAULT_ALIGNMENT - 1);
+			static const size_t SLAB_HEADER_SIZE = (sizeof(Slab) + IAllocator::DEFAULT_ALIGNMENT - 1) & ~static_cast<size_t>(IAllocator::DEFAULT_ALIGNMENT - 1);
+		private:
+			bool addSlab()
+			{
+				Slab *slab = static_cast<Slab*>(mAllocator->allocate(static_cast<unsigned int>(SLAB_HEADER_SIZE + mSlotStride * mNumberOfSlotsPerSlab), IAllocator::DEFAULT_ALIGNMENT, AllocationTag::RESOURCE));
+				if (nullptr == slab)
+				{
+					return false;
+				}
+				slab->nextSlab = mFirstSlab;
+				slab->resourcePool = this;
+				slab->allocator = mAllocator;
+				slab->numberOfUsedSlots = 0;
+				mFirstSlab = slab;
+				++mNumberOfSlabs;
+				unsigned char *slots = reinterpret_cast<unsigned char*>(slab) + SLAB_HEADER_SIZE;
+				for (unsigned int i = mNumberOfSlotsPerSlab; i > 0; --i)
+				{
+					SlotHeader *slotHeader = reinterpret_cast<SlotHeader*>(slots + mSlotStride * (i - 1));
+					slotHeader->slab = slab;
+					slotHeader->nextFreeSlot = mFirstFreeSlot;
+					mFirstFreeSlot = slotHeader;
+				}
+				return true;
+			}
+			explicit ResourcePool(const ResourcePool &source);
+			ResourcePool &operator =(const ResourcePool &source);
+		private:
+			IAllocator	 *mAllocator;
+			size_t		  mNumberOfBytesPerSlot;
+			size_t		  mSlotStride;
+			unsigned int  mNumberOfSlotsPerSlab;
+			unsigned int  mNumberOfSlabs;
+			unsigned int  mNumberOfUsedSlots;
+			Slab		 *mFirstSlab;
+			SlotHeader	 *mFirstFreeSlot;
+		};
+	#endif
+
+
 	//[-------------------------------------------------------]
 	//[ Classes                                               ]
 	//[-------------------------------------------------------]
@@ -769,31 +1106,40 @@ namespace Renderer
 			unsigned int maximumNumberOfSimultaneousRenderTargets;
 			unsigned int maximumTextureDimension;
 			unsigned int maximumNumberOf2DTextureArraySlices;
+			unsigned int maximumNumberOfMultisamples;
 			bool		 uniformBuffer;
 			unsigned int maximumTextureBufferSize;
 			bool		 individualUniforms;
 			bool		 instancedArrays;
 			bool		 drawInstanced;
 			bool		 baseVertex;
+			bool		 multiDrawIndirect;
+			bool		 bindlessTexture;
 			bool		 vertexShader;
 			unsigned int maximumNumberOfPatchVertices;
 			unsigned int maximumNumberOfGsOutputVertices;
 			bool		 fragmentShader;
+			bool		 computeShader;
+			unsigned int maximumNumberOfStreamOutputTargets;
 		public:
 			inline Capabilities() :
 				maximumNumberOfViewports(0),
 				maximumNumberOfSimultaneousRenderTargets(0),
 				maximumTextureDimension(0),
 				maximumNumberOf2DTextureArraySlices(0),
+				maximumNumberOfMultisamples(1),
 				uniformBuffer(false),
 				maximumTextureBufferSize(0),
 				individualUniforms(false),
 				instancedArrays(false),
 				drawInstanced(false),
 				baseVertex(false),
+				multiDrawIndirect(false),
+				bindlessTexture(false),
 				vertexShader(false),
 				maximumNumberOfPatchVertices(0),
-				maximumNumberOfGsOutputVertices(0)
+				maximumNumberOfGsOutputVertices(0),
+				maximumNumberOfStreamOutputTargets(0)
 			{
 			}
 			inline ~Capabilities()
@@ -805,15 +1151,19 @@ namespace Renderer
 				maximumNumberOfSimultaneousRenderTargets(0),
 				maximumTextureDimension(0),
 				maximumNumberOf2DTextureArraySlices(0),
+				maximumNumberOfMultisamples(1),
 				uniformBuffer(false),
 				maximumTextureBufferSize(0),
 				individualUniforms(false),
 				instancedArrays(false),
 				drawInstanced(false),
 				baseVertex(false),
+				multiDrawIndirect(false),
+				bindlessTexture(false),
 				vertexShader(false),
 				maximumNumberOfPatchVertices(0),
-				maximumNumberOfGsOutputVertices(0)
+				maximumNumberOfGsOutputVertices(0),
+				maximumNumberOfStreamOutputTargets(0)
 			{
 			}
 			inline Capabilities &operator =(const Capabilities &)
@@ -826,8 +1176,79 @@ namespace Renderer
 	// Renderer/Statistics.h
 	#ifndef __RENDERER_STATISTICS_H__
 	#define __RENDERER_STATISTICS_H__
+	struct ApiCall
+	{
+		enum Enum
+		{
+			CREATE_RESOURCE					=  0,
+			DESTROY_RESOURCE				=  1,
+			MAP								=  2,
+			UNMAP							=  3,
+			COPY_RESOURCE					=  4,
+			COPY_DATA_FROM					=  5,
+			UPDATE_REGION					=  6,
+			SET_PROGRAM						=  7,
+			SET_UNIFORM						=  8,
+			IA_SET_VERTEX_ARRAY				=  9,
+			IA_SET_PRIMITIVE_TOPOLOGY		= 10,
+			SET_TEXTURE						= 11,
+			SET_TEXTURE_COLLECTION			= 12,
+			SET_SAMPLER_STATE				= 13,
+			SET_SAMPLER_STATE_COLLECTION	= 14,
+			SET_UNIFORM_BUFFER				= 15,
+			SO_SET_TARGETS					= 16,
+			SO_BEGIN						= 17,
+			SO_END							= 18,
+			RS_SET_VIEWPORTS				= 19,
+			RS_SET_SCISSOR_RECTANGLES		= 20,
+			RS_SET_STATE					= 21,
+			OM_SET_RENDER_TARGET			= 22,
+			OM_SET_DEPTH_STENCIL_STATE		= 23,
+			OM_SET_BLEND_STATE				= 24,
+			CS_SET_UNORDERED_ACCESS_VIEW	= 25,
+			CLEAR							= 26,
+			BEGIN_SCENE						= 27,
+			END_SCENE						= 28,
+			RESOLVE_MULTISAMPLE_FRAMEBUFFER	= 29,
+			DRAW							= 30,
+			DRAW_INSTANCED					= 31,
+			DRAW_INDEXED					= 32,
+			DRAW_INDEXED_INSTANCED			= 33,
+			MULTI_DRAW_INDEXED_INDIRECT		= 34,
+			DRAW_AUTO						= 35,
+			DISPATCH						= 36,
+			MEMORY_BARRIER					= 37,
+			INSERT_FENCE					= 38,
+			IS_FENCE_SIGNALED				= 39,
+			WAIT_FENCE						= 40,
+			FLUSH							= 41,
+			FINISH							= 42,
+			PRESENT							= 43,
+			RESIZE_BUFFERS					= 44,
+			SET_FULLSCREEN_STATE			= 45,
+			DEBUG							= 46,
+			OTHER							= 47,
+			NUMBER_OF_API_CALLS				= 48
+		};
+	};
+	struct ResourceMemoryTag
+	{
+		char			   name[64];
+		unsigned long long currentNumberOfBytes;
+		unsigned long long peakNumberOfBytes;
+	};
+	struct FrameStatistics
+	{
+		unsigned int	   numberOfApiCalls[ApiCall::NUMBER_OF_API_CALLS];
+		unsigned int	   numberOfRedundantApiCalls[ApiCall::NUMBER_OF_API_CALLS];
+		unsigned long long numberOfPrimitives;
+		unsigned long long numberOfUploadedBytes;
+	};
 	class Statistics
 	{
+	public:
+		static const unsigned int NUMBER_OF_RESOURCE_TYPES					= ResourceType::FENCE + 1;
+		static const unsigned int MAXIMUM_NUMBER_OF_RESOURCE_MEMORY_TAGS	= 128;
 	public:
 		unsigned int currentNumberOfPrograms;
 		unsigned int numberOfCreatedPrograms;
@@ -843,6 +1264,8 @@ namespace Renderer
 		unsigned int numberOfCreatedVertexBuffers;
 		unsigned int currentNumberOfUniformBuffers;
 		unsigned int numberOfCreatedUniformBuffers;
+		unsigned int currentNumberOfIndirectBuffers;
+		unsigned int numberOfCreatedIndirectBuffers;
 		unsigned int currentNumberOfTextureBuffers;
 		unsigned int numberOfCreatedTextureBuffers;
 		unsigned int currentNumberOfTexture2Ds;
@@ -867,10 +1290,110 @@ namespace Renderer
 		unsigned int numberOfCreatedGeometryShaders;
 		unsigned int currentNumberOfFragmentShaders;
 		unsigned int numberOfCreatedFragmentShaders;
+		unsigned int currentNumberOfComputeShaders;
+		unsigned int numberOfCreatedComputeShaders;
 		unsigned int currentNumberOfTextureCollections;
 		unsigned int numberOfCreatedTextureCollections;
 		unsigned int currentNumberOfSamplerStateCollections;
 		unsigned int numberOfCreatedSamplerStateCollections;
+		unsigned int currentNumberOfFences;
+		unsigned int numberOfCreatedFences;
+		unsigned long long currentNumberOfBytes[NUMBER_OF_RESOURCE_TYPES];
+		unsigned long long peakNumberOfBytes[NUMBER_OF_RESOURCE_TYPES];
+		unsigned long long currentTotalNumberOfBytes;
+		unsigned long long peakTotalNumberOfBytes;
+		unsigned int	   numberOfResourceMemoryTags;
+		ResourceMemoryTag  resourceMemoryTags[MAXIMUM_NUMBER_OF_RESOURCE_MEMORY_TAGS];
+		unsigned int	numberOfFrames;
+		FrameStatistics	currentFrame;
+		FrameStatistics	lastFrame;
+	public:
+		static inline const char *getApiCallName(ApiCall::Enum apiCall)
+		{
+			static const char *API_CALL_NAMES[ApiCall::NUMBER_OF_API_CALLS] =
+			{
+				"Create resource",
+				"Destroy resource",
+				"map",
+				"unmap",
+				"copyResource",
+				"copyDataFrom",
+				"updateRegion",
+				"setProgram",
+				"setUniform",
+				"iaSetVertexArray",
+				"iaSetPrimitiveTopology",
+				"*SetTexture",
+				"*SetTextureCollection",
+				"*SetSamplerState",
+				"*SetSamplerStateCollection",
+				"*SetUniformBuffer",
+				"soSetTargets",
+				"soBegin",
+				"soEnd",
+				"rsSetViewports",
+				"rsSetScissorRectangles",
+				"rsSetState",
+				"omSetRenderTarget",
+				"omSetDepthStencilState",
+				"omSetBlendState",
+				"csSetUnorderedAccessView",
+				"clear",
+				"beginScene",
+				"endScene",
+				"resolveMultisampleFramebuffer",
+				"draw",
+				"drawInstanced",
+				"drawIndexed",
+				"drawIndexedInstanced",
+				"multiDrawIndexedIndirect",
+				"drawAuto",
+				"dispatch",
+				"memoryBarrier",
+				"insertFence",
+				"isFenceSignaled",
+				"waitFence",
+				"flush",
+				"finish",
+				"present",
+				"resizeBuffers",
+				"setFullscreenState",
+				"Debug",
+				"Other"
+			};
+			return (apiCall < ApiCall::NUMBER_OF_API_CALLS) ? API_CALL_NAMES[apiCall] : "Unknown";
+		}
+		static inline const char *getResourceTypeName(ResourceType::Enum resourceType)
+		{
+			static const char *RESOURCE_TYPE_NAMES[NUMBER_OF_RESOURCE_TYPES] =
+			{
+				"Programs",
+				"Vertex arrays",
+				"Swap chains",
+				"Framebuffers",
+				"Index buffers",
+				"Vertex buffers",
+				"Uniform buffers",
+				"Indirect buffers",
+				"Texture buffers",
+				"2D textures",
+				"2D texture arrays",
+				"Rasterizer states",
+				"Depth stencil states",
+				"Blend states",
+				"Sampler states",
+				"Vertex shaders",
+				"Tessellation control shaders",
+				"Tessellation evaluation shaders",
+				"Geometry shaders",
+				"Fragment shaders",
+				"Compute shaders",
+				"Texture collections",
+				"Sampler state collections",
+				"Fences"
+			};
+			return (static_cast<unsigned int>(resourceType) < NUMBER_OF_RESOURCE_TYPES) ? RESOURCE_TYPE_NAMES[resourceType] : "Unknown";
+		}
 	public:
 		inline Statistics() :
 			currentNumberOfPrograms(0),
@@ -887,6 +1410,8 @@ namespace Renderer
 			numberOfCreatedVertexBuffers(0),
 			currentNumberOfUniformBuffers(0),
 			numberOfCreatedUniformBuffers(0),
+			currentNumberOfIndirectBuffers(0),
+			numberOfCreatedIndirectBuffers(0),
 			currentNumberOfTextureBuffers(0),
 			numberOfCreatedTextureBuffers(0),
 			currentNumberOfTexture2Ds(0),
@@ -911,11 +1436,30 @@ namespace Renderer
 			numberOfCreatedGeometryShaders(0),
 			currentNumberOfFragmentShaders(0),
 			numberOfCreatedFragmentShaders(0),
+			currentNumberOfComputeShaders(0),
+			numberOfCreatedComputeShaders(0),
 			currentNumberOfTextureCollections(0),
 			numberOfCreatedTextureCollections(0),
 			currentNumberOfSamplerStateCollections(0),
-			numberOfCreatedSamplerStateCollections(0)
+			numberOfCreatedSamplerStateCollections(0),
+			currentNumberOfFences(0),
+			numberOfCreatedFences(0),
+			currentTotalNumberOfBytes(0),
+			peakTotalNumberOfBytes(0),
+			numberOfResourceMemoryTags(1),
+			numberOfFrames(0)
 		{
+			for (unsigned int i = 0; i < NUMBER_OF_RESOURCE_TYPES; ++i)
+			{
+				currentNumberOfBytes[i] = peakNumberOfBytes[i] = 0;
+			}
+			resourceMemoryTags[0].name[0] = '\0';
+			resourceMemoryTags[0].currentNumberOfBytes = resourceMemoryTags[0].peakNumberOfBytes = 0;
+			for (unsigned int i = 0; i < ApiCall::NUMBER_OF_API_CALLS; ++i)
+			{
+				currentFrame.numberOfApiCalls[i] = currentFrame.numberOfRedundantApiCalls[i] = lastFrame.numberOfApiCalls[i] = lastFrame.numberOfRedundantApiCalls[i] = 0;
+			}
+			currentFrame.numberOfPrimitives = currentFrame.numberOfUploadedBytes = lastFrame.numberOfPrimitives = lastFrame.numberOfUploadedBytes = 0;
 		}
 		inline ~Statistics()
 		{
@@ -936,6 +1480,8 @@ namespace Renderer
 			numberOfCreatedVertexBuffers(0),
 			currentNumberOfUniformBuffers(0),
 			numberOfCreatedUniformBuffers(0),
+			currentNumberOfIndirectBuffers(0),
+			numberOfCreatedIndirectBuffers(0),
 			currentNumberOfTextureBuffers(0),
 			numberOfCreatedTextureBuffers(0),
 			currentNumberOfTexture2Ds(0),
@@ -960,11 +1506,30 @@ namespace Renderer
 			numberOfCreatedGeometryShaders(0),
 			currentNumberOfFragmentShaders(0),
 			numberOfCreatedFragmentShaders(0),
+			currentNumberOfComputeShaders(0),
+			numberOfCreatedComputeShaders(0),
 			currentNumberOfTextureCollections(0),
 			numberOfCreatedTextureCollections(0),
 			currentNumberOfSamplerStateCollections(0),
-			numberOfCreatedSamplerStateCollections(0)
+			numberOfCreatedSamplerStateCollections(0),
+			currentNumberOfFences(0),
+			numberOfCreatedFences(0),
+			currentTotalNumberOfBytes(0),
+			peakTotalNumberOfBytes(0),
+			numberOfResourceMemoryTags(1),
+			numberOfFrames(0)
 		{
+			for (unsigned int i = 0; i < NUMBER_OF_RESOURCE_TYPES; ++i)
+			{
+				currentNumberOfBytes[i] = peakNumberOfBytes[i] = 0;
+			}
+			resourceMemoryTags[0].name[0] = '\0';
+			resourceMemoryTags[0].currentNumberOfBytes = resourceMemoryTags[0].peakNumberOfBytes = 0;
+			for (unsigned int i = 0; i < ApiCall::NUMBER_OF_API_CALLS; ++i)
+			{
+				currentFrame.numberOfApiCalls[i] = currentFrame.numberOfRedundantApiCalls[i] = lastFrame.numberOfApiCalls[i] = lastFrame.numberOfRedundantApiCalls[i] = 0;
+			}
+			currentFrame.numberOfPrimitives = currentFrame.numberOfUploadedBytes = lastFrame.numberOfPrimitives = lastFrame.numberOfUploadedBytes = 0;
 		}
 		inline Statistics &operator =(const Statistics &)
 		{
@@ -982,6 +1547,19 @@ namespace Renderer
 	#define __RENDERER_IRENDERER_H__
 		class IRenderer : public RefCount<IRenderer>
 		{
+		public:
+			static void *operator new(size_t numberOfBytes, IAllocator &allocator) throw()
+			{
+				return IAllocator::allocateWithHeader(allocator, numberOfBytes, AllocationTag::RENDERER);
+			}
+			static void operator delete(void *memory)
+			{
+				IAllocator::deallocateWithHeader(memory);
+			}
+			static void operator delete(void *memory, IAllocator &)
+			{
+				IAllocator::deallocateWithHeader(memory);
+			}
 		public:
 			virtual ~IRenderer();
 			inline const Capabilities &getCapabilities() const
@@ -992,6 +1570,10 @@ namespace Renderer
 			{
 				return mStatistics;
 			}
+			inline IAllocator &getAllocator() const
+			{
+				return *mAllocator;
+			}
 		public:
 			virtual const char *getName() const = 0;
 			virtual bool isInitialized() const = 0;
@@ -1004,7 +1586,8 @@ namespace Renderer
 			virtual IVertexBuffer *createVertexBuffer(unsigned int numberOfBytes, const void *data = nullptr, BufferUsage::Enum bufferUsage = BufferUsage::DYNAMIC_DRAW) = 0;
 			virtual IIndexBuffer *createIndexBuffer(unsigned int numberOfBytes, IndexBufferFormat::Enum indexBufferFormat, const void *data = nullptr, BufferUsage::Enum bufferUsage = BufferUsage::DYNAMIC_DRAW) = 0;
 			virtual ITextureBuffer *createTextureBuffer(unsigned int numberOfBytes, TextureFormat::Enum textureFormat, const void *data = nullptr, BufferUsage::Enum bufferUsage = BufferUsage::DYNAMIC_DRAW) = 0;
-			virtual ITexture2D *createTexture2D(unsigned int width, unsigned int height, TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, TextureUsage::Enum textureUsage = TextureUsage::DEFAULT) = 0;
+			virtual IIndirectBuffer *createIndirectBuffer(unsigned int numberOfBytes, const void *data = nullptr, BufferUsage::Enum bufferUsage = BufferUsage::DYNAMIC_DRAW) = 0;
+			virtual ITexture2D *createTexture2D(unsigned int width, unsigned int height, TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, TextureUsage::Enum textureUsage = TextureUsage::DEFAULT, unsigned int numberOfMultisamples = 1) = 0;
 			virtual ITexture2DArray *createTexture2DArray(unsigned int width, unsigned int height, unsigned int numberOfSlices, TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, TextureUsage::Enum textureUsage = TextureUsage::DEFAULT) = 0;
 			virtual IRasterizerState *createRasterizerState(const RasterizerState &rasterizerState) = 0;
 			virtual IDepthStencilState *createDepthStencilState(const DepthStencilState &depthStencilState) = 0;
@@ -1014,6 +1597,8 @@ namespace Renderer
 			virtual ISamplerStateCollection *createSamplerStateCollection(unsigned int numberOfSamplerStates, ISamplerState **samplerStates) = 0;
 			virtual bool map(IResource &resource, unsigned int subresource, MapType::Enum mapType, unsigned int mapFlags, MappedSubresource &mappedSubresource) = 0;
 			virtual void unmap(IResource &resource, unsigned int subresource) = 0;
+			virtual bool copyResource(IResource &destinationResource, IResource &sourceResource) = 0;
+			virtual void setTextureResident(ITexture &texture, ISamplerState *samplerState, bool resident) = 0;
 			virtual void setProgram(IProgram *program) = 0;
 			virtual void iaSetVertexArray(IVertexArray *vertexArray) = 0;
 			virtual void iaSetPrimitiveTopology(PrimitiveTopology::Enum primitiveTopology) = 0;
@@ -1037,6 +1622,9 @@ namespace Renderer
 			virtual void gsSetSamplerState(unsigned int unit, ISamplerState *samplerState) = 0;
 			virtual void gsSetSamplerStateCollection(unsigned int startUnit, ISamplerStateCollection *samplerStateCollection) = 0;
 			virtual void gsSetUniformBuffer(unsigned int slot, IUniformBuffer *uniformBuffer) = 0;
+			virtual void soSetTargets(unsigned int numberOfTargets, IVertexBuffer **vertexBuffers, const unsigned int *offsets = nullptr) = 0;
+			virtual void soBegin(PrimitiveTopology::Enum primitiveTopology, bool rasterizerDiscard = true) = 0;
+			virtual void soEnd() = 0;
 			virtual void rsSetViewports(unsigned int numberOfViewports, const Viewport *viewports) = 0;
 			virtual void rsSetScissorRectangles(unsigned int numberOfScissorRectangles, const Renderer::ScissorRectangle *scissorRectangles) = 0;
 			virtual void rsSetState(IRasterizerState *rasterizerState) = 0;
@@ -1049,27 +1637,45 @@ namespace Renderer
 			virtual void omSetRenderTarget(IRenderTarget *renderTarget) = 0;
 			virtual void omSetDepthStencilState(IDepthStencilState *depthStencilState) = 0;
 			virtual void omSetBlendState(IBlendState *blendState) = 0;
+			virtual void csSetTexture(unsigned int unit, ITexture *texture) = 0;
+			virtual void csSetTextureCollection(unsigned int startUnit, ITextureCollection *textureCollection) = 0;
+			virtual void csSetSamplerState(unsigned int unit, ISamplerState *samplerState) = 0;
+			virtual void csSetSamplerStateCollection(unsigned int startUnit, ISamplerStateCollection *samplerStateCollection) = 0;
+			virtual void csSetUniformBuffer(unsigned int slot, IUniformBuffer *uniformBuffer) = 0;
+			virtual void csSetUnorderedAccessView(unsigned int unit, IResource *resource) = 0;
 			virtual void clear(unsigned int flags, const float color[4], float z, unsigned int stencil) = 0;
 			virtual bool beginScene() = 0;
 			virtual void endScene() = 0;
+			virtual void resolveMultisampleFramebuffer(IRenderTarget &destinationRenderTarget, IFramebuffer &sourceMultisampleFramebuffer) = 0;
 			virtual void draw(unsigned int startVertexLocation, unsigned int numberOfVertices) = 0;
 			virtual void drawInstanced(unsigned int startVertexLocation, unsigned int numberOfVertices, unsigned int numberOfInstances) = 0;
 			virtual void drawIndexed(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int minimumIndex, unsigned int numberOfVertices) = 0;
 			virtual void drawIndexedInstanced(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int minimumIndex, unsigned int numberOfVertices, unsigned int numberOfInstances) = 0;
+			virtual void multiDrawIndexedIndirect(IIndirectBuffer &indirectBuffer, unsigned int indirectBufferOffset = 0, unsigned int numberOfDraws = 1) = 0;
+			virtual void drawAuto() = 0;
+			virtual void dispatch(unsigned int groupCountX, unsigned int groupCountY, unsigned int groupCountZ) = 0;
+			virtual void memoryBarrier(unsigned int flags) = 0;
+			virtual IFence *insertFence() = 0;
+			virtual bool isFenceSignaled(IFence &fence) = 0;
+			virtual bool waitFence(IFence &fence, unsigned int timeout = ~0u) = 0;
 			virtual void flush() = 0;
 			virtual void finish() = 0;
+			virtual void presentSwapChains(unsigned int numberOfSwapChains, ISwapChain **swapChains) = 0;
 			virtual bool isDebugEnabled() = 0;
 			virtual void setDebugMarker(const wchar_t *name) = 0;
 			virtual void beginDebugEvent(const wchar_t *name) = 0;
 			virtual void endDebugEvent() = 0;
 		protected:
-			IRenderer();
+			explicit IRenderer(IAllocator *allocator);
 			explicit IRenderer(const IRenderer &source);
 			IRenderer &operator =(const IRenderer &source);
+		private:
+			static void *operator new(size_t numberOfBytes);
 		protected:
 			Capabilities mCapabilities;
 		private:
-			Statistics mStatistics;
+			Statistics  mStatistics;
+			IAllocator *mAllocator;
 		};
 		typedef SmartRefCount<IRenderer> IRendererPtr;
 	#endif
@@ -1079,6 +1685,19 @@ namespace Renderer
 	#define __RENDERER_ISHADERLANGUAGE_H__
 		class IShaderLanguage : public RefCount<IShaderLanguage>
 		{
+		public:
+			static void *operator new(size_t numberOfBytes, IAllocator &allocator) throw()
+			{
+				return IAllocator::allocateWithHeader(allocator, numberOfBytes, AllocationTag::RENDERER);
+			}
+			static void operator delete(void *memory)
+			{
+				IAllocator::deallocateWithHeader(memory);
+			}
+			static void operator delete(void *memory, IAllocator &)
+			{
+				IAllocator::deallocateWithHeader(memory);
+			}
 		public:
 			virtual ~IShaderLanguage();
 			inline IRenderer &getRenderer() const
@@ -1105,11 +1724,15 @@ namespace Renderer
 			virtual IGeometryShader *createGeometryShader(const char *sourceCode, GsInputPrimitiveTopology::Enum gsInputPrimitiveTopology, GsOutputPrimitiveTopology::Enum gsOutputPrimitiveTopology, unsigned int numberOfOutputVertices, const char *profile = nullptr, const char *arguments = nullptr, const char *entry = nullptr) = 0;
 			virtual IFragmentShader *createFragmentShader(const char *sourceCode, const char *profile = nullptr, const char *arguments = nullptr, const char *entry = nullptr) = 0;
 			virtual IProgram *createProgram(IVertexShader *vertexShader, ITessellationControlShader *tessellationControlShader, ITessellationEvaluationShader *tessellationEvaluationShader, IGeometryShader *geometryShader, IFragmentShader *fragmentShader) = 0;
+			virtual IComputeShader *createComputeShader(const char *sourceCode, const char *profile = nullptr, const char *arguments = nullptr, const char *entry = nullptr) = 0;
+			virtual IProgram *createComputeProgram(IComputeShader *computeShader) = 0;
 			virtual IUniformBuffer *createUniformBuffer(unsigned int numberOfBytes, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) = 0;
 		protected:
 			explicit IShaderLanguage(IRenderer &renderer);
 			explicit IShaderLanguage(const IShaderLanguage &source);
 			IShaderLanguage &operator =(const IShaderLanguage &source);
+		private:
+			static void *operator new(size_t numberOfBytes);
 		private:
 			IRenderer *mRenderer;
 		};
@@ -1121,6 +1744,27 @@ namespace Renderer
 	#define __RENDERER_IRESOURCE_H__
 		class IResource : public RefCount<IResource>
 		{
+		public:
+			static inline void *operator new(size_t numberOfBytes, IAllocator &allocator) throw()
+			{
+				return ResourcePool::allocateUnpooled(allocator, numberOfBytes);
+			}
+			static inline void *operator new(size_t numberOfBytes, ResourcePool &resourcePool) throw()
+			{
+				return resourcePool.allocate(numberOfBytes);
+			}
+			static inline void operator delete(void *memory)
+			{
+				ResourcePool::deallocate(memory);
+			}
+			static inline void operator delete(void *memory, IAllocator &)
+			{
+				ResourcePool::deallocate(memory);
+			}
+			static inline void operator delete(void *memory, ResourcePool &)
+			{
+				ResourcePool::deallocate(memory);
+			}
 		public:
 			virtual ~IResource();
 			inline ResourceType::Enum getResourceType() const
@@ -1131,15 +1775,23 @@ namespace Renderer
 			{
 				return *mRenderer;
 			}
+			inline unsigned long long getNumberOfBytes() const
+			{
+				return mNumberOfBytes;
+			}
 		public:
 			virtual void setDebugName(const char *name) = 0;
 		protected:
 			IResource(ResourceType::Enum resourceType, IRenderer &renderer);
 			explicit IResource(const IResource &source);
 			IResource &operator =(const IResource &source);
+		private:
+			static void *operator new(size_t numberOfBytes);
 		private:
 			ResourceType::Enum  mResourceType;
 			IRenderer		   *mRenderer;
+			unsigned long long  mNumberOfBytes;
+			unsigned int		mResourceMemoryTag;
 		};
 		typedef SmartRefCount<IResource> IResourcePtr;
 	#endif
@@ -1153,6 +1805,7 @@ namespace Renderer
 			virtual ~IProgram();
 		public:
 			virtual IVertexArray *createVertexArray(unsigned int numberOfAttributes, const VertexArrayAttribute *attributes, IIndexBuffer *indexBuffer = nullptr) = 0;
+			virtual bool setStreamOutputVaryings(unsigned int numberOfVaryings, const char **varyingNames, bool interleaved = true) = 0;
 			virtual int getAttributeLocation(const char *attributeName) = 0;
 			virtual unsigned int getUniformBlockIndex(const char *uniformBlockName, unsigned int defaultIndex) = 0;
 			virtual handle getUniformHandle(const char *uniformName) = 0;
@@ -1217,6 +1870,11 @@ namespace Renderer
 			virtual void resizeBuffers() = 0;
 			virtual bool getFullscreenState() const = 0;
 			virtual void setFullscreenState(bool fullscreen) = 0;
+			virtual int getSwapInterval() const = 0;
+			virtual bool setSwapInterval(int swapInterval) = 0;
+			virtual unsigned int getMaximumFrameLatency() const = 0;
+			virtual void setMaximumFrameLatency(unsigned int maximumFrameLatency) = 0;
+			virtual const PresentStatistics &getPresentStatistics() const = 0;
 		protected:
 			explicit ISwapChain(IRenderer &renderer);
 			explicit ISwapChain(const ISwapChain &source);
@@ -1302,6 +1960,23 @@ namespace Renderer
 		typedef SmartRefCount<IUniformBuffer> IUniformBufferPtr;
 	#endif
 
+	// Renderer/IIndirectBuffer.h
+	#ifndef __RENDERER_IINDIRECTBUFFER_H__
+	#define __RENDERER_IINDIRECTBUFFER_H__
+		class IIndirectBuffer : public IBuffer
+		{
+		public:
+			virtual ~IIndirectBuffer();
+		public:
+			virtual void copyDataFrom(unsigned int numberOfBytes, const void *data) = 0;
+		protected:
+			explicit IIndirectBuffer(IRenderer &renderer);
+			explicit IIndirectBuffer(const IIndirectBuffer &source);
+			IIndirectBuffer &operator =(const IIndirectBuffer &source);
+		};
+		typedef SmartRefCount<IIndirectBuffer> IIndirectBufferPtr;
+	#endif
+
 	// Renderer/ITexture.h
 	#ifndef __RENDERER_ITEXTURE_H__
 	#define __RENDERER_ITEXTURE_H__
@@ -1309,6 +1984,8 @@ namespace Renderer
 		{
 		public:
 			virtual ~ITexture();
+		public:
+			virtual unsigned long long getBindlessHandle(ISamplerState *samplerState) = 0;
 		protected:
 			ITexture(ResourceType::Enum resourceType, IRenderer &renderer);
 			explicit ITexture(const ITexture &source);
@@ -1349,6 +2026,8 @@ namespace Renderer
 			{
 				return mHeight;
 			}
+		public:
+			virtual void updateRegion(unsigned int mipmap, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data) = 0;
 		protected:
 			ITexture2D(IRenderer &renderer, unsigned int width, unsigned int height);
 			explicit ITexture2D(const ITexture2D &source);
@@ -1379,6 +2058,8 @@ namespace Renderer
 			{
 				return mNumberOfSlices;
 			}
+		public:
+			virtual void updateRegion(unsigned int mipmap, unsigned int slice, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data) = 0;
 		protected:
 			ITexture2DArray(IRenderer &renderer, unsigned int width, unsigned int height, unsigned int numberOfSlices);
 			explicit ITexture2DArray(const ITexture2DArray &source);
@@ -1693,6 +2374,21 @@ namespace Renderer
 		typedef SmartRefCount<IFragmentShader> IFragmentShaderPtr;
 	#endif
 
+	// Renderer/IComputeShader.h
+	#ifndef __RENDERER_ICOMPUTESHADER_H__
+	#define __RENDERER_ICOMPUTESHADER_H__
+		class IComputeShader : public IShader
+		{
+		public:
+			virtual ~IComputeShader();
+		protected:
+			explicit IComputeShader(IRenderer &renderer);
+			explicit IComputeShader(const IComputeShader &source);
+			IComputeShader &operator =(const IComputeShader &source);
+		};
+		typedef SmartRefCount<IComputeShader> IComputeShaderPtr;
+	#endif
+
 	// Renderer/ICollection.h
 	#ifndef __RENDERER_ICOLLECTION_H__
 	#define __RENDERER_ICOLLECTION_H__
@@ -1738,6 +2434,21 @@ namespace Renderer
 		typedef SmartRefCount<ISamplerStateCollection> ISamplerStateCollectionPtr;
 	#endif
 
+	// Renderer/IFence.h
+	#ifndef __RENDERER_IFENCE_H__
+	#define __RENDERER_IFENCE_H__
+		class IFence : public IResource
+		{
+		public:
+			virtual ~IFence();
+		protected:
+			explicit IFence(IRenderer &renderer);
+			explicit IFence(const IFence &source);
+			IFence &operator =(const IFence &source);
+		};
+		typedef SmartRefCount<IFence> IFencePtr;
+	#endif
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -86,6 +86,29 @@ namespace Renderer
 		};
 	};
 
+	/**
+	*  @brief
+	*    Memory barrier flags, used to order compute shader writes against subsequent reads
+	*
+	*  @note
+	*    - Directly maps to the OpenGL "GL_ARB_shader_image_load_store"-extension barrier bits, do not change them
+	*/
+	struct MemoryBarrierFlag
+	{
+		enum Enum
+		{
+			VERTEX_ARRAY        = 0x00000001,	/**< Vertex data sourced from buffers written by shaders */
+			INDEX_BUFFER        = 0x00000002,	/**< Indices sourced from buffers written by shaders */
+			UNIFORM_BUFFER      = 0x00000004,	/**< Uniform buffer contents written by shaders */
+			TEXTURE_FETCH       = 0x00000008,	/**< Texture fetches from textures written by shaders */
+			SHADER_IMAGE_ACCESS = 0x00000020,	/**< Shader image loads and stores (unordered access views) */
+			COMMAND             = 0x00000040,	/**< Indirect draw and dispatch arguments written by shaders */
+			BUFFER_UPDATE       = 0x00000200,	/**< Buffer map and copy operations */
+			SHADER_STORAGE      = 0x00002000,	/**< Shader storage buffer loads and stores (unordered access views) */
+			ALL                 = 0xffffffff	/**< All of the above */
+		};
+	};
+
 	/**
 	*  @brief
 	*    Primitive topology types
@@ -0,0 +1,287 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERER_RESOURCEPOOL_H__
+#define __RENDERER_RESOURCEPOOL_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/IAllocator.h"
+
+#include <stddef.h>	// For "size_t"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Fixed-size object pool for resource instances of one resource type
+	*
+	*  @remarks
+	*    The pool hands out fixed-size slots from slabs, a slab is a contiguous block of memory holding a number of slots and
+	*    is allocated by using the allocator of the renderer. Released slots are put into a free list and are recycled in
+	*    O(1), slabs are kept until the pool gets destroyed. Each slot starts with a small header pointing to the owner slab,
+	*    this way "Renderer::IResource::operator delete()" is able to return the memory to the right pool without knowing
+	*    the pool. Memory requests which are too large for the pool are directly allocated by using the allocator of the pool.
+	*
+	*    Usage example:
+	*    @code
+	*    Renderer::IVertexBuffer *vertexBuffer = new (mVertexBufferPool) VertexBuffer(*this, numberOfBytes, data, bufferUsage);
+	*    @endcode
+	*
+	*  @note
+	*    - Not thread safe, the same rules as for the owner renderer instance apply
+	*    - Resource instances which are still alive when the pool gets destroyed (memory leak) stay valid, the slabs of those
+	*      instances are released as soon as the last of those instances was released
+	*
+	*  @see
+	*    - "Renderer::IResource::operator new()"
+	*/
+	class ResourcePool
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const unsigned int DEFAULT_NUMBER_OF_SLOTS_PER_SLAB = 64;	/**< Default number of slots per slab */
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Allocate memory for a resource instance without a resource pool
+		*
+		*  @param[in] allocator
+		*    Allocator to allocate with, must stay valid until the memory was deallocated
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate
+		*
+		*  @return
+		*    The allocated memory, null pointer on error, release it by using "deallocate()"
+		*/
+		static inline void *allocateUnpooled(IAllocator &allocator, size_t numberOfBytes);
+
+		/**
+		*  @brief
+		*    Deallocate memory which was allocated by a resource pool or by "allocateUnpooled()"
+		*
+		*  @param[in] memory
+		*    Memory to deallocate, can be a null pointer (nothing happens in this case)
+		*/
+		static inline void deallocate(void *memory);
+
+		/**
+		*  @brief
+		*    Return the size of the largest of the given types, used to choose the slot size of a pool shared by several resource classes
+		*
+		*  @return
+		*    The size of the largest of the given types in bytes
+		*/
+		template <typename TYPE0, typename TYPE1>
+		static inline size_t getMaximumNumberOfBytes();
+		template <typename TYPE0, typename TYPE1, typename TYPE2>
+		static inline size_t getMaximumNumberOfBytes();
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] allocator
+		*    Allocator to allocate the slabs with, must stay valid as long as slots of this pool are in use
+		*  @param[in] numberOfBytesPerSlot
+		*    Number of bytes per slot, usually the size of the largest resource class of the resource type the pool is used for
+		*  @param[in] numberOfSlotsPerSlab
+		*    Number of slots per slab, must not be 0
+		*/
+		inline ResourcePool(IAllocator &allocator, size_t numberOfBytesPerSlot, unsigned int numberOfSlotsPerSlab = DEFAULT_NUMBER_OF_SLOTS_PER_SLAB);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline ~ResourcePool();
+
+		/**
+		*  @brief
+		*    Return the number of bytes per slot
+		*
+		*  @return
+		*    The number of bytes per slot, without the slot header
+		*/
+		inline size_t getNumberOfBytesPerSlot() const;
+
+		/**
+		*  @brief
+		*    Return the number of slabs
+		*
+		*  @return
+		*    The number of slabs
+		*/
+		inline unsigned int getNumberOfSlabs() const;
+
+		/**
+		*  @brief
+		*    Return the number of slots in use
+		*
+		*  @return
+		*    The number of slots in use
+		*/
+		inline unsigned int getNumberOfUsedSlots() const;
+
+		/**
+		*  @brief
+		*    Allocate a slot
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate, when it's larger than the slot size the memory is allocated by using "allocateUnpooled()"
+		*
+		*  @return
+		*    The allocated memory, null pointer on error, release it by using "deallocate()"
+		*/
+		inline void *allocate(size_t numberOfBytes);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct Slab;
+		/**
+		*  @brief
+		*    Slot header, directly in front of the slot memory
+		*/
+		struct SlotHeader
+		{
+			Slab *slab;	/**< Owner slab, null pointer for memory allocated by "allocateUnpooled()" */
+			union
+			{
+				SlotHeader *nextFreeSlot;	/**< Next free slot, only valid for slab slots while the slot is inside the free list */
+				IAllocator *allocator;		/**< Allocator the memory was allocated with, only valid for memory allocated by "allocateUnpooled()" */
+			};
+		};
+		/**
+		*  @brief
+		*    Slab header, directly in front of the slots of a slab
+		*/
+		struct Slab
+		{
+			Slab		 *nextSlab;				/**< Next slab of the owner pool, can be a null pointer */
+			ResourcePool *resourcePool;			/**< Owner resource pool, null pointer if the pool was destroyed while slots were still in use */
+			IAllocator	 *allocator;			/**< Allocator the slab was allocated with, always valid */
+			unsigned int  numberOfUsedSlots;	/**< Number of slots in use */
+		};
+		static const size_t SLOT_HEADER_SIZE = (sizeof(SlotHeader) + IAllocator::DEFAULT_ALIGNMENT - 1) & ~static_cast<size_t>(IAllocator::DEFAULT_ALIGNMENT - 1);	/**< Size of the slot header in bytes, keeps the slot memory aligned */
+		static const size_t SLAB_HEADER_SIZE = (sizeof(Slab) + IAllocator::DEFAULT_ALIGNMENT - 1) & ~static_cast<size_t>(IAllocator::DEFAULT_ALIGNMENT - 1);			/**< Size of the slab header in bytes, keeps the slots aligned */
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Add a new slab and put its slots into the free list
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*/
+		inline bool addSlab();
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		inline explicit ResourcePool(const ResourcePool &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		inline ResourcePool &operator =(const ResourcePool &source);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		IAllocator	 *mAllocator;				/**< Allocator to allocate the slabs with, always valid */
+		size_t		  mNumberOfBytesPerSlot;	/**< Number of bytes per slot, without the slot header */
+		size_t		  mSlotStride;				/**< Distance between two slots in bytes, including the slot header */
+		unsigned int  mNumberOfSlotsPerSlab;	/**< Number of slots per slab, always at least 1 */
+		unsigned int  mNumberOfSlabs;			/**< Number of slabs */
+		unsigned int  mNumberOfUsedSlots;		/**< Number of slots in use */
+		Slab		 *mFirstSlab;				/**< First slab, can be a null pointer */
+		SlotHeader	 *mFirstFreeSlot;			/**< First free slot, can be a null pointer */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "Renderer/ResourcePool.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERER_RESOURCEPOOL_H__
@@ -0,0 +1,272 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Allocate memory for a resource instance without a resource pool
+	*/
+	inline void *ResourcePool::allocateUnpooled(IAllocator &allocator, size_t numberOfBytes)
+	{
+		// Unpooled memory has a slot header as well, without an owner slab but with the allocator to release the memory with
+		SlotHeader *slotHeader = static_cast<SlotHeader*>(allocator.allocate(static_cast<unsigned int>(SLOT_HEADER_SIZE + numberOfBytes), IAllocator::DEFAULT_ALIGNMENT, AllocationTag::RESOURCE));
+		if (nullptr == slotHeader)
+		{
+			// Error!
+			return nullptr;
+		}
+		slotHeader->slab = nullptr;
+		slotHeader->allocator = &allocator;
+		return reinterpret_cast<unsigned char*>(slotHeader) + SLOT_HEADER_SIZE;
+	}
+
+	/**
+	*  @brief
+	*    Deallocate memory which was allocated by a resource pool or by "allocateUnpooled()"
+	*/
+	inline void ResourcePool::deallocate(void *memory)
+	{
+		if (nullptr != memory)
+		{
+			SlotHeader *slotHeader = reinterpret_cast<SlotHeader*>(static_cast<unsigned char*>(memory) - SLOT_HEADER_SIZE);
+			Slab *slab = slotHeader->slab;
+			if (nullptr == slab)
+			{
+				// Unpooled memory
+				slotHeader->allocator->deallocate(slotHeader, AllocationTag::RESOURCE);
+			}
+			else
+			{
+				--slab->numberOfUsedSlots;
+				ResourcePool *resourcePool = slab->resourcePool;
+				if (nullptr != resourcePool)
+				{
+					// Put the slot into the free list of the owner pool, O(1)
+					slotHeader->nextFreeSlot = resourcePool->mFirstFreeSlot;
+					resourcePool->mFirstFreeSlot = slotHeader;
+					--resourcePool->mNumberOfUsedSlots;
+				}
+				else if (0 == slab->numberOfUsedSlots)
+				{
+					// The owner pool is already gone and this was the last slot in use, release the slab
+					slab->allocator->deallocate(slab, AllocationTag::RESOURCE);
+				}
+			}
+		}
+	}
+
+
+	/**
+	*  @brief
+	*    Return the size of the largest of the given types
+	*/
+	template <typename TYPE0, typename TYPE1>
+	inline size_t ResourcePool::getMaximumNumberOfBytes()
+	{
+		return (sizeof(TYPE0) > sizeof(TYPE1)) ? sizeof(TYPE0) : sizeof(TYPE1);
+	}
+
+	template <typename TYPE0, typename TYPE1, typename TYPE2>
+	inline size_t ResourcePool::getMaximumNumberOfBytes()
+	{
+		const size_t numberOfBytes = getMaximumNumberOfBytes<TYPE0, TYPE1>();
+		return (numberOfBytes > sizeof(TYPE2)) ? numberOfBytes : sizeof(TYPE2);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	inline ResourcePool::ResourcePool(IAllocator &allocator, size_t numberOfBytesPerSlot, unsigned int numberOfSlotsPerSlab) :
+		mAllocator(&allocator),
+		mNumberOfBytesPerSlot(numberOfBytesPerSlot),
+		mSlotStride((SLOT_HEADER_SIZE + numberOfBytesPerSlot + IAllocator::DEFAULT_ALIGNMENT - 1) & ~static_cast<size_t>(IAllocator::DEFAULT_ALIGNMENT - 1)),
+		mNumberOfSlotsPerSlab((numberOfSlotsPerSlab > 0) ? numberOfSlotsPerSlab : 1),
+		mNumberOfSlabs(0),
+		mNumberOfUsedSlots(0),
+		mFirstSlab(nullptr),
+		mFirstFreeSlot(nullptr)
+	{
+		// Nothing to do in here, slabs are added on demand
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline ResourcePool::~ResourcePool()
+	{
+		// Release all slabs, slabs with slots still in use are released as soon as the last slot is released
+		Slab *slab = mFirstSlab;
+		while (nullptr != slab)
+		{
+			Slab *nextSlab = slab->nextSlab;
+			if (0 == slab->numberOfUsedSlots)
+			{
+				mAllocator->deallocate(slab, AllocationTag::RESOURCE);
+			}
+			else
+			{
+				slab->resourcePool = nullptr;
+			}
+			slab = nextSlab;
+		}
+	}
+
+	/**
+	*  @brief
+	*    Return the number of bytes per slot
+	*/
+	inline size_t ResourcePool::getNumberOfBytesPerSlot() const
+	{
+		return mNumberOfBytesPerSlot;
+	}
+
+	/**
+	*  @brief
+	*    Return the number of slabs
+	*/
+	inline unsigned int ResourcePool::getNumberOfSlabs() const
+	{
+		return mNumberOfSlabs;
+	}
+
+	/**
+	*  @brief
+	*    Return the number of slots in use
+	*/
+	inline unsigned int ResourcePool::getNumberOfUsedSlots() const
+	{
+		return mNumberOfUsedSlots;
+	}
+
+	/**
+	*  @brief
+	*    Allocate a slot
+	*/
+	inline void *ResourcePool::allocate(size_t numberOfBytes)
+	{
+		// Too large for this pool? (e.g. a resource class which was not taken into account when choosing the slot size)
+		if (numberOfBytes > mNumberOfBytesPerSlot)
+		{
+			return allocateUnpooled(*mAllocator, numberOfBytes);
+		}
+
+		// Get a free slot, add a new slab if required
+		if (nullptr == mFirstFreeSlot && !addSlab())
+		{
+			// Error!
+			return nullptr;
+		}
+		SlotHeader *slotHeader = mFirstFreeSlot;
+		mFirstFreeSlot = slotHeader->nextFreeSlot;
+		slotHeader->nextFreeSlot = nullptr;
+		++slotHeader->slab->numberOfUsedSlots;
+		++mNumberOfUsedSlots;
+
+		// Done
+		return reinterpret_cast<unsigned char*>(slotHeader) + SLOT_HEADER_SIZE;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Add a new slab and put its slots into the free list
+	*/
+	inline bool ResourcePool::addSlab()
+	{
+		// Allocate the slab, the slots are directly behind the slab header
+		Slab *slab = static_cast<Slab*>(mAllocator->allocate(static_cast<unsigned int>(SLAB_HEADER_SIZE + mSlotStride * mNumberOfSlotsPerSlab), IAllocator::DEFAULT_ALIGNMENT, AllocationTag::RESOURCE));
+		if (nullptr == slab)
+		{
+			// Error!
+			return false;
+		}
+		slab->nextSlab = mFirstSlab;
+		slab->resourcePool = this;
+		slab->allocator = mAllocator;
+		slab->numberOfUsedSlots = 0;
+		mFirstSlab = slab;
+		++mNumberOfSlabs;
+
+		// Put the slots into the free list, in reverse order so the slots are handed out in memory order
+		unsigned char *slots = reinterpret_cast<unsigned char*>(slab) + SLAB_HEADER_SIZE;
+		for (unsigned int i = mNumberOfSlotsPerSlab; i > 0; --i)
+		{
+			SlotHeader *slotHeader = reinterpret_cast<SlotHeader*>(slots + mSlotStride * (i - 1));
+			slotHeader->slab = slab;
+			slotHeader->nextFreeSlot = mFirstFreeSlot;
+			mFirstFreeSlot = slotHeader;
+		}
+
+		// Done
+		return true;
+	}
+
+	/**
+	*  @brief
+	*    Copy constructor
+	*/
+	inline ResourcePool::ResourcePool(const ResourcePool &) :
+		mAllocator(nullptr),
+		mNumberOfBytesPerSlot(0),
+		mSlotStride(0),
+		mNumberOfSlotsPerSlab(0),
+		mNumberOfSlabs(0),
+		mNumberOfUsedSlots(0),
+		mFirstSlab(nullptr),
+		mFirstFreeSlot(nullptr)
+	{
+		// Not supported
+	}
+
+	/**
+	*  @brief
+	*    Copy operator
+	*/
+	inline ResourcePool &ResourcePool::operator =(const ResourcePool &)
+	{
+		// Not supported
+		return *this;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
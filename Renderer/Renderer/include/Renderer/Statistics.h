@@ -26,6 +26,12 @@
 #define __RENDERER_STATISTICS_H__
 
 
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/ResourceTypes.h"
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -33,6 +39,111 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Definitions                                           ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Renderer API call, used as index for the per frame API call histograms
+	*
+	*  @note
+	*    - Related renderer API methods are sharing one API call, e.g. the shader stage methods of all shader stages
+	*/
+	struct ApiCall
+	{
+		enum Enum
+		{
+			// Resource
+			CREATE_RESOURCE					=  0,	/**< "Renderer::IRenderer::create*()", "Renderer::IShaderLanguage::create*()" and "Renderer::IProgram::createVertexArray()" */
+			DESTROY_RESOURCE				=  1,	/**< Resource destruction caused by the last "release()" */
+			MAP								=  2,	/**< "Renderer::IRenderer::map()" */
+			UNMAP							=  3,	/**< "Renderer::IRenderer::unmap()" */
+			COPY_RESOURCE					=  4,	/**< "Renderer::IRenderer::copyResource()" */
+			COPY_DATA_FROM					=  5,	/**< "copyDataFrom()" of the texture buffer, uniform buffer and indirect buffer */
+			UPDATE_REGION					=  6,	/**< "updateRegion()" of the 2D texture and 2D texture array */
+			// States
+			SET_PROGRAM						=  7,	/**< "Renderer::IRenderer::setProgram()" */
+			SET_UNIFORM						=  8,	/**< "Renderer::IProgram::setUniform*()" and "Renderer::IProgram::setTextureUnit()" */
+			IA_SET_VERTEX_ARRAY				=  9,	/**< "Renderer::IRenderer::iaSetVertexArray()" */
+			IA_SET_PRIMITIVE_TOPOLOGY		= 10,	/**< "Renderer::IRenderer::iaSetPrimitiveTopology()" */
+			SET_TEXTURE						= 11,	/**< "Renderer::IRenderer::*SetTexture()" of all shader stages */
+			SET_TEXTURE_COLLECTION			= 12,	/**< "Renderer::IRenderer::*SetTextureCollection()" of all shader stages */
+			SET_SAMPLER_STATE				= 13,	/**< "Renderer::IRenderer::*SetSamplerState()" of all shader stages */
+			SET_SAMPLER_STATE_COLLECTION	= 14,	/**< "Renderer::IRenderer::*SetSamplerStateCollection()" of all shader stages */
+			SET_UNIFORM_BUFFER				= 15,	/**< "Renderer::IRenderer::*SetUniformBuffer()" of all shader stages */
+			SO_SET_TARGETS					= 16,	/**< "Renderer::IRenderer::soSetTargets()" */
+			SO_BEGIN						= 17,	/**< "Renderer::IRenderer::soBegin()" */
+			SO_END							= 18,	/**< "Renderer::IRenderer::soEnd()" */
+			RS_SET_VIEWPORTS				= 19,	/**< "Renderer::IRenderer::rsSetViewports()" */
+			RS_SET_SCISSOR_RECTANGLES		= 20,	/**< "Renderer::IRenderer::rsSetScissorRectangles()" */
+			RS_SET_STATE					= 21,	/**< "Renderer::IRenderer::rsSetState()" */
+			OM_SET_RENDER_TARGET			= 22,	/**< "Renderer::IRenderer::omSetRenderTarget()" */
+			OM_SET_DEPTH_STENCIL_STATE		= 23,	/**< "Renderer::IRenderer::omSetDepthStencilState()" */
+			OM_SET_BLEND_STATE				= 24,	/**< "Renderer::IRenderer::omSetBlendState()" */
+			CS_SET_UNORDERED_ACCESS_VIEW	= 25,	/**< "Renderer::IRenderer::csSetUnorderedAccessView()" */
+			// Operations
+			CLEAR							= 26,	/**< "Renderer::IRenderer::clear()" */
+			BEGIN_SCENE						= 27,	/**< "Renderer::IRenderer::beginScene()" */
+			END_SCENE						= 28,	/**< "Renderer::IRenderer::endScene()" */
+			RESOLVE_MULTISAMPLE_FRAMEBUFFER	= 29,	/**< "Renderer::IRenderer::resolveMultisampleFramebuffer()" */
+			// Draw call
+			DRAW							= 30,	/**< "Renderer::IRenderer::draw()" */
+			DRAW_INSTANCED					= 31,	/**< "Renderer::IRenderer::drawInstanced()" */
+			DRAW_INDEXED					= 32,	/**< "Renderer::IRenderer::drawIndexed()" */
+			DRAW_INDEXED_INSTANCED			= 33,	/**< "Renderer::IRenderer::drawIndexedInstanced()" */
+			MULTI_DRAW_INDEXED_INDIRECT		= 34,	/**< "Renderer::IRenderer::multiDrawIndexedIndirect()" */
+			DRAW_AUTO						= 35,	/**< "Renderer::IRenderer::drawAuto()" */
+			// Compute
+			DISPATCH						= 36,	/**< "Renderer::IRenderer::dispatch()" */
+			MEMORY_BARRIER					= 37,	/**< "Renderer::IRenderer::memoryBarrier()" */
+			// Synchronization
+			INSERT_FENCE					= 38,	/**< "Renderer::IRenderer::insertFence()" */
+			IS_FENCE_SIGNALED				= 39,	/**< "Renderer::IRenderer::isFenceSignaled()" */
+			WAIT_FENCE						= 40,	/**< "Renderer::IRenderer::waitFence()" */
+			FLUSH							= 41,	/**< "Renderer::IRenderer::flush()" */
+			FINISH							= 42,	/**< "Renderer::IRenderer::finish()" */
+			// Swap chain
+			PRESENT							= 43,	/**< "Renderer::ISwapChain::present()" */
+			RESIZE_BUFFERS					= 44,	/**< "Renderer::ISwapChain::resizeBuffers()" */
+			SET_FULLSCREEN_STATE			= 45,	/**< "Renderer::ISwapChain::setFullscreenState()" */
+			// Misc
+			DEBUG							= 46,	/**< Debug markers, debug events and debug names */
+			OTHER							= 47,	/**< Shader language and program queries */
+			NUMBER_OF_API_CALLS				= 48	/**< Number of API calls */
+		};
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ Structures                                            ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Resource memory tag, the estimated memory of all resources sharing the same debug name
+	*
+	*  @see
+	*    - "Renderer::IResource::setDebugName()"
+	*/
+	struct ResourceMemoryTag
+	{
+		char			   name[64];				/**< ASCII debug name of the resources, empty string for unnamed resources */
+		unsigned long long currentNumberOfBytes;	/**< Current estimated number of bytes of the resources */
+		unsigned long long peakNumberOfBytes;		/**< Highest estimated number of bytes of the resources so far (high-water mark) */
+	};
+
+	/**
+	*  @brief
+	*    Renderer API calls and the work submitted by them during one frame
+	*/
+	struct FrameStatistics
+	{
+		unsigned int	   numberOfApiCalls[ApiCall::NUMBER_OF_API_CALLS];			/**< Number of calls per renderer API call, use "Renderer::ApiCall" as index */
+		unsigned int	   numberOfRedundantApiCalls[ApiCall::NUMBER_OF_API_CALLS];	/**< Number of state setting calls setting the same state the previous call (of the same shader stage and unit) already set, use "Renderer::ApiCall" as index */
+		unsigned long long numberOfPrimitives;										/**< Number of submitted points, lines, triangles or patches, indirect and automatic draw calls are not taken into account because only the GPU knows their number of primitives */
+		unsigned long long numberOfUploadedBytes;									/**< Number of bytes passed by the CPU to the renderer (resource creation data, data updates and data written into mapped resources) */
+	};
+
+
 	//[-------------------------------------------------------]
 	//[ Classes                                               ]
 	//[-------------------------------------------------------]
@@ -48,6 +159,14 @@ namespace Renderer
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const unsigned int NUMBER_OF_RESOURCE_TYPES					= ResourceType::FENCE + 1;	/**< Number of resource types, see "Renderer::ResourceType" */
+		static const unsigned int MAXIMUM_NUMBER_OF_RESOURCE_MEMORY_TAGS	= 128;						/**< Maximum number of resource memory tags, resources with further debug names are accounted to the unnamed resources */
+
+
 	//[-------------------------------------------------------]
 	//[ Public data                                           ]
 	//[-------------------------------------------------------]
@@ -71,6 +190,8 @@ namespace Renderer
 		unsigned int numberOfCreatedVertexBuffers;					/**< Number of created vertex buffer object (VBO, input-assembler (IA) stage) instances */
 		unsigned int currentNumberOfUniformBuffers;					/**< Current number of uniform buffer object (UBO, "constant buffer" in Direct3D terminology) instances */
 		unsigned int numberOfCreatedUniformBuffers;					/**< Number of created uniform buffer object (UBO, "constant buffer" in Direct3D terminology) instances */
+		unsigned int currentNumberOfIndirectBuffers;				/**< Current number of indirect buffer object instances */
+		unsigned int numberOfCreatedIndirectBuffers;				/**< Number of created indirect buffer object instances */
 		// ITexture
 		unsigned int currentNumberOfTextureBuffers;					/**< Current number of texture buffer object (TBO) instances */
 		unsigned int numberOfCreatedTextureBuffers;					/**< Number of created texture buffer object (TBO) instances */
@@ -98,11 +219,62 @@ namespace Renderer
 		unsigned int numberOfCreatedGeometryShaders;				/**< Number of created geometry shader (GS) instances */
 		unsigned int currentNumberOfFragmentShaders;				/**< Current number of gragment shader (FS, "pixel shader" in Direct3D terminology) instances */
 		unsigned int numberOfCreatedFragmentShaders;				/**< Number of created gragment shader (FS, "pixel shader" in Direct3D terminology) instances */
+		unsigned int currentNumberOfComputeShaders;					/**< Current number of compute shader (CS) instances */
+		unsigned int numberOfCreatedComputeShaders;					/**< Number of created compute shader (CS) instances */
 		// ICollection
 		unsigned int currentNumberOfTextureCollections;				/**< Current number of texture collection instances */
 		unsigned int numberOfCreatedTextureCollections;				/**< Number of created texture collection instances */
 		unsigned int currentNumberOfSamplerStateCollections;		/**< Current number of sampler state collection instances */
 		unsigned int numberOfCreatedSamplerStateCollections;		/**< Number of created sampler state collection instances */
+		// Synchronization
+		unsigned int currentNumberOfFences;							/**< Current number of fence instances */
+		unsigned int numberOfCreatedFences;							/**< Number of created fence instances */
+		//[-------------------------------------------------------]
+		//[ Memory                                                ]
+		//[-------------------------------------------------------]
+		// -> Estimated number of bytes of buffers, textures and render targets, recorded by the renderer backends at resource creation
+		unsigned long long currentNumberOfBytes[NUMBER_OF_RESOURCE_TYPES];					/**< Current estimated number of bytes per resource type, use "Renderer::ResourceType" as index */
+		unsigned long long peakNumberOfBytes[NUMBER_OF_RESOURCE_TYPES];						/**< Highest estimated number of bytes per resource type so far (high-water mark), use "Renderer::ResourceType" as index */
+		unsigned long long currentTotalNumberOfBytes;										/**< Current estimated number of bytes of all resources */
+		unsigned long long peakTotalNumberOfBytes;											/**< Highest estimated number of bytes of all resources so far (high-water mark) */
+		unsigned int	   numberOfResourceMemoryTags;										/**< Number of used resource memory tags, the first one is always used for unnamed resources */
+		ResourceMemoryTag  resourceMemoryTags[MAXIMUM_NUMBER_OF_RESOURCE_MEMORY_TAGS];		/**< Resource memory tags, per debug name */
+		//[-------------------------------------------------------]
+		//[ Frame                                                 ]
+		//[-------------------------------------------------------]
+		// -> Only recorded by instrumenting renderers wrapping another renderer (e.g. the trace renderer), the renderer backends don't record them
+		unsigned int	numberOfFrames;	/**< Number of frames recorded so far, 0 if the renderer doesn't record frame statistics */
+		FrameStatistics	currentFrame;	/**< Statistics of the current frame, still growing */
+		FrameStatistics	lastFrame;		/**< Statistics of the last complete frame, this is the one to display */
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return the name of a renderer API call
+		*
+		*  @param[in] apiCall
+		*    Renderer API call
+		*
+		*  @return
+		*    The ASCII name of the renderer API call, always valid
+		*/
+		static inline const char *getApiCallName(ApiCall::Enum apiCall);
+
+		/**
+		*  @brief
+		*    Return the name of a resource type
+		*
+		*  @param[in] resourceType
+		*    Resource type
+		*
+		*  @return
+		*    The ASCII name of the resource type, always valid
+		*/
+		static inline const char *getResourceTypeName(ResourceType::Enum resourceType);
 
 
 	//[-------------------------------------------------------]
@@ -145,6 +317,83 @@ namespace Renderer
 		*/
 		inline void debugOutputCurrentResouces() const;
 
+		/**
+		*  @brief
+		*    Use debug output to show the estimated resource memory per resource type and per debug name
+		*
+		*  @note
+		*    - Primarily for debugging, e.g. to find out which subsystem is responsible for exceeding a memory budget
+		*    - Not for the public "Renderer.h"-interface
+		*/
+		inline void debugOutputResourceMemory() const;
+
+		/**
+		*  @brief
+		*    Use debug output to show the renderer API calls of the last complete frame
+		*
+		*  @note
+		*    - Primarily for debugging
+		*    - Not for the public "Renderer.h"-interface
+		*/
+		inline void debugOutputLastFrame() const;
+
+		/**
+		*  @brief
+		*    Return the resource memory tag index of a debug name
+		*
+		*  @param[in] name
+		*    ASCII debug name, empty string for unnamed resources, must be valid
+		*
+		*  @return
+		*    The resource memory tag index, a new resource memory tag is added if required
+		*
+		*  @note
+		*    - Not for the public "Renderer.h"-interface, used by "Renderer::IResource"
+		*    - Names are truncated to 63 characters, if there's no free resource memory tag left, the unnamed one is returned
+		*/
+		inline unsigned int getResourceMemoryTag(const char *name);
+
+		/**
+		*  @brief
+		*    Account resource memory
+		*
+		*  @param[in] resourceType
+		*    The resource type
+		*  @param[in] resourceMemoryTag
+		*    Resource memory tag index, see "getResourceMemoryTag()"
+		*  @param[in] numberOfBytes
+		*    Estimated number of bytes to add
+		*
+		*  @note
+		*    - Not for the public "Renderer.h"-interface, used by "Renderer::IResource"
+		*/
+		inline void addResourceMemory(ResourceType::Enum resourceType, unsigned int resourceMemoryTag, unsigned long long numberOfBytes);
+
+		/**
+		*  @brief
+		*    Remove previously accounted resource memory
+		*
+		*  @param[in] resourceType
+		*    The resource type
+		*  @param[in] resourceMemoryTag
+		*    Resource memory tag index, see "getResourceMemoryTag()"
+		*  @param[in] numberOfBytes
+		*    Estimated number of bytes to remove, must have been added before
+		*
+		*  @note
+		*    - Not for the public "Renderer.h"-interface, used by "Renderer::IResource"
+		*/
+		inline void removeResourceMemory(ResourceType::Enum resourceType, unsigned int resourceMemoryTag, unsigned long long numberOfBytes);
+
+		/**
+		*  @brief
+		*    End the current frame, the current frame statistics become the last frame statistics
+		*
+		*  @note
+		*    - Not for the public "Renderer.h"-interface, used by instrumenting renderers when the main swap chain gets presented
+		*/
+		inline void endFrame();
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
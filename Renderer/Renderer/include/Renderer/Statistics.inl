@@ -23,6 +23,8 @@
 //[-------------------------------------------------------]
 #include "Renderer/PlatformTypes.h"	// For "RENDERER_OUTPUT_DEBUG_STRING()" and "RENDERER_OUTPUT_DEBUG_PRINTF()"
 
+#include <string.h>	// For "memset()", "memcpy()", "strncmp()" and "strncpy()"
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -31,6 +33,123 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Return the name of a renderer API call
+	*/
+	inline const char *Statistics::getApiCallName(ApiCall::Enum apiCall)
+	{
+		// API call names, use "Renderer::ApiCall" as index
+		static const char *API_CALL_NAMES[ApiCall::NUMBER_OF_API_CALLS] =
+		{
+			// Resource
+			"Create resource",
+			"Destroy resource",
+			"map",
+			"unmap",
+			"copyResource",
+			"copyDataFrom",
+			"updateRegion",
+			// States
+			"setProgram",
+			"setUniform",
+			"iaSetVertexArray",
+			"iaSetPrimitiveTopology",
+			"*SetTexture",
+			"*SetTextureCollection",
+			"*SetSamplerState",
+			"*SetSamplerStateCollection",
+			"*SetUniformBuffer",
+			"soSetTargets",
+			"soBegin",
+			"soEnd",
+			"rsSetViewports",
+			"rsSetScissorRectangles",
+			"rsSetState",
+			"omSetRenderTarget",
+			"omSetDepthStencilState",
+			"omSetBlendState",
+			"csSetUnorderedAccessView",
+			// Operations
+			"clear",
+			"beginScene",
+			"endScene",
+			"resolveMultisampleFramebuffer",
+			// Draw call
+			"draw",
+			"drawInstanced",
+			"drawIndexed",
+			"drawIndexedInstanced",
+			"multiDrawIndexedIndirect",
+			"drawAuto",
+			// Compute
+			"dispatch",
+			"memoryBarrier",
+			// Synchronization
+			"insertFence",
+			"isFenceSignaled",
+			"waitFence",
+			"flush",
+			"finish",
+			// Swap chain
+			"present",
+			"resizeBuffers",
+			"setFullscreenState",
+			// Misc
+			"Debug",
+			"Other"
+		};
+		return (apiCall < ApiCall::NUMBER_OF_API_CALLS) ? API_CALL_NAMES[apiCall] : "Unknown";
+	}
+
+	/**
+	*  @brief
+	*    Return the name of a resource type
+	*/
+	inline const char *Statistics::getResourceTypeName(ResourceType::Enum resourceType)
+	{
+		// Resource type names, use "Renderer::ResourceType" as index
+		static const char *RESOURCE_TYPE_NAMES[NUMBER_OF_RESOURCE_TYPES] =
+		{
+			"Programs",
+			"Vertex arrays",
+			// IRenderTarget
+			"Swap chains",
+			"Framebuffers",
+			// IBuffer
+			"Index buffers",
+			"Vertex buffers",
+			"Uniform buffers",
+			"Indirect buffers",
+			// ITexture
+			"Texture buffers",
+			"2D textures",
+			"2D texture arrays",
+			// IState
+			"Rasterizer states",
+			"Depth stencil states",
+			"Blend states",
+			"Sampler states",
+			// IShader
+			"Vertex shaders",
+			"Tessellation control shaders",
+			"Tessellation evaluation shaders",
+			"Geometry shaders",
+			"Fragment shaders",
+			"Compute shaders",
+			// ICollection
+			"Texture collections",
+			"Sampler state collections",
+			// Synchronization
+			"Fences"
+		};
+		return (static_cast<unsigned int>(resourceType) < NUMBER_OF_RESOURCE_TYPES) ? RESOURCE_TYPE_NAMES[resourceType] : "Unknown";
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -55,6 +174,8 @@ namespace Renderer
 		numberOfCreatedVertexBuffers(0),
 		currentNumberOfUniformBuffers(0),
 		numberOfCreatedUniformBuffers(0),
+		currentNumberOfIndirectBuffers(0),
+		numberOfCreatedIndirectBuffers(0),
 		// ITexture
 		currentNumberOfTextureBuffers(0),
 		numberOfCreatedTextureBuffers(0),
@@ -82,13 +203,31 @@ namespace Renderer
 		numberOfCreatedGeometryShaders(0),
 		currentNumberOfFragmentShaders(0),
 		numberOfCreatedFragmentShaders(0),
+		currentNumberOfComputeShaders(0),
+		numberOfCreatedComputeShaders(0),
 		// ICollection
 		currentNumberOfTextureCollections(0),
 		numberOfCreatedTextureCollections(0),
 		currentNumberOfSamplerStateCollections(0),
-		numberOfCreatedSamplerStateCollections(0)
+		numberOfCreatedSamplerStateCollections(0),
+		// Synchronization
+		currentNumberOfFences(0),
+		numberOfCreatedFences(0),
+		// Memory
+		currentTotalNumberOfBytes(0),
+		peakTotalNumberOfBytes(0),
+		numberOfResourceMemoryTags(1),
+		// Frame
+		numberOfFrames(0)
 	{
-		// Nothing to do in here
+		// Clear the memory statistics, the first resource memory tag is used for unnamed resources
+		memset(currentNumberOfBytes, 0, sizeof(currentNumberOfBytes));
+		memset(peakNumberOfBytes, 0, sizeof(peakNumberOfBytes));
+		memset(resourceMemoryTags, 0, sizeof(resourceMemoryTags));
+
+		// Clear the frame statistics
+		memset(&currentFrame, 0, sizeof(FrameStatistics));
+		memset(&lastFrame, 0, sizeof(FrameStatistics));
 	}
 
 	/**
@@ -116,6 +255,7 @@ namespace Renderer
 				currentNumberOfIndexBuffers +
 				currentNumberOfVertexBuffers +
 				currentNumberOfUniformBuffers +
+				currentNumberOfIndirectBuffers +
 				// ITexture
 				currentNumberOfTextureBuffers +
 				currentNumberOfTexture2Ds +
@@ -131,9 +271,12 @@ namespace Renderer
 				currentNumberOfTessellationEvaluationShaders +
 				currentNumberOfGeometryShaders +
 				currentNumberOfFragmentShaders +
+				currentNumberOfComputeShaders +
 				// ICollection
 				currentNumberOfTextureCollections +
-				currentNumberOfSamplerStateCollections;
+				currentNumberOfSamplerStateCollections +
+				// Synchronization
+				currentNumberOfFences;
 	}
 
 	/**
@@ -157,6 +300,7 @@ namespace Renderer
 		RENDERER_OUTPUT_DEBUG_PRINTF("Index buffers: %d\n", currentNumberOfIndexBuffers)
 		RENDERER_OUTPUT_DEBUG_PRINTF("Vertex buffers: %d\n", currentNumberOfVertexBuffers)
 		RENDERER_OUTPUT_DEBUG_PRINTF("Uniform buffers: %d\n", currentNumberOfUniformBuffers)
+		RENDERER_OUTPUT_DEBUG_PRINTF("Indirect buffers: %d\n", currentNumberOfIndirectBuffers)
 
 		// ITexture
 		RENDERER_OUTPUT_DEBUG_PRINTF("Texture buffers: %d\n", currentNumberOfTextureBuffers)
@@ -175,15 +319,168 @@ namespace Renderer
 		RENDERER_OUTPUT_DEBUG_PRINTF("Tessellation evaluation shaders: %d\n", currentNumberOfTessellationEvaluationShaders)
 		RENDERER_OUTPUT_DEBUG_PRINTF("Geometry shaders: %d\n", currentNumberOfGeometryShaders)
 		RENDERER_OUTPUT_DEBUG_PRINTF("Fragment shaders: %d\n", currentNumberOfFragmentShaders)
+		RENDERER_OUTPUT_DEBUG_PRINTF("Compute shaders: %d\n", currentNumberOfComputeShaders)
 
 		// ICollection
 		RENDERER_OUTPUT_DEBUG_PRINTF("Texture collections: %d\n", currentNumberOfTextureCollections)
 		RENDERER_OUTPUT_DEBUG_PRINTF("Sampler state collections: %d\n", currentNumberOfSamplerStateCollections)
 
+		// Synchronization
+		RENDERER_OUTPUT_DEBUG_PRINTF("Fences: %d\n", currentNumberOfFences)
+
 		// End
 		RENDERER_OUTPUT_DEBUG_STRING("***************************************************\n")
 	}
 
+	/**
+	*  @brief
+	*    Use debug output to show the estimated resource memory per resource type and per debug name
+	*/
+	inline void Statistics::debugOutputResourceMemory() const
+	{
+		// Start
+		RENDERER_OUTPUT_DEBUG_STRING("** Estimated renderer resource memory in KiB (current/peak) **\n")
+
+		// Per resource type, only the ones which ever had memory
+		for (unsigned int i = 0; i < NUMBER_OF_RESOURCE_TYPES; ++i)
+		{
+			if (0 != peakNumberOfBytes[i])
+			{
+				RENDERER_OUTPUT_DEBUG_PRINTF("%s: %llu/%llu\n", getResourceTypeName(static_cast<ResourceType::Enum>(i)), currentNumberOfBytes[i] / 1024, peakNumberOfBytes[i] / 1024)
+			}
+		}
+		RENDERER_OUTPUT_DEBUG_PRINTF("Total: %llu/%llu\n", currentTotalNumberOfBytes / 1024, peakTotalNumberOfBytes / 1024)
+
+		// Per debug name
+		RENDERER_OUTPUT_DEBUG_STRING("-- Per debug name --\n")
+		for (unsigned int i = 0; i < numberOfResourceMemoryTags; ++i)
+		{
+			RENDERER_OUTPUT_DEBUG_PRINTF("%s: %llu/%llu\n", (0 == i) ? "<unnamed>" : resourceMemoryTags[i].name, resourceMemoryTags[i].currentNumberOfBytes / 1024, resourceMemoryTags[i].peakNumberOfBytes / 1024)
+		}
+
+		// End
+		RENDERER_OUTPUT_DEBUG_STRING("**************************************************************\n")
+	}
+
+	/**
+	*  @brief
+	*    Use debug output to show the renderer API calls of the last complete frame
+	*/
+	inline void Statistics::debugOutputLastFrame() const
+	{
+		// Start
+		RENDERER_OUTPUT_DEBUG_PRINTF("** Renderer API calls of frame %u (calls/redundant calls) **\n", numberOfFrames)
+
+		// Per API call, only the ones which were used
+		unsigned int numberOfApiCalls = 0;
+		for (unsigned int i = 0; i < ApiCall::NUMBER_OF_API_CALLS; ++i)
+		{
+			if (0 != lastFrame.numberOfApiCalls[i])
+			{
+				RENDERER_OUTPUT_DEBUG_PRINTF("%s: %u/%u\n", getApiCallName(static_cast<ApiCall::Enum>(i)), lastFrame.numberOfApiCalls[i], lastFrame.numberOfRedundantApiCalls[i])
+				numberOfApiCalls += lastFrame.numberOfApiCalls[i];
+			}
+		}
+		RENDERER_OUTPUT_DEBUG_PRINTF("Total: %u\n", numberOfApiCalls)
+
+		// Submitted work
+		RENDERER_OUTPUT_DEBUG_PRINTF("Primitives: %llu\n", lastFrame.numberOfPrimitives)
+		RENDERER_OUTPUT_DEBUG_PRINTF("Uploaded KiB: %llu\n", lastFrame.numberOfUploadedBytes / 1024)
+
+		// End
+		RENDERER_OUTPUT_DEBUG_STRING("*************************************************************\n")
+	}
+
+	/**
+	*  @brief
+	*    Return the resource memory tag index of a debug name
+	*/
+	inline unsigned int Statistics::getResourceMemoryTag(const char *name)
+	{
+		// Unnamed resource?
+		if ('\0' == name[0])
+		{
+			return 0;
+		}
+
+		// Is there already a resource memory tag with the given name?
+		// -> A linear search is fine in here, debug names are only set once per resource
+		static const unsigned int MAXIMUM_NAME_LENGTH = sizeof(resourceMemoryTags[0].name) - 1;
+		for (unsigned int i = 1; i < numberOfResourceMemoryTags; ++i)
+		{
+			if (0 == strncmp(resourceMemoryTags[i].name, name, MAXIMUM_NAME_LENGTH))
+			{
+				// Done
+				return i;
+			}
+		}
+
+		// Add a new resource memory tag, if there's no free one left the resources are accounted to the unnamed ones
+		if (numberOfResourceMemoryTags < MAXIMUM_NUMBER_OF_RESOURCE_MEMORY_TAGS)
+		{
+			ResourceMemoryTag &resourceMemoryTag = resourceMemoryTags[numberOfResourceMemoryTags];
+			strncpy(resourceMemoryTag.name, name, MAXIMUM_NAME_LENGTH);
+			resourceMemoryTag.name[MAXIMUM_NAME_LENGTH] = '\0';
+			resourceMemoryTag.currentNumberOfBytes = 0;
+			resourceMemoryTag.peakNumberOfBytes    = 0;
+
+			// Done
+			return numberOfResourceMemoryTags++;
+		}
+		return 0;
+	}
+
+	/**
+	*  @brief
+	*    Account resource memory
+	*/
+	inline void Statistics::addResourceMemory(ResourceType::Enum resourceType, unsigned int resourceMemoryTag, unsigned long long numberOfBytes)
+	{
+		// Per resource type
+		currentNumberOfBytes[resourceType] += numberOfBytes;
+		if (peakNumberOfBytes[resourceType] < currentNumberOfBytes[resourceType])
+		{
+			peakNumberOfBytes[resourceType] = currentNumberOfBytes[resourceType];
+		}
+
+		// Total
+		currentTotalNumberOfBytes += numberOfBytes;
+		if (peakTotalNumberOfBytes < currentTotalNumberOfBytes)
+		{
+			peakTotalNumberOfBytes = currentTotalNumberOfBytes;
+		}
+
+		// Per debug name
+		ResourceMemoryTag &currentResourceMemoryTag = resourceMemoryTags[resourceMemoryTag];
+		currentResourceMemoryTag.currentNumberOfBytes += numberOfBytes;
+		if (currentResourceMemoryTag.peakNumberOfBytes < currentResourceMemoryTag.currentNumberOfBytes)
+		{
+			currentResourceMemoryTag.peakNumberOfBytes = currentResourceMemoryTag.currentNumberOfBytes;
+		}
+	}
+
+	/**
+	*  @brief
+	*    Remove previously accounted resource memory
+	*/
+	inline void Statistics::removeResourceMemory(ResourceType::Enum resourceType, unsigned int resourceMemoryTag, unsigned long long numberOfBytes)
+	{
+		currentNumberOfBytes[resourceType] -= numberOfBytes;
+		currentTotalNumberOfBytes -= numberOfBytes;
+		resourceMemoryTags[resourceMemoryTag].currentNumberOfBytes -= numberOfBytes;
+	}
+
+
+	/**
+	*  @brief
+	*    End the current frame, the current frame statistics become the last frame statistics
+	*/
+	inline void Statistics::endFrame()
+	{
+		memcpy(&lastFrame, &currentFrame, sizeof(FrameStatistics));
+		memset(&currentFrame, 0, sizeof(FrameStatistics));
+		++numberOfFrames;
+	}
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -209,6 +506,8 @@ namespace Renderer
 		numberOfCreatedVertexBuffers(0),
 		currentNumberOfUniformBuffers(0),
 		numberOfCreatedUniformBuffers(0),
+		currentNumberOfIndirectBuffers(0),
+		numberOfCreatedIndirectBuffers(0),
 		// ITexture
 		currentNumberOfTextureBuffers(0),
 		numberOfCreatedTextureBuffers(0),
@@ -236,13 +535,29 @@ namespace Renderer
 		numberOfCreatedGeometryShaders(0),
 		currentNumberOfFragmentShaders(0),
 		numberOfCreatedFragmentShaders(0),
+		currentNumberOfComputeShaders(0),
+		numberOfCreatedComputeShaders(0),
 		// ICollection
 		currentNumberOfTextureCollections(0),
 		numberOfCreatedTextureCollections(0),
 		currentNumberOfSamplerStateCollections(0),
-		numberOfCreatedSamplerStateCollections(0)
+		numberOfCreatedSamplerStateCollections(0),
+		// Synchronization
+		currentNumberOfFences(0),
+		numberOfCreatedFences(0),
+		// Memory
+		currentTotalNumberOfBytes(0),
+		peakTotalNumberOfBytes(0),
+		numberOfResourceMemoryTags(1),
+		// Frame
+		numberOfFrames(0)
 	{
 		// Not supported
+		memset(currentNumberOfBytes, 0, sizeof(currentNumberOfBytes));
+		memset(peakNumberOfBytes, 0, sizeof(peakNumberOfBytes));
+		memset(resourceMemoryTags, 0, sizeof(resourceMemoryTags));
+		memset(&currentFrame, 0, sizeof(FrameStatistics));
+		memset(&lastFrame, 0, sizeof(FrameStatistics));
 	}
 
 	/**
@@ -0,0 +1,180 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERER_STLALLOCATOR_H__
+#define __RENDERER_STLALLOCATOR_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/IAllocator.h"
+
+#include <stddef.h>	// For "size_t" and "ptrdiff_t"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Standard template library (STL) allocator adapter, lets STL containers allocate through a renderer allocator
+	*
+	*  @remarks
+	*    Usage example:
+	*    @code
+	*    std::vector<Handle, Renderer::StlAllocator<Handle> > handles(Renderer::StlAllocator<Handle>(renderer.getAllocator(), Renderer::AllocationTag::RESOURCE));
+	*    @endcode
+	*
+	*  @note
+	*    - Has no default constructor, the allocator must be passed to the constructor of the container
+	*    - The STL containers used by the renderer are not using exceptions, running out of memory is fatal just as with the default STL allocator
+	*/
+	template <typename TYPE>
+	class StlAllocator
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		typedef TYPE		value_type;
+		typedef TYPE	   *pointer;
+		typedef const TYPE *const_pointer;
+		typedef TYPE	   &reference;
+		typedef const TYPE &const_reference;
+		typedef size_t		size_type;
+		typedef ptrdiff_t	difference_type;
+		template <typename OTHER_TYPE>
+		struct rebind
+		{
+			typedef StlAllocator<OTHER_TYPE> other;
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] allocator
+		*    Allocator to allocate with, must stay valid as long as the container using this STL allocator exists
+		*  @param[in] tag
+		*    Allocation tag
+		*/
+		inline StlAllocator(IAllocator &allocator, AllocationTag::Enum tag);
+
+		/**
+		*  @brief
+		*    Converting copy constructor, required by the STL containers to allocate their internal node types
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		template <typename OTHER_TYPE>
+		inline StlAllocator(const StlAllocator<OTHER_TYPE> &source);
+
+		/**
+		*  @brief
+		*    Return the renderer allocator
+		*
+		*  @return
+		*    The renderer allocator
+		*/
+		inline IAllocator &getAllocator() const;
+
+		/**
+		*  @brief
+		*    Return the allocation tag
+		*
+		*  @return
+		*    The allocation tag
+		*/
+		inline AllocationTag::Enum getTag() const;
+
+		//[-------------------------------------------------------]
+		//[ STL allocator requirements                            ]
+		//[-------------------------------------------------------]
+		inline pointer address(reference value) const;
+		inline const_pointer address(const_reference value) const;
+		inline pointer allocate(size_type numberOfElements, const void *hint = nullptr);
+		inline void deallocate(pointer elements, size_type numberOfElements);
+		inline size_type max_size() const;
+		inline void construct(pointer element, const_reference value);
+		inline void destroy(pointer element);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		IAllocator			*mAllocator;	/**< Renderer allocator, always valid */
+		AllocationTag::Enum  mTag;			/**< Allocation tag */
+
+
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ Global operators                                      ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Return whether or not two STL allocators are using the same renderer allocator, memory allocated by one can be deallocated by the other in this case
+	*/
+	template <typename TYPE0, typename TYPE1>
+	inline bool operator ==(const StlAllocator<TYPE0> &left, const StlAllocator<TYPE1> &right);
+	template <typename TYPE0, typename TYPE1>
+	inline bool operator !=(const StlAllocator<TYPE0> &left, const StlAllocator<TYPE1> &right);
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "Renderer/StlAllocator.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERER_STLALLOCATOR_H__
@@ -0,0 +1,150 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <new>	// For placement new
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	template <typename TYPE>
+	inline StlAllocator<TYPE>::StlAllocator(IAllocator &allocator, AllocationTag::Enum tag) :
+		mAllocator(&allocator),
+		mTag(tag)
+	{
+		// Nothing to do in here
+	}
+
+	/**
+	*  @brief
+	*    Converting copy constructor
+	*/
+	template <typename TYPE>
+	template <typename OTHER_TYPE>
+	inline StlAllocator<TYPE>::StlAllocator(const StlAllocator<OTHER_TYPE> &source) :
+		mAllocator(&source.getAllocator()),
+		mTag(source.getTag())
+	{
+		// Nothing to do in here
+	}
+
+	/**
+	*  @brief
+	*    Return the renderer allocator
+	*/
+	template <typename TYPE>
+	inline IAllocator &StlAllocator<TYPE>::getAllocator() const
+	{
+		return *mAllocator;
+	}
+
+	/**
+	*  @brief
+	*    Return the allocation tag
+	*/
+	template <typename TYPE>
+	inline AllocationTag::Enum StlAllocator<TYPE>::getTag() const
+	{
+		return mTag;
+	}
+
+	//[-------------------------------------------------------]
+	//[ STL allocator requirements                            ]
+	//[-------------------------------------------------------]
+	template <typename TYPE>
+	inline typename StlAllocator<TYPE>::pointer StlAllocator<TYPE>::address(reference value) const
+	{
+		return &value;
+	}
+
+	template <typename TYPE>
+	inline typename StlAllocator<TYPE>::const_pointer StlAllocator<TYPE>::address(const_reference value) const
+	{
+		return &value;
+	}
+
+	template <typename TYPE>
+	inline typename StlAllocator<TYPE>::pointer StlAllocator<TYPE>::allocate(size_type numberOfElements, const void *)
+	{
+		return mAllocator->allocateArray<TYPE>(static_cast<unsigned int>(numberOfElements), mTag);
+	}
+
+	template <typename TYPE>
+	inline void StlAllocator<TYPE>::deallocate(pointer elements, size_type)
+	{
+		mAllocator->deallocateArray(elements, mTag);
+	}
+
+	template <typename TYPE>
+	inline typename StlAllocator<TYPE>::size_type StlAllocator<TYPE>::max_size() const
+	{
+		// The renderer allocator is using 32 bit sizes
+		return static_cast<size_type>(~0u) / sizeof(TYPE);
+	}
+
+	template <typename TYPE>
+	inline void StlAllocator<TYPE>::construct(pointer element, const_reference value)
+	{
+		new (element) TYPE(value);
+	}
+
+	template <typename TYPE>
+	inline void StlAllocator<TYPE>::destroy(pointer element)
+	{
+		element->~TYPE();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Global operators                                      ]
+	//[-------------------------------------------------------]
+	template <typename TYPE0, typename TYPE1>
+	inline bool operator ==(const StlAllocator<TYPE0> &left, const StlAllocator<TYPE1> &right)
+	{
+		return (&left.getAllocator() == &right.getAllocator());
+	}
+
+	template <typename TYPE0, typename TYPE1>
+	inline bool operator !=(const StlAllocator<TYPE0> &left, const StlAllocator<TYPE1> &right)
+	{
+		return (&left.getAllocator() != &right.getAllocator());
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
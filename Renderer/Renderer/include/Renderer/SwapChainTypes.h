@@ -0,0 +1,73 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERER_SWAPCHAIN_TYPES_H__
+#define __RENDERER_SWAPCHAIN_TYPES_H__
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Definitions                                           ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Present statistics of a swap chain
+	*
+	*  @remarks
+	*    The present interval is the CPU time between two consecutive "Renderer::ISwapChain::present()" returns. When the
+	*    frame pacing is working this matches the display refresh rate multiplied by the swap interval, uneven intervals
+	*    are a sign of stuttering.
+	*/
+	struct PresentStatistics
+	{
+		static const unsigned int NUMBER_OF_PRESENT_INTERVALS = 128;	/**< Number of recorded present intervals */
+
+		unsigned int numberOfPresents;										/**< Number of presents so far */
+		float		 lastPresentInterval;									/**< Last present interval in milliseconds, 0 before the second present */
+		float		 averagePresentInterval;								/**< Average of the recorded present intervals in milliseconds */
+		float		 minimumPresentInterval;								/**< Minimum of the recorded present intervals in milliseconds */
+		float		 maximumPresentInterval;								/**< Maximum of the recorded present intervals in milliseconds */
+		float		 lastFrameLatencyWaitTime;								/**< Time in milliseconds the last present was blocked to honor the maximum frame latency */
+		unsigned int numberOfPresentIntervals;								/**< Number of valid recorded present intervals, at most "NUMBER_OF_PRESENT_INTERVALS" */
+		unsigned int nextPresentInterval;									/**< Index of the recorded present interval to overwrite next, the oldest one as soon as all are valid */
+		float		 presentIntervals[NUMBER_OF_PRESENT_INTERVALS];			/**< Recorded present intervals in milliseconds (ring buffer), e.g. for frame time graphs */
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERER_SWAPCHAIN_TYPES_H__
@@ -53,7 +53,9 @@ namespace Renderer
 			FLOAT_1 = 0,	/**< Float 1 (one component per element, 32 bit floating point per component) */
 			FLOAT_2 = 1,	/**< Float 2 (two components per element, 32 bit floating point per component) */
 			FLOAT_3 = 2,	/**< Float 3 (three components per element, 32 bit floating point per component) */
-			FLOAT_4 = 3		/**< Float 4 (four components per element, 32 bit floating point per component) */
+			FLOAT_4 = 3,	/**< Float 4 (four components per element, 32 bit floating point per component) */
+			HALF_2  = 4,	/**< Half 2 (two components per element, 16 bit floating point per component, may not be supported by each API) */
+			HALF_4  = 5		/**< Half 4 (four components per element, 16 bit floating point per component, may not be supported by each API) */
 		};
 	};
 
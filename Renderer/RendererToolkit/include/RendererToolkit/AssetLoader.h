@@ -0,0 +1,244 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERERTOOLKIT_ASSETLOADER_H__
+#define __RENDERERTOOLKIT_ASSETLOADER_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/IAssetLoader.h"
+#include "RendererToolkit/IJobSystem.h"
+
+#include <Renderer/StlAllocator.h>
+#include <Renderer/AllocatorObject.h>
+
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <string>
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+	class RendererToolkitImpl;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Asset loader class
+	*
+	*  @remarks
+	*    A single job with one element per request is used for loading. Each job function call claims the next request which
+	*    wasn't loaded yet, so it doesn't matter which thread is executing which element. Loaded requests are added to a queue
+	*    which is processed by "update()".
+	*/
+	class AssetLoader : public IAssetLoader, public Renderer::AllocatorObject<Renderer::AllocationTag::TOOLKIT>
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] rendererToolkitImpl
+		*    Renderer toolkit implementation instance to use
+		*
+		*  @note
+		*    - The asset loader instance keeps a reference to the provided renderer toolkit implementation instance
+		*/
+		explicit AssetLoader(RendererToolkitImpl &rendererToolkitImpl);
+
+		/**
+		*  @brief
+		*    Destructor
+		*
+		*  @note
+		*    - Requests which were not loaded yet are skipped, the calling thread waits for requests which are currently loaded
+		*/
+		virtual ~AssetLoader();
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual RendererToolkit::IAssetLoader methods  ]
+	//[-------------------------------------------------------]
+	public:
+		virtual bool addRequest(const char *filename, LoadFunction loadFunction, CreateFunction createFunction, DestroyFunction destroyFunction, void *data) override;
+		inline virtual unsigned int getNumberOfRequests() const override;
+		inline virtual unsigned int getNumberOfLoadedRequests() const override;
+		inline virtual unsigned int getNumberOfFinishedRequests() const override;
+		virtual bool start() override;
+		virtual unsigned int update(float maximumMilliseconds) override;
+		virtual void flush() override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef std::basic_string<char, std::char_traits<char>, Renderer::StlAllocator<char> > String;
+
+		/**
+		*  @brief
+		*    Request
+		*/
+		struct Request
+		{
+			String			 filename;			/**< ASCII filename of the asset to load */
+			LoadFunction	 loadFunction;		/**< Load function, always valid */
+			CreateFunction	 createFunction;	/**< Create function, always valid */
+			DestroyFunction	 destroyFunction;	/**< Destroy function, always valid */
+			void			*data;				/**< Data to pass to the functions, can be a null pointer */
+			void			*loadedAsset;		/**< The loaded asset, a null pointer if the request wasn't loaded yet, loading failed or the request is finished */
+		};
+		typedef std::vector<Request, Renderer::StlAllocator<Request> >			Requests;
+		typedef std::deque<unsigned int, Renderer::StlAllocator<unsigned int> >	RequestIndices;
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Job function loading requests
+		*
+		*  @param[in] data
+		*    Owner asset loader instance
+		*  @param[in] firstElement
+		*    Index of the first element to process
+		*  @param[in] lastElement
+		*    Index of the element after the last element to process
+		*
+		*  @note
+		*    - Loads one request per element
+		*/
+		static void loadJob(void *data, unsigned int firstElement, unsigned int lastElement);
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		inline explicit AssetLoader(const AssetLoader &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		inline AssetLoader &operator =(const AssetLoader &source);
+
+		/**
+		*  @brief
+		*    Load the next request which wasn't loaded yet
+		*
+		*  @return
+		*    "true" if a request was loaded, else "false" (all requests were already claimed or loading was cancelled)
+		*/
+		bool loadNextRequest();
+
+		/**
+		*  @brief
+		*    Finish the oldest loaded request which isn't finished yet
+		*
+		*  @return
+		*    "true" if a request was finished, else "false" (there's no loaded request)
+		*/
+		bool finishNextRequest();
+
+		/**
+		*  @brief
+		*    Wait for the loading job in case it's still running
+		*/
+		void waitForJob();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		RendererToolkitImpl			*mRendererToolkitImpl;		/**< The used renderer toolkit implementation instance (we keep a reference to it), always valid */
+		Requests					 mRequests;					/**< Requests, not changed after loading was started so the worker threads can access them without synchronization */
+		IJobSystem::Job				*mJob;						/**< Job loading the requests, a null pointer if loading wasn't started yet or the job was waited for */
+		bool						 mStarted;					/**< Was loading started? */
+		std::atomic<bool>			 mCancelled;				/**< Was loading cancelled? Requests which were not loaded yet are skipped. */
+		std::atomic<unsigned int>	 mNextRequestIndex;			/**< Index of the next request to load, can be beyond the number of requests */
+		std::atomic<unsigned int>	 mNumberOfLoadedRequests;	/**< Number of loaded requests */
+		unsigned int				 mNumberOfFinishedRequests;	/**< Number of finished requests */
+		std::mutex					 mLoadedRequestsMutex;		/**< Mutex protecting "mLoadedRequests" */
+		RequestIndices				 mLoadedRequests;			/**< Indices of loaded requests which are not finished yet, in the order they were loaded */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/AssetLoader.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERERTOOLKIT_ASSETLOADER_H__
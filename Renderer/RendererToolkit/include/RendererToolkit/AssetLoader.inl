@@ -0,0 +1,83 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual RendererToolkit::IAssetLoader methods  ]
+	//[-------------------------------------------------------]
+	inline unsigned int AssetLoader::getNumberOfRequests() const
+	{
+		return static_cast<unsigned int>(mRequests.size());
+	}
+
+	inline unsigned int AssetLoader::getNumberOfLoadedRequests() const
+	{
+		return mNumberOfLoadedRequests;
+	}
+
+	inline unsigned int AssetLoader::getNumberOfFinishedRequests() const
+	{
+		return mNumberOfFinishedRequests;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Copy constructor
+	*/
+	inline AssetLoader::AssetLoader(const AssetLoader &source) :
+		IAssetLoader(source),
+		mRendererToolkitImpl(nullptr),
+		mRequests(source.mRequests.get_allocator()),
+		mJob(nullptr),
+		mStarted(false),
+		mCancelled(false),
+		mNextRequestIndex(0),
+		mNumberOfLoadedRequests(0),
+		mNumberOfFinishedRequests(0),
+		mLoadedRequests(source.mLoadedRequests.get_allocator())
+	{
+		// Not supported
+	}
+
+	/**
+	*  @brief
+	*    Copy operator
+	*/
+	inline AssetLoader &AssetLoader::operator =(const AssetLoader &)
+	{
+		// Not supported
+		return *this;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
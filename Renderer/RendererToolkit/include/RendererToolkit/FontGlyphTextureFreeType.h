@@ -32,6 +32,12 @@
 #include "RendererToolkit/IFontGlyphTexture.h"
 
 
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+typedef struct FT_FaceRec_ *FT_Face;
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -72,6 +78,8 @@ namespace RendererToolkit
 		*
 		*  @param[in]  fontTextureFreeType
 		*    Owner FreeType texture font
+		*  @param[in]  ftFace
+		*    FreeType library face object (aka "The Font") to render the glyph with, must be valid, FreeType face objects must not be used by multiple threads at the same time
 		*  @param[in]  characterCode
 		*    Character code
 		*  @param[in]  positionOffsetX
@@ -81,7 +89,7 @@ namespace RendererToolkit
 		*  @param[out] glyphTextureAtlasData
 		*    Pointer to the glyph texture atlas data to fill, must be valid! (data is not destroyed or cached inside this method)
 		*/
-		void initialize(FontTextureFreeType &fontTextureFreeType, unsigned long characterCode, unsigned int positionOffsetX, unsigned int positionOffsetY, unsigned char *glyphTextureAtlasData);
+		void initialize(FontTextureFreeType &fontTextureFreeType, FT_Face ftFace, unsigned long characterCode, unsigned int positionOffsetX, unsigned int positionOffsetY, unsigned char *glyphTextureAtlasData);
 
 		/**
 		*  @brief
@@ -30,6 +30,8 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RendererToolkit/IFontTexture.h"
+
+#include <Renderer/AllocatorObject.h>
 // [TODO] put in common header used by all
 #ifdef LINUX
 	// "override"-definition, see e.g. http://www2.research.att.com/~bs/C++0xFAQ.html#override (C++11 keyword is introduced in GCC 4.7 or clang 2.9)
@@ -68,7 +70,7 @@ namespace RendererToolkit
 	*  @brief
 	*    FreeType font texture class
 	*/
-	class FontTextureFreeType : public IFontTexture
+	class FontTextureFreeType : public IFontTexture, public Renderer::AllocatorObject<Renderer::AllocationTag::TOOLKIT>
 	{
 
 
@@ -130,6 +132,48 @@ namespace RendererToolkit
 		virtual void drawText(const char *text, const float *color, const float objectSpaceToClipSpace[16], float scaleX = 1.0f, float scaleY = 1.0f, float biasX = 0.0f, float biasY = 0.0f, unsigned int flags = 0) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static const unsigned int NUMBER_OF_GLYPHS		  = 256;	/**< Number of glyphs inside the glyph texture atlas */
+		static const unsigned int NUMBER_OF_GLYPHS_PER_ROW = 16;		/**< Number of glyphs per row inside the glyph texture atlas */
+		static const unsigned int NUMBER_OF_GLYPHS_PER_JOB = 64;		/**< Number of glyphs rendered by a single job, each job has to create an own FreeType face */
+
+		/**
+		*  @brief
+		*    Data of the jobs rendering the glyphs into the glyph texture atlas
+		*/
+		struct GlyphJobData
+		{
+			FontTextureFreeType *fontTextureFreeType;		/**< Owner FreeType texture font, always valid */
+			unsigned char		*glyphTextureAtlasData;		/**< Glyph texture atlas data to fill, always valid */
+			unsigned int		 distanceToNextGlyph;		/**< Distance (in pixel) between the positions of two neighbour glyphs inside the glyph texture atlas */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Job function rendering a range of glyphs into the glyph texture atlas
+		*
+		*  @param[in] data
+		*    "RendererToolkit::FontTextureFreeType::GlyphJobData" instance, must be valid
+		*  @param[in] firstElement
+		*    Character code of the first glyph to render
+		*  @param[in] lastElement
+		*    Character code after the character code of the last glyph to render
+		*
+		*  @remarks
+		*    FreeType library and face objects must not be used by multiple threads at the same time, so each job creates
+		*    its own FreeType library and face object by using the font file data which is shared read-only.
+		*/
+		static void renderGlyphsJob(void *data, unsigned int firstElement, unsigned int lastElement);
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <Renderer/AllocatorObject.h>
 #include <Renderer/SmartRefCount.h>
 
 
@@ -56,7 +57,7 @@ namespace RendererToolkit
 	*  @brief
 	*    FreeType context class
 	*/
-	class FreeTypeContext : public Renderer::RefCount<FreeTypeContext>
+	class FreeTypeContext : public Renderer::RefCount<FreeTypeContext>, public Renderer::AllocatorObject<Renderer::AllocationTag::TOOLKIT>
 	{
 
 
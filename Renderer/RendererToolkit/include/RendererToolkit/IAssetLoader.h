@@ -0,0 +1,290 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERERTOOLKIT_IASSETLOADER_H__
+#define __RENDERERTOOLKIT_IASSETLOADER_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/SmartRefCount.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Abstract asset loader interface
+	*
+	*  @remarks
+	*    An asset loader loads a batch of assets (e.g. meshes and textures) in two steps:
+	*    - The file I/O and the decoding into system memory is done by the worker threads of the job system of the
+	*      renderer toolkit, the assets are loaded in parallel
+	*    - The renderer resources are created by the thread calling "update()", usually the render thread once per frame,
+	*      only as many assets as fit into the given time budget are created so the frame rate stays stable while loading
+	*
+	*    The asset loader doesn't know anything about asset file formats, each request provides functions which are doing
+	*    the actual work. This way e.g. Assimp isn't a dependency of the renderer toolkit.
+	*
+	*    Usage:
+	*    1. Add the requests by using "addRequest()"
+	*    2. Start loading by using "start()", no further requests can be added
+	*    3. Each frame: "update()" until "isFinished()" returns "true", use "getProgress()" to show a progress bar
+	*/
+	class IAssetLoader : public Renderer::RefCount<IAssetLoader>
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Load function, called by a worker thread
+		*
+		*  @param[in] filename
+		*    ASCII filename of the asset to load, always valid
+		*  @param[in] data
+		*    The data given when adding the request
+		*
+		*  @return
+		*    The loaded asset in system memory, a null pointer on error
+		*
+		*  @note
+		*    - Load functions are executed concurrently, they must not access shared data without synchronization
+		*    - The renderer must not be used inside a load function
+		*/
+		typedef void *(*LoadFunction)(const char *filename, void *data);
+
+		/**
+		*  @brief
+		*    Create function, called by the thread calling "update()"
+		*
+		*  @param[in] loadedAsset
+		*    The asset returned by the load function, a null pointer if loading failed
+		*  @param[in] data
+		*    The data given when adding the request
+		*
+		*  @note
+		*    - Creates the renderer resources, the loaded asset is destroyed by using the destroy function afterwards
+		*/
+		typedef void (*CreateFunction)(void *loadedAsset, void *data);
+
+		/**
+		*  @brief
+		*    Destroy function
+		*
+		*  @param[in] loadedAsset
+		*    The asset returned by the load function, always valid
+		*  @param[in] data
+		*    The data given when adding the request
+		*
+		*  @note
+		*    - Also called for loaded assets which were never created because the asset loader was destroyed before
+		*/
+		typedef void (*DestroyFunction)(void *loadedAsset, void *data);
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline virtual ~IAssetLoader();
+
+		/**
+		*  @brief
+		*    Return the loading progress
+		*
+		*  @return
+		*    The loading progress between 0 and 1, loading and creating an asset count half each
+		*/
+		inline float getProgress() const;
+
+		/**
+		*  @brief
+		*    Return whether or not all requests are finished
+		*
+		*  @return
+		*    "true" if the renderer resources of all requests have been created, else "false"
+		*/
+		inline bool isFinished() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual IAssetLoader methods                   ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Add a request
+		*
+		*  @param[in] filename
+		*    ASCII filename of the asset to load, if null pointer or empty string the request is rejected, a copy is made
+		*  @param[in] loadFunction
+		*    Load function, must be valid
+		*  @param[in] createFunction
+		*    Create function, must be valid
+		*  @param[in] destroyFunction
+		*    Destroy function, must be valid
+		*  @param[in] data
+		*    Data to pass to the functions, can be a null pointer, must stay valid until the request is finished or the asset loader is destroyed
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (invalid parameters or loading was already started)
+		*/
+		virtual bool addRequest(const char *filename, LoadFunction loadFunction, CreateFunction createFunction, DestroyFunction destroyFunction, void *data) = 0;
+
+		/**
+		*  @brief
+		*    Return the number of requests
+		*
+		*  @return
+		*    The number of requests
+		*/
+		virtual unsigned int getNumberOfRequests() const = 0;
+
+		/**
+		*  @brief
+		*    Return the number of loaded requests
+		*
+		*  @return
+		*    The number of requests whose load function has been called, can be called while the worker threads are loading
+		*/
+		virtual unsigned int getNumberOfLoadedRequests() const = 0;
+
+		/**
+		*  @brief
+		*    Return the number of finished requests
+		*
+		*  @return
+		*    The number of requests whose create function has been called
+		*/
+		virtual unsigned int getNumberOfFinishedRequests() const = 0;
+
+		/**
+		*  @brief
+		*    Start loading the requests on the worker threads
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (loading was already started)
+		*/
+		virtual bool start() = 0;
+
+		/**
+		*  @brief
+		*    Create the renderer resources of loaded requests
+		*
+		*  @param[in] maximumMilliseconds
+		*    Time budget in milliseconds, at least one loaded request is finished per call in order to guarantee progress
+		*
+		*  @return
+		*    The number of requests finished by this call
+		*
+		*  @note
+		*    - Call this method once per frame by the thread the renderer resources should be created by
+		*    - In case the job system has no worker threads, the calling thread loads a single request per call
+		*/
+		virtual unsigned int update(float maximumMilliseconds) = 0;
+
+		/**
+		*  @brief
+		*    Load all requests and create their renderer resources right now
+		*
+		*  @note
+		*    - Starts loading if this wasn't done yet, the calling thread loads requests as well while waiting
+		*/
+		virtual void flush() = 0;
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		inline IAssetLoader();
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		inline explicit IAssetLoader(const IAssetLoader &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		inline IAssetLoader &operator =(const IAssetLoader &source);
+
+
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ Type definitions                                      ]
+	//[-------------------------------------------------------]
+	typedef Renderer::SmartRefCount<IAssetLoader> IAssetLoaderPtr;
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/IAssetLoader.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERERTOOLKIT_IASSETLOADER_H__
@@ -0,0 +1,95 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline IAssetLoader::~IAssetLoader()
+	{
+		// Nothing to do in here
+	}
+
+	/**
+	*  @brief
+	*    Return the loading progress
+	*/
+	inline float IAssetLoader::getProgress() const
+	{
+		const unsigned int numberOfRequests = getNumberOfRequests();
+		return (numberOfRequests > 0) ? static_cast<float>(getNumberOfLoadedRequests() + getNumberOfFinishedRequests()) / (2 * numberOfRequests) : 1.0f;
+	}
+
+	/**
+	*  @brief
+	*    Return whether or not all requests are finished
+	*/
+	inline bool IAssetLoader::isFinished() const
+	{
+		return (getNumberOfFinishedRequests() == getNumberOfRequests());
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Default constructor
+	*/
+	inline IAssetLoader::IAssetLoader()
+	{
+		// Nothing to do in here
+	}
+
+	/**
+	*  @brief
+	*    Copy constructor
+	*/
+	inline IAssetLoader::IAssetLoader(const IAssetLoader &)
+	{
+		// Not supported
+	}
+
+	/**
+	*  @brief
+	*    Copy operator
+	*/
+	inline IAssetLoader &IAssetLoader::operator =(const IAssetLoader &)
+	{
+		// Not supported
+		return *this;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
@@ -0,0 +1,243 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERERTOOLKIT_IJOBSYSTEM_H__
+#define __RENDERERTOOLKIT_IJOBSYSTEM_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/SmartRefCount.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Abstract job system interface
+	*
+	*  @remarks
+	*    The job system executes jobs on a fixed pool of worker threads. Each worker thread owns a job queue, it takes the
+	*    most recently added jobs from its own queue and steals the oldest jobs from the queues of the other worker threads
+	*    when running out of work. A job processes a range of elements, large ranges are recursively split into halves
+	*    while being executed so that idle worker threads can steal the other half.
+	*
+	*    Usage:
+	*    1. Create the jobs by using "createJob()"
+	*    2. Optional: Let jobs wait for other jobs by using "addDependency()"
+	*    3. Start the jobs by using "run()"
+	*    4. Wait for each created job by using "wait()", this also destroys the job
+	*
+	*    For the common case of processing a range of elements in parallel and waiting for the result there's "parallelFor()".
+	*
+	*  @note
+	*    - The job functions are executed concurrently, they must not access shared data without synchronization
+	*    - The job system itself can be used from multiple threads, also from within job functions
+	*/
+	class IJobSystem : public Renderer::RefCount<IJobSystem>
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Job function
+		*
+		*  @param[in] data
+		*    The data given when creating the job
+		*  @param[in] firstElement
+		*    Index of the first element to process
+		*  @param[in] lastElement
+		*    Index of the element after the last element to process, always greater than "firstElement"
+		*/
+		typedef void (*JobFunction)(void *data, unsigned int firstElement, unsigned int lastElement);
+
+		struct Job;	/**< Opaque job, created by "createJob()" and destroyed by "wait()" */
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline virtual ~IJobSystem();
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual IJobSystem methods                     ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return the number of worker threads
+		*
+		*  @return
+		*    The number of worker threads, can be zero in which case all jobs are executed by the threads calling "wait()"
+		*/
+		virtual unsigned int getNumberOfWorkerThreads() const = 0;
+
+		/**
+		*  @brief
+		*    Create a job
+		*
+		*  @param[in] function
+		*    Job function, must be valid
+		*  @param[in] data
+		*    Data to pass to the job function, can be a null pointer, must stay valid until the job is finished
+		*  @param[in] numberOfElements
+		*    Number of elements to process, the job function is never called if this is zero
+		*  @param[in] numberOfElementsPerJob
+		*    Maximum number of elements processed by a single job function call, zero to automatically split the elements across all worker threads
+		*
+		*  @return
+		*    The created job, a null pointer on error, each created job must be given to "wait()" exactly once
+		*
+		*  @note
+		*    - The job is not started until "run()" is called
+		*/
+		virtual Job *createJob(JobFunction function, void *data, unsigned int numberOfElements = 1, unsigned int numberOfElementsPerJob = 0) = 0;
+
+		/**
+		*  @brief
+		*    Let a job wait for another job
+		*
+		*  @param[in] job
+		*    Job which must not be started before "dependency" is finished, must not have been started yet
+		*  @param[in] dependency
+		*    Job the given job depends on, must not have been started yet
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (e.g. one of the jobs was already started or the maximum number of jobs depending on "dependency" was reached)
+		*/
+		virtual bool addDependency(Job &job, Job &dependency) = 0;
+
+		/**
+		*  @brief
+		*    Start a job
+		*
+		*  @param[in] job
+		*    Job to start, must not have been started yet, the job is executed as soon as all jobs it depends on are finished
+		*/
+		virtual void run(Job &job) = 0;
+
+		/**
+		*  @brief
+		*    Wait until a job is finished and destroy it
+		*
+		*  @param[in] job
+		*    Job to wait for, the job is started if this wasn't done yet, the job is destroyed and must no longer be used after this call
+		*
+		*  @note
+		*    - The calling thread executes jobs while waiting instead of blocking
+		*/
+		virtual void wait(Job &job) = 0;
+
+		/**
+		*  @brief
+		*    Process a range of elements in parallel and wait until all elements have been processed
+		*
+		*  @param[in] function
+		*    Job function, must be valid
+		*  @param[in] data
+		*    Data to pass to the job function, can be a null pointer
+		*  @param[in] numberOfElements
+		*    Number of elements to process
+		*  @param[in] numberOfElementsPerJob
+		*    Maximum number of elements processed by a single job function call, zero to automatically split the elements across all worker threads
+		*/
+		virtual void parallelFor(JobFunction function, void *data, unsigned int numberOfElements, unsigned int numberOfElementsPerJob = 0) = 0;
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		inline IJobSystem();
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		inline explicit IJobSystem(const IJobSystem &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		inline IJobSystem &operator =(const IJobSystem &source);
+
+
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ Type definitions                                      ]
+	//[-------------------------------------------------------]
+	typedef Renderer::SmartRefCount<IJobSystem> IJobSystemPtr;
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/IJobSystem.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERERTOOLKIT_IJOBSYSTEM_H__
@@ -0,0 +1,265 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERERTOOLKIT_IMESHBATCH_H__
+#define __RENDERERTOOLKIT_IMESHBATCH_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/SmartRefCount.h>
+#include <Renderer/RendererTypes.h>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class IProgram;
+	class IVertexArray;
+	struct VertexArrayAttribute;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Abstract mesh batch interface
+	*
+	*  @remarks
+	*    A mesh batch packs the vertices and indices of many meshes sharing the same vertex layout into a single vertex
+	*    megabuffer and a single 32-bit index megabuffer. Each mesh is drawn by using an own set of draw arguments pointing into
+	*    the megabuffers, so all meshes of a batch can be drawn by using a single "Renderer::IRenderer::multiDrawIndexedIndirect()"-call
+	*    instead of one "Renderer::IRenderer::iaSetVertexArray()", "Renderer::IRenderer::iaSetPrimitiveTopology()" and
+	*    "Renderer::IRenderer::drawIndexed()" triple per mesh.
+	*
+	*    Usage:
+	*    1. Add the meshes by using "addMesh()"
+	*    2. Create the vertex array by using "createVertexArray()", this uploads the megabuffers and no further meshes can be added
+	*    3. Each frame: "clearDraws()", "addDraw()" for each visible mesh and finally "draw()"
+	*/
+	class IMeshBatch : public Renderer::RefCount<IMeshBatch>
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline virtual ~IMeshBatch();
+
+		/**
+		*  @brief
+		*    Return the number of bytes per vertex
+		*
+		*  @return
+		*    The number of bytes per vertex, identical for all meshes within the batch
+		*/
+		inline unsigned int getNumberOfBytesPerVertex() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual IMeshBatch methods                     ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Add a mesh to the batch
+		*
+		*  @param[in] vertexData
+		*    Vertex data, must be valid, must hold at least "numberOfVertices" times "getNumberOfBytesPerVertex()" bytes, the data is internally copied
+		*  @param[in] numberOfVertices
+		*    Number of vertices, must be valid
+		*  @param[in] indices
+		*    32-bit indices relative to the first vertex of this mesh, must be valid, the data is internally copied
+		*  @param[in] numberOfIndices
+		*    Number of indices, must be valid
+		*
+		*  @return
+		*    The index of the added mesh, "~0u" on error (e.g. invalid data or the vertex array was already created)
+		*/
+		virtual unsigned int addMesh(const void *vertexData, unsigned int numberOfVertices, const unsigned int *indices, unsigned int numberOfIndices) = 0;
+
+		/**
+		*  @brief
+		*    Return the number of meshes within the batch
+		*
+		*  @return
+		*    The number of meshes within the batch
+		*/
+		virtual unsigned int getNumberOfMeshes() const = 0;
+
+		/**
+		*  @brief
+		*    Create the megabuffers and the vertex array used to draw the batch
+		*
+		*  @param[in] program
+		*    Program the vertex array is created for
+		*  @param[in] numberOfAttributes
+		*    Number of attributes (position, color, texture coordinate, normal...)
+		*  @param[in] attributes
+		*    At least "numberOfAttributes" instances of vertex array attributes, attributes with a null pointer vertex buffer are sourced from the vertex megabuffer
+		*
+		*  @return
+		*    The created vertex array instance, null pointer on error, do not release the returned instance unless you added an own reference to it
+		*
+		*  @note
+		*    - After this call no further meshes can be added
+		*    - Calling this method a second time releases the previous vertex array, the megabuffers are reused
+		*/
+		virtual Renderer::IVertexArray *createVertexArray(Renderer::IProgram &program, unsigned int numberOfAttributes, const Renderer::VertexArrayAttribute *attributes) = 0;
+
+		/**
+		*  @brief
+		*    Remove all draws added by using "addDraw()"
+		*/
+		virtual void clearDraws() = 0;
+
+		/**
+		*  @brief
+		*    Add a draw of a mesh
+		*
+		*  @param[in] meshIndex
+		*    Index of the mesh to draw, as returned by "addMesh()"
+		*  @param[in] numberOfInstances
+		*    Number of instances to draw
+		*  @param[in] startInstanceLocation
+		*    Value added to the instance ID before reading per-instance data, only honored if "Renderer::Capabilities::multiDrawIndirect" is true
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (invalid mesh index)
+		*/
+		virtual bool addDraw(unsigned int meshIndex, unsigned int numberOfInstances = 1, unsigned int startInstanceLocation = 0) = 0;
+
+		/**
+		*  @brief
+		*    Return the number of draws added by using "addDraw()"
+		*
+		*  @return
+		*    The number of draws
+		*/
+		virtual unsigned int getNumberOfDraws() const = 0;
+
+		/**
+		*  @brief
+		*    Draw added draws by using a single multi-draw indexed indirect call
+		*
+		*  @param[in] primitiveTopology
+		*    Primitive topology used for all draws
+		*  @param[in] firstDraw
+		*    Index of the first draw to draw, as added by using "addDraw()"
+		*  @param[in] numberOfDraws
+		*    Number of draws to draw, clamped to the number of added draws, "~0u" for all draws starting at "firstDraw"
+		*
+		*  @note
+		*    - Sets the vertex array and the primitive topology, the program and other states have to be set by the caller
+		*    - The indirect buffer is only updated if the draws were changed since the previous "draw()"-call
+		*    - Drawing ranges of the draws is meant for draws which need different states in between, the draws of all
+		*      ranges should still be added at once so the indirect buffer is only updated once
+		*/
+		virtual void draw(Renderer::PrimitiveTopology::Enum primitiveTopology = Renderer::PrimitiveTopology::TRIANGLE_LIST, unsigned int firstDraw = 0, unsigned int numberOfDraws = ~0u) = 0;
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] numberOfBytesPerVertex
+		*    Number of bytes per vertex
+		*/
+		inline explicit IMeshBatch(unsigned int numberOfBytesPerVertex);
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		inline explicit IMeshBatch(const IMeshBatch &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		inline IMeshBatch &operator =(const IMeshBatch &source);
+
+
+	//[-------------------------------------------------------]
+	//[ Protected data                                        ]
+	//[-------------------------------------------------------]
+	protected:
+		unsigned int mNumberOfBytesPerVertex;	/**< Number of bytes per vertex */
+
+
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ Type definitions                                      ]
+	//[-------------------------------------------------------]
+	typedef Renderer::SmartRefCount<IMeshBatch> IMeshBatchPtr;
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/IMeshBatch.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERERTOOLKIT_IMESHBATCH_H__
@@ -43,6 +43,9 @@ namespace Renderer
 namespace RendererToolkit
 {
 	class IFont;
+	class IJobSystem;
+	class IAssetLoader;
+	class IMeshBatch;
 }
 
 
@@ -104,6 +107,49 @@ namespace RendererToolkit
 		*/
 		virtual IFont *createFontTexture(const char *filename, unsigned int size = 12, unsigned int resolution = 96) = 0;
 
+		/**
+		*  @brief
+		*    Create a mesh batch instance
+		*
+		*  @param[in] numberOfBytesPerVertex
+		*    Number of bytes per vertex, identical for all meshes within the batch, if zero a null pointer will be returned
+		*
+		*  @return
+		*    The created mesh batch instance, a null pointer on error. Release the returned instance if you no longer need it.
+		*
+		*  @see
+		*    - "RendererToolkit::IMeshBatch"
+		*/
+		virtual IMeshBatch *createMeshBatch(unsigned int numberOfBytesPerVertex) = 0;
+
+		/**
+		*  @brief
+		*    Return the job system instance
+		*
+		*  @return
+		*    The job system instance, do not release the returned instance unless you added an own reference to it
+		*
+		*  @note
+		*    - The job system instance is created by using lazy evaluation, meaning that the instance and its worker threads are created the first time it's required
+		*    - The first call must not be done concurrently with other calls
+		*
+		*  @see
+		*    - "RendererToolkit::IJobSystem"
+		*/
+		virtual IJobSystem &getJobSystem() = 0;
+
+		/**
+		*  @brief
+		*    Create an asset loader instance
+		*
+		*  @return
+		*    The created asset loader instance, a null pointer on error. Release the returned instance if you no longer need it.
+		*
+		*  @see
+		*    - "RendererToolkit::IAssetLoader"
+		*/
+		virtual IAssetLoader *createAssetLoader() = 0;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -0,0 +1,275 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERERTOOLKIT_JOBSYSTEM_H__
+#define __RENDERERTOOLKIT_JOBSYSTEM_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/IJobSystem.h"
+
+#include <Renderer/AllocatorObject.h>
+#include <Renderer/PlatformTypes.h>
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class IRenderer;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Work-stealing job system class
+	*
+	*  @remarks
+	*    There's one job queue per worker thread plus one job queue for the threads which are not worker threads (e.g. the
+	*    main thread). Jobs started by using "run()" and jobs whose dependencies were finished by a non worker thread are
+	*    added to the latter. Each job queue is protected by an own mutex which is only held for pushing or popping a single
+	*    job pointer, so there's nearly no contention. Idle worker threads sleep until new jobs are queued.
+	*/
+	class JobSystem : public IJobSystem, public Renderer::AllocatorObject<Renderer::AllocationTag::TOOLKIT>
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] renderer
+		*    Renderer instance to use, the jobs are allocated by using the allocator of this renderer instance
+		*
+		*  @note
+		*    - The job system keeps a reference to the provided renderer instance
+		*    - Starts one worker thread per hardware thread except for one, the thread waiting for jobs is executing jobs as well
+		*/
+		explicit JobSystem(Renderer::IRenderer &renderer);
+
+		/**
+		*  @brief
+		*    Destructor
+		*
+		*  @note
+		*    - All jobs must have been waited for before the job system is destroyed
+		*/
+		virtual ~JobSystem();
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual RendererToolkit::IJobSystem methods    ]
+	//[-------------------------------------------------------]
+	public:
+		inline virtual unsigned int getNumberOfWorkerThreads() const override;
+		virtual Job *createJob(JobFunction function, void *data, unsigned int numberOfElements = 1, unsigned int numberOfElementsPerJob = 0) override;
+		virtual bool addDependency(Job &job, Job &dependency) override;
+		virtual void run(Job &job) override;
+		virtual void wait(Job &job) override;
+		virtual void parallelFor(JobFunction function, void *data, unsigned int numberOfElements, unsigned int numberOfElementsPerJob = 0) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static const unsigned int MAXIMUM_NUMBER_OF_WORKER_THREADS = 63;	/**< Maximum number of worker threads */
+		static const unsigned int NUMBER_OF_JOBS_PER_THREAD		   = 4;		/**< Number of jobs per thread used when automatically splitting elements, more jobs than threads balance uneven workloads */
+
+		struct JobQueue;
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Worker thread function
+		*
+		*  @param[in] jobSystem
+		*    Owner job system instance
+		*  @param[in] jobQueueIndex
+		*    Index of the job queue owned by the worker thread
+		*/
+		static void workerThreadFunction(JobSystem *jobSystem, unsigned int jobQueueIndex);
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		inline explicit JobSystem(const JobSystem &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		inline JobSystem &operator =(const JobSystem &source);
+
+		/**
+		*  @brief
+		*    Allocate and construct a job
+		*
+		*  @param[in] function
+		*    Job function, must be valid
+		*  @param[in] data
+		*    Data to pass to the job function, can be a null pointer
+		*  @param[in] firstElement
+		*    Index of the first element to process
+		*  @param[in] lastElement
+		*    Index of the element after the last element to process
+		*  @param[in] numberOfElementsPerJob
+		*    Maximum number of elements processed by a single job function call, must be valid
+		*  @param[in] parentJob
+		*    Parent job which isn't finished before this job is finished, null pointer for a job created by using "createJob()"
+		*
+		*  @return
+		*    The created job, a null pointer on error
+		*/
+		Job *allocateJob(JobFunction function, void *data, unsigned int firstElement, unsigned int lastElement, unsigned int numberOfElementsPerJob, Job *parentJob);
+
+		/**
+		*  @brief
+		*    Destruct and free a job
+		*
+		*  @param[in] job
+		*    Job to destroy
+		*/
+		void freeJob(Job &job);
+
+		/**
+		*  @brief
+		*    Add a job to a job queue and wake up a sleeping worker thread
+		*
+		*  @param[in] jobQueueIndex
+		*    Index of the job queue to add the job to
+		*  @param[in] job
+		*    Job to add, all jobs it depends on must be finished
+		*/
+		void pushJob(unsigned int jobQueueIndex, Job &job);
+
+		/**
+		*  @brief
+		*    Get a job to execute
+		*
+		*  @param[in] jobQueueIndex
+		*    Index of the job queue owned by the calling thread
+		*
+		*  @return
+		*    The most recently added job of the owned job queue, if it's empty the oldest job stolen from another job queue, a null pointer if there are no jobs
+		*/
+		Job *popJob(unsigned int jobQueueIndex);
+
+		/**
+		*  @brief
+		*    Execute a job
+		*
+		*  @param[in] job
+		*    Job to execute
+		*  @param[in] jobQueueIndex
+		*    Index of the job queue owned by the calling thread, receives the jobs split off from the given job
+		*/
+		void executeJob(Job &job, unsigned int jobQueueIndex);
+
+		/**
+		*  @brief
+		*    Mark a job or one of its child jobs as finished
+		*
+		*  @param[in] job
+		*    Job to mark as finished
+		*  @param[in] jobQueueIndex
+		*    Index of the job queue owned by the calling thread, receives the jobs which are ready to be executed now
+		*/
+		void finishJob(Job &job, unsigned int jobQueueIndex);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Renderer::IRenderer		   *mRenderer;					/**< The used renderer instance (we keep a reference to it), always valid */
+		unsigned int				mNumberOfWorkerThreads;		/**< Number of worker threads */
+		JobQueue				   *mJobQueues;					/**< Job queues, the first one is used by threads which are not worker threads, followed by one job queue per worker thread, always valid */
+		std::thread				   *mWorkerThreads;				/**< Worker threads, can be a null pointer */
+		std::atomic<unsigned int>	mNumberOfQueuedJobs;		/**< Number of jobs inside all job queues */
+		std::atomic<bool>			mShutdown;					/**< Shall the worker threads shut down? */
+		std::mutex					mWakeUpMutex;				/**< Mutex used together with "mWakeUpConditionVariable" */
+		std::condition_variable		mWakeUpConditionVariable;	/**< Condition variable sleeping worker threads are waiting for */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/JobSystem.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERERTOOLKIT_JOBSYSTEM_H__
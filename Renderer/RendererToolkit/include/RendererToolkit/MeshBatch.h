@@ -0,0 +1,206 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERERTOOLKIT_MESHBATCH_H__
+#define __RENDERERTOOLKIT_MESHBATCH_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/IMeshBatch.h"
+
+#include <Renderer/AllocatorObject.h>
+// [TODO] put in common header used by all
+#ifdef LINUX
+	// "override"-definition, see e.g. http://www2.research.att.com/~bs/C++0xFAQ.html#override (C++11 keyword is introduced in GCC 4.7 or clang 2.9)
+	#if ((__GNUC__ < 4 || __GNUC_MINOR__ < 7) && !defined(__clang__))
+		#define override
+	#endif
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class IIndexBuffer;
+	class IVertexBuffer;
+	class IIndirectBuffer;
+	struct DrawIndexedInstancedArguments;
+}
+namespace RendererToolkit
+{
+	class RendererToolkitImpl;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Mesh batch class packing meshes into shared vertex and index megabuffers
+	*/
+	class MeshBatch : public IMeshBatch, public Renderer::AllocatorObject<Renderer::AllocationTag::TOOLKIT>
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] rendererToolkitImpl
+		*    Renderer toolkit implementation instance to use
+		*  @param[in] numberOfBytesPerVertex
+		*    Number of bytes per vertex, must be valid
+		*
+		*  @note
+		*    - The mesh batch instance keeps a reference to the provided renderer toolkit implementation instance
+		*/
+		MeshBatch(RendererToolkitImpl &rendererToolkitImpl, unsigned int numberOfBytesPerVertex);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~MeshBatch();
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual RendererToolkit::IMeshBatch methods    ]
+	//[-------------------------------------------------------]
+	public:
+		virtual unsigned int addMesh(const void *vertexData, unsigned int numberOfVertices, const unsigned int *indices, unsigned int numberOfIndices) override;
+		inline virtual unsigned int getNumberOfMeshes() const override;
+		virtual Renderer::IVertexArray *createVertexArray(Renderer::IProgram &program, unsigned int numberOfAttributes, const Renderer::VertexArrayAttribute *attributes) override;
+		inline virtual void clearDraws() override;
+		virtual bool addDraw(unsigned int meshIndex, unsigned int numberOfInstances = 1, unsigned int startInstanceLocation = 0) override;
+		inline virtual unsigned int getNumberOfDraws() const override;
+		virtual void draw(Renderer::PrimitiveTopology::Enum primitiveTopology = Renderer::PrimitiveTopology::TRIANGLE_LIST, unsigned int firstDraw = 0, unsigned int numberOfDraws = ~0u) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Location of a mesh within the megabuffers
+		*/
+		struct Mesh
+		{
+			unsigned int startIndexLocation;	/**< First index of the mesh within the index megabuffer */
+			unsigned int numberOfIndices;		/**< Number of indices of the mesh */
+			unsigned int baseVertexLocation;	/**< First vertex of the mesh within the vertex megabuffer */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		inline MeshBatch();
+
+		/**
+		*  @brief
+		*    Grow a system memory array so it can hold at least the given number of bytes
+		*
+		*  @param[in, out] data
+		*    Data to grow, can be a null pointer, the data is preserved
+		*  @param[in, out] capacity
+		*    Current capacity in bytes, receives the new capacity
+		*  @param[in] numberOfBytes
+		*    Required number of bytes
+		*
+		*  @note
+		*    - The data is allocated by using the allocator of the used renderer
+		*/
+		void growArray(unsigned char *&data, unsigned int &capacity, unsigned int numberOfBytes);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		RendererToolkitImpl		  *mRendererToolkitImpl;		/**< The used renderer toolkit implementation instance (we keep a reference to it), always valid */
+		// Megabuffer source data, released as soon as the megabuffers were created
+		unsigned char			  *mVertexData;					/**< System memory vertex data, can be a null pointer */
+		unsigned int			   mVertexDataCapacity;			/**< Capacity of "mVertexData" in bytes */
+		unsigned int			   mNumberOfVertices;			/**< Total number of vertices of all meshes */
+		unsigned char			  *mIndexData;					/**< System memory 32-bit index data, can be a null pointer */
+		unsigned int			   mIndexDataCapacity;			/**< Capacity of "mIndexData" in bytes */
+		unsigned int			   mNumberOfIndices;			/**< Total number of indices of all meshes */
+		// Meshes
+		unsigned char			  *mMeshes;						/**< Array of "RendererToolkit::MeshBatch::Mesh" instances, can be a null pointer */
+		unsigned int			   mMeshesCapacity;				/**< Capacity of "mMeshes" in bytes */
+		unsigned int			   mNumberOfMeshes;				/**< Number of meshes */
+		// Draws
+		unsigned char			  *mDraws;						/**< Array of "Renderer::DrawIndexedInstancedArguments" instances, can be a null pointer */
+		unsigned int			   mDrawsCapacity;				/**< Capacity of "mDraws" in bytes */
+		unsigned int			   mNumberOfDraws;				/**< Number of draws */
+		bool					   mDrawsDirty;					/**< Were the draws changed since the indirect buffer was updated the last time? */
+		// Renderer resources
+		Renderer::IVertexBuffer	  *mVertexBuffer;				/**< Vertex megabuffer (we keep a reference to it), can be a null pointer */
+		Renderer::IIndexBuffer	  *mIndexBuffer;				/**< 32-bit index megabuffer (we keep a reference to it), can be a null pointer */
+		Renderer::IVertexArray	  *mVertexArray;				/**< Vertex array object (VAO, we keep a reference to it), can be a null pointer */
+		Renderer::IIndirectBuffer *mIndirectBuffer;				/**< Indirect buffer holding the draw arguments (we keep a reference to it), can be a null pointer */
+		unsigned int			   mIndirectBufferCapacity;		/**< Capacity of "mIndirectBuffer" in bytes */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/MeshBatch.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERERTOOLKIT_MESHBATCH_H__
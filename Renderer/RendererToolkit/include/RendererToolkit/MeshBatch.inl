@@ -0,0 +1,84 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual RendererToolkit::IMeshBatch methods    ]
+	//[-------------------------------------------------------]
+	inline unsigned int MeshBatch::getNumberOfMeshes() const
+	{
+		return mNumberOfMeshes;
+	}
+
+	inline void MeshBatch::clearDraws()
+	{
+		mNumberOfDraws = 0;
+		mDrawsDirty = true;
+	}
+
+	inline unsigned int MeshBatch::getNumberOfDraws() const
+	{
+		return mNumberOfDraws;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Default constructor
+	*/
+	inline MeshBatch::MeshBatch() :
+		IMeshBatch(0),
+		mRendererToolkitImpl(nullptr),
+		mVertexData(nullptr),
+		mVertexDataCapacity(0),
+		mNumberOfVertices(0),
+		mIndexData(nullptr),
+		mIndexDataCapacity(0),
+		mNumberOfIndices(0),
+		mMeshes(nullptr),
+		mMeshesCapacity(0),
+		mNumberOfMeshes(0),
+		mDraws(nullptr),
+		mDrawsCapacity(0),
+		mNumberOfDraws(0),
+		mDrawsDirty(false),
+		mVertexBuffer(nullptr),
+		mIndexBuffer(nullptr),
+		mVertexArray(nullptr),
+		mIndirectBuffer(nullptr),
+		mIndirectBufferCapacity(0)
+	{
+		// Nothing to do in here
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
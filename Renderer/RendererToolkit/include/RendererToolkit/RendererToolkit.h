@@ -46,6 +46,9 @@ namespace RendererToolkit
 	//[ Forward declarations                                  ]
 	//[-------------------------------------------------------]
 	class IFont;
+	class IJobSystem;
+	class IAssetLoader;
+	class IMeshBatch;
 	class IRendererToolkit;
 
 
@@ -63,6 +66,9 @@ namespace RendererToolkit
 		}
 	public:
 		virtual IFont *createFontTexture(const char *filename, unsigned int size = 12, unsigned int resolution = 96) = 0;
+		virtual IMeshBatch *createMeshBatch(unsigned int numberOfBytesPerVertex) = 0;
+		virtual IJobSystem &getJobSystem() = 0;
+		virtual IAssetLoader *createAssetLoader() = 0;
 	protected:
 		IRendererToolkit();
 		explicit IRendererToolkit(const IRendererToolkit &source);
@@ -119,6 +125,87 @@ namespace RendererToolkit
 	};
 	typedef Renderer::SmartRefCount<IFont> IFontPtr;
 
+	// RendererToolkit/IMeshBatch.h
+	class IMeshBatch : public Renderer::RefCount<IMeshBatch>
+	{
+	public:
+		virtual ~IMeshBatch();
+		inline unsigned int getNumberOfBytesPerVertex() const
+		{
+			return mNumberOfBytesPerVertex;
+		}
+	public:
+		virtual unsigned int addMesh(const void *vertexData, unsigned int numberOfVertices, const unsigned int *indices, unsigned int numberOfIndices) = 0;
+		virtual unsigned int getNumberOfMeshes() const = 0;
+		virtual Renderer::IVertexArray *createVertexArray(Renderer::IProgram &program, unsigned int numberOfAttributes, const Renderer::VertexArrayAttribute *attributes) = 0;
+		virtual void clearDraws() = 0;
+		virtual bool addDraw(unsigned int meshIndex, unsigned int numberOfInstances = 1, unsigned int startInstanceLocation = 0) = 0;
+		virtual unsigned int getNumberOfDraws() const = 0;
+		virtual void draw(Renderer::PrimitiveTopology::Enum primitiveTopology = Renderer::PrimitiveTopology::TRIANGLE_LIST, unsigned int firstDraw = 0, unsigned int numberOfDraws = ~0u) = 0;
+	protected:
+		explicit IMeshBatch(unsigned int numberOfBytesPerVertex);
+		explicit IMeshBatch(const IMeshBatch &source);
+		IMeshBatch &operator =(const IMeshBatch &source);
+	protected:
+		unsigned int mNumberOfBytesPerVertex;
+	};
+	typedef Renderer::SmartRefCount<IMeshBatch> IMeshBatchPtr;
+
+	// RendererToolkit/IJobSystem.h
+	class IJobSystem : public Renderer::RefCount<IJobSystem>
+	{
+	public:
+		typedef void (*JobFunction)(void *data, unsigned int firstElement, unsigned int lastElement);
+		struct Job;
+	public:
+		virtual ~IJobSystem();
+	public:
+		virtual unsigned int getNumberOfWorkerThreads() const = 0;
+		virtual Job *createJob(JobFunction function, void *data, unsigned int numberOfElements = 1, unsigned int numberOfElementsPerJob = 0) = 0;
+		virtual bool addDependency(Job &job, Job &dependency) = 0;
+		virtual void run(Job &job) = 0;
+		virtual void wait(Job &job) = 0;
+		virtual void parallelFor(JobFunction function, void *data, unsigned int numberOfElements, unsigned int numberOfElementsPerJob = 0) = 0;
+	protected:
+		IJobSystem();
+		explicit IJobSystem(const IJobSystem &source);
+		IJobSystem &operator =(const IJobSystem &source);
+	};
+	typedef Renderer::SmartRefCount<IJobSystem> IJobSystemPtr;
+
+	// RendererToolkit/IAssetLoader.h
+	class IAssetLoader : public Renderer::RefCount<IAssetLoader>
+	{
+	public:
+		typedef void *(*LoadFunction)(const char *filename, void *data);
+		typedef void (*CreateFunction)(void *loadedAsset, void *data);
+		typedef void (*DestroyFunction)(void *loadedAsset, void *data);
+	public:
+		virtual ~IAssetLoader();
+		inline float getProgress() const
+		{
+			const unsigned int numberOfRequests = getNumberOfRequests();
+			return (numberOfRequests > 0) ? static_cast<float>(getNumberOfLoadedRequests() + getNumberOfFinishedRequests()) / (2 * numberOfRequests) : 1.0f;
+		}
+		inline bool isFinished() const
+		{
+			return (getNumberOfFinishedRequests() == getNumberOfRequests());
+		}
+	public:
+		virtual bool addRequest(const char *filename, LoadFunction loadFunction, CreateFunction createFunction, DestroyFunction destroyFunction, void *data) = 0;
+		virtual unsigned int getNumberOfRequests() const = 0;
+		virtual unsigned int getNumberOfLoadedRequests() const = 0;
+		virtual unsigned int getNumberOfFinishedRequests() const = 0;
+		virtual bool start() = 0;
+		virtual unsigned int update(float maximumMilliseconds) = 0;
+		virtual void flush() = 0;
+	protected:
+		IAssetLoader();
+		explicit IAssetLoader(const IAssetLoader &source);
+		IAssetLoader &operator =(const IAssetLoader &source);
+	};
+	typedef Renderer::SmartRefCount<IAssetLoader> IAssetLoaderPtr;
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
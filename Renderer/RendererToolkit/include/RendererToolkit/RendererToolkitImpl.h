@@ -31,6 +31,8 @@
 //[-------------------------------------------------------]
 #include "RendererToolkit/IRendererToolkit.h"
 
+#include <Renderer/AllocatorObject.h>
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -45,6 +47,7 @@ namespace Renderer
 }
 namespace RendererToolkit
 {
+	class JobSystem;
 	class FreeTypeContext;
 }
 
@@ -63,7 +66,7 @@ namespace RendererToolkit
 	*  @brief
 	*    Renderer toolkit class implementation
 	*/
-	class RendererToolkitImpl : public IRendererToolkit
+	class RendererToolkitImpl : public IRendererToolkit, public Renderer::AllocatorObject<Renderer::AllocationTag::TOOLKIT>
 	{
 
 
@@ -179,6 +182,9 @@ namespace RendererToolkit
 	//[-------------------------------------------------------]
 	public:
 		virtual IFont *createFontTexture(const char *filename, unsigned int size = 12, unsigned int resolution = 96) override;
+		virtual IMeshBatch *createMeshBatch(unsigned int numberOfBytesPerVertex) override;
+		virtual IJobSystem &getJobSystem() override;
+		virtual IAssetLoader *createAssetLoader() override;
 
 
 	//[-------------------------------------------------------]
@@ -212,6 +218,7 @@ namespace RendererToolkit
 	//[-------------------------------------------------------]
 	private:
 		FreeTypeContext			 *mFreeTypeContext;					/**< FreeType context instance (we keep a reference to it), can be a null pointer, do only access it by using "getFreeTypeContext()" */
+		JobSystem				 *mJobSystem;						/**< Job system instance (we keep a reference to it), can be a null pointer, do only access it by using "getJobSystem()" */
 		Renderer::IProgram		 *mFontProgram;						/**< Font program (we keep a reference to it), can be a null pointer, do only access it by using "getFontProgram()" */
 		Renderer::IUniformBuffer *mFontVertexShaderUniformBuffer;	/**< Font vertex shader uniform buffer (we keep a reference to it), can be a null pointer, do only access it by using "getFontVertexShaderUniformBuffer()" */
 		Renderer::IUniformBuffer *mFontFragmentShaderUniformBuffer;	/**< Font fragment shader uniform buffer (we keep a reference to it), can be a null pointer, do only access it by using "getFontFragmentShaderUniformBuffer()" */
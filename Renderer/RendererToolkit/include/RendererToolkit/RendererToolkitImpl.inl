@@ -34,6 +34,7 @@ namespace RendererToolkit
 	*/
 	inline RendererToolkitImpl::RendererToolkitImpl(const RendererToolkitImpl &) :
 		mFreeTypeContext(nullptr),
+		mJobSystem(nullptr),
 		mFontProgram(nullptr),
 		mFontVertexArray(nullptr),
 		mFontSamplerState(nullptr)
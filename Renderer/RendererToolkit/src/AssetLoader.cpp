@@ -0,0 +1,275 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/AssetLoader.h"
+#include "RendererToolkit/RendererToolkitImpl.h"
+
+#include <Renderer/IRenderer.h>
+
+#include <chrono>	// For measuring the time budget of "update()"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	AssetLoader::AssetLoader(RendererToolkitImpl &rendererToolkitImpl) :
+		mRendererToolkitImpl(&rendererToolkitImpl),
+		mRequests(Requests::allocator_type(rendererToolkitImpl.getRenderer().getAllocator(), Renderer::AllocationTag::TOOLKIT)),
+		mJob(nullptr),
+		mStarted(false),
+		mCancelled(false),
+		mNextRequestIndex(0),
+		mNumberOfLoadedRequests(0),
+		mNumberOfFinishedRequests(0),
+		mLoadedRequests(RequestIndices::allocator_type(rendererToolkitImpl.getRenderer().getAllocator(), Renderer::AllocationTag::TOOLKIT))
+	{
+		// Add our renderer toolkit implementation reference
+		mRendererToolkitImpl->addReference();
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	AssetLoader::~AssetLoader()
+	{
+		// Skip the requests which were not loaded yet and wait for the requests which are currently loaded
+		mCancelled = true;
+		waitForJob();
+
+		// Destroy the loaded assets which were never created
+		const size_t numberOfRequests = mRequests.size();
+		for (size_t i = 0; i < numberOfRequests; ++i)
+		{
+			Request &request = mRequests[i];
+			if (nullptr != request.loadedAsset)
+			{
+				request.destroyFunction(request.loadedAsset, request.data);
+			}
+		}
+
+		// Release our renderer toolkit implementation reference
+		mRendererToolkitImpl->release();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual RendererToolkit::IAssetLoader methods  ]
+	//[-------------------------------------------------------]
+	bool AssetLoader::addRequest(const char *filename, LoadFunction loadFunction, CreateFunction createFunction, DestroyFunction destroyFunction, void *data)
+	{
+		// Check the given parameters, the requests must not be changed while the worker threads are loading
+		if (nullptr == filename || '\0' == filename[0] || nullptr == loadFunction || nullptr == createFunction || nullptr == destroyFunction || mStarted)
+		{
+			// Error!
+			return false;
+		}
+
+		// Add the request, the filename is using the allocator of the requests
+		const Request request = { String(filename, mRequests.get_allocator()), loadFunction, createFunction, destroyFunction, data, nullptr };
+		mRequests.push_back(request);
+
+		// Done
+		return true;
+	}
+
+	bool AssetLoader::start()
+	{
+		if (mStarted)
+		{
+			// Error!
+			return false;
+		}
+		mStarted = true;
+
+		// Create and start the job loading the requests, one element per request so each request can be loaded by another worker thread
+		// -> In case the job can't be created, the requests are loaded by "update()" and "flush()"
+		if (!mRequests.empty())
+		{
+			IJobSystem &jobSystem = mRendererToolkitImpl->getJobSystem();
+			mJob = jobSystem.createJob(&AssetLoader::loadJob, this, static_cast<unsigned int>(mRequests.size()), 1);
+			if (nullptr != mJob)
+			{
+				jobSystem.run(*mJob);
+			}
+		}
+
+		// Done
+		return true;
+	}
+
+	unsigned int AssetLoader::update(float maximumMilliseconds)
+	{
+		if (!mStarted)
+		{
+			return 0;
+		}
+
+		// In case there are no worker threads, the job is only executed when it's waited for, load a single request per call instead
+		if (nullptr == mJob || 0 == mRendererToolkitImpl->getJobSystem().getNumberOfWorkerThreads())
+		{
+			loadNextRequest();
+		}
+
+		// Finish loaded requests until the time budget is used up, at least one request is finished per call
+		const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+		unsigned int numberOfFinishedRequests = 0;
+		while (finishNextRequest())
+		{
+			++numberOfFinishedRequests;
+			if (std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count() >= maximumMilliseconds)
+			{
+				break;
+			}
+		}
+
+		// Destroy the job as soon as all requests are finished, at this point the job is finished as well
+		if (isFinished())
+		{
+			waitForJob();
+		}
+
+		// Done
+		return numberOfFinishedRequests;
+	}
+
+	void AssetLoader::flush()
+	{
+		// Start loading in case this wasn't done yet
+		if (!mStarted)
+		{
+			start();
+		}
+
+		// Wait until all requests are loaded, the calling thread loads requests as well
+		waitForJob();
+		while (loadNextRequest())
+		{
+			// Nothing to do in here, only required in case the job couldn't be created
+		}
+
+		// Finish all loaded requests
+		while (finishNextRequest())
+		{
+			// Nothing to do in here
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	void AssetLoader::loadJob(void *data, unsigned int firstElement, unsigned int lastElement)
+	{
+		AssetLoader *assetLoader = static_cast<AssetLoader*>(data);
+		for (unsigned int i = firstElement; i < lastElement; ++i)
+		{
+			assetLoader->loadNextRequest();
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	bool AssetLoader::loadNextRequest()
+	{
+		// Claim the next request, the job function and "update()" may compete for it
+		if (mCancelled)
+		{
+			return false;
+		}
+		const unsigned int requestIndex = mNextRequestIndex++;
+		if (requestIndex >= mRequests.size())
+		{
+			return false;
+		}
+
+		// Load the request
+		Request &request = mRequests[requestIndex];
+		request.loadedAsset = request.loadFunction(request.filename.c_str(), request.data);
+
+		// Hand the request over to "update()"
+		{
+			std::lock_guard<std::mutex> lock(mLoadedRequestsMutex);
+			mLoadedRequests.push_back(requestIndex);
+		}
+		++mNumberOfLoadedRequests;
+
+		// Done
+		return true;
+	}
+
+	bool AssetLoader::finishNextRequest()
+	{
+		// Get the oldest loaded request
+		unsigned int requestIndex = 0;
+		{
+			std::lock_guard<std::mutex> lock(mLoadedRequestsMutex);
+			if (mLoadedRequests.empty())
+			{
+				return false;
+			}
+			requestIndex = mLoadedRequests.front();
+			mLoadedRequests.pop_front();
+		}
+
+		// Create the renderer resources and destroy the loaded asset, the create function is also informed about failed requests
+		Request &request = mRequests[requestIndex];
+		request.createFunction(request.loadedAsset, request.data);
+		if (nullptr != request.loadedAsset)
+		{
+			request.destroyFunction(request.loadedAsset, request.data);
+			request.loadedAsset = nullptr;
+		}
+		++mNumberOfFinishedRequests;
+
+		// Done
+		return true;
+	}
+
+	void AssetLoader::waitForJob()
+	{
+		if (nullptr != mJob)
+		{
+			mRendererToolkitImpl->getJobSystem().wait(*mJob);
+			mJob = nullptr;
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
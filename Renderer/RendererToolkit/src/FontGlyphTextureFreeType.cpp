@@ -43,71 +43,66 @@ namespace RendererToolkit
 	*  @brief
 	*    Initialize the glyph
 	*/
-	void FontGlyphTextureFreeType::initialize(FontTextureFreeType &fontTextureFreeType, unsigned long characterCode, unsigned int positionOffsetX, unsigned int positionOffsetY, unsigned char *glyphTextureAtlasData)
+	void FontGlyphTextureFreeType::initialize(FontTextureFreeType &fontTextureFreeType, FT_Face ftFace, unsigned long characterCode, unsigned int positionOffsetX, unsigned int positionOffsetY, unsigned char *glyphTextureAtlasData)
 	{
-		// Get the FreeType library face object (aka "The Font")
-		FT_Face *ftFace = fontTextureFreeType.getFTFace();
-		if (nullptr != ftFace)
+		// Load the Glyph for the character
+		if (0 == FT_Load_Glyph(ftFace, FT_Get_Char_Index(ftFace, characterCode), FT_LOAD_DEFAULT))
 		{
-			// Load the Glyph for the character
-			if (0 == FT_Load_Glyph(*ftFace, FT_Get_Char_Index(*ftFace, characterCode), FT_LOAD_DEFAULT))
+			// Move the glyph within the glyph slot of the face object into a glyph object
+			FT_Glyph ftGlyph;
+			if (0 == FT_Get_Glyph(ftFace->glyph, &ftGlyph))
 			{
-				// Move the glyph within the glyph slot of the face object into a glyph object
-				FT_Glyph ftGlyph;
-				if (0 == FT_Get_Glyph((*ftFace)->glyph, &ftGlyph))
-				{
-					// Convert the glyph to a bitmap
-					FT_Glyph_To_Bitmap(&ftGlyph, ft_render_mode_normal, 0, 1);
-					const FT_BitmapGlyph ftBitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(ftGlyph);
-
-					// Get a reference to the glyph bitmap
-					const FT_Bitmap &ftBitmap = ftBitmapGlyph->bitmap;
-
-					// Get the size (in pixel) of the glyph
-					mWidth  = ftBitmap.width;
-					mHeight = ftBitmap.rows;
-
-					{ // Copy the glyph bitmap into the glyph texture atlas
-						// Get the X component of the glyph texture atlas size (in pixel)
-						unsigned int numberOfBytesPerRow    = 0;
-						unsigned int glyphTextureAtlasSizeY = 0;
-						fontTextureFreeType.getGlyphTextureAtlasSize(numberOfBytesPerRow, glyphTextureAtlasSizeY);
-
-						// Copy all rows (one byte per texel)
-						unsigned char *currentGlyphTextureAtlasData = glyphTextureAtlasData + positionOffsetX + numberOfBytesPerRow * positionOffsetY;
-						unsigned char *endGlyphTextureAtlasData		= currentGlyphTextureAtlasData + numberOfBytesPerRow * mHeight;
-						unsigned char *currentFTBitmapBuffer		= ftBitmap.buffer;
-						for (; currentGlyphTextureAtlasData < endGlyphTextureAtlasData; currentGlyphTextureAtlasData += numberOfBytesPerRow, currentFTBitmapBuffer += mWidth)
-						{
-							// Copy the current row part
-							memcpy(currentGlyphTextureAtlasData, currentFTBitmapBuffer, static_cast<size_t>(mWidth));
-						}
-					}
+				// Convert the glyph to a bitmap
+				FT_Glyph_To_Bitmap(&ftGlyph, ft_render_mode_normal, 0, 1);
+				const FT_BitmapGlyph ftBitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(ftGlyph);
 
-					// Set the distance (in pixel) from the current pen position to the glyph bitmap
-					mCornerX = static_cast<float>(ftBitmapGlyph->left);
-					mCornerY = static_cast<float>(ftBitmapGlyph->top) - mHeight;
+				// Get a reference to the glyph bitmap
+				const FT_Bitmap &ftBitmap = ftBitmapGlyph->bitmap;
 
-					// Set the pen advance, the FreeType library measures font size in terms of 1/64ths of pixels, so we have to adjust with /64
-					mPenAdvanceX = static_cast<float>((*ftFace)->glyph->advance.x) / 64.0f;
-					mPenAdvanceY = static_cast<float>((*ftFace)->glyph->advance.y) / 64.0f;
+				// Get the size (in pixel) of the glyph
+				mWidth  = ftBitmap.width;
+				mHeight = ftBitmap.rows;
 
-					// Get the size of the glyph texture atlas
-					unsigned int glyphTextureAtlasSizeX = 0;
+				{ // Copy the glyph bitmap into the glyph texture atlas
+					// Get the X component of the glyph texture atlas size (in pixel)
+					unsigned int numberOfBytesPerRow    = 0;
 					unsigned int glyphTextureAtlasSizeY = 0;
-					fontTextureFreeType.getGlyphTextureAtlasSize(glyphTextureAtlasSizeX, glyphTextureAtlasSizeY);
+					fontTextureFreeType.getGlyphTextureAtlasSize(numberOfBytesPerRow, glyphTextureAtlasSizeY);
+
+					// Copy all rows (one byte per texel)
+					unsigned char *currentGlyphTextureAtlasData = glyphTextureAtlasData + positionOffsetX + numberOfBytesPerRow * positionOffsetY;
+					unsigned char *endGlyphTextureAtlasData		= currentGlyphTextureAtlasData + numberOfBytesPerRow * mHeight;
+					unsigned char *currentFTBitmapBuffer		= ftBitmap.buffer;
+					for (; currentGlyphTextureAtlasData < endGlyphTextureAtlasData; currentGlyphTextureAtlasData += numberOfBytesPerRow, currentFTBitmapBuffer += mWidth)
+					{
+						// Copy the current row part
+						memcpy(currentGlyphTextureAtlasData, currentFTBitmapBuffer, static_cast<size_t>(mWidth));
+					}
+				}
 
-					// Calculate the normalized minimum glyph texture coordinate inside the glyph texture atlas
-					mTexCoordMinX = static_cast<float>(positionOffsetX) / static_cast<float>(glyphTextureAtlasSizeX);
-					mTexCoordMinY = static_cast<float>(positionOffsetY) / static_cast<float>(glyphTextureAtlasSizeY);
+				// Set the distance (in pixel) from the current pen position to the glyph bitmap
+				mCornerX = static_cast<float>(ftBitmapGlyph->left);
+				mCornerY = static_cast<float>(ftBitmapGlyph->top) - mHeight;
 
-					// Calculate the normalized maximum glyph texture coordinate inside the glyph texture atlas
-					mTexCoordMaxX = static_cast<float>(positionOffsetX + mWidth)  / static_cast<float>(glyphTextureAtlasSizeX);
-					mTexCoordMaxY = static_cast<float>(positionOffsetY + mHeight) / static_cast<float>(glyphTextureAtlasSizeY);
+				// Set the pen advance, the FreeType library measures font size in terms of 1/64ths of pixels, so we have to adjust with /64
+				mPenAdvanceX = static_cast<float>(ftFace->glyph->advance.x) / 64.0f;
+				mPenAdvanceY = static_cast<float>(ftFace->glyph->advance.y) / 64.0f;
 
-					// Release the created FreeType glyph
-					FT_Done_Glyph(ftGlyph);
-				}
+				// Get the size of the glyph texture atlas
+				unsigned int glyphTextureAtlasSizeX = 0;
+				unsigned int glyphTextureAtlasSizeY = 0;
+				fontTextureFreeType.getGlyphTextureAtlasSize(glyphTextureAtlasSizeX, glyphTextureAtlasSizeY);
+
+				// Calculate the normalized minimum glyph texture coordinate inside the glyph texture atlas
+				mTexCoordMinX = static_cast<float>(positionOffsetX) / static_cast<float>(glyphTextureAtlasSizeX);
+				mTexCoordMinY = static_cast<float>(positionOffsetY) / static_cast<float>(glyphTextureAtlasSizeY);
+
+				// Calculate the normalized maximum glyph texture coordinate inside the glyph texture atlas
+				mTexCoordMaxX = static_cast<float>(positionOffsetX + mWidth)  / static_cast<float>(glyphTextureAtlasSizeX);
+				mTexCoordMaxY = static_cast<float>(positionOffsetY + mHeight) / static_cast<float>(glyphTextureAtlasSizeY);
+
+				// Release the created FreeType glyph
+				FT_Done_Glyph(ftGlyph);
 			}
 		}
 	}
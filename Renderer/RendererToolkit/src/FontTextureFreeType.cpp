@@ -22,6 +22,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RendererToolkit/FontTextureFreeType.h"
+#include "RendererToolkit/IJobSystem.h"
 #include "RendererToolkit/FreeTypeContext.h"
 #include "RendererToolkit/RendererToolkitImpl.h"
 #include "RendererToolkit/FontGlyphTextureFreeType.h"
@@ -34,6 +35,7 @@
 #include <ft2build.h>
 #include FT_FREETYPE_H
 
+#include <new>		// For the placement new of the glyphs
 #include <math.h>	// For "powf()"
 
 
@@ -144,18 +146,18 @@ namespace RendererToolkit
 			}
 
 			// Read in the whole file
-			mFontFileData = new unsigned char[mFontFileSize];
+			mFontFileData = rendererToolkitImpl.getRenderer().getAllocator().allocateArray<unsigned char>(mFontFileSize, Renderer::AllocationTag::TOOLKIT);
 			fread(mFontFileData, sizeof(unsigned char), mFontFileSize, file);
 
 			// Close the file
 			fclose(file);
 
 			// Create the FreeType library face
-			mFTFace = new FT_Face;
-			if (0 != FT_New_Memory_Face(*rendererToolkitImpl.getFreeTypeContext().getFTLibrary(), static_cast<FT_Byte const*>(mFontFileData), static_cast<FT_Long>(mFontFileSize), 0, mFTFace))
+			mFTFace = rendererToolkitImpl.getRenderer().getAllocator().allocateArray<FT_Face>(1, Renderer::AllocationTag::TOOLKIT);
+			if (nullptr != mFTFace && 0 != FT_New_Memory_Face(*rendererToolkitImpl.getFreeTypeContext().getFTLibrary(), static_cast<FT_Byte const*>(mFontFileData), static_cast<FT_Long>(mFontFileSize), 0, mFTFace))
 			{
 				// Error!
-				delete mFTFace;
+				rendererToolkitImpl.getRenderer().getAllocator().deallocateArray(mFTFace, Renderer::AllocationTag::TOOLKIT);
 				mFTFace = nullptr;
 			}
 			else
@@ -182,13 +184,13 @@ namespace RendererToolkit
 		if (nullptr != mFTFace)
 		{
 			FT_Done_Face(*mFTFace);
-			delete mFTFace;
+			mRendererToolkitImpl->getRenderer().getAllocator().deallocateArray(mFTFace, Renderer::AllocationTag::TOOLKIT);
 		}
 
 		// Destroy the cached font file data
 		if (nullptr != mFontFileData)
 		{
-			delete [] mFontFileData;
+			mRendererToolkitImpl->getRenderer().getAllocator().deallocateArray(mFontFileData, Renderer::AllocationTag::TOOLKIT);
 		}
 
 		// Release our renderer toolkit implementation reference
@@ -448,6 +450,45 @@ namespace RendererToolkit
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	void FontTextureFreeType::renderGlyphsJob(void *data, unsigned int firstElement, unsigned int lastElement)
+	{
+		const GlyphJobData &glyphJobData = *static_cast<const GlyphJobData*>(data);
+		FontTextureFreeType &fontTextureFreeType = *glyphJobData.fontTextureFreeType;
+
+		// Create an own FreeType library object for this job, FreeType library objects must not be used by multiple threads at the same time
+		FT_Library ftLibrary;
+		if (0 == FT_Init_FreeType(&ftLibrary))
+		{
+			// Create an own FreeType face object (aka "The Font") by using the shared font file data
+			FT_Face ftFace;
+			if (0 == FT_New_Memory_Face(ftLibrary, static_cast<FT_Byte const*>(fontTextureFreeType.mFontFileData), static_cast<FT_Long>(fontTextureFreeType.mFontFileSize), 0, &ftFace))
+			{
+				// Use the current font size, the FreeType library measures font size in terms of 1/64ths of pixels, so we have to adjust with *64
+				if (0 == FT_Set_Char_Size(ftFace, 0L, static_cast<FT_F26Dot6>(fontTextureFreeType.mSize * 64), fontTextureFreeType.mResolution, fontTextureFreeType.mResolution))
+				{
+					// Initialize the texture glyphs
+					const unsigned int padding = fontTextureFreeType.mGlyphTextureAtlasPadding;
+					for (unsigned int i = firstElement; i < lastElement; ++i)
+					{
+						const unsigned int x = i % NUMBER_OF_GLYPHS_PER_ROW;
+						const unsigned int y = i / NUMBER_OF_GLYPHS_PER_ROW;
+						fontTextureFreeType.mFontGlyphs[i].initialize(fontTextureFreeType, ftFace, i, padding + x * glyphJobData.distanceToNextGlyph, padding + y * glyphJobData.distanceToNextGlyph, glyphJobData.glyphTextureAtlasData);
+					}
+				}
+
+				// Destroy the FreeType face object
+				FT_Done_Face(ftFace);
+			}
+
+			// Destroy the FreeType library object
+			FT_Done_FreeType(ftLibrary);
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -511,30 +552,29 @@ namespace RendererToolkit
 			if (mGlyphTextureAtlasSizeX > 0 && mGlyphTextureAtlasSizeY > 0 )
 			{
 				// Allocate memory for the glyph texture atlas and initialize it with zero to avoid sampling artefacts later on
+				Renderer::IAllocator &allocator = mRendererToolkitImpl->getRenderer().getAllocator();
 				const unsigned int totalNumberOfBytes = getGlyphTextureAtlasNumberOfBytes(false);
-				unsigned char *glyphTextureAtlasData = new unsigned char[totalNumberOfBytes];
+				unsigned char *glyphTextureAtlasData = allocator.allocateArray<unsigned char>(totalNumberOfBytes, Renderer::AllocationTag::TEMPORARY);
 				memset(glyphTextureAtlasData, 0, totalNumberOfBytes);
 
 				// Get the font height in pixels (if we're here, we already now that it's valid!)
 				const unsigned int fontHeight = getHeightInPixels();
 
 				{ // Fill the glyph texture atlas - We've got 256 glyphs, this means there are 16 glyphs per row within the glyph texture atlas
-					const unsigned int numberOfGlyphs		= 256;
-					const unsigned int glyphsPerRow			= 16;
-					const unsigned int glyphsPerColumn		= 16;
-					const unsigned int xDistanceToNextGlyph = fontHeight + mGlyphTextureAtlasPadding;
-					const unsigned int yDistanceToNextGlyph = fontHeight + mGlyphTextureAtlasPadding;
-					mFontGlyphs = new FontGlyphTextureFreeType[numberOfGlyphs];
-					FontGlyphTextureFreeType *currentFontGlyphs = mFontGlyphs;
-					for (unsigned int y = 0, i = 0; y < glyphsPerRow; ++y)
+					// Construct the texture glyphs, the allocator doesn't call constructors
+					mFontGlyphs = allocator.allocateArray<FontGlyphTextureFreeType>(NUMBER_OF_GLYPHS, Renderer::AllocationTag::TOOLKIT);
+					for (unsigned int i = 0; i < NUMBER_OF_GLYPHS; ++i)
 					{
-						for (unsigned int x = 0; x < glyphsPerColumn; ++x, ++i, ++currentFontGlyphs)
-						{
-							// Initialize the texture glyph
-							currentFontGlyphs->initialize(*this, i, mGlyphTextureAtlasPadding + x * xDistanceToNextGlyph, mGlyphTextureAtlasPadding + y * yDistanceToNextGlyph, glyphTextureAtlasData);
-						}
+						new (&mFontGlyphs[i]) FontGlyphTextureFreeType();
 					}
-					mNumberOfFontGlyphs = numberOfGlyphs;
+					mNumberOfFontGlyphs = NUMBER_OF_GLYPHS;
+
+					// Render the glyphs in parallel, each glyph is written into an own part of the glyph texture atlas so there are no write conflicts
+					GlyphJobData glyphJobData;
+					glyphJobData.fontTextureFreeType   = this;
+					glyphJobData.glyphTextureAtlasData = glyphTextureAtlasData;
+					glyphJobData.distanceToNextGlyph   = fontHeight + mGlyphTextureAtlasPadding;
+					mRendererToolkitImpl->getJobSystem().parallelFor(&FontTextureFreeType::renderGlyphsJob, &glyphJobData, NUMBER_OF_GLYPHS, NUMBER_OF_GLYPHS_PER_JOB);
 				}
 
 				{ // Renderer related part
@@ -554,7 +594,7 @@ namespace RendererToolkit
 				}
 
 				// Free memory of the glyph texture atlas
-				delete [] glyphTextureAtlasData;
+				allocator.deallocateArray(glyphTextureAtlasData, Renderer::AllocationTag::TEMPORARY);
 			}
 		}
 	}
@@ -620,7 +660,12 @@ namespace RendererToolkit
 		// Destroy the array of currently active glyphs
 		if (nullptr != mFontGlyphs)
 		{
-			delete [] mFontGlyphs;
+			// The allocator doesn't call destructors
+			for (unsigned int i = 0; i < mNumberOfFontGlyphs; ++i)
+			{
+				mFontGlyphs[i].~FontGlyphTextureFreeType();
+			}
+			mRendererToolkitImpl->getRenderer().getAllocator().deallocateArray(mFontGlyphs, Renderer::AllocationTag::TOOLKIT);
 			mFontGlyphs = nullptr;
 			mNumberOfFontGlyphs = 0;
 		}
@@ -45,17 +45,16 @@ namespace RendererToolkit
 	*/
 	FreeTypeContext::FreeTypeContext(Renderer::IRenderer &renderer) :
 		mRenderer(&renderer),
-		mFTLibrary(new FT_Library)
+		mFTLibrary(renderer.getAllocator().allocateArray<FT_Library>(1, Renderer::AllocationTag::TOOLKIT))
 	{
 		// Add our renderer reference
 		mRenderer->addReference();
 
 		// Initialize the FreeType library object
-		const FT_Error ftError = FT_Init_FreeType(mFTLibrary);
-		if (0 != ftError)
+		if (nullptr != mFTLibrary && 0 != FT_Init_FreeType(mFTLibrary))
 		{
 			// Error!
-			delete mFTLibrary;
+			mRenderer->getAllocator().deallocateArray(mFTLibrary, Renderer::AllocationTag::TOOLKIT);
 			mFTLibrary = nullptr;
 		}
 	}
@@ -70,7 +69,7 @@ namespace RendererToolkit
 		if (nullptr != mFTLibrary)
 		{
 			FT_Done_FreeType(*mFTLibrary);
-			delete mFTLibrary;
+			mRenderer->getAllocator().deallocateArray(mFTLibrary, Renderer::AllocationTag::TOOLKIT);
 		}
 
 		// Release our renderer reference
@@ -0,0 +1,453 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/JobSystem.h"
+
+#include <Renderer/IRenderer.h>
+#include <Renderer/IAllocator.h>
+#include <Renderer/StlAllocator.h>
+
+#include <new>		// For placement new
+#include <deque>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Definitions                                           ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Job
+	*/
+	struct IJobSystem::Job
+	{
+		static const unsigned int MAXIMUM_NUMBER_OF_DEPENDENT_JOBS = 8;	/**< Maximum number of jobs depending on a single job */
+
+		JobFunction					 function;											/**< Job function, always valid */
+		void						*data;												/**< Data to pass to the job function, can be a null pointer */
+		unsigned int				 firstElement;										/**< Index of the first element to process */
+		unsigned int				 lastElement;										/**< Index of the element after the last element to process */
+		unsigned int				 numberOfElementsPerJob;							/**< Maximum number of elements processed by a single job function call, always valid */
+		Job							*parentJob;											/**< Parent job this job was split off from, a null pointer for jobs created by using "createJob()" */
+		std::atomic<unsigned int>	 numberOfUnfinishedJobs;							/**< One for the job itself plus the number of unfinished jobs split off from it */
+		std::atomic<unsigned int>	 numberOfPendingDependencies;						/**< Number of unfinished jobs this job depends on plus one until the job is started */
+		Job							*dependentJobs[MAXIMUM_NUMBER_OF_DEPENDENT_JOBS];	/**< Jobs depending on this job */
+		unsigned int				 numberOfDependentJobs;								/**< Number of jobs depending on this job */
+		bool						 started;											/**< Was "run()" called for this job? */
+		std::atomic<bool>			 finished;											/**< Is the job including all jobs split off from it finished? */
+	};
+
+	/**
+	*  @brief
+	*    Job queue
+	*
+	*  @remarks
+	*    The owner thread adds and takes jobs at the back, other threads steal jobs from the front. This way the owner
+	*    thread works on the most recently split off small jobs which are still in the cache while thieves take the
+	*    oldest and usually largest jobs, which keeps the number of steals low.
+	*/
+	struct JobSystem::JobQueue
+	{
+		typedef std::deque<IJobSystem::Job*, Renderer::StlAllocator<IJobSystem::Job*> > Jobs;
+
+		std::mutex	mutex;	/**< Mutex protecting the jobs */
+		Jobs		jobs;	/**< Queued jobs, the jobs are not owned by the queue */
+
+		explicit JobQueue(Renderer::IAllocator &allocator) :
+			jobs(Jobs::allocator_type(allocator, Renderer::AllocationTag::TOOLKIT))
+		{
+			// Nothing to do in here
+		}
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	JobSystem::JobSystem(Renderer::IRenderer &renderer) :
+		mRenderer(&renderer),
+		mNumberOfWorkerThreads(0),
+		mJobQueues(nullptr),
+		mWorkerThreads(nullptr),
+		mNumberOfQueuedJobs(0),
+		mShutdown(false)
+	{
+		// Add our renderer reference
+		mRenderer->addReference();
+
+		// One worker thread per hardware thread except for one, the thread waiting for jobs is executing jobs as well
+		// -> "std::thread::hardware_concurrency()" returns zero if the number of hardware threads is unknown, use a single worker thread in this case
+		const unsigned int numberOfHardwareThreads = std::thread::hardware_concurrency();
+		mNumberOfWorkerThreads = (0 == numberOfHardwareThreads) ? 1 : numberOfHardwareThreads - 1;
+		if (mNumberOfWorkerThreads > MAXIMUM_NUMBER_OF_WORKER_THREADS)
+		{
+			mNumberOfWorkerThreads = MAXIMUM_NUMBER_OF_WORKER_THREADS;
+		}
+
+		// Create the job queues, the allocator doesn't call constructors
+		Renderer::IAllocator &allocator = mRenderer->getAllocator();
+		mJobQueues = static_cast<JobQueue*>(allocator.allocate(sizeof(JobQueue) * (mNumberOfWorkerThreads + 1), Renderer::IAllocator::DEFAULT_ALIGNMENT, Renderer::AllocationTag::TOOLKIT));
+		for (unsigned int i = 0; i <= mNumberOfWorkerThreads; ++i)
+		{
+			new (&mJobQueues[i]) JobQueue(allocator);
+		}
+
+		// Start the worker threads, the first job queue is used by threads which are not worker threads
+		if (mNumberOfWorkerThreads > 0)
+		{
+			mWorkerThreads = static_cast<std::thread*>(allocator.allocate(sizeof(std::thread) * mNumberOfWorkerThreads, Renderer::IAllocator::DEFAULT_ALIGNMENT, Renderer::AllocationTag::TOOLKIT));
+			for (unsigned int i = 0; i < mNumberOfWorkerThreads; ++i)
+			{
+				new (&mWorkerThreads[i]) std::thread(&JobSystem::workerThreadFunction, this, i + 1);
+			}
+		}
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	JobSystem::~JobSystem()
+	{
+		Renderer::IAllocator &allocator = mRenderer->getAllocator();
+
+		// Shut down the worker threads
+		if (nullptr != mWorkerThreads)
+		{
+			{ // Set the shutdown flag while holding the wake up mutex, else a worker thread could miss the notification
+				std::lock_guard<std::mutex> lock(mWakeUpMutex);
+				mShutdown = true;
+			}
+			mWakeUpConditionVariable.notify_all();
+			for (unsigned int i = 0; i < mNumberOfWorkerThreads; ++i)
+			{
+				mWorkerThreads[i].join();
+				mWorkerThreads[i].~thread();
+			}
+			allocator.deallocate(mWorkerThreads, Renderer::AllocationTag::TOOLKIT);
+		}
+
+		// Destroy the job queues
+		for (unsigned int i = 0; i <= mNumberOfWorkerThreads; ++i)
+		{
+			mJobQueues[i].~JobQueue();
+		}
+		allocator.deallocate(mJobQueues, Renderer::AllocationTag::TOOLKIT);
+
+		// Release our renderer reference
+		mRenderer->release();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual RendererToolkit::IJobSystem methods    ]
+	//[-------------------------------------------------------]
+	IJobSystem::Job *JobSystem::createJob(JobFunction function, void *data, unsigned int numberOfElements, unsigned int numberOfElementsPerJob)
+	{
+		// Check the given job function
+		if (nullptr == function)
+		{
+			// Error!
+			return nullptr;
+		}
+
+		// Automatically split the elements across all threads?
+		if (0 == numberOfElementsPerJob)
+		{
+			numberOfElementsPerJob = numberOfElements / ((mNumberOfWorkerThreads + 1) * NUMBER_OF_JOBS_PER_THREAD);
+			if (0 == numberOfElementsPerJob)
+			{
+				numberOfElementsPerJob = 1;
+			}
+		}
+
+		// Create the job
+		return allocateJob(function, data, 0, numberOfElements, numberOfElementsPerJob, nullptr);
+	}
+
+	bool JobSystem::addDependency(Job &job, Job &dependency)
+	{
+		// The dependent jobs are not synchronized, this is only safe as long as none of the jobs was started
+		if (job.started || dependency.started || dependency.numberOfDependentJobs >= Job::MAXIMUM_NUMBER_OF_DEPENDENT_JOBS)
+		{
+			// Error!
+			return false;
+		}
+
+		// Register the dependency
+		dependency.dependentJobs[dependency.numberOfDependentJobs] = &job;
+		++dependency.numberOfDependentJobs;
+		++job.numberOfPendingDependencies;
+
+		// Done
+		return true;
+	}
+
+	void JobSystem::run(Job &job)
+	{
+		if (!job.started)
+		{
+			// Queue the job right now in case all jobs it depends on are already finished, else the last finished dependency is going to queue it
+			job.started = true;
+			if (1 == job.numberOfPendingDependencies.fetch_sub(1))
+			{
+				pushJob(0, job);
+			}
+		}
+	}
+
+	void JobSystem::wait(Job &job)
+	{
+		// Start the job in case this wasn't done yet
+		run(job);
+
+		// Execute jobs while waiting, this also ensures progress in case there are no worker threads
+		while (!job.finished.load(std::memory_order_acquire))
+		{
+			Job *otherJob = popJob(0);
+			if (nullptr != otherJob)
+			{
+				executeJob(*otherJob, 0);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		// Destroy the job
+		freeJob(job);
+	}
+
+	void JobSystem::parallelFor(JobFunction function, void *data, unsigned int numberOfElements, unsigned int numberOfElementsPerJob)
+	{
+		if (numberOfElements > 0)
+		{
+			Job *job = createJob(function, data, numberOfElements, numberOfElementsPerJob);
+			if (nullptr != job)
+			{
+				wait(*job);
+			}
+			else if (nullptr != function)
+			{
+				// Out of memory, process all elements on the calling thread
+				function(data, 0, numberOfElements);
+			}
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	void JobSystem::workerThreadFunction(JobSystem *jobSystem, unsigned int jobQueueIndex)
+	{
+		while (!jobSystem->mShutdown)
+		{
+			Job *job = jobSystem->popJob(jobQueueIndex);
+			if (nullptr != job)
+			{
+				jobSystem->executeJob(*job, jobQueueIndex);
+			}
+			else
+			{
+				// Sleep until there are new jobs
+				std::unique_lock<std::mutex> lock(jobSystem->mWakeUpMutex);
+				while (!jobSystem->mShutdown && 0 == jobSystem->mNumberOfQueuedJobs)
+				{
+					jobSystem->mWakeUpConditionVariable.wait(lock);
+				}
+			}
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	IJobSystem::Job *JobSystem::allocateJob(JobFunction function, void *data, unsigned int firstElement, unsigned int lastElement, unsigned int numberOfElementsPerJob, Job *parentJob)
+	{
+		// Allocate the job, the allocator doesn't call constructors
+		void *memory = mRenderer->getAllocator().allocate(sizeof(Job), Renderer::IAllocator::DEFAULT_ALIGNMENT, Renderer::AllocationTag::TOOLKIT);
+		if (nullptr == memory)
+		{
+			// Error!
+			return nullptr;
+		}
+		Job *job = new (memory) Job();
+
+		// Initialize the job
+		job->function					 = function;
+		job->data						 = data;
+		job->firstElement				 = firstElement;
+		job->lastElement				 = lastElement;
+		job->numberOfElementsPerJob		 = numberOfElementsPerJob;
+		job->parentJob					 = parentJob;
+		job->numberOfUnfinishedJobs		 = 1;
+		job->numberOfPendingDependencies = 1;
+		job->numberOfDependentJobs		 = 0;
+		job->started					 = false;
+		job->finished					 = false;
+
+		// Done
+		return job;
+	}
+
+	void JobSystem::freeJob(Job &job)
+	{
+		job.~Job();
+		mRenderer->getAllocator().deallocate(&job, Renderer::AllocationTag::TOOLKIT);
+	}
+
+	void JobSystem::pushJob(unsigned int jobQueueIndex, Job &job)
+	{
+		{ // Add the job to the back of the job queue
+			// -> Count the job while holding the job queue mutex so the number of queued jobs can't become negative when the job is taken right away
+			JobQueue &jobQueue = mJobQueues[jobQueueIndex];
+			std::lock_guard<std::mutex> lock(jobQueue.mutex);
+			++mNumberOfQueuedJobs;
+			jobQueue.jobs.push_back(&job);
+		}
+
+		// Wake up a sleeping worker thread
+		// -> Lock the wake up mutex once, else a worker thread which just found no jobs could miss the notification
+		if (mNumberOfWorkerThreads > 0)
+		{
+			{
+				std::lock_guard<std::mutex> lock(mWakeUpMutex);
+			}
+			mWakeUpConditionVariable.notify_one();
+		}
+	}
+
+	IJobSystem::Job *JobSystem::popJob(unsigned int jobQueueIndex)
+	{
+		// Early escape in case there are no jobs at all
+		if (0 == mNumberOfQueuedJobs)
+		{
+			return nullptr;
+		}
+
+		{ // Take the most recently added job from the own job queue
+			JobQueue &jobQueue = mJobQueues[jobQueueIndex];
+			std::lock_guard<std::mutex> lock(jobQueue.mutex);
+			if (!jobQueue.jobs.empty())
+			{
+				Job *job = jobQueue.jobs.back();
+				jobQueue.jobs.pop_back();
+				--mNumberOfQueuedJobs;
+				return job;
+			}
+		}
+
+		// Steal the oldest job from one of the other job queues, start with the next job queue so the thieves spread across the job queues
+		for (unsigned int i = 1; i <= mNumberOfWorkerThreads; ++i)
+		{
+			JobQueue &jobQueue = mJobQueues[(jobQueueIndex + i) % (mNumberOfWorkerThreads + 1)];
+			std::lock_guard<std::mutex> lock(jobQueue.mutex);
+			if (!jobQueue.jobs.empty())
+			{
+				Job *job = jobQueue.jobs.front();
+				jobQueue.jobs.pop_front();
+				--mNumberOfQueuedJobs;
+				return job;
+			}
+		}
+
+		// There's no job
+		return nullptr;
+	}
+
+	void JobSystem::executeJob(Job &job, unsigned int jobQueueIndex)
+	{
+		// Split off the upper half of the elements until the job is small enough, the split off jobs can be stolen by other threads
+		while (job.lastElement - job.firstElement > job.numberOfElementsPerJob)
+		{
+			const unsigned int middleElement = job.firstElement + (job.lastElement - job.firstElement) / 2;
+			Job *childJob = allocateJob(job.function, job.data, middleElement, job.lastElement, job.numberOfElementsPerJob, &job);
+			if (nullptr == childJob)
+			{
+				// Out of memory, process the remaining elements within this job
+				break;
+			}
+			++job.numberOfUnfinishedJobs;
+			pushJob(jobQueueIndex, *childJob);
+			job.lastElement = middleElement;
+		}
+
+		// Call the job function, respect the maximum number of elements per call in case splitting failed
+		for (unsigned int firstElement = job.firstElement; firstElement < job.lastElement; firstElement += job.numberOfElementsPerJob)
+		{
+			const unsigned int numberOfElements = job.lastElement - firstElement;
+			job.function(job.data, firstElement, firstElement + ((numberOfElements < job.numberOfElementsPerJob) ? numberOfElements : job.numberOfElementsPerJob));
+		}
+
+		// The job itself is finished, the jobs split off from it may still be running
+		finishJob(job, jobQueueIndex);
+	}
+
+	void JobSystem::finishJob(Job &job, unsigned int jobQueueIndex)
+	{
+		// Is this the last unfinished part of the job?
+		if (1 == job.numberOfUnfinishedJobs.fetch_sub(1))
+		{
+			// Queue the jobs which were only waiting for this job
+			for (unsigned int i = 0; i < job.numberOfDependentJobs; ++i)
+			{
+				Job &dependentJob = *job.dependentJobs[i];
+				if (1 == dependentJob.numberOfPendingDependencies.fetch_sub(1))
+				{
+					pushJob(jobQueueIndex, dependentJob);
+				}
+			}
+
+			// Split off jobs are destroyed right now and finish their parent job, jobs created by using "createJob()" are destroyed by "wait()"
+			Job *parentJob = job.parentJob;
+			if (nullptr != parentJob)
+			{
+				freeJob(job);
+				finishJob(*parentJob, jobQueueIndex);
+			}
+			else
+			{
+				// The job must not be accessed after this since a waiting thread is going to destroy it
+				job.finished.store(true, std::memory_order_release);
+			}
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
@@ -0,0 +1,331 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/MeshBatch.h"
+#include "RendererToolkit/RendererToolkitImpl.h"
+
+#include <Renderer/IProgram.h>
+#include <Renderer/IRenderer.h>
+#include <Renderer/IIndexBuffer.h>
+#include <Renderer/IVertexArray.h>
+#include <Renderer/IVertexBuffer.h>
+#include <Renderer/IIndirectBuffer.h>
+#include <Renderer/VertexArrayTypes.h>
+
+#include <string.h>	// For "memcpy()"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	MeshBatch::MeshBatch(RendererToolkitImpl &rendererToolkitImpl, unsigned int numberOfBytesPerVertex) :
+		IMeshBatch(numberOfBytesPerVertex),
+		mRendererToolkitImpl(&rendererToolkitImpl),
+		mVertexData(nullptr),
+		mVertexDataCapacity(0),
+		mNumberOfVertices(0),
+		mIndexData(nullptr),
+		mIndexDataCapacity(0),
+		mNumberOfIndices(0),
+		mMeshes(nullptr),
+		mMeshesCapacity(0),
+		mNumberOfMeshes(0),
+		mDraws(nullptr),
+		mDrawsCapacity(0),
+		mNumberOfDraws(0),
+		mDrawsDirty(false),
+		mVertexBuffer(nullptr),
+		mIndexBuffer(nullptr),
+		mVertexArray(nullptr),
+		mIndirectBuffer(nullptr),
+		mIndirectBufferCapacity(0)
+	{
+		// Add our renderer toolkit implementation reference
+		mRendererToolkitImpl->addReference();
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	MeshBatch::~MeshBatch()
+	{
+		// Release the renderer resources
+		if (nullptr != mIndirectBuffer)
+		{
+			mIndirectBuffer->release();
+		}
+		if (nullptr != mVertexArray)
+		{
+			mVertexArray->release();
+		}
+		if (nullptr != mIndexBuffer)
+		{
+			mIndexBuffer->release();
+		}
+		if (nullptr != mVertexBuffer)
+		{
+			mVertexBuffer->release();
+		}
+
+		// Destroy the system memory data
+		Renderer::IAllocator &allocator = mRendererToolkitImpl->getRenderer().getAllocator();
+		allocator.deallocateArray(mDraws, Renderer::AllocationTag::TOOLKIT);
+		allocator.deallocateArray(mMeshes, Renderer::AllocationTag::TOOLKIT);
+		allocator.deallocateArray(mIndexData, Renderer::AllocationTag::TOOLKIT);
+		allocator.deallocateArray(mVertexData, Renderer::AllocationTag::TOOLKIT);
+
+		// Release our renderer toolkit implementation reference
+		mRendererToolkitImpl->release();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual RendererToolkit::IMeshBatch methods    ]
+	//[-------------------------------------------------------]
+	unsigned int MeshBatch::addMesh(const void *vertexData, unsigned int numberOfVertices, const unsigned int *indices, unsigned int numberOfIndices)
+	{
+		// Check the given data, meshes can only be added as long as the megabuffers were not created, yet
+		if (nullptr == vertexData || 0 == numberOfVertices || nullptr == indices || 0 == numberOfIndices || 0 == mNumberOfBytesPerVertex || nullptr != mVertexBuffer)
+		{
+			// Error!
+			return ~0u;
+		}
+
+		// Append the vertices
+		growArray(mVertexData, mVertexDataCapacity, (mNumberOfVertices + numberOfVertices) * mNumberOfBytesPerVertex);
+		memcpy(mVertexData + mNumberOfVertices * mNumberOfBytesPerVertex, vertexData, numberOfVertices * mNumberOfBytesPerVertex);
+
+		// Append the indices, they stay relative to the first vertex of the mesh because the base vertex location is used during drawing
+		growArray(mIndexData, mIndexDataCapacity, (mNumberOfIndices + numberOfIndices) * sizeof(unsigned int));
+		memcpy(mIndexData + mNumberOfIndices * sizeof(unsigned int), indices, numberOfIndices * sizeof(unsigned int));
+
+		// Register the mesh
+		growArray(mMeshes, mMeshesCapacity, (mNumberOfMeshes + 1) * sizeof(Mesh));
+		Mesh &mesh = reinterpret_cast<Mesh*>(mMeshes)[mNumberOfMeshes];
+		mesh.startIndexLocation = mNumberOfIndices;
+		mesh.numberOfIndices	= numberOfIndices;
+		mesh.baseVertexLocation = mNumberOfVertices;
+		mNumberOfVertices += numberOfVertices;
+		mNumberOfIndices  += numberOfIndices;
+
+		// Done
+		return mNumberOfMeshes++;
+	}
+
+	Renderer::IVertexArray *MeshBatch::createVertexArray(Renderer::IProgram &program, unsigned int numberOfAttributes, const Renderer::VertexArrayAttribute *attributes)
+	{
+		Renderer::IRenderer &renderer = mRendererToolkitImpl->getRenderer();
+
+		// Create the megabuffers right now?
+		if (nullptr == mVertexBuffer)
+		{
+			// There must be at least one mesh
+			if (0 == mNumberOfMeshes)
+			{
+				// Error!
+				return nullptr;
+			}
+
+			// Begin debug event
+			RENDERER_BEGIN_DEBUG_EVENT_FUNCTION(&renderer)
+
+			// Create the vertex and index megabuffers and add our internal references
+			mVertexBuffer = renderer.createVertexBuffer(mNumberOfVertices * mNumberOfBytesPerVertex, mVertexData, Renderer::BufferUsage::STATIC_DRAW);
+			if (nullptr != mVertexBuffer)
+			{
+				RENDERER_SET_RESOURCE_DEBUG_NAME(mVertexBuffer, "Mesh batch vertex megabuffer")
+				mVertexBuffer->addReference();
+			}
+			mIndexBuffer = renderer.createIndexBuffer(mNumberOfIndices * sizeof(unsigned int), Renderer::IndexBufferFormat::UNSIGNED_INT, mIndexData, Renderer::BufferUsage::STATIC_DRAW);
+			if (nullptr != mIndexBuffer)
+			{
+				RENDERER_SET_RESOURCE_DEBUG_NAME(mIndexBuffer, "Mesh batch index megabuffer")
+				mIndexBuffer->addReference();
+			}
+
+			// End debug event
+			RENDERER_END_DEBUG_EVENT(&renderer)
+
+			// The system memory copies are no longer required
+			renderer.getAllocator().deallocateArray(mVertexData, Renderer::AllocationTag::TOOLKIT);
+			mVertexData = nullptr;
+			mVertexDataCapacity = 0;
+			renderer.getAllocator().deallocateArray(mIndexData, Renderer::AllocationTag::TOOLKIT);
+			mIndexData = nullptr;
+			mIndexDataCapacity = 0;
+		}
+
+		// Release the previous vertex array
+		if (nullptr != mVertexArray)
+		{
+			mVertexArray->release();
+			mVertexArray = nullptr;
+		}
+
+		// Create the vertex array, attributes without a vertex buffer are sourced from the vertex megabuffer
+		if (nullptr != mVertexBuffer && nullptr != mIndexBuffer)
+		{
+			Renderer::IAllocator &allocator = mRendererToolkitImpl->getRenderer().getAllocator();
+			Renderer::VertexArrayAttribute *vertexArrayAttributes = allocator.allocateArray<Renderer::VertexArrayAttribute>(numberOfAttributes, Renderer::AllocationTag::TEMPORARY);
+			for (unsigned int i = 0; i < numberOfAttributes; ++i)
+			{
+				vertexArrayAttributes[i] = attributes[i];
+				if (nullptr == vertexArrayAttributes[i].vertexBuffer)
+				{
+					vertexArrayAttributes[i].vertexBuffer = mVertexBuffer;
+				}
+			}
+			mVertexArray = program.createVertexArray(numberOfAttributes, vertexArrayAttributes, mIndexBuffer);
+			if (nullptr != mVertexArray)
+			{
+				mVertexArray->addReference();
+			}
+			allocator.deallocateArray(vertexArrayAttributes, Renderer::AllocationTag::TEMPORARY);
+		}
+
+		// Done
+		return mVertexArray;
+	}
+
+	bool MeshBatch::addDraw(unsigned int meshIndex, unsigned int numberOfInstances, unsigned int startInstanceLocation)
+	{
+		// Check the given mesh index
+		if (meshIndex >= mNumberOfMeshes)
+		{
+			// Error!
+			return false;
+		}
+
+		// Append the draw arguments
+		growArray(mDraws, mDrawsCapacity, (mNumberOfDraws + 1) * sizeof(Renderer::DrawIndexedInstancedArguments));
+		const Mesh &mesh = reinterpret_cast<const Mesh*>(mMeshes)[meshIndex];
+		Renderer::DrawIndexedInstancedArguments &drawArguments = reinterpret_cast<Renderer::DrawIndexedInstancedArguments*>(mDraws)[mNumberOfDraws];
+		drawArguments.indexCountPerInstance = mesh.numberOfIndices;
+		drawArguments.instanceCount			= numberOfInstances;
+		drawArguments.startIndexLocation	= mesh.startIndexLocation;
+		drawArguments.baseVertexLocation	= mesh.baseVertexLocation;
+		drawArguments.startInstanceLocation = startInstanceLocation;
+		++mNumberOfDraws;
+		mDrawsDirty = true;
+
+		// Done
+		return true;
+	}
+
+	void MeshBatch::draw(Renderer::PrimitiveTopology::Enum primitiveTopology, unsigned int firstDraw, unsigned int numberOfDraws)
+	{
+		// Is there anything to draw?
+		if (nullptr != mVertexArray && firstDraw < mNumberOfDraws && numberOfDraws > 0)
+		{
+			Renderer::IRenderer &renderer = mRendererToolkitImpl->getRenderer();
+
+			// Update the indirect buffer, if required
+			if (mDrawsDirty)
+			{
+				const unsigned int numberOfBytes = mNumberOfDraws * sizeof(Renderer::DrawIndexedInstancedArguments);
+
+				// Is the current indirect buffer too small? (use the capacity of the draws array to avoid recreating the buffer each time a draw is added)
+				if (numberOfBytes > mIndirectBufferCapacity)
+				{
+					if (nullptr != mIndirectBuffer)
+					{
+						mIndirectBuffer->release();
+					}
+					mIndirectBufferCapacity = mDrawsCapacity;
+					mIndirectBuffer = renderer.createIndirectBuffer(mIndirectBufferCapacity, nullptr, Renderer::BufferUsage::DYNAMIC_DRAW);
+					if (nullptr != mIndirectBuffer)
+					{
+						RENDERER_SET_RESOURCE_DEBUG_NAME(mIndirectBuffer, "Mesh batch indirect buffer")
+						mIndirectBuffer->addReference();
+					}
+					else
+					{
+						// Error!
+						mIndirectBufferCapacity = 0;
+						return;
+					}
+				}
+
+				// Upload the draw arguments
+				mIndirectBuffer->copyDataFrom(numberOfBytes, mDraws);
+				mDrawsDirty = false;
+			}
+
+			// Set the used vertex array and primitive topology
+			renderer.iaSetVertexArray(mVertexArray);
+			renderer.iaSetPrimitiveTopology(primitiveTopology);
+
+			// Draw the meshes by using a single call
+			if (numberOfDraws > mNumberOfDraws - firstDraw)
+			{
+				numberOfDraws = mNumberOfDraws - firstDraw;
+			}
+			renderer.multiDrawIndexedIndirect(*mIndirectBuffer, firstDraw * sizeof(Renderer::DrawIndexedInstancedArguments), numberOfDraws);
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void MeshBatch::growArray(unsigned char *&data, unsigned int &capacity, unsigned int numberOfBytes)
+	{
+		if (numberOfBytes > capacity)
+		{
+			// Double the capacity to keep the number of reallocations low
+			unsigned int newCapacity = (capacity > 0) ? capacity : 64;
+			while (newCapacity < numberOfBytes)
+			{
+				newCapacity *= 2;
+			}
+
+			// Reallocate and keep the previous data
+			Renderer::IAllocator &allocator = mRendererToolkitImpl->getRenderer().getAllocator();
+			unsigned char *newData = allocator.allocateArray<unsigned char>(newCapacity, Renderer::AllocationTag::TOOLKIT);
+			if (nullptr != data)
+			{
+				memcpy(newData, data, capacity);
+				allocator.deallocateArray(data, Renderer::AllocationTag::TOOLKIT);
+			}
+			data = newData;
+			capacity = newCapacity;
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
@@ -22,8 +22,11 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RendererToolkit/RendererToolkitImpl.h"
+#include "RendererToolkit/JobSystem.h"
+#include "RendererToolkit/AssetLoader.h"
 #include "RendererToolkit/FreeTypeContext.h"
 #include "RendererToolkit/FontTextureFreeType.h"
+#include "RendererToolkit/MeshBatch.h"
 
 #include <Renderer/IProgram.h>
 #include <Renderer/IRenderer.h>
@@ -49,7 +52,7 @@
 #endif
 RENDERERTOOLKIT_API_EXPORT RendererToolkit::IRendererToolkit *createRendererToolkitInstance(Renderer::IRenderer &renderer)
 {
-	return new RendererToolkit::RendererToolkitImpl(renderer);
+	return new (renderer.getAllocator()) RendererToolkit::RendererToolkitImpl(renderer);
 }
 #undef RENDERERTOOLKIT_API_EXPORT
 
@@ -70,6 +73,7 @@ namespace RendererToolkit
 	*/
 	RendererToolkitImpl::RendererToolkitImpl(Renderer::IRenderer &renderer) :
 		mFreeTypeContext(nullptr),
+		mJobSystem(nullptr),
 		mFontProgram(nullptr),
 		mFontVertexShaderUniformBuffer(nullptr),
 		mFontFragmentShaderUniformBuffer(nullptr),
@@ -126,6 +130,12 @@ namespace RendererToolkit
 			mFontProgram->release();
 		}
 
+		// Release the job system instance, this shuts down the worker threads
+		if (nullptr != mJobSystem)
+		{
+			mJobSystem->release();
+		}
+
 		// Release the FreeType context instance
 		if (nullptr != mFreeTypeContext)
 		{
@@ -145,7 +155,7 @@ namespace RendererToolkit
 		// Create the FreeType context instance right now?
 		if (nullptr == mFreeTypeContext)
 		{
-			mFreeTypeContext = new FreeTypeContext(*mRenderer);
+			mFreeTypeContext = new (mRenderer->getAllocator()) FreeTypeContext(*mRenderer);
 			mFreeTypeContext->addReference();	// Add our internal reference
 		}
 
@@ -368,10 +378,10 @@ namespace RendererToolkit
 		if (nullptr != filename && '\0' != filename[0])
 		{
 			// Create the font instance
-			font = new FontTextureFreeType(*this, filename);
+			font = new (mRenderer->getAllocator()) FontTextureFreeType(*this, filename);
 
 			// Is the font valid? If yes, should we set the font size and resolution right now?
-			if (font->isValid() && size > 0 && resolution > 0)
+			if (nullptr != font && font->isValid() && size > 0 && resolution > 0)
 			{
 				// Set the font size
 				font->setSize(size, resolution);
@@ -382,6 +392,29 @@ namespace RendererToolkit
 		return font;
 	}
 
+	IMeshBatch *RendererToolkitImpl::createMeshBatch(unsigned int numberOfBytesPerVertex)
+	{
+		return (numberOfBytesPerVertex > 0) ? new (mRenderer->getAllocator()) MeshBatch(*this, numberOfBytesPerVertex) : nullptr;
+	}
+
+	IJobSystem &RendererToolkitImpl::getJobSystem()
+	{
+		// Create the job system instance right now?
+		if (nullptr == mJobSystem)
+		{
+			mJobSystem = new (mRenderer->getAllocator()) JobSystem(*mRenderer);
+			mJobSystem->addReference();	// Add our internal reference
+		}
+
+		// Return the job system instance
+		return *mJobSystem;
+	}
+
+	IAssetLoader *RendererToolkitImpl::createAssetLoader()
+	{
+		return new (mRenderer->getAllocator()) AssetLoader(*this);
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -0,0 +1,121 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __TRACERENDERER_MAPPING_H__
+#define __TRACERENDERER_MAPPING_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/TraceFormat.h"
+
+#include <Renderer/Statistics.h>
+#include <Renderer/TextureTypes.h>
+#include <Renderer/RendererTypes.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Trace mapping
+	*/
+	class Mapping
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		//[-------------------------------------------------------]
+		//[ Renderer::TextureFormat                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    "Renderer::TextureFormat" to number of bytes per texel
+		*
+		*  @param[in] textureFormat
+		*    "Renderer::TextureFormat" to map
+		*
+		*  @return
+		*    Number of bytes per texel
+		*/
+		static unsigned int getSize(Renderer::TextureFormat::Enum textureFormat);
+
+		//[-------------------------------------------------------]
+		//[ Renderer::PrimitiveTopology                           ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    "Renderer::PrimitiveTopology" and number of vertices to number of primitives
+		*
+		*  @param[in] primitiveTopology
+		*    "Renderer::PrimitiveTopology" to map
+		*  @param[in] numberOfVertices
+		*    Number of vertices or indices
+		*
+		*  @return
+		*    Number of points, lines, triangles or patches, 0 for an unknown primitive topology
+		*/
+		static unsigned int getNumberOfPrimitives(Renderer::PrimitiveTopology::Enum primitiveTopology, unsigned int numberOfVertices);
+
+		//[-------------------------------------------------------]
+		//[ TraceFormat::Command                                  ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    "TraceFormat::Command" to "Renderer::ApiCall"
+		*
+		*  @param[in] command
+		*    "TraceFormat::Command" to map
+		*
+		*  @return
+		*    "Renderer::ApiCall", "Renderer::ApiCall::NUMBER_OF_API_CALLS" if the command is no renderer API call
+		*/
+		static Renderer::ApiCall::Enum getApiCall(TraceFormat::Command::Enum command);
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __TRACERENDERER_MAPPING_H__
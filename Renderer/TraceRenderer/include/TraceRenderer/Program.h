@@ -0,0 +1,142 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __TRACERENDERER_PROGRAM_H__
+#define __TRACERENDERER_PROGRAM_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/IProgram.h>
+#include <Renderer/StlAllocator.h>
+
+#include <vector>
+
+#include "TraceRenderer/TraceResource.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Trace program class
+	*/
+	class Program : public Renderer::IProgram, public TraceResource
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] traceRenderer
+		*    Owner trace renderer instance
+		*  @param[in] program
+		*    The wrapped program, we keep a reference to it
+		*/
+		Program(TraceRenderer &traceRenderer, Renderer::IProgram &program);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~Program();
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IResource methods            ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void setDebugName(const char *name) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IProgram methods             ]
+	//[-------------------------------------------------------]
+	public:
+		virtual Renderer::IVertexArray *createVertexArray(unsigned int numberOfAttributes, const Renderer::VertexArrayAttribute *attributes, Renderer::IIndexBuffer *indexBuffer = nullptr) override;
+		virtual bool setStreamOutputVaryings(unsigned int numberOfVaryings, const char **varyingNames, bool interleaved = true) override;
+		virtual int getAttributeLocation(const char *attributeName) override;
+		virtual unsigned int getUniformBlockIndex(const char *uniformBlockName, unsigned int defaultIndex) override;
+		virtual handle getUniformHandle(const char *uniformName) override;
+		virtual unsigned int setTextureUnit(handle uniformHandle, unsigned int unit) override;
+		virtual void setUniform1i(handle uniformHandle, int value) override;
+		virtual void setUniform1f(handle uniformHandle, float value) override;
+		virtual void setUniform2fv(handle uniformHandle, const float *value) override;
+		virtual void setUniform3fv(handle uniformHandle, const float *value) override;
+		virtual void setUniform4fv(handle uniformHandle, const float *value) override;
+		virtual void setUniformMatrix3fv(handle uniformHandle, const float *value) override;
+		virtual void setUniformMatrix4fv(handle uniformHandle, const float *value) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Return the wrapped uniform handle of a trace uniform handle
+		*
+		*  @param[in] uniformHandle
+		*    Trace uniform handle
+		*
+		*  @return
+		*    The wrapped uniform handle, null handle for an unknown trace uniform handle
+		*/
+		handle getWrappedUniformHandle(handle uniformHandle) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		std::vector<handle, Renderer::StlAllocator<handle> > mUniformHandles;	/**< Uniform handles of the wrapped program handed out so far, the trace uniform handles are one based indices into this table */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __TRACERENDERER_PROGRAM_H__
@@ -0,0 +1,233 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __TRACERENDERER_TRACEFORMAT_H__
+#define __TRACERENDERER_TRACEFORMAT_H__
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Binary renderer API call trace format
+*
+*  @remarks
+*    File layout:
+*    @code
+*    TraceFormat::Header
+*    Command stream: <command ID as one byte> <command arguments>, <command ID as one byte> <command arguments>, ...
+*    @endcode
+*
+*    Argument encoding (native byte order, traces are meant to be replayed on the same platform they were captured on):
+*    - "u32", "i32", "f32": 4 byte unsigned integer, signed integer and float
+*    - "bool": One byte, 0 or 1
+*    - "id": "u32" resource ID, 0 for a null pointer; resource IDs are assigned in creation order starting with 1 and are never reused
+*    - "string": "u32" number of bytes including the terminating zero followed by the bytes, 0 for a null pointer
+*    - "wstring": Same as "string" but with 2 bytes per character, wide characters outside of UCS-2 are truncated
+*    - "data": "u32" number of bytes followed by the bytes, 0 for a null pointer
+*    - "struct": The raw bytes of a renderer state or type structure
+*
+*    Per command documentation: "<command ID>: <argument>, <argument>, ...". The arguments match the arguments of the
+*    renderer interface method the command was captured from, resources are replaced by their ID, return values are
+*    not captured with the exception of resource IDs of created resources and uniform handle indices.
+*
+*    Uniform handles are program specific, a captured uniform handle is a one based index into the table of uniform handles
+*    the program returned so far, 0 stands for a null handle. Resource contents written by the CPU are captured when the
+*    resource is created, when the resource data is updated and when a resource mapped for writing gets unmapped.
+*
+*    Increase "VERSION" whenever the layout changes, the player rejects traces with a different version.
+*/
+namespace TraceFormat
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Definitions                                           ]
+	//[-------------------------------------------------------]
+	static const unsigned int MAGIC   = 0x45435254;	/**< "TRCE" as four character code */
+	static const unsigned int VERSION = 1;			/**< Format version, increase it whenever the layout changes */
+
+	/**
+	*  @brief
+	*    Shader stage, used by the commands assigning resources to a shader stage
+	*/
+	struct ShaderStage
+	{
+		enum Enum
+		{
+			VERTEX_SHADER                  = 0,	/**< Vertex-shader (VS) stage */
+			TESSELLATION_CONTROL_SHADER    = 1,	/**< Tessellation-control-shader (TCS) stage */
+			TESSELLATION_EVALUATION_SHADER = 2,	/**< Tessellation-evaluation-shader (TES) stage */
+			GEOMETRY_SHADER                = 3,	/**< Geometry-shader (GS) stage */
+			FRAGMENT_SHADER                = 4,	/**< Fragment-shader (FS) stage */
+			COMPUTE_SHADER                 = 5	/**< Compute-shader (CS) stage */
+		};
+	};
+
+	/**
+	*  @brief
+	*    Command ID, stored as one byte
+	*/
+	struct Command
+	{
+		enum Enum
+		{
+			// Renderer
+			MAIN_SWAP_CHAIN						=  0,	/**< id swapChain, u32 width, u32 height - Captured once at the beginning in case the renderer has a main swap chain */
+			GET_SHADER_LANGUAGE					=  1,	/**< id shaderLanguage, string shaderLanguageName */
+			// Resource creation
+			CREATE_SWAP_CHAIN					=  2,	/**< id swapChain, u32 width, u32 height */
+			CREATE_FRAMEBUFFER					=  3,	/**< id framebuffer, u32 numberOfColorTextures, id colorTextures[numberOfColorTextures], id depthStencilTexture */
+			CREATE_VERTEX_BUFFER				=  4,	/**< id vertexBuffer, u32 numberOfBytes, u32 bufferUsage, data data */
+			CREATE_INDEX_BUFFER					=  5,	/**< id indexBuffer, u32 numberOfBytes, u32 indexBufferFormat, u32 bufferUsage, data data */
+			CREATE_TEXTURE_BUFFER				=  6,	/**< id textureBuffer, u32 numberOfBytes, u32 textureFormat, u32 bufferUsage, data data */
+			CREATE_INDIRECT_BUFFER				=  7,	/**< id indirectBuffer, u32 numberOfBytes, u32 bufferUsage, data data */
+			CREATE_TEXTURE_2D					=  8,	/**< id texture2D, u32 width, u32 height, u32 textureFormat, u32 flags, u32 textureUsage, u32 numberOfMultisamples, data data */
+			CREATE_TEXTURE_2D_ARRAY				=  9,	/**< id texture2DArray, u32 width, u32 height, u32 numberOfSlices, u32 textureFormat, u32 flags, u32 textureUsage, data data */
+			CREATE_RASTERIZER_STATE				= 10,	/**< id rasterizerState, struct "Renderer::RasterizerState" */
+			CREATE_DEPTH_STENCIL_STATE			= 11,	/**< id depthStencilState, struct "Renderer::DepthStencilState" */
+			CREATE_BLEND_STATE					= 12,	/**< id blendState, struct "Renderer::BlendState" */
+			CREATE_SAMPLER_STATE				= 13,	/**< id samplerState, struct "Renderer::SamplerState" */
+			CREATE_TEXTURE_COLLECTION			= 14,	/**< id textureCollection, u32 numberOfTextures, id textures[numberOfTextures] */
+			CREATE_SAMPLER_STATE_COLLECTION		= 15,	/**< id samplerStateCollection, u32 numberOfSamplerStates, id samplerStates[numberOfSamplerStates] */
+			// Resource handling
+			MAP									= 16,	/**< id resource, u32 subresource, u32 mapType, u32 mapFlags */
+			UNMAP								= 17,	/**< id resource, u32 subresource, u32 rowPitch, data writtenData - The data is empty if the resource was not mapped for writing, row pitch is 0 for buffers */
+			COPY_RESOURCE						= 18,	/**< id destinationResource, id sourceResource */
+			// States
+			SET_PROGRAM							= 19,	/**< id program */
+			// Input-assembler (IA) stage
+			IA_SET_VERTEX_ARRAY					= 20,	/**< id vertexArray */
+			IA_SET_PRIMITIVE_TOPOLOGY			= 21,	/**< u32 primitiveTopology */
+			// Shader stages
+			SET_TEXTURE							= 22,	/**< u32 shaderStage, u32 unit, id texture */
+			SET_TEXTURE_COLLECTION				= 23,	/**< u32 shaderStage, u32 startUnit, id textureCollection */
+			SET_SAMPLER_STATE					= 24,	/**< u32 shaderStage, u32 unit, id samplerState */
+			SET_SAMPLER_STATE_COLLECTION		= 25,	/**< u32 shaderStage, u32 startUnit, id samplerStateCollection */
+			SET_UNIFORM_BUFFER					= 26,	/**< u32 shaderStage, u32 slot, id uniformBuffer */
+			// Stream-output (SO) stage
+			SO_SET_TARGETS						= 27,	/**< u32 numberOfTargets, id vertexBuffers[numberOfTargets], bool hasOffsets, u32 offsets[numberOfTargets] (only if "hasOffsets" is true) */
+			SO_BEGIN							= 28,	/**< u32 primitiveTopology, bool rasterizerDiscard */
+			SO_END								= 29,	/**< - */
+			// Rasterizer (RS) stage
+			RS_SET_VIEWPORTS					= 30,	/**< u32 numberOfViewports, struct "Renderer::Viewport"[numberOfViewports] */
+			RS_SET_SCISSOR_RECTANGLES			= 31,	/**< u32 numberOfScissorRectangles, struct "Renderer::ScissorRectangle"[numberOfScissorRectangles] */
+			RS_SET_STATE						= 32,	/**< id rasterizerState */
+			// Output-merger (OM) stage
+			OM_SET_RENDER_TARGET				= 33,	/**< id renderTarget */
+			OM_SET_DEPTH_STENCIL_STATE			= 34,	/**< id depthStencilState */
+			OM_SET_BLEND_STATE					= 35,	/**< id blendState */
+			// Compute-shader (CS) stage
+			CS_SET_UNORDERED_ACCESS_VIEW		= 36,	/**< u32 unit, id resource */
+			// Operations
+			CLEAR								= 37,	/**< u32 flags, f32 color[4], f32 z, u32 stencil */
+			BEGIN_SCENE							= 38,	/**< - */
+			END_SCENE							= 39,	/**< - */
+			RESOLVE_MULTISAMPLE_FRAMEBUFFER		= 40,	/**< id destinationRenderTarget, id sourceMultisampleFramebuffer */
+			// Draw call
+			DRAW								= 41,	/**< u32 startVertexLocation, u32 numberOfVertices */
+			DRAW_INSTANCED						= 42,	/**< u32 startVertexLocation, u32 numberOfVertices, u32 numberOfInstances */
+			DRAW_INDEXED						= 43,	/**< u32 startIndexLocation, u32 numberOfIndices, u32 baseVertexLocation, u32 minimumIndex, u32 numberOfVertices */
+			DRAW_INDEXED_INSTANCED				= 44,	/**< u32 startIndexLocation, u32 numberOfIndices, u32 baseVertexLocation, u32 minimumIndex, u32 numberOfVertices, u32 numberOfInstances */
+			MULTI_DRAW_INDEXED_INDIRECT			= 45,	/**< id indirectBuffer, u32 indirectBufferOffset, u32 numberOfDraws */
+			DRAW_AUTO							= 46,	/**< - */
+			// Compute
+			DISPATCH							= 47,	/**< u32 groupCountX, u32 groupCountY, u32 groupCountZ */
+			MEMORY_BARRIER						= 48,	/**< u32 flags */
+			// Synchronization
+			INSERT_FENCE						= 49,	/**< id fence */
+			IS_FENCE_SIGNALED					= 50,	/**< id fence */
+			WAIT_FENCE							= 51,	/**< id fence, u32 timeout */
+			FLUSH								= 52,	/**< - */
+			FINISH								= 53,	/**< - */
+			// Debug
+			SET_DEBUG_MARKER					= 54,	/**< wstring name */
+			BEGIN_DEBUG_EVENT					= 55,	/**< wstring name */
+			END_DEBUG_EVENT						= 56,	/**< - */
+			// Resource
+			RELEASE_RESOURCE					= 57,	/**< id resource - The resource or shader language instance was destroyed */
+			SET_DEBUG_NAME						= 58,	/**< id resource, string name */
+			// Swap chain
+			PRESENT								= 59,	/**< id swapChain - Marks the end of a frame in case it's the main swap chain */
+			RESIZE_BUFFERS						= 60,	/**< id swapChain, u32 width, u32 height */
+			SET_FULLSCREEN_STATE				= 61,	/**< id swapChain, bool fullscreen */
+			// Buffer and texture
+			COPY_DATA_FROM						= 62,	/**< id resource, data data - Texture buffer, uniform buffer or indirect buffer */
+			UPDATE_REGION_2D					= 63,	/**< id texture2D, u32 mipmap, u32 x, u32 y, u32 width, u32 height, data data */
+			UPDATE_REGION_2D_ARRAY				= 64,	/**< id texture2DArray, u32 mipmap, u32 slice, u32 x, u32 y, u32 width, u32 height, data data */
+			// Program
+			CREATE_VERTEX_ARRAY					= 65,	/**< id program, id vertexArray, u32 numberOfAttributes, <attribute>[numberOfAttributes], id indexBuffer - Attribute: u32 vertexArrayFormat, 64 bytes name, 64 bytes semantic, u32 semanticIndex, id vertexBuffer, u32 offset, u32 stride, u32 instancesPerElement */
+			SET_STREAM_OUTPUT_VARYINGS			= 66,	/**< id program, u32 numberOfVaryings, string varyingNames[numberOfVaryings], bool interleaved */
+			GET_ATTRIBUTE_LOCATION				= 67,	/**< id program, string attributeName */
+			GET_UNIFORM_BLOCK_INDEX				= 68,	/**< id program, string uniformBlockName, u32 defaultIndex */
+			GET_UNIFORM_HANDLE					= 69,	/**< id program, string uniformName, u32 uniformHandleIndex */
+			SET_TEXTURE_UNIT					= 70,	/**< id program, u32 uniformHandleIndex, u32 unit */
+			SET_UNIFORM_1I						= 71,	/**< id program, u32 uniformHandleIndex, i32 value */
+			SET_UNIFORM_1F						= 72,	/**< id program, u32 uniformHandleIndex, f32 value */
+			SET_UNIFORM_2FV						= 73,	/**< id program, u32 uniformHandleIndex, f32 value[2] */
+			SET_UNIFORM_3FV						= 74,	/**< id program, u32 uniformHandleIndex, f32 value[3] */
+			SET_UNIFORM_4FV						= 75,	/**< id program, u32 uniformHandleIndex, f32 value[4] */
+			SET_UNIFORM_MATRIX_3FV				= 76,	/**< id program, u32 uniformHandleIndex, f32 value[9] */
+			SET_UNIFORM_MATRIX_4FV				= 77,	/**< id program, u32 uniformHandleIndex, f32 value[16] */
+			// Shader language
+			CREATE_VERTEX_SHADER				= 78,	/**< id shaderLanguage, id vertexShader, string sourceCode, string profile, string arguments, string entry */
+			CREATE_TESSELLATION_CONTROL_SHADER	= 79,	/**< id shaderLanguage, id tessellationControlShader, string sourceCode, string profile, string arguments, string entry */
+			CREATE_TESSELLATION_EVALUATION_SHADER	= 80,	/**< id shaderLanguage, id tessellationEvaluationShader, string sourceCode, string profile, string arguments, string entry */
+			CREATE_GEOMETRY_SHADER				= 81,	/**< id shaderLanguage, id geometryShader, string sourceCode, u32 gsInputPrimitiveTopology, u32 gsOutputPrimitiveTopology, u32 numberOfOutputVertices, string profile, string arguments, string entry */
+			CREATE_FRAGMENT_SHADER				= 82,	/**< id shaderLanguage, id fragmentShader, string sourceCode, string profile, string arguments, string entry */
+			CREATE_PROGRAM						= 83,	/**< id shaderLanguage, id program, id vertexShader, id tessellationControlShader, id tessellationEvaluationShader, id geometryShader, id fragmentShader */
+			CREATE_COMPUTE_SHADER				= 84,	/**< id shaderLanguage, id computeShader, string sourceCode, string profile, string arguments, string entry */
+			CREATE_COMPUTE_PROGRAM				= 85,	/**< id shaderLanguage, id program, id computeShader */
+			CREATE_UNIFORM_BUFFER				= 86,	/**< id shaderLanguage, id uniformBuffer, u32 numberOfBytes, u32 bufferUsage, data data */
+			NUMBER_OF_COMMANDS					= 87	/**< Number of commands, not a command */
+		};
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ Structures                                            ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    File header
+	*/
+	struct Header
+	{
+		unsigned int magic;				/**< Must be "TraceFormat::MAGIC" */
+		unsigned int version;			/**< Must be "TraceFormat::VERSION" */
+		char		 rendererName[64];	/**< ASCII name of the renderer backend the trace was captured with, e.g. "OpenGL", terminated by zero */
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceFormat
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __TRACERENDERER_TRACEFORMAT_H__
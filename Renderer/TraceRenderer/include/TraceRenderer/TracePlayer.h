@@ -0,0 +1,303 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __TRACERENDERER_TRACEPLAYER_H__
+#define __TRACERENDERER_TRACEPLAYER_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/TraceReader.h"
+
+#include <Renderer/PlatformTypes.h>
+
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class IResource;
+	class IRenderer;
+	class IFramebuffer;
+	class IShaderLanguage;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Renderer API call trace player
+	*
+	*  @remarks
+	*    Replays a trace captured by the trace renderer against the given renderer instance, frame by frame. Swap chains are
+	*    replaced by offscreen framebuffers with the captured size, with the exception of the main swap chain in case the
+	*    given renderer instance has a main swap chain. This way a trace can be replayed without any window, e.g. by using
+	*    the null renderer to measure the renderer API overhead in isolation.
+	*
+	*    The player keeps a reference to every resource the trace created until the trace releases it again.
+	*/
+	class TracePlayer
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] renderer
+		*    Renderer instance to replay the trace with, the player keeps a reference to it
+		*  @param[in] data
+		*    Trace data, e.g. a memory mapped trace file, must stay valid as long as the player exists
+		*  @param[in] numberOfBytes
+		*    Number of bytes of the trace data
+		*/
+		TracePlayer(Renderer::IRenderer &renderer, const void *data, unsigned int numberOfBytes);
+
+		/**
+		*  @brief
+		*    Destructor
+		*
+		*  @note
+		*    - Releases all resources the trace didn't release
+		*/
+		~TracePlayer();
+
+		/**
+		*  @brief
+		*    Return whether or not the trace data has a valid header
+		*
+		*  @return
+		*    "true" if the trace data has a valid header, else "false"
+		*/
+		inline bool isValid() const;
+
+		/**
+		*  @brief
+		*    Return the name of the renderer the trace was captured with
+		*
+		*  @return
+		*    The ASCII name of the renderer the trace was captured with, always valid
+		*/
+		inline const char *getCapturedRendererName() const;
+
+		/**
+		*  @brief
+		*    Return the number of commands played so far
+		*
+		*  @return
+		*    The number of commands played so far
+		*/
+		inline unsigned int getNumberOfPlayedCommands() const;
+
+		/**
+		*  @brief
+		*    Play the next frame
+		*
+		*  @return
+		*    "true" if a frame was played, "false" if the end of the trace was reached
+		*
+		*  @note
+		*    - A frame ends with the present of a swap chain, the commands after the last present (e.g. the resource destruction)
+		*      are played by the call returning "false"
+		*/
+		bool playFrame();
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Resource created by the trace
+		*/
+		struct Resource
+		{
+			Renderer::IResource		  *resource;		/**< Resource (we keep a reference to it), can be a null pointer */
+			Renderer::IShaderLanguage *shaderLanguage;	/**< Shader language (we keep a reference to it), can be a null pointer */
+			std::vector<handle>		   uniformHandles;	/**< Uniform handles of a program, the captured uniform handle indices are one based indices into this table */
+			void					  *mappedData;		/**< Data of the currently mapped resource, null pointer if the resource isn't mapped */
+			unsigned int			   mappedRowPitch;	/**< Row pitch of the currently mapped resource */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		explicit TracePlayer(const TracePlayer &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		TracePlayer &operator =(const TracePlayer &source);
+
+		/**
+		*  @brief
+		*    Play a single command
+		*
+		*  @param[in] command
+		*    Command to play
+		*
+		*  @return
+		*    "true" if the command was a present, else "false"
+		*/
+		bool playCommand(unsigned char command);
+
+		/**
+		*  @brief
+		*    Return the resource table entry of a resource ID
+		*
+		*  @param[in] id
+		*    Resource ID
+		*
+		*  @return
+		*    The resource table entry, null pointer for an unknown resource ID
+		*/
+		Resource *getResourceEntry(unsigned int id);
+
+		/**
+		*  @brief
+		*    Return the resource of a resource ID
+		*
+		*  @param[in] id
+		*    Resource ID, 0 for a null pointer
+		*
+		*  @return
+		*    The resource, null pointer for 0 or an unknown resource ID, do not release the returned instance unless you added an own reference to it
+		*/
+		Renderer::IResource *getResource(unsigned int id);
+
+		/**
+		*  @brief
+		*    Set the resource of a resource ID
+		*
+		*  @param[in] id
+		*    Resource ID
+		*  @param[in] resource
+		*    Resource, can be a null pointer (the trace created a resource the renderer instance failed to create), we keep a reference to it
+		*/
+		void setResource(unsigned int id, Renderer::IResource *resource);
+
+		/**
+		*  @brief
+		*    Release the resource and the shader language of a resource ID
+		*
+		*  @param[in] id
+		*    Resource ID
+		*/
+		void releaseResource(unsigned int id);
+
+		/**
+		*  @brief
+		*    Return the uniform handle of a captured uniform handle index
+		*
+		*  @param[in] programId
+		*    Program resource ID
+		*  @param[in] uniformHandleIndex
+		*    Captured uniform handle index
+		*
+		*  @return
+		*    The uniform handle, "NULL_HANDLE" for an unknown uniform handle
+		*/
+		handle getUniformHandle(unsigned int programId, unsigned int uniformHandleIndex);
+
+		/**
+		*  @brief
+		*    Create an offscreen framebuffer replacing a captured swap chain
+		*
+		*  @param[in] width
+		*    Width of the captured swap chain
+		*  @param[in] height
+		*    Height of the captured swap chain
+		*
+		*  @return
+		*    The created framebuffer, null pointer on error
+		*/
+		Renderer::IFramebuffer *createOffscreenFramebuffer(unsigned int width, unsigned int height);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Renderer::IRenderer			*mRenderer;					/**< Renderer instance to replay the trace with (we keep a reference to it), always valid */
+		TraceReader					 mTraceReader;				/**< Trace reader */
+		TraceFormat::Header			 mHeader;					/**< Trace file header */
+		bool						 mValid;					/**< Does the trace data have a valid header? */
+		unsigned int				 mNumberOfPlayedCommands;	/**< Number of commands played so far */
+		std::vector<Resource>		 mResources;				/**< Resource table, the resource ID is the index */
+		std::vector<unsigned char>	 mScratchData;				/**< Aligned scratch memory for captured arrays which are used every frame, e.g. viewports */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/TracePlayer.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __TRACERENDERER_TRACEPLAYER_H__
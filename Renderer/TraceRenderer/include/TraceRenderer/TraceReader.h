@@ -0,0 +1,190 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __TRACERENDERER_TRACEREADER_H__
+#define __TRACERENDERER_TRACEREADER_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/TraceFormat.h"
+
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Reader for the binary renderer API call trace format
+	*
+	*  @remarks
+	*    Works directly on the trace data in memory, e.g. a memory mapped trace file. Reading beyond the end of the
+	*    trace data returns zero values and sets the error state, so a truncated trace (e.g. the captured application
+	*    crashed) can't result in invalid memory accesses.
+	*
+	*  @see
+	*    - "TraceFormat" for the file layout
+	*/
+	class TraceReader
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] data
+		*    Trace data, must be valid and must stay valid as long as the reader and the pointers it returned are used
+		*  @param[in] numberOfBytes
+		*    Number of bytes of the trace data
+		*/
+		inline TraceReader(const void *data, unsigned int numberOfBytes);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline ~TraceReader();
+
+		/**
+		*  @brief
+		*    Return whether or not all trace data has been read
+		*
+		*  @return
+		*    "true" if all trace data has been read, else "false"
+		*/
+		inline bool isEndOfData() const;
+
+		/**
+		*  @brief
+		*    Return whether or not it was tried to read beyond the end of the trace data
+		*
+		*  @return
+		*    "true" if it was tried to read beyond the end of the trace data, else "false"
+		*/
+		inline bool hasError() const;
+
+		//[-------------------------------------------------------]
+		//[ Command stream                                        ]
+		//[-------------------------------------------------------]
+		inline unsigned char readCommand();
+		inline unsigned int readUInt32();
+		inline int readInt32();
+		inline float readFloat();
+		inline void readFloats(float *values, unsigned int numberOfValues);
+		inline bool readBool();
+		inline void readRaw(void *data, unsigned int numberOfBytes);
+
+		/**
+		*  @brief
+		*    Read data
+		*
+		*  @param[out] numberOfBytes
+		*    Receives the number of bytes of the data
+		*
+		*  @return
+		*    Pointer to the data inside the trace data (not aligned), null pointer for no data
+		*/
+		inline const void *readData(unsigned int &numberOfBytes);
+
+		/**
+		*  @brief
+		*    Read a string
+		*
+		*  @return
+		*    Pointer to the zero terminated string inside the trace data, can be a null pointer
+		*/
+		inline const char *readString();
+
+		/**
+		*  @brief
+		*    Read a wide string
+		*
+		*  @return
+		*    Zero terminated wide string, can be a null pointer, valid until the next wide string is read
+		*/
+		inline const wchar_t *readWideString();
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Return a pointer to the given number of bytes at the current position and advance the position
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to read
+		*
+		*  @return
+		*    Pointer to the bytes inside the trace data, null pointer when reading beyond the end of the trace data
+		*/
+		inline const unsigned char *read(unsigned int numberOfBytes);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		const unsigned char  *mData;			/**< Trace data, always valid */
+		unsigned int		  mNumberOfBytes;	/**< Number of bytes of the trace data */
+		unsigned int		  mPosition;		/**< Current read position */
+		bool				  mError;			/**< Was it tried to read beyond the end of the trace data? */
+		std::vector<wchar_t>  mWideString;		/**< Last read wide string */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/TraceReader.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __TRACERENDERER_TRACEREADER_H__
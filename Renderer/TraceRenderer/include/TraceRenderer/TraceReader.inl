@@ -0,0 +1,204 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <string.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	inline TraceReader::TraceReader(const void *data, unsigned int numberOfBytes) :
+		mData(static_cast<const unsigned char*>(data)),
+		mNumberOfBytes(numberOfBytes),
+		mPosition(0),
+		mError(false)
+	{
+		// Nothing to do in here
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline TraceReader::~TraceReader()
+	{
+		// Nothing to do in here
+	}
+
+	/**
+	*  @brief
+	*    Return whether or not all trace data has been read
+	*/
+	inline bool TraceReader::isEndOfData() const
+	{
+		return (mError || mPosition >= mNumberOfBytes);
+	}
+
+	/**
+	*  @brief
+	*    Return whether or not it was tried to read beyond the end of the trace data
+	*/
+	inline bool TraceReader::hasError() const
+	{
+		return mError;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Command stream                                        ]
+	//[-------------------------------------------------------]
+	inline unsigned char TraceReader::readCommand()
+	{
+		const unsigned char *data = read(sizeof(unsigned char));
+		return (nullptr != data) ? *data : static_cast<unsigned char>(TraceFormat::Command::NUMBER_OF_COMMANDS);
+	}
+
+	inline unsigned int TraceReader::readUInt32()
+	{
+		unsigned int value = 0;
+		readRaw(&value, sizeof(unsigned int));
+		return value;
+	}
+
+	inline int TraceReader::readInt32()
+	{
+		int value = 0;
+		readRaw(&value, sizeof(int));
+		return value;
+	}
+
+	inline float TraceReader::readFloat()
+	{
+		float value = 0.0f;
+		readRaw(&value, sizeof(float));
+		return value;
+	}
+
+	inline void TraceReader::readFloats(float *values, unsigned int numberOfValues)
+	{
+		readRaw(values, sizeof(float) * numberOfValues);
+	}
+
+	inline bool TraceReader::readBool()
+	{
+		const unsigned char *data = read(sizeof(unsigned char));
+		return (nullptr != data && 0 != *data);
+	}
+
+	inline void TraceReader::readRaw(void *data, unsigned int numberOfBytes)
+	{
+		// The trace data is tightly packed, use "memcpy()" to not run into unaligned memory access issues
+		const unsigned char *source = read(numberOfBytes);
+		if (nullptr != source)
+		{
+			memcpy(data, source, numberOfBytes);
+		}
+		else
+		{
+			memset(data, 0, numberOfBytes);
+		}
+	}
+
+	inline const void *TraceReader::readData(unsigned int &numberOfBytes)
+	{
+		numberOfBytes = readUInt32();
+		if (numberOfBytes > 0)
+		{
+			const unsigned char *data = read(numberOfBytes);
+			if (nullptr == data)
+			{
+				numberOfBytes = 0;
+			}
+			return data;
+		}
+		return nullptr;
+	}
+
+	inline const char *TraceReader::readString()
+	{
+		unsigned int numberOfBytes = 0;
+		const char *string = static_cast<const char*>(readData(numberOfBytes));
+
+		// Ensure the string is terminated, a broken trace must not result in reading beyond the end of the trace data
+		return (nullptr != string && '\0' == string[numberOfBytes - 1]) ? string : nullptr;
+	}
+
+	inline const wchar_t *TraceReader::readWideString()
+	{
+		unsigned int numberOfBytes = 0;
+		const unsigned char *data = static_cast<const unsigned char*>(readData(numberOfBytes));
+		const unsigned int numberOfCharacters = numberOfBytes / sizeof(unsigned short);
+		if (nullptr != data && numberOfCharacters > 0)
+		{
+			// The size of "wchar_t" is platform dependent, inside the trace two bytes per character are used
+			mWideString.resize(numberOfCharacters);
+			for (unsigned int i = 0; i < numberOfCharacters; ++i)
+			{
+				unsigned short character = 0;
+				memcpy(&character, data + i * sizeof(unsigned short), sizeof(unsigned short));
+				mWideString[i] = static_cast<wchar_t>(character);
+			}
+			mWideString[numberOfCharacters - 1] = L'\0';
+			return mWideString.data();
+		}
+		return nullptr;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Return a pointer to the given number of bytes at the current position and advance the position
+	*/
+	inline const unsigned char *TraceReader::read(unsigned int numberOfBytes)
+	{
+		if (!mError && numberOfBytes <= mNumberOfBytes - mPosition)
+		{
+			const unsigned char *data = mData + mPosition;
+			mPosition += numberOfBytes;
+			return data;
+		}
+
+		// Error!
+		mError = true;
+		return nullptr;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
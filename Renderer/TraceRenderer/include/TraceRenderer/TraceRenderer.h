@@ -0,0 +1,441 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __TRACERENDERER_TRACERENDERER_H__
+#define __TRACERENDERER_TRACERENDERER_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/IRenderer.h>
+#include <Renderer/StlAllocator.h>
+
+#include "TraceRenderer/TraceWriter.h"
+
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+	class SwapChain;
+	class TraceResource;
+	class ShaderLanguage;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Trace renderer class
+	*
+	*  @remarks
+	*    Wraps another renderer instance: Each renderer API call is forwarded to the wrapped renderer and recorded together
+	*    with its arguments and the resource contents written by the CPU into a compact binary trace file. The trace can
+	*    be replayed deterministically against any renderer backend using "TraceRenderer::TracePlayer", e.g. by using the
+	*    null renderer in order to measure the CPU overhead of the renderer API calls alone.
+	*
+	*    The renderer API calls are counted per frame inside the statistics (see "Renderer::Statistics::lastFrame"), including
+	*    redundant state changes, the number of submitted primitives and the number of uploaded bytes. Without a trace file,
+	*    the trace renderer only records these statistics which makes it a lightweight instrumentation for development builds.
+	*
+	*  @see
+	*    - "TraceFormat" for the trace file layout
+	*/
+	class TraceRenderer : public Renderer::IRenderer
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return the wrapped resource of a trace resource
+		*
+		*  @param[in] resource
+		*    Trace resource, can be a null pointer
+		*
+		*  @return
+		*    The wrapped resource, null pointer if a null pointer was given
+		*/
+		static Renderer::IResource *unwrapResource(Renderer::IResource *resource);
+
+		/**
+		*  @brief
+		*    Return the trace resource ID of a trace resource
+		*
+		*  @param[in] resource
+		*    Trace resource, can be a null pointer
+		*
+		*  @return
+		*    The trace resource ID, 0 if a null pointer was given
+		*/
+		static unsigned int getResourceId(Renderer::IResource *resource);
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] renderer
+		*    Renderer instance to wrap, we keep a reference to it
+		*  @param[in] filename
+		*    ASCII name of the trace file to create, an existing file is overwritten, null pointer to only record the per frame statistics
+		*
+		*  @note
+		*    - Do never ever use a not properly initialized renderer! Use "Renderer::IRenderer::isInitialized()" to check the initialization state.
+		*/
+		TraceRenderer(Renderer::IRenderer &renderer, const char *filename);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~TraceRenderer();
+
+		/**
+		*  @brief
+		*    Return the wrapped renderer instance
+		*
+		*  @return
+		*    The wrapped renderer instance, do not release the returned instance unless you added an own reference to it
+		*/
+		inline Renderer::IRenderer &getWrappedRenderer() const;
+
+		/**
+		*  @brief
+		*    Return the trace writer
+		*
+		*  @return
+		*    The trace writer
+		*/
+		inline TraceWriter &getTraceWriter();
+
+		/**
+		*  @brief
+		*    Inform the trace renderer that a trace swap chain was presented
+		*
+		*  @param[in] swapChain
+		*    The presented trace swap chain
+		*
+		*  @note
+		*    - Presenting the main swap chain (or any swap chain in case there's no main swap chain) ends the current frame
+		*/
+		void onPresent(SwapChain &swapChain);
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IRenderer methods            ]
+	//[-------------------------------------------------------]
+	public:
+		virtual const char *getName() const override;
+		virtual bool isInitialized() const override;
+		virtual Renderer::ISwapChain *getMainSwapChain() const override;
+		//[-------------------------------------------------------]
+		//[ Shader language                                       ]
+		//[-------------------------------------------------------]
+		virtual unsigned int getNumberOfShaderLanguages() const override;
+		virtual const char *getShaderLanguageName(unsigned int index) const override;
+		virtual Renderer::IShaderLanguage *getShaderLanguage(const char *shaderLanguageName = nullptr) override;
+		//[-------------------------------------------------------]
+		//[ Resource creation                                     ]
+		//[-------------------------------------------------------]
+		virtual Renderer::ISwapChain *createSwapChain(handle nativeWindowHandle) override;
+		virtual Renderer::IFramebuffer *createFramebuffer(unsigned int numberOfColorTextures, Renderer::ITexture **colorTextures, Renderer::ITexture *depthStencilTexture = nullptr) override;
+		virtual Renderer::IVertexBuffer *createVertexBuffer(unsigned int numberOfBytes, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
+		virtual Renderer::IIndexBuffer *createIndexBuffer(unsigned int numberOfBytes, Renderer::IndexBufferFormat::Enum indexBufferFormat, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
+		virtual Renderer::ITextureBuffer *createTextureBuffer(unsigned int numberOfBytes, Renderer::TextureFormat::Enum textureFormat, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
+		virtual Renderer::IIndirectBuffer *createIndirectBuffer(unsigned int numberOfBytes, const void *data = nullptr, Renderer::BufferUsage::Enum bufferUsage = Renderer::BufferUsage::DYNAMIC_DRAW) override;
+		virtual Renderer::ITexture2D *createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, Renderer::TextureUsage::Enum textureUsage = Renderer::TextureUsage::DEFAULT, unsigned int numberOfMultisamples = 1) override;
+		virtual Renderer::ITexture2DArray *createTexture2DArray(unsigned int width, unsigned int height, unsigned int numberOfSlices, Renderer::TextureFormat::Enum textureFormat, void *data = nullptr, unsigned int flags = 0, Renderer::TextureUsage::Enum textureUsage = Renderer::TextureUsage::DEFAULT) override;
+		virtual Renderer::IRasterizerState *createRasterizerState(const Renderer::RasterizerState &rasterizerState) override;
+		virtual Renderer::IDepthStencilState *createDepthStencilState(const Renderer::DepthStencilState &depthStencilState) override;
+		virtual Renderer::IBlendState *createBlendState(const Renderer::BlendState &blendState) override;
+		virtual Renderer::ISamplerState *createSamplerState(const Renderer::SamplerState &samplerState) override;
+		virtual Renderer::ITextureCollection *createTextureCollection(unsigned int numberOfTextures, Renderer::ITexture **textures) override;
+		virtual Renderer::ISamplerStateCollection *createSamplerStateCollection(unsigned int numberOfSamplerStates, Renderer::ISamplerState **samplerStates) override;
+		//[-------------------------------------------------------]
+		//[ Resource handling                                     ]
+		//[-------------------------------------------------------]
+		virtual bool map(Renderer::IResource &resource, unsigned int subresource, Renderer::MapType::Enum mapType, unsigned int mapFlags, Renderer::MappedSubresource &mappedSubresource) override;
+		virtual void unmap(Renderer::IResource &resource, unsigned int subresource) override;
+		virtual bool copyResource(Renderer::IResource &destinationResource, Renderer::IResource &sourceResource) override;
+		virtual void setTextureResident(Renderer::ITexture &texture, Renderer::ISamplerState *samplerState, bool resident) override;
+		//[-------------------------------------------------------]
+		//[ States                                                ]
+		//[-------------------------------------------------------]
+		virtual void setProgram(Renderer::IProgram *program) override;
+		//[-------------------------------------------------------]
+		//[ Input-assembler (IA) stage                            ]
+		//[-------------------------------------------------------]
+		virtual void iaSetVertexArray(Renderer::IVertexArray *vertexArray) override;
+		virtual void iaSetPrimitiveTopology(Renderer::PrimitiveTopology::Enum primitiveTopology) override;
+		//[-------------------------------------------------------]
+		//[ Vertex-shader (VS) stage                              ]
+		//[-------------------------------------------------------]
+		virtual void vsSetTexture(unsigned int unit, Renderer::ITexture *texture) override;
+		virtual void vsSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection) override;
+		virtual void vsSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState) override;
+		virtual void vsSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection) override;
+		virtual void vsSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer) override;
+		//[-------------------------------------------------------]
+		//[ Tessellation-control-shader (TCS) stage               ]
+		//[-------------------------------------------------------]
+		virtual void tcsSetTexture(unsigned int unit, Renderer::ITexture *texture) override;
+		virtual void tcsSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection) override;
+		virtual void tcsSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState) override;
+		virtual void tcsSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection) override;
+		virtual void tcsSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer) override;
+		//[-------------------------------------------------------]
+		//[ Tessellation-evaluation-shader (TES) stage            ]
+		//[-------------------------------------------------------]
+		virtual void tesSetTexture(unsigned int unit, Renderer::ITexture *texture) override;
+		virtual void tesSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection) override;
+		virtual void tesSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState) override;
+		virtual void tesSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection) override;
+		virtual void tesSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer) override;
+		//[-------------------------------------------------------]
+		//[ Geometry-shader (GS) stage                            ]
+		//[-------------------------------------------------------]
+		virtual void gsSetTexture(unsigned int unit, Renderer::ITexture *texture) override;
+		virtual void gsSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection) override;
+		virtual void gsSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState) override;
+		virtual void gsSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection) override;
+		virtual void gsSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer) override;
+		//[-------------------------------------------------------]
+		//[ Stream-output (SO) stage                              ]
+		//[-------------------------------------------------------]
+		virtual void soSetTargets(unsigned int numberOfTargets, Renderer::IVertexBuffer **vertexBuffers, const unsigned int *offsets = nullptr) override;
+		virtual void soBegin(Renderer::PrimitiveTopology::Enum primitiveTopology, bool rasterizerDiscard = true) override;
+		virtual void soEnd() override;
+		//[-------------------------------------------------------]
+		//[ Rasterizer (RS) stage                                 ]
+		//[-------------------------------------------------------]
+		virtual void rsSetViewports(unsigned int numberOfViewports, const Renderer::Viewport *viewports) override;
+		virtual void rsSetScissorRectangles(unsigned int numberOfScissorRectangles, const Renderer::ScissorRectangle *scissorRectangles) override;
+		virtual void rsSetState(Renderer::IRasterizerState *rasterizerState) override;
+		//[-------------------------------------------------------]
+		//[ Fragment-shader (FS) stage                            ]
+		//[-------------------------------------------------------]
+		virtual void fsSetTexture(unsigned int unit, Renderer::ITexture *texture) override;
+		virtual void fsSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection) override;
+		virtual void fsSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState) override;
+		virtual void fsSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection) override;
+		virtual void fsSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer) override;
+		//[-------------------------------------------------------]
+		//[ Output-merger (OM) stage                              ]
+		//[-------------------------------------------------------]
+		virtual Renderer::IRenderTarget *omGetRenderTarget() override;
+		virtual void omSetRenderTarget(Renderer::IRenderTarget *renderTarget) override;
+		virtual void omSetDepthStencilState(Renderer::IDepthStencilState *depthStencilState) override;
+		virtual void omSetBlendState(Renderer::IBlendState *blendState) override;
+		//[-------------------------------------------------------]
+		//[ Compute-shader (CS) stage                             ]
+		//[-------------------------------------------------------]
+		virtual void csSetTexture(unsigned int unit, Renderer::ITexture *texture) override;
+		virtual void csSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection) override;
+		virtual void csSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState) override;
+		virtual void csSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection) override;
+		virtual void csSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer) override;
+		virtual void csSetUnorderedAccessView(unsigned int unit, Renderer::IResource *resource) override;
+		//[-------------------------------------------------------]
+		//[ Operations                                            ]
+		//[-------------------------------------------------------]
+		virtual void clear(unsigned int flags, const float color[4], float z, unsigned int stencil) override;
+		virtual bool beginScene() override;
+		virtual void endScene() override;
+		virtual void resolveMultisampleFramebuffer(Renderer::IRenderTarget &destinationRenderTarget, Renderer::IFramebuffer &sourceMultisampleFramebuffer) override;
+		//[-------------------------------------------------------]
+		//[ Draw call                                             ]
+		//[-------------------------------------------------------]
+		virtual void draw(unsigned int startVertexLocation, unsigned int numberOfVertices) override;
+		virtual void drawInstanced(unsigned int startVertexLocation, unsigned int numberOfVertices, unsigned int numberOfInstances) override;
+		virtual void drawIndexed(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int minimumIndex, unsigned int numberOfVertices) override;
+		virtual void drawIndexedInstanced(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int minimumIndex, unsigned int numberOfVertices, unsigned int numberOfInstances) override;
+		virtual void multiDrawIndexedIndirect(Renderer::IIndirectBuffer &indirectBuffer, unsigned int indirectBufferOffset = 0, unsigned int numberOfDraws = 1) override;
+		virtual void drawAuto() override;
+		//[-------------------------------------------------------]
+		//[ Compute                                               ]
+		//[-------------------------------------------------------]
+		virtual void dispatch(unsigned int groupCountX, unsigned int groupCountY, unsigned int groupCountZ) override;
+		virtual void memoryBarrier(unsigned int flags) override;
+		//[-------------------------------------------------------]
+		//[ Synchronization                                       ]
+		//[-------------------------------------------------------]
+		virtual Renderer::IFence *insertFence() override;
+		virtual bool isFenceSignaled(Renderer::IFence &fence) override;
+		virtual bool waitFence(Renderer::IFence &fence, unsigned int timeout = ~0u) override;
+		virtual void flush() override;
+		virtual void finish() override;
+		//[-------------------------------------------------------]
+		//[ Swap chain                                            ]
+		//[-------------------------------------------------------]
+		virtual void presentSwapChains(unsigned int numberOfSwapChains, Renderer::ISwapChain **swapChains) override;
+		//[-------------------------------------------------------]
+		//[ Debug                                                 ]
+		//[-------------------------------------------------------]
+		virtual bool isDebugEnabled() override;
+		virtual void setDebugMarker(const wchar_t *name) override;
+		virtual void beginDebugEvent(const wchar_t *name) override;
+		virtual void endDebugEvent() override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static const unsigned int NUMBER_OF_SHADER_STAGES		  = TraceFormat::ShaderStage::COMPUTE_SHADER + 1;										/**< Number of shader stages */
+		static const unsigned int NUMBER_OF_SHADER_STAGE_COMMANDS = TraceFormat::Command::SET_UNIFORM_BUFFER - TraceFormat::Command::SET_TEXTURE + 1;	/**< Number of shader stage commands, "TraceFormat::Command::SET_TEXTURE" up to "TraceFormat::Command::SET_UNIFORM_BUFFER" */
+		static const unsigned int NUMBER_OF_UNITS				  = 16;																					/**< Number of units or slots per shader stage the redundant calls are detected for */
+
+		/**
+		*  @brief
+		*    Resource which is currently mapped for writing
+		*/
+		struct MappedResource
+		{
+			unsigned int  id;				/**< Trace resource ID */
+			unsigned int  subresource;		/**< Mapped subresource */
+			void		 *data;				/**< Mapped memory, always valid */
+			unsigned int  numberOfBytes;	/**< Number of bytes of the mapped memory */
+			unsigned int  rowPitch;			/**< Row pitch in bytes of mapped textures, 0 for buffers */
+		};
+		typedef std::vector<ShaderLanguage*, Renderer::StlAllocator<ShaderLanguage*> > ShaderLanguages;
+		typedef std::vector<MappedResource, Renderer::StlAllocator<MappedResource> >   MappedResources;
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Return the trace resource of a resource
+		*
+		*  @param[in] resource
+		*    Resource created by a trace renderer, can be a null pointer
+		*
+		*  @return
+		*    The trace resource, null pointer if a null pointer was given
+		*/
+		static TraceResource *getTraceResource(Renderer::IResource *resource);
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Initialize the capabilities by using the capabilities of the wrapped renderer
+		*/
+		void initializeCapabilities();
+
+		/**
+		*  @brief
+		*    Record a shader stage command having a unit or slot and a resource as arguments, redundant calls are counted
+		*
+		*  @param[in] command
+		*    Command to record
+		*  @param[in] shaderStage
+		*    Shader stage
+		*  @param[in] unit
+		*    Unit, start unit or slot
+		*  @param[in] resource
+		*    Trace resource, can be a null pointer
+		*/
+		void recordShaderStage(TraceFormat::Command::Enum command, TraceFormat::ShaderStage::Enum shaderStage, unsigned int unit, Renderer::IResource *resource);
+
+		/**
+		*  @brief
+		*    Record a state command having a single resource as argument, redundant calls are counted
+		*
+		*  @param[in] command
+		*    Command to record
+		*  @param[in] resource
+		*    Trace resource, can be a null pointer
+		*/
+		void recordResource(TraceFormat::Command::Enum command, Renderer::IResource *resource);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Renderer::IRenderer			 *mRenderer;		/**< Wrapped renderer instance (we keep a reference to it in case the trace renderer was initialized successfully), always valid */
+		bool						  mInitialized;		/**< Was the trace renderer initialized successfully? This is the case if there's no trace file or the trace file was created. */
+		TraceWriter					  mTraceWriter;		/**< Trace writer */
+		ShaderLanguages				  mShaderLanguages;	/**< Trace shader language instances (we keep a reference to it) */
+		MappedResources				  mMappedResources;	/**< Resources which are currently mapped for writing */
+		//[-------------------------------------------------------]
+		//[ Output-merger (OM) stage                              ]
+		//[-------------------------------------------------------]
+		SwapChain				*mMainSwapChain;	/**< In case the wrapped renderer has a main swap chain, this holds the trace main swap chain (we keep a reference to it), can be a null pointer */
+		Renderer::IRenderTarget	*mRenderTarget;		/**< Currently set render target (we keep a reference to it), can be a null pointer */
+		//[-------------------------------------------------------]
+		//[ Frame statistics                                      ]
+		//[-------------------------------------------------------]
+		// -> Trace resource IDs are never reused, so comparing them is safe even if resources got destroyed in the meantime
+		Renderer::PrimitiveTopology::Enum mPrimitiveTopology;																			/**< Currently set primitive topology */
+		unsigned int					  mResourceIds[TraceFormat::Command::NUMBER_OF_COMMANDS];										/**< Trace resource ID set by the previous single resource state command, per command */
+		unsigned int					  mShaderStageResourceIds[NUMBER_OF_SHADER_STAGE_COMMANDS][NUMBER_OF_SHADER_STAGES][NUMBER_OF_UNITS];	/**< Trace resource ID set by the previous shader stage command, per command, shader stage and unit */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/TraceRenderer.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __TRACERENDERER_TRACERENDERER_H__
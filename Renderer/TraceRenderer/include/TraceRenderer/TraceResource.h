@@ -0,0 +1,210 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __TRACERENDERER_TRACERESOURCE_H__
+#define __TRACERENDERER_TRACERESOURCE_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/StlAllocator.h>
+
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class IResource;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Forward declarations                                  ]
+	//[-------------------------------------------------------]
+	class TraceRenderer;
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Trace resource base class, each trace resource wraps a resource of the traced renderer
+	*
+	*  @remarks
+	*    The trace resources are derived from the matching renderer resource interface and from this class. The trace resource
+	*    keeps a reference to the wrapped resource and to the trace resources it's using (e.g. the shaders of a program) so
+	*    the lifetime of the trace resources mirrors the lifetime of the wrapped resources. The destruction of a trace resource
+	*    is recorded inside the trace.
+	*/
+	class TraceResource
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return the owner trace renderer instance
+		*
+		*  @return
+		*    The owner trace renderer instance
+		*/
+		inline TraceRenderer &getTraceRenderer() const;
+
+		/**
+		*  @brief
+		*    Return the wrapped resource
+		*
+		*  @return
+		*    The wrapped resource, do not release the returned instance unless you added an own reference to it
+		*/
+		inline Renderer::IResource &getWrappedResource() const;
+
+		/**
+		*  @brief
+		*    Return the trace resource ID
+		*
+		*  @return
+		*    The trace resource ID, never 0
+		*/
+		inline unsigned int getId() const;
+
+		/**
+		*  @brief
+		*    Add a reference to a trace resource this trace resource is using
+		*
+		*  @param[in] resource
+		*    Trace resource this trace resource is using, can be a null pointer (nothing happens), the reference is released
+		*    when this trace resource gets destroyed
+		*/
+		void addReferencedResource(Renderer::IResource *resource);
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] traceRenderer
+		*    Owner trace renderer instance
+		*  @param[in] wrappedResource
+		*    The wrapped resource, we keep a reference to it
+		*/
+		TraceResource(TraceRenderer &traceRenderer, Renderer::IResource &wrappedResource);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~TraceResource();
+
+		/**
+		*  @brief
+		*    Record and forward the debug name of the resource
+		*
+		*  @param[in] name
+		*    ASCII name for debugging purposes, must be valid
+		*/
+		void traceDebugName(const char *name);
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		explicit TraceResource(const TraceResource &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		TraceResource &operator =(const TraceResource &source);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef std::vector<Renderer::IResource*, Renderer::StlAllocator<Renderer::IResource*> > ReferencedResources;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		TraceRenderer		*mTraceRenderer;		/**< Owner trace renderer instance, always valid */
+		Renderer::IResource	*mWrappedResource;		/**< The wrapped resource (we keep a reference to it), always valid */
+		unsigned int		 mId;					/**< Trace resource ID */
+		ReferencedResources	 mReferencedResources;	/**< Trace resources this trace resource is using (we keep a reference to it) */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/TraceResource.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __TRACERENDERER_TRACERESOURCE_H__
@@ -0,0 +1,233 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __TRACERENDERER_TRACEWRITER_H__
+#define __TRACERENDERER_TRACEWRITER_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/TraceFormat.h"
+
+#include <stdio.h>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class IAllocator;
+	struct FrameStatistics;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Buffered writer for the binary renderer API call trace format
+	*
+	*  @remarks
+	*    The command stream is collected within a memory buffer which is written into the trace file as soon as it's full
+	*    or when "flush()" is called. The trace renderer flushes at each present so a crashing application leaves behind a
+	*    trace which can be replayed up to the last completed frame.
+	*
+	*    Each command is counted inside the given frame statistics, even if there's no open trace file. The data written via
+	*    "writeData()" is the data passed by the CPU to the renderer, so it's counted as uploaded data.
+	*
+	*  @see
+	*    - "TraceFormat" for the file layout
+	*/
+	class TraceWriter
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] frameStatistics
+		*    Frame statistics to count the commands and the uploaded bytes in, must stay valid as long as the trace writer exists
+		*  @param[in] allocator
+		*    Allocator to allocate the memory buffer with, must stay valid as long as the trace writer exists
+		*/
+		TraceWriter(Renderer::FrameStatistics &frameStatistics, Renderer::IAllocator &allocator);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		~TraceWriter();
+
+		/**
+		*  @brief
+		*    Open the trace file and write the file header
+		*
+		*  @param[in] filename
+		*    ASCII name of the trace file to create, an existing file is overwritten, must be valid
+		*  @param[in] rendererName
+		*    ASCII name of the renderer backend the trace is captured with, must be valid
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*/
+		bool open(const char *filename, const char *rendererName);
+
+		/**
+		*  @brief
+		*    Flush and close the trace file
+		*/
+		void close();
+
+		/**
+		*  @brief
+		*    Return whether or not the trace file is open
+		*
+		*  @return
+		*    "true" if the trace file is open, else "false"
+		*/
+		inline bool isOpen() const;
+
+		/**
+		*  @brief
+		*    Generate a new resource ID
+		*
+		*  @return
+		*    The new resource ID, never 0
+		*/
+		inline unsigned int generateId();
+
+		/**
+		*  @brief
+		*    Write the content of the memory buffer into the trace file
+		*/
+		void flush();
+
+		//[-------------------------------------------------------]
+		//[ Command stream                                        ]
+		//[-------------------------------------------------------]
+		inline void beginCommand(TraceFormat::Command::Enum command);
+		inline void writeUInt32(unsigned int value);
+		inline void writeInt32(int value);
+		inline void writeFloat(float value);
+		inline void writeFloats(const float *values, unsigned int numberOfValues);
+		inline void writeBool(bool value);
+		inline void writeRaw(const void *data, unsigned int numberOfBytes);
+		void writeData(const void *data, unsigned int numberOfBytes);
+		void writeString(const char *string);
+		void writeWideString(const wchar_t *string);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static const unsigned int BUFFER_SIZE = 64 * 1024;	/**< Size of the memory buffer in bytes, larger writes bypass the memory buffer */
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		explicit TraceWriter(const TraceWriter &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		TraceWriter &operator =(const TraceWriter &source);
+
+		/**
+		*  @brief
+		*    Write the given data into the memory buffer
+		*
+		*  @param[in] data
+		*    Data to write, must be valid
+		*  @param[in] numberOfBytes
+		*    Number of bytes to write
+		*
+		*  @note
+		*    - Does nothing in case the trace file is not open
+		*/
+		void write(const void *data, unsigned int numberOfBytes);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Renderer::FrameStatistics *mFrameStatistics;		/**< Frame statistics to count the commands and the uploaded bytes in, always valid */
+		Renderer::IAllocator	  *mAllocator;				/**< Allocator to allocate the memory buffer with, always valid */
+		FILE					  *mFile;					/**< Trace file, can be a null pointer */
+		unsigned char			  *mBuffer;					/**< Memory buffer, can be a null pointer */
+		unsigned int			   mNumberOfBufferBytes;	/**< Number of bytes currently within the memory buffer */
+		unsigned int			   mNextId;					/**< Next free resource ID */
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/TraceWriter.inl"
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __TRACERENDERER_TRACEWRITER_H__
@@ -0,0 +1,110 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/Mapping.h"
+
+#include <Renderer/Statistics.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Return whether or not the trace file is open
+	*/
+	inline bool TraceWriter::isOpen() const
+	{
+		return (nullptr != mFile);
+	}
+
+	/**
+	*  @brief
+	*    Generate a new resource ID
+	*/
+	inline unsigned int TraceWriter::generateId()
+	{
+		return mNextId++;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Command stream                                        ]
+	//[-------------------------------------------------------]
+	inline void TraceWriter::beginCommand(TraceFormat::Command::Enum command)
+	{
+		// Count the renderer API call, some commands are no renderer API calls
+		const Renderer::ApiCall::Enum apiCall = Mapping::getApiCall(command);
+		if (apiCall < Renderer::ApiCall::NUMBER_OF_API_CALLS)
+		{
+			++mFrameStatistics->numberOfApiCalls[apiCall];
+		}
+
+		// Write the command ID
+		const unsigned char commandId = static_cast<unsigned char>(command);
+		write(&commandId, sizeof(unsigned char));
+	}
+
+	inline void TraceWriter::writeUInt32(unsigned int value)
+	{
+		write(&value, sizeof(unsigned int));
+	}
+
+	inline void TraceWriter::writeInt32(int value)
+	{
+		write(&value, sizeof(int));
+	}
+
+	inline void TraceWriter::writeFloat(float value)
+	{
+		write(&value, sizeof(float));
+	}
+
+	inline void TraceWriter::writeFloats(const float *values, unsigned int numberOfValues)
+	{
+		write(values, sizeof(float) * numberOfValues);
+	}
+
+	inline void TraceWriter::writeBool(bool value)
+	{
+		const unsigned char byte = static_cast<unsigned char>(value ? 1 : 0);
+		write(&byte, sizeof(unsigned char));
+	}
+
+	inline void TraceWriter::writeRaw(const void *data, unsigned int numberOfBytes)
+	{
+		write(data, numberOfBytes);
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
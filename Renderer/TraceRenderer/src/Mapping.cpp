@@ -0,0 +1,200 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/Mapping.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	//[-------------------------------------------------------]
+	//[ Renderer::TextureFormat                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    "Renderer::TextureFormat" to number of bytes per texel
+	*/
+	unsigned int Mapping::getSize(Renderer::TextureFormat::Enum textureFormat)
+	{
+		static const unsigned int MAPPING[] =
+		{
+			1,	// Renderer::TextureFormat::A8            - 8-bit pixel format, all bits alpha
+			3,	// Renderer::TextureFormat::R8G8B8        - 24-bit pixel format, 8 bits for red, green and blue
+			4,	// Renderer::TextureFormat::R8G8B8A8      - 32-bit pixel format, 8 bits for red, green, blue and alpha
+			8,	// Renderer::TextureFormat::R16G16B16A16F - 64-bit float format using 16 bits for the each channel (red, green, blue, alpha)
+			16	// Renderer::TextureFormat::R32G32B32A32F - 128-bit float format using 32 bits for the each channel (red, green, blue, alpha)
+		};
+		return MAPPING[textureFormat];
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Renderer::PrimitiveTopology                           ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    "Renderer::PrimitiveTopology" and number of vertices to number of primitives
+	*/
+	unsigned int Mapping::getNumberOfPrimitives(Renderer::PrimitiveTopology::Enum primitiveTopology, unsigned int numberOfVertices)
+	{
+		switch (primitiveTopology)
+		{
+			case Renderer::PrimitiveTopology::POINT_LIST:
+				return numberOfVertices;
+
+			case Renderer::PrimitiveTopology::LINE_LIST:
+				return numberOfVertices / 2;
+
+			case Renderer::PrimitiveTopology::LINE_STRIP:
+				return (numberOfVertices > 1) ? numberOfVertices - 1 : 0;
+
+			case Renderer::PrimitiveTopology::TRIANGLE_LIST:
+				return numberOfVertices / 3;
+
+			case Renderer::PrimitiveTopology::TRIANGLE_STRIP:
+				return (numberOfVertices > 2) ? numberOfVertices - 2 : 0;
+
+			case Renderer::PrimitiveTopology::UNKNOWN:
+				return 0;
+
+			default:
+				// Patch list, the number of vertices per patch is encoded inside the primitive topology
+				return (primitiveTopology >= Renderer::PrimitiveTopology::PATCH_LIST_1) ? numberOfVertices / (primitiveTopology - Renderer::PrimitiveTopology::PATCH_LIST_1 + 1) : 0;
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ TraceFormat::Command                                  ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    "TraceFormat::Command" to "Renderer::ApiCall"
+	*/
+	Renderer::ApiCall::Enum Mapping::getApiCall(TraceFormat::Command::Enum command)
+	{
+		static const Renderer::ApiCall::Enum MAPPING[TraceFormat::Command::NUMBER_OF_COMMANDS] =
+		{
+			Renderer::ApiCall::NUMBER_OF_API_CALLS,				// TraceFormat::Command::MAIN_SWAP_CHAIN
+			Renderer::ApiCall::OTHER,							// TraceFormat::Command::GET_SHADER_LANGUAGE
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_SWAP_CHAIN
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_FRAMEBUFFER
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_VERTEX_BUFFER
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_INDEX_BUFFER
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_TEXTURE_BUFFER
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_INDIRECT_BUFFER
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_TEXTURE_2D
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_TEXTURE_2D_ARRAY
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_RASTERIZER_STATE
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_DEPTH_STENCIL_STATE
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_BLEND_STATE
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_SAMPLER_STATE
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_TEXTURE_COLLECTION
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_SAMPLER_STATE_COLLECTION
+			Renderer::ApiCall::MAP,								// TraceFormat::Command::MAP
+			Renderer::ApiCall::UNMAP,							// TraceFormat::Command::UNMAP
+			Renderer::ApiCall::COPY_RESOURCE,					// TraceFormat::Command::COPY_RESOURCE
+			Renderer::ApiCall::SET_PROGRAM,						// TraceFormat::Command::SET_PROGRAM
+			Renderer::ApiCall::IA_SET_VERTEX_ARRAY,				// TraceFormat::Command::IA_SET_VERTEX_ARRAY
+			Renderer::ApiCall::IA_SET_PRIMITIVE_TOPOLOGY,		// TraceFormat::Command::IA_SET_PRIMITIVE_TOPOLOGY
+			Renderer::ApiCall::SET_TEXTURE,						// TraceFormat::Command::SET_TEXTURE
+			Renderer::ApiCall::SET_TEXTURE_COLLECTION,			// TraceFormat::Command::SET_TEXTURE_COLLECTION
+			Renderer::ApiCall::SET_SAMPLER_STATE,				// TraceFormat::Command::SET_SAMPLER_STATE
+			Renderer::ApiCall::SET_SAMPLER_STATE_COLLECTION,	// TraceFormat::Command::SET_SAMPLER_STATE_COLLECTION
+			Renderer::ApiCall::SET_UNIFORM_BUFFER,				// TraceFormat::Command::SET_UNIFORM_BUFFER
+			Renderer::ApiCall::SO_SET_TARGETS,					// TraceFormat::Command::SO_SET_TARGETS
+			Renderer::ApiCall::SO_BEGIN,						// TraceFormat::Command::SO_BEGIN
+			Renderer::ApiCall::SO_END,							// TraceFormat::Command::SO_END
+			Renderer::ApiCall::RS_SET_VIEWPORTS,				// TraceFormat::Command::RS_SET_VIEWPORTS
+			Renderer::ApiCall::RS_SET_SCISSOR_RECTANGLES,		// TraceFormat::Command::RS_SET_SCISSOR_RECTANGLES
+			Renderer::ApiCall::RS_SET_STATE,					// TraceFormat::Command::RS_SET_STATE
+			Renderer::ApiCall::OM_SET_RENDER_TARGET,			// TraceFormat::Command::OM_SET_RENDER_TARGET
+			Renderer::ApiCall::OM_SET_DEPTH_STENCIL_STATE,		// TraceFormat::Command::OM_SET_DEPTH_STENCIL_STATE
+			Renderer::ApiCall::OM_SET_BLEND_STATE,				// TraceFormat::Command::OM_SET_BLEND_STATE
+			Renderer::ApiCall::CS_SET_UNORDERED_ACCESS_VIEW,	// TraceFormat::Command::CS_SET_UNORDERED_ACCESS_VIEW
+			Renderer::ApiCall::CLEAR,							// TraceFormat::Command::CLEAR
+			Renderer::ApiCall::BEGIN_SCENE,						// TraceFormat::Command::BEGIN_SCENE
+			Renderer::ApiCall::END_SCENE,						// TraceFormat::Command::END_SCENE
+			Renderer::ApiCall::RESOLVE_MULTISAMPLE_FRAMEBUFFER,	// TraceFormat::Command::RESOLVE_MULTISAMPLE_FRAMEBUFFER
+			Renderer::ApiCall::DRAW,							// TraceFormat::Command::DRAW
+			Renderer::ApiCall::DRAW_INSTANCED,					// TraceFormat::Command::DRAW_INSTANCED
+			Renderer::ApiCall::DRAW_INDEXED,					// TraceFormat::Command::DRAW_INDEXED
+			Renderer::ApiCall::DRAW_INDEXED_INSTANCED,			// TraceFormat::Command::DRAW_INDEXED_INSTANCED
+			Renderer::ApiCall::MULTI_DRAW_INDEXED_INDIRECT,		// TraceFormat::Command::MULTI_DRAW_INDEXED_INDIRECT
+			Renderer::ApiCall::DRAW_AUTO,						// TraceFormat::Command::DRAW_AUTO
+			Renderer::ApiCall::DISPATCH,						// TraceFormat::Command::DISPATCH
+			Renderer::ApiCall::MEMORY_BARRIER,					// TraceFormat::Command::MEMORY_BARRIER
+			Renderer::ApiCall::INSERT_FENCE,					// TraceFormat::Command::INSERT_FENCE
+			Renderer::ApiCall::IS_FENCE_SIGNALED,				// TraceFormat::Command::IS_FENCE_SIGNALED
+			Renderer::ApiCall::WAIT_FENCE,						// TraceFormat::Command::WAIT_FENCE
+			Renderer::ApiCall::FLUSH,							// TraceFormat::Command::FLUSH
+			Renderer::ApiCall::FINISH,							// TraceFormat::Command::FINISH
+			Renderer::ApiCall::DEBUG,							// TraceFormat::Command::SET_DEBUG_MARKER
+			Renderer::ApiCall::DEBUG,							// TraceFormat::Command::BEGIN_DEBUG_EVENT
+			Renderer::ApiCall::DEBUG,							// TraceFormat::Command::END_DEBUG_EVENT
+			Renderer::ApiCall::DESTROY_RESOURCE,				// TraceFormat::Command::RELEASE_RESOURCE
+			Renderer::ApiCall::DEBUG,							// TraceFormat::Command::SET_DEBUG_NAME
+			Renderer::ApiCall::PRESENT,							// TraceFormat::Command::PRESENT
+			Renderer::ApiCall::RESIZE_BUFFERS,					// TraceFormat::Command::RESIZE_BUFFERS
+			Renderer::ApiCall::SET_FULLSCREEN_STATE,			// TraceFormat::Command::SET_FULLSCREEN_STATE
+			Renderer::ApiCall::COPY_DATA_FROM,					// TraceFormat::Command::COPY_DATA_FROM
+			Renderer::ApiCall::UPDATE_REGION,					// TraceFormat::Command::UPDATE_REGION_2D
+			Renderer::ApiCall::UPDATE_REGION,					// TraceFormat::Command::UPDATE_REGION_2D_ARRAY
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_VERTEX_ARRAY
+			Renderer::ApiCall::OTHER,							// TraceFormat::Command::SET_STREAM_OUTPUT_VARYINGS
+			Renderer::ApiCall::OTHER,							// TraceFormat::Command::GET_ATTRIBUTE_LOCATION
+			Renderer::ApiCall::OTHER,							// TraceFormat::Command::GET_UNIFORM_BLOCK_INDEX
+			Renderer::ApiCall::OTHER,							// TraceFormat::Command::GET_UNIFORM_HANDLE
+			Renderer::ApiCall::SET_UNIFORM,						// TraceFormat::Command::SET_TEXTURE_UNIT
+			Renderer::ApiCall::SET_UNIFORM,						// TraceFormat::Command::SET_UNIFORM_1I
+			Renderer::ApiCall::SET_UNIFORM,						// TraceFormat::Command::SET_UNIFORM_1F
+			Renderer::ApiCall::SET_UNIFORM,						// TraceFormat::Command::SET_UNIFORM_2FV
+			Renderer::ApiCall::SET_UNIFORM,						// TraceFormat::Command::SET_UNIFORM_3FV
+			Renderer::ApiCall::SET_UNIFORM,						// TraceFormat::Command::SET_UNIFORM_4FV
+			Renderer::ApiCall::SET_UNIFORM,						// TraceFormat::Command::SET_UNIFORM_MATRIX_3FV
+			Renderer::ApiCall::SET_UNIFORM,						// TraceFormat::Command::SET_UNIFORM_MATRIX_4FV
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_VERTEX_SHADER
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_TESSELLATION_CONTROL_SHADER
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_TESSELLATION_EVALUATION_SHADER
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_GEOMETRY_SHADER
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_FRAGMENT_SHADER
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_PROGRAM
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_COMPUTE_SHADER
+			Renderer::ApiCall::CREATE_RESOURCE,					// TraceFormat::Command::CREATE_COMPUTE_PROGRAM
+			Renderer::ApiCall::CREATE_RESOURCE					// TraceFormat::Command::CREATE_UNIFORM_BUFFER
+		};
+		return MAPPING[command];
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
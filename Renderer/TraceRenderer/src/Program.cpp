@@ -0,0 +1,323 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/Program.h"
+#include "TraceRenderer/TraceRenderer.h"
+#include "TraceRenderer/VertexArray.h"
+#include "TraceRenderer/IndexBuffer.h"
+#include "TraceRenderer/VertexBuffer.h"
+
+#include <Renderer/VertexArrayTypes.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	Program::Program(TraceRenderer &traceRenderer, Renderer::IProgram &program) :
+		IProgram(traceRenderer),
+		TraceResource(traceRenderer, program),
+		mUniformHandles(Renderer::StlAllocator<handle>(traceRenderer.getAllocator(), Renderer::AllocationTag::RESOURCE))
+	{
+		// Nothing to do in here
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	Program::~Program()
+	{
+		// Nothing to do in here
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IResource methods            ]
+	//[-------------------------------------------------------]
+	void Program::setDebugName(const char *name)
+	{
+		// Call the base implementation, updates the statistics
+		IResource::setDebugName(name);
+
+		// Record and forward
+		traceDebugName(name);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IProgram methods             ]
+	//[-------------------------------------------------------]
+	Renderer::IVertexArray *Program::createVertexArray(unsigned int numberOfAttributes, const Renderer::VertexArrayAttribute *attributes, Renderer::IIndexBuffer *indexBuffer)
+	{
+		// Replace the trace vertex buffers by the wrapped vertex buffers
+		std::vector<Renderer::VertexArrayAttribute, Renderer::StlAllocator<Renderer::VertexArrayAttribute> > wrappedAttributes(attributes, attributes + numberOfAttributes, Renderer::StlAllocator<Renderer::VertexArrayAttribute>(getTraceRenderer().getAllocator(), Renderer::AllocationTag::TEMPORARY));
+		for (unsigned int i = 0; i < numberOfAttributes; ++i)
+		{
+			wrappedAttributes[i].vertexBuffer = static_cast<Renderer::IVertexBuffer*>(TraceRenderer::unwrapResource(attributes[i].vertexBuffer));
+		}
+
+		// Forward
+		Renderer::IVertexArray *vertexArray = static_cast<Renderer::IProgram&>(getWrappedResource()).createVertexArray(numberOfAttributes, wrappedAttributes.empty() ? nullptr : &wrappedAttributes[0], static_cast<Renderer::IIndexBuffer*>(TraceRenderer::unwrapResource(indexBuffer)));
+		if (nullptr != vertexArray)
+		{
+			// Create the trace vertex array, it keeps a reference to the used trace vertex buffers and the trace index buffer just like the wrapped vertex array
+			VertexArray *traceVertexArray = new (getTraceRenderer().getAllocator()) VertexArray(getTraceRenderer(), *vertexArray);
+			for (unsigned int i = 0; i < numberOfAttributes; ++i)
+			{
+				traceVertexArray->addReferencedResource(attributes[i].vertexBuffer);
+			}
+			traceVertexArray->addReferencedResource(indexBuffer);
+
+			// Record
+			TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+			traceWriter.beginCommand(TraceFormat::Command::CREATE_VERTEX_ARRAY);
+			traceWriter.writeUInt32(getId());
+			traceWriter.writeUInt32(traceVertexArray->getId());
+			traceWriter.writeUInt32(numberOfAttributes);
+			for (unsigned int i = 0; i < numberOfAttributes; ++i)
+			{
+				const Renderer::VertexArrayAttribute &attribute = attributes[i];
+				traceWriter.writeUInt32(static_cast<unsigned int>(attribute.vertexArrayFormat));
+				traceWriter.writeRaw(attribute.name, sizeof(attribute.name));
+				traceWriter.writeRaw(attribute.semantic, sizeof(attribute.semantic));
+				traceWriter.writeUInt32(attribute.semanticIndex);
+				traceWriter.writeUInt32(TraceRenderer::getResourceId(attribute.vertexBuffer));
+				traceWriter.writeUInt32(attribute.offset);
+				traceWriter.writeUInt32(attribute.stride);
+				traceWriter.writeUInt32(attribute.instancesPerElement);
+			}
+			traceWriter.writeUInt32(TraceRenderer::getResourceId(indexBuffer));
+
+			// Done
+			return traceVertexArray;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	bool Program::setStreamOutputVaryings(unsigned int numberOfVaryings, const char **varyingNames, bool interleaved)
+	{
+		// Record
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::SET_STREAM_OUTPUT_VARYINGS);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeUInt32(numberOfVaryings);
+		for (unsigned int i = 0; i < numberOfVaryings; ++i)
+		{
+			traceWriter.writeString(varyingNames[i]);
+		}
+		traceWriter.writeBool(interleaved);
+
+		// Forward
+		return static_cast<Renderer::IProgram&>(getWrappedResource()).setStreamOutputVaryings(numberOfVaryings, varyingNames, interleaved);
+	}
+
+	int Program::getAttributeLocation(const char *attributeName)
+	{
+		// Record
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::GET_ATTRIBUTE_LOCATION);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeString(attributeName);
+
+		// Forward
+		return static_cast<Renderer::IProgram&>(getWrappedResource()).getAttributeLocation(attributeName);
+	}
+
+	unsigned int Program::getUniformBlockIndex(const char *uniformBlockName, unsigned int defaultIndex)
+	{
+		// Record
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::GET_UNIFORM_BLOCK_INDEX);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeString(uniformBlockName);
+		traceWriter.writeUInt32(defaultIndex);
+
+		// Forward
+		return static_cast<Renderer::IProgram&>(getWrappedResource()).getUniformBlockIndex(uniformBlockName, defaultIndex);
+	}
+
+	handle Program::getUniformHandle(const char *uniformName)
+	{
+		// Forward
+		const handle uniformHandle = static_cast<Renderer::IProgram&>(getWrappedResource()).getUniformHandle(uniformName);
+
+		// Uniform handles are program specific, e.g. OpenGL uniform locations, so we hand out one based indices into
+		// the table of uniform handles of this program instead (a null handle can be a valid OpenGL uniform location)
+		unsigned int uniformHandleIndex = 0;
+		const size_t numberOfUniformHandles = mUniformHandles.size();
+		while (uniformHandleIndex < numberOfUniformHandles && mUniformHandles[uniformHandleIndex] != uniformHandle)
+		{
+			++uniformHandleIndex;
+		}
+		if (uniformHandleIndex == numberOfUniformHandles)
+		{
+			mUniformHandles.push_back(uniformHandle);
+		}
+		++uniformHandleIndex;
+
+		// Record
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::GET_UNIFORM_HANDLE);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeString(uniformName);
+		traceWriter.writeUInt32(uniformHandleIndex);
+
+		// Done
+		return static_cast<handle>(uniformHandleIndex);
+	}
+
+	unsigned int Program::setTextureUnit(handle uniformHandle, unsigned int unit)
+	{
+		// Record
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::SET_TEXTURE_UNIT);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeUInt32(static_cast<unsigned int>(uniformHandle));
+		traceWriter.writeUInt32(unit);
+
+		// Forward
+		return static_cast<Renderer::IProgram&>(getWrappedResource()).setTextureUnit(getWrappedUniformHandle(uniformHandle), unit);
+	}
+
+	void Program::setUniform1i(handle uniformHandle, int value)
+	{
+		// Record
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::SET_UNIFORM_1I);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeUInt32(static_cast<unsigned int>(uniformHandle));
+		traceWriter.writeInt32(value);
+
+		// Forward
+		static_cast<Renderer::IProgram&>(getWrappedResource()).setUniform1i(getWrappedUniformHandle(uniformHandle), value);
+	}
+
+	void Program::setUniform1f(handle uniformHandle, float value)
+	{
+		// Record
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::SET_UNIFORM_1F);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeUInt32(static_cast<unsigned int>(uniformHandle));
+		traceWriter.writeFloat(value);
+
+		// Forward
+		static_cast<Renderer::IProgram&>(getWrappedResource()).setUniform1f(getWrappedUniformHandle(uniformHandle), value);
+	}
+
+	void Program::setUniform2fv(handle uniformHandle, const float *value)
+	{
+		// Record
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::SET_UNIFORM_2FV);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeUInt32(static_cast<unsigned int>(uniformHandle));
+		traceWriter.writeFloats(value, 2);
+
+		// Forward
+		static_cast<Renderer::IProgram&>(getWrappedResource()).setUniform2fv(getWrappedUniformHandle(uniformHandle), value);
+	}
+
+	void Program::setUniform3fv(handle uniformHandle, const float *value)
+	{
+		// Record
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::SET_UNIFORM_3FV);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeUInt32(static_cast<unsigned int>(uniformHandle));
+		traceWriter.writeFloats(value, 3);
+
+		// Forward
+		static_cast<Renderer::IProgram&>(getWrappedResource()).setUniform3fv(getWrappedUniformHandle(uniformHandle), value);
+	}
+
+	void Program::setUniform4fv(handle uniformHandle, const float *value)
+	{
+		// Record
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::SET_UNIFORM_4FV);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeUInt32(static_cast<unsigned int>(uniformHandle));
+		traceWriter.writeFloats(value, 4);
+
+		// Forward
+		static_cast<Renderer::IProgram&>(getWrappedResource()).setUniform4fv(getWrappedUniformHandle(uniformHandle), value);
+	}
+
+	void Program::setUniformMatrix3fv(handle uniformHandle, const float *value)
+	{
+		// Record
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::SET_UNIFORM_MATRIX_3FV);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeUInt32(static_cast<unsigned int>(uniformHandle));
+		traceWriter.writeFloats(value, 9);
+
+		// Forward
+		static_cast<Renderer::IProgram&>(getWrappedResource()).setUniformMatrix3fv(getWrappedUniformHandle(uniformHandle), value);
+	}
+
+	void Program::setUniformMatrix4fv(handle uniformHandle, const float *value)
+	{
+		// Record
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::SET_UNIFORM_MATRIX_4FV);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeUInt32(static_cast<unsigned int>(uniformHandle));
+		traceWriter.writeFloats(value, 16);
+
+		// Forward
+		static_cast<Renderer::IProgram&>(getWrappedResource()).setUniformMatrix4fv(getWrappedUniformHandle(uniformHandle), value);
+	}
+
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Return the wrapped uniform handle of a trace uniform handle
+	*/
+	handle Program::getWrappedUniformHandle(handle uniformHandle) const
+	{
+		return (uniformHandle > 0 && uniformHandle <= mUniformHandles.size()) ? mUniformHandles[static_cast<size_t>(uniformHandle - 1)] : NULL_HANDLE;
+	}
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
@@ -0,0 +1,379 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/ShaderLanguage.h"
+#include "TraceRenderer/TraceRenderer.h"
+#include "TraceRenderer/Program.h"
+#include "TraceRenderer/UniformBuffer.h"
+#include "TraceRenderer/VertexShader.h"
+#include "TraceRenderer/ComputeShader.h"
+#include "TraceRenderer/GeometryShader.h"
+#include "TraceRenderer/FragmentShader.h"
+#include "TraceRenderer/TessellationControlShader.h"
+#include "TraceRenderer/TessellationEvaluationShader.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	ShaderLanguage::ShaderLanguage(TraceRenderer &traceRenderer, Renderer::IShaderLanguage &shaderLanguage) :
+		IShaderLanguage(traceRenderer),
+		mShaderLanguage(&shaderLanguage),
+		mId(traceRenderer.getTraceWriter().generateId())
+	{
+		mShaderLanguage->addReference();
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	ShaderLanguage::~ShaderLanguage()
+	{
+		// Record the destruction of the shader language
+		TraceWriter &traceWriter = static_cast<TraceRenderer&>(getRenderer()).getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::RELEASE_RESOURCE);
+		traceWriter.writeUInt32(mId);
+
+		// Release the wrapped shader language
+		mShaderLanguage->release();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IShaderLanguage methods      ]
+	//[-------------------------------------------------------]
+	const char *ShaderLanguage::getShaderLanguageName() const
+	{
+		return mShaderLanguage->getShaderLanguageName();
+	}
+
+	Renderer::IVertexShader *ShaderLanguage::createVertexShader(const char *sourceCode, const char *profile, const char *arguments, const char *entry)
+	{
+		// Forward
+		Renderer::IVertexShader *vertexShader = mShaderLanguage->createVertexShader(sourceCode, profile, arguments, entry);
+		if (nullptr != vertexShader)
+		{
+			// Create the trace vertex shader
+			VertexShader *traceVertexShader = new (getRenderer().getAllocator()) VertexShader(static_cast<TraceRenderer&>(getRenderer()), *vertexShader);
+
+			// Record
+			TraceWriter &traceWriter = static_cast<TraceRenderer&>(getRenderer()).getTraceWriter();
+			traceWriter.beginCommand(TraceFormat::Command::CREATE_VERTEX_SHADER);
+			traceWriter.writeUInt32(mId);
+			traceWriter.writeUInt32(traceVertexShader->getId());
+			traceWriter.writeString(sourceCode);
+			traceWriter.writeString(profile);
+			traceWriter.writeString(arguments);
+			traceWriter.writeString(entry);
+
+			// Done
+			return traceVertexShader;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::ITessellationControlShader *ShaderLanguage::createTessellationControlShader(const char *sourceCode, const char *profile, const char *arguments, const char *entry)
+	{
+		// Forward
+		Renderer::ITessellationControlShader *tessellationControlShader = mShaderLanguage->createTessellationControlShader(sourceCode, profile, arguments, entry);
+		if (nullptr != tessellationControlShader)
+		{
+			// Create the trace tessellation control shader
+			TessellationControlShader *traceTessellationControlShader = new (getRenderer().getAllocator()) TessellationControlShader(static_cast<TraceRenderer&>(getRenderer()), *tessellationControlShader);
+
+			// Record
+			TraceWriter &traceWriter = static_cast<TraceRenderer&>(getRenderer()).getTraceWriter();
+			traceWriter.beginCommand(TraceFormat::Command::CREATE_TESSELLATION_CONTROL_SHADER);
+			traceWriter.writeUInt32(mId);
+			traceWriter.writeUInt32(traceTessellationControlShader->getId());
+			traceWriter.writeString(sourceCode);
+			traceWriter.writeString(profile);
+			traceWriter.writeString(arguments);
+			traceWriter.writeString(entry);
+
+			// Done
+			return traceTessellationControlShader;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::ITessellationEvaluationShader *ShaderLanguage::createTessellationEvaluationShader(const char *sourceCode, const char *profile, const char *arguments, const char *entry)
+	{
+		// Forward
+		Renderer::ITessellationEvaluationShader *tessellationEvaluationShader = mShaderLanguage->createTessellationEvaluationShader(sourceCode, profile, arguments, entry);
+		if (nullptr != tessellationEvaluationShader)
+		{
+			// Create the trace tessellation evaluation shader
+			TessellationEvaluationShader *traceTessellationEvaluationShader = new (getRenderer().getAllocator()) TessellationEvaluationShader(static_cast<TraceRenderer&>(getRenderer()), *tessellationEvaluationShader);
+
+			// Record
+			TraceWriter &traceWriter = static_cast<TraceRenderer&>(getRenderer()).getTraceWriter();
+			traceWriter.beginCommand(TraceFormat::Command::CREATE_TESSELLATION_EVALUATION_SHADER);
+			traceWriter.writeUInt32(mId);
+			traceWriter.writeUInt32(traceTessellationEvaluationShader->getId());
+			traceWriter.writeString(sourceCode);
+			traceWriter.writeString(profile);
+			traceWriter.writeString(arguments);
+			traceWriter.writeString(entry);
+
+			// Done
+			return traceTessellationEvaluationShader;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::IGeometryShader *ShaderLanguage::createGeometryShader(const char *sourceCode, Renderer::GsInputPrimitiveTopology::Enum gsInputPrimitiveTopology, Renderer::GsOutputPrimitiveTopology::Enum gsOutputPrimitiveTopology, unsigned int numberOfOutputVertices, const char *profile, const char *arguments, const char *entry)
+	{
+		// Forward
+		Renderer::IGeometryShader *geometryShader = mShaderLanguage->createGeometryShader(sourceCode, gsInputPrimitiveTopology, gsOutputPrimitiveTopology, numberOfOutputVertices, profile, arguments, entry);
+		if (nullptr != geometryShader)
+		{
+			// Create the trace geometry shader
+			GeometryShader *traceGeometryShader = new (getRenderer().getAllocator()) GeometryShader(static_cast<TraceRenderer&>(getRenderer()), *geometryShader);
+
+			// Record
+			TraceWriter &traceWriter = static_cast<TraceRenderer&>(getRenderer()).getTraceWriter();
+			traceWriter.beginCommand(TraceFormat::Command::CREATE_GEOMETRY_SHADER);
+			traceWriter.writeUInt32(mId);
+			traceWriter.writeUInt32(traceGeometryShader->getId());
+			traceWriter.writeString(sourceCode);
+			traceWriter.writeUInt32(static_cast<unsigned int>(gsInputPrimitiveTopology));
+			traceWriter.writeUInt32(static_cast<unsigned int>(gsOutputPrimitiveTopology));
+			traceWriter.writeUInt32(numberOfOutputVertices);
+			traceWriter.writeString(profile);
+			traceWriter.writeString(arguments);
+			traceWriter.writeString(entry);
+
+			// Done
+			return traceGeometryShader;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::IFragmentShader *ShaderLanguage::createFragmentShader(const char *sourceCode, const char *profile, const char *arguments, const char *entry)
+	{
+		// Forward
+		Renderer::IFragmentShader *fragmentShader = mShaderLanguage->createFragmentShader(sourceCode, profile, arguments, entry);
+		if (nullptr != fragmentShader)
+		{
+			// Create the trace fragment shader
+			FragmentShader *traceFragmentShader = new (getRenderer().getAllocator()) FragmentShader(static_cast<TraceRenderer&>(getRenderer()), *fragmentShader);
+
+			// Record
+			TraceWriter &traceWriter = static_cast<TraceRenderer&>(getRenderer()).getTraceWriter();
+			traceWriter.beginCommand(TraceFormat::Command::CREATE_FRAGMENT_SHADER);
+			traceWriter.writeUInt32(mId);
+			traceWriter.writeUInt32(traceFragmentShader->getId());
+			traceWriter.writeString(sourceCode);
+			traceWriter.writeString(profile);
+			traceWriter.writeString(arguments);
+			traceWriter.writeString(entry);
+
+			// Done
+			return traceFragmentShader;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::IProgram *ShaderLanguage::createProgram(Renderer::IVertexShader *vertexShader, Renderer::ITessellationControlShader *tessellationControlShader, Renderer::ITessellationEvaluationShader *tessellationEvaluationShader, Renderer::IGeometryShader *geometryShader, Renderer::IFragmentShader *fragmentShader)
+	{
+		// Forward using the wrapped shaders
+		Renderer::IProgram *program = mShaderLanguage->createProgram(static_cast<Renderer::IVertexShader*>(TraceRenderer::unwrapResource(vertexShader)),
+																	 static_cast<Renderer::ITessellationControlShader*>(TraceRenderer::unwrapResource(tessellationControlShader)),
+																	 static_cast<Renderer::ITessellationEvaluationShader*>(TraceRenderer::unwrapResource(tessellationEvaluationShader)),
+																	 static_cast<Renderer::IGeometryShader*>(TraceRenderer::unwrapResource(geometryShader)),
+																	 static_cast<Renderer::IFragmentShader*>(TraceRenderer::unwrapResource(fragmentShader)));
+
+		// The trace program keeps a reference to the trace shaders just like the wrapped program
+		// -> Ensure a correct reference counter behaviour, even in the situation of an error
+		Program *traceProgram = (nullptr != program) ? new (getRenderer().getAllocator()) Program(static_cast<TraceRenderer&>(getRenderer()), *program) : nullptr;
+		Renderer::IResource *shaders[] = { vertexShader, tessellationControlShader, tessellationEvaluationShader, geometryShader, fragmentShader };
+		for (int i = 0; i < 5; ++i)
+		{
+			if (nullptr != shaders[i])
+			{
+				shaders[i]->addReference();
+				if (nullptr != traceProgram)
+				{
+					traceProgram->addReferencedResource(shaders[i]);
+				}
+				shaders[i]->release();
+			}
+		}
+
+		// Record
+		if (nullptr != traceProgram)
+		{
+			TraceWriter &traceWriter = static_cast<TraceRenderer&>(getRenderer()).getTraceWriter();
+			traceWriter.beginCommand(TraceFormat::Command::CREATE_PROGRAM);
+			traceWriter.writeUInt32(mId);
+			traceWriter.writeUInt32(traceProgram->getId());
+			traceWriter.writeUInt32(TraceRenderer::getResourceId(vertexShader));
+			traceWriter.writeUInt32(TraceRenderer::getResourceId(tessellationControlShader));
+			traceWriter.writeUInt32(TraceRenderer::getResourceId(tessellationEvaluationShader));
+			traceWriter.writeUInt32(TraceRenderer::getResourceId(geometryShader));
+			traceWriter.writeUInt32(TraceRenderer::getResourceId(fragmentShader));
+		}
+
+		// Done
+		return traceProgram;
+	}
+
+	Renderer::IComputeShader *ShaderLanguage::createComputeShader(const char *sourceCode, const char *profile, const char *arguments, const char *entry)
+	{
+		// Forward
+		Renderer::IComputeShader *computeShader = mShaderLanguage->createComputeShader(sourceCode, profile, arguments, entry);
+		if (nullptr != computeShader)
+		{
+			// Create the trace compute shader
+			ComputeShader *traceComputeShader = new (getRenderer().getAllocator()) ComputeShader(static_cast<TraceRenderer&>(getRenderer()), *computeShader);
+
+			// Record
+			TraceWriter &traceWriter = static_cast<TraceRenderer&>(getRenderer()).getTraceWriter();
+			traceWriter.beginCommand(TraceFormat::Command::CREATE_COMPUTE_SHADER);
+			traceWriter.writeUInt32(mId);
+			traceWriter.writeUInt32(traceComputeShader->getId());
+			traceWriter.writeString(sourceCode);
+			traceWriter.writeString(profile);
+			traceWriter.writeString(arguments);
+			traceWriter.writeString(entry);
+
+			// Done
+			return traceComputeShader;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::IProgram *ShaderLanguage::createComputeProgram(Renderer::IComputeShader *computeShader)
+	{
+		// Forward using the wrapped compute shader
+		Renderer::IProgram *program = mShaderLanguage->createComputeProgram(static_cast<Renderer::IComputeShader*>(TraceRenderer::unwrapResource(computeShader)));
+
+		// The trace program keeps a reference to the trace compute shader just like the wrapped program
+		// -> Ensure a correct reference counter behaviour, even in the situation of an error
+		Program *traceProgram = (nullptr != program) ? new (getRenderer().getAllocator()) Program(static_cast<TraceRenderer&>(getRenderer()), *program) : nullptr;
+		if (nullptr != computeShader)
+		{
+			computeShader->addReference();
+			if (nullptr != traceProgram)
+			{
+				traceProgram->addReferencedResource(computeShader);
+			}
+			computeShader->release();
+		}
+
+		// Record
+		if (nullptr != traceProgram)
+		{
+			TraceWriter &traceWriter = static_cast<TraceRenderer&>(getRenderer()).getTraceWriter();
+			traceWriter.beginCommand(TraceFormat::Command::CREATE_COMPUTE_PROGRAM);
+			traceWriter.writeUInt32(mId);
+			traceWriter.writeUInt32(traceProgram->getId());
+			traceWriter.writeUInt32(TraceRenderer::getResourceId(computeShader));
+		}
+
+		// Done
+		return traceProgram;
+	}
+
+	Renderer::IUniformBuffer *ShaderLanguage::createUniformBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
+	{
+		// Forward
+		Renderer::IUniformBuffer *uniformBuffer = mShaderLanguage->createUniformBuffer(numberOfBytes, data, bufferUsage);
+		if (nullptr != uniformBuffer)
+		{
+			// Create the trace uniform buffer
+			UniformBuffer *traceUniformBuffer = new (getRenderer().getAllocator()) UniformBuffer(static_cast<TraceRenderer&>(getRenderer()), *uniformBuffer, numberOfBytes);
+
+			// Record
+			TraceWriter &traceWriter = static_cast<TraceRenderer&>(getRenderer()).getTraceWriter();
+			traceWriter.beginCommand(TraceFormat::Command::CREATE_UNIFORM_BUFFER);
+			traceWriter.writeUInt32(mId);
+			traceWriter.writeUInt32(traceUniformBuffer->getId());
+			traceWriter.writeUInt32(numberOfBytes);
+			traceWriter.writeUInt32(static_cast<unsigned int>(bufferUsage));
+			traceWriter.writeData(data, numberOfBytes);
+
+			// Done
+			return traceUniformBuffer;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Copy constructor
+	*/
+	ShaderLanguage::ShaderLanguage(const ShaderLanguage &source) :
+		IShaderLanguage(source),
+		mShaderLanguage(source.mShaderLanguage),
+		mId(0)
+	{
+		// Not supported
+	}
+
+	/**
+	*  @brief
+	*    Copy operator
+	*/
+	ShaderLanguage &ShaderLanguage::operator =(const ShaderLanguage &)
+	{
+		// Not supported
+		return *this;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
@@ -0,0 +1,173 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/SwapChain.h"
+#include "TraceRenderer/TraceRenderer.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	SwapChain::SwapChain(TraceRenderer &traceRenderer, Renderer::ISwapChain &swapChain) :
+		ISwapChain(traceRenderer),
+		TraceResource(traceRenderer, swapChain)
+	{
+		// Mirror the estimated number of bytes of the wrapped swap chain
+		setNumberOfBytes(swapChain.getNumberOfBytes());
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	SwapChain::~SwapChain()
+	{
+		// Nothing to do in here
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IResource methods            ]
+	//[-------------------------------------------------------]
+	void SwapChain::setDebugName(const char *name)
+	{
+		// Call the base implementation, updates the statistics
+		IResource::setDebugName(name);
+
+		// Record and forward
+		traceDebugName(name);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IRenderTarget methods        ]
+	//[-------------------------------------------------------]
+	void SwapChain::getWidthAndHeight(unsigned int &width, unsigned int &height) const
+	{
+		static_cast<Renderer::ISwapChain&>(getWrappedResource()).getWidthAndHeight(width, height);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ISwapChain methods           ]
+	//[-------------------------------------------------------]
+	handle SwapChain::getNativeWindowHandle() const
+	{
+		return static_cast<Renderer::ISwapChain&>(getWrappedResource()).getNativeWindowHandle();
+	}
+
+	void SwapChain::present()
+	{
+		// Record, a present marks the end of a frame so write the recorded frame into the trace file
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::PRESENT);
+		traceWriter.writeUInt32(getId());
+		traceWriter.flush();
+
+		// Forward
+		static_cast<Renderer::ISwapChain&>(getWrappedResource()).present();
+
+		// Update the frame statistics
+		getTraceRenderer().onPresent(*this);
+	}
+
+	void SwapChain::resizeBuffers()
+	{
+		// Forward
+		Renderer::ISwapChain &swapChain = static_cast<Renderer::ISwapChain&>(getWrappedResource());
+		swapChain.resizeBuffers();
+
+		// Record the new size
+		unsigned int width  = 0;
+		unsigned int height = 0;
+		swapChain.getWidthAndHeight(width, height);
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::RESIZE_BUFFERS);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeUInt32(width);
+		traceWriter.writeUInt32(height);
+
+		// Mirror the estimated number of bytes of the wrapped swap chain
+		setNumberOfBytes(swapChain.getNumberOfBytes());
+	}
+
+	bool SwapChain::getFullscreenState() const
+	{
+		return static_cast<Renderer::ISwapChain&>(getWrappedResource()).getFullscreenState();
+	}
+
+	void SwapChain::setFullscreenState(bool fullscreen)
+	{
+		// Record
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::SET_FULLSCREEN_STATE);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeBool(fullscreen);
+
+		// Forward
+		static_cast<Renderer::ISwapChain&>(getWrappedResource()).setFullscreenState(fullscreen);
+	}
+
+	int SwapChain::getSwapInterval() const
+	{
+		return static_cast<Renderer::ISwapChain&>(getWrappedResource()).getSwapInterval();
+	}
+
+	bool SwapChain::setSwapInterval(int swapInterval)
+	{
+		// Forward, frame pacing isn't recorded so a replay runs as fast as possible
+		return static_cast<Renderer::ISwapChain&>(getWrappedResource()).setSwapInterval(swapInterval);
+	}
+
+	unsigned int SwapChain::getMaximumFrameLatency() const
+	{
+		return static_cast<Renderer::ISwapChain&>(getWrappedResource()).getMaximumFrameLatency();
+	}
+
+	void SwapChain::setMaximumFrameLatency(unsigned int maximumFrameLatency)
+	{
+		// Forward, frame pacing isn't recorded so a replay runs as fast as possible
+		static_cast<Renderer::ISwapChain&>(getWrappedResource()).setMaximumFrameLatency(maximumFrameLatency);
+	}
+
+	const Renderer::PresentStatistics &SwapChain::getPresentStatistics() const
+	{
+		return static_cast<Renderer::ISwapChain&>(getWrappedResource()).getPresentStatistics();
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
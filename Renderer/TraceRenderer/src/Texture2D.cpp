@@ -0,0 +1,111 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/Texture2D.h"
+#include "TraceRenderer/TraceRenderer.h"
+#include "TraceRenderer/Mapping.h"
+
+#include <Renderer/ISamplerState.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	Texture2D::Texture2D(TraceRenderer &traceRenderer, Renderer::ITexture2D &texture2D, Renderer::TextureFormat::Enum textureFormat) :
+		ITexture2D(traceRenderer, texture2D.getWidth(), texture2D.getHeight()),
+		TraceResource(traceRenderer, texture2D),
+		mTextureFormat(textureFormat)
+	{
+		// Mirror the estimated number of bytes of the wrapped 2D texture
+		setNumberOfBytes(texture2D.getNumberOfBytes());
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	Texture2D::~Texture2D()
+	{
+		// Nothing to do in here
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IResource methods            ]
+	//[-------------------------------------------------------]
+	void Texture2D::setDebugName(const char *name)
+	{
+		// Call the base implementation, updates the statistics
+		IResource::setDebugName(name);
+
+		// Record and forward
+		traceDebugName(name);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture methods             ]
+	//[-------------------------------------------------------]
+	unsigned long long Texture2D::getBindlessHandle(Renderer::ISamplerState *samplerState)
+	{
+		// Forward, there's nothing to record: The bindless handle is only valid inside this process and written into buffers by the user
+		return static_cast<Renderer::ITexture2D&>(getWrappedResource()).getBindlessHandle(static_cast<Renderer::ISamplerState*>(TraceRenderer::unwrapResource(samplerState)));
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ITexture2D methods           ]
+	//[-------------------------------------------------------]
+	void Texture2D::updateRegion(unsigned int mipmap, unsigned int x, unsigned int y, unsigned int width, unsigned int height, const void *data)
+	{
+		// Record, the texel data is tightly packed
+		TraceWriter &traceWriter = getTraceRenderer().getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::UPDATE_REGION_2D);
+		traceWriter.writeUInt32(getId());
+		traceWriter.writeUInt32(mipmap);
+		traceWriter.writeUInt32(x);
+		traceWriter.writeUInt32(y);
+		traceWriter.writeUInt32(width);
+		traceWriter.writeUInt32(height);
+		traceWriter.writeData(data, width * height * Mapping::getSize(mTextureFormat));
+
+		// Forward
+		static_cast<Renderer::ITexture2D&>(getWrappedResource()).updateRegion(mipmap, x, y, width, height, data);
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
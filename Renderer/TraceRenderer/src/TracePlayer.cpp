@@ -0,0 +1,1337 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/TracePlayer.h"
+
+#include <Renderer/IFence.h>
+#include <Renderer/IProgram.h>
+#include <Renderer/IRenderer.h>
+#include <Renderer/ISwapChain.h>
+#include <Renderer/ITexture2D.h>
+#include <Renderer/IFramebuffer.h>
+#include <Renderer/IIndexBuffer.h>
+#include <Renderer/IBlendState.h>
+#include <Renderer/ISamplerState.h>
+#include <Renderer/IVertexBuffer.h>
+#include <Renderer/IVertexArray.h>
+#include <Renderer/IUniformBuffer.h>
+#include <Renderer/ITextureBuffer.h>
+#include <Renderer/IIndirectBuffer.h>
+#include <Renderer/ITexture2DArray.h>
+#include <Renderer/IShaderLanguage.h>
+#include <Renderer/IRasterizerState.h>
+#include <Renderer/IDepthStencilState.h>
+#include <Renderer/ITextureCollection.h>
+#include <Renderer/ISamplerStateCollection.h>
+#include <Renderer/IVertexShader.h>
+#include <Renderer/IComputeShader.h>
+#include <Renderer/IGeometryShader.h>
+#include <Renderer/IFragmentShader.h>
+#include <Renderer/ITessellationControlShader.h>
+#include <Renderer/ITessellationEvaluationShader.h>
+#include <Renderer/VertexArrayTypes.h>
+#include <Renderer/BlendStateTypes.h>
+#include <Renderer/SamplerStateTypes.h>
+#include <Renderer/RasterizerStateTypes.h>
+#include <Renderer/DepthStencilStateTypes.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	TracePlayer::TracePlayer(Renderer::IRenderer &renderer, const void *data, unsigned int numberOfBytes) :
+		mRenderer(&renderer),
+		mTraceReader(data, numberOfBytes),
+		mValid(false),
+		mNumberOfPlayedCommands(0)
+	{
+		mRenderer->addReference();
+
+		// Read and validate the trace file header
+		mTraceReader.readRaw(&mHeader, sizeof(TraceFormat::Header));
+		mHeader.rendererName[sizeof(mHeader.rendererName) - 1] = '\0';
+		mValid = (!mTraceReader.hasError() && TraceFormat::MAGIC == mHeader.magic && TraceFormat::VERSION == mHeader.version);
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	TracePlayer::~TracePlayer()
+	{
+		// Release the resources the trace didn't release, in reverse creation order
+		for (size_t id = mResources.size(); id > 0; --id)
+		{
+			releaseResource(static_cast<unsigned int>(id - 1));
+		}
+
+		// Release the renderer instance
+		mRenderer->release();
+	}
+
+	/**
+	*  @brief
+	*    Play the next frame
+	*/
+	bool TracePlayer::playFrame()
+	{
+		// Nothing to play in case the trace data is invalid
+		if (!mValid || mTraceReader.isEndOfData())
+		{
+			return false;
+		}
+
+		// Play the commands until the end of the frame or the end of the trace
+		while (!mTraceReader.isEndOfData())
+		{
+			const unsigned char command = mTraceReader.readCommand();
+			if (command >= TraceFormat::Command::NUMBER_OF_COMMANDS)
+			{
+				// Error! Unknown command, the rest of the trace can't be interpreted.
+				mValid = false;
+				break;
+			}
+			++mNumberOfPlayedCommands;
+			if (playCommand(command))
+			{
+				// End of the frame
+				return true;
+			}
+		}
+
+		// End of the trace, the remaining commands (e.g. the resource destruction) don't form a frame
+		return false;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Copy constructor
+	*/
+	TracePlayer::TracePlayer(const TracePlayer &source) :
+		mRenderer(source.mRenderer),
+		mTraceReader(nullptr, 0),
+		mValid(false),
+		mNumberOfPlayedCommands(0)
+	{
+		// Not supported
+	}
+
+	/**
+	*  @brief
+	*    Copy operator
+	*/
+	TracePlayer &TracePlayer::operator =(const TracePlayer &)
+	{
+		// Not supported
+		return *this;
+	}
+
+	/**
+	*  @brief
+	*    Play a single command
+	*/
+	bool TracePlayer::playCommand(unsigned char command)
+	{
+		TraceReader &reader = mTraceReader;
+		switch (command)
+		{
+			//[-------------------------------------------------------]
+			//[ Resource creation                                     ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::MAIN_SWAP_CHAIN:
+			{
+				const unsigned int id	  = reader.readUInt32();
+				const unsigned int width  = reader.readUInt32();
+				const unsigned int height = reader.readUInt32();
+
+				// Use the main swap chain of the renderer instance, in case there's one, else replace it by an offscreen framebuffer
+				Renderer::ISwapChain *mainSwapChain = mRenderer->getMainSwapChain();
+				if (nullptr != mainSwapChain)
+				{
+					setResource(id, mainSwapChain);
+				}
+				else
+				{
+					Renderer::IFramebuffer *framebuffer = createOffscreenFramebuffer(width, height);
+					setResource(id, framebuffer);
+
+					// The captured main swap chain was the initial render target
+					mRenderer->omSetRenderTarget(framebuffer);
+				}
+				break;
+			}
+
+			case TraceFormat::Command::GET_SHADER_LANGUAGE:
+			{
+				const unsigned int id = reader.readUInt32();
+				const char *shaderLanguageName = reader.readString();
+
+				// Fall back to the default shader language in case the renderer instance doesn't support the captured shader language
+				Renderer::IShaderLanguage *shaderLanguage = mRenderer->getShaderLanguage(shaderLanguageName);
+				if (nullptr == shaderLanguage)
+				{
+					shaderLanguage = mRenderer->getShaderLanguage();
+				}
+				Resource *resourceEntry = getResourceEntry(id);
+				if (nullptr != resourceEntry && nullptr != shaderLanguage)
+				{
+					shaderLanguage->addReference();
+					resourceEntry->shaderLanguage = shaderLanguage;
+				}
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_SWAP_CHAIN:
+			{
+				// There's no native window during replay, swap chains are always replaced by offscreen framebuffers
+				const unsigned int id	  = reader.readUInt32();
+				const unsigned int width  = reader.readUInt32();
+				const unsigned int height = reader.readUInt32();
+				setResource(id, createOffscreenFramebuffer(width, height));
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_FRAMEBUFFER:
+			{
+				const unsigned int id = reader.readUInt32();
+				const unsigned int numberOfColorTextures = reader.readUInt32();
+				std::vector<Renderer::ITexture*> colorTextures(numberOfColorTextures);
+				for (unsigned int i = 0; i < numberOfColorTextures; ++i)
+				{
+					colorTextures[i] = static_cast<Renderer::ITexture*>(getResource(reader.readUInt32()));
+				}
+				Renderer::ITexture *depthStencilTexture = static_cast<Renderer::ITexture*>(getResource(reader.readUInt32()));
+				setResource(id, mRenderer->createFramebuffer(numberOfColorTextures, colorTextures.empty() ? nullptr : &colorTextures[0], depthStencilTexture));
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_VERTEX_BUFFER:
+			{
+				const unsigned int id = reader.readUInt32();
+				const unsigned int numberOfBytes = reader.readUInt32();
+				const Renderer::BufferUsage::Enum bufferUsage = static_cast<Renderer::BufferUsage::Enum>(reader.readUInt32());
+				unsigned int numberOfDataBytes = 0;
+				const void *data = reader.readData(numberOfDataBytes);
+				setResource(id, mRenderer->createVertexBuffer(numberOfBytes, data, bufferUsage));
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_INDEX_BUFFER:
+			{
+				const unsigned int id = reader.readUInt32();
+				const unsigned int numberOfBytes = reader.readUInt32();
+				const Renderer::IndexBufferFormat::Enum indexBufferFormat = static_cast<Renderer::IndexBufferFormat::Enum>(reader.readUInt32());
+				const Renderer::BufferUsage::Enum bufferUsage = static_cast<Renderer::BufferUsage::Enum>(reader.readUInt32());
+				unsigned int numberOfDataBytes = 0;
+				const void *data = reader.readData(numberOfDataBytes);
+				setResource(id, mRenderer->createIndexBuffer(numberOfBytes, indexBufferFormat, data, bufferUsage));
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_TEXTURE_BUFFER:
+			{
+				const unsigned int id = reader.readUInt32();
+				const unsigned int numberOfBytes = reader.readUInt32();
+				const Renderer::TextureFormat::Enum textureFormat = static_cast<Renderer::TextureFormat::Enum>(reader.readUInt32());
+				const Renderer::BufferUsage::Enum bufferUsage = static_cast<Renderer::BufferUsage::Enum>(reader.readUInt32());
+				unsigned int numberOfDataBytes = 0;
+				const void *data = reader.readData(numberOfDataBytes);
+				setResource(id, mRenderer->createTextureBuffer(numberOfBytes, textureFormat, data, bufferUsage));
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_INDIRECT_BUFFER:
+			{
+				const unsigned int id = reader.readUInt32();
+				const unsigned int numberOfBytes = reader.readUInt32();
+				const Renderer::BufferUsage::Enum bufferUsage = static_cast<Renderer::BufferUsage::Enum>(reader.readUInt32());
+				unsigned int numberOfDataBytes = 0;
+				const void *data = reader.readData(numberOfDataBytes);
+				setResource(id, mRenderer->createIndirectBuffer(numberOfBytes, data, bufferUsage));
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_TEXTURE_2D:
+			{
+				const unsigned int id	  = reader.readUInt32();
+				const unsigned int width  = reader.readUInt32();
+				const unsigned int height = reader.readUInt32();
+				const Renderer::TextureFormat::Enum textureFormat = static_cast<Renderer::TextureFormat::Enum>(reader.readUInt32());
+				const unsigned int flags = reader.readUInt32();
+				const Renderer::TextureUsage::Enum textureUsage = static_cast<Renderer::TextureUsage::Enum>(reader.readUInt32());
+				const unsigned int numberOfMultisamples = reader.readUInt32();
+				unsigned int numberOfDataBytes = 0;
+				const void *data = reader.readData(numberOfDataBytes);
+				setResource(id, mRenderer->createTexture2D(width, height, textureFormat, const_cast<void*>(data), flags, textureUsage, numberOfMultisamples));
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_TEXTURE_2D_ARRAY:
+			{
+				const unsigned int id			  = reader.readUInt32();
+				const unsigned int width		  = reader.readUInt32();
+				const unsigned int height		  = reader.readUInt32();
+				const unsigned int numberOfSlices = reader.readUInt32();
+				const Renderer::TextureFormat::Enum textureFormat = static_cast<Renderer::TextureFormat::Enum>(reader.readUInt32());
+				const unsigned int flags = reader.readUInt32();
+				const Renderer::TextureUsage::Enum textureUsage = static_cast<Renderer::TextureUsage::Enum>(reader.readUInt32());
+				unsigned int numberOfDataBytes = 0;
+				const void *data = reader.readData(numberOfDataBytes);
+				setResource(id, mRenderer->createTexture2DArray(width, height, numberOfSlices, textureFormat, const_cast<void*>(data), flags, textureUsage));
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_RASTERIZER_STATE:
+			{
+				const unsigned int id = reader.readUInt32();
+				Renderer::RasterizerState rasterizerState;
+				reader.readRaw(&rasterizerState, sizeof(Renderer::RasterizerState));
+				setResource(id, mRenderer->createRasterizerState(rasterizerState));
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_DEPTH_STENCIL_STATE:
+			{
+				const unsigned int id = reader.readUInt32();
+				Renderer::DepthStencilState depthStencilState;
+				reader.readRaw(&depthStencilState, sizeof(Renderer::DepthStencilState));
+				setResource(id, mRenderer->createDepthStencilState(depthStencilState));
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_BLEND_STATE:
+			{
+				const unsigned int id = reader.readUInt32();
+				Renderer::BlendState blendState;
+				reader.readRaw(&blendState, sizeof(Renderer::BlendState));
+				setResource(id, mRenderer->createBlendState(blendState));
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_SAMPLER_STATE:
+			{
+				const unsigned int id = reader.readUInt32();
+				Renderer::SamplerState samplerState;
+				reader.readRaw(&samplerState, sizeof(Renderer::SamplerState));
+				setResource(id, mRenderer->createSamplerState(samplerState));
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_TEXTURE_COLLECTION:
+			{
+				const unsigned int id = reader.readUInt32();
+				const unsigned int numberOfTextures = reader.readUInt32();
+				std::vector<Renderer::ITexture*> textures(numberOfTextures);
+				for (unsigned int i = 0; i < numberOfTextures; ++i)
+				{
+					textures[i] = static_cast<Renderer::ITexture*>(getResource(reader.readUInt32()));
+				}
+				setResource(id, mRenderer->createTextureCollection(numberOfTextures, textures.empty() ? nullptr : &textures[0]));
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_SAMPLER_STATE_COLLECTION:
+			{
+				const unsigned int id = reader.readUInt32();
+				const unsigned int numberOfSamplerStates = reader.readUInt32();
+				std::vector<Renderer::ISamplerState*> samplerStates(numberOfSamplerStates);
+				for (unsigned int i = 0; i < numberOfSamplerStates; ++i)
+				{
+					samplerStates[i] = static_cast<Renderer::ISamplerState*>(getResource(reader.readUInt32()));
+				}
+				setResource(id, mRenderer->createSamplerStateCollection(numberOfSamplerStates, samplerStates.empty() ? nullptr : &samplerStates[0]));
+				break;
+			}
+
+			//[-------------------------------------------------------]
+			//[ Resource handling                                     ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::MAP:
+			{
+				const unsigned int id = reader.readUInt32();
+				const unsigned int subresource = reader.readUInt32();
+				const Renderer::MapType::Enum mapType = static_cast<Renderer::MapType::Enum>(reader.readUInt32());
+				const unsigned int mapFlags = reader.readUInt32();
+				Resource *resourceEntry = getResourceEntry(id);
+				if (nullptr != resourceEntry && nullptr != resourceEntry->resource)
+				{
+					Renderer::MappedSubresource mappedSubresource;
+					if (mRenderer->map(*resourceEntry->resource, subresource, mapType, mapFlags, mappedSubresource))
+					{
+						resourceEntry->mappedData	  = mappedSubresource.data;
+						resourceEntry->mappedRowPitch = mappedSubresource.rowPitch;
+					}
+				}
+				break;
+			}
+
+			case TraceFormat::Command::UNMAP:
+			{
+				const unsigned int id = reader.readUInt32();
+				const unsigned int subresource = reader.readUInt32();
+				const unsigned int rowPitch = reader.readUInt32();
+				unsigned int numberOfBytes = 0;
+				const unsigned char *data = static_cast<const unsigned char*>(reader.readData(numberOfBytes));
+				Resource *resourceEntry = getResourceEntry(id);
+				if (nullptr != resourceEntry && nullptr != resourceEntry->mappedData)
+				{
+					// Write the captured data into the mapped resource, the row pitch might differ between renderer backends
+					if (nullptr != data)
+					{
+						unsigned char *mappedData = static_cast<unsigned char*>(resourceEntry->mappedData);
+						if (0 == rowPitch || rowPitch == resourceEntry->mappedRowPitch || 0 == resourceEntry->mappedRowPitch)
+						{
+							memcpy(mappedData, data, numberOfBytes);
+						}
+						else
+						{
+							const unsigned int numberOfRows		   = numberOfBytes / rowPitch;
+							const unsigned int numberOfBytesPerRow = (rowPitch < resourceEntry->mappedRowPitch) ? rowPitch : resourceEntry->mappedRowPitch;
+							for (unsigned int row = 0; row < numberOfRows; ++row)
+							{
+								memcpy(mappedData + row * resourceEntry->mappedRowPitch, data + row * rowPitch, numberOfBytesPerRow);
+							}
+						}
+					}
+
+					// Unmap
+					mRenderer->unmap(*resourceEntry->resource, subresource);
+					resourceEntry->mappedData	  = nullptr;
+					resourceEntry->mappedRowPitch = 0;
+				}
+				break;
+			}
+
+			case TraceFormat::Command::COPY_RESOURCE:
+			{
+				Renderer::IResource *destinationResource = getResource(reader.readUInt32());
+				Renderer::IResource *sourceResource		 = getResource(reader.readUInt32());
+				if (nullptr != destinationResource && nullptr != sourceResource)
+				{
+					mRenderer->copyResource(*destinationResource, *sourceResource);
+				}
+				break;
+			}
+
+			//[-------------------------------------------------------]
+			//[ States                                                ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::SET_PROGRAM:
+				mRenderer->setProgram(static_cast<Renderer::IProgram*>(getResource(reader.readUInt32())));
+				break;
+
+			//[-------------------------------------------------------]
+			//[ Input-assembler (IA) stage                            ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::IA_SET_VERTEX_ARRAY:
+				mRenderer->iaSetVertexArray(static_cast<Renderer::IVertexArray*>(getResource(reader.readUInt32())));
+				break;
+
+			case TraceFormat::Command::IA_SET_PRIMITIVE_TOPOLOGY:
+				mRenderer->iaSetPrimitiveTopology(static_cast<Renderer::PrimitiveTopology::Enum>(reader.readUInt32()));
+				break;
+
+			//[-------------------------------------------------------]
+			//[ Shader stages                                         ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::SET_TEXTURE:
+			case TraceFormat::Command::SET_TEXTURE_COLLECTION:
+			case TraceFormat::Command::SET_SAMPLER_STATE:
+			case TraceFormat::Command::SET_SAMPLER_STATE_COLLECTION:
+			case TraceFormat::Command::SET_UNIFORM_BUFFER:
+			{
+				const unsigned int shaderStage = reader.readUInt32();
+				const unsigned int unit = reader.readUInt32();
+				Renderer::IResource *resource = getResource(reader.readUInt32());
+				switch (command)
+				{
+					case TraceFormat::Command::SET_TEXTURE:
+					{
+						Renderer::ITexture *texture = static_cast<Renderer::ITexture*>(resource);
+						switch (shaderStage)
+						{
+							case TraceFormat::ShaderStage::VERTEX_SHADER:					mRenderer->vsSetTexture(unit, texture);	break;
+							case TraceFormat::ShaderStage::TESSELLATION_CONTROL_SHADER:		mRenderer->tcsSetTexture(unit, texture);	break;
+							case TraceFormat::ShaderStage::TESSELLATION_EVALUATION_SHADER:	mRenderer->tesSetTexture(unit, texture);	break;
+							case TraceFormat::ShaderStage::GEOMETRY_SHADER:					mRenderer->gsSetTexture(unit, texture);	break;
+							case TraceFormat::ShaderStage::FRAGMENT_SHADER:					mRenderer->fsSetTexture(unit, texture);	break;
+							case TraceFormat::ShaderStage::COMPUTE_SHADER:					mRenderer->csSetTexture(unit, texture);	break;
+						}
+						break;
+					}
+
+					case TraceFormat::Command::SET_TEXTURE_COLLECTION:
+					{
+						Renderer::ITextureCollection *textureCollection = static_cast<Renderer::ITextureCollection*>(resource);
+						switch (shaderStage)
+						{
+							case TraceFormat::ShaderStage::VERTEX_SHADER:					mRenderer->vsSetTextureCollection(unit, textureCollection);	break;
+							case TraceFormat::ShaderStage::TESSELLATION_CONTROL_SHADER:		mRenderer->tcsSetTextureCollection(unit, textureCollection);	break;
+							case TraceFormat::ShaderStage::TESSELLATION_EVALUATION_SHADER:	mRenderer->tesSetTextureCollection(unit, textureCollection);	break;
+							case TraceFormat::ShaderStage::GEOMETRY_SHADER:					mRenderer->gsSetTextureCollection(unit, textureCollection);	break;
+							case TraceFormat::ShaderStage::FRAGMENT_SHADER:					mRenderer->fsSetTextureCollection(unit, textureCollection);	break;
+							case TraceFormat::ShaderStage::COMPUTE_SHADER:					mRenderer->csSetTextureCollection(unit, textureCollection);	break;
+						}
+						break;
+					}
+
+					case TraceFormat::Command::SET_SAMPLER_STATE:
+					{
+						Renderer::ISamplerState *samplerState = static_cast<Renderer::ISamplerState*>(resource);
+						switch (shaderStage)
+						{
+							case TraceFormat::ShaderStage::VERTEX_SHADER:					mRenderer->vsSetSamplerState(unit, samplerState);	break;
+							case TraceFormat::ShaderStage::TESSELLATION_CONTROL_SHADER:		mRenderer->tcsSetSamplerState(unit, samplerState);	break;
+							case TraceFormat::ShaderStage::TESSELLATION_EVALUATION_SHADER:	mRenderer->tesSetSamplerState(unit, samplerState);	break;
+							case TraceFormat::ShaderStage::GEOMETRY_SHADER:					mRenderer->gsSetSamplerState(unit, samplerState);	break;
+							case TraceFormat::ShaderStage::FRAGMENT_SHADER:					mRenderer->fsSetSamplerState(unit, samplerState);	break;
+							case TraceFormat::ShaderStage::COMPUTE_SHADER:					mRenderer->csSetSamplerState(unit, samplerState);	break;
+						}
+						break;
+					}
+
+					case TraceFormat::Command::SET_SAMPLER_STATE_COLLECTION:
+					{
+						Renderer::ISamplerStateCollection *samplerStateCollection = static_cast<Renderer::ISamplerStateCollection*>(resource);
+						switch (shaderStage)
+						{
+							case TraceFormat::ShaderStage::VERTEX_SHADER:					mRenderer->vsSetSamplerStateCollection(unit, samplerStateCollection);	break;
+							case TraceFormat::ShaderStage::TESSELLATION_CONTROL_SHADER:		mRenderer->tcsSetSamplerStateCollection(unit, samplerStateCollection);	break;
+							case TraceFormat::ShaderStage::TESSELLATION_EVALUATION_SHADER:	mRenderer->tesSetSamplerStateCollection(unit, samplerStateCollection);	break;
+							case TraceFormat::ShaderStage::GEOMETRY_SHADER:					mRenderer->gsSetSamplerStateCollection(unit, samplerStateCollection);	break;
+							case TraceFormat::ShaderStage::FRAGMENT_SHADER:					mRenderer->fsSetSamplerStateCollection(unit, samplerStateCollection);	break;
+							case TraceFormat::ShaderStage::COMPUTE_SHADER:					mRenderer->csSetSamplerStateCollection(unit, samplerStateCollection);	break;
+						}
+						break;
+					}
+
+					case TraceFormat::Command::SET_UNIFORM_BUFFER:
+					{
+						Renderer::IUniformBuffer *uniformBuffer = static_cast<Renderer::IUniformBuffer*>(resource);
+						switch (shaderStage)
+						{
+							case TraceFormat::ShaderStage::VERTEX_SHADER:					mRenderer->vsSetUniformBuffer(unit, uniformBuffer);	break;
+							case TraceFormat::ShaderStage::TESSELLATION_CONTROL_SHADER:		mRenderer->tcsSetUniformBuffer(unit, uniformBuffer);	break;
+							case TraceFormat::ShaderStage::TESSELLATION_EVALUATION_SHADER:	mRenderer->tesSetUniformBuffer(unit, uniformBuffer);	break;
+							case TraceFormat::ShaderStage::GEOMETRY_SHADER:					mRenderer->gsSetUniformBuffer(unit, uniformBuffer);	break;
+							case TraceFormat::ShaderStage::FRAGMENT_SHADER:					mRenderer->fsSetUniformBuffer(unit, uniformBuffer);	break;
+							case TraceFormat::ShaderStage::COMPUTE_SHADER:					mRenderer->csSetUniformBuffer(unit, uniformBuffer);	break;
+						}
+						break;
+					}
+				}
+				break;
+			}
+
+			//[-------------------------------------------------------]
+			//[ Stream-output (SO) stage                              ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::SO_SET_TARGETS:
+			{
+				const unsigned int numberOfTargets = reader.readUInt32();
+				std::vector<Renderer::IVertexBuffer*> vertexBuffers(numberOfTargets);
+				for (unsigned int i = 0; i < numberOfTargets; ++i)
+				{
+					vertexBuffers[i] = static_cast<Renderer::IVertexBuffer*>(getResource(reader.readUInt32()));
+				}
+				std::vector<unsigned int> offsets;
+				if (reader.readBool())
+				{
+					offsets.resize(numberOfTargets);
+					reader.readRaw(offsets.empty() ? nullptr : &offsets[0], sizeof(unsigned int) * numberOfTargets);
+				}
+				mRenderer->soSetTargets(numberOfTargets, vertexBuffers.empty() ? nullptr : &vertexBuffers[0], offsets.empty() ? nullptr : &offsets[0]);
+				break;
+			}
+
+			case TraceFormat::Command::SO_BEGIN:
+			{
+				const Renderer::PrimitiveTopology::Enum primitiveTopology = static_cast<Renderer::PrimitiveTopology::Enum>(reader.readUInt32());
+				mRenderer->soBegin(primitiveTopology, reader.readBool());
+				break;
+			}
+
+			case TraceFormat::Command::SO_END:
+				mRenderer->soEnd();
+				break;
+
+			//[-------------------------------------------------------]
+			//[ Rasterizer (RS) stage                                 ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::RS_SET_VIEWPORTS:
+			{
+				const unsigned int numberOfViewports = reader.readUInt32();
+				mScratchData.resize(sizeof(Renderer::Viewport) * numberOfViewports + 1);
+				reader.readRaw(&mScratchData[0], sizeof(Renderer::Viewport) * numberOfViewports);
+				mRenderer->rsSetViewports(numberOfViewports, reinterpret_cast<const Renderer::Viewport*>(&mScratchData[0]));
+				break;
+			}
+
+			case TraceFormat::Command::RS_SET_SCISSOR_RECTANGLES:
+			{
+				const unsigned int numberOfScissorRectangles = reader.readUInt32();
+				mScratchData.resize(sizeof(Renderer::ScissorRectangle) * numberOfScissorRectangles + 1);
+				reader.readRaw(&mScratchData[0], sizeof(Renderer::ScissorRectangle) * numberOfScissorRectangles);
+				mRenderer->rsSetScissorRectangles(numberOfScissorRectangles, reinterpret_cast<const Renderer::ScissorRectangle*>(&mScratchData[0]));
+				break;
+			}
+
+			case TraceFormat::Command::RS_SET_STATE:
+				mRenderer->rsSetState(static_cast<Renderer::IRasterizerState*>(getResource(reader.readUInt32())));
+				break;
+
+			//[-------------------------------------------------------]
+			//[ Output-merger (OM) stage                              ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::OM_SET_RENDER_TARGET:
+				mRenderer->omSetRenderTarget(static_cast<Renderer::IRenderTarget*>(getResource(reader.readUInt32())));
+				break;
+
+			case TraceFormat::Command::OM_SET_DEPTH_STENCIL_STATE:
+				mRenderer->omSetDepthStencilState(static_cast<Renderer::IDepthStencilState*>(getResource(reader.readUInt32())));
+				break;
+
+			case TraceFormat::Command::OM_SET_BLEND_STATE:
+				mRenderer->omSetBlendState(static_cast<Renderer::IBlendState*>(getResource(reader.readUInt32())));
+				break;
+
+			//[-------------------------------------------------------]
+			//[ Compute-shader (CS) stage                             ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::CS_SET_UNORDERED_ACCESS_VIEW:
+			{
+				const unsigned int unit = reader.readUInt32();
+				mRenderer->csSetUnorderedAccessView(unit, getResource(reader.readUInt32()));
+				break;
+			}
+
+			//[-------------------------------------------------------]
+			//[ Operations                                            ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::CLEAR:
+			{
+				const unsigned int flags = reader.readUInt32();
+				float color[4];
+				reader.readFloats(color, 4);
+				const float z = reader.readFloat();
+				mRenderer->clear(flags, color, z, reader.readUInt32());
+				break;
+			}
+
+			case TraceFormat::Command::BEGIN_SCENE:
+				mRenderer->beginScene();
+				break;
+
+			case TraceFormat::Command::END_SCENE:
+				mRenderer->endScene();
+				break;
+
+			case TraceFormat::Command::RESOLVE_MULTISAMPLE_FRAMEBUFFER:
+			{
+				Renderer::IResource *destinationRenderTarget	  = getResource(reader.readUInt32());
+				Renderer::IResource *sourceMultisampleFramebuffer = getResource(reader.readUInt32());
+				if (nullptr != destinationRenderTarget && nullptr != sourceMultisampleFramebuffer)
+				{
+					mRenderer->resolveMultisampleFramebuffer(*static_cast<Renderer::IRenderTarget*>(destinationRenderTarget), *static_cast<Renderer::IFramebuffer*>(sourceMultisampleFramebuffer));
+				}
+				break;
+			}
+
+			//[-------------------------------------------------------]
+			//[ Draw call                                             ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::DRAW:
+			{
+				unsigned int arguments[2];
+				reader.readRaw(arguments, sizeof(arguments));
+				mRenderer->draw(arguments[0], arguments[1]);
+				break;
+			}
+
+			case TraceFormat::Command::DRAW_INSTANCED:
+			{
+				unsigned int arguments[3];
+				reader.readRaw(arguments, sizeof(arguments));
+				mRenderer->drawInstanced(arguments[0], arguments[1], arguments[2]);
+				break;
+			}
+
+			case TraceFormat::Command::DRAW_INDEXED:
+			{
+				unsigned int arguments[5];
+				reader.readRaw(arguments, sizeof(arguments));
+				mRenderer->drawIndexed(arguments[0], arguments[1], arguments[2], arguments[3], arguments[4]);
+				break;
+			}
+
+			case TraceFormat::Command::DRAW_INDEXED_INSTANCED:
+			{
+				unsigned int arguments[6];
+				reader.readRaw(arguments, sizeof(arguments));
+				mRenderer->drawIndexedInstanced(arguments[0], arguments[1], arguments[2], arguments[3], arguments[4], arguments[5]);
+				break;
+			}
+
+			case TraceFormat::Command::MULTI_DRAW_INDEXED_INDIRECT:
+			{
+				Renderer::IResource *indirectBuffer = getResource(reader.readUInt32());
+				const unsigned int indirectBufferOffset = reader.readUInt32();
+				const unsigned int numberOfDraws = reader.readUInt32();
+				if (nullptr != indirectBuffer)
+				{
+					mRenderer->multiDrawIndexedIndirect(*static_cast<Renderer::IIndirectBuffer*>(indirectBuffer), indirectBufferOffset, numberOfDraws);
+				}
+				break;
+			}
+
+			case TraceFormat::Command::DRAW_AUTO:
+				mRenderer->drawAuto();
+				break;
+
+			//[-------------------------------------------------------]
+			//[ Compute                                               ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::DISPATCH:
+			{
+				unsigned int arguments[3];
+				reader.readRaw(arguments, sizeof(arguments));
+				mRenderer->dispatch(arguments[0], arguments[1], arguments[2]);
+				break;
+			}
+
+			case TraceFormat::Command::MEMORY_BARRIER:
+				mRenderer->memoryBarrier(reader.readUInt32());
+				break;
+
+			//[-------------------------------------------------------]
+			//[ Synchronization                                       ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::INSERT_FENCE:
+				setResource(reader.readUInt32(), mRenderer->insertFence());
+				break;
+
+			case TraceFormat::Command::IS_FENCE_SIGNALED:
+			{
+				// The result isn't needed, but the query itself might have an effect (e.g. a flush)
+				Renderer::IResource *fence = getResource(reader.readUInt32());
+				if (nullptr != fence)
+				{
+					mRenderer->isFenceSignaled(*static_cast<Renderer::IFence*>(fence));
+				}
+				break;
+			}
+
+			case TraceFormat::Command::WAIT_FENCE:
+			{
+				Renderer::IResource *fence = getResource(reader.readUInt32());
+				const unsigned int timeout = reader.readUInt32();
+				if (nullptr != fence)
+				{
+					mRenderer->waitFence(*static_cast<Renderer::IFence*>(fence), timeout);
+				}
+				break;
+			}
+
+			case TraceFormat::Command::FLUSH:
+				mRenderer->flush();
+				break;
+
+			case TraceFormat::Command::FINISH:
+				mRenderer->finish();
+				break;
+
+			//[-------------------------------------------------------]
+			//[ Debug                                                 ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::SET_DEBUG_MARKER:
+			{
+				const wchar_t *name = reader.readWideString();
+				mRenderer->setDebugMarker((nullptr != name) ? name : L"");
+				break;
+			}
+
+			case TraceFormat::Command::BEGIN_DEBUG_EVENT:
+			{
+				const wchar_t *name = reader.readWideString();
+				mRenderer->beginDebugEvent((nullptr != name) ? name : L"");
+				break;
+			}
+
+			case TraceFormat::Command::END_DEBUG_EVENT:
+				mRenderer->endDebugEvent();
+				break;
+
+			//[-------------------------------------------------------]
+			//[ Resource methods                                      ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::RELEASE_RESOURCE:
+				releaseResource(reader.readUInt32());
+				break;
+
+			case TraceFormat::Command::SET_DEBUG_NAME:
+			{
+				Renderer::IResource *resource = getResource(reader.readUInt32());
+				const char *name = reader.readString();
+				if (nullptr != resource && nullptr != name)
+				{
+					resource->setDebugName(name);
+				}
+				break;
+			}
+
+			//[-------------------------------------------------------]
+			//[ Swap chain methods                                    ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::PRESENT:
+			{
+				// Only a real swap chain can be presented, offscreen framebuffers replacing swap chains have nothing to present
+				Renderer::IResource *resource = getResource(reader.readUInt32());
+				if (nullptr != resource && Renderer::ResourceType::SWAP_CHAIN == resource->getResourceType())
+				{
+					static_cast<Renderer::ISwapChain*>(resource)->present();
+				}
+
+				// End of the frame
+				return true;
+			}
+
+			case TraceFormat::Command::RESIZE_BUFFERS:
+			{
+				const unsigned int id	  = reader.readUInt32();
+				const unsigned int width  = reader.readUInt32();
+				const unsigned int height = reader.readUInt32();
+				Renderer::IResource *resource = getResource(id);
+				if (nullptr != resource)
+				{
+					if (Renderer::ResourceType::SWAP_CHAIN == resource->getResourceType())
+					{
+						static_cast<Renderer::ISwapChain*>(resource)->resizeBuffers();
+					}
+					else
+					{
+						// Recreate the offscreen framebuffer replacing the swap chain
+						const bool currentRenderTarget = (mRenderer->omGetRenderTarget() == resource);
+						Renderer::IFramebuffer *framebuffer = createOffscreenFramebuffer(width, height);
+						setResource(id, framebuffer);
+						if (currentRenderTarget)
+						{
+							mRenderer->omSetRenderTarget(framebuffer);
+						}
+					}
+				}
+				break;
+			}
+
+			case TraceFormat::Command::SET_FULLSCREEN_STATE:
+				// Fullscreen is a property of the native window of the captured application, ignore it during replay
+				reader.readUInt32();
+				reader.readBool();
+				break;
+
+			//[-------------------------------------------------------]
+			//[ Buffer and texture methods                            ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::COPY_DATA_FROM:
+			{
+				Renderer::IResource *resource = getResource(reader.readUInt32());
+				unsigned int numberOfBytes = 0;
+				const void *data = reader.readData(numberOfBytes);
+				if (nullptr != resource)
+				{
+					switch (resource->getResourceType())
+					{
+						case Renderer::ResourceType::TEXTURE_BUFFER:
+							static_cast<Renderer::ITextureBuffer*>(resource)->copyDataFrom(numberOfBytes, data);
+							break;
+
+						case Renderer::ResourceType::UNIFORM_BUFFER:
+							static_cast<Renderer::IUniformBuffer*>(resource)->copyDataFrom(numberOfBytes, data);
+							break;
+
+						case Renderer::ResourceType::INDIRECT_BUFFER:
+							static_cast<Renderer::IIndirectBuffer*>(resource)->copyDataFrom(numberOfBytes, data);
+							break;
+
+						default:
+							// Not a buffer which supports copying data into it
+							break;
+					}
+				}
+				break;
+			}
+
+			case TraceFormat::Command::UPDATE_REGION_2D:
+			{
+				Renderer::IResource *resource = getResource(reader.readUInt32());
+				unsigned int arguments[5];
+				reader.readRaw(arguments, sizeof(arguments));
+				unsigned int numberOfBytes = 0;
+				const void *data = reader.readData(numberOfBytes);
+				if (nullptr != resource && nullptr != data)
+				{
+					static_cast<Renderer::ITexture2D*>(resource)->updateRegion(arguments[0], arguments[1], arguments[2], arguments[3], arguments[4], data);
+				}
+				break;
+			}
+
+			case TraceFormat::Command::UPDATE_REGION_2D_ARRAY:
+			{
+				Renderer::IResource *resource = getResource(reader.readUInt32());
+				unsigned int arguments[6];
+				reader.readRaw(arguments, sizeof(arguments));
+				unsigned int numberOfBytes = 0;
+				const void *data = reader.readData(numberOfBytes);
+				if (nullptr != resource && nullptr != data)
+				{
+					static_cast<Renderer::ITexture2DArray*>(resource)->updateRegion(arguments[0], arguments[1], arguments[2], arguments[3], arguments[4], arguments[5], data);
+				}
+				break;
+			}
+
+			//[-------------------------------------------------------]
+			//[ Program methods                                       ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::CREATE_VERTEX_ARRAY:
+			{
+				Renderer::IResource *program = getResource(reader.readUInt32());
+				const unsigned int id = reader.readUInt32();
+				const unsigned int numberOfAttributes = reader.readUInt32();
+				std::vector<Renderer::VertexArrayAttribute> attributes(numberOfAttributes);
+				bool validVertexBuffers = true;
+				for (unsigned int i = 0; i < numberOfAttributes; ++i)
+				{
+					Renderer::VertexArrayAttribute &attribute = attributes[i];
+					attribute.vertexArrayFormat = static_cast<Renderer::VertexArrayFormat::Enum>(reader.readUInt32());
+					reader.readRaw(attribute.name, sizeof(attribute.name));
+					reader.readRaw(attribute.semantic, sizeof(attribute.semantic));
+					attribute.semanticIndex		  = reader.readUInt32();
+					attribute.vertexBuffer		  = static_cast<Renderer::IVertexBuffer*>(getResource(reader.readUInt32()));
+					attribute.offset			  = reader.readUInt32();
+					attribute.stride			  = reader.readUInt32();
+					attribute.instancesPerElement = reader.readUInt32();
+					validVertexBuffers = validVertexBuffers && (nullptr != attribute.vertexBuffer);
+				}
+				Renderer::IIndexBuffer *indexBuffer = static_cast<Renderer::IIndexBuffer*>(getResource(reader.readUInt32()));
+
+				// Vertex array attributes must have a vertex buffer, one might be missing in case the renderer instance failed to create it
+				if (nullptr != program && validVertexBuffers)
+				{
+					setResource(id, static_cast<Renderer::IProgram*>(program)->createVertexArray(numberOfAttributes, attributes.empty() ? nullptr : &attributes[0], indexBuffer));
+				}
+				break;
+			}
+
+			case TraceFormat::Command::SET_STREAM_OUTPUT_VARYINGS:
+			{
+				Renderer::IResource *program = getResource(reader.readUInt32());
+				const unsigned int numberOfVaryings = reader.readUInt32();
+				std::vector<const char*> varyingNames(numberOfVaryings);
+				for (unsigned int i = 0; i < numberOfVaryings; ++i)
+				{
+					varyingNames[i] = reader.readString();
+				}
+				const bool interleaved = reader.readBool();
+				if (nullptr != program)
+				{
+					static_cast<Renderer::IProgram*>(program)->setStreamOutputVaryings(numberOfVaryings, varyingNames.empty() ? nullptr : &varyingNames[0], interleaved);
+				}
+				break;
+			}
+
+			case TraceFormat::Command::GET_ATTRIBUTE_LOCATION:
+			{
+				// The result isn't needed, but backends might do work inside the query
+				Renderer::IResource *program = getResource(reader.readUInt32());
+				const char *attributeName = reader.readString();
+				if (nullptr != program && nullptr != attributeName)
+				{
+					static_cast<Renderer::IProgram*>(program)->getAttributeLocation(attributeName);
+				}
+				break;
+			}
+
+			case TraceFormat::Command::GET_UNIFORM_BLOCK_INDEX:
+			{
+				// The result isn't needed, but backends might do work inside the query
+				Renderer::IResource *program = getResource(reader.readUInt32());
+				const char *uniformBlockName = reader.readString();
+				const unsigned int defaultIndex = reader.readUInt32();
+				if (nullptr != program && nullptr != uniformBlockName)
+				{
+					static_cast<Renderer::IProgram*>(program)->getUniformBlockIndex(uniformBlockName, defaultIndex);
+				}
+				break;
+			}
+
+			case TraceFormat::Command::GET_UNIFORM_HANDLE:
+			{
+				const unsigned int programId = reader.readUInt32();
+				const char *uniformName = reader.readString();
+				const unsigned int uniformHandleIndex = reader.readUInt32();
+				Resource *resourceEntry = getResourceEntry(programId);
+				if (nullptr != resourceEntry && nullptr != resourceEntry->resource && nullptr != uniformName && uniformHandleIndex > 0)
+				{
+					if (resourceEntry->uniformHandles.size() < uniformHandleIndex)
+					{
+						resourceEntry->uniformHandles.resize(uniformHandleIndex, NULL_HANDLE);
+					}
+					resourceEntry->uniformHandles[uniformHandleIndex - 1] = static_cast<Renderer::IProgram*>(resourceEntry->resource)->getUniformHandle(uniformName);
+				}
+				break;
+			}
+
+			case TraceFormat::Command::SET_TEXTURE_UNIT:
+			case TraceFormat::Command::SET_UNIFORM_1I:
+			case TraceFormat::Command::SET_UNIFORM_1F:
+			case TraceFormat::Command::SET_UNIFORM_2FV:
+			case TraceFormat::Command::SET_UNIFORM_3FV:
+			case TraceFormat::Command::SET_UNIFORM_4FV:
+			case TraceFormat::Command::SET_UNIFORM_MATRIX_3FV:
+			case TraceFormat::Command::SET_UNIFORM_MATRIX_4FV:
+			{
+				const unsigned int programId = reader.readUInt32();
+				const handle uniformHandle = getUniformHandle(programId, reader.readUInt32());
+				Renderer::IProgram *program = static_cast<Renderer::IProgram*>(getResource(programId));
+				float values[16];
+				switch (command)
+				{
+					case TraceFormat::Command::SET_TEXTURE_UNIT:
+					{
+						const unsigned int unit = reader.readUInt32();
+						if (nullptr != program)
+						{
+							program->setTextureUnit(uniformHandle, unit);
+						}
+						break;
+					}
+
+					case TraceFormat::Command::SET_UNIFORM_1I:
+					{
+						const int value = reader.readInt32();
+						if (nullptr != program)
+						{
+							program->setUniform1i(uniformHandle, value);
+						}
+						break;
+					}
+
+					case TraceFormat::Command::SET_UNIFORM_1F:
+					{
+						const float value = reader.readFloat();
+						if (nullptr != program)
+						{
+							program->setUniform1f(uniformHandle, value);
+						}
+						break;
+					}
+
+					case TraceFormat::Command::SET_UNIFORM_2FV:
+						reader.readFloats(values, 2);
+						if (nullptr != program)
+						{
+							program->setUniform2fv(uniformHandle, values);
+						}
+						break;
+
+					case TraceFormat::Command::SET_UNIFORM_3FV:
+						reader.readFloats(values, 3);
+						if (nullptr != program)
+						{
+							program->setUniform3fv(uniformHandle, values);
+						}
+						break;
+
+					case TraceFormat::Command::SET_UNIFORM_4FV:
+						reader.readFloats(values, 4);
+						if (nullptr != program)
+						{
+							program->setUniform4fv(uniformHandle, values);
+						}
+						break;
+
+					case TraceFormat::Command::SET_UNIFORM_MATRIX_3FV:
+						reader.readFloats(values, 9);
+						if (nullptr != program)
+						{
+							program->setUniformMatrix3fv(uniformHandle, values);
+						}
+						break;
+
+					case TraceFormat::Command::SET_UNIFORM_MATRIX_4FV:
+						reader.readFloats(values, 16);
+						if (nullptr != program)
+						{
+							program->setUniformMatrix4fv(uniformHandle, values);
+						}
+						break;
+				}
+				break;
+			}
+
+			//[-------------------------------------------------------]
+			//[ Shader language methods                               ]
+			//[-------------------------------------------------------]
+			case TraceFormat::Command::CREATE_VERTEX_SHADER:
+			case TraceFormat::Command::CREATE_TESSELLATION_CONTROL_SHADER:
+			case TraceFormat::Command::CREATE_TESSELLATION_EVALUATION_SHADER:
+			case TraceFormat::Command::CREATE_GEOMETRY_SHADER:
+			case TraceFormat::Command::CREATE_FRAGMENT_SHADER:
+			case TraceFormat::Command::CREATE_COMPUTE_SHADER:
+			{
+				Resource *shaderLanguageEntry = getResourceEntry(reader.readUInt32());
+				const unsigned int id = reader.readUInt32();
+				const char *sourceCode = reader.readString();
+				unsigned int geometryShaderArguments[3] = { 0, 0, 0 };
+				if (TraceFormat::Command::CREATE_GEOMETRY_SHADER == command)
+				{
+					reader.readRaw(geometryShaderArguments, sizeof(geometryShaderArguments));
+				}
+				const char *profile   = reader.readString();
+				const char *arguments = reader.readString();
+				const char *entry	  = reader.readString();
+				Renderer::IShaderLanguage *shaderLanguage = (nullptr != shaderLanguageEntry) ? shaderLanguageEntry->shaderLanguage : nullptr;
+				if (nullptr != shaderLanguage && nullptr != sourceCode)
+				{
+					Renderer::IResource *shader = nullptr;
+					switch (command)
+					{
+						case TraceFormat::Command::CREATE_VERTEX_SHADER:
+							shader = shaderLanguage->createVertexShader(sourceCode, profile, arguments, entry);
+							break;
+
+						case TraceFormat::Command::CREATE_TESSELLATION_CONTROL_SHADER:
+							shader = shaderLanguage->createTessellationControlShader(sourceCode, profile, arguments, entry);
+							break;
+
+						case TraceFormat::Command::CREATE_TESSELLATION_EVALUATION_SHADER:
+							shader = shaderLanguage->createTessellationEvaluationShader(sourceCode, profile, arguments, entry);
+							break;
+
+						case TraceFormat::Command::CREATE_GEOMETRY_SHADER:
+							shader = shaderLanguage->createGeometryShader(sourceCode, static_cast<Renderer::GsInputPrimitiveTopology::Enum>(geometryShaderArguments[0]), static_cast<Renderer::GsOutputPrimitiveTopology::Enum>(geometryShaderArguments[1]), geometryShaderArguments[2], profile, arguments, entry);
+							break;
+
+						case TraceFormat::Command::CREATE_FRAGMENT_SHADER:
+							shader = shaderLanguage->createFragmentShader(sourceCode, profile, arguments, entry);
+							break;
+
+						case TraceFormat::Command::CREATE_COMPUTE_SHADER:
+							shader = shaderLanguage->createComputeShader(sourceCode, profile, arguments, entry);
+							break;
+					}
+					setResource(id, shader);
+				}
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_PROGRAM:
+			{
+				Resource *shaderLanguageEntry = getResourceEntry(reader.readUInt32());
+				const unsigned int id = reader.readUInt32();
+				Renderer::IVertexShader					*vertexShader				  = static_cast<Renderer::IVertexShader*>(getResource(reader.readUInt32()));
+				Renderer::ITessellationControlShader	*tessellationControlShader	  = static_cast<Renderer::ITessellationControlShader*>(getResource(reader.readUInt32()));
+				Renderer::ITessellationEvaluationShader *tessellationEvaluationShader = static_cast<Renderer::ITessellationEvaluationShader*>(getResource(reader.readUInt32()));
+				Renderer::IGeometryShader				*geometryShader				  = static_cast<Renderer::IGeometryShader*>(getResource(reader.readUInt32()));
+				Renderer::IFragmentShader				*fragmentShader				  = static_cast<Renderer::IFragmentShader*>(getResource(reader.readUInt32()));
+				if (nullptr != shaderLanguageEntry && nullptr != shaderLanguageEntry->shaderLanguage)
+				{
+					setResource(id, shaderLanguageEntry->shaderLanguage->createProgram(vertexShader, tessellationControlShader, tessellationEvaluationShader, geometryShader, fragmentShader));
+				}
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_COMPUTE_PROGRAM:
+			{
+				Resource *shaderLanguageEntry = getResourceEntry(reader.readUInt32());
+				const unsigned int id = reader.readUInt32();
+				Renderer::IComputeShader *computeShader = static_cast<Renderer::IComputeShader*>(getResource(reader.readUInt32()));
+				if (nullptr != shaderLanguageEntry && nullptr != shaderLanguageEntry->shaderLanguage)
+				{
+					setResource(id, shaderLanguageEntry->shaderLanguage->createComputeProgram(computeShader));
+				}
+				break;
+			}
+
+			case TraceFormat::Command::CREATE_UNIFORM_BUFFER:
+			{
+				Resource *shaderLanguageEntry = getResourceEntry(reader.readUInt32());
+				const unsigned int id = reader.readUInt32();
+				const unsigned int numberOfBytes = reader.readUInt32();
+				const Renderer::BufferUsage::Enum bufferUsage = static_cast<Renderer::BufferUsage::Enum>(reader.readUInt32());
+				unsigned int numberOfDataBytes = 0;
+				const void *data = reader.readData(numberOfDataBytes);
+				if (nullptr != shaderLanguageEntry && nullptr != shaderLanguageEntry->shaderLanguage)
+				{
+					setResource(id, shaderLanguageEntry->shaderLanguage->createUniformBuffer(numberOfBytes, data, bufferUsage));
+				}
+				break;
+			}
+		}
+
+		// Not a present
+		return false;
+	}
+
+	/**
+	*  @brief
+	*    Return the resource table entry of a resource ID
+	*/
+	TracePlayer::Resource *TracePlayer::getResourceEntry(unsigned int id)
+	{
+		// Resource IDs are assigned in creation order, so the resource table only grows by a few entries at once
+		if (0 == id)
+		{
+			return nullptr;
+		}
+		if (id >= mResources.size())
+		{
+			// Reject resource IDs of broken traces which would result in a huge resource table
+			if (id > mResources.size() + 0xFFFF)
+			{
+				return nullptr;
+			}
+			const Resource resource = { nullptr, nullptr, std::vector<handle>(), nullptr, 0 };
+			mResources.resize(id + 1, resource);
+		}
+		return &mResources[id];
+	}
+
+	/**
+	*  @brief
+	*    Return the resource of a resource ID
+	*/
+	Renderer::IResource *TracePlayer::getResource(unsigned int id)
+	{
+		return (0 != id && id < mResources.size()) ? mResources[id].resource : nullptr;
+	}
+
+	/**
+	*  @brief
+	*    Set the resource of a resource ID
+	*/
+	void TracePlayer::setResource(unsigned int id, Renderer::IResource *resource)
+	{
+		// Add a reference to the new resource before releasing the previous one, they might be identical
+		if (nullptr != resource)
+		{
+			resource->addReference();
+		}
+		Resource *resourceEntry = getResourceEntry(id);
+		if (nullptr != resourceEntry)
+		{
+			if (nullptr != resourceEntry->resource)
+			{
+				resourceEntry->resource->release();
+			}
+			resourceEntry->resource = resource;
+		}
+		else if (nullptr != resource)
+		{
+			// Error! Invalid resource ID, the reference is released which might destroy the resource.
+			resource->release();
+		}
+	}
+
+	/**
+	*  @brief
+	*    Release the resource and the shader language of a resource ID
+	*/
+	void TracePlayer::releaseResource(unsigned int id)
+	{
+		if (0 != id && id < mResources.size())
+		{
+			Resource &resourceEntry = mResources[id];
+			if (nullptr != resourceEntry.resource)
+			{
+				resourceEntry.resource->release();
+				resourceEntry.resource = nullptr;
+			}
+			if (nullptr != resourceEntry.shaderLanguage)
+			{
+				resourceEntry.shaderLanguage->release();
+				resourceEntry.shaderLanguage = nullptr;
+			}
+			resourceEntry.uniformHandles.clear();
+			resourceEntry.mappedData	 = nullptr;
+			resourceEntry.mappedRowPitch = 0;
+		}
+	}
+
+	/**
+	*  @brief
+	*    Return the uniform handle of a captured uniform handle index
+	*/
+	handle TracePlayer::getUniformHandle(unsigned int programId, unsigned int uniformHandleIndex)
+	{
+		if (0 != programId && programId < mResources.size())
+		{
+			const std::vector<handle> &uniformHandles = mResources[programId].uniformHandles;
+			if (uniformHandleIndex > 0 && uniformHandleIndex <= uniformHandles.size())
+			{
+				return uniformHandles[uniformHandleIndex - 1];
+			}
+		}
+		return NULL_HANDLE;
+	}
+
+	/**
+	*  @brief
+	*    Create an offscreen framebuffer replacing a captured swap chain
+	*/
+	Renderer::IFramebuffer *TracePlayer::createOffscreenFramebuffer(unsigned int width, unsigned int height)
+	{
+		// Create the color texture instance
+		Renderer::ITexture *texture = mRenderer->createTexture2D((width > 0) ? width : 1, (height > 0) ? height : 1, Renderer::TextureFormat::R8G8B8A8, nullptr, Renderer::TextureFlag::RENDER_TARGET, Renderer::TextureUsage::DEFAULT);
+		if (nullptr != texture)
+		{
+			// Create the framebuffer object (FBO) instance, the framebuffer keeps a reference to the texture in case it needs it
+			texture->addReference();
+			Renderer::IFramebuffer *framebuffer = mRenderer->createFramebuffer(1, &texture);
+			texture->release();
+			return framebuffer;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
@@ -0,0 +1,1586 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/TraceRenderer.h"
+#include "TraceRenderer/Mapping.h"
+#include "TraceRenderer/Program.h"
+#include "TraceRenderer/Texture2D.h"
+#include "TraceRenderer/Texture2DArray.h"
+#include "TraceRenderer/IndexBuffer.h"
+#include "TraceRenderer/IndirectBuffer.h"
+#include "TraceRenderer/BlendState.h"
+#include "TraceRenderer/SamplerState.h"
+#include "TraceRenderer/TextureBuffer.h"
+#include "TraceRenderer/VertexBuffer.h"
+#include "TraceRenderer/VertexArray.h"
+#include "TraceRenderer/SwapChain.h"
+#include "TraceRenderer/Framebuffer.h"
+#include "TraceRenderer/RasterizerState.h"
+#include "TraceRenderer/DepthStencilState.h"
+#include "TraceRenderer/TextureCollection.h"
+#include "TraceRenderer/SamplerStateCollection.h"
+#include "TraceRenderer/ShaderLanguage.h"
+#include "TraceRenderer/UniformBuffer.h"
+#include "TraceRenderer/VertexShader.h"
+#include "TraceRenderer/ComputeShader.h"
+#include "TraceRenderer/GeometryShader.h"
+#include "TraceRenderer/FragmentShader.h"
+#include "TraceRenderer/TessellationControlShader.h"
+#include "TraceRenderer/TessellationEvaluationShader.h"
+#include "TraceRenderer/Fence.h"
+
+#include <Renderer/BlendStateTypes.h>
+#include <Renderer/SamplerStateTypes.h>
+#include <Renderer/RasterizerStateTypes.h>
+#include <Renderer/DepthStencilStateTypes.h>
+
+#include <string.h>	// For "memset()"
+
+
+//[-------------------------------------------------------]
+//[ Global functions                                      ]
+//[-------------------------------------------------------]
+// Export the instance creation function
+#ifdef TRACERENDERER_EXPORTS
+	#define TRACERENDERER_API_EXPORT GENERIC_API_EXPORT
+#else
+	#define TRACERENDERER_API_EXPORT
+#endif
+TRACERENDERER_API_EXPORT Renderer::IRenderer *createTraceRendererInstance(Renderer::IRenderer &renderer, const char *filename)
+{
+	// Create the trace renderer instance, in case the trace file can't be created there's no use in it
+	TraceRenderer::TraceRenderer *traceRenderer = new (renderer.getAllocator()) TraceRenderer::TraceRenderer(renderer, filename);
+	if (nullptr != traceRenderer && nullptr != filename && !traceRenderer->getTraceWriter().isOpen())
+	{
+		// Error!
+		RENDERER_OUTPUT_DEBUG_PRINTF("Trace error: Failed to create the trace file \"%s\"\n", filename)
+
+		// The trace renderer instance doesn't keep a reference to the given renderer instance in this situation
+		delete traceRenderer;
+		traceRenderer = nullptr;
+	}
+	return traceRenderer;
+}
+#undef TRACERENDERER_API_EXPORT
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Return the wrapped resource of a trace resource
+	*/
+	Renderer::IResource *TraceRenderer::unwrapResource(Renderer::IResource *resource)
+	{
+		TraceResource *traceResource = getTraceResource(resource);
+		return (nullptr != traceResource) ? &traceResource->getWrappedResource() : nullptr;
+	}
+
+	/**
+	*  @brief
+	*    Return the trace resource ID of a trace resource
+	*/
+	unsigned int TraceRenderer::getResourceId(Renderer::IResource *resource)
+	{
+		TraceResource *traceResource = getTraceResource(resource);
+		return (nullptr != traceResource) ? traceResource->getId() : 0;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	TraceRenderer::TraceRenderer(Renderer::IRenderer &renderer, const char *filename) :
+		IRenderer(&renderer.getAllocator()),
+		mRenderer(&renderer),
+		mInitialized(false),
+		mTraceWriter(getStatistics().currentFrame, getAllocator()),
+		mShaderLanguages(Renderer::StlAllocator<ShaderLanguage*>(getAllocator(), Renderer::AllocationTag::RENDERER)),
+		mMappedResources(Renderer::StlAllocator<MappedResource>(getAllocator(), Renderer::AllocationTag::RENDERER)),
+		mMainSwapChain(nullptr),
+		mRenderTarget(nullptr),
+		mPrimitiveTopology(Renderer::PrimitiveTopology::UNKNOWN)
+	{
+		// Initially, no resources are set
+		memset(mResourceIds, 0, sizeof(mResourceIds));
+		memset(mShaderStageResourceIds, 0, sizeof(mShaderStageResourceIds));
+
+		// Create the trace file, in case there's one, if the trace file can't be created the trace renderer instance is useless
+		if (nullptr == filename || mTraceWriter.open(filename, mRenderer->getName()))
+		{
+			mInitialized = true;
+			mRenderer->addReference();
+
+			// The capabilities are the ones of the wrapped renderer
+			initializeCapabilities();
+
+			// Wrap the main swap chain, in case there's one
+			Renderer::ISwapChain *mainSwapChain = mRenderer->getMainSwapChain();
+			if (nullptr != mainSwapChain)
+			{
+				mMainSwapChain = new (getAllocator()) SwapChain(*this, *mainSwapChain);
+				mMainSwapChain->addReference();	// Internal renderer reference
+
+				// Record the main swap chain, the player needs its size in case it has to replace it by an offscreen framebuffer
+				unsigned int width  = 0;
+				unsigned int height = 0;
+				mainSwapChain->getWidthAndHeight(width, height);
+				mTraceWriter.beginCommand(TraceFormat::Command::MAIN_SWAP_CHAIN);
+				mTraceWriter.writeUInt32(mMainSwapChain->getId());
+				mTraceWriter.writeUInt32(width);
+				mTraceWriter.writeUInt32(height);
+
+				// By default, the main swap chain is the currently used render target
+				if (mRenderer->omGetRenderTarget() == mainSwapChain)
+				{
+					mRenderTarget = mMainSwapChain;
+					mRenderTarget->addReference();
+				}
+			}
+		}
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	TraceRenderer::~TraceRenderer()
+	{
+		// Release instances
+		if (nullptr != mMainSwapChain)
+		{
+			mMainSwapChain->release();
+			mMainSwapChain = nullptr;
+		}
+		if (nullptr != mRenderTarget)
+		{
+			mRenderTarget->release();
+			mRenderTarget = nullptr;
+		}
+
+		{ // For debugging: At this point there should be no resource instances left, validate this!
+			// -> Are the currently any resource instances?
+			const unsigned long numberOfCurrentResources = getStatistics().getNumberOfCurrentResources();
+			if (numberOfCurrentResources > 0)
+			{
+				// Error!
+				if (numberOfCurrentResources > 1)
+				{
+					RENDERER_OUTPUT_DEBUG_PRINTF("Trace error: Renderer is going to be destroyed, but there are still %d resource instances left (memory leak)\n", numberOfCurrentResources)
+				}
+				else
+				{
+					RENDERER_OUTPUT_DEBUG_STRING("Trace error: Renderer is going to be destroyed, but there is still one resource instance left (memory leak)\n")
+				}
+
+				// Use debug output to show the current number of resource instances
+				getStatistics().debugOutputCurrentResouces();
+			}
+		}
+
+		// Release the trace shader language instances
+		const size_t numberOfShaderLanguages = mShaderLanguages.size();
+		for (size_t i = 0; i < numberOfShaderLanguages; ++i)
+		{
+			mShaderLanguages[i]->release();
+		}
+		mShaderLanguages.clear();
+
+		// Close the trace file, in case there's one
+		mTraceWriter.close();
+
+		// Release the wrapped renderer instance, in case we have a reference to it
+		if (mInitialized)
+		{
+			mRenderer->release();
+		}
+	}
+
+	/**
+	*  @brief
+	*    Inform the trace renderer that a trace swap chain was presented
+	*/
+	void TraceRenderer::onPresent(SwapChain &swapChain)
+	{
+		// Presenting the main swap chain ends the current frame, without a main swap chain every present does
+		if (nullptr == mMainSwapChain || mMainSwapChain == &swapChain)
+		{
+			getStatistics().endFrame();
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IRenderer methods            ]
+	//[-------------------------------------------------------]
+	const char *TraceRenderer::getName() const
+	{
+		// Return the name of the wrapped renderer, e.g. the examples are choosing their shader source codes by it
+		return mRenderer->getName();
+	}
+
+	bool TraceRenderer::isInitialized() const
+	{
+		return (mInitialized && mRenderer->isInitialized());
+	}
+
+	Renderer::ISwapChain *TraceRenderer::getMainSwapChain() const
+	{
+		return reinterpret_cast<Renderer::ISwapChain*>(mMainSwapChain);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Shader language                                       ]
+	//[-------------------------------------------------------]
+	unsigned int TraceRenderer::getNumberOfShaderLanguages() const
+	{
+		return mRenderer->getNumberOfShaderLanguages();
+	}
+
+	const char *TraceRenderer::getShaderLanguageName(unsigned int index) const
+	{
+		return mRenderer->getShaderLanguageName(index);
+	}
+
+	Renderer::IShaderLanguage *TraceRenderer::getShaderLanguage(const char *shaderLanguageName)
+	{
+		// Forward
+		Renderer::IShaderLanguage *shaderLanguage = mRenderer->getShaderLanguage(shaderLanguageName);
+		if (nullptr != shaderLanguage)
+		{
+			// Is there already a trace shader language wrapping the shader language?
+			const size_t numberOfShaderLanguages = mShaderLanguages.size();
+			for (size_t i = 0; i < numberOfShaderLanguages; ++i)
+			{
+				if (&mShaderLanguages[i]->getWrappedShaderLanguage() == shaderLanguage)
+				{
+					return mShaderLanguages[i];
+				}
+			}
+
+			// Create the trace shader language instance
+			ShaderLanguage *traceShaderLanguage = new (getAllocator()) ShaderLanguage(*this, *shaderLanguage);
+			traceShaderLanguage->addReference();	// Internal renderer reference
+			mShaderLanguages.push_back(traceShaderLanguage);
+
+			// Record
+			mTraceWriter.beginCommand(TraceFormat::Command::GET_SHADER_LANGUAGE);
+			mTraceWriter.writeUInt32(traceShaderLanguage->getId());
+			mTraceWriter.writeString(shaderLanguage->getShaderLanguageName());
+
+			// Done
+			return traceShaderLanguage;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Resource creation                                     ]
+	//[-------------------------------------------------------]
+	Renderer::ISwapChain *TraceRenderer::createSwapChain(handle nativeWindowHandle)
+	{
+		// Forward
+		Renderer::ISwapChain *swapChain = mRenderer->createSwapChain(nativeWindowHandle);
+		if (nullptr != swapChain)
+		{
+			// Create the trace swap chain
+			SwapChain *traceSwapChain = new (getAllocator()) SwapChain(*this, *swapChain);
+
+			// Record, the native window handle is meaningless inside the trace so record the size instead
+			unsigned int width  = 0;
+			unsigned int height = 0;
+			swapChain->getWidthAndHeight(width, height);
+			mTraceWriter.beginCommand(TraceFormat::Command::CREATE_SWAP_CHAIN);
+			mTraceWriter.writeUInt32(traceSwapChain->getId());
+			mTraceWriter.writeUInt32(width);
+			mTraceWriter.writeUInt32(height);
+
+			// Done
+			return traceSwapChain;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::IFramebuffer *TraceRenderer::createFramebuffer(unsigned int numberOfColorTextures, Renderer::ITexture **colorTextures, Renderer::ITexture *depthStencilTexture)
+	{
+		// Forward using the wrapped textures
+		std::vector<Renderer::ITexture*, Renderer::StlAllocator<Renderer::ITexture*> > wrappedColorTextures(numberOfColorTextures, nullptr, Renderer::StlAllocator<Renderer::ITexture*>(getAllocator(), Renderer::AllocationTag::TEMPORARY));
+		for (unsigned int i = 0; i < numberOfColorTextures; ++i)
+		{
+			wrappedColorTextures[i] = static_cast<Renderer::ITexture*>(unwrapResource(colorTextures[i]));
+		}
+		Renderer::IFramebuffer *framebuffer = mRenderer->createFramebuffer(numberOfColorTextures, wrappedColorTextures.empty() ? nullptr : &wrappedColorTextures[0], static_cast<Renderer::ITexture*>(unwrapResource(depthStencilTexture)));
+
+		// The trace framebuffer keeps a reference to the trace textures
+		// -> Ensure a correct reference counter behaviour, even in the situation of an error
+		Framebuffer *traceFramebuffer = (nullptr != framebuffer) ? new (getAllocator()) Framebuffer(*this, *framebuffer) : nullptr;
+		for (unsigned int i = 0; i <= numberOfColorTextures; ++i)
+		{
+			Renderer::ITexture *texture = (i < numberOfColorTextures) ? colorTextures[i] : depthStencilTexture;
+			if (nullptr != texture)
+			{
+				texture->addReference();
+				if (nullptr != traceFramebuffer)
+				{
+					traceFramebuffer->addReferencedResource(texture);
+				}
+				texture->release();
+			}
+		}
+
+		// Record
+		if (nullptr != traceFramebuffer)
+		{
+			mTraceWriter.beginCommand(TraceFormat::Command::CREATE_FRAMEBUFFER);
+			mTraceWriter.writeUInt32(traceFramebuffer->getId());
+			mTraceWriter.writeUInt32(numberOfColorTextures);
+			for (unsigned int i = 0; i < numberOfColorTextures; ++i)
+			{
+				mTraceWriter.writeUInt32(getResourceId(colorTextures[i]));
+			}
+			mTraceWriter.writeUInt32(getResourceId(depthStencilTexture));
+		}
+
+		// Done
+		return traceFramebuffer;
+	}
+
+	Renderer::IVertexBuffer *TraceRenderer::createVertexBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
+	{
+		// Forward
+		Renderer::IVertexBuffer *vertexBuffer = mRenderer->createVertexBuffer(numberOfBytes, data, bufferUsage);
+		if (nullptr != vertexBuffer)
+		{
+			// Create the trace vertex buffer
+			VertexBuffer *traceVertexBuffer = new (getAllocator()) VertexBuffer(*this, *vertexBuffer, numberOfBytes);
+
+			// Record
+			mTraceWriter.beginCommand(TraceFormat::Command::CREATE_VERTEX_BUFFER);
+			mTraceWriter.writeUInt32(traceVertexBuffer->getId());
+			mTraceWriter.writeUInt32(numberOfBytes);
+			mTraceWriter.writeUInt32(static_cast<unsigned int>(bufferUsage));
+			mTraceWriter.writeData(data, numberOfBytes);
+
+			// Done
+			return traceVertexBuffer;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::IIndexBuffer *TraceRenderer::createIndexBuffer(unsigned int numberOfBytes, Renderer::IndexBufferFormat::Enum indexBufferFormat, const void *data, Renderer::BufferUsage::Enum bufferUsage)
+	{
+		// Forward
+		Renderer::IIndexBuffer *indexBuffer = mRenderer->createIndexBuffer(numberOfBytes, indexBufferFormat, data, bufferUsage);
+		if (nullptr != indexBuffer)
+		{
+			// Create the trace index buffer
+			IndexBuffer *traceIndexBuffer = new (getAllocator()) IndexBuffer(*this, *indexBuffer, numberOfBytes);
+
+			// Record
+			mTraceWriter.beginCommand(TraceFormat::Command::CREATE_INDEX_BUFFER);
+			mTraceWriter.writeUInt32(traceIndexBuffer->getId());
+			mTraceWriter.writeUInt32(numberOfBytes);
+			mTraceWriter.writeUInt32(static_cast<unsigned int>(indexBufferFormat));
+			mTraceWriter.writeUInt32(static_cast<unsigned int>(bufferUsage));
+			mTraceWriter.writeData(data, numberOfBytes);
+
+			// Done
+			return traceIndexBuffer;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::ITextureBuffer *TraceRenderer::createTextureBuffer(unsigned int numberOfBytes, Renderer::TextureFormat::Enum textureFormat, const void *data, Renderer::BufferUsage::Enum bufferUsage)
+	{
+		// Forward
+		Renderer::ITextureBuffer *textureBuffer = mRenderer->createTextureBuffer(numberOfBytes, textureFormat, data, bufferUsage);
+		if (nullptr != textureBuffer)
+		{
+			// Create the trace texture buffer
+			TextureBuffer *traceTextureBuffer = new (getAllocator()) TextureBuffer(*this, *textureBuffer, numberOfBytes);
+
+			// Record
+			mTraceWriter.beginCommand(TraceFormat::Command::CREATE_TEXTURE_BUFFER);
+			mTraceWriter.writeUInt32(traceTextureBuffer->getId());
+			mTraceWriter.writeUInt32(numberOfBytes);
+			mTraceWriter.writeUInt32(static_cast<unsigned int>(textureFormat));
+			mTraceWriter.writeUInt32(static_cast<unsigned int>(bufferUsage));
+			mTraceWriter.writeData(data, numberOfBytes);
+
+			// Done
+			return traceTextureBuffer;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::IIndirectBuffer *TraceRenderer::createIndirectBuffer(unsigned int numberOfBytes, const void *data, Renderer::BufferUsage::Enum bufferUsage)
+	{
+		// Forward
+		Renderer::IIndirectBuffer *indirectBuffer = mRenderer->createIndirectBuffer(numberOfBytes, data, bufferUsage);
+		if (nullptr != indirectBuffer)
+		{
+			// Create the trace indirect buffer
+			IndirectBuffer *traceIndirectBuffer = new (getAllocator()) IndirectBuffer(*this, *indirectBuffer, numberOfBytes);
+
+			// Record
+			mTraceWriter.beginCommand(TraceFormat::Command::CREATE_INDIRECT_BUFFER);
+			mTraceWriter.writeUInt32(traceIndirectBuffer->getId());
+			mTraceWriter.writeUInt32(numberOfBytes);
+			mTraceWriter.writeUInt32(static_cast<unsigned int>(bufferUsage));
+			mTraceWriter.writeData(data, numberOfBytes);
+
+			// Done
+			return traceIndirectBuffer;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::ITexture2D *TraceRenderer::createTexture2D(unsigned int width, unsigned int height, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage, unsigned int numberOfMultisamples)
+	{
+		// Forward
+		Renderer::ITexture2D *texture2D = mRenderer->createTexture2D(width, height, textureFormat, data, flags, textureUsage, numberOfMultisamples);
+		if (nullptr != texture2D)
+		{
+			// Create the trace 2D texture
+			Texture2D *traceTexture2D = new (getAllocator()) Texture2D(*this, *texture2D, textureFormat);
+
+			// Record, the given data is the base level only
+			mTraceWriter.beginCommand(TraceFormat::Command::CREATE_TEXTURE_2D);
+			mTraceWriter.writeUInt32(traceTexture2D->getId());
+			mTraceWriter.writeUInt32(width);
+			mTraceWriter.writeUInt32(height);
+			mTraceWriter.writeUInt32(static_cast<unsigned int>(textureFormat));
+			mTraceWriter.writeUInt32(flags);
+			mTraceWriter.writeUInt32(static_cast<unsigned int>(textureUsage));
+			mTraceWriter.writeUInt32(numberOfMultisamples);
+			mTraceWriter.writeData(data, width * height * Mapping::getSize(textureFormat));
+
+			// Done
+			return traceTexture2D;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::ITexture2DArray *TraceRenderer::createTexture2DArray(unsigned int width, unsigned int height, unsigned int numberOfSlices, Renderer::TextureFormat::Enum textureFormat, void *data, unsigned int flags, Renderer::TextureUsage::Enum textureUsage)
+	{
+		// Forward
+		Renderer::ITexture2DArray *texture2DArray = mRenderer->createTexture2DArray(width, height, numberOfSlices, textureFormat, data, flags, textureUsage);
+		if (nullptr != texture2DArray)
+		{
+			// Create the trace 2D texture array
+			Texture2DArray *traceTexture2DArray = new (getAllocator()) Texture2DArray(*this, *texture2DArray, textureFormat);
+
+			// Record, the given data is the base level only
+			mTraceWriter.beginCommand(TraceFormat::Command::CREATE_TEXTURE_2D_ARRAY);
+			mTraceWriter.writeUInt32(traceTexture2DArray->getId());
+			mTraceWriter.writeUInt32(width);
+			mTraceWriter.writeUInt32(height);
+			mTraceWriter.writeUInt32(numberOfSlices);
+			mTraceWriter.writeUInt32(static_cast<unsigned int>(textureFormat));
+			mTraceWriter.writeUInt32(flags);
+			mTraceWriter.writeUInt32(static_cast<unsigned int>(textureUsage));
+			mTraceWriter.writeData(data, width * height * numberOfSlices * Mapping::getSize(textureFormat));
+
+			// Done
+			return traceTexture2DArray;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::IRasterizerState *TraceRenderer::createRasterizerState(const Renderer::RasterizerState &rasterizerState)
+	{
+		// Forward
+		Renderer::IRasterizerState *rasterizerStateInstance = mRenderer->createRasterizerState(rasterizerState);
+		if (nullptr != rasterizerStateInstance)
+		{
+			// Create the trace rasterizer state
+			RasterizerState *traceRasterizerState = new (getAllocator()) RasterizerState(*this, *rasterizerStateInstance);
+
+			// Record
+			mTraceWriter.beginCommand(TraceFormat::Command::CREATE_RASTERIZER_STATE);
+			mTraceWriter.writeUInt32(traceRasterizerState->getId());
+			mTraceWriter.writeRaw(&rasterizerState, sizeof(Renderer::RasterizerState));
+
+			// Done
+			return traceRasterizerState;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::IDepthStencilState *TraceRenderer::createDepthStencilState(const Renderer::DepthStencilState &depthStencilState)
+	{
+		// Forward
+		Renderer::IDepthStencilState *depthStencilStateInstance = mRenderer->createDepthStencilState(depthStencilState);
+		if (nullptr != depthStencilStateInstance)
+		{
+			// Create the trace depth stencil state
+			DepthStencilState *traceDepthStencilState = new (getAllocator()) DepthStencilState(*this, *depthStencilStateInstance);
+
+			// Record
+			mTraceWriter.beginCommand(TraceFormat::Command::CREATE_DEPTH_STENCIL_STATE);
+			mTraceWriter.writeUInt32(traceDepthStencilState->getId());
+			mTraceWriter.writeRaw(&depthStencilState, sizeof(Renderer::DepthStencilState));
+
+			// Done
+			return traceDepthStencilState;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::IBlendState *TraceRenderer::createBlendState(const Renderer::BlendState &blendState)
+	{
+		// Forward
+		Renderer::IBlendState *blendStateInstance = mRenderer->createBlendState(blendState);
+		if (nullptr != blendStateInstance)
+		{
+			// Create the trace blend state
+			BlendState *traceBlendState = new (getAllocator()) BlendState(*this, *blendStateInstance);
+
+			// Record
+			mTraceWriter.beginCommand(TraceFormat::Command::CREATE_BLEND_STATE);
+			mTraceWriter.writeUInt32(traceBlendState->getId());
+			mTraceWriter.writeRaw(&blendState, sizeof(Renderer::BlendState));
+
+			// Done
+			return traceBlendState;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::ISamplerState *TraceRenderer::createSamplerState(const Renderer::SamplerState &samplerState)
+	{
+		// Forward
+		Renderer::ISamplerState *samplerStateInstance = mRenderer->createSamplerState(samplerState);
+		if (nullptr != samplerStateInstance)
+		{
+			// Create the trace sampler state
+			SamplerState *traceSamplerState = new (getAllocator()) SamplerState(*this, *samplerStateInstance);
+
+			// Record
+			mTraceWriter.beginCommand(TraceFormat::Command::CREATE_SAMPLER_STATE);
+			mTraceWriter.writeUInt32(traceSamplerState->getId());
+			mTraceWriter.writeRaw(&samplerState, sizeof(Renderer::SamplerState));
+
+			// Done
+			return traceSamplerState;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	Renderer::ITextureCollection *TraceRenderer::createTextureCollection(unsigned int numberOfTextures, Renderer::ITexture **textures)
+	{
+		// Forward using the wrapped textures
+		std::vector<Renderer::ITexture*, Renderer::StlAllocator<Renderer::ITexture*> > wrappedTextures(numberOfTextures, nullptr, Renderer::StlAllocator<Renderer::ITexture*>(getAllocator(), Renderer::AllocationTag::TEMPORARY));
+		for (unsigned int i = 0; i < numberOfTextures; ++i)
+		{
+			wrappedTextures[i] = static_cast<Renderer::ITexture*>(unwrapResource(textures[i]));
+		}
+		Renderer::ITextureCollection *textureCollection = mRenderer->createTextureCollection(numberOfTextures, wrappedTextures.empty() ? nullptr : &wrappedTextures[0]);
+
+		// The trace texture collection keeps a reference to the trace textures
+		// -> Ensure a correct reference counter behaviour, even in the situation of an error
+		TextureCollection *traceTextureCollection = (nullptr != textureCollection) ? new (getAllocator()) TextureCollection(*this, *textureCollection) : nullptr;
+		for (unsigned int i = 0; i < numberOfTextures; ++i)
+		{
+			if (nullptr != textures[i])
+			{
+				textures[i]->addReference();
+				if (nullptr != traceTextureCollection)
+				{
+					traceTextureCollection->addReferencedResource(textures[i]);
+				}
+				textures[i]->release();
+			}
+		}
+
+		// Record
+		if (nullptr != traceTextureCollection)
+		{
+			mTraceWriter.beginCommand(TraceFormat::Command::CREATE_TEXTURE_COLLECTION);
+			mTraceWriter.writeUInt32(traceTextureCollection->getId());
+			mTraceWriter.writeUInt32(numberOfTextures);
+			for (unsigned int i = 0; i < numberOfTextures; ++i)
+			{
+				mTraceWriter.writeUInt32(getResourceId(textures[i]));
+			}
+		}
+
+		// Done
+		return traceTextureCollection;
+	}
+
+	Renderer::ISamplerStateCollection *TraceRenderer::createSamplerStateCollection(unsigned int numberOfSamplerStates, Renderer::ISamplerState **samplerStates)
+	{
+		// Forward using the wrapped sampler states
+		std::vector<Renderer::ISamplerState*, Renderer::StlAllocator<Renderer::ISamplerState*> > wrappedSamplerStates(numberOfSamplerStates, nullptr, Renderer::StlAllocator<Renderer::ISamplerState*>(getAllocator(), Renderer::AllocationTag::TEMPORARY));
+		for (unsigned int i = 0; i < numberOfSamplerStates; ++i)
+		{
+			wrappedSamplerStates[i] = static_cast<Renderer::ISamplerState*>(unwrapResource(samplerStates[i]));
+		}
+		Renderer::ISamplerStateCollection *samplerStateCollection = mRenderer->createSamplerStateCollection(numberOfSamplerStates, wrappedSamplerStates.empty() ? nullptr : &wrappedSamplerStates[0]);
+
+		// The trace sampler state collection keeps a reference to the trace sampler states
+		// -> Ensure a correct reference counter behaviour, even in the situation of an error
+		SamplerStateCollection *traceSamplerStateCollection = (nullptr != samplerStateCollection) ? new (getAllocator()) SamplerStateCollection(*this, *samplerStateCollection) : nullptr;
+		for (unsigned int i = 0; i < numberOfSamplerStates; ++i)
+		{
+			if (nullptr != samplerStates[i])
+			{
+				samplerStates[i]->addReference();
+				if (nullptr != traceSamplerStateCollection)
+				{
+					traceSamplerStateCollection->addReferencedResource(samplerStates[i]);
+				}
+				samplerStates[i]->release();
+			}
+		}
+
+		// Record
+		if (nullptr != traceSamplerStateCollection)
+		{
+			mTraceWriter.beginCommand(TraceFormat::Command::CREATE_SAMPLER_STATE_COLLECTION);
+			mTraceWriter.writeUInt32(traceSamplerStateCollection->getId());
+			mTraceWriter.writeUInt32(numberOfSamplerStates);
+			for (unsigned int i = 0; i < numberOfSamplerStates; ++i)
+			{
+				mTraceWriter.writeUInt32(getResourceId(samplerStates[i]));
+			}
+		}
+
+		// Done
+		return traceSamplerStateCollection;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Resource handling                                     ]
+	//[-------------------------------------------------------]
+	bool TraceRenderer::map(Renderer::IResource &resource, unsigned int subresource, Renderer::MapType::Enum mapType, unsigned int mapFlags, Renderer::MappedSubresource &mappedSubresource)
+	{
+		// Forward
+		if (mRenderer->map(*unwrapResource(&resource), subresource, mapType, mapFlags, mappedSubresource))
+		{
+			// Record
+			const unsigned int id = getResourceId(&resource);
+			mTraceWriter.beginCommand(TraceFormat::Command::MAP);
+			mTraceWriter.writeUInt32(id);
+			mTraceWriter.writeUInt32(subresource);
+			mTraceWriter.writeUInt32(static_cast<unsigned int>(mapType));
+			mTraceWriter.writeUInt32(mapFlags);
+
+			// Remember resources mapped for writing, the written data is recorded when the resource gets unmapped
+			if (Renderer::MapType::READ != mapType)
+			{
+				MappedResource mappedResource;
+				mappedResource.id			 = id;
+				mappedResource.subresource	 = subresource;
+				mappedResource.data			 = mappedSubresource.data;
+				mappedResource.numberOfBytes = 0;
+				mappedResource.rowPitch		 = 0;
+				switch (resource.getResourceType())
+				{
+					case Renderer::ResourceType::INDEX_BUFFER:
+					case Renderer::ResourceType::VERTEX_BUFFER:
+					case Renderer::ResourceType::UNIFORM_BUFFER:
+					case Renderer::ResourceType::INDIRECT_BUFFER:
+					case Renderer::ResourceType::TEXTURE_BUFFER:
+						// The number of bytes of the trace buffers is the exact number of bytes of the buffers
+						mappedResource.numberOfBytes = static_cast<unsigned int>(resource.getNumberOfBytes());
+						break;
+
+					case Renderer::ResourceType::TEXTURE_2D:
+					case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+					{
+						// Not all renderer backends provide a depth pitch for 2D textures, the subresource is the mipmap in here
+						const unsigned int height = (Renderer::ResourceType::TEXTURE_2D == resource.getResourceType()) ? static_cast<Texture2D&>(resource).getHeight() : static_cast<Texture2DArray&>(resource).getHeight();
+						const unsigned int mipmapHeight = (subresource < 32 && (height >> subresource) > 0) ? (height >> subresource) : 1;
+						mappedResource.numberOfBytes = (0 != mappedSubresource.depthPitch) ? mappedSubresource.depthPitch : mappedSubresource.rowPitch * mipmapHeight;
+						mappedResource.rowPitch		 = mappedSubresource.rowPitch;
+						break;
+					}
+
+					default:
+						// Nothing to record for other resource types
+						break;
+				}
+				if (nullptr != mappedResource.data && mappedResource.numberOfBytes > 0)
+				{
+					mMappedResources.push_back(mappedResource);
+				}
+			}
+
+			// Done
+			return true;
+		}
+
+		// Error!
+		return false;
+	}
+
+	void TraceRenderer::unmap(Renderer::IResource &resource, unsigned int subresource)
+	{
+		// Record, the written data must be recorded before the wrapped resource gets unmapped
+		const unsigned int id = getResourceId(&resource);
+		mTraceWriter.beginCommand(TraceFormat::Command::UNMAP);
+		mTraceWriter.writeUInt32(id);
+		mTraceWriter.writeUInt32(subresource);
+		MappedResources::iterator iterator = mMappedResources.begin();
+		while (iterator != mMappedResources.end() && (iterator->id != id || iterator->subresource != subresource))
+		{
+			++iterator;
+		}
+		if (iterator != mMappedResources.end())
+		{
+			mTraceWriter.writeUInt32(iterator->rowPitch);
+			mTraceWriter.writeData(iterator->data, iterator->numberOfBytes);
+			mMappedResources.erase(iterator);
+		}
+		else
+		{
+			// The resource was not mapped for writing
+			mTraceWriter.writeUInt32(0);
+			mTraceWriter.writeData(nullptr, 0);
+		}
+
+		// Forward
+		mRenderer->unmap(*unwrapResource(&resource), subresource);
+	}
+
+	bool TraceRenderer::copyResource(Renderer::IResource &destinationResource, Renderer::IResource &sourceResource)
+	{
+		// Record
+		mTraceWriter.beginCommand(TraceFormat::Command::COPY_RESOURCE);
+		mTraceWriter.writeUInt32(getResourceId(&destinationResource));
+		mTraceWriter.writeUInt32(getResourceId(&sourceResource));
+
+		// Forward
+		return mRenderer->copyResource(*unwrapResource(&destinationResource), *unwrapResource(&sourceResource));
+	}
+
+	void TraceRenderer::setTextureResident(Renderer::ITexture &texture, Renderer::ISamplerState *samplerState, bool resident)
+	{
+		// Forward, there's nothing to record: The bindless handles used by a trace are only valid inside the captured process
+		mRenderer->setTextureResident(*static_cast<Renderer::ITexture*>(unwrapResource(&texture)), static_cast<Renderer::ISamplerState*>(unwrapResource(samplerState)), resident);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ States                                                ]
+	//[-------------------------------------------------------]
+	void TraceRenderer::setProgram(Renderer::IProgram *program)
+	{
+		recordResource(TraceFormat::Command::SET_PROGRAM, program);
+		mRenderer->setProgram(static_cast<Renderer::IProgram*>(unwrapResource(program)));
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Input-assembler (IA) stage                            ]
+	//[-------------------------------------------------------]
+	void TraceRenderer::iaSetVertexArray(Renderer::IVertexArray *vertexArray)
+	{
+		recordResource(TraceFormat::Command::IA_SET_VERTEX_ARRAY, vertexArray);
+		mRenderer->iaSetVertexArray(static_cast<Renderer::IVertexArray*>(unwrapResource(vertexArray)));
+	}
+
+	void TraceRenderer::iaSetPrimitiveTopology(Renderer::PrimitiveTopology::Enum primitiveTopology)
+	{
+		// The primitive topology is required to count the submitted primitives
+		if (mPrimitiveTopology == primitiveTopology)
+		{
+			++getStatistics().currentFrame.numberOfRedundantApiCalls[Renderer::ApiCall::IA_SET_PRIMITIVE_TOPOLOGY];
+		}
+		mPrimitiveTopology = primitiveTopology;
+
+		// Record and forward
+		mTraceWriter.beginCommand(TraceFormat::Command::IA_SET_PRIMITIVE_TOPOLOGY);
+		mTraceWriter.writeUInt32(static_cast<unsigned int>(primitiveTopology));
+		mRenderer->iaSetPrimitiveTopology(primitiveTopology);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Vertex-shader (VS) stage                              ]
+	//[-------------------------------------------------------]
+	void TraceRenderer::vsSetTexture(unsigned int unit, Renderer::ITexture *texture)
+	{
+		recordShaderStage(TraceFormat::Command::SET_TEXTURE, TraceFormat::ShaderStage::VERTEX_SHADER, unit, texture);
+		mRenderer->vsSetTexture(unit, static_cast<Renderer::ITexture*>(unwrapResource(texture)));
+	}
+
+	void TraceRenderer::vsSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection)
+	{
+		recordShaderStage(TraceFormat::Command::SET_TEXTURE_COLLECTION, TraceFormat::ShaderStage::VERTEX_SHADER, startUnit, textureCollection);
+		mRenderer->vsSetTextureCollection(startUnit, static_cast<Renderer::ITextureCollection*>(unwrapResource(textureCollection)));
+	}
+
+	void TraceRenderer::vsSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState)
+	{
+		recordShaderStage(TraceFormat::Command::SET_SAMPLER_STATE, TraceFormat::ShaderStage::VERTEX_SHADER, unit, samplerState);
+		mRenderer->vsSetSamplerState(unit, static_cast<Renderer::ISamplerState*>(unwrapResource(samplerState)));
+	}
+
+	void TraceRenderer::vsSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection)
+	{
+		recordShaderStage(TraceFormat::Command::SET_SAMPLER_STATE_COLLECTION, TraceFormat::ShaderStage::VERTEX_SHADER, startUnit, samplerStateCollection);
+		mRenderer->vsSetSamplerStateCollection(startUnit, static_cast<Renderer::ISamplerStateCollection*>(unwrapResource(samplerStateCollection)));
+	}
+
+	void TraceRenderer::vsSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer)
+	{
+		recordShaderStage(TraceFormat::Command::SET_UNIFORM_BUFFER, TraceFormat::ShaderStage::VERTEX_SHADER, slot, uniformBuffer);
+		mRenderer->vsSetUniformBuffer(slot, static_cast<Renderer::IUniformBuffer*>(unwrapResource(uniformBuffer)));
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Tessellation-control-shader (TCS) stage               ]
+	//[-------------------------------------------------------]
+	void TraceRenderer::tcsSetTexture(unsigned int unit, Renderer::ITexture *texture)
+	{
+		recordShaderStage(TraceFormat::Command::SET_TEXTURE, TraceFormat::ShaderStage::TESSELLATION_CONTROL_SHADER, unit, texture);
+		mRenderer->tcsSetTexture(unit, static_cast<Renderer::ITexture*>(unwrapResource(texture)));
+	}
+
+	void TraceRenderer::tcsSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection)
+	{
+		recordShaderStage(TraceFormat::Command::SET_TEXTURE_COLLECTION, TraceFormat::ShaderStage::TESSELLATION_CONTROL_SHADER, startUnit, textureCollection);
+		mRenderer->tcsSetTextureCollection(startUnit, static_cast<Renderer::ITextureCollection*>(unwrapResource(textureCollection)));
+	}
+
+	void TraceRenderer::tcsSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState)
+	{
+		recordShaderStage(TraceFormat::Command::SET_SAMPLER_STATE, TraceFormat::ShaderStage::TESSELLATION_CONTROL_SHADER, unit, samplerState);
+		mRenderer->tcsSetSamplerState(unit, static_cast<Renderer::ISamplerState*>(unwrapResource(samplerState)));
+	}
+
+	void TraceRenderer::tcsSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection)
+	{
+		recordShaderStage(TraceFormat::Command::SET_SAMPLER_STATE_COLLECTION, TraceFormat::ShaderStage::TESSELLATION_CONTROL_SHADER, startUnit, samplerStateCollection);
+		mRenderer->tcsSetSamplerStateCollection(startUnit, static_cast<Renderer::ISamplerStateCollection*>(unwrapResource(samplerStateCollection)));
+	}
+
+	void TraceRenderer::tcsSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer)
+	{
+		recordShaderStage(TraceFormat::Command::SET_UNIFORM_BUFFER, TraceFormat::ShaderStage::TESSELLATION_CONTROL_SHADER, slot, uniformBuffer);
+		mRenderer->tcsSetUniformBuffer(slot, static_cast<Renderer::IUniformBuffer*>(unwrapResource(uniformBuffer)));
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Tessellation-evaluation-shader (TES) stage            ]
+	//[-------------------------------------------------------]
+	void TraceRenderer::tesSetTexture(unsigned int unit, Renderer::ITexture *texture)
+	{
+		recordShaderStage(TraceFormat::Command::SET_TEXTURE, TraceFormat::ShaderStage::TESSELLATION_EVALUATION_SHADER, unit, texture);
+		mRenderer->tesSetTexture(unit, static_cast<Renderer::ITexture*>(unwrapResource(texture)));
+	}
+
+	void TraceRenderer::tesSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection)
+	{
+		recordShaderStage(TraceFormat::Command::SET_TEXTURE_COLLECTION, TraceFormat::ShaderStage::TESSELLATION_EVALUATION_SHADER, startUnit, textureCollection);
+		mRenderer->tesSetTextureCollection(startUnit, static_cast<Renderer::ITextureCollection*>(unwrapResource(textureCollection)));
+	}
+
+	void TraceRenderer::tesSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState)
+	{
+		recordShaderStage(TraceFormat::Command::SET_SAMPLER_STATE, TraceFormat::ShaderStage::TESSELLATION_EVALUATION_SHADER, unit, samplerState);
+		mRenderer->tesSetSamplerState(unit, static_cast<Renderer::ISamplerState*>(unwrapResource(samplerState)));
+	}
+
+	void TraceRenderer::tesSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection)
+	{
+		recordShaderStage(TraceFormat::Command::SET_SAMPLER_STATE_COLLECTION, TraceFormat::ShaderStage::TESSELLATION_EVALUATION_SHADER, startUnit, samplerStateCollection);
+		mRenderer->tesSetSamplerStateCollection(startUnit, static_cast<Renderer::ISamplerStateCollection*>(unwrapResource(samplerStateCollection)));
+	}
+
+	void TraceRenderer::tesSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer)
+	{
+		recordShaderStage(TraceFormat::Command::SET_UNIFORM_BUFFER, TraceFormat::ShaderStage::TESSELLATION_EVALUATION_SHADER, slot, uniformBuffer);
+		mRenderer->tesSetUniformBuffer(slot, static_cast<Renderer::IUniformBuffer*>(unwrapResource(uniformBuffer)));
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Geometry-shader (GS) stage                            ]
+	//[-------------------------------------------------------]
+	void TraceRenderer::gsSetTexture(unsigned int unit, Renderer::ITexture *texture)
+	{
+		recordShaderStage(TraceFormat::Command::SET_TEXTURE, TraceFormat::ShaderStage::GEOMETRY_SHADER, unit, texture);
+		mRenderer->gsSetTexture(unit, static_cast<Renderer::ITexture*>(unwrapResource(texture)));
+	}
+
+	void TraceRenderer::gsSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection)
+	{
+		recordShaderStage(TraceFormat::Command::SET_TEXTURE_COLLECTION, TraceFormat::ShaderStage::GEOMETRY_SHADER, startUnit, textureCollection);
+		mRenderer->gsSetTextureCollection(startUnit, static_cast<Renderer::ITextureCollection*>(unwrapResource(textureCollection)));
+	}
+
+	void TraceRenderer::gsSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState)
+	{
+		recordShaderStage(TraceFormat::Command::SET_SAMPLER_STATE, TraceFormat::ShaderStage::GEOMETRY_SHADER, unit, samplerState);
+		mRenderer->gsSetSamplerState(unit, static_cast<Renderer::ISamplerState*>(unwrapResource(samplerState)));
+	}
+
+	void TraceRenderer::gsSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection)
+	{
+		recordShaderStage(TraceFormat::Command::SET_SAMPLER_STATE_COLLECTION, TraceFormat::ShaderStage::GEOMETRY_SHADER, startUnit, samplerStateCollection);
+		mRenderer->gsSetSamplerStateCollection(startUnit, static_cast<Renderer::ISamplerStateCollection*>(unwrapResource(samplerStateCollection)));
+	}
+
+	void TraceRenderer::gsSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer)
+	{
+		recordShaderStage(TraceFormat::Command::SET_UNIFORM_BUFFER, TraceFormat::ShaderStage::GEOMETRY_SHADER, slot, uniformBuffer);
+		mRenderer->gsSetUniformBuffer(slot, static_cast<Renderer::IUniformBuffer*>(unwrapResource(uniformBuffer)));
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Stream-output (SO) stage                              ]
+	//[-------------------------------------------------------]
+	void TraceRenderer::soSetTargets(unsigned int numberOfTargets, Renderer::IVertexBuffer **vertexBuffers, const unsigned int *offsets)
+	{
+		// Record
+		mTraceWriter.beginCommand(TraceFormat::Command::SO_SET_TARGETS);
+		mTraceWriter.writeUInt32(numberOfTargets);
+		for (unsigned int i = 0; i < numberOfTargets; ++i)
+		{
+			mTraceWriter.writeUInt32(getResourceId(vertexBuffers[i]));
+		}
+		mTraceWriter.writeBool(nullptr != offsets);
+		if (nullptr != offsets)
+		{
+			mTraceWriter.writeRaw(offsets, sizeof(unsigned int) * numberOfTargets);
+		}
+
+		// Forward using the wrapped vertex buffers
+		std::vector<Renderer::IVertexBuffer*, Renderer::StlAllocator<Renderer::IVertexBuffer*> > wrappedVertexBuffers(numberOfTargets, nullptr, Renderer::StlAllocator<Renderer::IVertexBuffer*>(getAllocator(), Renderer::AllocationTag::TEMPORARY));
+		for (unsigned int i = 0; i < numberOfTargets; ++i)
+		{
+			wrappedVertexBuffers[i] = static_cast<Renderer::IVertexBuffer*>(unwrapResource(vertexBuffers[i]));
+		}
+		mRenderer->soSetTargets(numberOfTargets, wrappedVertexBuffers.empty() ? nullptr : &wrappedVertexBuffers[0], offsets);
+	}
+
+	void TraceRenderer::soBegin(Renderer::PrimitiveTopology::Enum primitiveTopology, bool rasterizerDiscard)
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::SO_BEGIN);
+		mTraceWriter.writeUInt32(static_cast<unsigned int>(primitiveTopology));
+		mTraceWriter.writeBool(rasterizerDiscard);
+		mRenderer->soBegin(primitiveTopology, rasterizerDiscard);
+	}
+
+	void TraceRenderer::soEnd()
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::SO_END);
+		mRenderer->soEnd();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Rasterizer (RS) stage                                 ]
+	//[-------------------------------------------------------]
+	void TraceRenderer::rsSetViewports(unsigned int numberOfViewports, const Renderer::Viewport *viewports)
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::RS_SET_VIEWPORTS);
+		mTraceWriter.writeUInt32(numberOfViewports);
+		mTraceWriter.writeRaw(viewports, sizeof(Renderer::Viewport) * numberOfViewports);
+		mRenderer->rsSetViewports(numberOfViewports, viewports);
+	}
+
+	void TraceRenderer::rsSetScissorRectangles(unsigned int numberOfScissorRectangles, const Renderer::ScissorRectangle *scissorRectangles)
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::RS_SET_SCISSOR_RECTANGLES);
+		mTraceWriter.writeUInt32(numberOfScissorRectangles);
+		mTraceWriter.writeRaw(scissorRectangles, sizeof(Renderer::ScissorRectangle) * numberOfScissorRectangles);
+		mRenderer->rsSetScissorRectangles(numberOfScissorRectangles, scissorRectangles);
+	}
+
+	void TraceRenderer::rsSetState(Renderer::IRasterizerState *rasterizerState)
+	{
+		recordResource(TraceFormat::Command::RS_SET_STATE, rasterizerState);
+		mRenderer->rsSetState(static_cast<Renderer::IRasterizerState*>(unwrapResource(rasterizerState)));
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Fragment-shader (FS) stage                            ]
+	//[-------------------------------------------------------]
+	void TraceRenderer::fsSetTexture(unsigned int unit, Renderer::ITexture *texture)
+	{
+		recordShaderStage(TraceFormat::Command::SET_TEXTURE, TraceFormat::ShaderStage::FRAGMENT_SHADER, unit, texture);
+		mRenderer->fsSetTexture(unit, static_cast<Renderer::ITexture*>(unwrapResource(texture)));
+	}
+
+	void TraceRenderer::fsSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection)
+	{
+		recordShaderStage(TraceFormat::Command::SET_TEXTURE_COLLECTION, TraceFormat::ShaderStage::FRAGMENT_SHADER, startUnit, textureCollection);
+		mRenderer->fsSetTextureCollection(startUnit, static_cast<Renderer::ITextureCollection*>(unwrapResource(textureCollection)));
+	}
+
+	void TraceRenderer::fsSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState)
+	{
+		recordShaderStage(TraceFormat::Command::SET_SAMPLER_STATE, TraceFormat::ShaderStage::FRAGMENT_SHADER, unit, samplerState);
+		mRenderer->fsSetSamplerState(unit, static_cast<Renderer::ISamplerState*>(unwrapResource(samplerState)));
+	}
+
+	void TraceRenderer::fsSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection)
+	{
+		recordShaderStage(TraceFormat::Command::SET_SAMPLER_STATE_COLLECTION, TraceFormat::ShaderStage::FRAGMENT_SHADER, startUnit, samplerStateCollection);
+		mRenderer->fsSetSamplerStateCollection(startUnit, static_cast<Renderer::ISamplerStateCollection*>(unwrapResource(samplerStateCollection)));
+	}
+
+	void TraceRenderer::fsSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer)
+	{
+		recordShaderStage(TraceFormat::Command::SET_UNIFORM_BUFFER, TraceFormat::ShaderStage::FRAGMENT_SHADER, slot, uniformBuffer);
+		mRenderer->fsSetUniformBuffer(slot, static_cast<Renderer::IUniformBuffer*>(unwrapResource(uniformBuffer)));
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Output-merger (OM) stage                              ]
+	//[-------------------------------------------------------]
+	Renderer::IRenderTarget *TraceRenderer::omGetRenderTarget()
+	{
+		return mRenderTarget;
+	}
+
+	void TraceRenderer::omSetRenderTarget(Renderer::IRenderTarget *renderTarget)
+	{
+		// New render target?
+		if (mRenderTarget != renderTarget)
+		{
+			// Release the render target reference, in case we have one
+			if (nullptr != mRenderTarget)
+			{
+				mRenderTarget->release();
+			}
+
+			// Set new render target and add a reference to it, in case there's one
+			mRenderTarget = renderTarget;
+			if (nullptr != mRenderTarget)
+			{
+				mRenderTarget->addReference();
+			}
+		}
+
+		// Record and forward, even if the render target didn't change because the wrapped renderer might do some work
+		recordResource(TraceFormat::Command::OM_SET_RENDER_TARGET, renderTarget);
+		mRenderer->omSetRenderTarget(static_cast<Renderer::IRenderTarget*>(unwrapResource(renderTarget)));
+	}
+
+	void TraceRenderer::omSetDepthStencilState(Renderer::IDepthStencilState *depthStencilState)
+	{
+		recordResource(TraceFormat::Command::OM_SET_DEPTH_STENCIL_STATE, depthStencilState);
+		mRenderer->omSetDepthStencilState(static_cast<Renderer::IDepthStencilState*>(unwrapResource(depthStencilState)));
+	}
+
+	void TraceRenderer::omSetBlendState(Renderer::IBlendState *blendState)
+	{
+		recordResource(TraceFormat::Command::OM_SET_BLEND_STATE, blendState);
+		mRenderer->omSetBlendState(static_cast<Renderer::IBlendState*>(unwrapResource(blendState)));
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Compute-shader (CS) stage                             ]
+	//[-------------------------------------------------------]
+	void TraceRenderer::csSetTexture(unsigned int unit, Renderer::ITexture *texture)
+	{
+		recordShaderStage(TraceFormat::Command::SET_TEXTURE, TraceFormat::ShaderStage::COMPUTE_SHADER, unit, texture);
+		mRenderer->csSetTexture(unit, static_cast<Renderer::ITexture*>(unwrapResource(texture)));
+	}
+
+	void TraceRenderer::csSetTextureCollection(unsigned int startUnit, Renderer::ITextureCollection *textureCollection)
+	{
+		recordShaderStage(TraceFormat::Command::SET_TEXTURE_COLLECTION, TraceFormat::ShaderStage::COMPUTE_SHADER, startUnit, textureCollection);
+		mRenderer->csSetTextureCollection(startUnit, static_cast<Renderer::ITextureCollection*>(unwrapResource(textureCollection)));
+	}
+
+	void TraceRenderer::csSetSamplerState(unsigned int unit, Renderer::ISamplerState *samplerState)
+	{
+		recordShaderStage(TraceFormat::Command::SET_SAMPLER_STATE, TraceFormat::ShaderStage::COMPUTE_SHADER, unit, samplerState);
+		mRenderer->csSetSamplerState(unit, static_cast<Renderer::ISamplerState*>(unwrapResource(samplerState)));
+	}
+
+	void TraceRenderer::csSetSamplerStateCollection(unsigned int startUnit, Renderer::ISamplerStateCollection *samplerStateCollection)
+	{
+		recordShaderStage(TraceFormat::Command::SET_SAMPLER_STATE_COLLECTION, TraceFormat::ShaderStage::COMPUTE_SHADER, startUnit, samplerStateCollection);
+		mRenderer->csSetSamplerStateCollection(startUnit, static_cast<Renderer::ISamplerStateCollection*>(unwrapResource(samplerStateCollection)));
+	}
+
+	void TraceRenderer::csSetUniformBuffer(unsigned int slot, Renderer::IUniformBuffer *uniformBuffer)
+	{
+		recordShaderStage(TraceFormat::Command::SET_UNIFORM_BUFFER, TraceFormat::ShaderStage::COMPUTE_SHADER, slot, uniformBuffer);
+		mRenderer->csSetUniformBuffer(slot, static_cast<Renderer::IUniformBuffer*>(unwrapResource(uniformBuffer)));
+	}
+
+
+	void TraceRenderer::csSetUnorderedAccessView(unsigned int unit, Renderer::IResource *resource)
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::CS_SET_UNORDERED_ACCESS_VIEW);
+		mTraceWriter.writeUInt32(unit);
+		mTraceWriter.writeUInt32(getResourceId(resource));
+		mRenderer->csSetUnorderedAccessView(unit, unwrapResource(resource));
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Operations                                            ]
+	//[-------------------------------------------------------]
+	void TraceRenderer::clear(unsigned int flags, const float color[4], float z, unsigned int stencil)
+	{
+		// Record
+		static const float DEFAULT_COLOR[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		mTraceWriter.beginCommand(TraceFormat::Command::CLEAR);
+		mTraceWriter.writeUInt32(flags);
+		mTraceWriter.writeFloats((nullptr != color) ? color : DEFAULT_COLOR, 4);
+		mTraceWriter.writeFloat(z);
+		mTraceWriter.writeUInt32(stencil);
+
+		// Forward
+		mRenderer->clear(flags, color, z, stencil);
+	}
+
+	bool TraceRenderer::beginScene()
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::BEGIN_SCENE);
+		return mRenderer->beginScene();
+	}
+
+	void TraceRenderer::endScene()
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::END_SCENE);
+		mRenderer->endScene();
+	}
+
+	void TraceRenderer::resolveMultisampleFramebuffer(Renderer::IRenderTarget &destinationRenderTarget, Renderer::IFramebuffer &sourceMultisampleFramebuffer)
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::RESOLVE_MULTISAMPLE_FRAMEBUFFER);
+		mTraceWriter.writeUInt32(getResourceId(&destinationRenderTarget));
+		mTraceWriter.writeUInt32(getResourceId(&sourceMultisampleFramebuffer));
+		mRenderer->resolveMultisampleFramebuffer(*static_cast<Renderer::IRenderTarget*>(unwrapResource(&destinationRenderTarget)), *static_cast<Renderer::IFramebuffer*>(unwrapResource(&sourceMultisampleFramebuffer)));
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Draw call                                             ]
+	//[-------------------------------------------------------]
+	void TraceRenderer::draw(unsigned int startVertexLocation, unsigned int numberOfVertices)
+	{
+		getStatistics().currentFrame.numberOfPrimitives += Mapping::getNumberOfPrimitives(mPrimitiveTopology, numberOfVertices);
+		mTraceWriter.beginCommand(TraceFormat::Command::DRAW);
+		mTraceWriter.writeUInt32(startVertexLocation);
+		mTraceWriter.writeUInt32(numberOfVertices);
+		mRenderer->draw(startVertexLocation, numberOfVertices);
+	}
+
+	void TraceRenderer::drawInstanced(unsigned int startVertexLocation, unsigned int numberOfVertices, unsigned int numberOfInstances)
+	{
+		getStatistics().currentFrame.numberOfPrimitives += static_cast<unsigned long long>(Mapping::getNumberOfPrimitives(mPrimitiveTopology, numberOfVertices)) * numberOfInstances;
+		mTraceWriter.beginCommand(TraceFormat::Command::DRAW_INSTANCED);
+		mTraceWriter.writeUInt32(startVertexLocation);
+		mTraceWriter.writeUInt32(numberOfVertices);
+		mTraceWriter.writeUInt32(numberOfInstances);
+		mRenderer->drawInstanced(startVertexLocation, numberOfVertices, numberOfInstances);
+	}
+
+	void TraceRenderer::drawIndexed(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int minimumIndex, unsigned int numberOfVertices)
+	{
+		getStatistics().currentFrame.numberOfPrimitives += Mapping::getNumberOfPrimitives(mPrimitiveTopology, numberOfIndices);
+		mTraceWriter.beginCommand(TraceFormat::Command::DRAW_INDEXED);
+		mTraceWriter.writeUInt32(startIndexLocation);
+		mTraceWriter.writeUInt32(numberOfIndices);
+		mTraceWriter.writeUInt32(baseVertexLocation);
+		mTraceWriter.writeUInt32(minimumIndex);
+		mTraceWriter.writeUInt32(numberOfVertices);
+		mRenderer->drawIndexed(startIndexLocation, numberOfIndices, baseVertexLocation, minimumIndex, numberOfVertices);
+	}
+
+	void TraceRenderer::drawIndexedInstanced(unsigned int startIndexLocation, unsigned int numberOfIndices, unsigned int baseVertexLocation, unsigned int minimumIndex, unsigned int numberOfVertices, unsigned int numberOfInstances)
+	{
+		getStatistics().currentFrame.numberOfPrimitives += static_cast<unsigned long long>(Mapping::getNumberOfPrimitives(mPrimitiveTopology, numberOfIndices)) * numberOfInstances;
+		mTraceWriter.beginCommand(TraceFormat::Command::DRAW_INDEXED_INSTANCED);
+		mTraceWriter.writeUInt32(startIndexLocation);
+		mTraceWriter.writeUInt32(numberOfIndices);
+		mTraceWriter.writeUInt32(baseVertexLocation);
+		mTraceWriter.writeUInt32(minimumIndex);
+		mTraceWriter.writeUInt32(numberOfVertices);
+		mTraceWriter.writeUInt32(numberOfInstances);
+		mRenderer->drawIndexedInstanced(startIndexLocation, numberOfIndices, baseVertexLocation, minimumIndex, numberOfVertices, numberOfInstances);
+	}
+
+	void TraceRenderer::multiDrawIndexedIndirect(Renderer::IIndirectBuffer &indirectBuffer, unsigned int indirectBufferOffset, unsigned int numberOfDraws)
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::MULTI_DRAW_INDEXED_INDIRECT);
+		mTraceWriter.writeUInt32(getResourceId(&indirectBuffer));
+		mTraceWriter.writeUInt32(indirectBufferOffset);
+		mTraceWriter.writeUInt32(numberOfDraws);
+		mRenderer->multiDrawIndexedIndirect(*static_cast<Renderer::IIndirectBuffer*>(unwrapResource(&indirectBuffer)), indirectBufferOffset, numberOfDraws);
+	}
+
+	void TraceRenderer::drawAuto()
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::DRAW_AUTO);
+		mRenderer->drawAuto();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Compute                                               ]
+	//[-------------------------------------------------------]
+	void TraceRenderer::dispatch(unsigned int groupCountX, unsigned int groupCountY, unsigned int groupCountZ)
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::DISPATCH);
+		mTraceWriter.writeUInt32(groupCountX);
+		mTraceWriter.writeUInt32(groupCountY);
+		mTraceWriter.writeUInt32(groupCountZ);
+		mRenderer->dispatch(groupCountX, groupCountY, groupCountZ);
+	}
+
+	void TraceRenderer::memoryBarrier(unsigned int flags)
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::MEMORY_BARRIER);
+		mTraceWriter.writeUInt32(flags);
+		mRenderer->memoryBarrier(flags);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Synchronization                                       ]
+	//[-------------------------------------------------------]
+	Renderer::IFence *TraceRenderer::insertFence()
+	{
+		// Forward
+		Renderer::IFence *fence = mRenderer->insertFence();
+		if (nullptr != fence)
+		{
+			// Create the trace fence
+			Fence *traceFence = new (getAllocator()) Fence(*this, *fence);
+
+			// Record
+			mTraceWriter.beginCommand(TraceFormat::Command::INSERT_FENCE);
+			mTraceWriter.writeUInt32(traceFence->getId());
+
+			// Done
+			return traceFence;
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+	bool TraceRenderer::isFenceSignaled(Renderer::IFence &fence)
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::IS_FENCE_SIGNALED);
+		mTraceWriter.writeUInt32(getResourceId(&fence));
+		return mRenderer->isFenceSignaled(*static_cast<Renderer::IFence*>(unwrapResource(&fence)));
+	}
+
+	bool TraceRenderer::waitFence(Renderer::IFence &fence, unsigned int timeout)
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::WAIT_FENCE);
+		mTraceWriter.writeUInt32(getResourceId(&fence));
+		mTraceWriter.writeUInt32(timeout);
+		return mRenderer->waitFence(*static_cast<Renderer::IFence*>(unwrapResource(&fence)), timeout);
+	}
+
+	void TraceRenderer::flush()
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::FLUSH);
+		mRenderer->flush();
+	}
+
+	void TraceRenderer::finish()
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::FINISH);
+		mRenderer->finish();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Swap chain                                            ]
+	//[-------------------------------------------------------]
+	void TraceRenderer::presentSwapChains(unsigned int numberOfSwapChains, Renderer::ISwapChain **swapChains)
+	{
+		// Record one present per swap chain so the trace format stays unchanged, write the recorded frame into the trace file at once
+		std::vector<Renderer::ISwapChain*, Renderer::StlAllocator<Renderer::ISwapChain*> > wrappedSwapChains(numberOfSwapChains, nullptr, Renderer::StlAllocator<Renderer::ISwapChain*>(getAllocator(), Renderer::AllocationTag::TEMPORARY));
+		for (unsigned int i = 0; i < numberOfSwapChains; ++i)
+		{
+			mTraceWriter.beginCommand(TraceFormat::Command::PRESENT);
+			mTraceWriter.writeUInt32(getResourceId(swapChains[i]));
+			wrappedSwapChains[i] = static_cast<Renderer::ISwapChain*>(unwrapResource(swapChains[i]));
+		}
+		mTraceWriter.flush();
+
+		// Forward using the wrapped swap chains
+		mRenderer->presentSwapChains(numberOfSwapChains, wrappedSwapChains.empty() ? nullptr : &wrappedSwapChains[0]);
+
+		// Update the frame statistics
+		for (unsigned int i = 0; i < numberOfSwapChains; ++i)
+		{
+			onPresent(*static_cast<SwapChain*>(swapChains[i]));
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Debug                                                 ]
+	//[-------------------------------------------------------]
+	bool TraceRenderer::isDebugEnabled()
+	{
+		return mRenderer->isDebugEnabled();
+	}
+
+	void TraceRenderer::setDebugMarker(const wchar_t *name)
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::SET_DEBUG_MARKER);
+		mTraceWriter.writeWideString(name);
+		mRenderer->setDebugMarker(name);
+	}
+
+	void TraceRenderer::beginDebugEvent(const wchar_t *name)
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::BEGIN_DEBUG_EVENT);
+		mTraceWriter.writeWideString(name);
+		mRenderer->beginDebugEvent(name);
+	}
+
+	void TraceRenderer::endDebugEvent()
+	{
+		mTraceWriter.beginCommand(TraceFormat::Command::END_DEBUG_EVENT);
+		mRenderer->endDebugEvent();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Return the trace resource of a resource
+	*/
+	TraceResource *TraceRenderer::getTraceResource(Renderer::IResource *resource)
+	{
+		if (nullptr != resource)
+		{
+			switch (resource->getResourceType())
+			{
+				case Renderer::ResourceType::PROGRAM:
+					return static_cast<Program*>(resource);
+
+				case Renderer::ResourceType::VERTEX_ARRAY:
+					return static_cast<VertexArray*>(resource);
+
+				case Renderer::ResourceType::SWAP_CHAIN:
+					return static_cast<SwapChain*>(resource);
+
+				case Renderer::ResourceType::FRAMEBUFFER:
+					return static_cast<Framebuffer*>(resource);
+
+				case Renderer::ResourceType::INDEX_BUFFER:
+					return static_cast<IndexBuffer*>(resource);
+
+				case Renderer::ResourceType::VERTEX_BUFFER:
+					return static_cast<VertexBuffer*>(resource);
+
+				case Renderer::ResourceType::UNIFORM_BUFFER:
+					return static_cast<UniformBuffer*>(resource);
+
+				case Renderer::ResourceType::INDIRECT_BUFFER:
+					return static_cast<IndirectBuffer*>(resource);
+
+				case Renderer::ResourceType::TEXTURE_BUFFER:
+					return static_cast<TextureBuffer*>(resource);
+
+				case Renderer::ResourceType::TEXTURE_2D:
+					return static_cast<Texture2D*>(resource);
+
+				case Renderer::ResourceType::TEXTURE_2D_ARRAY:
+					return static_cast<Texture2DArray*>(resource);
+
+				case Renderer::ResourceType::RASTERIZER_STATE:
+					return static_cast<RasterizerState*>(resource);
+
+				case Renderer::ResourceType::DEPTH_STENCIL_STATE:
+					return static_cast<DepthStencilState*>(resource);
+
+				case Renderer::ResourceType::BLEND_STATE:
+					return static_cast<BlendState*>(resource);
+
+				case Renderer::ResourceType::SAMPLER_STATE:
+					return static_cast<SamplerState*>(resource);
+
+				case Renderer::ResourceType::VERTEX_SHADER:
+					return static_cast<VertexShader*>(resource);
+
+				case Renderer::ResourceType::TESSELLATION_CONTROL_SHADER:
+					return static_cast<TessellationControlShader*>(resource);
+
+				case Renderer::ResourceType::TESSELLATION_EVALUATION_SHADER:
+					return static_cast<TessellationEvaluationShader*>(resource);
+
+				case Renderer::ResourceType::GEOMETRY_SHADER:
+					return static_cast<GeometryShader*>(resource);
+
+				case Renderer::ResourceType::FRAGMENT_SHADER:
+					return static_cast<FragmentShader*>(resource);
+
+				case Renderer::ResourceType::COMPUTE_SHADER:
+					return static_cast<ComputeShader*>(resource);
+
+				case Renderer::ResourceType::TEXTURE_COLLECTION:
+					return static_cast<TextureCollection*>(resource);
+
+				case Renderer::ResourceType::SAMPLER_STATE_COLLECTION:
+					return static_cast<SamplerStateCollection*>(resource);
+
+				case Renderer::ResourceType::FENCE:
+					return static_cast<Fence*>(resource);
+			}
+		}
+
+		// Error!
+		return nullptr;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Initialize the capabilities by using the capabilities of the wrapped renderer
+	*/
+	void TraceRenderer::initializeCapabilities()
+	{
+		// "Renderer::Capabilities" can't be copied as a whole by intent
+		const Renderer::Capabilities &capabilities = mRenderer->getCapabilities();
+		mCapabilities.maximumNumberOfViewports                 = capabilities.maximumNumberOfViewports;
+		mCapabilities.maximumNumberOfSimultaneousRenderTargets = capabilities.maximumNumberOfSimultaneousRenderTargets;
+		mCapabilities.maximumTextureDimension                  = capabilities.maximumTextureDimension;
+		mCapabilities.maximumNumberOf2DTextureArraySlices      = capabilities.maximumNumberOf2DTextureArraySlices;
+		mCapabilities.maximumNumberOfMultisamples              = capabilities.maximumNumberOfMultisamples;
+		mCapabilities.uniformBuffer                            = capabilities.uniformBuffer;
+		mCapabilities.maximumTextureBufferSize                 = capabilities.maximumTextureBufferSize;
+		mCapabilities.individualUniforms                       = capabilities.individualUniforms;
+		mCapabilities.instancedArrays                          = capabilities.instancedArrays;
+		mCapabilities.drawInstanced                            = capabilities.drawInstanced;
+		mCapabilities.baseVertex                               = capabilities.baseVertex;
+		mCapabilities.multiDrawIndirect                        = capabilities.multiDrawIndirect;
+		mCapabilities.bindlessTexture                          = capabilities.bindlessTexture;
+		mCapabilities.vertexShader                             = capabilities.vertexShader;
+		mCapabilities.maximumNumberOfPatchVertices             = capabilities.maximumNumberOfPatchVertices;
+		mCapabilities.maximumNumberOfGsOutputVertices          = capabilities.maximumNumberOfGsOutputVertices;
+		mCapabilities.fragmentShader                           = capabilities.fragmentShader;
+		mCapabilities.computeShader                            = capabilities.computeShader;
+		mCapabilities.maximumNumberOfStreamOutputTargets       = capabilities.maximumNumberOfStreamOutputTargets;
+	}
+
+	/**
+	*  @brief
+	*    Record a shader stage command having a unit or slot and a resource as arguments
+	*/
+	void TraceRenderer::recordShaderStage(TraceFormat::Command::Enum command, TraceFormat::ShaderStage::Enum shaderStage, unsigned int unit, Renderer::IResource *resource)
+	{
+		// Count redundant calls, only the first units are taken into account
+		const unsigned int id = getResourceId(resource);
+		if (unit < NUMBER_OF_UNITS)
+		{
+			unsigned int &previousId = mShaderStageResourceIds[command - TraceFormat::Command::SET_TEXTURE][shaderStage][unit];
+			if (previousId == id)
+			{
+				++getStatistics().currentFrame.numberOfRedundantApiCalls[Mapping::getApiCall(command)];
+			}
+			previousId = id;
+		}
+
+		// Record
+		mTraceWriter.beginCommand(command);
+		mTraceWriter.writeUInt32(static_cast<unsigned int>(shaderStage));
+		mTraceWriter.writeUInt32(unit);
+		mTraceWriter.writeUInt32(id);
+	}
+
+	/**
+	*  @brief
+	*    Record a command having a single resource as argument
+	*/
+	void TraceRenderer::recordResource(TraceFormat::Command::Enum command, Renderer::IResource *resource)
+	{
+		// Count redundant calls
+		const unsigned int id = getResourceId(resource);
+		if (mResourceIds[command] == id)
+		{
+			++getStatistics().currentFrame.numberOfRedundantApiCalls[Mapping::getApiCall(command)];
+		}
+		mResourceIds[command] = id;
+
+		// Record
+		mTraceWriter.beginCommand(command);
+		mTraceWriter.writeUInt32(id);
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
@@ -0,0 +1,135 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/TraceResource.h"
+#include "TraceRenderer/TraceRenderer.h"
+
+#include <Renderer/IResource.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	void TraceResource::addReferencedResource(Renderer::IResource *resource)
+	{
+		if (nullptr != resource)
+		{
+			resource->addReference();
+			mReferencedResources.push_back(resource);
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	TraceResource::TraceResource(TraceRenderer &traceRenderer, Renderer::IResource &wrappedResource) :
+		mTraceRenderer(&traceRenderer),
+		mWrappedResource(&wrappedResource),
+		mId(traceRenderer.getTraceWriter().generateId()),
+		mReferencedResources(Renderer::StlAllocator<Renderer::IResource*>(traceRenderer.getAllocator(), Renderer::AllocationTag::RESOURCE))
+	{
+		mWrappedResource->addReference();
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	TraceResource::~TraceResource()
+	{
+		// Record the destruction of the resource
+		TraceWriter &traceWriter = mTraceRenderer->getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::RELEASE_RESOURCE);
+		traceWriter.writeUInt32(mId);
+
+		// Release the wrapped resource
+		mWrappedResource->release();
+
+		// Release the referenced trace resources, this might destroy them as well
+		const size_t numberOfReferencedResources = mReferencedResources.size();
+		for (size_t i = 0; i < numberOfReferencedResources; ++i)
+		{
+			mReferencedResources[i]->release();
+		}
+	}
+
+	/**
+	*  @brief
+	*    Record and forward the debug name of the resource
+	*/
+	void TraceResource::traceDebugName(const char *name)
+	{
+		// Record
+		TraceWriter &traceWriter = mTraceRenderer->getTraceWriter();
+		traceWriter.beginCommand(TraceFormat::Command::SET_DEBUG_NAME);
+		traceWriter.writeUInt32(mId);
+		traceWriter.writeString(name);
+
+		// Forward
+		mWrappedResource->setDebugName(name);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Copy constructor
+	*/
+	TraceResource::TraceResource(const TraceResource &source) :
+		mTraceRenderer(source.mTraceRenderer),
+		mWrappedResource(source.mWrappedResource),
+		mId(0),
+		mReferencedResources(source.mReferencedResources.get_allocator())
+	{
+		// Not supported
+	}
+
+	/**
+	*  @brief
+	*    Copy operator
+	*/
+	TraceResource &TraceResource::operator =(const TraceResource &)
+	{
+		// Not supported
+		return *this;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
@@ -0,0 +1,248 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "TraceRenderer/TraceWriter.h"
+
+#include <Renderer/IAllocator.h>
+
+#include <string.h>
+#include <wchar.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace TraceRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	TraceWriter::TraceWriter(Renderer::FrameStatistics &frameStatistics, Renderer::IAllocator &allocator) :
+		mFrameStatistics(&frameStatistics),
+		mAllocator(&allocator),
+		mFile(nullptr),
+		mBuffer(nullptr),
+		mNumberOfBufferBytes(0),
+		mNextId(1)
+	{
+		// Nothing to do in here
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	TraceWriter::~TraceWriter()
+	{
+		// Flush and close the trace file, in case it's still open
+		close();
+	}
+
+	/**
+	*  @brief
+	*    Open the trace file and write the file header
+	*/
+	bool TraceWriter::open(const char *filename, const char *rendererName)
+	{
+		// Close the previous trace file, in case there's one
+		close();
+
+		// Create the trace file
+		mFile = fopen(filename, "wb");
+		if (nullptr != mFile)
+		{
+			// Allocate the memory buffer
+			mBuffer = mAllocator->allocateArray<unsigned char>(BUFFER_SIZE, Renderer::AllocationTag::RENDERER);
+			mNumberOfBufferBytes = 0;
+
+			// Write the file header
+			TraceFormat::Header header;
+			memset(&header, 0, sizeof(TraceFormat::Header));
+			header.magic   = TraceFormat::MAGIC;
+			header.version = TraceFormat::VERSION;
+			strncpy(header.rendererName, rendererName, sizeof(header.rendererName) - 1);
+			write(&header, sizeof(TraceFormat::Header));
+
+			// Done
+			return true;
+		}
+
+		// Error!
+		return false;
+	}
+
+	/**
+	*  @brief
+	*    Flush and close the trace file
+	*/
+	void TraceWriter::close()
+	{
+		if (nullptr != mFile)
+		{
+			// Write the rest of the memory buffer
+			flush();
+
+			// Close the trace file
+			fclose(mFile);
+			mFile = nullptr;
+
+			// Destroy the memory buffer
+			mAllocator->deallocateArray(mBuffer, Renderer::AllocationTag::RENDERER);
+			mBuffer = nullptr;
+		}
+	}
+
+	/**
+	*  @brief
+	*    Write the content of the memory buffer into the trace file
+	*/
+	void TraceWriter::flush()
+	{
+		if (nullptr != mFile && mNumberOfBufferBytes > 0)
+		{
+			fwrite(mBuffer, 1, mNumberOfBufferBytes, mFile);
+			fflush(mFile);
+			mNumberOfBufferBytes = 0;
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Command stream                                        ]
+	//[-------------------------------------------------------]
+	void TraceWriter::writeData(const void *data, unsigned int numberOfBytes)
+	{
+		// A null pointer is written as empty data
+		if (nullptr != data)
+		{
+			mFrameStatistics->numberOfUploadedBytes += numberOfBytes;
+			writeUInt32(numberOfBytes);
+			write(data, numberOfBytes);
+		}
+		else
+		{
+			writeUInt32(0);
+		}
+	}
+
+	void TraceWriter::writeString(const char *string)
+	{
+		// The number of bytes includes the terminating zero, so the reader is able to return a pointer into the trace data
+		if (nullptr != string)
+		{
+			const unsigned int numberOfBytes = static_cast<unsigned int>(strlen(string) + 1);
+			writeUInt32(numberOfBytes);
+			write(string, numberOfBytes);
+		}
+		else
+		{
+			writeUInt32(0);
+		}
+	}
+
+	void TraceWriter::writeWideString(const wchar_t *string)
+	{
+		// The size of "wchar_t" is platform dependent, use two bytes per character inside the trace
+		if (nullptr != string)
+		{
+			const unsigned int numberOfCharacters = static_cast<unsigned int>(wcslen(string) + 1);
+			writeUInt32(numberOfCharacters * sizeof(unsigned short));
+			for (unsigned int i = 0; i < numberOfCharacters; ++i)
+			{
+				const unsigned short character = static_cast<unsigned short>(string[i]);
+				write(&character, sizeof(unsigned short));
+			}
+		}
+		else
+		{
+			writeUInt32(0);
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Copy constructor
+	*/
+	TraceWriter::TraceWriter(const TraceWriter &source) :
+		mFrameStatistics(source.mFrameStatistics),
+		mAllocator(source.mAllocator),
+		mFile(nullptr),
+		mBuffer(nullptr),
+		mNumberOfBufferBytes(0),
+		mNextId(1)
+	{
+		// Not supported
+	}
+
+	/**
+	*  @brief
+	*    Copy operator
+	*/
+	TraceWriter &TraceWriter::operator =(const TraceWriter &)
+	{
+		// Not supported
+		return *this;
+	}
+
+	/**
+	*  @brief
+	*    Write the given data into the memory buffer
+	*/
+	void TraceWriter::write(const void *data, unsigned int numberOfBytes)
+	{
+		if (nullptr != mFile)
+		{
+			// Not enough space left inside the memory buffer?
+			if (mNumberOfBufferBytes + numberOfBytes > BUFFER_SIZE)
+			{
+				flush();
+
+				// Write large data directly into the trace file
+				if (numberOfBytes > BUFFER_SIZE)
+				{
+					fwrite(data, 1, numberOfBytes, mFile);
+					return;
+				}
+			}
+
+			// Append the data to the memory buffer
+			memcpy(mBuffer + mNumberOfBufferBytes, data, numberOfBytes);
+			mNumberOfBufferBytes += numberOfBytes;
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // TraceRenderer
@@ -0,0 +1,87 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/Examples/CMakeLists.txt"
+  "/root/repo/Renderer/CMakeLists.txt"
+  "/root/repo/Renderer/NullRenderer/CMakeLists.txt"
+  "/root/repo/Renderer/OpenGLES2Renderer/CMakeLists.txt"
+  "/root/repo/Renderer/OpenGLRenderer/CMakeLists.txt"
+  "/root/repo/Renderer/Renderer/CMakeLists.txt"
+  "/root/repo/Renderer/RendererToolkit/CMakeLists.txt"
+  "/root/repo/Renderer/TraceRenderer/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindFreetype.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Renderer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Renderer/Renderer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Renderer/NullRenderer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Renderer/OpenGLRenderer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Renderer/OpenGLES2Renderer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Renderer/TraceRenderer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Renderer/RendererToolkit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "Renderer/Renderer/CMakeFiles/Renderer.dir/DependInfo.cmake"
+  "Renderer/NullRenderer/CMakeFiles/NullRendererStatic.dir/DependInfo.cmake"
+  "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/DependInfo.cmake"
+  "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/DependInfo.cmake"
+  "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRenderer.dir/DependInfo.cmake"
+  "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2RendererStatic.dir/DependInfo.cmake"
+  "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/DependInfo.cmake"
+  "Renderer/TraceRenderer/CMakeFiles/TraceRendererStatic.dir/DependInfo.cmake"
+  "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/DependInfo.cmake"
+  "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/DependInfo.cmake"
+  "Renderer/RendererToolkit/CMakeFiles/RendererToolkit.dir/DependInfo.cmake"
+  "Examples/CMakeFiles/ExamplesStatic.dir/DependInfo.cmake"
+  "Examples/CMakeFiles/Examples.dir/DependInfo.cmake"
+  "Examples/CMakeFiles/MeshCooker.dir/DependInfo.cmake"
+  "Examples/CMakeFiles/CookedMeshes.dir/DependInfo.cmake"
+  "Examples/CMakeFiles/TraceReplay.dir/DependInfo.cmake"
+  )
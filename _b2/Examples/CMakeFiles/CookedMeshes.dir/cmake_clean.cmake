@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/Data/Imrod/ImrodLowPoly.mesh"
+  "CMakeFiles/CookedMeshes"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CookedMeshes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
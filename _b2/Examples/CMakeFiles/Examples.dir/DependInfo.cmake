@@ -0,0 +1,60 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Examples/src/AssimpMesh/AssimpMesh.cpp" "Examples/CMakeFiles/Examples.dir/src/AssimpMesh/AssimpMesh.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/AssimpMesh/AssimpMesh.cpp.o.d"
+  "/root/repo/Examples/src/AssimpMesh/Mesh.cpp" "Examples/CMakeFiles/Examples.dir/src/AssimpMesh/Mesh.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/AssimpMesh/Mesh.cpp.o.d"
+  "/root/repo/Examples/src/FirstAssimp/FirstAssimp.cpp" "Examples/CMakeFiles/Examples.dir/src/FirstAssimp/FirstAssimp.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/FirstAssimp/FirstAssimp.cpp.o.d"
+  "/root/repo/Examples/src/FirstAssimp/PointsMesh.cpp" "Examples/CMakeFiles/Examples.dir/src/FirstAssimp/PointsMesh.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/FirstAssimp/PointsMesh.cpp.o.d"
+  "/root/repo/Examples/src/FirstFont/FirstFont.cpp" "Examples/CMakeFiles/Examples.dir/src/FirstFont/FirstFont.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/FirstFont/FirstFont.cpp.o.d"
+  "/root/repo/Examples/src/FirstGeometryShader/FirstGeometryShader.cpp" "Examples/CMakeFiles/Examples.dir/src/FirstGeometryShader/FirstGeometryShader.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/FirstGeometryShader/FirstGeometryShader.cpp.o.d"
+  "/root/repo/Examples/src/FirstGpgpu/FirstGpgpu.cpp" "Examples/CMakeFiles/Examples.dir/src/FirstGpgpu/FirstGpgpu.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/FirstGpgpu/FirstGpgpu.cpp.o.d"
+  "/root/repo/Examples/src/FirstInstancing/FirstInstancing.cpp" "Examples/CMakeFiles/Examples.dir/src/FirstInstancing/FirstInstancing.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/FirstInstancing/FirstInstancing.cpp.o.d"
+  "/root/repo/Examples/src/FirstMultipleRenderTargets/FirstMultipleRenderTargets.cpp" "Examples/CMakeFiles/Examples.dir/src/FirstMultipleRenderTargets/FirstMultipleRenderTargets.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/FirstMultipleRenderTargets/FirstMultipleRenderTargets.cpp.o.d"
+  "/root/repo/Examples/src/FirstMultipleSwapChains/FirstMultipleSwapChains.cpp" "Examples/CMakeFiles/Examples.dir/src/FirstMultipleSwapChains/FirstMultipleSwapChains.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/FirstMultipleSwapChains/FirstMultipleSwapChains.cpp.o.d"
+  "/root/repo/Examples/src/FirstPostProcessing/FirstPostProcessing.cpp" "Examples/CMakeFiles/Examples.dir/src/FirstPostProcessing/FirstPostProcessing.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/FirstPostProcessing/FirstPostProcessing.cpp.o.d"
+  "/root/repo/Examples/src/FirstRenderToTexture/FirstRenderToTexture.cpp" "Examples/CMakeFiles/Examples.dir/src/FirstRenderToTexture/FirstRenderToTexture.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/FirstRenderToTexture/FirstRenderToTexture.cpp.o.d"
+  "/root/repo/Examples/src/FirstTessellation/FirstTessellation.cpp" "Examples/CMakeFiles/Examples.dir/src/FirstTessellation/FirstTessellation.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/FirstTessellation/FirstTessellation.cpp.o.d"
+  "/root/repo/Examples/src/FirstTexture/FirstTexture.cpp" "Examples/CMakeFiles/Examples.dir/src/FirstTexture/FirstTexture.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/FirstTexture/FirstTexture.cpp.o.d"
+  "/root/repo/Examples/src/FirstTriangle/FirstTriangle.cpp" "Examples/CMakeFiles/Examples.dir/src/FirstTriangle/FirstTriangle.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/FirstTriangle/FirstTriangle.cpp.o.d"
+  "/root/repo/Examples/src/Framework/ApplicationImplLinux.cpp" "Examples/CMakeFiles/Examples.dir/src/Framework/ApplicationImplLinux.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/Framework/ApplicationImplLinux.cpp.o.d"
+  "/root/repo/Examples/src/Framework/Color4.cpp" "Examples/CMakeFiles/Examples.dir/src/Framework/Color4.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/Framework/Color4.cpp.o.d"
+  "/root/repo/Examples/src/Framework/EulerAngles.cpp" "Examples/CMakeFiles/Examples.dir/src/Framework/EulerAngles.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/Framework/EulerAngles.cpp.o.d"
+  "/root/repo/Examples/src/Framework/IApplication.cpp" "Examples/CMakeFiles/Examples.dir/src/Framework/IApplication.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/Framework/IApplication.cpp.o.d"
+  "/root/repo/Examples/src/Framework/IApplicationImpl.cpp" "Examples/CMakeFiles/Examples.dir/src/Framework/IApplicationImpl.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/Framework/IApplicationImpl.cpp.o.d"
+  "/root/repo/Examples/src/Framework/IApplicationRenderer.cpp" "Examples/CMakeFiles/Examples.dir/src/Framework/IApplicationRenderer.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/Framework/IApplicationRenderer.cpp.o.d"
+  "/root/repo/Examples/src/Framework/IApplicationRendererToolkit.cpp" "Examples/CMakeFiles/Examples.dir/src/Framework/IApplicationRendererToolkit.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/Framework/IApplicationRendererToolkit.cpp.o.d"
+  "/root/repo/Examples/src/Framework/MemoryMappedFile.cpp" "Examples/CMakeFiles/Examples.dir/src/Framework/MemoryMappedFile.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/Framework/MemoryMappedFile.cpp.o.d"
+  "/root/repo/Examples/src/Framework/Stopwatch.cpp" "Examples/CMakeFiles/Examples.dir/src/Framework/Stopwatch.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/Framework/Stopwatch.cpp.o.d"
+  "/root/repo/Examples/src/Framework/TGALoader.cpp" "Examples/CMakeFiles/Examples.dir/src/Framework/TGALoader.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/Framework/TGALoader.cpp.o.d"
+  "/root/repo/Examples/src/Framework/X11Application.cpp" "Examples/CMakeFiles/Examples.dir/src/Framework/X11Application.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/Framework/X11Application.cpp.o.d"
+  "/root/repo/Examples/src/Framework/X11Window.cpp" "Examples/CMakeFiles/Examples.dir/src/Framework/X11Window.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/Framework/X11Window.cpp.o.d"
+  "/root/repo/Examples/src/Fxaa/Fxaa.cpp" "Examples/CMakeFiles/Examples.dir/src/Fxaa/Fxaa.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/Fxaa/Fxaa.cpp.o.d"
+  "/root/repo/Examples/src/IcosahedronTessellation/IcosahedronTessellation.cpp" "Examples/CMakeFiles/Examples.dir/src/IcosahedronTessellation/IcosahedronTessellation.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/IcosahedronTessellation/IcosahedronTessellation.cpp.o.d"
+  "/root/repo/Examples/src/InstancedCubes/CubeRendererDrawInstanced/BatchDrawInstanced.cpp" "Examples/CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererDrawInstanced/BatchDrawInstanced.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererDrawInstanced/BatchDrawInstanced.cpp.o.d"
+  "/root/repo/Examples/src/InstancedCubes/CubeRendererDrawInstanced/CubeRendererDrawInstanced.cpp" "Examples/CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererDrawInstanced/CubeRendererDrawInstanced.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererDrawInstanced/CubeRendererDrawInstanced.cpp.o.d"
+  "/root/repo/Examples/src/InstancedCubes/CubeRendererInstancedArrays/BatchInstancedArrays.cpp" "Examples/CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererInstancedArrays/BatchInstancedArrays.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererInstancedArrays/BatchInstancedArrays.cpp.o.d"
+  "/root/repo/Examples/src/InstancedCubes/CubeRendererInstancedArrays/CubeRendererInstancedArrays.cpp" "Examples/CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererInstancedArrays/CubeRendererInstancedArrays.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererInstancedArrays/CubeRendererInstancedArrays.cpp.o.d"
+  "/root/repo/Examples/src/InstancedCubes/FrustumCulling.cpp" "Examples/CMakeFiles/Examples.dir/src/InstancedCubes/FrustumCulling.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/InstancedCubes/FrustumCulling.cpp.o.d"
+  "/root/repo/Examples/src/InstancedCubes/ICubeRenderer.cpp" "Examples/CMakeFiles/Examples.dir/src/InstancedCubes/ICubeRenderer.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/InstancedCubes/ICubeRenderer.cpp.o.d"
+  "/root/repo/Examples/src/InstancedCubes/InstancedCubes.cpp" "Examples/CMakeFiles/Examples.dir/src/InstancedCubes/InstancedCubes.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/InstancedCubes/InstancedCubes.cpp.o.d"
+  "/root/repo/Examples/src/Main.cpp" "Examples/CMakeFiles/Examples.dir/src/Main.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/Main.cpp.o.d"
+  "/root/repo/Examples/src/MeshCooker/MeshCooker.cpp" "Examples/CMakeFiles/Examples.dir/src/MeshCooker/MeshCooker.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/MeshCooker/MeshCooker.cpp.o.d"
+  "/root/repo/Examples/src/MeshCooker/MeshOptimizer.cpp" "Examples/CMakeFiles/Examples.dir/src/MeshCooker/MeshOptimizer.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/MeshCooker/MeshOptimizer.cpp.o.d"
+  "/root/repo/Examples/src/MeshCooker/MeshSimplifier.cpp" "Examples/CMakeFiles/Examples.dir/src/MeshCooker/MeshSimplifier.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/MeshCooker/MeshSimplifier.cpp.o.d"
+  "/root/repo/Examples/src/VertexBuffer/VertexBuffer.cpp" "Examples/CMakeFiles/Examples.dir/src/VertexBuffer/VertexBuffer.cpp.o" "gcc" "Examples/CMakeFiles/Examples.dir/src/VertexBuffer/VertexBuffer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_b2/Renderer/RendererToolkit/CMakeFiles/RendererToolkit.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
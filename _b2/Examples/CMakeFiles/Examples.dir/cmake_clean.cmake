@@ -0,0 +1,91 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Examples.dir/src/AssimpMesh/AssimpMesh.cpp.o"
+  "CMakeFiles/Examples.dir/src/AssimpMesh/AssimpMesh.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/AssimpMesh/Mesh.cpp.o"
+  "CMakeFiles/Examples.dir/src/AssimpMesh/Mesh.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/FirstAssimp/FirstAssimp.cpp.o"
+  "CMakeFiles/Examples.dir/src/FirstAssimp/FirstAssimp.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/FirstAssimp/PointsMesh.cpp.o"
+  "CMakeFiles/Examples.dir/src/FirstAssimp/PointsMesh.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/FirstFont/FirstFont.cpp.o"
+  "CMakeFiles/Examples.dir/src/FirstFont/FirstFont.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/FirstGeometryShader/FirstGeometryShader.cpp.o"
+  "CMakeFiles/Examples.dir/src/FirstGeometryShader/FirstGeometryShader.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/FirstGpgpu/FirstGpgpu.cpp.o"
+  "CMakeFiles/Examples.dir/src/FirstGpgpu/FirstGpgpu.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/FirstInstancing/FirstInstancing.cpp.o"
+  "CMakeFiles/Examples.dir/src/FirstInstancing/FirstInstancing.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/FirstMultipleRenderTargets/FirstMultipleRenderTargets.cpp.o"
+  "CMakeFiles/Examples.dir/src/FirstMultipleRenderTargets/FirstMultipleRenderTargets.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/FirstMultipleSwapChains/FirstMultipleSwapChains.cpp.o"
+  "CMakeFiles/Examples.dir/src/FirstMultipleSwapChains/FirstMultipleSwapChains.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/FirstPostProcessing/FirstPostProcessing.cpp.o"
+  "CMakeFiles/Examples.dir/src/FirstPostProcessing/FirstPostProcessing.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/FirstRenderToTexture/FirstRenderToTexture.cpp.o"
+  "CMakeFiles/Examples.dir/src/FirstRenderToTexture/FirstRenderToTexture.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/FirstTessellation/FirstTessellation.cpp.o"
+  "CMakeFiles/Examples.dir/src/FirstTessellation/FirstTessellation.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/FirstTexture/FirstTexture.cpp.o"
+  "CMakeFiles/Examples.dir/src/FirstTexture/FirstTexture.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/FirstTriangle/FirstTriangle.cpp.o"
+  "CMakeFiles/Examples.dir/src/FirstTriangle/FirstTriangle.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/Framework/ApplicationImplLinux.cpp.o"
+  "CMakeFiles/Examples.dir/src/Framework/ApplicationImplLinux.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/Framework/Color4.cpp.o"
+  "CMakeFiles/Examples.dir/src/Framework/Color4.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/Framework/EulerAngles.cpp.o"
+  "CMakeFiles/Examples.dir/src/Framework/EulerAngles.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/Framework/IApplication.cpp.o"
+  "CMakeFiles/Examples.dir/src/Framework/IApplication.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/Framework/IApplicationImpl.cpp.o"
+  "CMakeFiles/Examples.dir/src/Framework/IApplicationImpl.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/Framework/IApplicationRenderer.cpp.o"
+  "CMakeFiles/Examples.dir/src/Framework/IApplicationRenderer.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/Framework/IApplicationRendererToolkit.cpp.o"
+  "CMakeFiles/Examples.dir/src/Framework/IApplicationRendererToolkit.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/Framework/MemoryMappedFile.cpp.o"
+  "CMakeFiles/Examples.dir/src/Framework/MemoryMappedFile.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/Framework/Stopwatch.cpp.o"
+  "CMakeFiles/Examples.dir/src/Framework/Stopwatch.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/Framework/TGALoader.cpp.o"
+  "CMakeFiles/Examples.dir/src/Framework/TGALoader.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/Framework/X11Application.cpp.o"
+  "CMakeFiles/Examples.dir/src/Framework/X11Application.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/Framework/X11Window.cpp.o"
+  "CMakeFiles/Examples.dir/src/Framework/X11Window.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/Fxaa/Fxaa.cpp.o"
+  "CMakeFiles/Examples.dir/src/Fxaa/Fxaa.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/IcosahedronTessellation/IcosahedronTessellation.cpp.o"
+  "CMakeFiles/Examples.dir/src/IcosahedronTessellation/IcosahedronTessellation.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererDrawInstanced/BatchDrawInstanced.cpp.o"
+  "CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererDrawInstanced/BatchDrawInstanced.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererDrawInstanced/CubeRendererDrawInstanced.cpp.o"
+  "CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererDrawInstanced/CubeRendererDrawInstanced.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererInstancedArrays/BatchInstancedArrays.cpp.o"
+  "CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererInstancedArrays/BatchInstancedArrays.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererInstancedArrays/CubeRendererInstancedArrays.cpp.o"
+  "CMakeFiles/Examples.dir/src/InstancedCubes/CubeRendererInstancedArrays/CubeRendererInstancedArrays.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/InstancedCubes/FrustumCulling.cpp.o"
+  "CMakeFiles/Examples.dir/src/InstancedCubes/FrustumCulling.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/InstancedCubes/ICubeRenderer.cpp.o"
+  "CMakeFiles/Examples.dir/src/InstancedCubes/ICubeRenderer.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/InstancedCubes/InstancedCubes.cpp.o"
+  "CMakeFiles/Examples.dir/src/InstancedCubes/InstancedCubes.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/Main.cpp.o"
+  "CMakeFiles/Examples.dir/src/Main.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/MeshCooker/MeshCooker.cpp.o"
+  "CMakeFiles/Examples.dir/src/MeshCooker/MeshCooker.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/MeshCooker/MeshOptimizer.cpp.o"
+  "CMakeFiles/Examples.dir/src/MeshCooker/MeshOptimizer.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/MeshCooker/MeshSimplifier.cpp.o"
+  "CMakeFiles/Examples.dir/src/MeshCooker/MeshSimplifier.cpp.o.d"
+  "CMakeFiles/Examples.dir/src/VertexBuffer/VertexBuffer.cpp.o"
+  "CMakeFiles/Examples.dir/src/VertexBuffer/VertexBuffer.cpp.o.d"
+  "Examples"
+  "Examples.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Examples.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,91 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ExamplesStatic.dir/src/AssimpMesh/AssimpMesh.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/AssimpMesh/AssimpMesh.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/AssimpMesh/Mesh.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/AssimpMesh/Mesh.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstAssimp/FirstAssimp.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstAssimp/FirstAssimp.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstAssimp/PointsMesh.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstAssimp/PointsMesh.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstFont/FirstFont.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstFont/FirstFont.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstGeometryShader/FirstGeometryShader.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstGeometryShader/FirstGeometryShader.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstGpgpu/FirstGpgpu.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstGpgpu/FirstGpgpu.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstInstancing/FirstInstancing.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstInstancing/FirstInstancing.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstMultipleRenderTargets/FirstMultipleRenderTargets.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstMultipleRenderTargets/FirstMultipleRenderTargets.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstMultipleSwapChains/FirstMultipleSwapChains.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstMultipleSwapChains/FirstMultipleSwapChains.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstPostProcessing/FirstPostProcessing.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstPostProcessing/FirstPostProcessing.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstRenderToTexture/FirstRenderToTexture.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstRenderToTexture/FirstRenderToTexture.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstTessellation/FirstTessellation.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstTessellation/FirstTessellation.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstTexture/FirstTexture.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstTexture/FirstTexture.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstTriangle/FirstTriangle.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/FirstTriangle/FirstTriangle.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/ApplicationImplLinux.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/ApplicationImplLinux.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/Color4.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/Color4.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/EulerAngles.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/EulerAngles.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/IApplication.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/IApplication.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/IApplicationImpl.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/IApplicationImpl.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/IApplicationRenderer.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/IApplicationRenderer.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/IApplicationRendererToolkit.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/IApplicationRendererToolkit.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/MemoryMappedFile.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/MemoryMappedFile.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/Stopwatch.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/Stopwatch.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/TGALoader.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/TGALoader.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/X11Application.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/X11Application.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/X11Window.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/Framework/X11Window.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/Fxaa/Fxaa.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/Fxaa/Fxaa.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/IcosahedronTessellation/IcosahedronTessellation.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/IcosahedronTessellation/IcosahedronTessellation.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/InstancedCubes/CubeRendererDrawInstanced/BatchDrawInstanced.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/InstancedCubes/CubeRendererDrawInstanced/BatchDrawInstanced.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/InstancedCubes/CubeRendererDrawInstanced/CubeRendererDrawInstanced.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/InstancedCubes/CubeRendererDrawInstanced/CubeRendererDrawInstanced.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/InstancedCubes/CubeRendererInstancedArrays/BatchInstancedArrays.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/InstancedCubes/CubeRendererInstancedArrays/BatchInstancedArrays.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/InstancedCubes/CubeRendererInstancedArrays/CubeRendererInstancedArrays.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/InstancedCubes/CubeRendererInstancedArrays/CubeRendererInstancedArrays.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/InstancedCubes/FrustumCulling.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/InstancedCubes/FrustumCulling.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/InstancedCubes/ICubeRenderer.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/InstancedCubes/ICubeRenderer.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/InstancedCubes/InstancedCubes.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/InstancedCubes/InstancedCubes.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/Main.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/Main.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/MeshCooker/MeshCooker.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/MeshCooker/MeshCooker.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/MeshCooker/MeshOptimizer.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/MeshCooker/MeshOptimizer.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/MeshCooker/MeshSimplifier.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/MeshCooker/MeshSimplifier.cpp.o.d"
+  "CMakeFiles/ExamplesStatic.dir/src/VertexBuffer/VertexBuffer.cpp.o"
+  "CMakeFiles/ExamplesStatic.dir/src/VertexBuffer/VertexBuffer.cpp.o.d"
+  "ExamplesStatic"
+  "ExamplesStatic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ExamplesStatic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Examples/src/MeshCooker/Main.cpp" "Examples/CMakeFiles/MeshCooker.dir/src/MeshCooker/Main.cpp.o" "gcc" "Examples/CMakeFiles/MeshCooker.dir/src/MeshCooker/Main.cpp.o.d"
+  "/root/repo/Examples/src/MeshCooker/MeshCooker.cpp" "Examples/CMakeFiles/MeshCooker.dir/src/MeshCooker/MeshCooker.cpp.o" "gcc" "Examples/CMakeFiles/MeshCooker.dir/src/MeshCooker/MeshCooker.cpp.o.d"
+  "/root/repo/Examples/src/MeshCooker/MeshOptimizer.cpp" "Examples/CMakeFiles/MeshCooker.dir/src/MeshCooker/MeshOptimizer.cpp.o" "gcc" "Examples/CMakeFiles/MeshCooker.dir/src/MeshCooker/MeshOptimizer.cpp.o.d"
+  "/root/repo/Examples/src/MeshCooker/MeshSimplifier.cpp" "Examples/CMakeFiles/MeshCooker.dir/src/MeshCooker/MeshSimplifier.cpp.o" "gcc" "Examples/CMakeFiles/MeshCooker.dir/src/MeshCooker/MeshSimplifier.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
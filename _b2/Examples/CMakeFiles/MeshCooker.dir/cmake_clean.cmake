@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MeshCooker.dir/src/MeshCooker/Main.cpp.o"
+  "CMakeFiles/MeshCooker.dir/src/MeshCooker/Main.cpp.o.d"
+  "CMakeFiles/MeshCooker.dir/src/MeshCooker/MeshCooker.cpp.o"
+  "CMakeFiles/MeshCooker.dir/src/MeshCooker/MeshCooker.cpp.o.d"
+  "CMakeFiles/MeshCooker.dir/src/MeshCooker/MeshOptimizer.cpp.o"
+  "CMakeFiles/MeshCooker.dir/src/MeshCooker/MeshOptimizer.cpp.o.d"
+  "CMakeFiles/MeshCooker.dir/src/MeshCooker/MeshSimplifier.cpp.o"
+  "CMakeFiles/MeshCooker.dir/src/MeshCooker/MeshSimplifier.cpp.o.d"
+  "MeshCooker"
+  "MeshCooker.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MeshCooker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Examples/src/Framework/MemoryMappedFile.cpp" "Examples/CMakeFiles/TraceReplay.dir/src/Framework/MemoryMappedFile.cpp.o" "gcc" "Examples/CMakeFiles/TraceReplay.dir/src/Framework/MemoryMappedFile.cpp.o.d"
+  "/root/repo/Examples/src/Framework/Stopwatch.cpp" "Examples/CMakeFiles/TraceReplay.dir/src/Framework/Stopwatch.cpp.o" "gcc" "Examples/CMakeFiles/TraceReplay.dir/src/Framework/Stopwatch.cpp.o.d"
+  "/root/repo/Examples/src/TraceReplay/Main.cpp" "Examples/CMakeFiles/TraceReplay.dir/src/TraceReplay/Main.cpp.o" "gcc" "Examples/CMakeFiles/TraceReplay.dir/src/TraceReplay/Main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_b2/Renderer/TraceRenderer/CMakeFiles/TraceRendererStatic.dir/DependInfo.cmake"
+  "/root/repo/_b2/Renderer/NullRenderer/CMakeFiles/NullRendererStatic.dir/DependInfo.cmake"
+  "/root/repo/_b2/Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/DependInfo.cmake"
+  "/root/repo/_b2/Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2RendererStatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TraceReplay.dir/src/Framework/MemoryMappedFile.cpp.o"
+  "CMakeFiles/TraceReplay.dir/src/Framework/MemoryMappedFile.cpp.o.d"
+  "CMakeFiles/TraceReplay.dir/src/Framework/Stopwatch.cpp.o"
+  "CMakeFiles/TraceReplay.dir/src/Framework/Stopwatch.cpp.o.d"
+  "CMakeFiles/TraceReplay.dir/src/TraceReplay/Main.cpp.o"
+  "CMakeFiles/TraceReplay.dir/src/TraceReplay/Main.cpp.o.d"
+  "TraceReplay"
+  "TraceReplay.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TraceReplay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
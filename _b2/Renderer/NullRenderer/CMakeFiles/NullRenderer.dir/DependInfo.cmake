@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Renderer/NullRenderer/src/BlendState.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/BlendState.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/BlendState.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/ComputeShader.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/ComputeShader.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/ComputeShader.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/DepthStencilState.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/DepthStencilState.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/DepthStencilState.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/Fence.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/Fence.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/Fence.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/FragmentShader.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/FragmentShader.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/FragmentShader.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/Framebuffer.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/Framebuffer.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/Framebuffer.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/GeometryShader.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/GeometryShader.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/GeometryShader.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/IndexBuffer.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/IndexBuffer.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/IndexBuffer.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/IndirectBuffer.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/IndirectBuffer.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/IndirectBuffer.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/NullRenderer.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/NullRenderer.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/NullRenderer.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/Program.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/Program.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/Program.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/RasterizerState.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/RasterizerState.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/RasterizerState.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/SamplerState.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/SamplerState.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/SamplerState.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/SamplerStateCollection.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/SamplerStateCollection.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/SamplerStateCollection.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/ShaderLanguage.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/ShaderLanguage.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/ShaderLanguage.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/SwapChain.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/SwapChain.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/SwapChain.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/TessellationControlShader.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/TessellationControlShader.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/TessellationControlShader.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/TessellationEvaluationShader.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/TessellationEvaluationShader.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/TessellationEvaluationShader.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/Texture2D.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/Texture2D.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/Texture2D.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/Texture2DArray.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/Texture2DArray.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/Texture2DArray.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/TextureBuffer.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/TextureBuffer.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/TextureBuffer.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/TextureCollection.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/TextureCollection.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/TextureCollection.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/UniformBuffer.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/UniformBuffer.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/UniformBuffer.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/VertexArray.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/VertexArray.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/VertexArray.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/VertexBuffer.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/VertexBuffer.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/VertexBuffer.cpp.o.d"
+  "/root/repo/Renderer/NullRenderer/src/VertexShader.cpp" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/VertexShader.cpp.o" "gcc" "Renderer/NullRenderer/CMakeFiles/NullRenderer.dir/src/VertexShader.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/NullRenderer.dir/src/BlendState.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/BlendState.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/ComputeShader.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/ComputeShader.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/DepthStencilState.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/DepthStencilState.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/Fence.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/Fence.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/FragmentShader.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/FragmentShader.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/Framebuffer.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/Framebuffer.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/GeometryShader.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/GeometryShader.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/IndexBuffer.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/IndexBuffer.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/IndirectBuffer.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/IndirectBuffer.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/NullRenderer.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/NullRenderer.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/Program.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/Program.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/RasterizerState.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/RasterizerState.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/SamplerState.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/SamplerState.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/SamplerStateCollection.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/SamplerStateCollection.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/ShaderLanguage.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/ShaderLanguage.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/SwapChain.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/SwapChain.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/TessellationControlShader.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/TessellationControlShader.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/TessellationEvaluationShader.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/TessellationEvaluationShader.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/Texture2D.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/Texture2D.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/Texture2DArray.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/Texture2DArray.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/TextureBuffer.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/TextureBuffer.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/TextureCollection.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/TextureCollection.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/UniformBuffer.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/UniformBuffer.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/VertexArray.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/VertexArray.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/VertexBuffer.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/VertexBuffer.cpp.o.d"
+  "CMakeFiles/NullRenderer.dir/src/VertexShader.cpp.o"
+  "CMakeFiles/NullRenderer.dir/src/VertexShader.cpp.o.d"
+  "libNullRenderer.pdb"
+  "libNullRenderer.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/NullRenderer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/NullRendererStatic.dir/src/BlendState.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/BlendState.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/ComputeShader.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/ComputeShader.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/DepthStencilState.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/DepthStencilState.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/Fence.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/Fence.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/FragmentShader.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/FragmentShader.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/Framebuffer.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/Framebuffer.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/GeometryShader.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/GeometryShader.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/IndexBuffer.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/IndexBuffer.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/IndirectBuffer.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/IndirectBuffer.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/NullRenderer.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/NullRenderer.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/Program.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/Program.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/RasterizerState.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/RasterizerState.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/SamplerState.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/SamplerState.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/SamplerStateCollection.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/SamplerStateCollection.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/ShaderLanguage.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/ShaderLanguage.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/SwapChain.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/SwapChain.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/TessellationControlShader.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/TessellationControlShader.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/TessellationEvaluationShader.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/TessellationEvaluationShader.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/Texture2D.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/Texture2D.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/Texture2DArray.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/Texture2DArray.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/TextureBuffer.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/TextureBuffer.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/TextureCollection.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/TextureCollection.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/UniformBuffer.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/UniformBuffer.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/VertexArray.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/VertexArray.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/VertexBuffer.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/VertexBuffer.cpp.o.d"
+  "CMakeFiles/NullRendererStatic.dir/src/VertexShader.cpp.o"
+  "CMakeFiles/NullRendererStatic.dir/src/VertexShader.cpp.o.d"
+  "libNullRendererStatic.a"
+  "libNullRendererStatic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/NullRendererStatic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,48 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Renderer/OpenGLES2Renderer/src/BlendState.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/BlendState.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/BlendState.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/ContextRuntimeLinking.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/ContextRuntimeLinking.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/ContextRuntimeLinking.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/DepthStencilState.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/DepthStencilState.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/DepthStencilState.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/ExtensionsRuntimeLinking.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/ExtensionsRuntimeLinking.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/ExtensionsRuntimeLinking.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/FragmentShader.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/FragmentShader.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/FragmentShader.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/FragmentShaderGlsl.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/FragmentShaderGlsl.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/FragmentShaderGlsl.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/Framebuffer.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/Framebuffer.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/Framebuffer.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/IContext.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/IContext.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/IContext.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/IExtensions.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/IExtensions.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/IExtensions.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/IndexBuffer.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/IndexBuffer.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/IndexBuffer.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/IndirectBuffer.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/IndirectBuffer.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/IndirectBuffer.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/Mapping.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/Mapping.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/Mapping.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/OpenGLES2Renderer.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/OpenGLES2Renderer.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/OpenGLES2Renderer.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/Program.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/Program.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/Program.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/ProgramGlsl.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/ProgramGlsl.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/ProgramGlsl.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/RasterizerState.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/RasterizerState.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/RasterizerState.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/SamplerState.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/SamplerState.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/SamplerState.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/SamplerStateCollection.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/SamplerStateCollection.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/SamplerStateCollection.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/ShaderLanguage.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/ShaderLanguage.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/ShaderLanguage.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/ShaderLanguageGlsl.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/ShaderLanguageGlsl.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/ShaderLanguageGlsl.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/SwapChain.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/SwapChain.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/SwapChain.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/Texture2D.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/Texture2D.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/Texture2D.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/Texture2DArray.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/Texture2DArray.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/Texture2DArray.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/TextureCollection.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/TextureCollection.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/TextureCollection.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/VertexArray.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/VertexArray.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/VertexArray.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/VertexArrayNoVao.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/VertexArrayNoVao.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/VertexArrayNoVao.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/VertexArrayVao.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/VertexArrayVao.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/VertexArrayVao.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/VertexBuffer.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/VertexBuffer.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/VertexBuffer.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/VertexShader.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/VertexShader.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/VertexShader.cpp.o.d"
+  "/root/repo/Renderer/OpenGLES2Renderer/src/VertexShaderGlsl.cpp" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/VertexShaderGlsl.cpp.o" "gcc" "Renderer/OpenGLES2Renderer/CMakeFiles/OpenGLES2Renderer.dir/src/VertexShaderGlsl.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,69 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/OpenGLES2Renderer.dir/src/BlendState.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/BlendState.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/ContextRuntimeLinking.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/ContextRuntimeLinking.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/DepthStencilState.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/DepthStencilState.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/ExtensionsRuntimeLinking.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/ExtensionsRuntimeLinking.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/FragmentShader.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/FragmentShader.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/FragmentShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/FragmentShaderGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/Framebuffer.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/Framebuffer.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/IContext.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/IContext.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/IExtensions.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/IExtensions.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/IndexBuffer.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/IndexBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/IndirectBuffer.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/IndirectBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/Mapping.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/Mapping.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/OpenGLES2Renderer.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/OpenGLES2Renderer.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/Program.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/Program.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/ProgramGlsl.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/ProgramGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/RasterizerState.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/RasterizerState.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/SamplerState.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/SamplerState.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/SamplerStateCollection.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/SamplerStateCollection.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/ShaderLanguage.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/ShaderLanguage.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/ShaderLanguageGlsl.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/ShaderLanguageGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/SwapChain.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/SwapChain.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/Texture2D.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/Texture2D.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/Texture2DArray.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/Texture2DArray.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/TextureCollection.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/TextureCollection.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/VertexArray.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/VertexArray.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/VertexArrayNoVao.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/VertexArrayNoVao.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/VertexArrayVao.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/VertexArrayVao.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/VertexBuffer.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/VertexBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/VertexShader.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/VertexShader.cpp.o.d"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/VertexShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLES2Renderer.dir/src/VertexShaderGlsl.cpp.o.d"
+  "libOpenGLES2Renderer.pdb"
+  "libOpenGLES2Renderer.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OpenGLES2Renderer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,69 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/BlendState.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/BlendState.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/ContextRuntimeLinking.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/ContextRuntimeLinking.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/DepthStencilState.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/DepthStencilState.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/ExtensionsRuntimeLinking.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/ExtensionsRuntimeLinking.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/FragmentShader.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/FragmentShader.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/FragmentShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/FragmentShaderGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/Framebuffer.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/Framebuffer.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/IContext.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/IContext.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/IExtensions.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/IExtensions.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/IndexBuffer.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/IndexBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/IndirectBuffer.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/IndirectBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/Mapping.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/Mapping.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/OpenGLES2Renderer.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/OpenGLES2Renderer.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/Program.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/Program.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/ProgramGlsl.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/ProgramGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/RasterizerState.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/RasterizerState.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/SamplerState.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/SamplerState.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/SamplerStateCollection.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/SamplerStateCollection.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/ShaderLanguage.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/ShaderLanguage.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/ShaderLanguageGlsl.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/ShaderLanguageGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/SwapChain.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/SwapChain.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/Texture2D.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/Texture2D.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/Texture2DArray.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/Texture2DArray.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/TextureCollection.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/TextureCollection.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/VertexArray.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/VertexArray.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/VertexArrayNoVao.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/VertexArrayNoVao.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/VertexArrayVao.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/VertexArrayVao.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/VertexBuffer.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/VertexBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/VertexShader.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/VertexShader.cpp.o.d"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/VertexShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLES2RendererStatic.dir/src/VertexShaderGlsl.cpp.o.d"
+  "libOpenGLES2RendererStatic.a"
+  "libOpenGLES2RendererStatic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OpenGLES2RendererStatic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
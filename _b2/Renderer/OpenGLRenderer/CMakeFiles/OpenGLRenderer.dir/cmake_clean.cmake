@@ -0,0 +1,145 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/OpenGLRenderer.dir/src/BindlessTextureHandles.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/BindlessTextureHandles.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/BlendState.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/BlendState.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/ComputeShader.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/ComputeShader.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/ComputeShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/ComputeShaderGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/DepthStencilState.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/DepthStencilState.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/Extensions.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/Extensions.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/Fence.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/Fence.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/FragmentShader.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/FragmentShader.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/FragmentShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/FragmentShaderGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/Framebuffer.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/Framebuffer.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/FramebufferBind.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/FramebufferBind.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/FramebufferDsa.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/FramebufferDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/GeometryShader.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/GeometryShader.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/GeometryShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/GeometryShaderGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/IContext.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/IContext.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/IndexBuffer.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/IndexBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/IndexBufferBind.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/IndexBufferBind.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/IndexBufferDsa.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/IndexBufferDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/IndirectBuffer.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/IndirectBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/IndirectBufferBind.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/IndirectBufferBind.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/IndirectBufferDsa.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/IndirectBufferDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/IndirectBufferEmulation.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/IndirectBufferEmulation.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/Linux/ContextLinux.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/Linux/ContextLinux.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/Linux/ExtensionsLinux.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/Linux/ExtensionsLinux.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/Mapping.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/Mapping.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/OpenGLRenderer.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/OpenGLRenderer.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/OpenGLRuntimeLinking.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/OpenGLRuntimeLinking.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/PixelUnpackBufferPool.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/PixelUnpackBufferPool.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/Program.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/Program.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/ProgramGlsl.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/ProgramGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/ProgramGlslDsa.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/ProgramGlslDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/RasterizerState.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/RasterizerState.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/SamplerState.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/SamplerState.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/SamplerStateBind.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/SamplerStateBind.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/SamplerStateCollection.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/SamplerStateCollection.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/SamplerStateDsa.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/SamplerStateDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/SamplerStateSo.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/SamplerStateSo.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/ShaderLanguage.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/ShaderLanguage.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/ShaderLanguageGlsl.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/ShaderLanguageGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/SwapChain.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/SwapChain.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/TessellationControlShader.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/TessellationControlShader.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/TessellationControlShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/TessellationControlShaderGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/TessellationEvaluationShader.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/TessellationEvaluationShader.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/TessellationEvaluationShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/TessellationEvaluationShaderGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/Texture2D.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/Texture2D.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/Texture2DArray.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/Texture2DArray.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/Texture2DArrayBind.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/Texture2DArrayBind.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/Texture2DArrayDsa.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/Texture2DArrayDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/Texture2DBind.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/Texture2DBind.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/Texture2DDsa.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/Texture2DDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/TextureBuffer.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/TextureBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/TextureBufferBind.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/TextureBufferBind.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/TextureBufferDsa.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/TextureBufferDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/TextureCollection.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/TextureCollection.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/UniformBuffer.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/UniformBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/UniformBufferGlsl.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/UniformBufferGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/UniformBufferGlslBind.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/UniformBufferGlslBind.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/UniformBufferGlslDsa.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/UniformBufferGlslDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexArray.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexArray.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexArrayNoVao.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexArrayNoVao.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexArrayVao.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexArrayVao.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexArrayVaoBind.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexArrayVaoBind.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexArrayVaoDsa.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexArrayVaoDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexBuffer.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexBufferBind.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexBufferBind.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexBufferDsa.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexBufferDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexShader.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexShader.cpp.o.d"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLRenderer.dir/src/VertexShaderGlsl.cpp.o.d"
+  "libOpenGLRenderer.pdb"
+  "libOpenGLRenderer.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OpenGLRenderer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,86 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Renderer/OpenGLRenderer/src/BindlessTextureHandles.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/BindlessTextureHandles.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/BindlessTextureHandles.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/BlendState.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/BlendState.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/BlendState.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/ComputeShader.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/ComputeShader.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/ComputeShader.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/ComputeShaderGlsl.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/ComputeShaderGlsl.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/ComputeShaderGlsl.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/DepthStencilState.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/DepthStencilState.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/DepthStencilState.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/Extensions.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Extensions.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Extensions.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/Fence.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Fence.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Fence.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/FragmentShader.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/FragmentShader.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/FragmentShader.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/FragmentShaderGlsl.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/FragmentShaderGlsl.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/FragmentShaderGlsl.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/Framebuffer.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Framebuffer.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Framebuffer.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/FramebufferBind.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/FramebufferBind.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/FramebufferBind.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/FramebufferDsa.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/FramebufferDsa.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/FramebufferDsa.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/GeometryShader.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/GeometryShader.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/GeometryShader.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/GeometryShaderGlsl.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/GeometryShaderGlsl.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/GeometryShaderGlsl.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/IContext.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IContext.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IContext.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/IndexBuffer.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IndexBuffer.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IndexBuffer.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/IndexBufferBind.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IndexBufferBind.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IndexBufferBind.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/IndexBufferDsa.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IndexBufferDsa.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IndexBufferDsa.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/IndirectBuffer.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBuffer.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBuffer.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/IndirectBufferBind.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBufferBind.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBufferBind.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/IndirectBufferDsa.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBufferDsa.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBufferDsa.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/IndirectBufferEmulation.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBufferEmulation.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBufferEmulation.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/Linux/ContextLinux.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Linux/ContextLinux.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Linux/ContextLinux.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/Linux/ExtensionsLinux.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Linux/ExtensionsLinux.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Linux/ExtensionsLinux.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/Mapping.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Mapping.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Mapping.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/OpenGLRenderer.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/OpenGLRenderer.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/OpenGLRenderer.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/OpenGLRuntimeLinking.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/OpenGLRuntimeLinking.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/OpenGLRuntimeLinking.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/PixelUnpackBufferPool.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/PixelUnpackBufferPool.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/PixelUnpackBufferPool.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/Program.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Program.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Program.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/ProgramGlsl.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/ProgramGlsl.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/ProgramGlsl.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/ProgramGlslDsa.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/ProgramGlslDsa.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/ProgramGlslDsa.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/RasterizerState.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/RasterizerState.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/RasterizerState.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/SamplerState.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/SamplerState.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/SamplerState.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/SamplerStateBind.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateBind.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateBind.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/SamplerStateCollection.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateCollection.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateCollection.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/SamplerStateDsa.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateDsa.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateDsa.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/SamplerStateSo.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateSo.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateSo.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/ShaderLanguage.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/ShaderLanguage.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/ShaderLanguage.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/ShaderLanguageGlsl.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/ShaderLanguageGlsl.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/ShaderLanguageGlsl.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/SwapChain.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/SwapChain.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/SwapChain.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/TessellationControlShader.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TessellationControlShader.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TessellationControlShader.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/TessellationControlShaderGlsl.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TessellationControlShaderGlsl.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TessellationControlShaderGlsl.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/TessellationEvaluationShader.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TessellationEvaluationShader.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TessellationEvaluationShader.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/TessellationEvaluationShaderGlsl.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TessellationEvaluationShaderGlsl.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TessellationEvaluationShaderGlsl.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/Texture2D.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Texture2D.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Texture2D.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/Texture2DArray.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DArray.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DArray.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/Texture2DArrayBind.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DArrayBind.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DArrayBind.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/Texture2DArrayDsa.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DArrayDsa.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DArrayDsa.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/Texture2DBind.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DBind.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DBind.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/Texture2DDsa.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DDsa.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DDsa.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/TextureBuffer.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TextureBuffer.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TextureBuffer.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/TextureBufferBind.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TextureBufferBind.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TextureBufferBind.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/TextureBufferDsa.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TextureBufferDsa.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TextureBufferDsa.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/TextureCollection.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TextureCollection.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/TextureCollection.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/UniformBuffer.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/UniformBuffer.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/UniformBuffer.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/UniformBufferGlsl.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/UniformBufferGlsl.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/UniformBufferGlsl.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/UniformBufferGlslBind.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/UniformBufferGlslBind.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/UniformBufferGlslBind.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/UniformBufferGlslDsa.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/UniformBufferGlslDsa.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/UniformBufferGlslDsa.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/VertexArray.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexArray.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexArray.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/VertexArrayNoVao.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayNoVao.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayNoVao.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/VertexArrayVao.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayVao.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayVao.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/VertexArrayVaoBind.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayVaoBind.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayVaoBind.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/VertexArrayVaoDsa.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayVaoDsa.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayVaoDsa.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/VertexBuffer.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexBuffer.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexBuffer.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/VertexBufferBind.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexBufferBind.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexBufferBind.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/VertexBufferDsa.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexBufferDsa.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexBufferDsa.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/VertexShader.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexShader.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexShader.cpp.o.d"
+  "/root/repo/Renderer/OpenGLRenderer/src/VertexShaderGlsl.cpp" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexShaderGlsl.cpp.o" "gcc" "Renderer/OpenGLRenderer/CMakeFiles/OpenGLRendererStatic.dir/src/VertexShaderGlsl.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,145 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/OpenGLRendererStatic.dir/src/BindlessTextureHandles.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/BindlessTextureHandles.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/BlendState.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/BlendState.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/ComputeShader.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/ComputeShader.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/ComputeShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/ComputeShaderGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/DepthStencilState.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/DepthStencilState.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Extensions.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Extensions.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Fence.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Fence.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/FragmentShader.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/FragmentShader.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/FragmentShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/FragmentShaderGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Framebuffer.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Framebuffer.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/FramebufferBind.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/FramebufferBind.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/FramebufferDsa.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/FramebufferDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/GeometryShader.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/GeometryShader.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/GeometryShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/GeometryShaderGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IContext.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IContext.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IndexBuffer.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IndexBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IndexBufferBind.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IndexBufferBind.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IndexBufferDsa.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IndexBufferDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBuffer.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBufferBind.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBufferBind.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBufferDsa.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBufferDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBufferEmulation.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/IndirectBufferEmulation.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Linux/ContextLinux.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Linux/ContextLinux.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Linux/ExtensionsLinux.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Linux/ExtensionsLinux.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Mapping.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Mapping.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/OpenGLRenderer.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/OpenGLRenderer.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/OpenGLRuntimeLinking.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/OpenGLRuntimeLinking.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/PixelUnpackBufferPool.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/PixelUnpackBufferPool.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Program.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Program.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/ProgramGlsl.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/ProgramGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/ProgramGlslDsa.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/ProgramGlslDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/RasterizerState.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/RasterizerState.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/SamplerState.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/SamplerState.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateBind.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateBind.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateCollection.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateCollection.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateDsa.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateSo.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/SamplerStateSo.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/ShaderLanguage.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/ShaderLanguage.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/ShaderLanguageGlsl.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/ShaderLanguageGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/SwapChain.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/SwapChain.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TessellationControlShader.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TessellationControlShader.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TessellationControlShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TessellationControlShaderGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TessellationEvaluationShader.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TessellationEvaluationShader.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TessellationEvaluationShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TessellationEvaluationShaderGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Texture2D.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Texture2D.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DArray.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DArray.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DArrayBind.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DArrayBind.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DArrayDsa.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DArrayDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DBind.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DBind.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DDsa.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/Texture2DDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TextureBuffer.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TextureBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TextureBufferBind.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TextureBufferBind.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TextureBufferDsa.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TextureBufferDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TextureCollection.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/TextureCollection.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/UniformBuffer.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/UniformBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/UniformBufferGlsl.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/UniformBufferGlsl.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/UniformBufferGlslBind.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/UniformBufferGlslBind.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/UniformBufferGlslDsa.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/UniformBufferGlslDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexArray.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexArray.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayNoVao.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayNoVao.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayVao.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayVao.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayVaoBind.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayVaoBind.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayVaoDsa.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexArrayVaoDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexBuffer.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexBuffer.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexBufferBind.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexBufferBind.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexBufferDsa.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexBufferDsa.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexShader.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexShader.cpp.o.d"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexShaderGlsl.cpp.o"
+  "CMakeFiles/OpenGLRendererStatic.dir/src/VertexShaderGlsl.cpp.o.d"
+  "libOpenGLRendererStatic.a"
+  "libOpenGLRendererStatic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OpenGLRendererStatic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RendererToolkit.dir/src/AssetLoader.cpp.o"
+  "CMakeFiles/RendererToolkit.dir/src/AssetLoader.cpp.o.d"
+  "CMakeFiles/RendererToolkit.dir/src/FontGlyphTextureFreeType.cpp.o"
+  "CMakeFiles/RendererToolkit.dir/src/FontGlyphTextureFreeType.cpp.o.d"
+  "CMakeFiles/RendererToolkit.dir/src/FontTextureFreeType.cpp.o"
+  "CMakeFiles/RendererToolkit.dir/src/FontTextureFreeType.cpp.o.d"
+  "CMakeFiles/RendererToolkit.dir/src/FreeTypeContext.cpp.o"
+  "CMakeFiles/RendererToolkit.dir/src/FreeTypeContext.cpp.o.d"
+  "CMakeFiles/RendererToolkit.dir/src/JobSystem.cpp.o"
+  "CMakeFiles/RendererToolkit.dir/src/JobSystem.cpp.o.d"
+  "CMakeFiles/RendererToolkit.dir/src/MeshBatch.cpp.o"
+  "CMakeFiles/RendererToolkit.dir/src/MeshBatch.cpp.o.d"
+  "CMakeFiles/RendererToolkit.dir/src/RendererToolkitImpl.cpp.o"
+  "CMakeFiles/RendererToolkit.dir/src/RendererToolkitImpl.cpp.o.d"
+  "libRendererToolkit.pdb"
+  "libRendererToolkit.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RendererToolkit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Renderer/RendererToolkit/src/AssetLoader.cpp" "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/src/AssetLoader.cpp.o" "gcc" "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/src/AssetLoader.cpp.o.d"
+  "/root/repo/Renderer/RendererToolkit/src/FontGlyphTextureFreeType.cpp" "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/src/FontGlyphTextureFreeType.cpp.o" "gcc" "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/src/FontGlyphTextureFreeType.cpp.o.d"
+  "/root/repo/Renderer/RendererToolkit/src/FontTextureFreeType.cpp" "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/src/FontTextureFreeType.cpp.o" "gcc" "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/src/FontTextureFreeType.cpp.o.d"
+  "/root/repo/Renderer/RendererToolkit/src/FreeTypeContext.cpp" "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/src/FreeTypeContext.cpp.o" "gcc" "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/src/FreeTypeContext.cpp.o.d"
+  "/root/repo/Renderer/RendererToolkit/src/JobSystem.cpp" "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/src/JobSystem.cpp.o" "gcc" "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/src/JobSystem.cpp.o.d"
+  "/root/repo/Renderer/RendererToolkit/src/MeshBatch.cpp" "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/src/MeshBatch.cpp.o" "gcc" "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/src/MeshBatch.cpp.o.d"
+  "/root/repo/Renderer/RendererToolkit/src/RendererToolkitImpl.cpp" "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/src/RendererToolkitImpl.cpp.o" "gcc" "Renderer/RendererToolkit/CMakeFiles/RendererToolkitStatic.dir/src/RendererToolkitImpl.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RendererToolkitStatic.dir/src/AssetLoader.cpp.o"
+  "CMakeFiles/RendererToolkitStatic.dir/src/AssetLoader.cpp.o.d"
+  "CMakeFiles/RendererToolkitStatic.dir/src/FontGlyphTextureFreeType.cpp.o"
+  "CMakeFiles/RendererToolkitStatic.dir/src/FontGlyphTextureFreeType.cpp.o.d"
+  "CMakeFiles/RendererToolkitStatic.dir/src/FontTextureFreeType.cpp.o"
+  "CMakeFiles/RendererToolkitStatic.dir/src/FontTextureFreeType.cpp.o.d"
+  "CMakeFiles/RendererToolkitStatic.dir/src/FreeTypeContext.cpp.o"
+  "CMakeFiles/RendererToolkitStatic.dir/src/FreeTypeContext.cpp.o.d"
+  "CMakeFiles/RendererToolkitStatic.dir/src/JobSystem.cpp.o"
+  "CMakeFiles/RendererToolkitStatic.dir/src/JobSystem.cpp.o.d"
+  "CMakeFiles/RendererToolkitStatic.dir/src/MeshBatch.cpp.o"
+  "CMakeFiles/RendererToolkitStatic.dir/src/MeshBatch.cpp.o.d"
+  "CMakeFiles/RendererToolkitStatic.dir/src/RendererToolkitImpl.cpp.o"
+  "CMakeFiles/RendererToolkitStatic.dir/src/RendererToolkitImpl.cpp.o.d"
+  "libRendererToolkitStatic.a"
+  "libRendererToolkitStatic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RendererToolkitStatic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,48 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Renderer/TraceRenderer/src/BlendState.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/BlendState.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/BlendState.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/ComputeShader.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/ComputeShader.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/ComputeShader.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/DepthStencilState.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/DepthStencilState.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/DepthStencilState.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/Fence.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/Fence.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/Fence.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/FragmentShader.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/FragmentShader.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/FragmentShader.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/Framebuffer.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/Framebuffer.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/Framebuffer.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/GeometryShader.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/GeometryShader.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/GeometryShader.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/IndexBuffer.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/IndexBuffer.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/IndexBuffer.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/IndirectBuffer.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/IndirectBuffer.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/IndirectBuffer.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/Mapping.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/Mapping.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/Mapping.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/Program.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/Program.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/Program.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/RasterizerState.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/RasterizerState.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/RasterizerState.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/SamplerState.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/SamplerState.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/SamplerState.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/SamplerStateCollection.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/SamplerStateCollection.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/SamplerStateCollection.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/ShaderLanguage.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/ShaderLanguage.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/ShaderLanguage.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/SwapChain.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/SwapChain.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/SwapChain.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/TessellationControlShader.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TessellationControlShader.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TessellationControlShader.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/TessellationEvaluationShader.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TessellationEvaluationShader.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TessellationEvaluationShader.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/Texture2D.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/Texture2D.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/Texture2D.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/Texture2DArray.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/Texture2DArray.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/Texture2DArray.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/TextureBuffer.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TextureBuffer.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TextureBuffer.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/TextureCollection.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TextureCollection.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TextureCollection.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/TracePlayer.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TracePlayer.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TracePlayer.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/TraceRenderer.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TraceRenderer.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TraceRenderer.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/TraceResource.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TraceResource.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TraceResource.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/TraceWriter.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TraceWriter.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/TraceWriter.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/UniformBuffer.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/UniformBuffer.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/UniformBuffer.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/VertexArray.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/VertexArray.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/VertexArray.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/VertexBuffer.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/VertexBuffer.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/VertexBuffer.cpp.o.d"
+  "/root/repo/Renderer/TraceRenderer/src/VertexShader.cpp" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/VertexShader.cpp.o" "gcc" "Renderer/TraceRenderer/CMakeFiles/TraceRenderer.dir/src/VertexShader.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,69 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TraceRenderer.dir/src/BlendState.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/BlendState.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/ComputeShader.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/ComputeShader.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/DepthStencilState.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/DepthStencilState.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/Fence.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/Fence.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/FragmentShader.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/FragmentShader.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/Framebuffer.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/Framebuffer.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/GeometryShader.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/GeometryShader.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/IndexBuffer.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/IndexBuffer.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/IndirectBuffer.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/IndirectBuffer.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/Mapping.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/Mapping.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/Program.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/Program.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/RasterizerState.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/RasterizerState.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/SamplerState.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/SamplerState.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/SamplerStateCollection.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/SamplerStateCollection.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/ShaderLanguage.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/ShaderLanguage.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/SwapChain.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/SwapChain.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/TessellationControlShader.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/TessellationControlShader.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/TessellationEvaluationShader.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/TessellationEvaluationShader.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/Texture2D.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/Texture2D.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/Texture2DArray.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/Texture2DArray.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/TextureBuffer.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/TextureBuffer.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/TextureCollection.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/TextureCollection.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/TracePlayer.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/TracePlayer.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/TraceRenderer.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/TraceRenderer.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/TraceResource.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/TraceResource.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/TraceWriter.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/TraceWriter.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/UniformBuffer.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/UniformBuffer.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/VertexArray.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/VertexArray.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/VertexBuffer.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/VertexBuffer.cpp.o.d"
+  "CMakeFiles/TraceRenderer.dir/src/VertexShader.cpp.o"
+  "CMakeFiles/TraceRenderer.dir/src/VertexShader.cpp.o.d"
+  "libTraceRenderer.pdb"
+  "libTraceRenderer.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TraceRenderer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,69 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TraceRendererStatic.dir/src/BlendState.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/BlendState.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/ComputeShader.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/ComputeShader.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/DepthStencilState.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/DepthStencilState.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/Fence.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/Fence.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/FragmentShader.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/FragmentShader.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/Framebuffer.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/Framebuffer.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/GeometryShader.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/GeometryShader.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/IndexBuffer.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/IndexBuffer.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/IndirectBuffer.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/IndirectBuffer.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/Mapping.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/Mapping.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/Program.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/Program.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/RasterizerState.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/RasterizerState.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/SamplerState.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/SamplerState.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/SamplerStateCollection.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/SamplerStateCollection.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/ShaderLanguage.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/ShaderLanguage.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/SwapChain.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/SwapChain.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/TessellationControlShader.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/TessellationControlShader.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/TessellationEvaluationShader.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/TessellationEvaluationShader.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/Texture2D.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/Texture2D.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/Texture2DArray.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/Texture2DArray.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/TextureBuffer.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/TextureBuffer.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/TextureCollection.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/TextureCollection.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/TracePlayer.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/TracePlayer.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/TraceRenderer.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/TraceRenderer.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/TraceResource.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/TraceResource.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/TraceWriter.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/TraceWriter.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/UniformBuffer.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/UniformBuffer.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/VertexArray.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/VertexArray.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/VertexBuffer.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/VertexBuffer.cpp.o.d"
+  "CMakeFiles/TraceRendererStatic.dir/src/VertexShader.cpp.o"
+  "CMakeFiles/TraceRendererStatic.dir/src/VertexShader.cpp.o.d"
+  "libTraceRendererStatic.a"
+  "libTraceRendererStatic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TraceRendererStatic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
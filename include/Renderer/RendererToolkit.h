@@ -0,0 +1,219 @@
+/*********************************************************\
+ * Copyright (c) 2012-2013 Christian Ofenberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+// Comfort header putting everything within a single header, only includes the renderer header
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+#ifndef __RENDERERTOOLKIT_H__
+#define __RENDERERTOOLKIT_H__
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/Renderer.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Forward declarations                                  ]
+	//[-------------------------------------------------------]
+	class IFont;
+	class IJobSystem;
+	class IAssetLoader;
+	class IMeshBatch;
+	class IRendererToolkit;
+
+
+	//[-------------------------------------------------------]
+	//[ Types                                                 ]
+	//[-------------------------------------------------------]
+	// RendererToolkit/IRendererToolkit.h
+	class IRendererToolkit : public Renderer::RefCount<IRendererToolkit>
+	{
+	public:
+		virtual ~IRendererToolkit();
+		inline Renderer::IRenderer &getRenderer() const
+		{
+			return *mRenderer;
+		}
+	public:
+		virtual IFont *createFontTexture(const char *filename, unsigned int size = 12, unsigned int resolution = 96) = 0;
+		virtual IMeshBatch *createMeshBatch(unsigned int numberOfBytesPerVertex) = 0;
+		virtual IJobSystem &getJobSystem() = 0;
+		virtual IAssetLoader *createAssetLoader() = 0;
+	protected:
+		IRendererToolkit();
+		explicit IRendererToolkit(const IRendererToolkit &source);
+		IRendererToolkit &operator =(const IRendererToolkit &source);
+	private:
+		Renderer::IRenderer *mRenderer;
+	};
+	typedef Renderer::SmartRefCount<IRendererToolkit> IRendererToolkitPtr;
+
+	// RendererToolkit/IFont.h
+	class IFont : public Renderer::RefCount<IFont>
+	{
+	public:
+		enum EDrawFlags
+		{
+			CENTER_TEXT    = 1<<0,
+			UNDERLINE_TEXT = 1<<1,
+			CROSSOUT_TEXT  = 1<<2,
+			MIPMAPPING     = 1<<3
+		};
+	public:
+		virtual ~IFont();
+		inline unsigned int getSize() const
+		{
+			return mSize;
+		}
+		inline unsigned int getResolution() const
+		{
+			return mResolution;
+		}
+		inline unsigned int getSizeInPixels() const
+		{
+			return static_cast<unsigned int>(mSize / 72.0f * mResolution);
+		}
+		inline unsigned int getHeightInPixels() const
+		{
+			return static_cast<unsigned int>(getHeight() / 72.0f * mResolution);
+		}
+	public:
+		virtual bool setSize(unsigned int size = 12, unsigned int resolution = 96) = 0;
+		virtual bool isValid() const = 0;
+		virtual float getAscender() const = 0;
+		virtual float getDescender() const = 0;
+		virtual float getHeight() const = 0;
+		virtual float getTextWidth(const char *text) = 0;
+		virtual void drawText(const char *text, const float *color, const float objectSpaceToClipSpace[16], float scaleX = 1.0f, float scaleY = 1.0f, float biasX = 0.0f, float biasY = 0.0f, unsigned int flags = 0) = 0;
+	protected:
+		IFont();
+		explicit IFont(const IFont &source);
+		IFont &operator =(const IFont &source);
+	protected:
+		unsigned int mSize;
+		unsigned int mResolution;
+	};
+	typedef Renderer::SmartRefCount<IFont> IFontPtr;
+
+	// RendererToolkit/IMeshBatch.h
+	class IMeshBatch : public Renderer::RefCount<IMeshBatch>
+	{
+	public:
+		virtual ~IMeshBatch();
+		inline unsigned int getNumberOfBytesPerVertex() const
+		{
+			return mNumberOfBytesPerVertex;
+		}
+	public:
+		virtual unsigned int addMesh(const void *vertexData, unsigned int numberOfVertices, const unsigned int *indices, unsigned int numberOfIndices) = 0;
+		virtual unsigned int getNumberOfMeshes() const = 0;
+		virtual Renderer::IVertexArray *createVertexArray(Renderer::IProgram &program, unsigned int numberOfAttributes, const Renderer::VertexArrayAttribute *attributes) = 0;
+		virtual void clearDraws() = 0;
+		virtual bool addDraw(unsigned int meshIndex, unsigned int numberOfInstances = 1, unsigned int startInstanceLocation = 0) = 0;
+		virtual unsigned int getNumberOfDraws() const = 0;
+		virtual void draw(Renderer::PrimitiveTopology::Enum primitiveTopology = Renderer::PrimitiveTopology::TRIANGLE_LIST, unsigned int firstDraw = 0, unsigned int numberOfDraws = ~0u) = 0;
+	protected:
+		explicit IMeshBatch(unsigned int numberOfBytesPerVertex);
+		explicit IMeshBatch(const IMeshBatch &source);
+		IMeshBatch &operator =(const IMeshBatch &source);
+	protected:
+		unsigned int mNumberOfBytesPerVertex;
+	};
+	typedef Renderer::SmartRefCount<IMeshBatch> IMeshBatchPtr;
+
+	// RendererToolkit/IJobSystem.h
+	class IJobSystem : public Renderer::RefCount<IJobSystem>
+	{
+	public:
+		typedef void (*JobFunction)(void *data, unsigned int firstElement, unsigned int lastElement);
+		struct Job;
+	public:
+		virtual ~IJobSystem();
+	public:
+		virtual unsigned int getNumberOfWorkerThreads() const = 0;
+		virtual Job *createJob(JobFunction function, void *data, unsigned int numberOfElements = 1, unsigned int numberOfElementsPerJob = 0) = 0;
+		virtual bool addDependency(Job &job, Job &dependency) = 0;
+		virtual void run(Job &job) = 0;
+		virtual void wait(Job &job) = 0;
+		virtual void parallelFor(JobFunction function, void *data, unsigned int numberOfElements, unsigned int numberOfElementsPerJob = 0) = 0;
+	protected:
+		IJobSystem();
+		explicit IJobSystem(const IJobSystem &source);
+		IJobSystem &operator =(const IJobSystem &source);
+	};
+	typedef Renderer::SmartRefCount<IJobSystem> IJobSystemPtr;
+
+	// RendererToolkit/IAssetLoader.h
+	class IAssetLoader : public Renderer::RefCount<IAssetLoader>
+	{
+	public:
+		typedef void *(*LoadFunction)(const char *filename, void *data);
+		typedef void (*CreateFunction)(void *loadedAsset, void *data);
+		typedef void (*DestroyFunction)(void *loadedAsset, void *data);
+	public:
+		virtual ~IAssetLoader();
+		inline float getProgress() const
+		{
+			const unsigned int numberOfRequests = getNumberOfRequests();
+			return (numberOfRequests > 0) ? static_cast<float>(getNumberOfLoadedRequests() + getNumberOfFinishedRequests()) / (2 * numberOfRequests) : 1.0f;
+		}
+		inline bool isFinished() const
+		{
+			return (getNumberOfFinishedRequests() == getNumberOfRequests());
+		}
+	public:
+		virtual bool addRequest(const char *filename, LoadFunction loadFunction, CreateFunction createFunction, DestroyFunction destroyFunction, void *data) = 0;
+		virtual unsigned int getNumberOfRequests() const = 0;
+		virtual unsigned int getNumberOfLoadedRequests() const = 0;
+		virtual unsigned int getNumberOfFinishedRequests() const = 0;
+		virtual bool start() = 0;
+		virtual unsigned int update(float maximumMilliseconds) = 0;
+		virtual void flush() = 0;
+	protected:
+		IAssetLoader();
+		explicit IAssetLoader(const IAssetLoader &source);
+		IAssetLoader &operator =(const IAssetLoader &source);
+	};
+	typedef Renderer::SmartRefCount<IAssetLoader> IAssetLoaderPtr;
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#endif // __RENDERERTOOLKIT_H__